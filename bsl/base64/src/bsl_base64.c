@@ -211,65 +211,6 @@ int32_t BSL_BASE64_Encode(const uint8_t *srcBuf, const uint32_t srcBufLen, char
     return BSL_SUCCESS;
 }
 
-static void BslBase64DecodeRemoveBlank(const uint8_t *buf, const uint32_t bufLen, uint8_t *destBuf, uint32_t *destLen)
-{
-    uint32_t fast = 0;
-    uint32_t slow = 0;
-    for (; fast < bufLen; fast++) {
-        if (BASE64_DECODE_MAP_TABLE[buf[fast]] != 64U) { /* when the character is not ' ' or '\r', '\n' */
-            destBuf[slow++] = buf[fast];
-        }
-    }
-    *destLen = slow;
-}
-
-static int32_t BslBase64DecodeCheckAndRmvEqualSign(uint8_t *buf, uint32_t *bufLen)
-{
-    int32_t ret = BSL_SUCCESS;
-    uint32_t i = 0;
-    bool hasEqualSign = false;
-    uint32_t len = *bufLen;
-    for (; i < len; i++) {
-        /* Check whether the characters are invalid characters in the Base64 mapping table. */
-        if (BASE64_DECODE_MAP_TABLE[buf[i]] > 65U) {
-            /* 66U is the status code of invalid characters. */
-            return BSL_BASE64_INVALID_CHARACTER;
-        }
-        /* Process the '=' */
-        if (BASE64_DECODE_MAP_TABLE[buf[i]] == 65U) {
-            hasEqualSign = true;
-            /* 65U is the status code with the '=' */
-            if (i == len - 1) {
-                break;
-            } else if (i == len - BASE64_PAD_MAX) {
-                ret = (buf[i + 1] == '=') ? BSL_SUCCESS : BSL_BASE64_INVALID_CHARACTER;
-                buf[i + 1] = '\0';
-                break;
-            } else {
-                return BSL_BASE64_INVALID_CHARACTER;
-            }
-        }
-    }
-    if (ret == BSL_SUCCESS) {
-        if (hasEqualSign == true) {
-            buf[i] = '\0';
-        }
-        *bufLen = i;
-    }
-    return ret;
-}
-
-static int32_t BslBase64Normalization(const char *srcBuf, const uint32_t srcBufLen, uint8_t *filterBuf,
-    uint32_t *filterBufLen)
-{
-    (void)memset_s(filterBuf, *filterBufLen, 0, *filterBufLen);
-    BslBase64DecodeRemoveBlank((const uint8_t *)srcBuf, srcBufLen, filterBuf, filterBufLen);
-    if (*filterBufLen == 0 || ((*filterBufLen) % BASE64_DECODE_BYTES != 0)) {
-        return BSL_BASE64_INVALID_ENCODE;
-    }
-    return BslBase64DecodeCheckAndRmvEqualSign(filterBuf, filterBufLen);
-}
-
 /* can ensure that dstBuf and dstBufLen are sufficient and that srcBuf does not contain invalid characters */
 static int32_t BslBase64DecodeBuffer(const uint8_t *srcBuf, const uint32_t srcBufLen, uint8_t *dstBuf,
     uint32_t *dstBufLen)
@@ -310,33 +251,104 @@ static int32_t BslBase64DecodeBuffer(const uint8_t *srcBuf, const uint32_t srcBu
     return BSL_SUCCESS;
 }
 
+/* Decode one quantum of four 6-bit values into three bytes. */
+static inline void BslBase64DecodeQuantum(uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t *dst)
+{
+    dst[0U] = (uint8_t)((v0 << 2U) | (v1 >> 4U));
+    dst[1U] = (uint8_t)((v1 << 4U) | (v2 >> 2U));
+    dst[2U] = (uint8_t)((v2 << 6U) | v3);
+}
+
+/*
+ * Validate and decode the part of the input from the first '=' or invalid character on.
+ * dataCnt is the number of base64 characters consumed so far, quad holds the quadNum characters that do not form
+ * a complete quantum yet. Apart from blanks, the rest must be exactly "=" or "==" completing that quantum.
+ */
+static int32_t BslBase64DecodeTail(const uint8_t *src, uint32_t srcLen, uint32_t dataCnt, const uint8_t *quad,
+    uint32_t quadNum, uint8_t *dst, uint32_t *dstLen)
+{
+    uint32_t restCnt = 0;
+    bool onlyPadding = true;
+    for (uint32_t i = 0; i < srcLen; i++) {
+        uint8_t v = BASE64_DECODE_MAP_TABLE[src[i]];
+        if (v == 64U) { /* ' ', '\r', '\n' */
+            continue;
+        }
+        onlyPadding = onlyPadding && (v == 65U);
+        restCnt++;
+    }
+    uint32_t total = dataCnt + restCnt;
+    if (total == 0 || (total % BASE64_DECODE_BYTES) != 0) {
+        return BSL_BASE64_INVALID_ENCODE;
+    }
+    if (restCnt > BASE64_PAD_MAX || !onlyPadding) {
+        return BSL_BASE64_INVALID_CHARACTER;
+    }
+    /* total is a multiple of 4, so quadNum + restCnt == 4 whenever padding is present. */
+    uint32_t idx = *dstLen;
+    if (quadNum > 1U) {
+        dst[idx++] = (uint8_t)((quad[0U] << 2U) | (quad[1U] >> 4U));
+    }
+    if (quadNum > 2U) {
+        dst[idx++] = (uint8_t)((quad[1U] << 4U) | (quad[2U] >> 2U));
+    }
+    *dstLen = idx;
+    return BSL_SUCCESS;
+}
+
+/*
+ * Single pass decoding: blanks are skipped and characters are validated while decoding, no normalized copy of the
+ * input is made. Runs of complete quanta, i.e. every full line of a PEM body, take the fast path.
+ */
 static int32_t BslBase64ArithDecodeProc(const char *srcBuf, const uint32_t srcBufLen, uint8_t *dstBuf,
     uint32_t *dstBufLen)
 {
-    uint8_t *buf = NULL;
-    uint32_t bufLen; /* length to be decoded after redundant characters are deleted */
-    int32_t ret;
+    const uint8_t *src = (const uint8_t *)srcBuf;
+    uint8_t quad[BASE64_DECODE_BYTES];
+    uint32_t quadNum = 0;
+    uint32_t dstIdx = 0;
+    uint32_t i = 0;
 
-    buf = BSL_SAL_Malloc((uint32_t)srcBufLen);
-    if (buf == NULL) {
-        return BSL_MALLOC_FAIL;
-    }
-    bufLen = srcBufLen;
-    /* Delete the extra white space characters (\r\n, space, '=') */
-    ret = BslBase64Normalization(srcBuf, (const uint32_t)srcBufLen, buf, &bufLen);
-    if (ret != BSL_SUCCESS) {
-        BSL_SAL_FREE(buf);
-        return ret;
+    while (i < srcBufLen) {
+        if (quadNum == 0) {
+            while (srcBufLen - i >= BASE64_DECODE_BYTES) {
+                uint8_t v0 = BASE64_DECODE_MAP_TABLE[src[i]];
+                uint8_t v1 = BASE64_DECODE_MAP_TABLE[src[i + 1U]];
+                uint8_t v2 = BASE64_DECODE_MAP_TABLE[src[i + 2U]];
+                uint8_t v3 = BASE64_DECODE_MAP_TABLE[src[i + 3U]];
+                if ((v0 | v1 | v2 | v3) >= 64U) { /* a blank, '=' or an invalid character in this quantum */
+                    break;
+                }
+                BslBase64DecodeQuantum(v0, v1, v2, v3, &dstBuf[dstIdx]);
+                dstIdx += BASE64_ENCODE_BYTES;
+                i += BASE64_DECODE_BYTES;
+            }
+            if (i == srcBufLen) {
+                break;
+            }
+        }
+        uint8_t v = BASE64_DECODE_MAP_TABLE[src[i]];
+        if (v > 64U) { /* '=' or an invalid character */
+            break;
+        }
+        i++;
+        if (v == 64U) {
+            continue;
+        }
+        quad[quadNum++] = v;
+        if (quadNum == BASE64_DECODE_BYTES) {
+            BslBase64DecodeQuantum(quad[0U], quad[1U], quad[2U], quad[3U], &dstBuf[dstIdx]);
+            dstIdx += BASE64_ENCODE_BYTES;
+            quadNum = 0;
+        }
     }
 
-    /* Decode the base64 character string. */
-    ret = BslBase64DecodeBuffer(buf, (const uint32_t)bufLen, dstBuf, dstBufLen);
+    uint32_t dataCnt = dstIdx / BASE64_ENCODE_BYTES * BASE64_DECODE_BYTES + quadNum;
+    int32_t ret = BslBase64DecodeTail(&src[i], srcBufLen - i, dataCnt, quad, quadNum, dstBuf, &dstIdx);
     if (ret != BSL_SUCCESS) {
-        BSL_SAL_FREE(buf);
         return ret;
     }
-
-    BSL_SAL_FREE(buf);
+    *dstBufLen = dstIdx;
     return BSL_SUCCESS;
 }
 
@@ -457,6 +469,15 @@ int32_t BSL_BASE64_DecodeInit(BSL_Base64Ctx *ctx)
     return BSL_SUCCESS;
 }
 
+static bool BslBase64IsDataBlock(const uint8_t *src)
+{
+    uint8_t acc = 0;
+    for (uint32_t i = 0; i < BASE64_DECODE_BLOCKSIZE; i++) {
+        acc |= BASE64_DECODE_MAP_TABLE[src[i]];
+    }
+    return acc < 64U; /* 0U ~ 63U are valid characters */
+}
+
 int32_t BSL_BASE64_DecodeUpdate(BSL_Base64Ctx *ctx, const char *srcBuf, const uint32_t srcBufLen,
     uint8_t *dstBuf, uint32_t *dstBufLen)
 {
@@ -479,6 +500,15 @@ int32_t BSL_BASE64_DecodeUpdate(BSL_Base64Ctx *ctx, const char *srcBuf, const ui
     uint8_t *dstTmp = dstBuf;
 
     for (uint32_t i = 0U; i < srcBufLen; i++) {
+        /* A whole block of valid characters is decoded in place, without staging it in ctx->buf. */
+        if (num == 0 && ctx->paddingCnt == 0 && srcBufLen - i >= BASE64_DECODE_BLOCKSIZE &&
+            BslBase64IsDataBlock((const uint8_t *)&srcBuf[i])) {
+            (void)BslBase64DecodeBuffer((const uint8_t *)&srcBuf[i], BASE64_DECODE_BLOCKSIZE, dstTmp, &decodeLen);
+            totalLen += decodeLen;
+            dstTmp += decodeLen;
+            i += BASE64_DECODE_BLOCKSIZE - 1;
+            continue;
+        }
         ret = BslBase64DecodeCheck(srcBuf[i], &ctx->paddingCnt);
         if (ret != BSL_SUCCESS) {
             *dstBufLen = 0;
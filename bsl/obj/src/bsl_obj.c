@@ -120,11 +120,15 @@ BslOidInfo g_oidTable[] = {
     {{9, "\52\206\110\206\367\15\1\11\16", BSL_OID_GLOBAL}, "Requested Extensions", BSL_CID_REQ_EXTENSION},
 
     {{9, "\52\206\110\206\367\15\1\7\1", BSL_OID_GLOBAL}, "data", BSL_CID_DATA},
+    {{9, "\52\206\110\206\367\15\1\7\2", BSL_OID_GLOBAL}, "signedData", BSL_CID_SIGENEDDATA},
     {{9, "\52\206\110\206\367\15\1\7\6", BSL_OID_GLOBAL}, "encryptedData", BSL_CID_ENCRYPTEDDATA},
 
     {{9, "\52\206\110\206\367\15\1\11\24", BSL_OID_GLOBAL}, "friendlyName", BSL_CID_FRIENDLYNAME},
     {{9, "\52\206\110\206\367\15\1\11\25", BSL_OID_GLOBAL}, "localKeyId", BSL_CID_LOCALKEYID},
     {{10, "\52\206\110\206\367\15\1\11\26\1", BSL_OID_GLOBAL}, "x509Certificate", BSL_CID_X509CERTIFICATE},
+    {{9, "\52\206\110\206\367\15\1\11\3", BSL_OID_GLOBAL}, "contentType", BSL_CID_CONTENTTYPE},
+    {{9, "\52\206\110\206\367\15\1\11\4", BSL_OID_GLOBAL}, "messageDigest", BSL_CID_MESSAGEDIGEST},
+    {{9, "\52\206\110\206\367\15\1\11\5", BSL_OID_GLOBAL}, "signingTime", BSL_CID_SIGNINGTIME},
 
     {{11, "\52\206\110\206\367\15\1\14\12\1\1", BSL_OID_GLOBAL}, "keyBag", BSL_CID_KEYBAG},
     {{11, "\52\206\110\206\367\15\1\14\12\1\2", BSL_OID_GLOBAL}, "pkcs8shroudedkeyBag", BSL_CID_PKCS8SHROUDEDKEYBAG},
@@ -68,6 +68,14 @@ int32_t BSL_PEM_ParsePem2Asn1(char **encode, uint32_t *encodeLen, BSL_PEM_Symbol
 /* encode must end in '\0' */
 bool BSL_PEM_IsPemFormat(char *encode, uint32_t encodeLen);
 
+/* Locate the base64 body of the next PEM block without decoding it, encode must end in '\0' */
+int32_t BSL_PEM_GetPemRealEncode(char **encode, uint32_t *encodeLen, BSL_PEM_Symbol *symbol, char **realEncode,
+    uint32_t *realLen);
+
+/* Decode the base64 body located by BSL_PEM_GetPemRealEncode */
+int32_t BSL_PEM_GetAsn1Encode(const char *encode, const uint32_t encodeLen, uint8_t **asn1Encode,
+    uint32_t *asn1Len);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -17,6 +17,15 @@
 #ifdef HITLS_BSL_UIO_TCP
 
 #include <unistd.h>
+#ifdef HITLS_BSL_SAL_LINUX
+#include <sys/socket.h>
+#include <sys/sendfile.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <linux/tls.h>
+#include "securec.h"
+#include "bsl_bytes.h"
+#endif
 
 #include "bsl_binlog_id.h"
 #include "bsl_err_internal.h"
@@ -28,8 +37,27 @@
 #include "uio_base.h"
 #include "uio_abstraction.h"
 
+#ifdef HITLS_BSL_SAL_LINUX
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#define TCP_KTLS_RECORD_TYPE_APP 23u
+#define TCP_KTLS_SEQ_SIZE 8u
+#define TCP_KTLS_TLS12_SALT_SIZE 4u
+#endif
+
 typedef struct {
     int32_t fd;
+#ifdef HITLS_BSL_SAL_LINUX
+    bool isUlpAttached;         /* The tls ULP has been attached to the socket */
+    bool isKtlsTx;              /* Records written to the socket are encrypted by the kernel */
+    bool isKtlsRx;              /* Records read from the socket are decrypted by the kernel */
+    uint8_t txRecordType;       /* Record type of the subsequent writes */
+    uint8_t rxRecordType;       /* Record type of the last read */
+#endif
 } TcpPrameters;
 
 static int32_t TcpNew(BSL_UIO *uio)
@@ -50,6 +78,10 @@ static int32_t TcpNew(BSL_UIO *uio)
     }
 
     parameters->fd = -1;
+#ifdef HITLS_BSL_SAL_LINUX
+    parameters->txRecordType = TCP_KTLS_RECORD_TYPE_APP;
+    parameters->rxRecordType = TCP_KTLS_RECORD_TYPE_APP;
+#endif
     uio->ctx = parameters;
     uio->ctxLen = sizeof(TcpPrameters);
     // Specifies whether to be closed by uio when setting fd.
@@ -74,6 +106,62 @@ static int32_t TcpSocketDestroy(BSL_UIO *uio)
     return BSL_SUCCESS;
 }
 
+#ifdef HITLS_BSL_SAL_LINUX
+/* Control message buffer of one record type byte, aligned for struct cmsghdr. */
+typedef union {
+    struct cmsghdr align;
+    uint8_t buf[CMSG_SPACE(sizeof(uint8_t))];
+} TcpKtlsCmsgBuf;
+
+/* Non application data records are sent with the record type in a control message. */
+static ssize_t TcpKtlsSendRecord(int32_t fd, uint8_t recordType, const void *buf, uint32_t len, int32_t *err)
+{
+    TcpKtlsCmsgBuf cmsgBuf;
+    (void)memset_s(&cmsgBuf, sizeof(cmsgBuf), 0, sizeof(cmsgBuf));
+    struct iovec iov = { .iov_base = (void *)(uintptr_t)buf, .iov_len = len };
+    struct msghdr msg = {0};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cmsgBuf.buf;
+    msg.msg_controllen = sizeof(cmsgBuf.buf);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(uint8_t));
+    *CMSG_DATA(cmsg) = recordType;
+    ssize_t ret = sendmsg(fd, &msg, 0);
+    if (ret < 0) {
+        *err = errno;
+    }
+    return ret;
+}
+
+/* The kernel reports the type of a decrypted record in a control message and never merges records of
+ * different types into one read. */
+static ssize_t TcpKtlsRecvRecord(int32_t fd, uint8_t *recordType, void *buf, uint32_t len, int32_t *err)
+{
+    TcpKtlsCmsgBuf cmsgBuf;
+    (void)memset_s(&cmsgBuf, sizeof(cmsgBuf), 0, sizeof(cmsgBuf));
+    struct iovec iov = { .iov_base = buf, .iov_len = len };
+    struct msghdr msg = {0};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cmsgBuf.buf;
+    msg.msg_controllen = sizeof(cmsgBuf.buf);
+    ssize_t ret = recvmsg(fd, &msg, 0);
+    if (ret < 0) {
+        *err = errno;
+        return ret;
+    }
+    *recordType = TCP_KTLS_RECORD_TYPE_APP;
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg != NULL && cmsg->cmsg_level == SOL_TLS && cmsg->cmsg_type == TLS_GET_RECORD_TYPE) {
+        *recordType = *CMSG_DATA(cmsg);
+    }
+    return ret;
+}
+#endif
+
 static int32_t TcpSocketWrite(BSL_UIO *uio, const void *buf, uint32_t len, uint32_t *writeLen)
 {
     *writeLen = 0;
@@ -83,7 +171,13 @@ static int32_t TcpSocketWrite(BSL_UIO *uio, const void *buf, uint32_t len, uint3
         BSL_ERR_PUSH_ERROR(BSL_UIO_IO_EXCEPTION);
         return BSL_UIO_IO_EXCEPTION;
     }
+#ifdef HITLS_BSL_SAL_LINUX
+    TcpPrameters *ctx = BSL_UIO_GetCtx(uio);
+    ssize_t ret = (ctx->isKtlsTx && ctx->txRecordType != TCP_KTLS_RECORD_TYPE_APP) ?
+        TcpKtlsSendRecord(fd, ctx->txRecordType, buf, len, &err) : BSL_SAL_Write(fd, buf, len, &err);
+#else
     ssize_t ret = BSL_SAL_Write(fd, buf, len, &err);
+#endif
     (void)BSL_UIO_ClearFlags(uio, BSL_UIO_FLAGS_RWS | BSL_UIO_FLAGS_SHOULD_RETRY);
     if (ret > 0) {
         *writeLen = (uint32_t)ret;
@@ -109,7 +203,13 @@ static int32_t TcpSocketRead(BSL_UIO *uio, void *buf, uint32_t len, uint32_t *re
         BSL_ERR_PUSH_ERROR(BSL_UIO_IO_EXCEPTION);
         return BSL_UIO_IO_EXCEPTION;
     }
+#ifdef HITLS_BSL_SAL_LINUX
+    TcpPrameters *ctx = BSL_UIO_GetCtx(uio);
+    ssize_t ret = ctx->isKtlsRx ? TcpKtlsRecvRecord(fd, &ctx->rxRecordType, buf, len, &err) :
+        BSL_SAL_Read(fd, buf, len, &err);
+#else
     ssize_t ret = BSL_SAL_Read(fd, buf, len, &err);
+#endif
     if (ret > 0) { // Success
         *readLen = (uint32_t)ret;
         return BSL_SUCCESS;
@@ -173,6 +273,186 @@ static int32_t TcpGetFd(BSL_UIO *uio, int32_t size, int32_t *fd)
     return BSL_SUCCESS;
 }
 
+#ifdef HITLS_BSL_SAL_LINUX
+typedef union {
+    struct tls12_crypto_info_aes_gcm_128 aes128Gcm;
+    struct tls12_crypto_info_aes_gcm_256 aes256Gcm;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    struct tls12_crypto_info_chacha20_poly1305 chacha20Poly1305;
+#endif
+} TcpKtlsCryptoInfo;
+
+typedef struct {
+    struct tls_crypto_info *info;
+    uint8_t *key;
+    uint8_t *salt;
+    uint8_t *iv;
+    uint8_t *recSeq;
+    uint32_t keyLen;
+    uint32_t saltLen;
+    uint32_t ivLen;
+    uint32_t infoLen;
+} TcpKtlsCryptoInfoRef;
+
+#define TCP_KTLS_INFO_REF(ref, member, cipherType)                        \
+    do {                                                                 \
+        (ref)->info = &(member).info;                                     \
+        (ref)->info->cipher_type = (cipherType);                          \
+        (ref)->key = (member).key;                                        \
+        (ref)->salt = (member).salt;                                      \
+        (ref)->iv = (member).iv;                                          \
+        (ref)->recSeq = (member).rec_seq;                                 \
+        (ref)->keyLen = sizeof((member).key);                             \
+        (ref)->saltLen = sizeof((member).salt);                           \
+        (ref)->ivLen = sizeof((member).iv);                               \
+        (ref)->infoLen = sizeof(member);                                  \
+    } while (0)
+
+static int32_t TcpKtlsGetInfoRef(uint8_t cipher, TcpKtlsCryptoInfo *info, TcpKtlsCryptoInfoRef *ref)
+{
+    switch (cipher) {
+        case BSL_UIO_KTLS_AES_128_GCM:
+            TCP_KTLS_INFO_REF(ref, info->aes128Gcm, TLS_CIPHER_AES_GCM_128);
+            return BSL_SUCCESS;
+        case BSL_UIO_KTLS_AES_256_GCM:
+            TCP_KTLS_INFO_REF(ref, info->aes256Gcm, TLS_CIPHER_AES_GCM_256);
+            return BSL_SUCCESS;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+        case BSL_UIO_KTLS_CHACHA20_POLY1305:
+            /* ChaCha20-Poly1305 has no salt, the whole static IV is carried in iv */
+            TCP_KTLS_INFO_REF(ref, info->chacha20Poly1305, TLS_CIPHER_CHACHA20_POLY1305);
+            ref->salt = NULL;
+            ref->saltLen = 0;
+            return BSL_SUCCESS;
+#endif
+        default:
+            return BSL_UIO_KTLS_NOT_SUPPORT;
+    }
+}
+
+/* Lay out the traffic keys in the kernel crypto_info structure of the cipher. */
+static int32_t TcpKtlsBuildCryptoInfo(const BSL_UIO_KtlsCryptoInfo *in, TcpKtlsCryptoInfo *info,
+    TcpKtlsCryptoInfoRef *ref)
+{
+    if (in->version != TLS_1_2_VERSION && in->version != TLS_1_3_VERSION) {
+        return BSL_UIO_KTLS_NOT_SUPPORT;
+    }
+    int32_t ret = TcpKtlsGetInfoRef(in->cipher, info, ref);
+    if (ret != BSL_SUCCESS) {
+        return ret;
+    }
+    uint8_t seq[TCP_KTLS_SEQ_SIZE];
+    BSL_Uint64ToByte(in->seq, seq);
+    /* TLS1.2 AES-GCM only shares the salt, the explicit nonce of each record continues from the sequence number */
+    bool isExplicitNonce = (in->version == TLS_1_2_VERSION && ref->saltLen == TCP_KTLS_TLS12_SALT_SIZE);
+    uint32_t ivLen = isExplicitNonce ? ref->saltLen : (ref->saltLen + ref->ivLen);
+    if (in->key == NULL || in->iv == NULL || in->keyLen != ref->keyLen || in->ivLen != ivLen) {
+        BSL_ERR_PUSH_ERROR(BSL_INVALID_ARG);
+        return BSL_INVALID_ARG;
+    }
+    ref->info->version = in->version;
+    (void)memcpy_s(ref->key, ref->keyLen, in->key, in->keyLen);
+    if (ref->saltLen != 0) {
+        (void)memcpy_s(ref->salt, ref->saltLen, in->iv, ref->saltLen);
+    }
+    if (isExplicitNonce) {
+        (void)memcpy_s(ref->iv, ref->ivLen, seq, sizeof(seq));
+    } else {
+        (void)memcpy_s(ref->iv, ref->ivLen, in->iv + ref->saltLen, ref->ivLen);
+    }
+    (void)memcpy_s(ref->recSeq, TCP_KTLS_SEQ_SIZE, seq, sizeof(seq));
+    return BSL_SUCCESS;
+}
+
+static int32_t TcpKtlsEnable(BSL_UIO *uio, int32_t size, const BSL_UIO_KtlsCryptoInfo *cryptoInfo, bool isTx)
+{
+    TcpPrameters *ctx = BSL_UIO_GetCtx(uio);
+    if (ctx == NULL || cryptoInfo == NULL || size != (int32_t)sizeof(BSL_UIO_KtlsCryptoInfo)) {
+        BSL_ERR_PUSH_ERROR(BSL_NULL_INPUT);
+        return BSL_NULL_INPUT;
+    }
+    if (ctx->fd < 0) {
+        BSL_ERR_PUSH_ERROR(BSL_UIO_UNINITIALIZED);
+        return BSL_UIO_UNINITIALIZED;
+    }
+    TcpKtlsCryptoInfo info = {0};
+    TcpKtlsCryptoInfoRef ref = {0};
+    int32_t ret = TcpKtlsBuildCryptoInfo(cryptoInfo, &info, &ref);
+    if (ret != BSL_SUCCESS) {
+        BSL_SAL_CleanseData(&info, sizeof(info));
+        return ret;
+    }
+    /* The ULP is attached once, a missing tls module is reported here */
+    if (!ctx->isUlpAttached) {
+        if (BSL_SAL_SetSockopt(ctx->fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != BSL_SUCCESS) {
+            BSL_SAL_CleanseData(&info, sizeof(info));
+            BSL_LOG_BINLOG_FIXLEN(BINLOG_ID05073, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
+                "Uio: tls ULP is unavailable.", 0, 0, 0, 0);
+            return BSL_UIO_KTLS_NOT_SUPPORT;
+        }
+        ctx->isUlpAttached = true;
+    }
+    /* Setting the keys again on an offloaded direction performs a kernel rekey (TLS1.3 KeyUpdate). */
+    ret = BSL_SAL_SetSockopt(ctx->fd, SOL_TLS, isTx ? TLS_TX : TLS_RX, ref.info, ref.infoLen);
+    BSL_SAL_CleanseData(&info, sizeof(info));
+    if (ret != BSL_SUCCESS) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID05074, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
+            "Uio: kernel refused the tls crypto info, tx %u.", isTx, 0, 0, 0);
+        return BSL_UIO_KTLS_NOT_SUPPORT;
+    }
+    if (isTx) {
+        ctx->isKtlsTx = true;
+    } else {
+        ctx->isKtlsRx = true;
+    }
+    return BSL_SUCCESS;
+}
+
+static int32_t TcpKtlsRecordType(BSL_UIO *uio, int32_t size, uint8_t *recordType, bool isSet)
+{
+    TcpPrameters *ctx = BSL_UIO_GetCtx(uio);
+    if (ctx == NULL || recordType == NULL || size != (int32_t)sizeof(uint8_t)) {
+        BSL_ERR_PUSH_ERROR(BSL_NULL_INPUT);
+        return BSL_NULL_INPUT;
+    }
+    if (isSet) {
+        ctx->txRecordType = *recordType;
+    } else {
+        *recordType = ctx->rxRecordType;
+    }
+    return BSL_SUCCESS;
+}
+
+static int32_t TcpKtlsSendFile(BSL_UIO *uio, int32_t size, BSL_UIO_KtlsSendFileParam *param)
+{
+    TcpPrameters *ctx = BSL_UIO_GetCtx(uio);
+    if (ctx == NULL || param == NULL || size != (int32_t)sizeof(BSL_UIO_KtlsSendFileParam)) {
+        BSL_ERR_PUSH_ERROR(BSL_NULL_INPUT);
+        return BSL_NULL_INPUT;
+    }
+    param->sentLen = 0;
+    if (!ctx->isKtlsTx) {
+        BSL_ERR_PUSH_ERROR(BSL_UIO_KTLS_NOT_SUPPORT);
+        return BSL_UIO_KTLS_NOT_SUPPORT;
+    }
+    (void)BSL_UIO_ClearFlags(uio, BSL_UIO_FLAGS_RWS | BSL_UIO_FLAGS_SHOULD_RETRY);
+    off_t offset = (off_t)param->offset;
+    ssize_t ret = sendfile(ctx->fd, param->fd, &offset, param->len);
+    if (ret >= 0) { // 0 indicates the end of the file
+        param->sentLen = (uint32_t)ret;
+        return BSL_SUCCESS;
+    }
+    if (ret < 0 && UioIsNonFatalErr(errno)) {
+        (void)BSL_UIO_SetFlags(uio, BSL_UIO_FLAGS_WRITE | BSL_UIO_FLAGS_SHOULD_RETRY);
+        return BSL_SUCCESS;
+    }
+    BSL_LOG_BINLOG_FIXLEN(BINLOG_ID05075, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+        "Uio: sendfile fail, ret %d.", (int32_t)ret, 0, 0, 0);
+    BSL_ERR_PUSH_ERROR(BSL_UIO_IO_EXCEPTION);
+    return BSL_UIO_IO_EXCEPTION;
+}
+#endif /* HITLS_BSL_SAL_LINUX */
+
 static int32_t TcpSocketCtrl(BSL_UIO *uio, int32_t cmd, int32_t larg, void *parg)
 {
     switch (cmd) {
@@ -180,6 +460,23 @@ static int32_t TcpSocketCtrl(BSL_UIO *uio, int32_t cmd, int32_t larg, void *parg
             return TcpSetFd(uio, larg, parg);
         case BSL_UIO_GET_FD:
             return TcpGetFd(uio, larg, parg);
+#ifdef HITLS_BSL_SAL_LINUX
+        case BSL_UIO_TCP_KTLS_ENABLE_TX:
+            return TcpKtlsEnable(uio, larg, parg, true);
+        case BSL_UIO_TCP_KTLS_ENABLE_RX:
+            return TcpKtlsEnable(uio, larg, parg, false);
+        case BSL_UIO_TCP_KTLS_SET_RECORD_TYPE:
+            return TcpKtlsRecordType(uio, larg, parg, true);
+        case BSL_UIO_TCP_KTLS_GET_RECORD_TYPE:
+            return TcpKtlsRecordType(uio, larg, parg, false);
+        case BSL_UIO_TCP_KTLS_SENDFILE:
+            return TcpKtlsSendFile(uio, larg, parg);
+#else
+        case BSL_UIO_TCP_KTLS_ENABLE_TX:
+        case BSL_UIO_TCP_KTLS_ENABLE_RX:
+        case BSL_UIO_TCP_KTLS_SENDFILE:
+            return BSL_UIO_KTLS_NOT_SUPPORT;
+#endif
         case BSL_UIO_FLUSH:
             return BSL_SUCCESS;
         default:
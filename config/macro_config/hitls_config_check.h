@@ -53,6 +53,14 @@
     #error "[HiTLS] Integrity check must work with TLS13"
 #endif
 
+#if defined(HITLS_TLS_FEATURE_KTLS) && !defined(HITLS_TLS_PROTO_TLS)
+    #error "[HiTLS] Kernel TLS offload must work with TLS"
+#endif
+
+#if defined(HITLS_TLS_FEATURE_KEY_SHARE_POOL) && !(defined(HITLS_BSL_SAL_THREAD) && defined(HITLS_BSL_SAL_LOCK))
+    #error "[HiTLS] The key share pool must work with sal_thread and sal_lock"
+#endif
+
 #if defined(HITLS_TLS_SUITE_AES_128_GCM_SHA256)
 #if !defined(HITLS_CRYPTO_SHA256) || !defined(HITLS_CRYPTO_GCM) || !defined(HITLS_CRYPTO_AES)
 #error "[HiTLS] cipher suite HITLS_TLS_SUITE_AES_128_GCM_SHA256 must work with sha256, gcm, aes"
@@ -79,6 +87,16 @@
 #error "[HiTLS] cipher suite HITLS_TLS_SUITE_AES_128_CCM_8_SHA256 must work with sha256, ccm, aes"
 #endif
 #endif
+#if defined(HITLS_TLS_SUITE_SM4_GCM_SM3)
+#if !defined(HITLS_CRYPTO_SM3) || !defined(HITLS_CRYPTO_GCM) || !defined(HITLS_CRYPTO_SM4)
+#error "[HiTLS] cipher suite HITLS_TLS_SUITE_SM4_GCM_SM3 must work with sm3, gcm, sm4"
+#endif
+#endif
+#if defined(HITLS_TLS_SUITE_SM4_CCM_SM3)
+#if !defined(HITLS_CRYPTO_SM3) || !defined(HITLS_CRYPTO_CCM) || !defined(HITLS_CRYPTO_SM4)
+#error "[HiTLS] cipher suite HITLS_TLS_SUITE_SM4_CCM_SM3 must work with sm3, ccm, sm4"
+#endif
+#endif
 #if defined(HITLS_TLS_SUITE_RSA_WITH_AES_128_CBC_SHA)
 #if !defined(HITLS_CRYPTO_SHA1) || !defined(HITLS_CRYPTO_CBC) || !defined(HITLS_CRYPTO_AES) || \
     !defined(HITLS_CRYPTO_RSA)
@@ -594,10 +612,12 @@ chacha20poly1305, chacha20, rsa"
 
 #if defined(HITLS_TLS_SUITE_AES_128_GCM_SHA256) || defined(HITLS_TLS_SUITE_AES_256_GCM_SHA384) || \
     defined(HITLS_TLS_SUITE_CHACHA20_POLY1305_SHA256) || defined(HITLS_TLS_SUITE_AES_128_CCM_SHA256) || \
-    defined(HITLS_TLS_SUITE_AES_128_CCM_8_SHA256)
+    defined(HITLS_TLS_SUITE_AES_128_CCM_8_SHA256) || defined(HITLS_TLS_SUITE_SM4_GCM_SM3) || \
+    defined(HITLS_TLS_SUITE_SM4_CCM_SM3)
     #if (!defined(HITLS_TLS_SUITE_AUTH_RSA) && !defined(HITLS_TLS_SUITE_AUTH_ECDSA) && \
-        !defined(HITLS_TLS_SUITE_AUTH_PSK))
-    #error "[HiTLS] tls13 ciphersuite must work with suite_auth_rsa or suite_auth_ecdsa or suite_auth_psk"
+        !defined(HITLS_TLS_SUITE_AUTH_SM2) && !defined(HITLS_TLS_SUITE_AUTH_PSK))
+    #error "[HiTLS] tls13 ciphersuite must work with suite_auth_rsa or suite_auth_ecdsa or suite_auth_sm2 or \
+suite_auth_psk"
     #endif
 #endif
 #endif /* HITLS_CONFIG_CHECK_H */
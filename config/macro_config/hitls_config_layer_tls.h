@@ -126,6 +126,12 @@
     #ifndef HITLS_TLS_FEATURE_CERT_MODE
         #define HITLS_TLS_FEATURE_CERT_MODE
     #endif
+    #ifndef HITLS_TLS_FEATURE_KTLS
+        #define HITLS_TLS_FEATURE_KTLS
+    #endif
+    #if !defined(HITLS_TLS_FEATURE_KEY_SHARE_POOL) && defined(HITLS_BSL_SAL_THREAD) && defined(HITLS_BSL_SAL_LOCK)
+        #define HITLS_TLS_FEATURE_KEY_SHARE_POOL
+    #endif
 #endif /* HITLS_TLS_FEATURE */
 
 #ifdef HITLS_TLS_FEATURE_SESSION
@@ -509,6 +515,14 @@
         #define HITLS_TLS_SUITE_ECDHE_SM4_CBC_SM3
     #endif
 #endif
+#if defined(HITLS_TLS_SUITE_CIPHER_AEAD) && defined(HITLS_TLS_SUITE_KX_ECDHE) && defined(HITLS_TLS_SUITE_AUTH_SM2)
+    #if !defined(HITLS_TLS_SUITE_SM4_GCM_SM3) && defined(HITLS_TLS_PROTO_TLS13)
+        #define HITLS_TLS_SUITE_SM4_GCM_SM3
+    #endif
+    #if !defined(HITLS_TLS_SUITE_SM4_CCM_SM3) && defined(HITLS_TLS_PROTO_TLS13)
+        #define HITLS_TLS_SUITE_SM4_CCM_SM3
+    #endif
+#endif
 #if defined(HITLS_TLS_SUITE_CIPHER_CBC) && defined(HITLS_TLS_SUITE_KX_DHE) && defined(HITLS_TLS_SUITE_AUTH_RSA)
     #ifndef HITLS_TLS_SUITE_DHE_RSA_WITH_AES_128_CBC_SHA
         #define HITLS_TLS_SUITE_DHE_RSA_WITH_AES_128_CBC_SHA
@@ -660,7 +674,8 @@
 
 #if defined(HITLS_TLS_SUITE_AES_128_GCM_SHA256) || defined(HITLS_TLS_SUITE_AES_256_GCM_SHA384) || \
     defined(HITLS_TLS_SUITE_CHACHA20_POLY1305_SHA256) || defined(HITLS_TLS_SUITE_AES_128_CCM_SHA256) || \
-    defined(HITLS_TLS_SUITE_AES_128_CCM_8_SHA256)
+    defined(HITLS_TLS_SUITE_AES_128_CCM_8_SHA256) || defined(HITLS_TLS_SUITE_SM4_GCM_SM3) || \
+    defined(HITLS_TLS_SUITE_SM4_CCM_SM3)
     #ifndef HITLS_TLS_SUITE_CIPHER_AEAD
         #define HITLS_TLS_SUITE_CIPHER_AEAD
     #endif
@@ -20,6 +20,7 @@
 #ifdef HITLS_CRYPTO_AES
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -199,6 +200,130 @@ int32_t CRYPT_AES_ECB_Decrypt(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8
 int32_t CRYPT_AES_CFB_Decrypt(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8_t *out, uint32_t len, uint8_t *iv);
 #endif
 
+#ifdef HITLS_CRYPTO_AES_X8664
+/* The VAES functions process four blocks per zmm register, the length must be a multiple of this value. */
+#define CRYPT_AES_VAES_BLOCK_LEN 64
+
+/**
+ * @ingroup aes
+ * @brief Check whether the VAES functions should process len bytes.
+ *        They require VAES and AVX-512 and only pay off once the 16 blocks loop is reached.
+ *
+ * @param len [IN] Data length
+ * @return true: use the VAES functions for the first (len & ~(CRYPT_AES_VAES_BLOCK_LEN - 1)) bytes.
+ */
+bool CRYPT_AES_UseVaes(uint32_t len);
+
+#ifdef HITLS_CRYPTO_ECB
+/**
+ * @ingroup aes
+ * @brief AES-ECB encryption with VAES
+ *
+ * @param ctx [IN]  AES handle, storing keys
+ * @param in  [IN]  Input plaintext data
+ * @param out [OUT] Output ciphertext data
+ * @param len [IN]  Data length, a non-zero multiple of CRYPT_AES_VAES_BLOCK_LEN
+*/
+int32_t CRYPT_AES_ECB_EncryptVaes(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8_t *out, uint32_t len);
+
+/**
+ * @ingroup aes
+ * @brief AES-ECB decryption with VAES
+ *
+ * @param ctx [IN]  AES handle, storing keys
+ * @param in  [IN]  Input ciphertext data
+ * @param out [OUT] Output plaintext data
+ * @param len [IN]  Data length, a non-zero multiple of CRYPT_AES_VAES_BLOCK_LEN
+*/
+int32_t CRYPT_AES_ECB_DecryptVaes(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8_t *out, uint32_t len);
+#endif
+
+#ifdef HITLS_CRYPTO_CTR
+/**
+ * @ingroup aes
+ * @brief AES-CTR encryption with VAES. Like CRYPT_AES_CTR_Encrypt only the low 32 bits of the counter are
+ *        incremented, the caller must not let them wrap within one call.
+ *
+ * @param ctx [IN]  AES handle, storing keys
+ * @param in  [IN]  Input data
+ * @param out [OUT] Output data
+ * @param len [IN]  Data length, a non-zero multiple of CRYPT_AES_VAES_BLOCK_LEN
+ * @param iv  [IN/OUT] Counter block, updated to the next unused counter
+*/
+int32_t CRYPT_AES_CTR_EncryptVaes(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8_t *out, uint32_t len,
+    uint8_t *iv);
+#endif
+
+#ifdef HITLS_CRYPTO_CBC
+/**
+ * @ingroup aes
+ * @brief AES-CBC decryption with VAES
+ *
+ * @param ctx [IN]  AES handle, storing keys
+ * @param in  [IN]  Input ciphertext data
+ * @param out [OUT] Output plaintext data
+ * @param len [IN]  Data length, a non-zero multiple of CRYPT_AES_VAES_BLOCK_LEN
+ * @param iv  [IN/OUT] Initial vector, updated to the last ciphertext block
+*/
+int32_t CRYPT_AES_CBC_DecryptVaes(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8_t *out, uint32_t len,
+    uint8_t *iv);
+#endif
+
+#ifdef HITLS_CRYPTO_XTS
+/**
+ * @ingroup aes
+ * @brief AES-XTS encryption of whole blocks with AES-NI, without ciphertext stealing
+ *
+ * @param ctx   [IN]  AES handle, storing key1
+ * @param in    [IN]  Input plaintext data
+ * @param out   [OUT] Output ciphertext data
+ * @param len   [IN]  Data length, a multiple of 16 bytes
+ * @param tweak [IN/OUT] Tweak of the first block, updated to the tweak of the next block
+*/
+int32_t CRYPT_AES_XTS_Encrypt(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8_t *out, uint32_t len,
+    uint8_t *tweak);
+
+/**
+ * @ingroup aes
+ * @brief AES-XTS decryption of whole blocks with AES-NI, without ciphertext stealing
+ *
+ * @param ctx   [IN]  AES handle, storing the decryption key of key1
+ * @param in    [IN]  Input ciphertext data
+ * @param out   [OUT] Output plaintext data
+ * @param len   [IN]  Data length, a multiple of 16 bytes
+ * @param tweak [IN/OUT] Tweak of the first block, updated to the tweak of the next block
+*/
+int32_t CRYPT_AES_XTS_Decrypt(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8_t *out, uint32_t len,
+    uint8_t *tweak);
+
+/**
+ * @ingroup aes
+ * @brief AES-XTS encryption of whole blocks with VAES, which also requires VPCLMULQDQ
+ *
+ * @param ctx   [IN]  AES handle, storing key1
+ * @param in    [IN]  Input plaintext data
+ * @param out   [OUT] Output ciphertext data
+ * @param len   [IN]  Data length, a non-zero multiple of CRYPT_AES_VAES_BLOCK_LEN
+ * @param tweak [IN/OUT] Tweak of the first block, updated to the tweak of the next block
+*/
+int32_t CRYPT_AES_XTS_EncryptVaes(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8_t *out, uint32_t len,
+    uint8_t *tweak);
+
+/**
+ * @ingroup aes
+ * @brief AES-XTS decryption of whole blocks with VAES, which also requires VPCLMULQDQ
+ *
+ * @param ctx   [IN]  AES handle, storing the decryption key of key1
+ * @param in    [IN]  Input ciphertext data
+ * @param out   [OUT] Output plaintext data
+ * @param len   [IN]  Data length, a non-zero multiple of CRYPT_AES_VAES_BLOCK_LEN
+ * @param tweak [IN/OUT] Tweak of the first block, updated to the tweak of the next block
+*/
+int32_t CRYPT_AES_XTS_DecryptVaes(const CRYPT_AES_Key *ctx, const uint8_t *in, uint8_t *out, uint32_t len,
+    uint8_t *tweak);
+#endif
+#endif // HITLS_CRYPTO_AES_X8664
+
 /**
  * @ingroup aes
  * @brief Delete the AES key information.
@@ -0,0 +1,34 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#if defined(HITLS_CRYPTO_AES) && defined(HITLS_CRYPTO_AES_X8664)
+
+#include "crypt_utils.h"
+#include "crypt_aes.h"
+
+/* Below 16 blocks the zmm code runs its 4 blocks loop only, which is not faster than the 8 blocks AES-NI code. */
+#define AES_VAES_MIN_LEN 256
+
+bool CRYPT_AES_UseVaes(uint32_t len)
+{
+    if (len < AES_VAES_MIN_LEN) {
+        return false;
+    }
+    // The cpuid state is filled in by CRYPT_EAL_Init, before that every check fails and AES-NI is used.
+    return IsSupportVAES() && IsSupportAVX512F() && IsSupportAVX512BW() && IsOSSupportAVX512();
+}
+
+#endif // HITLS_CRYPTO_AES && HITLS_CRYPTO_AES_X8664
@@ -52,6 +52,8 @@ typedef enum {
 
 typedef struct BnMont BN_Mont;
 
+typedef struct BnMontFixedBase BN_MontFixedBase;
+
 typedef struct BigNum BN_BigNum;
 
 typedef struct BnOptimizer BN_Optimizer;
@@ -867,6 +869,88 @@ int32_t BN_Rshift(BN_BigNum *r, const BN_BigNum *a, uint32_t n);
 int32_t BN_MontExpMul(BN_BigNum *r, const BN_BigNum *a1, const BN_BigNum *e1, const BN_BigNum *a2, const BN_BigNum *e2,
     BN_Mont *mont, BN_Optimizer *opt);
 
+/**
+ * @ingroup bn
+ * @brief Modular exponentiation of several bases with the same public exponent, r[i] = a[i] ^ e mod m[i],
+ *        m[i] is the modulus of mont[i]. Items may share a Montgomery context.
+ *        With AVX-512 IFMA eight items are computed at once, one per vector lane. The time depends on e,
+ *        use it for public exponents only.
+ *
+ * @param r    [OUT] Modular exponentiation results, num elements, r[i] may be a[i] but no other base or e
+ * @param a    [IN] bases, 0 <= a[i] < m[i], num elements
+ * @param e    [IN] exponent
+ * @param mont [IN] Montgomery contexts, num elements
+ * @param num  [IN] Number of items
+ * @param opt  [IN] Optimizer
+ *
+ * @retval CRYPT_SUCCESS                    calculated successfully.
+ * @retval CRYPT_NULL_INPUT                 Invalid null pointer
+ * @retval CRYPT_INVALID_ARG                A result is the exponent.
+ * @retval CRYPT_MEM_ALLOC_FAIL             Memory allocation failure
+ * @retval CRYPT_BN_OPTIMIZER_GET_FAIL      Failed to apply for space from the optimizer.
+ * @retval CRYPT_BN_ERR_EXP_NO_NEGATIVE     exponent cannot be a negative number
+ * @retval CRYPT_BN_MONT_BASE_TOO_MAX       A base is negative or not lower than its modulus.
+ */
+int32_t BN_MontExpBatch(BN_BigNum *r[], const BN_BigNum *a[], const BN_BigNum *e, BN_Mont *mont[], uint32_t num,
+    BN_Optimizer *opt);
+
+/**
+ * @ingroup bn
+ * @brief Precompute a fixed-base comb table of base for exponents up to eBits bits.
+ *        The table is read-only after creation and can be shared by several threads,
+ *        each of them using its own Montgomery context of the same modulus.
+ *
+ * @param base  [IN] base, 0 <= base < modulus
+ * @param eBits [IN] maximum number of bits of the exponents
+ * @param mont  [IN] Montgomery context
+ * @param opt   [IN] Optimizer
+ *
+ * @retval Not NULL Success
+ * @retval NULL failure
+ */
+BN_MontFixedBase *BN_MontFixedBaseCreate(const BN_BigNum *base, uint32_t eBits, BN_Mont *mont, BN_Optimizer *opt);
+
+/**
+ * @ingroup bn
+ * @brief Constant time modular exponentiation of the base of a fixed-base table, r = base ^ e mod m.
+ *
+ * @param r     [OUT] Modular exponentiation result
+ * @param table [IN] fixed-base table
+ * @param e     [IN] exponent, no more bits than the table was created for
+ * @param mont  [IN] Montgomery context of the modulus of the table
+ * @param opt   [IN] Optimizer
+ *
+ * @retval CRYPT_SUCCESS                    calculated successfully.
+ * @retval CRYPT_NULL_INPUT                 Invalid null pointer
+ * @retval CRYPT_INVALID_ARG                The exponent or the Montgomery context does not match the table.
+ * @retval CRYPT_MEM_ALLOC_FAIL             Memory allocation failure
+ * @retval CRYPT_BN_OPTIMIZER_GET_FAIL      Failed to apply for space from the optimizer.
+ * @retval CRYPT_BN_ERR_EXP_NO_NEGATIVE     exponent cannot be a negative number
+ */
+int32_t BN_MontExpFixedBase(BN_BigNum *r, const BN_MontFixedBase *table, const BN_BigNum *e, BN_Mont *mont,
+    BN_Optimizer *opt);
+
+/**
+ * @ingroup bn
+ * @brief Increase the reference count of a fixed-base table.
+ *
+ * @param table [IN] fixed-base table
+ *
+ * @retval CRYPT_SUCCESS        succeeded.
+ * @retval CRYPT_NULL_INPUT     Invalid null pointer
+ */
+int32_t BN_MontFixedBaseUpRef(BN_MontFixedBase *table);
+
+/**
+ * @ingroup bn
+ * @brief Release a reference of a fixed-base table, the table is freed with the last reference.
+ *
+ * @param table [IN] fixed-base table
+ *
+ * @retval none
+ */
+void BN_MontFixedBaseDestroy(BN_MontFixedBase *table);
+
 /**
  * @ingroup bn
  * @brief Mould opening root
@@ -21,6 +21,7 @@
 
 #include <stdbool.h>
 #include "crypt_bn.h"
+#include "sal_atomic.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +51,14 @@ struct BnMont {
     BN_UINT *t;         /* *< tmpt(1) ^ 2 */
 };
 
+struct BnMontFixedBase {
+    uint32_t mSize;     /* *< size of mod in BN_UINT */
+    uint32_t teeth;     /* *< rows of the comb, the table has 2 ^ teeth entries */
+    uint32_t span;      /* *< exponent bits covered by each row */
+    BN_UINT *data;      /* *< entry v is the product of base ^ (2 ^ (k * span)) over the bits k of v, mont form */
+    BSL_SAL_RefCount references;
+};
+
 struct BnCbCtx {
     void *arg; // callback parameter
     BN_CallBack cb; // callback function, which is defined by the user
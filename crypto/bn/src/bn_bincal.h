@@ -301,6 +301,8 @@ void MulConquer(BN_UINT *r, const BN_UINT *a, const BN_UINT *b, uint32_t size, B
 
 void SqrConquer(BN_UINT *r, const BN_UINT *a, uint32_t size, BN_UINT *space, bool consttime);
 
+int32_t MontSetMod(BN_Mont *mont, const BN_BigNum *m);
+
 int32_t MontSqrBinCore(BN_UINT *r, BN_Mont *mont, BN_Optimizer *opt, bool consttime);
 
 int32_t MontMulBinCore(BN_UINT *r, const BN_UINT *a, const BN_UINT *b, BN_Mont *mont,
@@ -387,6 +387,17 @@ BN_Mont *BN_MontCreate(const BN_BigNum *m)
     return mont;
 }
 
+/* Reuse a Montgomery context for another odd modulus of the same size, e.g. the next prime candidate. */
+int32_t MontSetMod(BN_Mont *mont, const BN_BigNum *m)
+{
+    if (!BN_GetBit(m, 0) || BN_ISNEG(m->flag) || m->size != mont->mSize) {
+        BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+        return CRYPT_INVALID_ARG;
+    }
+    SetMod(mont, m);
+    return CRYPT_SUCCESS;
+}
+
 int32_t MontSqrBinCore(BN_UINT *r, BN_Mont *mont, BN_Optimizer *opt, bool consttime)
 {
     int32_t ret = OptimizerStart(opt);
@@ -741,4 +752,217 @@ ERR:
     OptimizerEnd(opt);
     return ret;
 }
+
+/* Number of rows of the comb, the table has 2 ^ teeth entries of mSize. */
+static uint32_t FixedBaseTeeth(uint32_t eBits)
+{
+    if (eBits > 512) {
+        return 6;
+    }
+    if (eBits > 128) {
+        return 5;
+    }
+    return 4;
+}
+
+static uint32_t FixedBaseSize(uint32_t mSize, uint32_t teeth)
+{
+    uint32_t size = (uint32_t)(sizeof(BN_MontFixedBase) + sizeof(BN_UINT));
+    size += (mSize << teeth) * ((uint32_t)sizeof(BN_UINT));
+    return size;
+}
+
+/* Lim-Lee comb: T[2 ^ k] = base ^ (2 ^ (k * span)), T[v] = T[v - low] * T[low] with low the lowest bit of v */
+static int32_t FixedBasePrecompute(BN_MontFixedBase *table, const BN_BigNum *base, BN_Mont *mont,
+    BN_Optimizer *opt)
+{
+    uint32_t mSize = table->mSize;
+    BN_UINT *data = table->data;
+    data[0] = 1; /* T[0] = mont_enc(1) */
+    int32_t ret = MontEncBin(data, mont, opt, false);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    BN_COPY_BYTES(data + mSize, mSize, base->data, base->size);
+    ret = MontEncBin(data + mSize, mont, opt, false);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    uint32_t k;
+    for (k = 1; k < table->teeth; k++) {
+        BN_UINT *row = data + (mSize << k);
+        BN_COPY_BYTES(row, mSize, data + (mSize << (k - 1)), mSize);
+        for (uint32_t i = 0; i < table->span; i++) {
+            ret = MontSqrBin(row, mont, opt, false);
+            if (ret != CRYPT_SUCCESS) {
+                return ret;
+            }
+        }
+    }
+    uint32_t num = 1u << table->teeth;
+    for (uint32_t v = 3; v < num; v++) {
+        uint32_t low = v & (0u - v);
+        if (low == v) {
+            continue; /* power of 2, computed above */
+        }
+        ret = MontMulBin(data + v * mSize, data + (v - low) * mSize, data + low * mSize, mont, opt, false);
+        if (ret != CRYPT_SUCCESS) {
+            return ret;
+        }
+    }
+    return CRYPT_SUCCESS;
+}
+
+BN_MontFixedBase *BN_MontFixedBaseCreate(const BN_BigNum *base, uint32_t eBits, BN_Mont *mont, BN_Optimizer *opt)
+{
+    if (base == NULL || mont == NULL || opt == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return NULL;
+    }
+    if (eBits == 0 || eBits > BN_MAX_BITS || BN_ISNEG(base->flag)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+        return NULL;
+    }
+    if (BinCmp(base->data, base->size, mont->mod, mont->mSize) >= 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_BN_MONT_BASE_TOO_MAX);
+        return NULL;
+    }
+    uint32_t teeth = FixedBaseTeeth(eBits);
+    if (mont->mSize > (BITS_TO_BN_UNIT(BN_MAX_BITS) >> teeth)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_BN_BITS_TOO_MAX);
+        return NULL;
+    }
+    BN_MontFixedBase *table = BSL_SAL_Calloc(1u, FixedBaseSize(mont->mSize, teeth));
+    if (table == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return NULL;
+    }
+    table->mSize = mont->mSize;
+    table->teeth = teeth;
+    table->span = (eBits + teeth - 1) / teeth;
+    table->data = AlignedPointer((uint8_t *)table + sizeof(BN_MontFixedBase), sizeof(BN_UINT));
+    BSL_SAL_ReferencesInit(&(table->references));
+    int32_t ret = FixedBasePrecompute(table, base, mont, opt);
+    if (ret != CRYPT_SUCCESS) {
+        BN_MontFixedBaseDestroy(table);
+        return NULL;
+    }
+    return table;
+}
+
+int32_t BN_MontFixedBaseUpRef(BN_MontFixedBase *table)
+{
+    if (table == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    int ref = 0;
+    return BSL_SAL_AtomicUpReferences(&(table->references), &ref);
+}
+
+void BN_MontFixedBaseDestroy(BN_MontFixedBase *table)
+{
+    if (table == NULL) {
+        return;
+    }
+    int ref = 0;
+    BSL_SAL_AtomicDownReferences(&(table->references), &ref);
+    if (ref > 0) {
+        return;
+    }
+    BSL_SAL_ReferencesFree(&(table->references));
+    uint32_t size = FixedBaseSize(table->mSize, table->teeth);
+    (void)memset_s(table, size, 0, size);
+    BSL_SAL_FREE(table);
+}
+
+/* Bit col of every row of the exponent, the bit of row k is bit k of the result. */
+static uint32_t FixedBaseColumn(const BN_BigNum *e, uint32_t col, const BN_MontFixedBase *table)
+{
+    uint32_t v = 0;
+    for (uint32_t k = table->teeth; k > 0; k--) {
+        uint32_t bit = (k - 1) * table->span + col;
+        uint32_t nw = bit / BN_UINT_BITS; /* shift words */
+        uint32_t nb = bit % BN_UINT_BITS; /* shift bits */
+        v <<= 1;
+        v |= (nw < e->size) ? (uint32_t)((e->data[nw] >> nb) & 1) : 0;
+    }
+    return v;
+}
+
+/* r = T[v], every entry is read to keep the access pattern independent of v */
+static void FixedBaseSelect(BN_UINT *r, const BN_MontFixedBase *table, uint32_t v)
+{
+    uint32_t mSize = table->mSize;
+    uint32_t num = 1u << table->teeth;
+    for (uint32_t j = 0; j < num; j++) {
+        BN_UINT mask = BN_IsZeroUintConsttime((BN_UINT)(j ^ v));
+        CopyConsttime(r, table->data + j * mSize, r, mSize, mask);
+    }
+}
+
+static int32_t MontExpFixedBaseCore(BN_BigNum *r, const BN_MontFixedBase *table, const BN_BigNum *e,
+    BN_Mont *mont, BN_Optimizer *opt)
+{
+    uint32_t mSize = mont->mSize;
+    int32_t ret = OptimizerStart(opt);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    /* r may be e, the result is accumulated apart */
+    BN_BigNum *acc = OptimizerGetBn(opt, mSize);
+    BN_BigNum *sel = OptimizerGetBn(opt, mSize);
+    if (acc == NULL || sel == NULL) {
+        OptimizerEnd(opt);
+        BSL_ERR_PUSH_ERROR(CRYPT_BN_OPTIMIZER_GET_FAIL);
+        return CRYPT_BN_OPTIMIZER_GET_FAIL;
+    }
+    BN_COPY_BYTES(acc->data, mSize, table->data, mSize);
+    uint32_t col = table->span;
+    do {
+        col--;
+        if (col + 1 != table->span) {
+            ret = MontSqrBin(acc->data, mont, opt, true);
+            if (ret != CRYPT_SUCCESS) {
+                OptimizerEnd(opt);
+                return ret;
+            }
+        }
+        FixedBaseSelect(sel->data, table, FixedBaseColumn(e, col, table));
+        ret = MontMulBin(acc->data, acc->data, sel->data, mont, opt, true);
+        if (ret != CRYPT_SUCCESS) {
+            OptimizerEnd(opt);
+            return ret;
+        }
+    } while (col != 0);
+    /* field conversion */
+    MontDecBin(acc->data, mont);
+    BN_COPY_BYTES(r->data, r->room, acc->data, mSize);
+    r->size = BinFixSize(r->data, mSize);
+    BN_CLRNEG(r->flag);
+    OptimizerEnd(opt);
+    return CRYPT_SUCCESS;
+}
+
+int32_t BN_MontExpFixedBase(BN_BigNum *r, const BN_MontFixedBase *table, const BN_BigNum *e, BN_Mont *mont,
+    BN_Optimizer *opt)
+{
+    if (r == NULL || table == NULL || e == NULL || mont == NULL || opt == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (BN_ISNEG(e->flag)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_BN_ERR_EXP_NO_NEGATIVE);
+        return CRYPT_BN_ERR_EXP_NO_NEGATIVE;
+    }
+    if (table->mSize != mont->mSize || BinBits(e->data, e->size) > table->span * table->teeth) {
+        BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+        return CRYPT_INVALID_ARG;
+    }
+    if (BnExtend(r, mont->mSize) != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    return MontExpFixedBaseCore(r, table, e, mont, opt);
+}
 #endif /* HITLS_CRYPTO_BN */
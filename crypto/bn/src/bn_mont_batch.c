@@ -0,0 +1,307 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#ifdef HITLS_CRYPTO_BN
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "securec.h"
+#include "bsl_err_internal.h"
+#include "bsl_sal.h"
+#include "crypt_errno.h"
+#include "crypt_utils.h"
+#include "bn_bincal.h"
+#include "bn_optimizer.h"
+#include "bn_montbin.h"
+
+#if defined(HITLS_CRYPTO_BN_X8664) && defined(HITLS_SIXTY_FOUR_BITS)
+#define MONT_X8_LANES 8
+#define MONT_X8_LIMB_BITS 52
+#define MONT_X8_MASK (((uint64_t)1 << MONT_X8_LIMB_BITS) - 1)
+/* The kernel keeps a number on the stack, larger moduli are computed one by one. */
+#define MONT_X8_MAX_BITS 8192
+/* Eight lanes cost the same for any number of items, fewer items are faster one by one. */
+#define MONT_X8_MIN_NUM 2
+
+/* Numbers of the eight lanes in radix 2 ^ 52, n rows of MONT_X8_LANES limbs each. */
+typedef struct {
+    uint32_t n;
+    uint64_t k0[MONT_X8_LANES];
+    uint64_t *m;
+    uint64_t *rr;       /* 2 ^ (104 * n) mod m */
+    uint64_t *base;     /* a * 2 ^ (52 * n) mod m */
+    uint64_t *x;
+    uint64_t *one;
+} MontX8Ctx;
+
+static bool MontX8Enable(void)
+{
+    // The cpuid state is filled in by CRYPT_EAL_Init, before that the items are computed one by one.
+    return IsSupportAVX512IFMA() && IsSupportAVX512F() && IsOSSupportAVX512();
+}
+
+/* The almost Montgomery multiplication needs 4 * m < 2 ^ (52 * n). */
+static uint32_t MontX8Limbs(const BN_Mont *mont)
+{
+    return (BinBits(mont->mod, mont->mSize) + 2 + MONT_X8_LIMB_BITS - 1) / MONT_X8_LIMB_BITS;
+}
+
+/* Write a, size words, to one lane of n rows. */
+static void MontX8Load(uint64_t *rows, uint32_t lane, uint32_t n, const BN_UINT *a, uint32_t size)
+{
+    uint32_t bit = 0;
+    for (uint32_t i = 0; i < n; i++, bit += MONT_X8_LIMB_BITS) {
+        uint32_t nw = bit / BN_UINT_BITS;
+        uint32_t nb = bit % BN_UINT_BITS;
+        uint64_t v = 0;
+        if (nw < size) {
+            v = a[nw] >> nb;
+            if (nb > BN_UINT_BITS - MONT_X8_LIMB_BITS && nw + 1 < size) {
+                v |= a[nw + 1] << (BN_UINT_BITS - nb);
+            }
+        }
+        rows[i * MONT_X8_LANES + lane] = v & MONT_X8_MASK;
+    }
+}
+
+/* Read one lane of n rows to r, size words, the value must fit. */
+static void MontX8Store(BN_UINT *r, uint32_t size, const uint64_t *rows, uint32_t lane, uint32_t n)
+{
+    uint32_t bit = 0;
+    (void)memset_s(r, size * sizeof(BN_UINT), 0, size * sizeof(BN_UINT));
+    for (uint32_t i = 0; i < n; i++, bit += MONT_X8_LIMB_BITS) {
+        uint32_t nw = bit / BN_UINT_BITS;
+        uint32_t nb = bit % BN_UINT_BITS;
+        uint64_t v = rows[i * MONT_X8_LANES + lane];
+        if (nw < size) {
+            r[nw] |= v << nb;
+        }
+        if (nb > BN_UINT_BITS - MONT_X8_LIMB_BITS && nw + 1 < size) {
+            r[nw + 1] |= v >> (BN_UINT_BITS - nb);
+        }
+    }
+}
+
+static void MontX8CopyLane(uint64_t *rows, uint32_t dst, uint32_t src, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        rows[i * MONT_X8_LANES + dst] = rows[i * MONT_X8_LANES + src];
+    }
+}
+
+/* rr of the lane = 2 ^ (104 * n) mod m */
+static int32_t MontX8SetRR(MontX8Ctx *ctx, uint32_t lane, const BN_Mont *mont, BN_Optimizer *opt)
+{
+    uint32_t bits = 2 * MONT_X8_LIMB_BITS * ctx->n;
+    int32_t ret = OptimizerStart(opt);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    BN_BigNum *x = OptimizerGetBn(opt, BITS_TO_BN_UNIT(bits + 1));
+    BN_BigNum *m = OptimizerGetBn(opt, mont->mSize);
+    BN_BigNum *rr = OptimizerGetBn(opt, mont->mSize);
+    if (x == NULL || m == NULL || rr == NULL) {
+        OptimizerEnd(opt);
+        BSL_ERR_PUSH_ERROR(CRYPT_BN_OPTIMIZER_GET_FAIL);
+        return CRYPT_BN_OPTIMIZER_GET_FAIL;
+    }
+    BN_COPY_BYTES(m->data, mont->mSize, mont->mod, mont->mSize);
+    m->size = BinFixSize(m->data, mont->mSize);
+    ret = BN_SetBit(x, bits);
+    if (ret == CRYPT_SUCCESS) {
+        ret = BN_Mod(rr, x, m, opt);
+    }
+    if (ret == CRYPT_SUCCESS) {
+        MontX8Load(ctx->rr, lane, ctx->n, rr->data, rr->size);
+    }
+    OptimizerEnd(opt);
+    return ret;
+}
+
+/* Lane i computes item i, the lanes after num repeat item 0. Lanes of the same context share m, k0 and rr. */
+static int32_t MontX8Ready(MontX8Ctx *ctx, const BN_BigNum *a[], BN_Mont *mont[], uint32_t num,
+    BN_Optimizer *opt)
+{
+    uint32_t lane;
+    uint32_t n = 0;
+    for (lane = 0; lane < num; lane++) {
+        uint32_t limbs = MontX8Limbs(mont[lane]);
+        n = (limbs > n) ? limbs : n;
+    }
+    ctx->n = n;
+    for (lane = 0; lane < MONT_X8_LANES; lane++) {
+        uint32_t i = (lane < num) ? lane : 0;
+        uint32_t j = 0;
+        while (j < lane && mont[(j < num) ? j : 0] != mont[i]) {
+            j++;
+        }
+        if (j < lane) {
+            ctx->k0[lane] = ctx->k0[j];
+            MontX8CopyLane(ctx->m, lane, j, n);
+            MontX8CopyLane(ctx->rr, lane, j, n);
+        } else {
+            ctx->k0[lane] = (uint64_t)mont[i]->k0 & MONT_X8_MASK;
+            MontX8Load(ctx->m, lane, n, mont[i]->mod, mont[i]->mSize);
+            int32_t ret = MontX8SetRR(ctx, lane, mont[i], opt);
+            if (ret != CRYPT_SUCCESS) {
+                return ret;
+            }
+        }
+        MontX8Load(ctx->base, lane, n, a[i]->data, a[i]->size);
+    }
+    return CRYPT_SUCCESS;
+}
+
+/* r[i] = a[i] ^ e mod m[i] for num <= MONT_X8_LANES items, left-to-right binary over the public exponent */
+static int32_t MontExpX8(BN_BigNum *r[], const BN_BigNum *a[], const BN_BigNum *e, BN_Mont *mont[], uint32_t num,
+    MontX8Ctx *ctx, BN_Optimizer *opt)
+{
+    int32_t ret = MontX8Ready(ctx, a, mont, num, opt);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    uint32_t n = ctx->n;
+    uint32_t rowsSize = n * MONT_X8_LANES * (uint32_t)sizeof(uint64_t);
+    MontMul52x8(ctx->base, ctx->base, ctx->rr, ctx->m, ctx->k0, n); /* field conversion */
+    (void)memcpy_s(ctx->x, rowsSize, ctx->base, rowsSize);
+    uint32_t bit = BinBits(e->data, e->size) - 1;
+    while (bit > 0) {
+        bit--;
+        MontMul52x8(ctx->x, ctx->x, ctx->x, ctx->m, ctx->k0, n);
+        if (BN_GetBit(e, bit)) {
+            MontMul52x8(ctx->x, ctx->x, ctx->base, ctx->m, ctx->k0, n);
+        }
+    }
+    (void)memset_s(ctx->one, rowsSize, 0, rowsSize);
+    for (uint32_t lane = 0; lane < MONT_X8_LANES; lane++) {
+        ctx->one[lane] = 1;
+    }
+    MontMul52x8(ctx->x, ctx->x, ctx->one, ctx->m, ctx->k0, n); /* field conversion, the result is at most m */
+    for (uint32_t i = 0; i < num; i++) {
+        uint32_t mSize = mont[i]->mSize;
+        MontX8Store(r[i]->data, mSize, ctx->x, i, n);
+        if (BinCmp(r[i]->data, mSize, mont[i]->mod, mSize) >= 0) {
+            (void)BinSub(r[i]->data, r[i]->data, mont[i]->mod, mSize);
+        }
+        r[i]->size = BinFixSize(r[i]->data, mSize);
+        BN_CLRNEG(r[i]->flag);
+    }
+    return CRYPT_SUCCESS;
+}
+
+static bool MontExpBatchX8Enable(const BN_BigNum *e, BN_Mont *mont[], uint32_t num)
+{
+    if (num < MONT_X8_MIN_NUM || BinBits(e->data, e->size) == 0 || !MontX8Enable()) {
+        return false;
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        if (BinBits(mont[i]->mod, mont[i]->mSize) > MONT_X8_MAX_BITS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int32_t MontExpBatchX8(BN_BigNum *r[], const BN_BigNum *a[], const BN_BigNum *e, BN_Mont *mont[],
+    uint32_t num, BN_Optimizer *opt)
+{
+    uint32_t n = 0;
+    uint32_t i;
+    for (i = 0; i < num; i++) {
+        uint32_t limbs = MontX8Limbs(mont[i]);
+        n = (limbs > n) ? limbs : n;
+    }
+    uint32_t rowsNum = n * MONT_X8_LANES;
+    uint64_t *buf = BSL_SAL_Malloc(rowsNum * 5 * sizeof(uint64_t)); /* m, rr, base, x and one */
+    if (buf == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    MontX8Ctx ctx = {0};
+    ctx.m = buf;
+    ctx.rr = ctx.m + rowsNum;
+    ctx.base = ctx.rr + rowsNum;
+    ctx.x = ctx.base + rowsNum;
+    ctx.one = ctx.x + rowsNum;
+    int32_t ret = CRYPT_SUCCESS;
+    for (i = 0; i < num && ret == CRYPT_SUCCESS; i += MONT_X8_LANES) {
+        uint32_t cnt = (num - i < MONT_X8_LANES) ? (num - i) : MONT_X8_LANES;
+        if (cnt < MONT_X8_MIN_NUM) {
+            for (uint32_t j = i; j < num && ret == CRYPT_SUCCESS; j++) {
+                ret = BN_MontExp(r[j], a[j], e, mont[j], opt);
+            }
+            break;
+        }
+        ret = MontExpX8(r + i, a + i, e, mont + i, cnt, &ctx, opt);
+    }
+    BSL_SAL_FREE(buf);
+    return ret;
+}
+#endif
+
+static int32_t MontExpBatchParaCheck(BN_BigNum *r[], const BN_BigNum *a[], const BN_BigNum *e, BN_Mont *mont[],
+    uint32_t num, const BN_Optimizer *opt)
+{
+    if (r == NULL || a == NULL || e == NULL || mont == NULL || opt == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (BN_ISNEG(e->flag)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_BN_ERR_EXP_NO_NEGATIVE);
+        return CRYPT_BN_ERR_EXP_NO_NEGATIVE;
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        if (r[i] == NULL || a[i] == NULL || mont[i] == NULL) {
+            BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+            return CRYPT_NULL_INPUT;
+        }
+        if (r[i] == e) {
+            BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+            return CRYPT_INVALID_ARG;
+        }
+        if (BN_ISNEG(a[i]->flag) || BinCmp(a[i]->data, a[i]->size, mont[i]->mod, mont[i]->mSize) >= 0) {
+            BSL_ERR_PUSH_ERROR(CRYPT_BN_MONT_BASE_TOO_MAX);
+            return CRYPT_BN_MONT_BASE_TOO_MAX;
+        }
+        if (BnExtend(r[i], mont[i]->mSize) != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+            return CRYPT_MEM_ALLOC_FAIL;
+        }
+    }
+    return CRYPT_SUCCESS;
+}
+
+int32_t BN_MontExpBatch(BN_BigNum *r[], const BN_BigNum *a[], const BN_BigNum *e, BN_Mont *mont[], uint32_t num,
+    BN_Optimizer *opt)
+{
+    int32_t ret = MontExpBatchParaCheck(r, a, e, mont, num, opt);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+#if defined(HITLS_CRYPTO_BN_X8664) && defined(HITLS_SIXTY_FOUR_BITS)
+    if (MontExpBatchX8Enable(e, mont, num)) {
+        return MontExpBatchX8(r, a, e, mont, num, opt);
+    }
+#endif
+    for (uint32_t i = 0; i < num; i++) {
+        ret = BN_MontExp(r[i], a[i], e, mont[i], opt);
+        if (ret != CRYPT_SUCCESS) {
+            return ret;
+        }
+    }
+    return CRYPT_SUCCESS;
+}
+#endif /* HITLS_CRYPTO_BN */
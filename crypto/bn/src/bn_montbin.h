@@ -39,6 +39,17 @@ int32_t MontEncBin(BN_UINT *r, BN_Mont *mont, BN_Optimizer *opt, bool consttime)
 /* r = reduce(x * 1) mod m = (x * R') mod m */
 void Reduce(BN_UINT *r, BN_UINT *x, const BN_UINT *m, uint32_t mSize, BN_UINT m0);
 
+#ifdef HITLS_CRYPTO_BN_X8664
+/**
+ * Eight lanes almost Montgomery multiplication with AVX-512 IFMA, implemented in asm/bn_mont_ifma_x86_64.S.
+ * r = a * b / 2 ^ (52 * n) mod m in every lane, numbers are n rows of eight limbs in radix 2 ^ 52, row i holds
+ * limb i of the lanes. a and b lower than 2 * m give r lower than 2 * m when 4 * m < 2 ^ (52 * n).
+ * k0 is -m ^ -1 mod 2 ^ 52 of the lanes, r may alias a or b, n is at least 2.
+ */
+void MontMul52x8(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *m, const uint64_t *k0,
+    uint32_t n);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,17 +47,19 @@ static BN_UINT PrimeLimbGen(BN_UINT base, int32_t len)
 
 static void PrimeTableGen(void)
 {
-    static bool gen = false;
-    if (gen) {
-        return;
-    }
     g_primesTable[0] = 2;
     g_primesTable[1] = 3;
     int32_t i;
     for (i = 2; i < 2048; i++) {
         g_primesTable[i] = PrimeLimbGen(g_primesTable[i - 1], i);
     }
-    gen = true;
+}
+
+// Primes may be generated on several threads at once, e.g. p and q of an RSA key.
+static uint32_t g_primesTableOnce = 0;
+static void PrimeTableInit(void)
+{
+    (void)BSL_SAL_ThreadRunOnce(&g_primesTableOnce, PrimeTableGen);
 }
 
 // Minimum times of checking for Miller-Rabin.
@@ -116,94 +118,45 @@ static int32_t LimbCheck(const BN_BigNum *bn)
     return ret;
 }
 
-/* The random number increases by 2 each time, and added for n times,
-   so that it is mutually primed to all data in the prime table. */
-static int32_t FillUp(BN_BigNum *rnd, const BN_UINT *mods, uint32_t modsLen)
+/* The farthest step from a random start before the search draws a new one. */
+#define PRIME_SIEVE_MAX_DELTA ((BN_UINT)1 << 20)
+
+/* The residues are computed once per start, so the whole table is affordable unless it overlaps the candidates. */
+static uint32_t SieveCnt(uint32_t bits)
 {
-    uint32_t i;
-    uint32_t complete = 0;
-    uint32_t bits = BN_Bits(rnd);
-    uint32_t cnt = modsLen;
-    BN_UINT inc = 0;
-    while (complete == 0) {
-        for (i = 1; i < cnt; i++) {
-            if ((mods[i] + inc) % g_primesTable[i] == 0) {
-                inc += 2;
-                break;
-            }
-            if (i == cnt - 1) { // end and exit
-                complete = 1;
-            }
-        }
-        if (inc + 2 == 0) { // inc increases by 2 each time. Check whether the inc may overflow.
-            BSL_ERR_PUSH_ERROR(CRYPT_BN_NOR_CHECK_PRIME);
-            return CRYPT_BN_NOR_CHECK_PRIME;
-        }
-    }
-    int32_t ret = BN_AddLimb(rnd, rnd, inc);
-    if (ret != CRYPT_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        return ret;
-    }
-    // If the random number length of a prime number is incorrect, generate a new random number.
-    if (BN_Bits(rnd) != bits) {
-        BSL_ERR_PUSH_ERROR(CRYPT_BN_NOR_CHECK_PRIME);
-        return CRYPT_BN_NOR_CHECK_PRIME;
+    if (bits < 32) { // candidates above 2^31 are larger than any prime in the table
+        return DivisorsCnt(bits);
     }
-    return CRYPT_SUCCESS;
+    return (uint32_t)(sizeof(g_primesTable) / sizeof(g_primesTable[0]));
 }
 
-/* Generate random numbers that can be mutually primed with the data in the small prime number table. */
-static int32_t ProbablePrime(BN_BigNum *rnd, uint32_t bits, bool half, BN_Optimizer *opt)
+/* The residues of the random start modulo the small primes, computed once per start. */
+static void SieveInit(BN_UINT *mods, const BN_BigNum *rnd, uint32_t cnt)
 {
-    const int32_t maxCnt = 100;
-    int32_t tryCnt = 0;
     uint32_t i;
-    int32_t ret;
-    uint32_t cnt = DivisorsCnt(bits);
-    ret = OptimizerStart(opt);
-    if (ret != CRYPT_SUCCESS) {
-        return ret;
-    }
-    BN_BigNum *mods = OptimizerGetBn(opt, cnt);
-    if (mods == NULL) {
-        OptimizerEnd(opt);
-        BSL_ERR_PUSH_ERROR(CRYPT_BN_OPTIMIZER_GET_FAIL);
-        return CRYPT_BN_OPTIMIZER_GET_FAIL;
+    for (i = 1; i < cnt; i++) {
+        mods[i] = ModLimbHalf(rnd, g_primesTable[i]);
     }
+}
 
-    uint32_t top = ((half == true) ? BN_RAND_TOP_TWOBIT : BN_RAND_TOP_ONEBIT);
-    do {
-        tryCnt++;
-        if (tryCnt > maxCnt) {
-            /* If it cannot be generated after loop 100 times, a failure message is returned. */
-            OptimizerEnd(opt);
-            /* In this case, the random number may be incorrect. Keep the error information. */
-            BSL_ERR_PUSH_ERROR(CRYPT_BN_NOR_GEN_PRIME);
-            return CRYPT_BN_NOR_GEN_PRIME;
-        }
-        // 'top' can control whether to set the most two significant bits to 1.
-        // RSA key generation usually focuses on this parameter to ensure the length of p*q.
-        ret = BN_Rand(rnd, bits, top, BN_RAND_BOTTOM_ONEBIT);
-        if (ret != CRYPT_SUCCESS) {
-            BSL_ERR_PUSH_ERROR(ret);
-            OptimizerEnd(opt);
-            return ret;
-        }
-        // Random number rnd divided by the prime number in the table of small prime numbers, modulo mods.
+/* Advance delta in steps of 2 until start + delta has no factor in the small prime table, the residues of the
+   candidate are mods[i] + delta. Return false if no such candidate is left in the window. */
+static bool SieveNext(const BN_UINT *mods, uint32_t cnt, BN_UINT *delta)
+{
+    BN_UINT d;
+    uint32_t i;
+    for (d = *delta; d <= PRIME_SIEVE_MAX_DELTA; d += 2) {
         for (i = 1; i < cnt; i++) {
-            mods->data[i] = ModLimbHalf(rnd, g_primesTable[i]);
+            if ((mods[i] + d) % g_primesTable[i] == 0) {
+                break;
+            }
         }
-        // Check the mods and supplement the rnd.
-        ret = FillUp(rnd, mods->data, cnt);
-        if (ret != CRYPT_BN_NOR_CHECK_PRIME && ret != CRYPT_SUCCESS) {
-            BSL_ERR_PUSH_ERROR(ret);
-            OptimizerEnd(opt);
-            return ret;
+        if (i == cnt) {
+            *delta = d;
+            return true;
         }
-    } while (ret == CRYPT_BN_NOR_CHECK_PRIME);
-    OptimizerEnd(opt);
-    return ret;
+    }
+    return false;
 }
 
 static int32_t BnCheck(const BN_BigNum *bnSubOne, const BN_BigNum *bnSubThree,
@@ -315,20 +268,11 @@ static uint32_t GetP(const BN_BigNum *bn)
     return p;
 }
 
-// CRYPT_SUCCESS is returned for a prime number,
-// and CRYPT_BN_NOR_CHECK_PRIME is returned for a non-prime number. Other error codes are returned.
-static int32_t MillerRabinPrimeVerify(const BN_BigNum *bn, BN_Optimizer *opt)
+// Miller-Rabin test of an odd bn > 3 with a Montgomery context of bn.
+static int32_t MillerRabinVerifyMont(const BN_BigNum *bn, BN_Mont *mont, BN_Optimizer *opt)
 {
-    int32_t ret = CRYPT_SUCCESS;
     uint32_t p;
-    if (PrimeLimbCheck(bn) == CRYPT_SUCCESS) { /* 2 and 3 directly determine that the number is a prime number. */
-        return CRYPT_SUCCESS;
-    }
-    if (!BN_GetBit(bn, 0)) { // even
-        BSL_ERR_PUSH_ERROR(CRYPT_BN_NOR_CHECK_PRIME);
-        return CRYPT_BN_NOR_CHECK_PRIME;
-    }
-    ret = OptimizerStart(opt);
+    int32_t ret = OptimizerStart(opt);
     if (ret != CRYPT_SUCCESS) {
         return ret;
     }
@@ -336,7 +280,6 @@ static int32_t MillerRabinPrimeVerify(const BN_BigNum *bn, BN_Optimizer *opt)
     BN_BigNum *bnSubThree = OptimizerGetBn(opt, bn->size); // bnSubThree = bn - 3
     BN_BigNum *divisor = OptimizerGetBn(opt, bn->size); // divisor = bnSubOne / 2^p
     BN_BigNum *rnd = OptimizerGetBn(opt, bn->size); // rnd to verify bn
-    BN_Mont *mont = BN_MontCreate(bn);
 
     ret = BnCheck(bnSubOne, bnSubThree, divisor, rnd, mont);
     if (ret != CRYPT_SUCCESS) {
@@ -358,11 +301,31 @@ static int32_t MillerRabinPrimeVerify(const BN_BigNum *bn, BN_Optimizer *opt)
     }
     ret = MillerRabinCheckCore(bn, mont, rnd, divisor, bnSubOne, bnSubThree, p, opt);
 ERR:
-    BN_MontDestroy(mont);
     OptimizerEnd(opt);
     return ret;
 }
 
+// CRYPT_SUCCESS is returned for a prime number,
+// and CRYPT_BN_NOR_CHECK_PRIME is returned for a non-prime number. Other error codes are returned.
+static int32_t MillerRabinPrimeVerify(const BN_BigNum *bn, BN_Optimizer *opt)
+{
+    if (PrimeLimbCheck(bn) == CRYPT_SUCCESS) { /* 2 and 3 directly determine that the number is a prime number. */
+        return CRYPT_SUCCESS;
+    }
+    if (!BN_GetBit(bn, 0)) { // even
+        BSL_ERR_PUSH_ERROR(CRYPT_BN_NOR_CHECK_PRIME);
+        return CRYPT_BN_NOR_CHECK_PRIME;
+    }
+    BN_Mont *mont = BN_MontCreate(bn);
+    if (mont == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    int32_t ret = MillerRabinVerifyMont(bn, mont, opt);
+    BN_MontDestroy(mont);
+    return ret;
+}
+
 // CRYPT_SUCCESS is returned for a prime number,
 // and CRYPT_BN_NOR_CHECK_PRIME is returned for a non-prime number. Other error codes are returned.
 int32_t BN_PrimeCheck(const BN_BigNum *bn, BN_Optimizer *opt)
@@ -382,7 +345,7 @@ int32_t BN_PrimeCheck(const BN_BigNum *bn, BN_Optimizer *opt)
         BSL_ERR_PUSH_ERROR(CRYPT_BN_NOR_CHECK_PRIME);
         return CRYPT_BN_NOR_CHECK_PRIME;
     }
-    PrimeTableGen(); // Generate a small prime number table.
+    PrimeTableInit(); // Generate a small prime number table.
     ret = LimbCheck(bn);
     if (ret != CRYPT_SUCCESS) {
         return ret;
@@ -448,23 +411,41 @@ static int32_t GenCheck(BN_BigNum *bn, uint32_t bits, const BN_Optimizer *opt)
     return CRYPT_SUCCESS;
 }
 
-// Create a new optimizer to prevent optimizer from using too much memory.
-static int32_t PrimeVerifyGenPrime(const BN_BigNum *bn)
+/* The Miller-Rabin state of a prime search. All candidates have the same size, so one Montgomery context is
+   reset for each of them, and a separate optimizer keeps the caller's optimizer from growing. */
+typedef struct {
+    BN_Mont *mont;
+    BN_Optimizer *opt;
+} PrimeVerifyCtx;
+
+static int32_t PrimeVerifyCandidate(PrimeVerifyCtx *verify, const BN_BigNum *bn)
 {
-    BN_Optimizer *opt = BN_OptimizerCreate();
-    if (opt == NULL) {
-        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
-        return CRYPT_MEM_ALLOC_FAIL;
+    if (verify->mont == NULL) {
+        verify->mont = BN_MontCreate(bn);
+        if (verify->mont == NULL) {
+            BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+            return CRYPT_MEM_ALLOC_FAIL;
+        }
+    } else {
+        int32_t ret = MontSetMod(verify->mont, bn);
+        if (ret != CRYPT_SUCCESS) {
+            return ret;
+        }
     }
+    return MillerRabinVerifyMont(bn, verify->mont, verify->opt);
+}
 
-    int32_t ret = MillerRabinPrimeVerify(bn, opt);
-    BN_OptimizerDestroy(opt);
-    return ret;
+/* The candidate has to keep the bit length, and the two most significant bits if half is set. */
+static bool CandidateBitsCorrect(const BN_BigNum *bn, uint32_t bits, bool half)
+{
+    return BN_Bits(bn) == bits && (!half || BN_GetBit(bn, bits - 2));
 }
 
 // If the prime number r is generated successfully, CRYPT_SUCCESS is returned.
 // If the prime number r fails to be generated, CRYPT_BN_NOR_GEN_PRIME is returned. Other error codes are returned.
 // If half is 1, the prime number whose two most significant bits are 1 is generated.
+// The candidates are start, start + 2, ... from a random odd start, sieved with the small prime table through
+// residues that are computed once per start, and a new start is drawn after PRIME_SIEVE_MAX_DELTA.
 int32_t BN_GenPrime(BN_BigNum *r, uint32_t bits, bool half, BN_Optimizer *opt, BN_CbCtx *cb)
 {
     int32_t time = 0;
@@ -474,45 +455,78 @@ int32_t BN_GenPrime(BN_BigNum *r, uint32_t bits, bool half, BN_Optimizer *opt, B
         BSL_ERR_PUSH_ERROR(ret);
         return ret;
     }
-    PrimeTableGen(); // Generate a small prime number table.
+    PrimeTableInit(); // Generate a small prime number table.
     if (bits <= 14) { // The number within 14 bits is less than 17863 and can be obtained from the small prime table.
         return GenPrimeLimb(r, bits, half, opt);
     }
+    PrimeVerifyCtx verify = {NULL, BN_OptimizerCreate()};
+    if (verify.opt == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
     ret = OptimizerStart(opt);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
+        BN_OptimizerDestroy(verify.opt);
         return ret;
     }
-    /* To preventing insufficient space in addition operations when the rnd is constructed. */
+    uint32_t cnt = SieveCnt(bits);
+    /* To preventing insufficient space in addition operations when the candidate is constructed. */
     BN_BigNum *rnd = OptimizerGetBn(opt, BITS_TO_BN_UNIT(bits) + 1);
-    if (rnd == NULL) {
-        OptimizerEnd(opt);
+    BN_BigNum *cand = OptimizerGetBn(opt, BITS_TO_BN_UNIT(bits) + 1);
+    BN_BigNum *mods = OptimizerGetBn(opt, cnt);
+    if (rnd == NULL || cand == NULL || mods == NULL) {
         BSL_ERR_PUSH_ERROR(CRYPT_BN_OPTIMIZER_GET_FAIL);
-        return CRYPT_BN_OPTIMIZER_GET_FAIL;
+        ret = CRYPT_BN_OPTIMIZER_GET_FAIL;
+        goto ERR;
     }
-    do {
-        if (cb == NULL && maxTime == time) {
-            BSL_ERR_PUSH_ERROR(CRYPT_BN_NOR_GEN_PRIME);
-            OptimizerEnd(opt);
-            return CRYPT_BN_NOR_GEN_PRIME;
+    // 'top' can control whether to set the most two significant bits to 1.
+    // RSA key generation usually focuses on this parameter to ensure the length of p*q.
+    uint32_t top = ((half == true) ? BN_RAND_TOP_TWOBIT : BN_RAND_TOP_ONEBIT);
+    BN_UINT delta = PRIME_SIEVE_MAX_DELTA + 2; // no start yet
+    while (true) {
+        if (delta > PRIME_SIEVE_MAX_DELTA) {
+            ret = BN_Rand(rnd, bits, top, BN_RAND_BOTTOM_ONEBIT);
+            if (ret != CRYPT_SUCCESS) {
+                BSL_ERR_PUSH_ERROR(ret);
+                goto ERR;
+            }
+            SieveInit(mods->data, rnd, cnt);
+            delta = 0;
         }
-        if (BN_CbCtxCall(cb, time, 0) != CRYPT_SUCCESS) {
-            BSL_ERR_PUSH_ERROR(CRYPT_BN_NOR_GEN_PRIME);
-            OptimizerEnd(opt);
-            return CRYPT_BN_NOR_GEN_PRIME;
+        if (!SieveNext(mods->data, cnt, &delta)) {
+            delta = PRIME_SIEVE_MAX_DELTA + 2;
+            continue;
         }
-        // Generate a random number bn that may be a prime.
-        ret = ProbablePrime(rnd, bits, half, opt);
+        ret = BN_AddLimb(cand, rnd, delta);
         if (ret != CRYPT_SUCCESS) {
             BSL_ERR_PUSH_ERROR(ret);
-            OptimizerEnd(opt);
-            return ret;
+            goto ERR;
+        }
+        // The start is too close to the top of the range, draw a new one.
+        if (!CandidateBitsCorrect(cand, bits, half)) {
+            delta = PRIME_SIEVE_MAX_DELTA + 2;
+            continue;
+        }
+        if ((cb == NULL && maxTime == time) || BN_CbCtxCall(cb, time, 0) != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(CRYPT_BN_NOR_GEN_PRIME);
+            ret = CRYPT_BN_NOR_GEN_PRIME;
+            goto ERR;
         }
-        ret = PrimeVerifyGenPrime(rnd);
+        ret = PrimeVerifyCandidate(&verify, cand);
         time++;
-    } while (ret != CRYPT_SUCCESS);
-
+        if (ret != CRYPT_BN_NOR_CHECK_PRIME) {
+            break;
+        }
+        delta += 2;
+    }
+    if (ret == CRYPT_SUCCESS) {
+        ret = BN_Copy(r, cand);
+    }
+ERR:
     OptimizerEnd(opt);
-    return BN_Copy(r, rnd);
+    BN_MontDestroy(verify.mont);
+    BN_OptimizerDestroy(verify.opt);
+    return ret;
 }
 #endif /* HITLS_CRYPTO_BN */
@@ -206,6 +206,34 @@ int32_t CRYPT_CURVE25519_GetSignLen(const CRYPT_CURVE25519_Ctx *pkey);
 int32_t CRYPT_CURVE25519_Verify(const CRYPT_CURVE25519_Ctx *pkey, int32_t algid, const uint8_t *msg,
     uint32_t msgLen, const uint8_t *sign, uint32_t signLen);
 
+typedef struct {
+    const CRYPT_CURVE25519_Ctx *pkey;
+    const uint8_t *msg;
+    uint32_t msgLen;
+    const uint8_t *sign;
+    uint32_t signLen;
+} CRYPT_CURVE25519_VerifyItem;
+
+/**
+ * @ingroup curve25519
+ * @brief ed25519 batch verification
+ *
+ * The signatures are checked together with random weights by one multi-scalar multiplication, a batch that
+ * does not pass is verified one by one to find the failed signatures. The batch uses the cofactored equation
+ * [8](sB - R - kA) = 0, which also admits a signature that only differs by a small order component.
+ *
+ * @param items   [IN] Public keys, messages and signatures
+ * @param num     [IN] Number of items
+ * @param algid   [IN] md algid
+ * @param results [OUT] Result of each item, as returned by CRYPT_CURVE25519_Verify, num elements
+ *
+ * @retval CRYPT_SUCCESS                    All signatures are verified successfully.
+ * @retval CRYPT_NULL_INPUT                 items or results is NULL.
+ * @retval Other error codes                Result of the first failed item, see CRYPT_CURVE25519_Verify.
+ */
+int32_t CRYPT_CURVE25519_BatchVerify(const CRYPT_CURVE25519_VerifyItem *items, uint32_t num, int32_t algid,
+    int32_t *results);
+
 /**
  * @ingroup curve25519
  * @brief ed25519 Generate a key pair (public and private keys).
@@ -250,6 +278,38 @@ int32_t CRYPT_CURVE25519_ComputeSharedKey(CRYPT_CURVE25519_Ctx *prvKey, CRYPT_CU
  * @retval CRYPT_NULL_INPUT                     The input parameter is empty.
  */
 int32_t CRYPT_X25519_GenKey(CRYPT_CURVE25519_Ctx *pkey);
+
+/**
+ * @ingroup curve25519
+ * @brief x25519 Generate num key pairs, the public keys are computed eight at a time when AVX-512 IFMA is available.
+ *
+ * @param pkeys [IN/OUT] num key pair structures
+ * @param num   [IN] Number of key pairs
+ *
+ * @retval CRYPT_SUCCESS                        generated successfully.
+ * @retval CRYPT_NULL_INPUT                     pkeys or one of its elements is NULL, or num is 0.
+ * @retval Error code of the registered random number module. No key pair is generated.
+ */
+int32_t CRYPT_X25519_GenKeyBatch(CRYPT_CURVE25519_Ctx *const *pkeys, uint32_t num);
+
+/**
+ * @ingroup curve25519
+ * @brief x25519 Calculate num shared keys, sharedKeys[i] is the CRYPT_CURVE25519_KEYLEN bytes shared key of
+ *        prvKeys[i] and pubKeys[i]. The keys are computed eight at a time when AVX-512 IFMA is available.
+ *
+ * @param prvKeys     [IN] num key pair structures, local private keys
+ * @param pubKeys     [IN] num key pair structures, peer public keys
+ * @param sharedKeys  [OUT] num buffers of CRYPT_CURVE25519_KEYLEN bytes
+ * @param num         [IN] Number of shared keys
+ *
+ * @retval CRYPT_SUCCESS                        generated successfully.
+ * @retval CRYPT_NULL_INPUT                     The input parameter is empty, or num is 0.
+ * @retval CRYPT_CURVE25519_NO_PRVKEY           A private key is not set, nothing is computed.
+ * @retval CRYPT_CURVE25519_NO_PUBKEY           A public key is not set, nothing is computed.
+ * @retval CRYPT_CURVE25519_KEY_COMPUTE_FAILED  At least one shared key is zero, the other ones are valid.
+ */
+int32_t CRYPT_X25519_ComputeSharedKeyBatch(CRYPT_CURVE25519_Ctx *const *prvKeys,
+    CRYPT_CURVE25519_Ctx *const *pubKeys, uint8_t *const *sharedKeys, uint32_t num);
 #endif /* HITLS_CRYPTO_X25519 */
 
 /**
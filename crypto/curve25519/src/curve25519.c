@@ -26,6 +26,9 @@
 #include "crypt_types.h"
 #include "eal_md_local.h"
 #include "crypt_params_key.h"
+#ifdef HITLS_CRYPTO_CURVE25519_X8664
+#include "x25519_asm.h"
+#endif
 
 CRYPT_CURVE25519_Ctx *CRYPT_X25519_NewCtx(void)
 {
@@ -413,7 +416,6 @@ int32_t CRYPT_CURVE25519_Sign(CRYPT_CURVE25519_Ctx *pkey, int32_t algid, const u
     uint8_t r[CRYPT_CURVE25519_SIGNLEN];
     uint8_t k[CRYPT_CURVE25519_SIGNLEN];
     uint8_t outSign[CRYPT_CURVE25519_SIGNLEN];
-    GeE geTmp;
 
     ret = SignInputCheck(pkey, msg, msgLen, sign, signLen);
     if (ret != CRYPT_SUCCESS) {
@@ -435,8 +437,7 @@ int32_t CRYPT_CURVE25519_Sign(CRYPT_CURVE25519_Ctx *pkey, int32_t algid, const u
 
     // if ctx has no public key, generate public key and store it in ctx
     if ((pkey->keyType & CURVE25519_PUBKEY) == 0) {
-        ScalarMultiBase(&geTmp, prvKeyHash);
-        PointEncoding(&geTmp, pkey->pubKey, CRYPT_CURVE25519_KEYLEN);
+        ScalarMultiBaseEncode(pkey->pubKey, prvKeyHash);
         pkey->keyType |= CURVE25519_PUBKEY;
     }
 
@@ -447,8 +448,7 @@ int32_t CRYPT_CURVE25519_Sign(CRYPT_CURVE25519_Ctx *pkey, int32_t algid, const u
     }
 
     ModuloL(r);
-    ScalarMultiBase(&geTmp, r);
-    PointEncoding(&geTmp, outSign, CRYPT_CURVE25519_SIGNLEN);
+    ScalarMultiBaseEncode(outSign, r);
 
     ret = GetKHash(k, outSign, pkey->pubKey, msg, msgLen, pkey->hashMethod);
     if (ret != CRYPT_SUCCESS) {
@@ -530,7 +530,6 @@ int32_t CRYPT_CURVE25519_Verify(const CRYPT_CURVE25519_Ctx *pkey, int32_t algid,
         return CRYPT_EAL_ERR_ALGID;
     }
     int32_t ret;
-    GeE geA, sG;
     uint8_t kHash[CRYPT_CURVE25519_SIGNLEN];
     uint8_t localR[CRYPT_CURVE25519_KEYLEN];
 
@@ -553,24 +552,19 @@ int32_t CRYPT_CURVE25519_Verify(const CRYPT_CURVE25519_Ctx *pkey, int32_t algid,
         goto END;
     }
 
-    if (PointDecoding(&geA, pkey->pubKey) != 0) {
-        BSL_ERR_PUSH_ERROR(CRYPT_CURVE25519_VERIFY_FAIL);
-        ret = CRYPT_CURVE25519_INVALID_PUBKEY;
-        goto END;
-    }
-
     ret = GetKHash(kHash, r, pkey->pubKey, msg, msgLen, pkey->hashMethod);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
         goto END;
     }
 
-    CURVE25519_FP_NEGATE(geA.x.data, geA.x.data);
-    CURVE25519_FP_NEGATE(geA.t.data, geA.t.data);
-
     ModuloL(kHash);
-    KAMulPlusMulBase(&sG, kHash, &geA, s);
-    PointEncoding(&sG, localR, CRYPT_CURVE25519_KEYLEN);
+    // localR = s * B - k * A
+    if (KAMulPlusMulBaseEncode(localR, kHash, pkey->pubKey, s) != 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_CURVE25519_VERIFY_FAIL);
+        ret = CRYPT_CURVE25519_INVALID_PUBKEY;
+        goto END;
+    }
 
     if (memcmp(localR, r, CRYPT_CURVE25519_KEYLEN) == 0) {
         ret = CRYPT_SUCCESS;
@@ -583,6 +577,106 @@ END:
     return ret;
 }
 
+static void BatchVerifyOneByOne(const CRYPT_CURVE25519_VerifyItem *items, uint32_t num, int32_t algid,
+    int32_t *results)
+{
+    uint32_t i;
+    for (i = 0; i < num; i++) {
+        results[i] = CRYPT_CURVE25519_Verify(items[i].pkey, algid, items[i].msg, items[i].msgLen,
+            items[i].sign, items[i].signLen);
+    }
+}
+
+#ifdef CURVE25519_FP51
+/* the input checks of CRYPT_CURVE25519_Verify without pushing errors, the failed item is verified alone */
+static bool BatchItemValid(const CRYPT_CURVE25519_VerifyItem *item)
+{
+    const CRYPT_CURVE25519_Ctx *pkey = item->pkey;
+    return pkey != NULL && (item->msg != NULL || item->msgLen == 0) && item->sign != NULL &&
+        (pkey->keyType & CURVE25519_PUBKEY) != 0 && item->signLen == CRYPT_CURVE25519_SIGNLEN &&
+        pkey->hashMethod != NULL && VerifyCheckSValid(item->sign + CRYPT_CURVE25519_KEYLEN);
+}
+
+/* verify at most CURVE25519_BATCH_MAX sha512 items together, falls back to one by one if the batch fails */
+static void BatchVerifyChunk(const CRYPT_CURVE25519_VerifyItem *items, uint32_t num, int32_t *results)
+{
+    Curve25519BatchTerm terms[CURVE25519_BATCH_MAX];
+    const CRYPT_CURVE25519_VerifyItem *termItems[CURVE25519_BATCH_MAX];
+    int32_t *termResults[CURVE25519_BATCH_MAX];
+    uint8_t weights[CURVE25519_BATCH_MAX * 16]; // 128 bits weight for each term
+    uint8_t kHash[CRYPT_CURVE25519_SIGNLEN];
+    uint8_t zs[CRYPT_CURVE25519_KEYLEN] = {0};
+    const uint8_t zero[CRYPT_CURVE25519_KEYLEN] = {0};
+    uint32_t termNum = 0;
+    uint32_t i;
+
+    for (i = 0; i < num; i++) {
+        const CRYPT_CURVE25519_VerifyItem *item = &items[i];
+        if (!BatchItemValid(item) || GetKHash(kHash, item->sign, item->pkey->pubKey, item->msg, item->msgLen,
+            item->pkey->hashMethod) != CRYPT_SUCCESS) {
+            BatchVerifyOneByOne(item, 1, CRYPT_MD_SHA512, &results[i]);
+            continue;
+        }
+        ModuloL(kHash);
+        terms[termNum].r = item->sign;
+        terms[termNum].pubKey = item->pkey->pubKey;
+        (void)memcpy_s(terms[termNum].zk, CRYPT_CURVE25519_KEYLEN, kHash, CRYPT_CURVE25519_KEYLEN);
+        termItems[termNum] = item;
+        termResults[termNum] = &results[i];
+        termNum++;
+    }
+    if (termNum == 0) {
+        return;
+    }
+    if (CRYPT_Rand(weights, termNum * 16) == CRYPT_SUCCESS) { // 16 bytes for each term
+        for (i = 0; i < termNum; i++) {
+            (void)memset_s(terms[i].z, CRYPT_CURVE25519_KEYLEN, 0, CRYPT_CURVE25519_KEYLEN);
+            (void)memcpy_s(terms[i].z, CRYPT_CURVE25519_KEYLEN, weights + i * 16, 16); // 16 bytes for each term
+            // zk = z * k, zs = zs + z * s, s is the second half of the signature
+            ScalarMulAdd(terms[i].zk, terms[i].z, terms[i].zk, zero);
+            ScalarMulAdd(zs, terms[i].z, termItems[i]->sign + CRYPT_CURVE25519_KEYLEN, zs);
+        }
+        if (BatchMulPlusMulBaseCheck(terms, termNum, zs) == CRYPT_SUCCESS) {
+            for (i = 0; i < termNum; i++) {
+                *termResults[i] = CRYPT_SUCCESS;
+            }
+            return;
+        }
+    }
+    for (i = 0; i < termNum; i++) {
+        BatchVerifyOneByOne(termItems[i], 1, CRYPT_MD_SHA512, termResults[i]);
+    }
+}
+#endif
+
+int32_t CRYPT_CURVE25519_BatchVerify(const CRYPT_CURVE25519_VerifyItem *items, uint32_t num, int32_t algid,
+    int32_t *results)
+{
+    if (items == NULL || results == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    uint32_t i;
+#ifdef CURVE25519_FP51
+    if (algid == CRYPT_MD_SHA512) {
+        for (i = 0; i < num; i += CURVE25519_BATCH_MAX) {
+            BatchVerifyChunk(items + i, (num - i < CURVE25519_BATCH_MAX) ? (num - i) : CURVE25519_BATCH_MAX,
+                results + i);
+        }
+    } else {
+        BatchVerifyOneByOne(items, num, algid, results);
+    }
+#else
+    BatchVerifyOneByOne(items, num, algid, results);
+#endif
+    for (i = 0; i < num; i++) {
+        if (results[i] != CRYPT_SUCCESS) {
+            return results[i];
+        }
+    }
+    return CRYPT_SUCCESS;
+}
+
 int32_t CRYPT_ED25519_GenKey(CRYPT_CURVE25519_Ctx *pkey)
 {
     if (pkey == NULL) {
@@ -597,7 +691,6 @@ int32_t CRYPT_ED25519_GenKey(CRYPT_CURVE25519_Ctx *pkey)
     int32_t ret;
     uint8_t prvKey[CRYPT_CURVE25519_KEYLEN];
     uint8_t prvKeyHash[CRYPT_CURVE25519_SIGNLEN];
-    GeE tmp;
 
     ret = CRYPT_Rand(prvKey, sizeof(prvKey));
     if (ret != CRYPT_SUCCESS) {
@@ -617,8 +710,7 @@ int32_t CRYPT_ED25519_GenKey(CRYPT_CURVE25519_Ctx *pkey)
     // on block 31, set second highest bit to 1
     prvKeyHash[31] |= 0x40;
 
-    ScalarMultiBase(&tmp, prvKeyHash);
-    PointEncoding(&tmp, pkey->pubKey, CRYPT_CURVE25519_KEYLEN);
+    ScalarMultiBaseEncode(pkey->pubKey, prvKeyHash);
 
     // The pkey is not empty. The length of the prvKey is CRYPT_CURVE25519_KEYLEN,
     // which is the same as the length of local prvKey.
@@ -687,8 +779,6 @@ void CRYPT_X25519_PublicFromPrivate(const uint8_t privateKey[CRYPT_CURVE25519_KE
     uint8_t publicKey[CRYPT_CURVE25519_KEYLEN])
 {
     uint8_t privateCopy[CRYPT_CURVE25519_KEYLEN];
-    GeE out;
-    Fp25 zPlusY, zMinusY, zMinusYInvert;
 
     (void)memcpy_s(privateCopy, sizeof(privateCopy), privateKey, sizeof(privateCopy));
 
@@ -696,13 +786,7 @@ void CRYPT_X25519_PublicFromPrivate(const uint8_t privateKey[CRYPT_CURVE25519_KE
     privateCopy[31] &= 0x7f;     /* decodeScalar25519(k): k_list[31] &= 0x7f */
     privateCopy[31] |= 0x40;      /* decodeScalar25519(k): k_list[31] |= 0x40 */
 
-    ScalarMultiBase(&out, privateCopy);
-
-    CURVE25519_FP_ADD(zPlusY.data, out.z.data, out.y.data);
-    CURVE25519_FP_SUB(zMinusY.data, out.z.data, out.y.data);
-    FpInvert(&zMinusYInvert, &zMinusY);
-    FpMul(&zPlusY, &zPlusY, &zMinusYInvert);
-    PolynomialToData(publicKey, &zPlusY);
+    X25519ScalarMultiBase(publicKey, privateCopy);
 
     /* cleanup tmp private key */
     BSL_SAL_CleanseData(privateCopy, sizeof(privateCopy));
@@ -728,6 +812,133 @@ int32_t CRYPT_X25519_GenKey(CRYPT_CURVE25519_Ctx *pkey)
 
     return CRYPT_SUCCESS;
 }
+
+/* scalar multiplications handed to X25519ScalarMultBatch at once */
+#define X25519_BATCH_NUM 8
+
+#ifdef HITLS_CRYPTO_CURVE25519_X8664
+/*
+ * Eight lanes cost about 51us, a ladder on one lane about 29us and the fixed base comb about 11us, so the ifma code
+ * pays off from 2 points or from 5 base point multiplications.
+ */
+#define X25519_IFMA_MIN_POINT 2
+#define X25519_IFMA_MIN_BASE 5
+#endif
+
+/* out[i] = X25519(scalars[i], points[i]) for num <= X25519_BATCH_NUM, points NULL selects the base point */
+static void X25519ScalarMultBatch(uint8_t *const *out, const uint8_t *const *scalars,
+    const uint8_t *const *points, uint32_t num)
+{
+#ifdef HITLS_CRYPTO_CURVE25519_X8664
+    if (num >= ((points == NULL) ? X25519_IFMA_MIN_BASE : X25519_IFMA_MIN_POINT) && X25519UseIfma()) {
+        X25519ScalarMultX8(out, scalars, points, num);
+        return;
+    }
+#endif
+    for (uint32_t i = 0; i < num; i++) {
+        if (points == NULL) {
+            CRYPT_X25519_PublicFromPrivate(scalars[i], out[i]);
+        } else {
+            ScalarMultiPoint(out[i], scalars[i], points[i]);
+        }
+    }
+}
+
+int32_t CRYPT_X25519_GenKeyBatch(CRYPT_CURVE25519_Ctx *const *pkeys, uint32_t num)
+{
+    const uint8_t *prvKeys[X25519_BATCH_NUM];
+    uint8_t *pubKeys[X25519_BATCH_NUM];
+    uint32_t i, j;
+
+    if (pkeys == NULL || num == 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    for (i = 0; i < num; i++) {
+        if (pkeys[i] == NULL) {
+            BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+            return CRYPT_NULL_INPUT;
+        }
+    }
+    for (i = 0; i < num; i++) {
+        int32_t ret = CRYPT_Rand(pkeys[i]->prvKey, sizeof(pkeys[i]->prvKey));
+        if (ret != CRYPT_SUCCESS) {
+            for (j = 0; j <= i; j++) {
+                BSL_SAL_CleanseData(pkeys[j]->prvKey, sizeof(pkeys[j]->prvKey));
+                pkeys[j]->keyType = 0;
+            }
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+    }
+    for (i = 0; i < num; i += X25519_BATCH_NUM) {
+        uint32_t n = (num - i < X25519_BATCH_NUM) ? (num - i) : X25519_BATCH_NUM;
+        for (j = 0; j < n; j++) {
+            prvKeys[j] = pkeys[i + j]->prvKey;
+            pubKeys[j] = pkeys[i + j]->pubKey;
+        }
+        X25519ScalarMultBatch(pubKeys, prvKeys, NULL, n);
+        for (j = 0; j < n; j++) {
+            pkeys[i + j]->keyType = CURVE25519_PRVKEY | CURVE25519_PUBKEY;
+        }
+    }
+    return CRYPT_SUCCESS;
+}
+
+static int32_t X25519ExchKeysCheck(CRYPT_CURVE25519_Ctx *const *prvKeys, CRYPT_CURVE25519_Ctx *const *pubKeys,
+    uint8_t *const *sharedKeys, uint32_t num)
+{
+    if (prvKeys == NULL || pubKeys == NULL || sharedKeys == NULL || num == 0) {
+        return CRYPT_NULL_INPUT;
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        if (prvKeys[i] == NULL || pubKeys[i] == NULL || sharedKeys[i] == NULL) {
+            return CRYPT_NULL_INPUT;
+        }
+        if ((prvKeys[i]->keyType & CURVE25519_PRVKEY) == 0) {
+            return CRYPT_CURVE25519_NO_PRVKEY;
+        }
+        if ((pubKeys[i]->keyType & CURVE25519_PUBKEY) == 0) {
+            return CRYPT_CURVE25519_NO_PUBKEY;
+        }
+    }
+    return CRYPT_SUCCESS;
+}
+
+int32_t CRYPT_X25519_ComputeSharedKeyBatch(CRYPT_CURVE25519_Ctx *const *prvKeys,
+    CRYPT_CURVE25519_Ctx *const *pubKeys, uint8_t *const *sharedKeys, uint32_t num)
+{
+    const uint8_t *scalars[X25519_BATCH_NUM];
+    const uint8_t *points[X25519_BATCH_NUM];
+    uint32_t i, j, k;
+
+    int32_t ret = X25519ExchKeysCheck(prvKeys, pubKeys, sharedKeys, num);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    for (i = 0; i < num; i += X25519_BATCH_NUM) {
+        uint32_t n = (num - i < X25519_BATCH_NUM) ? (num - i) : X25519_BATCH_NUM;
+        for (j = 0; j < n; j++) {
+            scalars[j] = prvKeys[i + j]->prvKey;
+            points[j] = pubKeys[i + j]->pubKey;
+        }
+        X25519ScalarMultBatch(sharedKeys + i, scalars, points, n);
+        for (j = 0; j < n; j++) {
+            uint8_t checkValid = 0;
+            for (k = 0; k < CRYPT_CURVE25519_KEYLEN; k++) {
+                checkValid |= sharedKeys[i + j][k];
+            }
+            if (checkValid == 0) {
+                ret = CRYPT_CURVE25519_KEY_COMPUTE_FAILED;
+            }
+        }
+    }
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+    }
+    return ret;
+}
 #endif /* HITLS_CRYPTO_X25519 */
 
 int32_t CRYPT_CURVE25519_Cmp(const CRYPT_CURVE25519_Ctx *a, const CRYPT_CURVE25519_Ctx *b)
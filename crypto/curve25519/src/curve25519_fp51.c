@@ -0,0 +1,921 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+/* Some of these codes are adapted from https://ed25519.cr.yp.to/software.html */
+
+#include "hitls_build.h"
+#ifdef HITLS_CRYPTO_CURVE25519
+
+#include <stdbool.h>
+#include "securec.h"
+#include "bsl_sal.h"
+#include "crypt_errno.h"
+#include "curve25519_local.h"
+
+#ifdef CURVE25519_FP51
+
+void Fp51DataToPoly(Fp51 *out, const uint8_t in[32])
+{
+    uint64_t h[5];
+
+    CURVE25519_BYTES7_LOAD(h, in);
+
+    CURVE25519_BYTES6_LOAD(h + 1, in + 7);
+    h[1] <<= 5;
+
+    CURVE25519_BYTES7_LOAD(h + 2, in + 13);
+    h[2] <<= 2;
+
+    CURVE25519_BYTES6_LOAD(h + 3, in + 20);
+    h[3] <<= 7;
+
+    CURVE25519_BYTES6_LOAD(h + 4, in + 26);
+    h[4] &= 0x7fffffffffff; // 41 bits mask = 0x7fffffffffff
+    h[4] <<= 4;
+
+    h[1] |= h[0] >> CURVE25519_51BITS;
+    h[0] &= CURVE25519_51BITS_MASK;
+
+    h[2] |= h[1] >> CURVE25519_51BITS;
+    h[1] &= CURVE25519_51BITS_MASK;
+
+    h[3] |= h[2] >> CURVE25519_51BITS;
+    h[2] &= CURVE25519_51BITS_MASK;
+
+    h[4] |= h[3] >> CURVE25519_51BITS;
+    h[3] &= CURVE25519_51BITS_MASK;
+
+    out->data[0] = h[0];
+    out->data[1] = h[1];
+    out->data[2] = h[2];
+    out->data[3] = h[3];
+    out->data[4] = h[4];
+}
+
+static void Fp51UnloadTo8Bits(uint8_t out[32], uint64_t h[5])
+{
+    // load from uint64 to uint8, load 8 bits at a time
+    out[0] = (uint8_t)h[0];
+    out[1] = (uint8_t)(h[0] >> 8);
+    out[2] = (uint8_t)(h[0] >> 16);
+    out[3] = (uint8_t)(h[0] >> 24);
+    out[4] = (uint8_t)(h[0] >> 32);
+    out[5] = (uint8_t)(h[0] >> 40);
+    // load from position 48 from h[1] and (8-5)=3 bits from h[1] to out[6]
+    out[6] = (uint8_t)((h[0] >> 48) | (uint8_t)(h[1] << 3));
+    out[7] = (uint8_t)(h[1] >> 5);
+    out[8] = (uint8_t)(h[1] >> 13);
+    out[9] = (uint8_t)(h[1] >> 21);
+    out[10] = (uint8_t)(h[1] >> 29);
+    out[11] = (uint8_t)(h[1] >> 37);
+    // load from position 45 from h[1] and (8-2)=6 bits from h[2] to out[12]
+    out[12] = (uint8_t)((h[1] >> 45) | (uint8_t)(h[2] << 6));
+    out[13] = (uint8_t)(h[2] >> 2);
+    out[14] = (uint8_t)(h[2] >> 10);
+    out[15] = (uint8_t)(h[2] >> 18);
+    out[16] = (uint8_t)(h[2] >> 26);
+    out[17] = (uint8_t)(h[2] >> 34);
+    out[18] = (uint8_t)(h[2] >> 42);
+    // load from position 50 from h[2] and (8-1)=7 bits from h[3] to out[19]
+    out[19] = (uint8_t)((h[2] >> 50) | (uint8_t)(h[3] << 1));
+    out[20] = (uint8_t)(h[3] >> 7);
+    out[21] = (uint8_t)(h[3] >> 15);
+    out[22] = (uint8_t)(h[3] >> 23);
+    out[23] = (uint8_t)(h[3] >> 31);
+    out[24] = (uint8_t)(h[3] >> 39);
+    // load from position 47 from h[3] and (4-4)=4 bits from h[4] to out[25]
+    out[25] = (uint8_t)((h[3] >> 47) | (uint8_t)(h[4] << 4));
+    out[26] = (uint8_t)(h[4] >> 4);
+    out[27] = (uint8_t)(h[4] >> 12);
+    out[28] = (uint8_t)(h[4] >> 20);
+    out[29] = (uint8_t)(h[4] >> 28);
+    out[30] = (uint8_t)(h[4] >> 36);
+    out[31] = (uint8_t)(h[4] >> 44);
+}
+
+void Fp51PolyToData(const Fp51 *in, uint8_t out[32])
+{
+    uint64_t h[5];
+    h[0] = in->data[0];
+    h[1] = in->data[1];
+    h[2] = in->data[2];
+    h[3] = in->data[3];
+    h[4] = in->data[4];
+    uint64_t carry;
+
+    carry = (h[0] + 19) >> CURVE25519_51BITS; // plus 19 then calculate carry
+    carry = (h[1] + carry) >> CURVE25519_51BITS;
+    carry = (h[2] + carry) >> CURVE25519_51BITS;
+    carry = (h[3] + carry) >> CURVE25519_51BITS;
+    carry = (h[4] + carry) >> CURVE25519_51BITS;
+
+    h[0] += 19 * carry; // process carry h[4] -> h[0], h[0] += 19 * carry
+    h[1] += h[0] >> CURVE25519_51BITS;
+    h[0] &= CURVE25519_51BITS_MASK;
+    h[2] += h[1] >> CURVE25519_51BITS;
+    h[1] &= CURVE25519_51BITS_MASK;
+    h[3] += h[2] >> CURVE25519_51BITS;
+    h[2] &= CURVE25519_51BITS_MASK;
+    h[4] += h[3] >> CURVE25519_51BITS;
+    h[3] &= CURVE25519_51BITS_MASK;
+    h[4] &= CURVE25519_51BITS_MASK;
+
+    Fp51UnloadTo8Bits(out, h);
+}
+
+/* out = in1 ^ (4 * 2 ^ (2 * times)) * in2 */
+static inline void Fp51MultiSquare(Fp51 *in1, Fp51 *in2, Fp51 *out, int32_t times)
+{
+    int32_t i;
+    Fp51 temp1, temp2;
+    Fp51Square(&temp1, in1);
+    Fp51Square(&temp2, &temp1);
+    for (i = 0; i < times; i++) {
+        Fp51Square(&temp1, &temp2);
+        Fp51Square(&temp2, &temp1);
+    }
+    Fp51Mul(out, in2, &temp2);
+}
+
+/* out = a ^ -1 */
+void Fp51Invert(Fp51 *out, const Fp51 *a)
+{
+    Fp51 a0;    /* save a^1         */
+    Fp51 a1;    /* save a^2         */
+    Fp51 a2;    /* save a^11        */
+    Fp51 a3;    /* save a^(2^5-1)   */
+    Fp51 a4;    /* save a^(2^10-1)  */
+    Fp51 a5;    /* save a^(2^20-1)  */
+    Fp51 a6;    /* save a^(2^40-1)  */
+    Fp51 a7;    /* save a^(2^50-1)  */
+    Fp51 a8;    /* save a^(2^100-1) */
+    Fp51 a9;    /* save a^(2^200-1) */
+    Fp51 a10;   /* save a^(2^250-1) */
+    Fp51 temp1, temp2;
+
+    /* We know a×b=1(mod p), then a and b are inverses of mod p, i.e. a=b^(-1), b=a^(-1);
+     * According to Fermat's little theorem a^(p-1)=1(mod p), so a*a^(p-2)=1(mod p);
+     * So the inverse element of a is a^(-1) = a^(p-2)(mod p)
+     * Here it is, p=2^255-19, thus we need to compute a^(2^255-21)(mod(2^255-19))
+     */
+
+    /* a^1 */
+    CURVE25519_FP51_COPY(a0.data, a->data);
+
+    /* a^2 */
+    Fp51Square(&a1, &a0);
+
+    /* a^4 */
+    Fp51Square(&temp1, &a1);
+
+    /* a^8 */
+    Fp51Square(&temp2, &temp1);
+
+    /* a^9 */
+    Fp51Mul(&temp1, &a0, &temp2);
+
+    /* a^11 */
+    Fp51Mul(&a2, &a1, &temp1);
+
+    /* a^22 */
+    Fp51Square(&temp2, &a2);
+
+    /* a^(2^5-1) = a^(9+22) */
+    Fp51Mul(&a3, &temp1, &temp2);
+
+    /* a^(2^10-1) = a^(2^10-2^5) * a^(2^5-1) */
+    Fp51Square(&temp1, &a3);
+    Fp51Square(&temp2, &temp1);
+    Fp51Square(&temp1, &temp2);
+    Fp51Square(&temp2, &temp1);
+    Fp51Square(&temp1, &temp2);
+    Fp51Mul(&a4, &a3, &temp1);
+
+    /* a^(2^20-1) = a^(2^20-2^10) * a^(2^10-1) */
+    Fp51MultiSquare(&a4, &a4, &a5, 4); // (2 * 2) ^ 4
+
+    /* a^(2^40-1) = a^(2^40-2^20) * a^(2^20-1) */
+    Fp51MultiSquare(&a5, &a5, &a6, 9); // (2 * 2) ^ 9
+
+    /* a^(2^50-1) = a^(2^50-2^10) * a^(2^10-1) */
+    Fp51MultiSquare(&a6, &a4, &a7, 4); // (2 * 2) ^ 4
+
+    /* a^(2^100-1) = a^(2^100-2^50) * a^(2^50-1) */
+    Fp51MultiSquare(&a7, &a7, &a8, 24); // (2 * 2) ^ 24
+
+    /* a^(2^200-1) = a^(2^200-2^100) * a^(2^100-1) */
+    Fp51MultiSquare(&a8, &a8, &a9, 49); // (2 * 2) ^ 49
+
+    /* a^(2^250-1) = a^(2^250-2^50) * a^(2^50-1) */
+    Fp51MultiSquare(&a9, &a7, &a10, 24); // (2 * 2) ^ 24
+
+    /* a^(2^5*(2^250-1)) = (a^(2^250-1))^5 */
+    Fp51Square(&temp1, &a10);
+    Fp51Square(&temp2, &temp1);
+    Fp51Square(&temp1, &temp2);
+    Fp51Square(&temp2, &temp1);
+    Fp51Square(&temp1, &temp2);
+
+    /* The output: a^(2^255-21) = a(2^5*(2^250-1)+11) = a^(2^5*(2^250-1)) * a^11 */
+    Fp51Mul(out, &a2, &temp1);
+}
+
+#ifdef HITLS_CRYPTO_X25519
+void ScalarMultiPoint(uint8_t out[32], const uint8_t scalar[32], const uint8_t point[32])
+{
+    uint8_t k[32];
+    const uint8_t *u = point;
+    int32_t t;
+    uint32_t swap;
+    uint32_t kTemp;
+    Fp51 x1, x2, x3;
+    Fp51 z2, z3;
+    Fp51 t1, t2;
+
+    /* Decord the scalar into k */
+    CURVE25519_DECODE_LITTLE_ENDIAN(k, scalar);
+
+    /* Reference RFC 7748 section 5: The constant a24 is (486662 - 2) / 4 = 121665 for curve25519/X25519 */
+    Fp51DataToPoly(&x1, u);
+    CURVE25519_FP51_SET(x2.data, 1);
+    CURVE25519_FP51_SET(z2.data, 0);
+    CURVE25519_FP51_COPY(x3.data, x1.data);
+    CURVE25519_FP51_SET(z3.data, 1);
+    swap = 0;
+
+    /* "bits" parameter set to 255 for x25519  */ /* For t = bits-1(254) down to 0: */
+    for (t = 254; t >= 0; t--) {
+        /* t >> 3: calculation the index of bit; t & 7: Obtains the corresponding bit in the byte */
+        kTemp = (k[(uint32_t)t >> 3] >> ((uint32_t)t & 7)) & 1;           /* kTemp = (k >> t) & 1 */
+        swap ^= kTemp;                                /* swap ^= kTemp */
+        CURVE25519_FP51_CSWAP(swap, x2.data, x3.data);  /* (x_2, x_3) = cswap(swap, x_2, x_3) */
+        CURVE25519_FP51_CSWAP(swap, z2.data, z3.data);  /* (z_2, z_3) = cswap(swap, z_2, z_3) */
+        swap = kTemp;                                 /* swap = kTemp */
+        CURVE25519_FP51_SUB(t1.data, x3.data, z3.data);                /* x3 = D */
+        CURVE25519_FP51_SUB(t2.data, x2.data, z2.data);                /* t2 = B */
+        CURVE25519_FP51_ADD(x2.data, x2.data, z2.data);                /* t1 = A */
+        CURVE25519_FP51_ADD(z2.data, x3.data, z3.data);                /* x2 = C */
+
+        Fp51Mul(&z3, &t1, &x2);
+        Fp51Mul(&z2, &z2, &t2);
+        Fp51Square(&t1, &t2);
+        Fp51Square(&t2, &x2);
+
+        CURVE25519_FP51_ADD(x3.data, z3.data, z2.data);
+        CURVE25519_FP51_SUB(z2.data, z3.data, z2.data);
+        Fp51Mul(&x2, &t2, &t1);
+        CURVE25519_FP51_SUB(t2.data, t2.data, t1.data);
+        Fp51Square(&z2, &z2);
+        Fp51MulScalar(&z3, &t2); // z2 *= 121665 + 1 = 121666
+        Fp51Square(&x3, &x3);
+        CURVE25519_FP51_ADD(t1.data, t1.data, z3.data);
+        Fp51Mul(&z3, &x1, &z2);
+        Fp51Mul(&z2, &t2, &t1);
+    }
+
+    CURVE25519_FP51_CSWAP(swap, x2.data, x3.data);
+    CURVE25519_FP51_CSWAP(swap, z2.data, z3.data);
+    /* Return x2 * (z2 ^ (p - 2)) */
+    Fp51Invert(&t1, &z2);
+    Fp51Mul(&t2, &x2, &t1);
+    Fp51PolyToData(&t2, out);
+    BSL_SAL_CleanseData(k, sizeof(k));
+}
+#endif /* HITLS_CRYPTO_X25519 */
+
+/*
+ * The Edwards group operations below mirror the radix 2^25.5 ones in curve25519_op.c.
+ * CURVE25519_FP51_SUB adds 2p before subtracting, so a subtrahend must be a product, a table element or carried,
+ * the formulas are arranged that way and every multiplier input stays below 2^54.
+ */
+
+/* unified addition in Extended twist Edwards Coordinate, out = out + tableElement */
+static void GeAdd51(GeE51 *out, const GePre51 *tableElement)
+{
+    Fp51 a, b, c, d, e, f, g, h;
+    /* a = (Y1 − X1) * (Y2 − X2), b = (Y1 + X1) * (Y2 + X2)
+     * c = 2 * d * T1 * X2 * Y2, d = 2 * Z1
+     * e = b − a, f = d − c, g = d + c, h = b + a
+     * X3 = e * f, Y3 = g * h, T3 = e * h, Z3 = f * g
+     */
+    CURVE25519_FP51_ADD(e.data, out->y.data, out->x.data);
+    CURVE25519_FP51_SUB(f.data, out->y.data, out->x.data);
+    Fp51Mul(&b, &e, &(tableElement->yplusx));
+    Fp51Mul(&a, &f, &(tableElement->yminusx));
+    Fp51Mul(&c, &(out->t), &(tableElement->xy2d));
+    CURVE25519_FP51_ADD(d.data, out->z.data, out->z.data);
+    CURVE25519_FP51_SUB(e.data, b.data, a.data);
+    CURVE25519_FP51_SUB(f.data, d.data, c.data);
+    CURVE25519_FP51_ADD(g.data, d.data, c.data);
+    CURVE25519_FP51_ADD(h.data, b.data, a.data);
+    Fp51Mul(&(out->x), &e, &f);
+    Fp51Mul(&(out->y), &h, &g);
+    Fp51Mul(&(out->z), &g, &f);
+    Fp51Mul(&(out->t), &e, &h);
+}
+
+/* double in Projective twist Edwards Coordinate */
+static void ProjectiveDouble51(GeC51 *complete, const GeP51 *projective)
+{
+    Fp51 xx, yy, zz2, xPlusY;
+    Fp51Square(&xx, &(projective->x));
+    Fp51Square(&yy, &(projective->y));
+    Fp51Square(&zz2, &(projective->z));
+    CURVE25519_FP51_ADD(zz2.data, zz2.data, zz2.data);
+    CURVE25519_FP51_ADD(xPlusY.data, projective->x.data, projective->y.data);
+    Fp51Square(&xPlusY, &xPlusY);
+    // X = (X1 + Y1) ^ 2 - Y1 ^ 2 - X1 ^ 2, Y = Y1 ^ 2 + X1 ^ 2, Z = Y1 ^ 2 - X1 ^ 2, T = 2 * Z1 ^ 2 - Z
+    CURVE25519_FP51_ADD(complete->y.data, yy.data, xx.data);
+    CURVE25519_FP51_SUB(complete->z.data, yy.data, xx.data);
+    CURVE25519_FP51_SUB(complete->x.data, xPlusY.data, yy.data);
+    CURVE25519_FP51_SUB(complete->x.data, complete->x.data, xx.data);
+    CURVE25519_FP51_SUB(complete->t.data, zz2.data, yy.data);
+    CURVE25519_FP51_ADD(complete->t.data, complete->t.data, xx.data);
+}
+
+/* Convert complete coordinate to projective coordinate */
+static void GeCompleteToProjective51(GeP51 *out, const GeC51 *complete)
+{
+    Fp51Mul(&out->x, &complete->t, &complete->x);
+    Fp51Mul(&out->y, &complete->z, &complete->y);
+    Fp51Mul(&out->z, &complete->t, &complete->z);
+}
+
+/* p1 = 2 ^ n * p1, n > 0 */
+static void P1DoubleN51(GeE51 *p1, int32_t n)
+{
+    GeP51 p;
+    GeC51 c;
+    int32_t i;
+    // From extended coordinate to projective coordinate, just ignore T
+    CURVE25519_FP51_COPY(p.x.data, p1->x.data);
+    CURVE25519_FP51_COPY(p.y.data, p1->y.data);
+    CURVE25519_FP51_COPY(p.z.data, p1->z.data);
+
+    ProjectiveDouble51(&c, &p);
+    for (i = 1; i < n; i++) {
+        GeCompleteToProjective51(&p, &c);
+        ProjectiveDouble51(&c, &p);
+    }
+
+    Fp51Mul(&p1->x, &c.t, &c.x);
+    Fp51Mul(&p1->y, &c.z, &c.y);
+    Fp51Mul(&p1->z, &c.t, &c.z);
+    Fp51Mul(&p1->t, &c.y, &c.x);
+}
+
+static void SetExtendedBasePoint51(GeE51 *out)
+{
+    CURVE25519_FP51_SET(out->x.data, 0);
+    CURVE25519_FP51_SET(out->y.data, 1);
+    CURVE25519_FP51_SET(out->t.data, 0);
+    CURVE25519_FP51_SET(out->z.data, 1);
+}
+
+/* Multiple with Base point, same signed 4 bits comb as ScalarMultiBase */
+static void ScalarMultiBase51(GeE51 *out, const uint8_t in[CRYPT_CURVE25519_KEYLEN])
+{
+    uint8_t carry;
+    // inLen is always 32, buffer needs 32 * 2 = 64
+    uint8_t privateKey[64];
+    int32_t i;
+    GePre51 preCompute;
+
+    // split 32 8bits input into 64 4bits-based number
+    for (i = 0; i < 32; i++) {
+        privateKey[i * 2] = in[i] & 15;            // and 15 to get low 4 bits, stored in 2i
+        privateKey[i * 2 + 1] = (in[i] >> 4) & 15; // shift 4 then and 15 to get upper 4 bits, stored in 2i+1
+    }
+    carry = 0;
+    // change from 0 - 15 to -8 - 7
+    for (i = 0; i < 63; i++) { // 0 to 63
+        privateKey[i] += carry;
+        carry = (privateKey[i] + 8) >> 4; // plus 8 then shit 4 to get carry
+        privateKey[i] -= carry << 4;      // left shift 4
+    }
+    // never overflow since we set first bit to 0 of private key
+    privateKey[63] += carry; // last one is 63
+    SetExtendedBasePoint51(out);
+    for (i = 1; i < 64; i += 2) { // form 1 to 63, process all odd element
+        TableLookup51(&preCompute, i / 2, (int8_t)privateKey[i]); // position goes from 0 to 31, i / 2 = pos
+        GeAdd51(out, &preCompute);
+    }
+    P1DoubleN51(out, 4); // 16 * P1
+    for (i = 0; i < 64; i += 2) { // form 0 to 62, process all even element
+        TableLookup51(&preCompute, i / 2, (int8_t)privateKey[i]); // position goes from 0 to 31, i / 2 = pos
+        GeAdd51(out, &preCompute);
+    }
+    // clean up private key information
+    BSL_SAL_CleanseData(privateKey, sizeof(privateKey));
+    BSL_SAL_CleanseData(&preCompute, sizeof(preCompute));
+}
+
+#ifdef HITLS_CRYPTO_ED25519
+static void PointEncoding51(const GeE51 *point, uint8_t out[CRYPT_CURVE25519_KEYLEN])
+{
+    Fp51 zInvert;
+    Fp51 x;
+    Fp51 y;
+    uint8_t xData[CRYPT_CURVE25519_KEYLEN];
+    /* x = X / Z, y = Y / Z */
+    Fp51Invert(&zInvert, &point->z);
+    Fp51Mul(&x, &point->x, &zInvert);
+    Fp51Mul(&y, &point->y, &zInvert);
+    Fp51PolyToData(&y, out);
+    Fp51PolyToData(&x, xData);
+    out[31] ^= (xData[0] & 0x1) << 7; // last one is out[31], get only last bit then shift 7
+}
+
+void ScalarMultiBaseEncode(uint8_t out[CRYPT_CURVE25519_KEYLEN], const uint8_t in[CRYPT_CURVE25519_KEYLEN])
+{
+    GeE51 point;
+    ScalarMultiBase51(&point, in);
+    PointEncoding51(&point, out);
+}
+
+/* out = in ^ ((q - 5) / 8) */
+static void Fp51Powq58(Fp51 *out, const Fp51 *in)
+{
+    Fp51 a, b, c;
+    int32_t i;
+    Fp51Square(&a, in);
+    Fp51Square(&b, &a);
+    Fp51Square(&b, &b);
+    Fp51Mul(&b, in, &b);
+    Fp51Mul(&a, &a, &b);
+    Fp51Square(&a, &a);
+    Fp51Mul(&a, &b, &a);
+    Fp51Square(&b, &a);
+    // b = a ^ (2^5)
+    for (i = 1; i < 5; i++) {
+        Fp51Square(&b, &b);
+    }
+    Fp51Mul(&a, &b, &a);
+    Fp51Square(&b, &a);
+    // b = a ^ (2^10)
+    for (i = 1; i < 10; i++) {
+        Fp51Square(&b, &b);
+    }
+    Fp51Mul(&b, &b, &a);
+    Fp51Square(&c, &b);
+    // c = b ^ (2^20)
+    for (i = 1; i < 20; i++) {
+        Fp51Square(&c, &c);
+    }
+    Fp51Mul(&b, &c, &b);
+    // b = b ^ (2^10)
+    for (i = 0; i < 10; i++) {
+        Fp51Square(&b, &b);
+    }
+    Fp51Mul(&a, &b, &a);
+    Fp51Square(&b, &a);
+    // b = a ^ (2^50)
+    for (i = 1; i < 50; i++) {
+        Fp51Square(&b, &b);
+    }
+    Fp51Mul(&b, &b, &a);
+    Fp51Square(&c, &b);
+    // c = b ^ (2 ^ 100)
+    for (i = 1; i < 100; i++) {
+        Fp51Square(&c, &c);
+    }
+    Fp51Mul(&b, &c, &b);
+    // b = b ^ (2^50)
+    for (i = 0; i < 50; i++) {
+        Fp51Square(&b, &b);
+    }
+    Fp51Mul(&a, &b, &a);
+    Fp51Square(&a, &a);
+    Fp51Square(&a, &a);
+    Fp51Mul(out, &a, in);
+}
+
+/* out = in with every limb carried back to about 51 bits, so that it can be a subtrahend again */
+static void Fp51Carry(Fp51 *out, const Fp51 *in)
+{
+    uint64_t h[5];
+    h[0] = in->data[0];
+    h[1] = in->data[1];
+    h[2] = in->data[2];
+    h[3] = in->data[3];
+    h[4] = in->data[4];
+
+    h[1] += h[0] >> CURVE25519_51BITS;
+    h[0] &= CURVE25519_51BITS_MASK;
+    h[2] += h[1] >> CURVE25519_51BITS;
+    h[1] &= CURVE25519_51BITS_MASK;
+    h[3] += h[2] >> CURVE25519_51BITS;
+    h[2] &= CURVE25519_51BITS_MASK;
+    h[4] += h[3] >> CURVE25519_51BITS;
+    h[3] &= CURVE25519_51BITS_MASK;
+    h[0] += (h[4] >> CURVE25519_51BITS) * 19; // 2^255 = 19 mod p
+    h[4] &= CURVE25519_51BITS_MASK;
+
+    out->data[0] = h[0];
+    out->data[1] = h[1];
+    out->data[2] = h[2];
+    out->data[3] = h[3];
+    out->data[4] = h[4];
+}
+
+static bool CheckZero51(const Fp51 *x)
+{
+    uint8_t tmp[32];
+    const uint8_t zero[32] = {0};
+    Fp51 carried;
+    Fp51Carry(&carried, x);
+    Fp51PolyToData(&carried, tmp);
+    return memcmp(tmp, zero, sizeof(zero)) == 0;
+}
+
+static const Fp51 SQRTM1_51 = {{0x61b274a0ea0b0, 0x0d5a5fc8f189d, 0x7ef5e9cbd0c60, 0x78595a6804c9e, 0x2b8324804fc1d}};
+static const Fp51 D_51 = {{0x34dca135978a3, 0x1a8283b156ebd, 0x5e7a26001c029, 0x739c663a03cbb, 0x52036cee2b6ff}};
+static const Fp51 D2_51 = {{0x69b9426b2f159, 0x35050762add7a, 0x3cf44c0038052, 0x6738cc7407977, 0x2406d9dc56dff}};
+
+static int32_t PointDecoding51(GeE51 *point, const uint8_t in[CRYPT_CURVE25519_KEYLEN])
+{
+    Fp51 u, v, v3, x2, result;
+    const Fp51 zero = {{0}};
+    uint8_t xData[CRYPT_CURVE25519_KEYLEN];
+    // get the last block (31), shift 7 for first bit
+    uint8_t x0 = in[31] >> 7;
+    Fp51DataToPoly(&(point->y), in);
+
+    CURVE25519_FP51_SET(point->z.data, 1);
+    Fp51Square(&u, &(point->y));
+    Fp51Mul(&v, &u, &D_51);
+    CURVE25519_FP51_SUB(u.data, u.data, point->z.data);
+    CURVE25519_FP51_ADD(v.data, v.data, point->z.data);
+    Fp51Carry(&u, &u);
+
+    Fp51Square(&v3, &v);
+    Fp51Mul(&v3, &v3, &v);
+    Fp51Square(&(point->x), &v3);
+    Fp51Mul(&(point->x), &(point->x), &v);
+    Fp51Mul(&(point->x), &(point->x), &u);
+
+    /* x = x ^ ((q - 5) / 8) */
+    Fp51Powq58(&(point->x), &(point->x));
+
+    Fp51Mul(&(point->x), &(point->x), &v3);
+    Fp51Mul(&(point->x), &(point->x), &u);
+    Fp51Square(&x2, &(point->x));
+    Fp51Mul(&x2, &x2, &v);
+    CURVE25519_FP51_SUB(result.data, x2.data, u.data);
+
+    if (CheckZero51(&result) == false) {
+        CURVE25519_FP51_ADD(result.data, x2.data, u.data);
+        if (CheckZero51(&result) == false) {
+            return 1;
+        }
+        Fp51Mul(&(point->x), &(point->x), &SQRTM1_51);
+    }
+    Fp51PolyToData(&(point->x), xData);
+    if ((xData[0] & 0x1) != x0) {
+        CURVE25519_FP51_SUB(point->x.data, zero.data, point->x.data);
+        Fp51Carry(&(point->x), &(point->x));
+    }
+    Fp51Mul(&(point->t), &(point->x), &(point->y));
+
+    return 0;
+}
+
+/* out = out - tableElement */
+static void GeSub51(GeE51 *out, const GePre51 *tableElement)
+{
+    Fp51 a, b, c, d, e, f, g, h;
+
+    CURVE25519_FP51_ADD(e.data, out->y.data, out->x.data);
+    CURVE25519_FP51_SUB(f.data, out->y.data, out->x.data);
+    Fp51Mul(&b, &e, &(tableElement->yminusx));
+    Fp51Mul(&a, &f, &(tableElement->yplusx));
+    Fp51Mul(&c, &(out->t), &(tableElement->xy2d));
+    CURVE25519_FP51_ADD(d.data, out->z.data, out->z.data);
+    CURVE25519_FP51_SUB(e.data, b.data, a.data);
+    CURVE25519_FP51_ADD(f.data, d.data, c.data);
+    CURVE25519_FP51_SUB(g.data, d.data, c.data);
+    CURVE25519_FP51_ADD(h.data, b.data, a.data);
+    Fp51Mul(&(out->x), &e, &f);
+    Fp51Mul(&(out->y), &h, &g);
+    Fp51Mul(&(out->z), &g, &f);
+    Fp51Mul(&(out->t), &e, &h);
+}
+
+/* RFC8032, out = a + b */
+static void PointAdd51(GeE51 *out, const GeE51 *greA, const GeE51 *greB)
+{
+    Fp51 a, b, c, d, e, f, g, h;
+    CURVE25519_FP51_SUB(e.data, greA->y.data, greA->x.data);
+    CURVE25519_FP51_SUB(f.data, greB->y.data, greB->x.data);
+    CURVE25519_FP51_ADD(g.data, greA->y.data, greA->x.data);
+    CURVE25519_FP51_ADD(h.data, greB->y.data, greB->x.data);
+    Fp51Mul(&a, &e, &f);
+    Fp51Mul(&b, &g, &h);
+    Fp51Mul(&c, &(greA->t), &(greB->t));
+    Fp51Mul(&c, &c, &D2_51);
+    Fp51Mul(&d, &(greA->z), &(greB->z));
+    CURVE25519_FP51_ADD(d.data, d.data, d.data);
+    CURVE25519_FP51_SUB(e.data, b.data, a.data);
+    CURVE25519_FP51_SUB(f.data, d.data, c.data);
+    CURVE25519_FP51_ADD(g.data, d.data, c.data);
+    CURVE25519_FP51_ADD(h.data, b.data, a.data);
+    Fp51Mul(&(out->x), &e, &f);
+    Fp51Mul(&(out->y), &g, &h);
+    Fp51Mul(&(out->z), &f, &g);
+    Fp51Mul(&(out->t), &e, &h);
+}
+
+static void PointAddPrecompute51(GeE51 *out, const GeE51 *greA, const GeEPre51 *greB)
+{
+    Fp51 a, b, c, d, e, f, g, h;
+    CURVE25519_FP51_SUB(e.data, greA->y.data, greA->x.data);
+    CURVE25519_FP51_ADD(g.data, greA->y.data, greA->x.data);
+    Fp51Mul(&a, &e, &(greB->yminusx));
+    Fp51Mul(&b, &g, &(greB->yplusx));
+    Fp51Mul(&c, &(greA->t), &(greB->t2z));
+    Fp51Mul(&d, &(greA->z), &(greB->z));
+    CURVE25519_FP51_ADD(d.data, d.data, d.data);
+    CURVE25519_FP51_SUB(e.data, b.data, a.data);
+    CURVE25519_FP51_SUB(f.data, d.data, c.data);
+    CURVE25519_FP51_ADD(g.data, d.data, c.data);
+    CURVE25519_FP51_ADD(h.data, b.data, a.data);
+    Fp51Mul(&(out->x), &e, &f);
+    Fp51Mul(&(out->y), &g, &h);
+    Fp51Mul(&(out->z), &f, &g);
+    Fp51Mul(&(out->t), &e, &h);
+}
+
+static void PointSubPrecompute51(GeE51 *out, const GeE51 *greA, const GeEPre51 *greB)
+{
+    Fp51 a, b, c, d, e, f, g, h;
+    CURVE25519_FP51_SUB(e.data, greA->y.data, greA->x.data);
+    CURVE25519_FP51_ADD(g.data, greA->y.data, greA->x.data);
+    Fp51Mul(&a, &e, &(greB->yplusx));
+    Fp51Mul(&b, &g, &(greB->yminusx));
+    Fp51Mul(&c, &(greA->t), &(greB->t2z));
+    Fp51Mul(&d, &(greA->z), &(greB->z));
+    CURVE25519_FP51_ADD(d.data, d.data, d.data);
+    CURVE25519_FP51_SUB(e.data, b.data, a.data);
+    CURVE25519_FP51_ADD(f.data, d.data, c.data);
+    CURVE25519_FP51_SUB(g.data, d.data, c.data);
+    CURVE25519_FP51_ADD(h.data, b.data, a.data);
+    Fp51Mul(&(out->x), &e, &f);
+    Fp51Mul(&(out->y), &g, &h);
+    Fp51Mul(&(out->z), &f, &g);
+    Fp51Mul(&(out->t), &e, &h);
+}
+
+static void PointToPrecompute51(GeEPre51 *out, const GeE51 *in)
+{
+    CURVE25519_FP51_ADD(out->yplusx.data, in->y.data, in->x.data);
+    CURVE25519_FP51_SUB(out->yminusx.data, in->y.data, in->x.data);
+    CURVE25519_FP51_COPY(out->z.data, in->z.data);
+    Fp51Mul(&(out->t2z), &(in->t), &D2_51);
+}
+
+// stores B, 3B, 5B, 7B, 9B, 11B, 13B, 15B, with B as ed25519 base point
+static const GePre51 g_precomputedB[8] = {
+    {
+        {{0x493c6f58c3b85, 0x0df7181c325f7, 0x0f50b0b3e4cb7, 0x5329385a44c32, 0x07cf9d3a33d4b}},
+        {{0x03905d740913e, 0x0ba2817d673a2, 0x23e2827f4e67c, 0x133d2e0c21a34, 0x44fd2f9298f81}},
+        {{0x11205877aaa68, 0x479955893d579, 0x50d66309b67a0, 0x2d42d0dbee5ee, 0x6f117b689f0c6}},
+    },
+    {
+        {{0x5b0a84cee9730, 0x61d10c97155e4, 0x4059cc8096a10, 0x47a608da8014f, 0x7a164e1b9a80f}},
+        {{0x11fe8a4fcd265, 0x7bcb8374faacc, 0x52f5af4ef4d4f, 0x5314098f98d10, 0x2ab91587555bd}},
+        {{0x6933f0dd0d889, 0x44386bb4c4295, 0x3cb6d3162508c, 0x26368b872a2c6, 0x5a2826af12b9b}},
+    },
+    {
+        {{0x2bc4408a5bb33, 0x078ebdda05442, 0x2ffb112354123, 0x375ee8df5862d, 0x2945ccf146e20}},
+        {{0x182c3a447d6ba, 0x22964e536eff2, 0x192821f540053, 0x2f9f19e788e5c, 0x154a7e73eb1b5}},
+        {{0x3dbf1812a8285, 0x0fa17ba3f9797, 0x6f69cb49c3820, 0x34d5a0db3858d, 0x43aabe696b3bb}},
+    },
+    {
+        {{0x25cd0944ea3bf, 0x75673b81a4d63, 0x150b925d1c0d4, 0x13f38d9294114, 0x461bea69283c9}},
+        {{0x72c9aaa3221b1, 0x267774474f74d, 0x064b0e9b28085, 0x3f04ef53b27c9, 0x1d6edd5d2e531}},
+        {{0x36dc801b8b3a2, 0x0e0a7d4935e30, 0x1deb7cecc0d7d, 0x053a94e20dd2c, 0x7a9fbb1c6a0f9}},
+    },
+    {
+        {{0x6678aa6a8632f, 0x5ea3788d8b365, 0x21bd6d6994279, 0x7ace75919e4e3, 0x34b9ed338add7}},
+        {{0x6217e039d8064, 0x6dea408337e6d, 0x57ac112628206, 0x647cb65e30473, 0x49c05a51fadc9}},
+        {{0x4e8bf9045af1b, 0x514e33a45e0d6, 0x7533c5b8bfe0f, 0x583557b7e14c9, 0x73c172021b008}},
+    },
+    {
+        {{0x700848a802ade, 0x1e04605c4e5f7, 0x5c0d01b9767fb, 0x7d7889f42388b, 0x4275aae2546d8}},
+        {{0x75b0249864348, 0x52ee11070262b, 0x237ae54fb5acd, 0x3bfd1d03aaab5, 0x18ab598029d5c}},
+        {{0x32cc5fd6089e9, 0x426505c949b05, 0x46a18880c7ad2, 0x4a4221888ccda, 0x3dc65522b53df}},
+    },
+    {
+        {{0x0c222a2007f6d, 0x356b79bdb77ee, 0x41ee81efe12ce, 0x120a9bd07097d, 0x234fd7eec346f}},
+        {{0x7013b327fbf93, 0x1336eeded6a0d, 0x2b565a2bbf3af, 0x253ce89591955, 0x0267882d17602}},
+        {{0x0a119732ea378, 0x63bf1ba8e2a6c, 0x69f94cc90df9a, 0x431d1779bfc48, 0x497ba6fdaa097}},
+    },
+    {
+        {{0x6cc0313cfeaa0, 0x1a313848da499, 0x7cb534219230a, 0x39596dedefd60, 0x61e22917f12de}},
+        {{0x3cd86468ccf0b, 0x48553221ac081, 0x6c9464b4e0a6e, 0x75fba84180403, 0x43b5cd4218d05}},
+        {{0x2762f9bd0b516, 0x1c6e7fbddcbb3, 0x75909c3ace2bd, 0x42101972d3ec9, 0x511d61210ae4d}},
+    },
+};
+
+/* preComputedP stores p, 3p, 5p, 7p, 9p, 11p, 13p, 15p */
+static void PointOddMultiples51(GeEPre51 preComputedP[8], const GeE51 *p)
+{
+    GeE51 tmpP; // p, 3p, ....., 13p, 15p in turn
+    GeE51 doubleP;
+    int32_t i;
+
+    tmpP = *p;
+    doubleP = *p;
+    PointToPrecompute51(&preComputedP[0], &tmpP);
+    P1DoubleN51(&doubleP, 1);
+    for (i = 1; i < 8; i++) { // p, 3p, ....., 13p, 15p, total 8
+        PointAdd51(&tmpP, &tmpP, &doubleP);
+        PointToPrecompute51(&preComputedP[i], &tmpP);
+    }
+}
+
+/* out = hash * p + s * B */
+static void KAMulPlusMulBase51(GeE51 *out, const uint8_t hash[CRYPT_CURVE25519_KEYLEN],
+    const GeE51 *p, const uint8_t s[CRYPT_CURVE25519_KEYLEN])
+{
+    GeEPre51 preComputedP[8]; // stores p, 3p, 5p, 7p, 9p, 11p, 13p, 15p
+    int8_t slideP[256];
+    int8_t slideS[256];
+    int32_t i;
+
+    SetExtendedBasePoint51(out);
+    SlideReduce(slideP, 256, hash, CRYPT_CURVE25519_KEYLEN);
+    SlideReduce(slideS, 256, s, CRYPT_CURVE25519_KEYLEN);
+    PointOddMultiples51(preComputedP, p);
+
+    int32_t zeroCount = 0;
+    i = 255; // 255 to 0
+    while (i >= 0 && slideP[i] == 0 && slideS[i] == 0) {
+        i--;
+    }
+    for (; i >= 0; i--) {
+        while (i >= 0 && slideP[i] == 0 && slideS[i] == 0) {
+            zeroCount++;
+            i--;
+        }
+        if (i < 0) {
+            P1DoubleN51(out, zeroCount);
+            break;
+        }
+        P1DoubleN51(out, zeroCount + 1);
+        zeroCount = 0;
+        if (slideP[i] > 0) {
+            PointAddPrecompute51(out, out, &preComputedP[slideP[i] / 2]); // preComputedP[i] = (i * 2 + 1)P
+        } else if (slideP[i] < 0) {
+            PointSubPrecompute51(out, out, &preComputedP[(-slideP[i]) / 2]);
+        }
+        if (slideS[i] > 0) {
+            GeAdd51(out, &g_precomputedB[slideS[i] / 2]); // g_precomputedB[i] = (i * 2 + 1)B
+        } else if (slideS[i] < 0) {
+            GeSub51(out, &g_precomputedB[(-slideS[i]) / 2]);
+        }
+    }
+}
+
+int32_t KAMulPlusMulBaseEncode(uint8_t out[CRYPT_CURVE25519_KEYLEN], const uint8_t hash[CRYPT_CURVE25519_KEYLEN],
+    const uint8_t p[CRYPT_CURVE25519_KEYLEN], const uint8_t s[CRYPT_CURVE25519_KEYLEN])
+{
+    GeE51 geP, res;
+    const Fp51 zero = {{0}};
+    if (PointDecoding51(&geP, p) != 0) {
+        return 1;
+    }
+    CURVE25519_FP51_SUB(geP.x.data, zero.data, geP.x.data);
+    CURVE25519_FP51_SUB(geP.t.data, zero.data, geP.t.data);
+    Fp51Carry(&geP.x, &geP.x);
+    Fp51Carry(&geP.t, &geP.t);
+    KAMulPlusMulBase51(&res, hash, &geP, s);
+    PointEncoding51(&res, out);
+    return 0;
+}
+
+/*
+ * R is compared byte by byte in the single verification, so the batch only takes its canonical encodings:
+ * y < p, and the sign bit is clear when x = 0.
+ */
+static int32_t BatchRDecoding51(GeE51 *point, const uint8_t r[CRYPT_CURVE25519_KEYLEN])
+{
+    int32_t i;
+    // y >= p only if bytes 1 to 30 are all 0xff, the top 7 bits are all 1 and the lowest byte is at least 0xed
+    if ((r[31] & 0x7f) == 0x7f && r[0] >= 0xed) { // 31 is the last byte, 0xed is the lowest byte of p
+        i = 1;
+        while (i < 31 && r[i] == 0xff) { // bytes 1 to 30
+            i++;
+        }
+        if (i == 31) {
+            return 1;
+        }
+    }
+    if (PointDecoding51(point, r) != 0) {
+        return 1;
+    }
+    if ((r[31] >> 7) != 0 && CheckZero51(&point->x)) { // the sign bit of x is the 7th bit of byte 31
+        return 1;
+    }
+    return 0;
+}
+
+static void BatchAddDigit51(GeE51 *out, const GeEPre51 *preComputed, int8_t digit)
+{
+    if (digit > 0) {
+        PointAddPrecompute51(out, out, &preComputed[digit / 2]); // preComputed[i] = (i * 2 + 1)P
+    } else if (digit < 0) {
+        PointSubPrecompute51(out, out, &preComputed[(-digit) / 2]);
+    }
+}
+
+/*
+ * Interleaved sliding window multiplication over all 2 * num + 1 points, so the 256 doublings are shared by the
+ * whole batch and every signature only pays for its additions and the two point decodings.
+ */
+int32_t BatchMulPlusMulBaseCheck(const Curve25519BatchTerm *terms, uint32_t num,
+    const uint8_t zs[CRYPT_CURVE25519_KEYLEN])
+{
+    uint32_t pointNum = num * 2; // R and A of every signature
+    uint32_t tableSize = pointNum * 8 * (uint32_t)sizeof(GeEPre51); // 8 odd multiples of each point
+    uint8_t *buf = BSL_SAL_Malloc(tableSize + (pointNum + 1) * 256); // 256 digits of each scalar and of zs
+    if (buf == NULL) {
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    GeEPre51 *preComputed = (GeEPre51 *)buf;
+    int8_t *slides = (int8_t *)(buf + tableSize);
+    int8_t *slideB = slides + pointNum * 256;
+    int32_t ret = CRYPT_CURVE25519_VERIFY_FAIL;
+    GeE51 point, res;
+    Fp51 yMinusZ;
+    uint32_t j;
+    int32_t i;
+
+    for (j = 0; j < num; j++) {
+        if (BatchRDecoding51(&point, terms[j].r) != 0) {
+            goto END;
+        }
+        PointOddMultiples51(&preComputed[j * 2 * 8], &point);
+        SlideReduce(&slides[j * 2 * 256], 256, terms[j].z, CRYPT_CURVE25519_KEYLEN);
+        if (PointDecoding51(&point, terms[j].pubKey) != 0) {
+            goto END;
+        }
+        PointOddMultiples51(&preComputed[(j * 2 + 1) * 8], &point);
+        SlideReduce(&slides[(j * 2 + 1) * 256], 256, terms[j].zk, CRYPT_CURVE25519_KEYLEN);
+    }
+    SlideReduce(slideB, 256, zs, CRYPT_CURVE25519_KEYLEN);
+
+    SetExtendedBasePoint51(&res);
+    for (i = 255; i >= 0; i--) { // 255 to 0
+        P1DoubleN51(&res, 1);
+        for (j = 0; j < pointNum; j++) {
+            BatchAddDigit51(&res, &preComputed[j * 8], slides[j * 256 + i]);
+        }
+        // subtract zs * B
+        if (slideB[i] > 0) {
+            GeSub51(&res, &g_precomputedB[slideB[i] / 2]); // g_precomputedB[i] = (i * 2 + 1)B
+        } else if (slideB[i] < 0) {
+            GeAdd51(&res, &g_precomputedB[(-slideB[i]) / 2]);
+        }
+    }
+    // clear the small order component, the neutral element has X = 0 and Y = Z
+    P1DoubleN51(&res, 3);
+    CURVE25519_FP51_SUB(yMinusZ.data, res.y.data, res.z.data);
+    if (CheckZero51(&res.x) && CheckZero51(&yMinusZ)) {
+        ret = CRYPT_SUCCESS;
+    }
+END:
+    BSL_SAL_Free(buf);
+    return ret;
+}
+#endif /* HITLS_CRYPTO_ED25519 */
+
+#ifdef HITLS_CRYPTO_X25519
+void X25519ScalarMultiBase(uint8_t out[CRYPT_CURVE25519_KEYLEN], const uint8_t in[CRYPT_CURVE25519_KEYLEN])
+{
+    GeE51 point;
+    Fp51 zPlusY, zMinusY, zMinusYInvert;
+
+    ScalarMultiBase51(&point, in);
+    /* u = (1 + y) / (1 - y) = (Z + Y) / (Z - Y) */
+    CURVE25519_FP51_ADD(zPlusY.data, point.z.data, point.y.data);
+    CURVE25519_FP51_SUB(zMinusY.data, point.z.data, point.y.data);
+    Fp51Invert(&zMinusYInvert, &zMinusY);
+    Fp51Mul(&zPlusY, &zPlusY, &zMinusYInvert);
+    Fp51PolyToData(&zPlusY, out);
+}
+#endif /* HITLS_CRYPTO_X25519 */
+
+#endif /* CURVE25519_FP51 */
+#endif /* HITLS_CRYPTO_CURVE25519 */
@@ -33,6 +33,13 @@ extern "C" {
 #define UINT8_32_21BITS_BLOCKNUM 12
 #define UINT8_64_21BITS_BLOCKNUM 24
 
+/* The radix 2^51 field needs 64 x 64 -> 128 bits products, either from the x86_64 assembly or from int128 */
+#if defined(HITLS_CRYPTO_CURVE25519_X8664) || (defined(__SIZEOF_INT128__) && (__SIZEOF_INT128__ == 16))
+#define CURVE25519_FP51
+#define CURVE25519_51BITS_MASK 0x7ffffffffffff
+#define CURVE25519_51BITS 51
+#endif
+
 struct CryptCurve25519Ctx {
     uint8_t keyType; /* specify the key type */
     const EAL_MdMethod *hashMethod;
@@ -89,6 +96,42 @@ typedef struct GeEPre {
     Fp25 z;
 } GeEPre;
 
+#ifdef CURVE25519_FP51
+// The same group elements with radix 2^51 coordinates
+typedef struct GeP51 {
+    Fp51 x;
+    Fp51 y;
+    Fp51 z;
+} GeP51;
+
+typedef struct GeE51 {
+    Fp51 x;
+    Fp51 y;
+    Fp51 t;
+    Fp51 z;
+} GeE51;
+
+typedef struct GeC51 {
+    Fp51 x;
+    Fp51 y;
+    Fp51 t;
+    Fp51 z;
+} GeC51;
+
+typedef struct GePre51 {
+    Fp51 yplusx;
+    Fp51 yminusx;
+    Fp51 xy2d;
+} GePre51;
+
+typedef struct GeEPre51 {
+    Fp51 yplusx;
+    Fp51 yminusx;
+    Fp51 t2z;
+    Fp51 z;
+} GeEPre51;
+#endif
+
 /* Get High x bits for 64bits block */
 #define MASK_HIGH64(x) (0xFFFFFFFFFFFFFFFFLL << (64 - (x)))
 /* Get low x bits for 32bits block */
@@ -393,7 +436,28 @@ typedef struct GeEPre {
             }                                                           \
     } while (0)
 
+#ifdef CURVE25519_FP51
+/**
+ * The radix 2^51 field kernels, implemented in asm/x25519_x86_64.S or noasm_curve25519_fp51_ops.c.
+ * Input limbs must not exceed 2^54, output limbs are carried to about 51 bits.
+ */
+void Fp51Mul(Fp51 *out, const Fp51 *f, const Fp51 *g);
+
+void Fp51Square(Fp51 *out, const Fp51 *in);
+
+/* out = in * 121666, a24 + 1 of the montgomery ladder */
+void Fp51MulScalar(Fp51 *out, const Fp51 *in);
+
+void Fp51DataToPoly(Fp51 *out, const uint8_t in[32]);
+
+void Fp51PolyToData(const Fp51 *in, uint8_t out[32]);
+
+void Fp51Invert(Fp51 *out, const Fp51 *a);
+
+void TableLookup51(GePre51 *preCompute, int32_t pos, int8_t e);
+#else
 void TableLookup(GePre *preCompute, int32_t pos, int8_t e);
+#endif
 
 void ConditionalMove(GePre *preCompute, const GePre *tableElement, uint32_t indicator);
 
@@ -409,11 +473,44 @@ void ScalarMulAdd(uint8_t s[CRYPT_CURVE25519_KEYLEN], const uint8_t a[CRYPT_CURV
 
 void ModuloL(uint8_t s[CRYPT_CURVE25519_SIGNLEN]);
 
+/* recode the scalar into sliding window digits, each one is 0 or an odd number in [-15, 15] */
+void SlideReduce(int8_t *out, uint32_t outLen, const uint8_t *in, uint32_t inLen);
+
 void KAMulPlusMulBase(GeE *out, const uint8_t hash[CRYPT_CURVE25519_KEYLEN],
     const GeE *p, const uint8_t s[CRYPT_CURVE25519_KEYLEN]);
+
+/* out = encode(in * B), B is the ed25519 base point */
+void ScalarMultiBaseEncode(uint8_t out[CRYPT_CURVE25519_KEYLEN], const uint8_t in[CRYPT_CURVE25519_KEYLEN]);
+
+/* out = encode(s * B - hash * A), A = decode(p), returns 1 if p is not a valid point encoding */
+int32_t KAMulPlusMulBaseEncode(uint8_t out[CRYPT_CURVE25519_KEYLEN], const uint8_t hash[CRYPT_CURVE25519_KEYLEN],
+    const uint8_t p[CRYPT_CURVE25519_KEYLEN], const uint8_t s[CRYPT_CURVE25519_KEYLEN]);
+
+#ifdef CURVE25519_FP51
+/* signatures checked by one multi-scalar multiplication */
+#define CURVE25519_BATCH_MAX 64
+
+/* one signature of a batch, weighted by the random z */
+typedef struct {
+    const uint8_t *r;                          /* R, first half of the signature */
+    const uint8_t *pubKey;                     /* A */
+    uint8_t z[CRYPT_CURVE25519_KEYLEN];        /* random 128 bits weight */
+    uint8_t zk[CRYPT_CURVE25519_KEYLEN];       /* z * k mod l, k = H(R || A || M) */
+} Curve25519BatchTerm;
+
+/**
+ * Check [8](sum(z * R) + sum(zk * A) - zs * B) == 0 for num <= CURVE25519_BATCH_MAX terms, zs = sum(z * s) mod l.
+ * Returns CRYPT_SUCCESS if it holds, or an error code if it does not, a point does not decode or R is not canonical.
+ */
+int32_t BatchMulPlusMulBaseCheck(const Curve25519BatchTerm *terms, uint32_t num,
+    const uint8_t zs[CRYPT_CURVE25519_KEYLEN]);
+#endif
 #endif
 
 #ifdef HITLS_CRYPTO_X25519
+/* out = u coordinate of in * B on the birationally equivalent montgomery curve, in is a decoded scalar */
+void X25519ScalarMultiBase(uint8_t out[CRYPT_CURVE25519_KEYLEN], const uint8_t in[CRYPT_CURVE25519_KEYLEN]);
+
 void ScalarMultiPoint(uint8_t out[32], const uint8_t scalar[32], const uint8_t point[32]);
 #endif
 
@@ -24,6 +24,8 @@
 
 #define CRYPT_CURVE25519_OPTLEN 32
 
+// The radix 2^25.5 field and group operations, curve25519_fp51.c takes over when CURVE25519_FP51 is defined
+#ifndef CURVE25519_FP51
 #define CONDITION_COPY(dst, src, indicate)     \
     (int32_t)((uint32_t)(dst) ^ (((uint32_t)(dst) ^ (uint32_t)(src)) & (indicate)))
 
@@ -777,6 +779,29 @@ void PointEncoding(const GeE *point, uint8_t *output, uint32_t outputLen)
     // PointEcoding writes only 32 bytes data, therefore output[31] is the last one
     output[31] ^= (xData[0] & 0x1) << 7; // last one is output[31], get only last bit then shift 7
 }
+
+void ScalarMultiBaseEncode(uint8_t out[CRYPT_CURVE25519_KEYLEN], const uint8_t in[CRYPT_CURVE25519_KEYLEN])
+{
+    GeE point;
+    ScalarMultiBase(&point, in);
+    PointEncoding(&point, out, CRYPT_CURVE25519_KEYLEN);
+}
+#endif
+
+#ifdef HITLS_CRYPTO_X25519
+void X25519ScalarMultiBase(uint8_t out[CRYPT_CURVE25519_KEYLEN], const uint8_t in[CRYPT_CURVE25519_KEYLEN])
+{
+    GeE point;
+    Fp25 zPlusY, zMinusY, zMinusYInvert;
+
+    ScalarMultiBase(&point, in);
+    /* u = (1 + y) / (1 - y) = (Z + Y) / (Z - Y) */
+    CURVE25519_FP_ADD(zPlusY.data, point.z.data, point.y.data);
+    CURVE25519_FP_SUB(zMinusY.data, point.z.data, point.y.data);
+    FpInvert(&zMinusYInvert, &zMinusY);
+    FpMul(&zPlusY, &zPlusY, &zMinusYInvert);
+    PolynomialToData(out, &zPlusY);
+}
 #endif
 
 static void FeCmove(Fp25 *dst, const Fp25 *src, const uint32_t indicator)
@@ -936,7 +961,10 @@ int32_t PointDecoding(GeE *point, const uint8_t in[CRYPT_CURVE25519_KEYLEN])
 
     return 0;
 }
+#endif /* HITLS_CRYPTO_ED25519 */
+#endif /* CURVE25519_FP51 */
 
+#ifdef HITLS_CRYPTO_ED25519
 static void ScalarMulAddPreLoad(const uint8_t in[CRYPT_CURVE25519_KEYLEN],
     uint64_t out[UINT8_32_21BITS_BLOCKNUM])
 {
@@ -1368,6 +1396,7 @@ void ScalarMulAdd(uint8_t s[CRYPT_CURVE25519_KEYLEN], const uint8_t a[CRYPT_CURV
     UnloadTo8Bits(s, s21Bits);
 }
 
+#ifndef CURVE25519_FP51
 /* RFC8032, out = a + b */
 static void PointAdd(GeE *out, GeE *greA, GeE *greB)
 {
@@ -1466,6 +1495,7 @@ static void PointToPrecompute(GeEPre *out, GeE *in)
     CURVE25519_FP_COPY(out->z.data, in->z.data);
     FpMul(&(out->t2z), &(in->t), &d2);
 }
+#endif /* CURVE25519_FP51 */
 
 static void FlipK(int8_t slide[256], uint32_t start)
 {
@@ -1480,7 +1510,7 @@ static void FlipK(int8_t slide[256], uint32_t start)
     }
 }
 
-static void SlideReduce(int8_t *out, uint32_t outLen, const uint8_t *in, uint32_t inLen)
+void SlideReduce(int8_t *out, uint32_t outLen, const uint8_t *in, uint32_t inLen)
 {
     uint32_t i, j;
     int8_t tmp;
@@ -1515,6 +1545,7 @@ static void SlideReduce(int8_t *out, uint32_t outLen, const uint8_t *in, uint32_
     }
 }
 
+#ifndef CURVE25519_FP51
 // Base on article "High-speed high-security signatures"
 // stores B, 3B, 5B, 7B, 9B, 11B, 13B, 15B, with B as ed25519 base point
 static const GePre g_precomputedB[8] = {
@@ -1639,6 +1670,21 @@ void KAMulPlusMulBase(GeE *out, const uint8_t hash[CRYPT_CURVE25519_KEYLEN],
         }
     }
 }
+
+int32_t KAMulPlusMulBaseEncode(uint8_t out[CRYPT_CURVE25519_KEYLEN], const uint8_t hash[CRYPT_CURVE25519_KEYLEN],
+    const uint8_t p[CRYPT_CURVE25519_KEYLEN], const uint8_t s[CRYPT_CURVE25519_KEYLEN])
+{
+    GeE geP, res;
+    if (PointDecoding(&geP, p) != 0) {
+        return 1;
+    }
+    CURVE25519_FP_NEGATE(geP.x.data, geP.x.data);
+    CURVE25519_FP_NEGATE(geP.t.data, geP.t.data);
+    KAMulPlusMulBase(&res, hash, &geP, s);
+    PointEncoding(&res, out, CRYPT_CURVE25519_KEYLEN);
+    return 0;
+}
+#endif /* CURVE25519_FP51 */
 #endif /* HITLS_CRYPTO_ED25519 */
 
 #endif /* HITLS_CRYPTO_CURVE25519 */
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#if defined(HITLS_CRYPTO_X25519) && defined(HITLS_CRYPTO_CURVE25519_X8664)
+
+#include "securec.h"
+#include "bsl_sal.h"
+#include "crypt_utils.h"
+#include "curve25519_local.h"
+#include "x25519_asm.h"
+
+bool X25519UseIfma(void)
+{
+    // The cpuid state is filled in by CRYPT_EAL_Init, before that the one lane code is used.
+    return IsSupportAVX512IFMA() && IsSupportAVX512F() && IsOSSupportAVX512();
+}
+
+/* out = a ^ (p - 2) = a ^ -1 in every lane, the same addition chain as Fp51Invert */
+static void Fp51x8Invert(Fp51x8 *out, const Fp51x8 *a)
+{
+    Fp51x8 a2, a11, a5, a10, a50, a100, t1, t2;
+
+    Fp51x8Square(&a2, a, 1);            /* a^2 */
+    Fp51x8Square(&t1, &a2, 2);          /* a^8 */
+    Fp51x8Mul(&t1, &t1, a);             /* a^9 */
+    Fp51x8Mul(&a11, &t1, &a2);          /* a^11 */
+    Fp51x8Square(&t2, &a11, 1);         /* a^22 */
+    Fp51x8Mul(&a5, &t1, &t2);           /* a^(2^5-1) */
+    Fp51x8Square(&t1, &a5, 5);
+    Fp51x8Mul(&a10, &t1, &a5);          /* a^(2^10-1) */
+    Fp51x8Square(&t1, &a10, 10);
+    Fp51x8Mul(&t2, &t1, &a10);          /* a^(2^20-1) */
+    Fp51x8Square(&t1, &t2, 20);
+    Fp51x8Mul(&t2, &t1, &t2);           /* a^(2^40-1) */
+    Fp51x8Square(&t1, &t2, 10);
+    Fp51x8Mul(&a50, &t1, &a10);         /* a^(2^50-1) */
+    Fp51x8Square(&t1, &a50, 50);
+    Fp51x8Mul(&a100, &t1, &a50);        /* a^(2^100-1) */
+    Fp51x8Square(&t1, &a100, 100);
+    Fp51x8Mul(&t2, &t1, &a100);         /* a^(2^200-1) */
+    Fp51x8Square(&t1, &t2, 50);
+    Fp51x8Mul(&t2, &t1, &a50);          /* a^(2^250-1) */
+    Fp51x8Square(&t1, &t2, 5);
+    Fp51x8Mul(out, &t1, &a11);          /* a^(2^255-21) */
+}
+
+/* the scalar of the unused lanes, any decoded scalar does */
+static const uint8_t g_dummyScalar[CRYPT_CURVE25519_KEYLEN] = {
+    0x08, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x40
+};
+
+static const uint8_t g_basePointU[CRYPT_CURVE25519_KEYLEN] = {9};
+
+void X25519ScalarMultX8(uint8_t *const *out, const uint8_t *const *scalars, const uint8_t *const *points,
+    uint32_t num)
+{
+    uint64_t k[4][X25519_LANES];
+    uint8_t decoded[CRYPT_CURVE25519_KEYLEN];
+    Fp51x8 u, xz[2], zInv;
+    Fp51 lane;
+    uint32_t i, j;
+
+    for (i = 0; i < X25519_LANES; i++) {
+        const uint8_t *scalar = (i < num) ? scalars[i] : g_dummyScalar;
+        const uint8_t *point = (i < num && points != NULL) ? points[i] : g_basePointU;
+        CURVE25519_DECODE_LITTLE_ENDIAN(decoded, scalar);
+        for (j = 0; j < 4; j++) { // 4 words of 64 bits
+            k[j][i] = GET_UINT64_LE(decoded, j * sizeof(uint64_t));
+        }
+        Fp51DataToPoly(&lane, point);
+        for (j = 0; j < 5; j++) { // 5 limbs
+            u.data[j][i] = lane.data[j];
+        }
+    }
+
+    X25519x8Ladder(xz, &u, (const uint64_t (*)[X25519_LANES])k);
+    /* Return x2 * (z2 ^ (p - 2)) */
+    Fp51x8Invert(&zInv, &xz[1]);
+    Fp51x8Mul(&xz[0], &xz[0], &zInv);
+
+    for (i = 0; i < num; i++) {
+        for (j = 0; j < 5; j++) { // 5 limbs
+            lane.data[j] = xz[0].data[j][i];
+        }
+        Fp51PolyToData(&lane, out[i]);
+    }
+    BSL_SAL_CleanseData(k, sizeof(k));
+    BSL_SAL_CleanseData(decoded, sizeof(decoded));
+    BSL_SAL_CleanseData(xz, sizeof(xz));
+    BSL_SAL_CleanseData(&lane, sizeof(lane));
+}
+
+#endif // HITLS_CRYPTO_X25519 && HITLS_CRYPTO_CURVE25519_X8664
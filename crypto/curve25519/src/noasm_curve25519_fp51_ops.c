@@ -14,125 +14,13 @@
  */
 
 #include "hitls_build.h"
-#ifdef HITLS_CRYPTO_X25519
+#ifdef HITLS_CRYPTO_CURVE25519
 
 #include "securec.h"
 #include "curve25519_local.h"
 
-// X25519 alternative implementation, faster but require int128
-#if (defined(__SIZEOF_INT128__) && (__SIZEOF_INT128__ == 16))
-#define CURVE25519_51BITS_MASK 0x7ffffffffffff
-#define CURVE25519_51BITS 51
-
-static void Fp51DataToPoly(Fp51 *out, const uint8_t in[32])
-{
-    uint64_t h[5];
-
-    CURVE25519_BYTES7_LOAD(h, in);
-
-    CURVE25519_BYTES6_LOAD(h + 1, in + 7);
-    h[1] <<= 5;
-
-    CURVE25519_BYTES7_LOAD(h + 2, in + 13);
-    h[2] <<= 2;
-
-    CURVE25519_BYTES6_LOAD(h + 3, in + 20);
-    h[3] <<= 7;
-
-    CURVE25519_BYTES6_LOAD(h + 4, in + 26);
-    h[4] &= 0x7fffffffffff; // 41 bits mask = 0x7fffffffffff
-    h[4] <<= 4;
-
-    h[1] |= h[0] >> CURVE25519_51BITS;
-    h[0] &= CURVE25519_51BITS_MASK;
-
-    h[2] |= h[1] >> CURVE25519_51BITS;
-    h[1] &= CURVE25519_51BITS_MASK;
-
-    h[3] |= h[2] >> CURVE25519_51BITS;
-    h[2] &= CURVE25519_51BITS_MASK;
-
-    h[4] |= h[3] >> CURVE25519_51BITS;
-    h[3] &= CURVE25519_51BITS_MASK;
-
-    out->data[0] = h[0];
-    out->data[1] = h[1];
-    out->data[2] = h[2];
-    out->data[3] = h[3];
-    out->data[4] = h[4];
-}
-
-static void Fp51UnloadTo8Bits(uint8_t out[32], uint64_t h[5])
-{
-    // load from uint64 to uint8, load 8 bits at a time
-    out[0] = (uint8_t)h[0];
-    out[1] = (uint8_t)(h[0] >> 8);
-    out[2] = (uint8_t)(h[0] >> 16);
-    out[3] = (uint8_t)(h[0] >> 24);
-    out[4] = (uint8_t)(h[0] >> 32);
-    out[5] = (uint8_t)(h[0] >> 40);
-    // load from position 48 from h[1] and (8-5)=3 bits from h[1] to out[6]
-    out[6] = (uint8_t)((h[0] >> 48) | (uint8_t)(h[1] << 3));
-    out[7] = (uint8_t)(h[1] >> 5);
-    out[8] = (uint8_t)(h[1] >> 13);
-    out[9] = (uint8_t)(h[1] >> 21);
-    out[10] = (uint8_t)(h[1] >> 29);
-    out[11] = (uint8_t)(h[1] >> 37);
-    // load from position 45 from h[1] and (8-2)=6 bits from h[2] to out[12]
-    out[12] = (uint8_t)((h[1] >> 45) | (uint8_t)(h[2] << 6));
-    out[13] = (uint8_t)(h[2] >> 2);
-    out[14] = (uint8_t)(h[2] >> 10);
-    out[15] = (uint8_t)(h[2] >> 18);
-    out[16] = (uint8_t)(h[2] >> 26);
-    out[17] = (uint8_t)(h[2] >> 34);
-    out[18] = (uint8_t)(h[2] >> 42);
-    // load from position 50 from h[2] and (8-1)=7 bits from h[3] to out[19]
-    out[19] = (uint8_t)((h[2] >> 50) | (uint8_t)(h[3] << 1));
-    out[20] = (uint8_t)(h[3] >> 7);
-    out[21] = (uint8_t)(h[3] >> 15);
-    out[22] = (uint8_t)(h[3] >> 23);
-    out[23] = (uint8_t)(h[3] >> 31);
-    out[24] = (uint8_t)(h[3] >> 39);
-    // load from position 47 from h[3] and (4-4)=4 bits from h[4] to out[25]
-    out[25] = (uint8_t)((h[3] >> 47) | (uint8_t)(h[4] << 4));
-    out[26] = (uint8_t)(h[4] >> 4);
-    out[27] = (uint8_t)(h[4] >> 12);
-    out[28] = (uint8_t)(h[4] >> 20);
-    out[29] = (uint8_t)(h[4] >> 28);
-    out[30] = (uint8_t)(h[4] >> 36);
-    out[31] = (uint8_t)(h[4] >> 44);
-}
-
-static void Fp51PolyToData(const Fp51 *in, uint8_t out[32])
-{
-    uint64_t h[5];
-    h[0] = in->data[0];
-    h[1] = in->data[1];
-    h[2] = in->data[2];
-    h[3] = in->data[3];
-    h[4] = in->data[4];
-    uint64_t carry;
-
-    carry = (h[0] + 19) >> CURVE25519_51BITS; // plus 19 then calculate carry
-    carry = (h[1] + carry) >> CURVE25519_51BITS;
-    carry = (h[2] + carry) >> CURVE25519_51BITS;
-    carry = (h[3] + carry) >> CURVE25519_51BITS;
-    carry = (h[4] + carry) >> CURVE25519_51BITS;
-
-    h[0] += 19 * carry; // process carry h[4] -> h[0], h[0] += 19 * carry
-    h[1] += h[0] >> CURVE25519_51BITS;
-    h[0] &= CURVE25519_51BITS_MASK;
-    h[2] += h[1] >> CURVE25519_51BITS;
-    h[1] &= CURVE25519_51BITS_MASK;
-    h[3] += h[2] >> CURVE25519_51BITS;
-    h[2] &= CURVE25519_51BITS_MASK;
-    h[4] += h[3] >> CURVE25519_51BITS;
-    h[3] &= CURVE25519_51BITS_MASK;
-    h[4] &= CURVE25519_51BITS_MASK;
-
-    Fp51UnloadTo8Bits(out, h);
-}
-
+// radix 2^51 field kernels, faster but require int128
+#ifdef CURVE25519_FP51
 void Fp51ProcessCarry(__uint128_t in[5])
 {
     in[1] += (uint64_t)(in[0] >> CURVE25519_51BITS);
@@ -221,8 +109,9 @@ void Fp51Square(Fp51 *out, const Fp51 *in)
     out->data[4] = (uint64_t)h[4];
 }
 
-void Fp51MulScalar(Fp51 *out, const Fp51 *in, const uint32_t scalar)
+void Fp51MulScalar(Fp51 *out, const Fp51 *in)
 {
+    const uint64_t scalar = 121666; // same contract as the assembly, a24 + 1 = 121665 + 1
     __uint128_t h[5];
     h[0] = in->data[0] * (__uint128_t)scalar;
     h[1] = in->data[1] * (__uint128_t)scalar;
@@ -239,165 +128,7 @@ void Fp51MulScalar(Fp51 *out, const Fp51 *in, const uint32_t scalar)
     out->data[4] = (uint64_t)h[4];
 }
 
-/* out = in1 ^ (4 * 2 ^ (2 * times)) * in2 */
-static inline void Fp51MultiSquare(Fp51 *in1, Fp51 *in2, Fp51 *out, int32_t times)
-{
-    int32_t i;
-    Fp51 temp1, temp2;
-    Fp51Square(&temp1, in1);
-    Fp51Square(&temp2, &temp1);
-    for (i = 0; i < times; i++) {
-        Fp51Square(&temp1, &temp2);
-        Fp51Square(&temp2, &temp1);
-    }
-    Fp51Mul(out, in2, &temp2);
-}
-
-/* out = a ^ -1 */
-static void Fp51Invert(Fp51 *out, const Fp51 *a)
-{
-    Fp51 a0;    /* save a^1         */
-    Fp51 a1;    /* save a^2         */
-    Fp51 a2;    /* save a^11        */
-    Fp51 a3;    /* save a^(2^5-1)   */
-    Fp51 a4;    /* save a^(2^10-1)  */
-    Fp51 a5;    /* save a^(2^20-1)  */
-    Fp51 a6;    /* save a^(2^40-1)  */
-    Fp51 a7;    /* save a^(2^50-1)  */
-    Fp51 a8;    /* save a^(2^100-1) */
-    Fp51 a9;    /* save a^(2^200-1) */
-    Fp51 a10;   /* save a^(2^250-1) */
-    Fp51 temp1, temp2;
-
-    /* We know a×b=1(mod p), then a and b are inverses of mod p, i.e. a=b^(-1), b=a^(-1);
-     * According to Fermat's little theorem a^(p-1)=1(mod p), so a*a^(p-2)=1(mod p);
-     * So the inverse element of a is a^(-1) = a^(p-2)(mod p)
-     * Here it is, p=2^255-19, thus we need to compute a^(2^255-21)(mod(2^255-19))
-     */
-
-    /* a^1 */
-    CURVE25519_FP51_COPY(a0.data, a->data);
-
-    /* a^2 */
-    Fp51Square(&a1, &a0);
-
-    /* a^4 */
-    Fp51Square(&temp1, &a1);
-
-    /* a^8 */
-    Fp51Square(&temp2, &temp1);
-
-    /* a^9 */
-    Fp51Mul(&temp1, &a0, &temp2);
-
-    /* a^11 */
-    Fp51Mul(&a2, &a1, &temp1);
-
-    /* a^22 */
-    Fp51Square(&temp2, &a2);
-
-    /* a^(2^5-1) = a^(9+22) */
-    Fp51Mul(&a3, &temp1, &temp2);
-
-    /* a^(2^10-1) = a^(2^10-2^5) * a^(2^5-1) */
-    Fp51Square(&temp1, &a3);
-    Fp51Square(&temp2, &temp1);
-    Fp51Square(&temp1, &temp2);
-    Fp51Square(&temp2, &temp1);
-    Fp51Square(&temp1, &temp2);
-    Fp51Mul(&a4, &a3, &temp1);
-
-    /* a^(2^20-1) = a^(2^20-2^10) * a^(2^10-1) */
-    Fp51MultiSquare(&a4, &a4, &a5, 4); // (2 * 2) ^ 4
-
-    /* a^(2^40-1) = a^(2^40-2^20) * a^(2^20-1) */
-    Fp51MultiSquare(&a5, &a5, &a6, 9); // (2 * 2) ^ 9
-
-    /* a^(2^50-1) = a^(2^50-2^10) * a^(2^10-1) */
-    Fp51MultiSquare(&a6, &a4, &a7, 4); // (2 * 2) ^ 4
-
-    /* a^(2^100-1) = a^(2^100-2^50) * a^(2^50-1) */
-    Fp51MultiSquare(&a7, &a7, &a8, 24); // (2 * 2) ^ 24
-
-    /* a^(2^200-1) = a^(2^200-2^100) * a^(2^100-1) */
-    Fp51MultiSquare(&a8, &a8, &a9, 49); // (2 * 2) ^ 49
-
-    /* a^(2^250-1) = a^(2^250-2^50) * a^(2^50-1) */
-    Fp51MultiSquare(&a9, &a7, &a10, 24); // (2 * 2) ^ 24
-
-    /* a^(2^5*(2^250-1)) = (a^(2^250-1))^5 */
-    Fp51Square(&temp1, &a10);
-    Fp51Square(&temp2, &temp1);
-    Fp51Square(&temp1, &temp2);
-    Fp51Square(&temp2, &temp1);
-    Fp51Square(&temp1, &temp2);
-
-    /* The output: a^(2^255-21) = a(2^5*(2^250-1)+11) = a^(2^5*(2^250-1)) * a^11 */
-    Fp51Mul(out, &a2, &temp1);
-}
-
-void ScalarMultiPoint(uint8_t out[32], const uint8_t scalar[32], const uint8_t point[32])
-{
-    uint8_t k[32];
-    const uint8_t *u = point;
-    int32_t t;
-    uint32_t swap;
-    uint32_t kTemp;
-    Fp51 x1, x2, x3;
-    Fp51 z2, z3;
-    Fp51 t1, t2;
-
-    /* Decord the scalar into k */
-    CURVE25519_DECODE_LITTLE_ENDIAN(k, scalar);
-
-    /* Reference RFC 7748 section 5: The constant a24 is (486662 - 2) / 4 = 121665 for curve25519/X25519 */
-    Fp51DataToPoly(&x1, u);
-    CURVE25519_FP51_SET(x2.data, 1);
-    CURVE25519_FP51_SET(z2.data, 0);
-    CURVE25519_FP51_COPY(x3.data, x1.data);
-    CURVE25519_FP51_SET(z3.data, 1);
-    swap = 0;
-
-    /* "bits" parameter set to 255 for x25519  */ /* For t = bits-1(254) down to 0: */
-    for (t = 254; t >= 0; t--) {
-        /* t >> 3: calculation the index of bit; t & 7: Obtains the corresponding bit in the byte */
-        kTemp = (k[(uint32_t)t >> 3] >> ((uint32_t)t & 7)) & 1;           /* kTemp = (k >> t) & 1 */
-        swap ^= kTemp;                                /* swap ^= kTemp */
-        CURVE25519_FP51_CSWAP(swap, x2.data, x3.data);  /* (x_2, x_3) = cswap(swap, x_2, x_3) */
-        CURVE25519_FP51_CSWAP(swap, z2.data, z3.data);  /* (z_2, z_3) = cswap(swap, z_2, z_3) */
-        swap = kTemp;                                 /* swap = kTemp */
-        CURVE25519_FP51_SUB(t1.data, x3.data, z3.data);                /* x3 = D */
-        CURVE25519_FP51_SUB(t2.data, x2.data, z2.data);                /* t2 = B */
-        CURVE25519_FP51_ADD(x2.data, x2.data, z2.data);                /* t1 = A */
-        CURVE25519_FP51_ADD(z2.data, x3.data, z3.data);                /* x2 = C */
-
-        Fp51Mul(&z3, &t1, &x2);
-        Fp51Mul(&z2, &z2, &t2);
-        Fp51Square(&t1, &t2);
-        Fp51Square(&t2, &x2);
-
-        CURVE25519_FP51_ADD(x3.data, z3.data, z2.data);
-        CURVE25519_FP51_SUB(z2.data, z3.data, z2.data);
-        Fp51Mul(&x2, &t2, &t1);
-        CURVE25519_FP51_SUB(t2.data, t2.data, t1.data);
-        Fp51Square(&z2, &z2);
-        Fp51MulScalar(&z3, &t2, 121666); // z2 *= 121665 + 1 = 121666
-        Fp51Square(&x3, &x3);
-        CURVE25519_FP51_ADD(t1.data, t1.data, z3.data);
-        Fp51Mul(&z3, &x1, &z2);
-        Fp51Mul(&z2, &t2, &t1);
-    }
-
-    CURVE25519_FP51_CSWAP(swap, x2.data, x3.data);
-    CURVE25519_FP51_CSWAP(swap, z2.data, z3.data);
-    /* Return x2 * (z2 ^ (p - 2)) */
-    Fp51Invert(&t1, &z2);
-    Fp51Mul(&t2, &x2, &t1);
-    Fp51PolyToData(&t2, out);
-    BSL_SAL_CleanseData(k, sizeof(k));
-}
-
-#else
+#elif defined(HITLS_CRYPTO_X25519)
 
 void FpMulScalar(Fp25 *out, const Fp25 *p, const int32_t scalar)
 {
@@ -530,5 +261,5 @@ void ScalarMultiPoint(uint8_t out[32], const uint8_t scalar[32], const uint8_t p
     FpMul(&t2, &x2, &t1);
     PolynomialToData(out, &t2);
 }
-#endif // uint128
-#endif /* HITLS_CRYPTO_X25519 */
+#endif // CURVE25519_FP51
+#endif /* HITLS_CRYPTO_CURVE25519 */
@@ -19,6 +19,7 @@
 #include "hitls_build.h"
 #ifdef HITLS_CRYPTO_X25519
 
+#include <stdbool.h>
 #include "curve25519_local.h"
 
 #ifdef __cplusplus
@@ -62,6 +63,53 @@ void Fp51Square(Fp51 *out, const Fp51 *f);
  */
 void Fp51MulScalar(Fp51 *out, const Fp51 *in);
 
+#ifdef HITLS_CRYPTO_CURVE25519_X8664
+/* eight lanes X25519 with AVX-512 IFMA, implemented in asm/x25519_ifma_x86_64.S */
+#define X25519_LANES 8
+
+/* eight field elements in radix 2^51, data[i][j] is limb i of lane j, limbs are lower than 2^52 */
+typedef struct {
+    uint64_t data[5][X25519_LANES];
+} Fp51x8;
+
+/**
+ * Function description: out = a * b (mod p) in every lane, out may alias a or b.
+ * Function prototype: void Fp51x8Mul(Fp51x8 *out, const Fp51x8 *a, const Fp51x8 *b);
+ * Input register: rdi: out; rsi: a; rdx: b
+ * Modify the register as follows: zmm0-zmm31
+ * Output register: None
+ */
+void Fp51x8Mul(Fp51x8 *out, const Fp51x8 *a, const Fp51x8 *b);
+
+/**
+ * Function description: out = a ^ (2 ^ times) (mod p) in every lane, times is at least 1.
+ * Function prototype: void Fp51x8Square(Fp51x8 *out, const Fp51x8 *a, uint32_t times);
+ * Input register: rdi: out; rsi: a; edx: times
+ * Modify the register as follows: rdx, zmm0-zmm31
+ * Output register: None
+ */
+void Fp51x8Square(Fp51x8 *out, const Fp51x8 *a, uint32_t times);
+
+/**
+ * Function description: Montgomery ladder of RFC 7748 section 5 in every lane, (out[0] : out[1]) = k * u.
+ * Function prototype: void X25519x8Ladder(Fp51x8 out[2], const Fp51x8 *u, const uint64_t k[4][8]);
+ * Input register: rdi: out, X2 and Z2; rsi: u; rdx: k, k[i][j] is the word i of the decoded scalar of lane j
+ * Modify the register as follows: rax, rcx, r8, k1-k3, zmm0-zmm31
+ * Output register: None
+ */
+void X25519x8Ladder(Fp51x8 out[2], const Fp51x8 *u, const uint64_t k[4][X25519_LANES]);
+
+/* whether the cpu and the os support the eight lanes kernels */
+bool X25519UseIfma(void);
+
+/**
+ * out[i] = X25519(scalars[i], points[i]) for num <= X25519_LANES lanes at once, points NULL selects the base point 9.
+ * The unused lanes run on dummy inputs, so the cost does not depend on num.
+ */
+void X25519ScalarMultX8(uint8_t *const *out, const uint8_t *const *scalars, const uint8_t *const *points,
+    uint32_t num);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -190,6 +190,8 @@ void CRYPT_DH_FreePara(CRYPT_DH_Para *dhPara)
     BN_Destroy(dhPara->p);
     BN_Destroy(dhPara->q);
     BN_Destroy(dhPara->g);
+    BN_MontDestroy(dhPara->mont);
+    BN_MontFixedBaseDestroy(dhPara->gTable);
     BSL_SAL_FREE(dhPara);
 }
 
@@ -297,6 +299,20 @@ ERR:
     return ret;
 }
 
+// The Montgomery context of p is built once the parameters are accepted, and reused by every operation.
+static int32_t ParaMontInit(CRYPT_DH_Para *para)
+{
+    if (para->mont != NULL) {
+        return CRYPT_SUCCESS;
+    }
+    para->mont = BN_MontCreate(para->p);
+    if (para->mont == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    return CRYPT_SUCCESS;
+}
+
 static CRYPT_DH_Para *ParaDup(const CRYPT_DH_Para *para)
 {
     CRYPT_DH_Para *ret = BSL_SAL_Malloc(sizeof(CRYPT_DH_Para));
@@ -308,6 +324,8 @@ static CRYPT_DH_Para *ParaDup(const CRYPT_DH_Para *para)
     ret->q = BN_Dup(para->q);
     ret->g = BN_Dup(para->g);
     ret->id = para->id;
+    ret->mont = NULL;
+    ret->gTable = NULL;
     if (ret->p == NULL || ret->g == NULL) {
         CRYPT_DH_FreePara(ret);
         BSL_ERR_PUSH_ERROR(CRYPT_DH_CREATE_PARA_FAIL);
@@ -318,6 +336,14 @@ static CRYPT_DH_Para *ParaDup(const CRYPT_DH_Para *para)
         BSL_ERR_PUSH_ERROR(CRYPT_DH_CREATE_PARA_FAIL);
         return NULL;
     }
+    if (para->mont != NULL && ParaMontInit(ret) != CRYPT_SUCCESS) {
+        CRYPT_DH_FreePara(ret);
+        return NULL;
+    }
+    // The table is read-only, the duplicated parameters share it.
+    if (para->gTable != NULL && BN_MontFixedBaseUpRef(para->gTable) == CRYPT_SUCCESS) {
+        ret->gTable = para->gTable;
+    }
     return ret;
 }
 
@@ -336,6 +362,7 @@ CRYPT_DH_Ctx *CRYPT_DH_DupCtx(CRYPT_DH_Ctx *ctx)
     GOTO_ERR_IF_SRC_NOT_NULL(newKeyCtx->x, ctx->x, BN_Dup(ctx->x), CRYPT_MEM_ALLOC_FAIL);
     GOTO_ERR_IF_SRC_NOT_NULL(newKeyCtx->y, ctx->y, BN_Dup(ctx->y), CRYPT_MEM_ALLOC_FAIL);
     GOTO_ERR_IF_SRC_NOT_NULL(newKeyCtx->para, ctx->para, ParaDup(ctx->para), CRYPT_MEM_ALLOC_FAIL);
+    newKeyCtx->prvBits = ctx->prvBits;
     BSL_SAL_ReferencesInit(&(newKeyCtx->references));
     return newKeyCtx;
 
@@ -355,12 +382,17 @@ int32_t CRYPT_DH_SetParaEx(CRYPT_DH_Ctx *ctx, CRYPT_DH_Para *para)
         BSL_ERR_PUSH_ERROR(ret);
         return ret;
     }
+    ret = ParaMontInit(para);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
     BN_Destroy(ctx->x);
     BN_Destroy(ctx->y);
     CRYPT_DH_FreePara(ctx->para);
     ctx->x = NULL;
     ctx->y = NULL;
     ctx->para = para;
+    ctx->prvBits = 0;
     return CRYPT_SUCCESS;
 }
 
@@ -381,12 +413,18 @@ int32_t CRYPT_DH_SetPara(CRYPT_DH_Ctx *ctx, const BSL_Param *para)
         BSL_ERR_PUSH_ERROR(ret);
         return ret;
     }
+    ret = ParaMontInit(dhPara);
+    if (ret != CRYPT_SUCCESS) {
+        CRYPT_DH_FreePara(dhPara);
+        return ret;
+    }
     BN_Destroy(ctx->x);
     BN_Destroy(ctx->y);
     CRYPT_DH_FreePara(ctx->para);
     ctx->x = NULL;
     ctx->y = NULL;
     ctx->para = dhPara;
+    ctx->prvBits = 0;
     return CRYPT_SUCCESS;
 }
 
@@ -531,6 +569,32 @@ static int32_t GetXLimb(BN_BigNum *xLimb, const BN_BigNum *p, const BN_BigNum *q
     return BN_SubLimb(xLimb, p, 2);
 }
 
+// Get 2^prvBits - 1 for the short exponents of the named safe-prime groups, otherwise p-2 or q-1
+static int32_t GetGenXLimb(BN_BigNum *xLimb, const CRYPT_DH_Ctx *ctx)
+{
+    if (ctx->prvBits == 0) {
+        return GetXLimb(xLimb, ctx->para->p, ctx->para->q);
+    }
+    int32_t ret = BN_Zeroize(xLimb);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    ret = BN_SetBit(xLimb, ctx->prvBits);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    return BN_SubLimb(xLimb, xLimb, 1);
+}
+
+// y = g ^ x mod p, with the fixed-base table of g when it has been precomputed
+static int32_t ExpG(BN_BigNum *y, const CRYPT_DH_Para *para, const BN_BigNum *x, BN_Mont *mont, BN_Optimizer *opt)
+{
+    if (para->gTable != NULL) {
+        return BN_MontExpFixedBase(y, para->gTable, x, mont, opt);
+    }
+    return BN_MontExpConsttime(y, para->g, x, mont, opt);
+}
+
 static void RefreshCtx(CRYPT_DH_Ctx *dhCtx, BN_BigNum *x, BN_BigNum *y, int32_t ret)
 {
     if (ret == CRYPT_SUCCESS) {
@@ -560,7 +624,7 @@ int32_t CRYPT_DH_Gen(CRYPT_DH_Ctx *ctx)
     BN_BigNum *y = BN_Create(BN_Bits(ctx->para->p));
     BN_BigNum *minP = BN_Create(BN_Bits(ctx->para->p) + 1);
     BN_BigNum *xLimb = BN_Create(BN_Bits(ctx->para->p) + 1);
-    BN_Mont *mont = BN_MontCreate(ctx->para->p);
+    BN_Mont *mont = (ctx->para->mont != NULL) ? ctx->para->mont : BN_MontCreate(ctx->para->p);
     BN_Optimizer *opt = BN_OptimizerCreate();
     if (x == NULL || y == NULL || minP == NULL || xLimb == NULL || mont == NULL || opt == NULL) {
         ret = CRYPT_MEM_ALLOC_FAIL;
@@ -572,13 +636,13 @@ int32_t CRYPT_DH_Gen(CRYPT_DH_Ctx *ctx)
         BSL_ERR_PUSH_ERROR(ret);
         goto ERR;
     }
-    ret = GetXLimb(xLimb, ctx->para->p, ctx->para->q);
+    ret = GetGenXLimb(xLimb, ctx);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
         goto ERR;
     }
     for (cnt = 0; cnt < CRYPT_DH_TRY_CNT_MAX; cnt++) {
-        /*  Generate private key x for [1, q-1] or [1, p-2] */
+        /*  Generate private key x for [1, q-1], [1, p-2] or [1, 2^prvBits - 1] */
         ret = BN_RandRange(x, xLimb);
         if (ret != CRYPT_SUCCESS) {
             BSL_ERR_PUSH_ERROR(ret);
@@ -590,7 +654,7 @@ int32_t CRYPT_DH_Gen(CRYPT_DH_Ctx *ctx)
             goto ERR;
         }
         /* Calculate the public key y. */
-        ret = BN_MontExpConsttime(y, ctx->para->g, x, mont, opt);
+        ret = ExpG(y, ctx->para, x, mont, opt);
         if (ret != CRYPT_SUCCESS) {
             BSL_ERR_PUSH_ERROR(ret);
             goto ERR;
@@ -608,7 +672,9 @@ ERR:
     RefreshCtx(ctx, x, y, ret);
     BN_Destroy(minP);
     BN_Destroy(xLimb);
-    BN_MontDestroy(mont);
+    if (mont != ctx->para->mont) {
+        BN_MontDestroy(mont);
+    }
     BN_OptimizerDestroy(opt);
     return ret;
 }
@@ -661,7 +727,7 @@ int32_t CRYPT_DH_ComputeShareKey(const CRYPT_DH_Ctx *ctx, const CRYPT_DH_Ctx *pu
     }
     BN_BigNum *minP = BN_Create(BN_Bits(ctx->para->p) + 1);
     BN_BigNum *r = BN_Create(BN_Bits(ctx->para->p));
-    BN_Mont *mont = BN_MontCreate(ctx->para->p);
+    BN_Mont *mont = (ctx->para->mont != NULL) ? ctx->para->mont : BN_MontCreate(ctx->para->p);
     BN_Optimizer *opt = BN_OptimizerCreate();
     if (minP == NULL || r == NULL || mont == NULL || opt == NULL) {
         ret = CRYPT_MEM_ALLOC_FAIL;
@@ -694,7 +760,9 @@ int32_t CRYPT_DH_ComputeShareKey(const CRYPT_DH_Ctx *ctx, const CRYPT_DH_Ctx *pu
 ERR:
     BN_Destroy(minP);
     BN_Destroy(r);
-    BN_MontDestroy(mont);
+    if (mont != ctx->para->mont) {
+        BN_MontDestroy(mont);
+    }
     BN_OptimizerDestroy(opt);
     return ret;
 }
@@ -923,6 +991,67 @@ int32_t CRYPT_DH_SetParamById(CRYPT_DH_Ctx *ctx, CRYPT_PKEY_ParaId id)
     return ret;
 }
 
+static int32_t DhSetFixedBaseTable(CRYPT_DH_Ctx *ctx)
+{
+    CRYPT_DH_Para *para = ctx->para;
+    if (para == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_DH_PARA_ERROR);
+        return CRYPT_DH_PARA_ERROR;
+    }
+    if (para->gTable != NULL) {
+        return CRYPT_SUCCESS;
+    }
+    int32_t ret = ParaMontInit(para);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    BN_Optimizer *opt = BN_OptimizerCreate();
+    if (opt == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    // The private key is at most q - 1 or p - 2.
+    uint32_t eBits = BN_Bits((para->q != NULL) ? para->q : para->p);
+    para->gTable = BN_MontFixedBaseCreate(para->g, eBits, para->mont, opt);
+    BN_OptimizerDestroy(opt);
+    if (para->gTable == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    return CRYPT_SUCCESS;
+}
+
+/**
+ * NIST.SP.800-56Ar3 5.6.1.1.1: for the safe-prime groups the private key can be drawn from [1, 2^N - 1],
+ * where 2 * security strength <= N <= len(q). 0 restores the full range [1, q - 1].
+ */
+static int32_t DhSetPrvKeyBits(CRYPT_DH_Ctx *ctx, const void *val, uint32_t len)
+{
+    if (val == NULL || len != (uint32_t)sizeof(uint32_t)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+        return CRYPT_INVALID_ARG;
+    }
+    if (ctx->para == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_DH_PARA_ERROR);
+        return CRYPT_DH_PARA_ERROR;
+    }
+    uint32_t bits = *(const uint32_t *)val;
+    if (bits == 0) {
+        ctx->prvBits = 0;
+        return CRYPT_SUCCESS;
+    }
+    if (ctx->para->id == CRYPT_PKEY_PARAID_MAX || ctx->para->q == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_DH_PARA_ERROR);
+        return CRYPT_DH_PARA_ERROR;
+    }
+    if (bits < 2 * (uint32_t)CRYPT_DH_GetSecBits(ctx) || bits > BN_Bits(ctx->para->q)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+        return CRYPT_INVALID_ARG;
+    }
+    ctx->prvBits = bits;
+    return CRYPT_SUCCESS;
+}
+
 static int32_t CRYPT_DH_GetLen(const CRYPT_DH_Ctx *ctx, GetLenFunc func, void *val, uint32_t len)
 {
     if (val == NULL || len != sizeof(int32_t)) {
@@ -949,6 +1078,10 @@ int32_t CRYPT_DH_Ctrl(CRYPT_DH_Ctx *ctx, int32_t opt, void *val, uint32_t len)
             return CRYPT_DH_GetLen(ctx, (GetLenFunc)CRYPT_DH_GetSecBits, val, len);
         case CRYPT_CTRL_SET_PARAM_BY_ID:
             return CRYPT_DH_SetParamById(ctx, *(CRYPT_PKEY_ParaId *)val);
+        case CRYPT_CTRL_SET_FIXED_BASE_TABLE:
+            return DhSetFixedBaseTable(ctx);
+        case CRYPT_CTRL_SET_DH_PRVKEY_BITS:
+            return DhSetPrvKeyBits(ctx, val, len);
         case CRYPT_CTRL_UP_REFERENCES:
             if (val == NULL || len != (uint32_t)sizeof(int)) {
                 BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
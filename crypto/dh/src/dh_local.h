@@ -37,6 +37,8 @@ struct DH_Para {
     BN_BigNum *q;
     BN_BigNum *g;
     CRYPT_PKEY_ParaId id;
+    BN_Mont *mont; // Montgomery pre-calculation cache of p
+    BN_MontFixedBase *gTable; // Fixed-base table of g, shared by the duplicated parameters
 };
 
 /* DH key context */
@@ -44,6 +46,7 @@ struct DH_Ctx {
     BN_BigNum *x; // Private key
     BN_BigNum *y; // Public key
     CRYPT_DH_Para *para; // key parameter
+    uint32_t prvBits; // Bits of the private key generated for a named safe-prime group, 0 for the full range
     BSL_SAL_RefCount references;
 };
 
@@ -57,6 +57,8 @@ static CRYPT_DSA_Para *ParaMemGet(uint32_t bits)
     para->p = BN_Create(bits);
     para->q = BN_Create(bits);
     para->g = BN_Create(bits);
+    para->mont = NULL;
+    para->gTable = NULL;
     if (para->p == NULL || para->q == NULL || para->g == NULL) {
         BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
         CRYPT_DSA_FreePara(para);
@@ -153,6 +155,8 @@ void CRYPT_DSA_FreePara(CRYPT_DSA_Para *para)
     BN_Destroy(para->p);
     BN_Destroy(para->q);
     BN_Destroy(para->g);
+    BN_MontDestroy(para->mont);
+    BN_MontFixedBaseDestroy(para->gTable);
     BSL_SAL_FREE(para);
 }
 
@@ -251,6 +255,20 @@ static int32_t ParaDataCheck(const CRYPT_DSA_Para *para)
     return ParaPQGCheck(p, q, g);
 }
 
+// The Montgomery context of p is built once the parameters are accepted, and reused by every operation.
+static int32_t ParaMontInit(CRYPT_DSA_Para *para)
+{
+    if (para->mont != NULL) {
+        return CRYPT_SUCCESS;
+    }
+    para->mont = BN_MontCreate(para->p);
+    if (para->mont == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    return CRYPT_SUCCESS;
+}
+
 static CRYPT_DSA_Para *ParaDup(const CRYPT_DSA_Para *para)
 {
     CRYPT_DSA_Para *ret = BSL_SAL_Malloc(sizeof(CRYPT_DSA_Para));
@@ -261,11 +279,21 @@ static CRYPT_DSA_Para *ParaDup(const CRYPT_DSA_Para *para)
     ret->p = BN_Dup(para->p);
     ret->q = BN_Dup(para->q);
     ret->g = BN_Dup(para->g);
+    ret->mont = NULL;
+    ret->gTable = NULL;
     if (ret->p == NULL || ret->q == NULL || ret->g == NULL) {
         CRYPT_DSA_FreePara(ret);
         BSL_ERR_PUSH_ERROR(CRYPT_DSA_ERR_KEY_PARA);
         return NULL;
     }
+    if (para->mont != NULL && ParaMontInit(ret) != CRYPT_SUCCESS) {
+        CRYPT_DSA_FreePara(ret);
+        return NULL;
+    }
+    // The table is read-only, the duplicated parameters share it.
+    if (para->gTable != NULL && BN_MontFixedBaseUpRef(para->gTable) == CRYPT_SUCCESS) {
+        ret->gTable = para->gTable;
+    }
     return ret;
 }
 
@@ -285,6 +313,11 @@ int32_t CRYPT_DSA_SetPara(CRYPT_DSA_Ctx *ctx, const BSL_Param *para)
         CRYPT_DSA_FreePara(dsaPara);
         return ret;
     }
+    ret = ParaMontInit(dsaPara);
+    if (ret != CRYPT_SUCCESS) {
+        CRYPT_DSA_FreePara(dsaPara);
+        return ret;
+    }
 
     BN_Destroy(ctx->x);
     BN_Destroy(ctx->y);
@@ -600,6 +633,15 @@ static void RefreshCtx(CRYPT_DSA_Ctx *ctx, BN_BigNum *x, BN_BigNum *y, int32_t r
     }
 }
 
+// r = g ^ e mod p, with the fixed-base table of g when it has been precomputed
+static int32_t ExpG(BN_BigNum *r, const CRYPT_DSA_Para *para, const BN_BigNum *e, BN_Mont *mont, BN_Optimizer *opt)
+{
+    if (para->gTable != NULL) {
+        return BN_MontExpFixedBase(r, para->gTable, e, mont, opt);
+    }
+    return BN_MontExpConsttime(r, para->g, e, mont, opt);
+}
+
 int32_t CRYPT_DSA_Gen(CRYPT_DSA_Ctx *ctx)
 {
     if (ctx == NULL) {
@@ -614,7 +656,7 @@ int32_t CRYPT_DSA_Gen(CRYPT_DSA_Ctx *ctx)
     int32_t cnt;
     BN_BigNum *x = BN_Create(BN_Bits(ctx->para->q));
     BN_BigNum *y = BN_Create(BN_Bits(ctx->para->p));
-    BN_Mont *mont = BN_MontCreate(ctx->para->p);
+    BN_Mont *mont = (ctx->para->mont != NULL) ? ctx->para->mont : BN_MontCreate(ctx->para->p);
     BN_Optimizer *opt = BN_OptimizerCreate();
     if (x == NULL || y == NULL || opt == NULL || mont == NULL) {
         ret = CRYPT_MEM_ALLOC_FAIL;
@@ -629,7 +671,7 @@ int32_t CRYPT_DSA_Gen(CRYPT_DSA_Ctx *ctx)
             goto ERR;
         }
         /* Calculate the public key y. */
-        ret = BN_MontExpConsttime(y, ctx->para->g, x, mont, opt);
+        ret = ExpG(y, ctx->para, x, mont, opt);
         if (ret != CRYPT_SUCCESS) {
             BSL_ERR_PUSH_ERROR(ret);
             goto ERR;
@@ -645,7 +687,9 @@ int32_t CRYPT_DSA_Gen(CRYPT_DSA_Ctx *ctx)
     BSL_ERR_PUSH_ERROR(ret);
 ERR:
     RefreshCtx(ctx, x, y, ret);
-    BN_MontDestroy(mont);
+    if (mont != ctx->para->mont) {
+        BN_MontDestroy(mont);
+    }
     BN_OptimizerDestroy(opt);
     return ret;
 }
@@ -722,7 +766,7 @@ static int32_t SignCore(const CRYPT_DSA_Ctx *ctx, BN_BigNum *d, BN_BigNum *r,
     int32_t cnt = 0;
     int32_t ret = CRYPT_SUCCESS;
     BN_BigNum *k = BN_Create(BN_Bits(ctx->para->q));
-    BN_Mont *montP = BN_MontCreate(ctx->para->p);
+    BN_Mont *montP = (ctx->para->mont != NULL) ? ctx->para->mont : BN_MontCreate(ctx->para->p);
     BN_Optimizer *opt = BN_OptimizerCreate();
     if (k == NULL || montP == NULL || opt == NULL) {
         ret = CRYPT_MEM_ALLOC_FAIL;
@@ -737,7 +781,7 @@ static int32_t SignCore(const CRYPT_DSA_Ctx *ctx, BN_BigNum *d, BN_BigNum *r,
             goto ERR;
         }
         // Compute r = g^k mod p mod q, see RFC6979-2.4.3 */
-        ret = BN_MontExpConsttime(r, ctx->para->g, k, montP, opt);
+        ret = ExpG(r, ctx->para, k, montP, opt);
         if (ret != CRYPT_SUCCESS) {
             BSL_ERR_PUSH_ERROR(ret);
             goto ERR;
@@ -765,7 +809,9 @@ static int32_t SignCore(const CRYPT_DSA_Ctx *ctx, BN_BigNum *d, BN_BigNum *r,
     BSL_ERR_PUSH_ERROR(ret);
 ERR:
     BN_Destroy(k);
-    BN_MontDestroy(montP);
+    if (montP != ctx->para->mont) {
+        BN_MontDestroy(montP);
+    }
     BN_OptimizerDestroy(opt);
     return ret;
 }
@@ -855,7 +901,7 @@ static int32_t VerifyCore(const CRYPT_DSA_Ctx *ctx, BN_BigNum *d, const DSA_Sign
     BN_BigNum *u1 = BN_Create(BN_Bits(ctx->para->p));
     BN_BigNum *u2 = BN_Create(BN_Bits(ctx->para->p));
     BN_BigNum *w = BN_Create(BN_Bits(ctx->para->q));
-    BN_Mont *montP = BN_MontCreate(ctx->para->p);
+    BN_Mont *montP = (ctx->para->mont != NULL) ? ctx->para->mont : BN_MontCreate(ctx->para->p);
     BN_Optimizer *opt = BN_OptimizerCreate();
     if (u1 == NULL || u2 == NULL || w == NULL || montP == NULL || opt == NULL) {
         BSL_ERR_PUSH_ERROR(ret);
@@ -904,7 +950,9 @@ ERR:
     BN_Destroy(u1);
     BN_Destroy(u2);
     BN_Destroy(w);
-    BN_MontDestroy(montP);
+    if (montP != ctx->para->mont) {
+        BN_MontDestroy(montP);
+    }
     BN_OptimizerDestroy(opt);
     return ret;
 }
@@ -980,6 +1028,35 @@ static int32_t CRYPT_DSA_GetLen(const CRYPT_DSA_Ctx *ctx, GetLenFunc func, void
     return CRYPT_SUCCESS;
 }
 
+static int32_t DsaSetFixedBaseTable(CRYPT_DSA_Ctx *ctx)
+{
+    CRYPT_DSA_Para *para = ctx->para;
+    if (para == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_DSA_ERR_KEY_PARA);
+        return CRYPT_DSA_ERR_KEY_PARA;
+    }
+    if (para->gTable != NULL) {
+        return CRYPT_SUCCESS;
+    }
+    int32_t ret = ParaMontInit(para);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    BN_Optimizer *opt = BN_OptimizerCreate();
+    if (opt == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    // The private key x and the nonce k are both in [1, q-1].
+    para->gTable = BN_MontFixedBaseCreate(para->g, BN_Bits(para->q), para->mont, opt);
+    BN_OptimizerDestroy(opt);
+    if (para->gTable == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    return CRYPT_SUCCESS;
+}
+
 int32_t CRYPT_DSA_Ctrl(CRYPT_DSA_Ctx *ctx, int32_t opt, void *val, uint32_t len)
 {
     if (ctx == NULL) {
@@ -993,6 +1070,8 @@ int32_t CRYPT_DSA_Ctrl(CRYPT_DSA_Ctx *ctx, int32_t opt, void *val, uint32_t len)
             return CRYPT_DSA_GetLen(ctx, (GetLenFunc)CRYPT_DSA_GetSignLen, val, len);
         case CRYPT_CTRL_GET_SECBITS:
             return CRYPT_DSA_GetLen(ctx, (GetLenFunc)CRYPT_DSA_GetSecBits, val, len);
+        case CRYPT_CTRL_SET_FIXED_BASE_TABLE:
+            return DsaSetFixedBaseTable(ctx);
         case CRYPT_CTRL_UP_REFERENCES:
             if (val == NULL || len != (uint32_t)sizeof(int)) {
                 BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
@@ -36,6 +36,8 @@ struct DSA_Para {
     BN_BigNum *p;
     BN_BigNum *q;
     BN_BigNum *g;
+    BN_Mont *mont; // Montgomery pre-calculation cache of p
+    BN_MontFixedBase *gTable; // Fixed-base table of g, shared by the duplicated parameters
 };
 
 /* DSA key ctx */
@@ -379,7 +379,7 @@ static bool CipherCtrlIsCanSet(const CRYPT_EAL_CipherCtx *ctx, int32_t type)
     }
     if ((ctx->states == EAL_CIPHER_STATE_UPDATE) &&
         (type == CRYPT_CTRL_SET_COUNT || type == CRYPT_CTRL_SET_TAGLEN ||
-        type == CRYPT_CTRL_SET_MSGLEN || type == CRYPT_CTRL_SET_AAD)) {
+        type == CRYPT_CTRL_SET_MSGLEN || type == CRYPT_CTRL_SET_AAD || type == CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN)) {
         return false;
     }
     return true;
@@ -468,6 +468,7 @@ static const uint32_t CIPHER_IS_AEAD[] = {
     CRYPT_CIPHER_AES256_GCM,
     CRYPT_CIPHER_CHACHA20_POLY1305,
     CRYPT_CIPHER_SM4_GCM,
+    CRYPT_CIPHER_SM4_CCM,
 };
 
 // Check whether the algorithm is the AEAD algorithm. If yes, true is returned. Otherwise, false is returned.
@@ -247,6 +247,8 @@ static const EAL_SymAlgMap SYM_ID_MAP[] = {
     {.id = CRYPT_CIPHER_AES128_OFB, .modeId = CRYPT_MODE_OFB },
     {.id = CRYPT_CIPHER_AES192_OFB, .modeId = CRYPT_MODE_OFB },
     {.id = CRYPT_CIPHER_AES256_OFB, .modeId = CRYPT_MODE_OFB },
+    {.id = CRYPT_CIPHER_AES128_XTS, .modeId = CRYPT_MODE_XTS },
+    {.id = CRYPT_CIPHER_AES256_XTS, .modeId = CRYPT_MODE_XTS },
 #endif
 #ifdef HITLS_CRYPTO_CHACHA20
     {.id = CRYPT_CIPHER_CHACHA20_POLY1305, .modeId = CRYPT_MODE_CHACHA20_POLY1305},
@@ -259,6 +261,7 @@ static const EAL_SymAlgMap SYM_ID_MAP[] = {
     {.id = CRYPT_CIPHER_SM4_GCM, .modeId = CRYPT_MODE_GCM },
     {.id = CRYPT_CIPHER_SM4_CFB, .modeId = CRYPT_MODE_CFB },
     {.id = CRYPT_CIPHER_SM4_OFB, .modeId = CRYPT_MODE_OFB },
+    {.id = CRYPT_CIPHER_SM4_CCM, .modeId = CRYPT_MODE_CCM },
 #endif
 };
 
@@ -310,6 +313,8 @@ static CRYPT_CipherInfo g_cipherInfo[] = {
     {.id = CRYPT_CIPHER_AES128_OFB, .blockSize = 1, .keyLen = 16, .ivLen = 16},
     {.id = CRYPT_CIPHER_AES192_OFB, .blockSize = 1, .keyLen = 24, .ivLen = 16},
     {.id = CRYPT_CIPHER_AES256_OFB, .blockSize = 1, .keyLen = 32, .ivLen = 16},
+    {.id = CRYPT_CIPHER_AES128_XTS, .blockSize = 1, .keyLen = 32, .ivLen = 16},
+    {.id = CRYPT_CIPHER_AES256_XTS, .blockSize = 1, .keyLen = 64, .ivLen = 16},
 #endif
 #ifdef HITLS_CRYPTO_CHACHA20
     {.id = CRYPT_CIPHER_CHACHA20_POLY1305, .blockSize = 1, .keyLen = 32, .ivLen = 12},
@@ -322,6 +327,7 @@ static CRYPT_CipherInfo g_cipherInfo[] = {
     {.id = CRYPT_CIPHER_SM4_GCM, .blockSize = 1, .keyLen = 16, .ivLen = 12},
     {.id = CRYPT_CIPHER_SM4_CFB, .blockSize = 1, .keyLen = 16, .ivLen = 16},
     {.id = CRYPT_CIPHER_SM4_OFB, .blockSize = 1, .keyLen = 16, .ivLen = 16},
+    {.id = CRYPT_CIPHER_SM4_CCM, .blockSize = 1, .keyLen = 16, .ivLen = 12},
 #endif
 };
 
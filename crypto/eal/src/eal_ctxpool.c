@@ -0,0 +1,252 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#ifdef HITLS_CRYPTO_EAL
+
+#include "securec.h"
+#include "bsl_err_internal.h"
+#include "bsl_sal.h"
+#include "crypt_algid.h"
+#include "crypt_errno.h"
+#include "crypt_eal_ctxpool.h"
+#ifdef HITLS_CRYPTO_MD
+#include "eal_md_local.h"
+#endif
+#ifdef HITLS_CRYPTO_MAC
+#include "eal_mac_local.h"
+#endif
+#ifdef HITLS_CRYPTO_CIPHER
+#include "eal_cipher_local.h"
+#endif
+
+#define CTX_POOL_ATTR_LEN_MAX 1024
+
+typedef enum {
+    CTX_POOL_MD,
+    CTX_POOL_MAC,
+    CTX_POOL_CIPHER
+} EAL_CtxPoolKind;
+
+typedef struct {
+    EAL_CtxPoolKind kind;
+    int32_t id;
+    void *ctx;
+} EAL_CtxPoolSlot;
+
+struct EAL_CtxPool {
+    CRYPT_EAL_LibCtx *libCtx;
+    char *attrName;
+    uint32_t maxNum;
+    uint32_t num;              // number of idle contexts
+    EAL_CtxPoolSlot *slots;
+};
+
+CRYPT_EAL_CtxPool *CRYPT_EAL_CtxPoolNew(CRYPT_EAL_LibCtx *libCtx, const char *attrName, uint32_t maxNum)
+{
+    if (maxNum == 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+        return NULL;
+    }
+    CRYPT_EAL_CtxPool *pool = BSL_SAL_Calloc(1u, sizeof(CRYPT_EAL_CtxPool));
+    if (pool == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return NULL;
+    }
+    pool->slots = BSL_SAL_Calloc(maxNum, sizeof(EAL_CtxPoolSlot));
+    if (pool->slots == NULL) {
+        BSL_SAL_FREE(pool);
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return NULL;
+    }
+    if (attrName != NULL) {
+        uint32_t len = BSL_SAL_Strnlen(attrName, CTX_POOL_ATTR_LEN_MAX);
+        if (len >= CTX_POOL_ATTR_LEN_MAX) {
+            CRYPT_EAL_CtxPoolFree(pool);
+            BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+            return NULL;
+        }
+        pool->attrName = BSL_SAL_Dump(attrName, len + 1);
+        if (pool->attrName == NULL) {
+            CRYPT_EAL_CtxPoolFree(pool);
+            BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+            return NULL;
+        }
+    }
+    pool->libCtx = libCtx;
+    pool->maxNum = maxNum;
+    return pool;
+}
+
+static void CtxPoolFreeCtx(EAL_CtxPoolKind kind, void *ctx)
+{
+    switch (kind) {
+#ifdef HITLS_CRYPTO_MD
+        case CTX_POOL_MD:
+            CRYPT_EAL_MdFreeCtx(ctx);
+            break;
+#endif
+#ifdef HITLS_CRYPTO_MAC
+        case CTX_POOL_MAC:
+            CRYPT_EAL_MacFreeCtx(ctx);
+            break;
+#endif
+#ifdef HITLS_CRYPTO_CIPHER
+        case CTX_POOL_CIPHER:
+            CRYPT_EAL_CipherFreeCtx(ctx);
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+void CRYPT_EAL_CtxPoolFree(CRYPT_EAL_CtxPool *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    for (uint32_t i = 0; i < pool->num; i++) {
+        CtxPoolFreeCtx(pool->slots[i].kind, pool->slots[i].ctx);
+    }
+    BSL_SAL_FREE(pool->slots);
+    BSL_SAL_FREE(pool->attrName);
+    BSL_SAL_Free(pool);
+}
+
+// Take an idle context of the algorithm out of the pool, the most recently put one first.
+static void *CtxPoolTake(CRYPT_EAL_CtxPool *pool, EAL_CtxPoolKind kind, int32_t id)
+{
+    for (uint32_t i = pool->num; i > 0; i--) {
+        EAL_CtxPoolSlot *slot = &pool->slots[i - 1];
+        if (slot->kind == kind && slot->id == id) {
+            void *ctx = slot->ctx;
+            pool->num--;
+            *slot = pool->slots[pool->num];
+            return ctx;
+        }
+    }
+    return NULL;
+}
+
+// Keep the deinitialized context, or free it if the pool is full.
+static void CtxPoolKeep(CRYPT_EAL_CtxPool *pool, EAL_CtxPoolKind kind, int32_t id, void *ctx)
+{
+    if (pool->num >= pool->maxNum) {
+        CtxPoolFreeCtx(kind, ctx);
+        return;
+    }
+    pool->slots[pool->num].kind = kind;
+    pool->slots[pool->num].id = id;
+    pool->slots[pool->num].ctx = ctx;
+    pool->num++;
+}
+
+#ifdef HITLS_CRYPTO_MD
+CRYPT_EAL_MdCTX *CRYPT_EAL_CtxPoolGetMd(CRYPT_EAL_CtxPool *pool, CRYPT_MD_AlgId id)
+{
+    if (pool == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return NULL;
+    }
+    CRYPT_EAL_MdCTX *ctx = CtxPoolTake(pool, CTX_POOL_MD, (int32_t)id);
+    if (ctx != NULL) {
+        return ctx;
+    }
+#ifdef HITLS_CRYPTO_PROVIDER
+    return CRYPT_EAL_ProviderMdNewCtx(pool->libCtx, id, pool->attrName);
+#else
+    return CRYPT_EAL_MdNewCtx(id);
+#endif
+}
+
+void CRYPT_EAL_CtxPoolPutMd(CRYPT_EAL_CtxPool *pool, CRYPT_EAL_MdCTX *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    // A context in the memory of the caller can not outlive this call.
+    if (pool == NULL || ctx->inPlace || CRYPT_EAL_MdDeinit(ctx) != CRYPT_SUCCESS) {
+        CRYPT_EAL_MdFreeCtx(ctx);
+        return;
+    }
+    CtxPoolKeep(pool, CTX_POOL_MD, (int32_t)ctx->id, ctx);
+}
+#endif // HITLS_CRYPTO_MD
+
+#ifdef HITLS_CRYPTO_MAC
+CRYPT_EAL_MacCtx *CRYPT_EAL_CtxPoolGetMac(CRYPT_EAL_CtxPool *pool, CRYPT_MAC_AlgId id)
+{
+    if (pool == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return NULL;
+    }
+    CRYPT_EAL_MacCtx *ctx = CtxPoolTake(pool, CTX_POOL_MAC, (int32_t)id);
+    if (ctx != NULL) {
+        return ctx;
+    }
+#ifdef HITLS_CRYPTO_PROVIDER
+    return CRYPT_EAL_ProviderMacNewCtx(pool->libCtx, id, pool->attrName);
+#else
+    return CRYPT_EAL_MacNewCtx(id);
+#endif
+}
+
+void CRYPT_EAL_CtxPoolPutMac(CRYPT_EAL_CtxPool *pool, CRYPT_EAL_MacCtx *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    if (pool == NULL || CRYPT_EAL_MacDeinit(ctx) != CRYPT_SUCCESS) {
+        CRYPT_EAL_MacFreeCtx(ctx);
+        return;
+    }
+    CtxPoolKeep(pool, CTX_POOL_MAC, (int32_t)ctx->id, ctx);
+}
+#endif // HITLS_CRYPTO_MAC
+
+#ifdef HITLS_CRYPTO_CIPHER
+CRYPT_EAL_CipherCtx *CRYPT_EAL_CtxPoolGetCipher(CRYPT_EAL_CtxPool *pool, CRYPT_CIPHER_AlgId id)
+{
+    if (pool == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return NULL;
+    }
+    CRYPT_EAL_CipherCtx *ctx = CtxPoolTake(pool, CTX_POOL_CIPHER, (int32_t)id);
+    if (ctx != NULL) {
+        return ctx;
+    }
+#ifdef HITLS_CRYPTO_PROVIDER
+    return CRYPT_EAL_ProviderCipherNewCtx(pool->libCtx, id, pool->attrName);
+#else
+    return CRYPT_EAL_CipherNewCtx(id);
+#endif
+}
+
+void CRYPT_EAL_CtxPoolPutCipher(CRYPT_EAL_CtxPool *pool, CRYPT_EAL_CipherCtx *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    if (pool == NULL) {
+        CRYPT_EAL_CipherFreeCtx(ctx);
+        return;
+    }
+    CRYPT_EAL_CipherDeinit(ctx);
+    CtxPoolKeep(pool, CTX_POOL_CIPHER, (int32_t)ctx->id, ctx);
+}
+#endif // HITLS_CRYPTO_CIPHER
+
+#endif // HITLS_CRYPTO_EAL
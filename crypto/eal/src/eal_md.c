@@ -191,6 +191,50 @@ CRYPT_EAL_MdCTX *CRYPT_EAL_MdNewCtx(CRYPT_MD_AlgId id)
     return MdNewDefaultCtx(id);
 }
 
+#define MD_CTX_BUF_ALIGN(len) (((len) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1))
+
+CRYPT_EAL_MdCTX *CRYPT_EAL_MdInitCtxIn(CRYPT_EAL_MdCtxBuf *buf, CRYPT_MD_AlgId id)
+{
+    if (buf == NULL) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_MD, id, CRYPT_NULL_INPUT);
+        return NULL;
+    }
+#ifdef HITLS_CRYPTO_ASM_CHECK
+    if (CRYPT_ASMCAP_Md(id) != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(CRYPT_EAL_ALG_ASM_NOT_SUPPORT);
+        return NULL;
+    }
+#endif
+    const EAL_MdMethod *method = EAL_MdFindMethod(id);
+    uint32_t dataSize = EAL_MdGetCtxSize(id);
+    if (method == NULL || dataSize == 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_EAL_ERR_ALGID);
+        return NULL;
+    }
+    // Layout of the buffer: EAL context | method | algorithm context, each one 8 bytes aligned.
+    size_t methodOff = MD_CTX_BUF_ALIGN(sizeof(CRYPT_EAL_MdCTX));
+    size_t dataOff = methodOff + MD_CTX_BUF_ALIGN(sizeof(EAL_MdUnitaryMethod));
+    if (dataOff + dataSize > sizeof(CRYPT_EAL_MdCtxBuf)) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_MD, id, CRYPT_EAL_BUFF_LEN_NOT_ENOUGH);
+        return NULL;
+    }
+    (void)memset_s(buf, sizeof(CRYPT_EAL_MdCtxBuf), 0, sizeof(CRYPT_EAL_MdCtxBuf));
+    uint8_t *base = (uint8_t *)buf;
+    CRYPT_EAL_MdCTX *ctx = (CRYPT_EAL_MdCTX *)base;
+    EAL_MdUnitaryMethod *temp = (EAL_MdUnitaryMethod *)(base + methodOff);
+    EalMdCopyMethod(method, temp);
+    ctx->inPlace = true;
+    ctx->method = temp;
+    ctx->data = base + dataOff;
+    ctx->id = id;
+    ctx->state = CRYPT_MD_STATE_NEW;
+    if (CRYPT_EAL_MdInit(ctx) != CRYPT_SUCCESS) {
+        BSL_SAL_CleanseData(buf, sizeof(CRYPT_EAL_MdCtxBuf));
+        return NULL;
+    }
+    return ctx;
+}
+
 bool CRYPT_EAL_MdIsValidAlgId(CRYPT_MD_AlgId id)
 {
     return EAL_MdFindMethod(id) != NULL;
@@ -214,7 +258,8 @@ int32_t CRYPT_EAL_MdCopyCtx(CRYPT_EAL_MdCTX *to, const CRYPT_EAL_MdCTX *from)
         EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_MD, CRYPT_MD_MAX, CRYPT_NULL_INPUT);
         return CRYPT_NULL_INPUT;
     }
-    if (to->isProvider != from->isProvider) {
+    // The algorithm context of an in-place ctx can not be replaced by a duplicated one.
+    if (to->isProvider != from->isProvider || to->inPlace) {
         EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_MD, CRYPT_MD_MAX, CRYPT_INCONSISTENT_OPERATION);
         return CRYPT_INCONSISTENT_OPERATION;
     }
@@ -287,6 +332,11 @@ void CRYPT_EAL_MdFreeCtx(CRYPT_EAL_MdCTX *ctx)
         return;
     }
     EAL_EventReport(CRYPT_EVENT_ZERO, CRYPT_ALGO_KDF, ctx->id, CRYPT_SUCCESS);
+    if (ctx->inPlace) {
+        // The memory belongs to the caller, only wipe it.
+        BSL_SAL_CleanseData(ctx, sizeof(CRYPT_EAL_MdCtxBuf));
+        return;
+    }
     ctx->method->freeCtx(ctx->data);
     BSL_SAL_FREE(ctx->method);
     BSL_SAL_FREE(ctx);
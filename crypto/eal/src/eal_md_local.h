@@ -36,6 +36,7 @@ typedef enum {
 
 struct EAL_MdCtx {
     bool isProvider;
+    bool inPlace;      /* placed in a CRYPT_EAL_MdCtxBuf, the memory belongs to the caller */
     EAL_MdUnitaryMethod *method;  /* algorithm operation entity */
     void *data;        /* Algorithm ctx, mainly context */
     uint32_t state;
@@ -55,6 +56,16 @@ const EAL_MdMethod *EAL_MdFindMethod(CRYPT_MD_AlgId id);
 
 int32_t EAL_Md(CRYPT_MD_AlgId id, const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen);
 
+/**
+ * @ingroup eal
+ * @brief Size of the algorithm context of a hash algorithm of the default implementation
+ *
+ * @param id [IN] Algorithm ID
+ *
+ * @return Size in bytes, 0 if the algorithm is not supported.
+ */
+uint32_t EAL_MdGetCtxSize(CRYPT_MD_AlgId id);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -125,6 +125,51 @@ const EAL_MdMethod *EAL_MdFindMethod(CRYPT_MD_AlgId id)
     return NULL;
 }
 
+uint32_t EAL_MdGetCtxSize(CRYPT_MD_AlgId id)
+{
+    switch (id) {
+#ifdef HITLS_CRYPTO_MD5
+        case CRYPT_MD_MD5:
+            return CRYPT_MD5_GetCtxSize();
+#endif
+#ifdef HITLS_CRYPTO_SHA1
+        case CRYPT_MD_SHA1:
+            return CRYPT_SHA1_GetCtxSize();
+#endif
+#ifdef HITLS_CRYPTO_SHA224
+        case CRYPT_MD_SHA224:
+            return CRYPT_SHA2_256_GetCtxSize();
+#endif
+#ifdef HITLS_CRYPTO_SHA256
+        case CRYPT_MD_SHA256:
+            return CRYPT_SHA2_256_GetCtxSize();
+#endif
+#ifdef HITLS_CRYPTO_SHA384
+        case CRYPT_MD_SHA384:
+            return CRYPT_SHA2_512_GetCtxSize();
+#endif
+#ifdef HITLS_CRYPTO_SHA512
+        case CRYPT_MD_SHA512:
+            return CRYPT_SHA2_512_GetCtxSize();
+#endif
+#ifdef HITLS_CRYPTO_SHA3
+        case CRYPT_MD_SHA3_224:
+        case CRYPT_MD_SHA3_256:
+        case CRYPT_MD_SHA3_384:
+        case CRYPT_MD_SHA3_512:
+        case CRYPT_MD_SHAKE128:
+        case CRYPT_MD_SHAKE256:
+            return CRYPT_SHA3_GetCtxSize();
+#endif
+#ifdef HITLS_CRYPTO_SM3
+        case CRYPT_MD_SM3:
+            return CRYPT_SM3_GetCtxSize();
+#endif
+        default:
+            return 0;
+    }
+}
+
 int32_t EAL_Md(CRYPT_MD_AlgId id, const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen)
 {
     int32_t ret;
@@ -36,6 +36,9 @@
 #include "crypt_provider.h"
 #include "bsl_params.h"
 #include "crypt_params_key.h"
+#ifdef HITLS_CRYPTO_X25519
+#include "crypt_curve25519.h"
+#endif
 
 static void EalPkeyCopyMethod(const EAL_PkeyMethod *method, EAL_PkeyUnitaryMethod *dest)
 {
@@ -466,6 +469,68 @@ int32_t CRYPT_EAL_PkeyGen(CRYPT_EAL_PkeyCtx *pkey)
     return CRYPT_SUCCESS;
 }
 
+#ifdef HITLS_CRYPTO_X25519
+/* Key sessions handed to CRYPT_X25519_GenKeyBatch at once */
+#define EAL_PKEY_GEN_BATCH_NUM 64
+
+/* The default method table and the default provider share CRYPT_X25519_GenKey, its key is a curve25519 context */
+static bool EalGenBatchIsX25519(const CRYPT_EAL_PkeyCtx *pkey)
+{
+    return pkey->id == CRYPT_PKEY_X25519 && pkey->method != NULL &&
+        pkey->method->gen == (PkeyGen)CRYPT_X25519_GenKey;
+}
+
+static int32_t EalGenBatchX25519(CRYPT_EAL_PkeyCtx *const *pkeys, CRYPT_CURVE25519_Ctx *const *keys, uint32_t num)
+{
+    uint32_t i;
+    int32_t ret = CRYPT_X25519_GenKeyBatch(keys, num);
+    for (i = 0; i < num; i++) {
+        EAL_EventReport((ret == CRYPT_SUCCESS) ? CRYPT_EVENT_GEN : CRYPT_EVENT_ERR, CRYPT_ALGO_PKEY, pkeys[i]->id,
+            ret);
+    }
+    return ret;
+}
+#endif
+
+int32_t CRYPT_EAL_PkeyGenBatch(CRYPT_EAL_PkeyCtx *const *pkeys, uint32_t num)
+{
+    int32_t ret = CRYPT_SUCCESS;
+    int32_t itemRet;
+    uint32_t i;
+    if (pkeys == NULL || num == 0) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_PKEY, CRYPT_PKEY_MAX, CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+#ifdef HITLS_CRYPTO_X25519
+    CRYPT_EAL_PkeyCtx *xPkeys[EAL_PKEY_GEN_BATCH_NUM];
+    CRYPT_CURVE25519_Ctx *xKeys[EAL_PKEY_GEN_BATCH_NUM];
+    uint32_t xNum = 0;
+#endif
+    for (i = 0; i < num; i++) {
+#ifdef HITLS_CRYPTO_X25519
+        if (pkeys[i] != NULL && EalGenBatchIsX25519(pkeys[i])) {
+            xPkeys[xNum] = pkeys[i];
+            xKeys[xNum++] = pkeys[i]->key;
+            if (xNum == EAL_PKEY_GEN_BATCH_NUM) {
+                itemRet = EalGenBatchX25519(xPkeys, xKeys, xNum);
+                ret = (ret == CRYPT_SUCCESS) ? itemRet : ret;
+                xNum = 0;
+            }
+            continue;
+        }
+#endif
+        itemRet = CRYPT_EAL_PkeyGen(pkeys[i]);
+        ret = (ret == CRYPT_SUCCESS) ? itemRet : ret;
+    }
+#ifdef HITLS_CRYPTO_X25519
+    if (xNum != 0) {
+        itemRet = EalGenBatchX25519(xPkeys, xKeys, xNum);
+        ret = (ret == CRYPT_SUCCESS) ? itemRet : ret;
+    }
+#endif
+    return ret;
+}
+
 static int32_t PriAndPubParamIsValid(const CRYPT_EAL_PkeyCtx *pkey, const void *key, bool isPriKey)
 {
     bool isInputValid = (pkey == NULL) || (key == NULL);
@@ -610,7 +675,7 @@ int32_t CRYPT_EAL_PkeySetPrv(CRYPT_EAL_PkeyCtx *pkey, const CRYPT_EAL_PkeyPrv *k
             break;
         }
         case CRYPT_PKEY_PAILLIER: {
-            BSL_Param paParam[5] = {{CRYPT_PARAM_PAILLIER_N, BSL_PARAM_TYPE_OCTETS, key->key.paillierPrv.n,
+            BSL_Param paParam[7] = {{CRYPT_PARAM_PAILLIER_N, BSL_PARAM_TYPE_OCTETS, key->key.paillierPrv.n,
                     key->key.paillierPrv.nLen, 0},
                 {CRYPT_PARAM_PAILLIER_LAMBDA, BSL_PARAM_TYPE_OCTETS, key->key.paillierPrv.lambda,
                     key->key.paillierPrv.lambdaLen, 0},
@@ -618,6 +683,8 @@ int32_t CRYPT_EAL_PkeySetPrv(CRYPT_EAL_PkeyCtx *pkey, const CRYPT_EAL_PkeyPrv *k
                     0},
                 {CRYPT_PARAM_PAILLIER_N2, BSL_PARAM_TYPE_OCTETS, key->key.paillierPrv.n2, key->key.paillierPrv.n2Len,
                     0},
+                {CRYPT_PARAM_PAILLIER_P, BSL_PARAM_TYPE_OCTETS, key->key.paillierPrv.p, key->key.paillierPrv.pLen, 0},
+                {CRYPT_PARAM_PAILLIER_Q, BSL_PARAM_TYPE_OCTETS, key->key.paillierPrv.q, key->key.paillierPrv.qLen, 0},
                  BSL_PARAM_END};
             ret = pkey->method->setPrv(pkey->key, &paParam);
             break;
@@ -758,10 +825,12 @@ static int32_t GetCommonPrv(const CRYPT_EAL_PkeyCtx *pkey, int32_t paramKey, CRY
 
 static int32_t GetPaillierPrv(const CRYPT_EAL_PkeyCtx *pkey, CRYPT_PaillierPrv *prv)
 {
-    BSL_Param param[5] = {{CRYPT_PARAM_PAILLIER_N, BSL_PARAM_TYPE_OCTETS, prv->n, prv->nLen, 0},
+    BSL_Param param[7] = {{CRYPT_PARAM_PAILLIER_N, BSL_PARAM_TYPE_OCTETS, prv->n, prv->nLen, 0},
         {CRYPT_PARAM_PAILLIER_LAMBDA, BSL_PARAM_TYPE_OCTETS, prv->lambda, prv->lambdaLen, 0},
         {CRYPT_PARAM_PAILLIER_MU, BSL_PARAM_TYPE_OCTETS, prv->mu, prv->muLen, 0},
         {CRYPT_PARAM_PAILLIER_N2, BSL_PARAM_TYPE_OCTETS, prv->n2, prv->n2Len, 0},
+        {CRYPT_PARAM_PAILLIER_P, BSL_PARAM_TYPE_OCTETS, prv->p, prv->pLen, 0},
+        {CRYPT_PARAM_PAILLIER_Q, BSL_PARAM_TYPE_OCTETS, prv->q, prv->qLen, 0},
         BSL_PARAM_END};
     int32_t ret = pkey->method->getPrv(pkey->key, &param);
     if (ret != CRYPT_SUCCESS) {
@@ -772,6 +841,8 @@ static int32_t GetPaillierPrv(const CRYPT_EAL_PkeyCtx *pkey, CRYPT_PaillierPrv *
     prv->lambdaLen = param[1].useLen;
     prv->muLen = param[2].useLen;
     prv->n2Len = param[3].useLen;
+    prv->pLen = param[4].useLen;
+    prv->qLen = param[5].useLen;
     return CRYPT_SUCCESS;
 }
 
@@ -29,7 +29,15 @@
 #include "bsl_err_internal.h"
 #include "eal_common.h"
 #include "crypt_utils.h"
+#ifdef HITLS_CRYPTO_ED25519
+#include "crypt_curve25519.h"
+#endif
+#ifdef HITLS_CRYPTO_RSA
+#include "crypt_rsa.h"
+#endif
 
+/* Items examined together by CRYPT_EAL_PkeyBatchVerify */
+#define EAL_PKEY_BATCH_NUM 64
 
 int32_t CRYPT_EAL_PkeySignData(const CRYPT_EAL_PkeyCtx *pkey, const uint8_t *hash,
     uint32_t hashLen, uint8_t *sign, uint32_t *signLen)
@@ -93,6 +101,127 @@ int32_t CRYPT_EAL_PkeyVerify(const CRYPT_EAL_PkeyCtx *pkey, CRYPT_MD_AlgId id,
     return ret;
 }
 
+typedef struct {
+    uint32_t failIndex; /* index of the first failed item, num if there is none */
+    int32_t failRet;
+    int32_t *results;
+} EalBatchVerifyState;
+
+static void EalBatchVerifyRecord(EalBatchVerifyState *state, uint32_t index, int32_t ret)
+{
+    if (state->results != NULL) {
+        state->results[index] = ret;
+    }
+    if (ret != CRYPT_SUCCESS && index < state->failIndex) {
+        state->failIndex = index;
+        state->failRet = ret;
+    }
+}
+
+#ifdef HITLS_CRYPTO_ED25519
+/* The default method table and the default provider share CRYPT_CURVE25519_Verify, its key is a curve25519 context */
+static bool EalBatchVerifyIsEd25519(const CRYPT_EAL_PkeyCtx *pkey)
+{
+    return pkey != NULL && pkey->id == CRYPT_PKEY_ED25519 && pkey->method != NULL &&
+        pkey->method->verify == (PkeyVerify)CRYPT_CURVE25519_Verify;
+}
+#endif
+
+#ifdef HITLS_CRYPTO_RSA
+/* The same for CRYPT_RSA_Verify and the rsa context */
+static bool EalBatchVerifyIsRsa(const CRYPT_EAL_PkeyCtx *pkey)
+{
+    return pkey != NULL && pkey->id == CRYPT_PKEY_RSA && pkey->method != NULL &&
+        pkey->method->verify == (PkeyVerify)CRYPT_RSA_Verify;
+}
+#endif
+
+static void EalBatchVerifyReport(EalBatchVerifyState *state, uint32_t index, CRYPT_PKEY_AlgId algId, int32_t ret)
+{
+    if (ret != CRYPT_SUCCESS) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_PKEY, algId, ret);
+    } else {
+        EAL_EventReport(CRYPT_EVENT_VERIFY, CRYPT_ALGO_PKEY, algId, CRYPT_SUCCESS);
+    }
+    EalBatchVerifyRecord(state, index, ret);
+}
+
+static void EalBatchVerifyWindow(const CRYPT_EAL_PkeyVerifyItem *items, uint32_t start, uint32_t end,
+    CRYPT_MD_AlgId id, EalBatchVerifyState *state)
+{
+    uint32_t i;
+#ifdef HITLS_CRYPTO_ED25519
+    CRYPT_CURVE25519_VerifyItem edItems[EAL_PKEY_BATCH_NUM];
+    uint32_t edIndex[EAL_PKEY_BATCH_NUM];
+    int32_t edResults[EAL_PKEY_BATCH_NUM];
+    uint32_t edNum = 0;
+#endif
+#ifdef HITLS_CRYPTO_RSA
+    CRYPT_RSA_VerifyItem rsaItems[EAL_PKEY_BATCH_NUM];
+    uint32_t rsaIndex[EAL_PKEY_BATCH_NUM];
+    int32_t rsaResults[EAL_PKEY_BATCH_NUM];
+    uint32_t rsaNum = 0;
+#endif
+    for (i = start; i < end; i++) {
+#ifdef HITLS_CRYPTO_ED25519
+        if (EalBatchVerifyIsEd25519(items[i].pkey)) {
+            edItems[edNum].pkey = items[i].pkey->key;
+            edItems[edNum].msg = items[i].data;
+            edItems[edNum].msgLen = items[i].dataLen;
+            edItems[edNum].sign = items[i].sign;
+            edItems[edNum].signLen = items[i].signLen;
+            edIndex[edNum++] = i;
+            continue;
+        }
+#endif
+#ifdef HITLS_CRYPTO_RSA
+        if (EalBatchVerifyIsRsa(items[i].pkey)) {
+            rsaItems[rsaNum].ctx = items[i].pkey->key;
+            rsaItems[rsaNum].data = items[i].data;
+            rsaItems[rsaNum].dataLen = items[i].dataLen;
+            rsaItems[rsaNum].sign = items[i].sign;
+            rsaItems[rsaNum].signLen = items[i].signLen;
+            rsaIndex[rsaNum++] = i;
+            continue;
+        }
+#endif
+        EalBatchVerifyRecord(state, i, CRYPT_EAL_PkeyVerify(items[i].pkey, id, items[i].data, items[i].dataLen,
+            items[i].sign, items[i].signLen));
+    }
+#ifdef HITLS_CRYPTO_ED25519
+    if (edNum != 0) {
+        (void)CRYPT_CURVE25519_BatchVerify(edItems, edNum, id, edResults);
+        for (i = 0; i < edNum; i++) {
+            EalBatchVerifyReport(state, edIndex[i], CRYPT_PKEY_ED25519, edResults[i]);
+        }
+    }
+#endif
+#ifdef HITLS_CRYPTO_RSA
+    if (rsaNum != 0) {
+        (void)CRYPT_RSA_BatchVerify(rsaItems, rsaNum, id, rsaResults);
+        for (i = 0; i < rsaNum; i++) {
+            EalBatchVerifyReport(state, rsaIndex[i], CRYPT_PKEY_RSA, rsaResults[i]);
+        }
+    }
+#endif
+}
+
+int32_t CRYPT_EAL_PkeyBatchVerify(const CRYPT_EAL_PkeyVerifyItem *items, uint32_t num, CRYPT_MD_AlgId id,
+    int32_t *results)
+{
+    if (items == NULL || num == 0) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_PKEY, CRYPT_PKEY_MAX, CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    EalBatchVerifyState state = {num, CRYPT_SUCCESS, results};
+    uint32_t start;
+    for (start = 0; start < num; start += EAL_PKEY_BATCH_NUM) {
+        EalBatchVerifyWindow(items, start, (num - start < EAL_PKEY_BATCH_NUM) ? num : (start + EAL_PKEY_BATCH_NUM),
+            id, &state);
+    }
+    return state.failRet;
+}
+
 int32_t CRYPT_EAL_PkeyVerifyData(const CRYPT_EAL_PkeyCtx *pkey, const uint8_t *hash,
     uint32_t hashLen, const uint8_t *sign, uint32_t signLen)
 {
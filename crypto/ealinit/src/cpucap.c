@@ -111,6 +111,26 @@ bool IsSupportAVX512BW(void)
     return g_cpuState.code7Out[EBX_OUT_IDX] & bit_AVX512BW;
 }
 
+bool IsSupportAVX512IFMA(void)
+{
+    return g_cpuState.code7Out[EBX_OUT_IDX] & bit_AVX512IFMA;
+}
+
+bool IsSupportVAES(void)
+{
+    return g_cpuState.code7Out[ECX_OUT_IDX] & bit_VAES;
+}
+
+bool IsSupportVPCLMULQDQ(void)
+{
+    return g_cpuState.code7Out[ECX_OUT_IDX] & bit_VPCLMULQDQ;
+}
+
+bool IsSupportSHA(void)
+{
+    return g_cpuState.code7Out[EBX_OUT_IDX] & bit_SHA;
+}
+
 bool IsSupportXSAVE(void)
 {
     return g_cpuState.code1Out[ECX_OUT_IDX] & bit_XSAVE;
@@ -24,268 +24,538 @@
 #include "crypt_errno.h"
 #include "bsl_sal.h"
 #include "bsl_err_internal.h"
+#include "bsl_bytes.h"
 #include "asm_ecp_sm2.h"
 
-static const uint64_t g_sm2Precompute[8 * 256] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    /* Base point G */
-    0x715a4589334c74c7, 0x8fe30bbff2660be1, 0x5f9904466a39c994, 0x32c4ae2c1f198119, 0x02df32e52139f0a0, 0xd0a9877cc62a4740, 0x59bdcee36b692153, 0xbc3736a2f4f6779c,
-    /* 2 * G */
-    0x495c2e1da3f2bd52, 0x9c0dfa08c08a7331, 0x0d58ef57fa73ba4d, 0x56cefd60d7c87c00, 0x6f780d3a970a23c3, 0x6de84c182f6c8e71, 0x68535ce0f8eaf1bd, 0x31b7e7e6cc8189f6,
-    /* 3 * G */
-    0xe26918f1d0509ebf, 0xa13f6bd945302244, 0xbe2daa8cdb41e24c, 0xa97f7cd4b3c993b4, 0xaaacdd037458f6e6, 0x7c400ee5cd045292, 0xccc5cec08a72150f, 0x530b5dd88c688ef5,
-    0xb21646cd34a0ced5, 0x009a084ad5cc937d, 0x2a81052ff641ed69, 0xc239507105c68324, 0x7a253666cb66e009, 0x6bee2e96ab8c71fb, 0x35f1294ac0db1968, 0xb1bf7ec4080f3c87,
-    0xa575da57cc372a9e, 0x344a417b7fce19db, 0x040e008fdd5eb77a, 0xc749061668652e26, 0xa6976eff5fbe6480, 0x5006206eb579ff7d, 0x4504c622b51cf38f, 0xf2df5db2d144e945,
-    0x2c8b1a1a3c4b0d30, 0x05ff8856a6601689, 0xbb17c93e71f22a31, 0x0927afb57d93483b, 0xd572103000088f63, 0x81adf1f0855a064d, 0xac1c0ef6ebf26645, 0x150c6b1ab4d1fc7e,
-    0xcd27e384d9fcaf15, 0xa80198337744ee78, 0xfdbe86a75c139906, 0xddf092555409c19d, 0x223b949657e52bc1, 0x037937707d6a49a2, 0x5cd6b6e9c12d2922, 0x847d18ffb38e8706,
-    0x675d822ded0bb916, 0xd4ea35d60c1c29bb, 0x3db4333d4e860e64, 0xb9c3faeb4b161071, 0x3c286da2cfd31a3e, 0x0366a8a03024b3e0, 0x2491d2de9accf2be, 0xc519b309ecf7269c,
-    0x173472a58cca247e, 0xfe8d59cb43619e4f, 0x0b4a2444a46a74c5, 0xa27233f3a5959508, 0x85227940922c02e9, 0xc3a8433140d1ebca, 0x768f7689b210f45f, 0x379e72f63722c924,
-    0x84a04814db522756, 0xb2d0d065cd219e32, 0x21666061f65c3e32, 0xd3f94862519621c1, 0x47d46fb2bab82a14, 0xf6b743f64d1482d1, 0x2ebd57d146dca428, 0x4b9030cf676f6a74,
-    0x668c74d78ce20ace, 0x125dcdd589c2ff82, 0x7c1aab770f67f543, 0x04b3cb10c9c6d8e2, 0x739a8fd805174a4b, 0x0c94816e63c4bc72, 0x4918e5c02e2b0b93, 0x63516355287e39fe,
-    0x9c9f042d0279270a, 0x5f7b516c5bdaddad, 0xd89058ca059be46e, 0xbfc2df6bb17f971a, 0xb5fbf87b64af3c26, 0x73c9fc6fd150aaaa, 0xcef696b67939bd7b, 0xb145513f59636106,
-    0x2b834f1d509b9cd0, 0x7bea65c6421e189e, 0xfa804513275f58aa, 0x952072d6ff9c65bd, 0x03891e105e009b00, 0x58d1434ae934ba75, 0x1a473f8d9748f238, 0xe6bb9804458bb70f,
-    0x0a44248a36bb0a07, 0xef22ea28be9d44de, 0x4aaf81826982d748, 0x83b4a4de96a4d70f, 0x2e663cd4373a2f24, 0x3e707c8a43852949, 0xeeb6d6c6d7e74f8e, 0xe481c0d9ee8a98d4,
-    0x461b1bbcb80f829c, 0x3b424f35f0ecce4c, 0x3291676c38d39324, 0xf73b839f13912c1a, 0x4c3533771db0955e, 0xdc2e788fb170aa14, 0x5ee9fab985c12455, 0x32ec7722695dc7cf,
-    0x55645bbc8704fb68, 0xea133cd248a93e25, 0xbbce44ef5db3e419, 0x35648233f554ae51, 0x4411a9a30eca2046, 0x154b1870a6a65166, 0x6117bca9ce885dd6, 0x04d7ac60f6d975ef,
-    0x36969f8b77125e6a, 0xbf5113ab85b5ed44, 0x1c993f01115c57f7, 0xdd18aa4aec26eac4, 0xe0180d54d4ae2221, 0x6cce6001d7c0b853, 0x3361493f76fac50f, 0x161e5851969da822,
-    0x427e33ae8ed9c317, 0xa3448557a24554db, 0x221ea8657781ce71, 0x69fdf8a436fd8e5d, 0x71e35709341fdcab, 0xeb7b1ad657c155f5, 0x6b0a9658b33b347b, 0xbaa856d1cad68af3,
-    0x1323f252e493952a, 0xf7c96c55940a4726, 0xe2e0586bb5dc9419, 0xa68b2ec49d1921d0, 0xfd4520a63f5cc585, 0xb95f2de69200269e, 0x933ef442fca7a734, 0x96f361a23b3deb99,
-    0x0588fdd88abdee94, 0xabbb1ea1417f958d, 0x7575e3cb2fa9092d, 0x08314765e44847eb, 0x5eeb0e99c2eb61e9, 0x7de3a53937e8a75f, 0x6b443ab436095378, 0xdf922344fa592a98,
-    0xe1de5f100950c8ab, 0x5b551c86a8976933, 0x137cbf4e8aa50535, 0x6407be639bc5b738, 0xf945321148e90344, 0x60fcfd988fff6dec, 0x12a9423fd80dea54, 0x141caee612e7ab07,
-    0x0755a352dafa1e1d, 0x3e7307f46fa550d1, 0x1835a4d0f3e5e299, 0xe61120569974c0bc, 0x3b86cc142850b0f3, 0x02855e18d12379b4, 0xd08fc10e5056e4bc, 0xcfe30aa2c3877e52,
-    0x4dbb2fcd069d45db, 0xbb570a9f430ea7f6, 0x15c07a8c04226fe3, 0xac8df677299e8288, 0x7bd8b7c847718ce5, 0x0e9b9643d766da33, 0x30c43be69b23cc14, 0xaef82cf361db1c71,
-    0xd7240a35d1f4ffed, 0xec268911ccb79283, 0x314fa6c814c7bda8, 0xdf8a74f904d1715e, 0xbcb60a9e82017c30, 0xe1c80e7752bd6499, 0x7a7606ef148aa5fb, 0x0fed448a3f263918,
-    0x0263b20d539e4139, 0x7e8581fbbcf5de01, 0xce1564c3df7d67ea, 0x178d1f6bd584afcc, 0x9b499a7da7820bf9, 0x7021aafc29ac8e86, 0x53da45cec1caada1, 0xf575f34e5f6c63c6,
-    0x8e6a9e4fdf895290, 0x73783ef304251e74, 0xbcf26fe238a102c2, 0xa0a1a4fbeb476576, 0xe54f7f3a4896d9d3, 0xec73068587361b34, 0x0d09c3f281d4c41c, 0x8dfdd7cd150d2564,
-    0xce37e84fc9541b4b, 0x02a85a7410754529, 0xd7a1f169475b4ddf, 0xec6f34ceacaa73a0, 0x73306a0ff0485872, 0xe607f33be20135ea, 0x6f251c63fbbd2927, 0x3c85cf62a744817e,
-    0x6cb2f058c747d33f, 0x36f0dfe49113c16e, 0x94ed53ed581d191d, 0x91cb72dc55f84346, 0x3ea6aace93921f31, 0xf4c600e8b5dfe811, 0xf7efb07682931f88, 0x1957ad4cfffd491e,
-    0x9dd4ef421635b9dc, 0xc9816be068be66db, 0x625773cae69bbe05, 0x28221c36398c4c3a, 0x2995225e66b162ba, 0x64c77a81858d4ca1, 0xab2012c41627cd81, 0x3b4d172d6963510b,
-    0xfd23ea021da51c9d, 0x8b1ac02e98d543ce, 0xc315796922bf1343, 0x17a5f74d533ae724, 0x57d2e81dbb945dfe, 0x7befa4db8c8d3eff, 0xb9038823d9ad0d5f, 0x498470ec6752b2ec,
-    0xac995c5066bdaaa5, 0x27d053c0f150fe10, 0xd6b48259b69e8530, 0x08daae840b2a43eb, 0x2458b9e3c73bf657, 0xf7dc310560bbe83a, 0xc1b8e58150da662d, 0x80cc0a980495af87,
-    0xa32641e56024666c, 0x791734cd03e5565c, 0xa6d5c2b5817f2329, 0x25d3debd0950d180, 0xd39e100303fa10a2, 0x0458895120e208b4, 0xb938c406dd5cb0e1, 0x92d99a70679d61ef,
-    0x6d69b1bd07837dc9, 0x451641e8455eedb6, 0x4624f85fe9b7cb83, 0xa1aa7f4a42808908, 0xc3c8bd75b5fe25de, 0x6e67fd81941c6a60, 0xeb15fccc63694830, 0x3d420dee447499cf,
-    0x37a60fce33247b4c, 0x1afddac4a9667094, 0x72e11351388e9d3d, 0x87e13ab96307c971, 0x217ed12bbc413d35, 0xd7ac6191958240c7, 0xadb32c8ad1d8a615, 0x3ff4e73fac0283e5,
-    0x549786448c4f3f4d, 0xbaf30f4638d2231b, 0x46dab2eba04afd78, 0x68126a90b051062b, 0x5a8ce092c6b7c016, 0xe7fec8984be51251, 0x35ecf208bdec5980, 0x7e72f70a2eaf1bf4,
-    0xfa2f46cf90a47d2b, 0xe7579164cc5a233c, 0xcdd2cc00d6ce411e, 0x323159ac22478ac2, 0x939227b1d05f49ba, 0xa94c472c0089e4b4, 0x7e7a32282a0c2900, 0xe488cf88fe83acfc,
-    0x31f8514dc6115cb5, 0x8c641a6cb43ae7da, 0x8b8f45b58a12e6cc, 0x3242e1de1fa494c5, 0x7dab7b373c8f551b, 0x56ab9bcf11b6f25a, 0xaa27b4380a8333ad, 0xcbf18ef2f229c025,
-    0xb7d6af71fb640a75, 0x47a9f7f697a28e0b, 0x6b663188dc931a44, 0x7f404379407b0976, 0xf500974f78295571, 0xc7652177fdfae41b, 0x860bec0a6c78c5d0, 0x3178d1bb1435c9af,
-    0xcd1bb864637cf4f9, 0x10e34d63f48c5ed4, 0x5b075be3c412ad03, 0xe6857f7fc3345385, 0x1ca28a8ee15f1878, 0x5d72264551d68eae, 0x581dfa7d2b4c09e3, 0x6b61903f2ba03769,
-    0x2bed704f6dff2150, 0x3b66f17073149664, 0x2a722a8a3b798a66, 0x376bf9e5403eedb7, 0x95c769d2fc372cd9, 0x35698578596b792f, 0x2670a8f2e7f7a641, 0xf6f8ca3c58d3089e,
-    0x47d58af32a91ddc2, 0x30abb6eab3f02921, 0x490df25e43f73f13, 0xf537773939d38a9b, 0xf9099fa3212d8fc1, 0x63ae367eb959d9f8, 0x8e2e511cce74be18, 0xbeb6132d28ff4099,
-    0xc88b69c57731c07e, 0x52ed6a3d227ff763, 0x52cd70822173c59f, 0xd0d299040f1250d8, 0x5769c965f01be7a3, 0xf6db21dd26bbf942, 0x648ab14004516e12, 0xabfc349e2f1d2118,
-    0x0180bb9d84d7141b, 0x134911d8e4bbaaec, 0x4b92b8f64e804905, 0x897da7bb358b6d21, 0x38ecb2e51caf0aae, 0x6543e7e5a787f93d, 0xf571032510364cd2, 0x995b4a9a20d88c89,
-    0xdd379996725be125, 0xb1df2f7a4fcad9d2, 0xa7b5fa7d47457508, 0x2575c600187cec18, 0x1e259e3d752b00d1, 0x83580245568efa73, 0xed22d2e0508647f4, 0x84442dfc92fb06ff,
-    0x3d24524ac4d2c465, 0x0462308a30d9d3e5, 0x45254a01baae8a2e, 0xd2593661cf6daf12, 0x5dca599abe435bf0, 0xa169da8afcb3a620, 0x6cf13824af9f6508, 0x416b602161b2bbf6,
-    0x5c4b342a0ead84ed, 0x654b3a33c67ed63d, 0xa31dbd4bffd8c960, 0x2f7fa743ade7d8ef, 0x3e6c057797b29702, 0xd19f608ec8d8fdbd, 0xfc7473793f836beb, 0x3a0b20471be6e94a,
-    0xec0ddc2b82cb0747, 0xdaeda7da80dde8ce, 0x98e2f9df22a96604, 0x8ab85f67eec67f06, 0xe2874ab08c6c6e2b, 0x0445b6381fc45c42, 0x53e29b91b9afd253, 0x0d90c6f4584c9d15,
-    0xbcafd803c7fa407d, 0xd4a5aebc3d150787, 0xf0d92d5deb9a8696, 0x516478a2567460c7, 0xab9d905b209fb8a3, 0x0e93b2f066f5b023, 0x36ecf288427a2ed2, 0xcd8596762e7c1384,
-    0x2755c80bb1316dd9, 0x787ab24d5a604fb9, 0xdf25cd6e045b914d, 0x968513d803c0a611, 0x60f9fd6e5a72901a, 0x9a31b57f2e430478, 0x893c927b9668ddd5, 0xb0992fa258261de1,
-    0xf4bfcc77ea4809c9, 0xc56284e868ddcfa0, 0x6f0aea97a43907c7, 0xfbb54c148bd5828b, 0x18c1df9b3daafa9b, 0xd037d19f80bdadce, 0x06a3849d9204ccb4, 0x3ace4fd8dfca573e,
-    0x35eaa6e36461d0d3, 0x17905f2a781de540, 0x2d531dd8552f2765, 0x01eeb7b6a1494475, 0xb769488b3901a9f3, 0x7460ad9d8bcceeb9, 0x66a2abf1c7753bb8, 0xabd4a0f7fac6deb4,
-    0x869252402e6a9f99, 0x109e9f4b61c6f6bd, 0x20498d04f39cdf59, 0xd62fed8ce52682d6, 0x58f3f064c341c481, 0xaeb47ad53e382513, 0xe63d189ea323c1db, 0x106309c4f4f41c3b,
-    0x828cc5c0f20462a9, 0x6d96e2a601b93c0e, 0x4cd09b8e39701ff1, 0xd909bb3be4c02cd8, 0x5eefa9a3ec3f9511, 0x05977fb39adacec7, 0x5bb65608aa16f24f, 0x10d8c2a3b3396bd8,
-    0x4b9fdb48e73da1f4, 0xaf424d81ca4837d3, 0x12977a990acddfbc, 0x30c06b0c4ad8881a, 0xbdb45a06820f214c, 0x0d2b4dcdd1d72197, 0x6ac7be40ce1c0b24, 0xdffe969d5c0c2037,
-    0xc86610f34f66b3df, 0x015c9bf09e75950a, 0xcbde1f5982ace379, 0x6a13800155ef04b7, 0x1d092851b33025b7, 0x41d95d9e42639ac6, 0x84f5b14011d026db, 0x2de1cdf12e9cb8c0,
-    0x866723c1db16de4b, 0xdca3ec1ca731d89c, 0x72976afd2d0f4836, 0xb21e68780bd8ee9a, 0xaeece0bcd44dbd4b, 0x01b03b987a6324f8, 0xcef0026bcefa2aac, 0x85405981156ecd7d,
-    0x123308b4a9c5711a, 0x721dd5dacce5bc3d, 0x26804860af6a7e95, 0x7ccbc3bf87cc4d54, 0x5995334c3e242616, 0x3acfb676b987c213, 0x145518b80573d4c0, 0xc6ebde08aded9af4,
-    0x9a4daa72d104dd8b, 0xdde4dac3cd08710b, 0x57e470f1db64f91b, 0x6c7f036eb374832a, 0x9f07db54caab8fcf, 0xbc06cf52d8d5f56c, 0x4aea7bee9c0e0ed6, 0x282c76e18b24f8b4,
-    0xcd43853968e0f8c3, 0x9cab4fb10369ef34, 0xf5aba10ba06befde, 0x99ff4d8ff311e9a0, 0xd35aaa101d22c55a, 0xf2b3182557bf0529, 0xdd523fc5310a3ecf, 0x0b3cc5a35c82a6b7,
-    0x3a15c7a108af767c, 0x0693ab9cd8951ee4, 0x05f23cff908ed521, 0xba38ae4ed8f30818, 0x3567e7eb19841fbc, 0xd4f1f91388ce0fbd, 0x7b3440651da95cb5, 0x56b6c91fef0c0213,
-    0x0c5516aa79811c1c, 0x8869b952943a29fc, 0xf382d60f67fcc2e2, 0xd3a606c601b5c66f, 0x0d6b519f677f9e84, 0x3ef8e988f9e9e6c0, 0x8726d00ed296c2b3, 0x16429acf62bb2d8f,
-    0x858ddab4a1817e91, 0x6f0b334f51351a23, 0x7f09f1f531213b6f, 0x82a81778d373eb3a, 0xbed0e457d7a8801d, 0x632446bf2a988560, 0x3f2e4e9a57914a68, 0x45690fae01c59d44,
-    0x29dc4c21401d787f, 0x5c4a52f82ad10df3, 0x7048dcd10cdece63, 0x5eee8921f4fcd342, 0x9ffe119727f734ae, 0xf39e93dc1c8b27ad, 0x73516bbad0f603e4, 0xb6b3462b6a39a55b,
-    0x4a69c806e78615c2, 0xe988794843797b0c, 0xa47dcf644f700651, 0x97662389f36ce643, 0x17eef58bf866b33f, 0x5eb06c4515ff01bd, 0x328b8d67d4ae956f, 0xcd4d9449aea5cac5,
-    0xcd382e53ed23ae1f, 0x7b1eb83b8306ace5, 0x15a8ecd063d726ba, 0x403b18162679c055, 0xd0a5d4ebea56f425, 0xdf882dfcffcc84bc, 0x8d61a1c805ef7074, 0xeb42ebf496a7bd69,
-    0x4932828fa1eda64a, 0x9b29f654ca04e515, 0x899b922465789ef1, 0xf37e88764c7ac45c, 0x5c21a5c0dd61d736, 0x2554d8e82845136b, 0xbad57a13e441c8c8, 0xfbf59fee83ed48c0,
-    0xb6dfed771b9c57aa, 0xd2a721c4ca5988de, 0x4a72eef2c3b79c4a, 0x4735ff387ce5d531, 0x6595b84458e25402, 0x9050829a6000ae69, 0x4e309f2a26856099, 0xa8ed2943cca6016f,
-    0x93533941dbcc0ace, 0x841a1067098656b6, 0x30bb10f83e216e8a, 0xb4f7130dc7e9212a, 0x93ce7fc238b81921, 0x5b7e8e5a8f641f8c, 0x9ddc33deb95a5b71, 0x2f29f4a14bab0c77,
-    0xfcfdd7e629b3cadf, 0x773924b26ef7247d, 0xda1da81a16bb9420, 0xd25e0cb35f1f1faa, 0xc545c1a75e458451, 0xabedaafe76dcc117, 0x429b67f6ae073a8f, 0x67295cb2e7ed1851,
-    0x844c475a38b961fa, 0x355386afd494c53d, 0x81c6dcf871dd881b, 0x092af9a79f4170d1, 0x7d3dce96cbf08554, 0x72eac8accba2b32d, 0xca582b8e15cc89af, 0xc9a3d27ecf09b2f3,
-    0x09acc52ed3b84f43, 0xb5b0f39553570b43, 0xe9f8c0f1152682a5, 0xdc532866d1359272, 0xa830e1dfd3792ce9, 0x6ad5e7da482f3096, 0x0c80e17dba0aaedf, 0x306cfc30b3a85aae,
-    0x13970909b51d1a80, 0x14ce48989614edc1, 0xdc467497755cbd57, 0x9660670c8b61b1f5, 0x63d8896cd021a129, 0xff50d6958c5fb8d2, 0x39ee34cd34b67a5f, 0x8358e926ccc8e30d,
-    0x99f8edca8af044d5, 0xd3cbf4330b841d22, 0xd174131b63b02eba, 0x38eb496124b15eeb, 0x48a22e8cfb012cfc, 0xf5da2e278065962b, 0xff4403f9200acae2, 0xf184e282b6b418f7,
-    0xc6b107ca5b20c9f3, 0x26f583a441e0630a, 0x92d0e75229f427bc, 0x4f703d0de9e071bc, 0x3171ddeaace634c6, 0x12c49c6dc514680a, 0xa7002297639b4906, 0x1700f3d434b737fc,
-    0xbe75a9cad6bd2300, 0x748db9d9c1cb48ba, 0xadcafa24a2f2c39b, 0xea6d56b46741bf09, 0xc30eead02da09851, 0x8577fffe20f3731e, 0x245a5b85a5e0ebf1, 0x18e5eead89732407,
-    0x746075b5bfc55131, 0xba4453d3d8e14282, 0xf8a86d159d9a709d, 0xa4f4630217f0e85b, 0xf04d0d9b0b09c7c9, 0xe9669f06d6c1b268, 0xe2e27fbcfbda045e, 0xc8a35bec05eb827b,
-    0xeb9d4eaae174d6f2, 0x03e09a3ad81dd4ff, 0xebda3404ab654a2f, 0x5d39c2892dfb220a, 0xf1c3399fdb7845ad, 0x7d979bb1bce205b1, 0x89d18134a93a533c, 0x35b91f56afed2092,
-    0x7c42374fe8984cb6, 0x9c764897cfffdca0, 0xcaac6a4d50fade17, 0xe0ef4846a887c038, 0xd82902a52c00d995, 0xc5067a8d1a2f3a41, 0x0b4ce0b7d7daff7d, 0x9230ff23783733a8,
-    0xad1951435957726a, 0x2206d08929796e05, 0xd4fe4d4127cba088, 0xa162fb5f8af4185f, 0x3427a4e96c94f67c, 0xe86e6a15f91af428, 0xb465eb367ca10566, 0xb9e3bb2376a12196,
-    0xe445463326fd5391, 0xd2cb5fc8266bef82, 0x39f16938e29cf376, 0xb5e7992af43ff901, 0x4bd11a57af8b46ab, 0x0c5e337332e53a91, 0x5585aff51f34de17, 0x3324dae6ff8a7d31,
-    0x7d1a4a46cbefccd9, 0x27f1086e10c87ee9, 0xc78c20aec8a5fdfe, 0x4da8bbb0f99ffecb, 0xc62e8ca1d2255a8e, 0x6888bcbdff421c66, 0x4505e94b0635a09e, 0xcd4588f38a097beb,
-    0x5dd66e10fd954995, 0xf4c89fe58d2946ee, 0x9a994e3b6e6e8e23, 0xd8a26b12ea5c4d4f, 0x5ad271ccd78f3f33, 0xcc32ddea6b84a3ba, 0xe06e913d6923d4a2, 0x47d54e91bac13b53,
-    0x9c284015294338fd, 0xd5e81534cce44432, 0xcbe70ca22e5c5807, 0x28449ff72f96a915, 0xdde032503e64423c, 0xf7bdbe2478c4a4d8, 0x8b7b8d331850a22f, 0x6c6d8382d09406fb,
-    0xef14705131546e8c, 0xe37d671893d4f2fc, 0x5d8d444d3e8cf4ba, 0x61572c322b045a47, 0x82d10acd5f5bebce, 0xa1959df1dec34077, 0xe91ea4d68a7640f3, 0xe3b511c42ceef515,
-    0x481f41613b55ec09, 0xcfc60e29aa074743, 0x58d29712da50cb69, 0x9912f2f0ae0595ac, 0x43196eb35d95b713, 0x76e6a7ee0eb0d7f7, 0xa63822a6684c88ec, 0x308d561a3f241d0e,
-    0xc044c871fa3ba783, 0x37dae2451b0fed32, 0xcfcc32d3fcaf9df7, 0x8363e2ee5e5c4c5c, 0xf7ed72d0656c9949, 0xdc3b5a0fe7c9306a, 0x1c69661627293531, 0x9efda4aa036202c1,
-    0x062de907d0953ad0, 0xf8041e0c6f8a9ecc, 0x6115b8f3de7a86b0, 0x347ddd33f2a2a793, 0x8e7bcacc36680035, 0x9fa94d3cdc8750a8, 0x04e8b20daa55606e, 0x5a2280dbdb9b3752,
-    0x6e31484dbd771d0e, 0xa5fc6ff489cfc13e, 0xb169aadf11e60e81, 0x2837c25fdadc2e26, 0xf2030f4225a85995, 0x7807147e3e464e77, 0xf99091981e6bac0a, 0xc3723f3fc316243d,
-    0x2741ab72959580d9, 0x1cb62f04ad353b13, 0xd083375dc8f7410b, 0xaed46d363137584e, 0xa3d1bb4c8eb5d8f2, 0x830282b1dc1d81a1, 0x083108d71d52fa0d, 0x3b0d22596a1813ae,
-    0x4267a218068f0d8e, 0x0ad610f0ff4c2d83, 0xa8c734baf1d3ad11, 0xec1fbdf9e74e9729, 0x776d76940e9089f7, 0x423ce1f3edd46634, 0x47826701c68b519b, 0x3eedfd07b9887154,
-    0x68ef1d10a42f776a, 0x6386fcab69688add, 0x36a5dd89d191c3cb, 0x8c4881e5d7393294, 0x66def5145491bd99, 0x0a91c1fa773c3457, 0x43799ffb08efb028, 0x85cdcfb669092acb,
-    0x7f4fc84c4030cbfb, 0x72269f3f2b240663, 0x2fbdd32ac29920a7, 0xbdc4d61a0367ef71, 0xaa1216a122a659a2, 0xab1da8335c171bb0, 0x3ca0d22c3b3e45c4, 0x0f946baaadeae8d8,
-    0xef14e81fdd2b364f, 0x2f55ada2ae0de459, 0x940af90140a2de69, 0xc7e75e9aabf401bc, 0x47a9ff788e1c3a3a, 0x2ce3f69491e5dce8, 0x81dbf7dde0977adc, 0x42ba0b11851f6dd9,
-    0x1b4edf339840cf0e, 0xad8ff5b21132fd4f, 0xd5e31a8a588a6101, 0x1661c89b16294868, 0x8019be652e5068b1, 0xd91b1fada5f73c41, 0x283898bb911395dd, 0x06ba3fad70685b96,
-    0xdefeb106c49760ae, 0xdad52aa98d5e77f0, 0x0b9e3af9140b5ea4, 0x6ea78774ca7519f2, 0xcb4aa4498abb9d51, 0xa5c5b3f4d0469271, 0x397aadf70746ccb3, 0xc624e8dffabcc782,
-    0xcfdc959047b20f62, 0x6839796b357d0be1, 0x2c431e27f83005b7, 0x0569f1c4a75037ca, 0x709460772e4c876a, 0xeaa568fd7c9f7dd9, 0x4eae8ce3c8dd9b61, 0x8847a12643e7a6f3,
-    0x50337833e84a623a, 0x6d0f0e64adf10b27, 0xf3029bda34083597, 0x8204c4bb5cc07376, 0x5eb6dc8d28db1c54, 0x08f42a900ba5d9db, 0x90744ed74b2b207d, 0x1e9991f233d884f0,
-    0xaf5ca8e8bfa880e6, 0xfa43aab6924390d1, 0x4a7d2a178fc16736, 0x5a4aa3bf0525ff25, 0x00092c75b19c8544, 0x31fb7664db32f0ef, 0x196515334ea72250, 0x053efa8bfc39562f,
-    0x9bf9efc1b0242cb9, 0xfdd1f568ad88cea0, 0x5bd701ea2ded6b29, 0xe3ffd2783b7121e1, 0x6301c5c26b454d79, 0xc4d21c15e28fe4f0, 0xa2a4b664ef38802e, 0x7e23d698181dfdd3,
-    0x2a76ce3fcc775c7e, 0xbcf7808774f52159, 0x080f9528ffbf916c, 0x885bebd0441de6f0, 0x51e6593154e91061, 0xe5233d5e7b348535, 0x473b3b3f184aa822, 0x21151e7b977aaa95,
-    0xde51ba8cbee9bd99, 0xae5f23f269f957cd, 0x708d74a0a5a682c7, 0x91097071cb646e5e, 0x3bc35e10f5963bbc, 0xb426789ae226b25e, 0xef6cad6c7f12beb6, 0xeab10ec96bacab69,
-    0x23f3533bb1ac8e06, 0x8a6724bfaa07e6b3, 0x7b8760a2905deae8, 0x56702de289f4e2f0, 0xdada3f65d4f55bf8, 0x7f8c6d057d31d642, 0xc9b00abdc8495650, 0x1c51e60abc0eccd2,
-    0xfec65ffbf9c42481, 0x22e8c26bb26384db, 0x6be43bc89cf09d40, 0xbd6c96655fcfe6a2, 0xb626341c04311030, 0x905fe7ef57925046, 0x9509529bde2ef3df, 0x7948636bc0cdc7a4,
-    0xc30c108a100fec81, 0x6221aa9d592e8828, 0xf3c8215591cebb72, 0xd8bf6ea39c57b9dc, 0x1d183b59164b8c40, 0x7ea2a786319e78a6, 0xc973b32e93bc2f87, 0x9025624014782cbe,
-    0xbd6e444a134eac53, 0xfe0f19b444f2e570, 0xf60bc3c21500767c, 0xa8502a4bd10e123e, 0xded8e57012f4651f, 0xaeb1b9241eb04d7a, 0xd513f05f555fed42, 0xfa0c380af507ac6a,
-    0x65b433a8dfb5ce3d, 0x98999ef103eca182, 0xf56d0853313c64ec, 0x3e0417206422ad1b, 0xed5571f713fb7ed3, 0x02876cabef2d641d, 0x60cabfa0f8547278, 0x63a185e898896c4a,
-    0x0e1ecd9e46466a47, 0xd757ae92795b1541, 0xd9dcd23ac5c15de8, 0x3b3de05121ff3a36, 0xa11606102e19c39b, 0xd6106c43e6eb5c91, 0x5ab4cccacefee53a, 0x007b8326ebd1926d,
-    0x32ba940140487c6d, 0x46e0755a22260568, 0x7790f1c8c0222f19, 0xb2bb4be2c6bded6f, 0x175f675d63cdbf6e, 0xa1809a9af4da899a, 0xf7138f89ad5d7afb, 0x761b3fb67fd8c602,
-    0xa2eca2c4334f453b, 0xf64d9dc500a7a507, 0x924adebceb539c8a, 0xc209a7edb19c905e, 0x6dbbff18fdc777c1, 0x17fd5c2997f84b5a, 0x73c3bbc097fbb941, 0xf67681a6300cb02c,
-    0x5dcfafe1b79d21f7, 0x7d4217fb0d2f24bc, 0x53cc4b66d1bf5b67, 0x8512234b09a632ee, 0x7afef5d3c566680a, 0xcc16073d5ac4919b, 0x8cc1c7b68bbc832d, 0x50c43f4413c4c58c,
-    0x724c733a800256f2, 0xff3978a5dbd4f083, 0x9b2a00ed5c8a3916, 0x69e19793abf7a632, 0xcecb6edcab1857af, 0xa462893d3c564a29, 0x61c82e8a6cd57f10, 0x3fa79f6ccffe83c8,
-    0x364ce350ccad2815, 0x83d7adbfcaf46f89, 0x4c2fd40ac0ad5ce2, 0xd51c2c33a7b276b2, 0x37328b5094395ce3, 0x70812a15ff5243fe, 0x15ad4a85db620d26, 0xff3f9978e53508fc,
-    0x4dbe3930f085dd46, 0xe68954afa8bc18b9, 0x1e20699412fc97b3, 0x2b5bc43566c8182b, 0xe948a5e26d1d3ddc, 0xa35730ae4e899f73, 0x8187e151ade21342, 0x22ddbfb842707e88,
-    0x314b8155d6b6ad5b, 0x73d0d75407a752cb, 0xd9da783ff9fa2b9d, 0xf435d414df4f5076, 0x1dff839d5c16d42b, 0xd136dc23e40ab6c1, 0xfca6360f0e1c5a33, 0xaf1c58598e7cb56e,
-    0x43dcc5d73e585d51, 0x519f6ad4eebd062b, 0x80754ac3c1d740f1, 0xaf1fe551463c5b67, 0x1d24556ff8ace198, 0x02b91a2134d2ee23, 0x13d1ffba18d54997, 0x5d56aaa246770a3d,
-    0x4fbbcd60cdb5494b, 0x848f8dffabbea9b6, 0x42672e40d5a53819, 0x584f13fbeaca5bf3, 0xf160a9ccab6e11b4, 0x51a73a3a653b6373, 0x63c3bc25ecdf58c7, 0x325cc030e9514373,
-    0xe2a6b8f7aa1916bf, 0x9c668a4c33a54663, 0x5931972834a653b2, 0xc5e8ca195ea0274e, 0xa5a7a5e95eabfb91, 0xdd71f31da6f7c46e, 0x51b21e140a5fcb76, 0x7d4dc704d3c881db,
-    0x72bb35a49a20c914, 0x1c426d0b4fe64fef, 0xecfeeaed431bab4b, 0x85ac16eb56493abb, 0x45c61bdd78abbe40, 0x937b96bb7431209a, 0xaccf7f070abbe8fb, 0xa17a2586c5bab868,
-    0x0b40d7846acd93bd, 0xe92a3100a8aa7d86, 0x5a90c85c2b95d141, 0x42b957edf0eac80b, 0x97b291bad89c9cf3, 0x8164c5fc56ad0b3c, 0xe178efd995023ccd, 0x0035cde42dc2cf15,
-    0x6a755592839eaf7a, 0x324a4b4eba667d1a, 0xf5c3460b16ba21a4, 0xde9f478017f5ef6b, 0x8d31bc90b58a334a, 0x31fbdfe21dc8eb9c, 0x23d8b2d4a678ac83, 0x4dbb4cad0a7e2706,
-    0x7c91dba2fa129d98, 0x213e75991c59be79, 0x59f768c230bde513, 0x8c2972d5ff12ff22, 0xc691e275dd7475c9, 0x25f4ac9004ef9825, 0xfaad8de2af3a5b1a, 0x0460afdc2ee1ae1c,
-    0x8f542a7f1830047a, 0x2d9c80739c120316, 0x259137908d220bb6, 0xc1f1ed239eb2e2d6, 0x52fc97633cb4e187, 0x466c94626a15b643, 0x4a2391acbad2fc28, 0xd85fcc762fbee484,
-    0xe746df69c444e173, 0xe716b7df6ff3866f, 0xde7f692c0021274f, 0xb5ff42f5c63a693a, 0x183370004c000aa6, 0xcbb94a5f3fd9d41a, 0x592117ec50ae9cf2, 0xba6d987fe545a9d9,
-    0x7f564fc0813b5d4d, 0xb0c3c5252443ec98, 0xf763d3b20ef393ef, 0x86ba065985aab176, 0x1089bea456d640dc, 0x572ab615149aaddc, 0xbb18497c0b5e8699, 0x42acc8ecf1858fd0,
-    0xc7033a8ea70569dd, 0xf6670a5251e942ca, 0x76f01cc756a45ce9, 0x12192f6c25bb90b7, 0x5e67d8c073397f3e, 0x5943d66bca82b331, 0x2177d44402e76b82, 0x1e247b0fb5819ef9,
-    0x69f15537f160c9db, 0x2b7b74de9915f35c, 0xb028cd637d5f3b3f, 0x730cac8955b4a829, 0xff62e2a27178e739, 0xd895fd5a4574f298, 0x9245177f0510e27b, 0xf5d500feda9a7127,
-    0x073a60f73af7d8b2, 0x36fc50273862bdbb, 0xcf8391afee8b886a, 0xcd304e07207e8fd6, 0xf71260f3d5316697, 0xe8d71e81ffa497c1, 0xa945c9b42720abae, 0x45e5de0e5987e1ad,
-    0xce05418c9fdb0589, 0x94a780beb0eda9d8, 0x5b7ded5404d3fa8c, 0xdbe264a2ee1ad880, 0x7aebcd67079987f5, 0xf60062c177a57277, 0x9f71be1267cec822, 0x3f901c7848bef8e0,
-    0xecebbadd7dbef974, 0x3d01a5999ab31878, 0x9646807f6f1f91ba, 0xd8b30022c4e5f774, 0xd4f845b74984a74a, 0x9ef317840a4cd193, 0x201c39b8e0cbedc6, 0x19204c0d6c7fab92,
-    0x2aff1d698b3e9596, 0x03c3310096cbfdfd, 0x37fb5e89e4ade4a1, 0x73fd021127db2008, 0x1e56cc63984cbbdf, 0x884aa70a81db42e6, 0x2230ad7167d0a7ee, 0x6eac311bf6f3a5af,
-    0xa6bb02fdb15ad981, 0xd53d933ff264dba9, 0xa46551cb65cfac45, 0x666c41a76471a819, 0x7bd7ba38a851312a, 0x480fa8cd7fa30feb, 0xa5c42ef922662d51, 0x0afa1c9a8be1ab4f,
-    0x8d9c9aa214346d55, 0x516094082cdc3e18, 0x16a963ea107997d4, 0x8280001138c15cfc, 0xe4ab234bb9ff258d, 0x69880d3b6699086d, 0x3d7d3d1e32308eca, 0xbed0774a3daa1b2e,
-    0xb6df4485983a76d4, 0xc6fb7d520aee753e, 0xdb74f71648c81d1f, 0xb88725df36319c29, 0x9d0c477978210a58, 0x841060a628470c02, 0x70ccd8bc370e425c, 0x1634e628b865cc42,
-    0x0e037ed34a49d063, 0x53cdc28cf90ff0e6, 0x348b5047fc84dcbc, 0xf79591be4e039c0b, 0x9e5db80c33f78fb6, 0x69ce92f11c21829d, 0x919dc94a46942844, 0x0d8185a00b9273ca,
-    0xbb19136e4077238d, 0xdd9d4ca7441d8075, 0xd51e8bfd157c3dca, 0xcefba865bb345540, 0x89564e91dd8456bc, 0x1029166c5b13d782, 0xe02cd50a812d2c44, 0x654de0c9dadd2e89,
-    0x14709b5a9e1a3379, 0xff2a7b2dc49a6ce6, 0x93bb630b0c412bd8, 0x11f4f036687dd7c0, 0xee7fad8f341b1c8f, 0xaf83447eca86634e, 0xbd9c1795dc812ce4, 0xb7099de7e683f6bc,
-    0x2d39ca5fc097f911, 0xfdff3a8358576b7a, 0x272beaee1c8f9796, 0x726e78ffdbc59ca0, 0xb67d5853eaa0c878, 0xc03a497efc478336, 0xdc72b0f36a94a20f, 0x15d177b6ad45123a,
-    0xb887bb864c795fb3, 0x6566180c005efe01, 0xb3b53dc1f6851821, 0x44699e38ee0a6581, 0x1c55a93806333642, 0x1fcbc68cd58d1cd6, 0xa244bb60d708e219, 0x07173dff1b5350f7,
-    0xb8715e9116baeff0, 0xd3752ba762ba2ca1, 0x86d91965e5a31a56, 0x3c27c4951d076d17, 0xd41f651c2ade59ba, 0x8f2ca8db21b97bc5, 0x1c2a1efdae15b528, 0x96977c9dcdba8c3a,
-    0x91c8ddf3688697af, 0xc2de47e16a2fa935, 0x01d09ee453aeaf90, 0x9dbc205a2b000616, 0xc7a82e96d594c62e, 0x3317b8eb5b8b73e5, 0xfff7c8b4c3a32096, 0x6453b70094e3358c,
-    0x2b1bae699aff8a4e, 0xbf7b4736ad753b49, 0x20f6e0752f5bfc7b, 0x497dd9715e1cd5d4, 0xa91030923e88ceb4, 0x602ac3f33ced7c4c, 0xbf584ae8dfb8e2d9, 0x3105b41ec3549b6f,
-    0x163d3abbe998423f, 0x51234aac25187982, 0x8770f9bcfe97c132, 0x1800daeee2fe2a88, 0x0f02b3a8243fd4aa, 0x4a536e070e2bc9ae, 0x628c64308bc9c315, 0xfbecf1323c9722d9,
-    0x331ad785fc3e1d41, 0x5f5508bdfb62937d, 0x91a3214706923e0c, 0xfc796e8da1017f42, 0xaafe90f59343d9bc, 0x2d136e33a60bef49, 0x02f9f2c3db9d0229, 0xd4892cd932be8419,
-    0x79c72ac302f0d281, 0x8abb8e35b1d94786, 0x0c6de808c0c12a8d, 0xac6d4d8e5b9c2ed0, 0xcba0baa1708e791d, 0x4bec127f651f20ff, 0x261d3b5a50d67450, 0x0fc781b9f92cd6c3,
-    0x383faf53f2a71eb8, 0x0c20e971447ba60d, 0x3bdbd7533c088d5b, 0x56c8661b6d330584, 0xb60ad35ea1d2263f, 0x737d7418bce8ebe2, 0xdda539ab99ec21ed, 0xe5c1cea1abbce298,
-    0x4c92449387476985, 0x9c3be4e72e40685f, 0xf6d9c228a9f85902, 0xa44764c91adc6a9a, 0x0db0d2ba599a7553, 0xe3788aa1dd74946a, 0xd239baffacd81b2e, 0xef52f85666c340f8,
-    0xaaadb6ea9b1c8a45, 0x86fc426284837b81, 0xb33810a5001fa2cf, 0xf990bd17f7e2ecf7, 0x14aa4676275e6c1c, 0xf19a05d12146d05e, 0xea5f3c7c6d5b9b4f, 0x32efb45c62042da0,
-    0x7f430093a67ce3ea, 0xc8f47792c4d16d4a, 0xa7e72976b7f5e237, 0x26550333603f8d3e, 0x9b8fe810f3c3b225, 0x65e904778694f5c3, 0xe18bde37757c008c, 0x4fc064ba9ccda596,
-    0xa6ec138b14e30506, 0x064b8d8f63af9202, 0xc3783b153f753ecd, 0x20315c3032141460, 0xbe04af9758a4cb35, 0xa7f4476ceb2653a3, 0xc4699159169fac3b, 0x4e2d709e9b1d01cd,
-    0x4ec5972ace479262, 0x2fc417acdf559f30, 0x0605a730b11000e5, 0x8b65acbb6a17e365, 0xd967fbe917266184, 0x1c10125e01f5db0a, 0xbf638c23b61967f9, 0x71b359fac654beb9,
-    0x9d83451d64277002, 0xc8777ce755abe4f8, 0xfb4530585d7e824a, 0x63c28165d9737d56, 0x7d9dbb4c39824fe3, 0x469e8165902bacf8, 0x5fad83c408ef9c40, 0xf8b2d576c30d1026,
-    0x29f9f4bea44b1781, 0xac726909624bfe7c, 0xaafd751738177909, 0x90563245ba1c612c, 0x389ec2a7d7e59ce3, 0x50500c567966d3c3, 0x26b15bf6cb1ad6cc, 0xe9080fe122c631b5,
-    0x17f6dabe12e3e5d3, 0xc3f85d05a0f070f8, 0x67d33630af152ed4, 0xdb3b4096c5c332d7, 0xc3dd07768e70b774, 0xa1e0b82d0516b75c, 0x867ca995ad903a61, 0x4fcd47a488ba6d51,
-    0x6c6aba39dfc7d00e, 0xab65e0c18b16269b, 0x09ba717e85654122, 0x07e4cb761fb1b0e5, 0x9265799c5d55a837, 0xf7e6d513b6437316, 0x94a696b3988e41e6, 0x2607761bf2629a5f,
-    0x973e75d9df82ece9, 0x48730461eb3c4d75, 0x5796dc273ed9d51a, 0xf325bafd97b61151, 0x7007d37e9b53ea4c, 0x3368fe5e05f94087, 0xadd778da036b0736, 0xc31fcbabf6fdf8d7,
-    0x35de52e719187698, 0x1d2f3e4087fa3c08, 0x8047f5eb6ee05190, 0xd5add1eda45df387, 0xc2431d8a98a8fe49, 0xb1c0388fa3162e61, 0x1f0ab07565c55677, 0x7f3b14c57417b083,
-    0x1f0ffa4f1abb4291, 0xdfec55dc328de4d0, 0xb792695f0a121172, 0xe684ea8df0457fae, 0xcef58a827a97e9ba, 0xfd341be16fb9e359, 0xc87a2331a9fb1692, 0x2527b948cee2e7e3,
-    0x5e101fbe7514323e, 0x0d06560293e73c10, 0x1829f79b98724d80, 0x0c6ea39a34167a64, 0x1da654dac1c2b486, 0x4381d7a197d73b93, 0xed2de677dfea2660, 0x98cf929f0489101c,
-    0xd6f382504a8d8ea7, 0x483110e79c14ef66, 0xce485d95bbc34776, 0xaec1a6a8430e7289, 0xcafe578fb670a41a, 0x61243b580f10d832, 0x221c3043ce630b2f, 0x8e8705368c784121,
-    0x7963cf963518f155, 0xc21b75f27e48406f, 0x8f2f2bb31db2a418, 0x467a4ce355531acb, 0xd45bfce4db6ad410, 0x116a3d9dbd9162db, 0x26b549e62d30c113, 0xb4799b40daeb1ca5,
-    0xac6d4450ef27b16a, 0x51303f5d166ed3ae, 0x2a7b47acf0255aef, 0x85c10733b0fd7de5, 0xfa1b80f6fcd647ba, 0xc3b3a75c8e36ba96, 0xb89f7cf587c773bb, 0x2585e4ca847ec1e1,
-    0x8f587f5b9b828303, 0xdaf3e553b32110ee, 0x5a080e99f299f28b, 0x60b02561cbf056d9, 0x819439e181a81c62, 0x68e7551c7255e324, 0x8e47a1bdf4e2642f, 0x30b7c9517b5baffe,
-    0x2effcd65da6cf6e5, 0xc0e53b063106b643, 0xd1ac9588459392bf, 0xc3a9b3fe5c4914b8, 0x6fd4a4e70d53afbc, 0xb16f9f98ee51d7d6, 0xc372f1f76b65fc1c, 0x7ace9609a780c6dc,
-    0x4b62ba7528b34440, 0xba37cf920321a2ec, 0xdab82152af4d36ec, 0x359da66c3e405aa0, 0x32133b6e7e57f6b4, 0xfb739dd61168c5ee, 0xfbfc045b30bf74a2, 0xc1c2002bb95c9009,
-    0xfb0e87292c13de33, 0xe6a1ada23c8a0b87, 0x4a4ad963b5c4b22f, 0xed9800b5e15d4c3f, 0x1d3fd890d8ae7729, 0x46aa7d9d9bae01b2, 0x4f6e3a19e1a8fb67, 0x2b460d0337d72c74,
-    0x7be622092baae6c5, 0x8949c3aeda3c2feb, 0xa9d884a9e4704860, 0xfd3dd63e0fd6e075, 0x5de1715bbc8b024c, 0xaebb8f1195f7516c, 0x3bd0bf7a3f4a5378, 0xddd22dd5c8597960,
-    0x94e9199dc8d209b4, 0x5de530f34523777b, 0x51ba8ba0b866a17e, 0xfd55a04a1d22b19c, 0xcdb238bd4130d0d6, 0xa06aeb43357757f5, 0xa475cc0cc62d4527, 0x6d0e779b6e6a8758,
-    0x713405fae15e9778, 0x0f00a2b27568a6a3, 0x62bd58efbe3090fb, 0xf05cdf4c267eb1b6, 0x5e62d04738221b8e, 0xf5b9900f1295612f, 0xa0e5749d177233cf, 0xc44c5592311f8054,
-    0xbd52eb6cdf769fe2, 0xdd0d254454cf2122, 0xb981221ff70b0658, 0x3c36fb55ff496fd5, 0xf430a57f99390967, 0x0954ace551e02989, 0xaafe4ec82b2d9387, 0x6d9fb14548a4f4bc,
-    0x8031a9996ef12134, 0xf6416c9d68835bd2, 0xaffdc09d53a51a0c, 0x19ecea50392e51e3, 0x34a13752a3b17634, 0xee74fe197f0a21c7, 0x428f82d78e4fdbf6, 0x43d9a86b4ee32b41,
-    0x37bcb35d71d05a42, 0x6f9295c16c0084c8, 0x83be0ff5413d3a04, 0x3cd1cc1bba243b00, 0x9a355c5fe780c65d, 0x96f751125aa49305, 0x4996cbc8f7336602, 0x0c35ae189a910bda,
-    0x17aa114cd1e76239, 0x3b9a332aabe8563a, 0xe1275ec7a3241720, 0x7725b43f265d42a2, 0x652de643921dc113, 0x95074114a43d3ba2, 0x6ac46e80d122a80f, 0x1af28df0f5ddb5d8,
-    0xc49b4fcafd637609, 0x60812edd2d354b6f, 0x3491bbfbc599c6e0, 0xfc5c0fada9da1453, 0xb9d457569b43643a, 0x70ba805435dffd85, 0x128cc37ce3a2d1e3, 0xa5e7f2845bf10011,
-    0x5a9599124872a087, 0x6358b4f5deaff08f, 0x2d11e3e6dc803a0d, 0xe028f2b88218e837, 0x0f71a38a839a4b4b, 0xc92a5c359039daaf, 0xb2cc835b6228f5db, 0x8ae04d563cbc4d7a,
-    0x1c1cac7a75e61830, 0xfd2fd5f227d0984a, 0xaa90ea33113594e1, 0xf9e02ffebbe576ff, 0x5ce891014479b80c, 0x605419be299f8523, 0x83202fb7a4ae2a75, 0xf6e64ff96707e5d7,
-    0x3ccaf13d7dd066ce, 0x01aac585c5b5e009, 0x1b4aab8014566d6e, 0x11e7198efab59ba3, 0x24a323f70fc7120c, 0x5609b08316141155, 0x98b0a7b806547c85, 0xaca41a2e51149415,
-    0xcf751f8bd38bf1f5, 0x58ccdf65c8344efe, 0x6c72df390c015ec8, 0x133f9c9c23306d85, 0x61d1cfe15b558202, 0x6a3c4c3582a5f673, 0x637f9512f4c797a7, 0xd330644463579ff0,
-    0xf16e1e34b4ee7ea3, 0x618000e4502dc31c, 0xaa71c457381d0335, 0xf8d920561946d767, 0x9cecf035b94a3d40, 0x3e4545a17b61d5d5, 0x1c3564aa53e6e73f, 0xc2f4bd3857b00d4b,
-    0x211858b81239b300, 0x5e4926ac16c86f0a, 0xe83e64adca66d4c2, 0x63f875c830616302, 0xc6d8069d2b091649, 0x92f747c0d271c5eb, 0x39fa58b367129527, 0x4984ea9b3a80ff9d,
-    0x354da29136527160, 0x997edad9709c86fc, 0xad497e23b94da9bf, 0x7d12cc94bd4d5b76, 0xcabccf6f82027a0d, 0xed6559dcebfc6c95, 0x2f81892df9e2941b, 0x83c3531b95bc842b,
-    0xe48a4ee1f58654e0, 0x05fdbf72d0daa87b, 0x51ad2decf57851ea, 0xd61ba55be8f651a5, 0xceed919f6700c3e6, 0x763257403bff52ef, 0x61af8a4943b1a111, 0xddaf8c619a405fef,
-    0xd722bc84759b7dea, 0x35e5a14698bb02c2, 0xadcf17d7252bb6e3, 0xffe831ce375687b0, 0x02a7b4f8dba11145, 0xd4e67ff0a1cc75bd, 0xf6bed864cb3c0f74, 0xe379cc57b232b594,
-    0xb6599ef34e3d74df, 0xd06b61e56f72748b, 0x2ad1cf0c57a4d409, 0x98afe437bbe1e3aa, 0x1e21f20f87f1dcfb, 0xaaf3d2c81546a6f4, 0x7d14ff98c8a0d395, 0x3664b61f266003a0,
-    0x707b3ab273ddc773, 0xbb486f128f8ecd85, 0x7a396e34185f08f6, 0xa9d40d14282ef537, 0xad0fa6ce1e0d0138, 0x990146e8ced1b2ef, 0xb73509ea936fd5e5, 0x8408168b79b481aa,
-    0x9217fc8086230dd9, 0xaf81fa1a7a00519d, 0xd3c65b61ac9d8d7d, 0x3e83ff6d216d466a, 0x6393d00840e8fe0b, 0x5195eff7a58ecd18, 0x7b7aabcecde2f2bb, 0x1553aee7976dbbb9,
-    0x5d7f749ca175d496, 0x6292f95e5d333f51, 0xffe7f74bb8baf5a7, 0xe9649e0679728c39, 0xa937ccfa06522d38, 0xa7495d7e37c3a928, 0x974158e812ddc092, 0x9a6e70c82ca0b636,
-    0x4ba73f678b2d9ba1, 0x752ba57f558e6a5d, 0x9586e2990a7af7b4, 0xa486d8ada4ae89fd, 0x15ba224f45406dcb, 0x5854cc00ca213240, 0x12cd7a5d7053add0, 0x960b6b398a21e899,
-    0xac81ded4ec6e91d1, 0xe148de8034d93ae0, 0x3084579bb0d44847, 0xdb718742421f4cc0, 0x7358c2d19a2d549a, 0x929c1c9f9de2d932, 0x269b4d558077ce0b, 0x25fcf5912e113dc7,
-    0x04cc755f9b71f92b, 0x54069e1f886a4974, 0x5789c6348dc58a5a, 0x1dd27d9819361398, 0x7a2c2390a9dead06, 0x836b38bd06ad26e8, 0x735114cacf0abb97, 0x4ecfb2f5999e82c0,
-    0x85cd7efe9da98029, 0x88e472a38d18b4ce, 0x6e0a3ee3d8777812, 0xa05e44ebb1425ce7, 0xeb884cca4ee53297, 0x67a0f982cb5689e9, 0x84fee0ff278b4fa9, 0xa002601e44d5e266,
-    0x95fa98bbdae12807, 0x118c212dbb88133f, 0x9ede913100051a91, 0xd354ec4f9b29f406, 0x032ab62fc51a4ed6, 0xbfa91cfd68c85311, 0xfb98f0ef27647507, 0x5e418f8926b631ad,
-    0xc17e3e4fee8c4e5a, 0xc221a1b7acf82d68, 0x67bc9540ebff48f4, 0x390b760628e7982d, 0x0d9a4b18c65ca2ac, 0xe27166e392c64490, 0x081ae367a842acde, 0xa041f47bfe8bde53,
-    0x4992b5f7f17e54af, 0x99c4a493193d843c, 0x932846bd07cfbaba, 0x1de956fd8e865a43, 0xeba2f84cbff126af, 0xfc5a5703ac806638, 0x47cbc2aece2dfa99, 0x20cbbf78bd8d99e2,
-    0x22f23b1804c21205, 0x401b1e0887941f00, 0x4421d0c0c7631a72, 0xb7cdbc7b4156fde4, 0x61fce30f2abd51d0, 0xbc70fa9f22178665, 0x94516d4d06878320, 0xfb4a042f53e53e96,
-    0x34e40b1d511804ac, 0x22f37391e01602d1, 0xc280b1aa78edf92d, 0x0efbce19d6a90f10, 0x2bd9185734d40dcc, 0x213d47ac1e778360, 0xc63af769b6d25114, 0x13232c903e39fab3,
-    0xb6757d5b86fd514f, 0x1a6dd98096301f47, 0x18bab6a726908647, 0x05d536ca761feda8, 0x15bff4d2b834d102, 0x0ddc2d840252dd3a, 0x766542ad05502aff, 0x109015445ce703d5,
-    0xae20cb8c3d9dfea0, 0x46c095b0284fdcde, 0x2aec0ae73dbf67c3, 0x85bd72390c54277b, 0x85d589367f593a03, 0x8c18f9bb056fff2e, 0xfa2e3c913319abe9, 0x9ff6e4cd79254ae9,
-    0x03fc24efd2f3d4b4, 0xb2706372e82111fb, 0x097721ba480b1e14, 0x9e06c158cd3746a9, 0x683ec04d3612e0bb, 0xed3a15599cbe3da5, 0x807d052bd2d5260c, 0xdd923767b4122b7b,
-    0xd186423ef1afb4c9, 0x22ac6c53b4c862e1, 0x13da7b1fca53e5df, 0xdd5251565fab22e4, 0xa1197271cface62f, 0xc877adf578cd19a2, 0xee960066597841bd, 0x366359a40c773e2d,
-    0xaeabb0a3600f13fd, 0xabebe74e161a2d18, 0xd71b9e26fe2b124d, 0xc4662e6e1f313619, 0xfe173a50c65e8caf, 0x1bec45186302f028, 0xc075ff623f3bb554, 0x4323d08715ed7717,
-    0xbb776e2356075217, 0x1de047b5503e9641, 0x2e1bae289a76bdd7, 0xa757dc4e78636ced, 0x1095069123a4d1f9, 0x3f14e9b797008cda, 0xec63848d50b81ff9, 0xaf3b5cad36a95559,
-    0x233f53e5cf01a158, 0x5c8d2abb26b8dcce, 0x6d7537e21ef21ad0, 0x3c97225a9782d11a, 0xa6d3757ad819677a, 0xbb1692af9785433d, 0xd185a54d16cc6631, 0x39a85ac7b47d54d7,
-    0xb1a3cc96aa01e9b6, 0x8e7379d626c41f79, 0xde4e39bf11f63063, 0x3583d9a70f56bdd6, 0x4a41104b4edc1f13, 0xb32372a1e2403d80, 0x24f4942ad83baa34, 0x851fed6fc80a5dab,
-    0xcf66b12331d0de29, 0xd29c8987a3759f4f, 0xb724eca99bd71bd8, 0x998eed25e5462fd7, 0x18cc0667b23ed309, 0xa1678d75c0f9970e, 0x0e94c4407c882ebc, 0xaff49c696b108ff0,
-    0x8b85dc03cf67af83, 0xc3b8971a2c053ba2, 0x51b58872e31237dd, 0x270d8a4bdac2c029, 0x592315a7ffdee7ab, 0x6f9616538e5248cb, 0xd3852c3c412ced71, 0x627199cb4cea1797,
-    0xcce13b89571aae9a, 0x6d89ba4fb0251209, 0x1c9f50ab6c243e6b, 0x8aa0b93b2dc1383c, 0x7f548b6e1f79e9ab, 0x0cebfb32a3be244f, 0x017d1af1793fd3cd, 0x00ff6670e1a38c31,
-    0x36eed14d0e34adc7, 0x3abe441ae4f2a164, 0xb72d2b9e2fb7d8d3, 0x9da2accc7a9055af, 0x97d125518e51fa97, 0x99c34b9a44826d1f, 0x4f4076a28ddf9638, 0xf9c53f64cc369d29,
-    0x511e0048328995c1, 0xa88a11c39be88ceb, 0x2cf0f489fdd207e5, 0x9340574aef831f56, 0x804be4f3f31293ea, 0xbb4faf64c2a79175, 0x7e1b92775f22058c, 0x64ddc9fad2caaf6a,
-    0x0cc102dd78d54fcb, 0x75420b65bd9076d6, 0x43ad0f0faf4e6657, 0x7b7be9498e27286c, 0x28ebea8ca428e47f, 0xb8261eee41c26b60, 0xfb9699617411b1bf, 0xb2f5a238c8e024f6,
-    0x7e6243e5c35f8bd3, 0x9d8a370c1d4933d7, 0xf90035f232f83b9d, 0xde869941089e4792, 0xbb56c69fc5e94c5d, 0x3c20a31cb2acfee3, 0xec681c5669d1aed4, 0x35f813bbbd63efc8,
-    0x230bf3de5360fa81, 0x019ca9307351b1ea, 0x89483d5f294ad0d1, 0x2d26d5c3523a7bb0, 0xf448b3a734829026, 0xea966ac84c0d84a0, 0xbbc75b0df9cb45b3, 0x223fc92dd877705e,
-    0x82116ddf8aa5f946, 0xd833740e0435e67f, 0x3dd62d9029b2c9b5, 0x9d586c02e7d84980, 0x053549bc36234aa6, 0xb714a37694615d34, 0x310fe9eeb979f658, 0x49195c1ebd4390dd,
-    0xf8eca25389e4ad62, 0x3c0aec86657896d5, 0xb4ff852a39a579ed, 0x746e85d2c5b681b8, 0xa79919f1fed354ee, 0x3b5af8c711d7552e, 0x2ad734a81d085256, 0xace41048241012e7,
-    0x136b210fcacc5cba, 0x9030ac05d3bc5ef7, 0xae4581e0662ea88a, 0x9dab74fde9f5e395, 0x97c99675e85ca95b, 0xa6daedb7fba8027a, 0x627efe55a1a9d222, 0xa1ca5bf7d9bdb3b2,
-    0x7f9a4f4ff38af6a5, 0xe6daaa3132c047e9, 0x8ed319a4c49017d8, 0xdecec69b23dde41c, 0x6252770bd96b69b8, 0x57a7550df92a1734, 0xa515e7cc2adc773d, 0x4a0275ace8116020,
-    0x8d457d4f899101da, 0xab405c20ee2cc2e7, 0x3dc8c539033cc8f8, 0x1722b2c04c0bdb46, 0xa5e9648b2dacd730, 0x7034710480a5bd9a, 0x7eac55fe42fbd17d, 0x09289386d2f4082b,
-    0xd1a2f0078ce8def6, 0x1242812623174229, 0x08599f664d91c228, 0xc81c406a7396224e, 0xd509938218066269, 0xd2343389470438bf, 0x3447fb9f941dae35, 0x004de4a9a48ac636,
-    0x27ca90f4689c2301, 0x2f3412defbbc0ce5, 0x2ee5bb659869f6c3, 0x15261632db5911f7, 0x4199cac2a1336353, 0xebf5478d0e80e1e5, 0x48e4fa2e689db485, 0x9f8fc1c1df2169c7,
-    0x58acc70991dedf76, 0x32bd6dd6df76e594, 0xb1294d9a558addef, 0x939f07081590bd58, 0xe7353289595edd46, 0x6843a58ece448307, 0xa4f54869bbaa00e0, 0x3b74ece02c301fda,
-    0xe5c428dbe2f92851, 0xa968e8cd8720a09a, 0x04200b07e3772957, 0xf5ea6a41259fe96b, 0x51ba8890646974d1, 0x23a5b771eb9ef59a, 0x8ce5a677e27e30fa, 0xcd275c9060dad20b,
-    0x3db013fabfb3e7f0, 0x05285a98f8dcb9df, 0xfa1f29b103bbb7ef, 0x99b296a1cf43bdea, 0xb4a6f3c0a0b38b3d, 0xaeb12c1aeb5f28d8, 0xae2f1f03eb3e3968, 0x9693b9a888df1b69,
-    0xbec2bac7d73e3d13, 0x820cdad7cbb99d6b, 0xfe541ea866e19a24, 0xf8e2001b77881b99, 0x4442c8e030e9d71f, 0x3370b7879f9014e3, 0xb37106c5ed768dff, 0xf5f96b4753b52deb,
-    0xeb5b72aa23740779, 0x3c02fd793a6a8c6a, 0xbfb37fd699f63b3d, 0x637caaa95593d047, 0xcc3db0ced7526e79, 0xda0ba925cfaab89c, 0x0a1e599f26764a93, 0x98619f3e4d9ae02b,
-    0x9cfce1cf38a28a84, 0x49e24fd3eeb4444f, 0xc55ba9775274a5d1, 0x4039064d18391462, 0x49bad4dba89b74f5, 0x87a4287d22a51523, 0x08007c717cdbd135, 0xfde0ad0c0dc31b17,
-    0xfca05d8e9d566c4a, 0xe1c22849a715f865, 0x4f77083d9194bd32, 0x04de5434dc8aa50a, 0x8786c84405db498d, 0x451cf2e8867c0994, 0xf6277144136903e6, 0x3d442f97db571722,
-    0x14afeca0645cfaa3, 0x1ca827f4190b6464, 0x9b1a7cb30ee81922, 0xdedbbecf9c1f0335, 0x7f4eb403f969fea2, 0x5ac4f8a651f1348e, 0x003fc5816243b999, 0xe5fe41ff42ee5925,
-    0x973631b960509287, 0x06a13b8162813286, 0x9f9f8709acd52ff3, 0x5c11e094abaece8b, 0x354a7913bd03c8a2, 0x2eafde865751f313, 0x0b8712a8ef75ec69, 0xe848590e2df8c405,
-    0x60770245efcbc022, 0x218656367a1d7070, 0xf44c069e7f97795e, 0x72b0541de7a5879c, 0x08358548d77ac787, 0x92e2c32dc055d4f8, 0x4cc1abe176a5d932, 0x9ec9aab004d3ff13,
-    0x0ee5fd1c3b8aec79, 0x5d8f935675f05c32, 0x68ff2e62e4518e70, 0x501f9f82e0fca152, 0x842603f19c33c874, 0xc735950dc7e2f996, 0x8c1d99be490e3597, 0x8e42d0e66230fe93,
-    0xae329aa1564a80e9, 0x5649e17791c1ef21, 0xd02fb4de5056b33c, 0xaf53eb7e9c69160f, 0x526587c48aeb958b, 0xe5bd7f689e8f1d01, 0xfa7c125443e9cf4b, 0xda376c156aa7605a,
-    0x7ec566537c0424d6, 0x8c1a06af932c661f, 0xcd9125069014bc3c, 0xee08acb4bbfc0cee, 0xe6501cae883efb79, 0xa6f190b1ce1a8394, 0x2c8f90c4a264b718, 0x34a813d4c676a289,
-    0xd9ac28124c66cdb9, 0xa84842ddf899fee5, 0xd6f4dfb2165b1a4a, 0xdd9d2eb71a17b11b, 0xcd78677ebb392b2d, 0xec292883c27357c7, 0xbce91e11f9830d92, 0x7aa8b68435489adb,
-    0x54eb584bcdfea954, 0xb8dd62f763e7e58e, 0xa438f6df8db982d8, 0xca9441de3b544abb, 0x1deda190c70f9a4a, 0x445bb6ced6490995, 0x76bf6a3ded7b314d, 0x8a66f016dfdfab07,
-    0x64a21901e2bbdbac, 0x191ff6bb807fc7f4, 0x86b368995e99d41e, 0x417e6535be219210, 0x1491867633f53559, 0x0cecb02863af988a, 0x8e4e386e752beffa, 0x4ba58fed077cf4a5,
-    0xd777631cb7cc0ef3, 0xe11c0ccd18c90c4f, 0x9343426a5050f38e, 0x55efc291307ee56d, 0x0fbcae5d59aeb627, 0x288b467aa5bdfbca, 0xc0a392953f680019, 0x48916fc91ba84c06,
-    0x4a8b4836ba342ed5, 0x03142a9ea4c0e59d, 0xcf342a86d47380b3, 0x3454da8dc9c8791a, 0x0260f14f96803fa0, 0x973bbe79a5f164a8, 0x49edc10d9edee956, 0x0cf5cacd8fccfba6,
-    0xdb4f8f51bb534076, 0x470b7f9d70824b90, 0x1a2e4d589fbe3c75, 0xcbc03b148e363146, 0x99ee702383e08652, 0x7d3a7bc2b1d17942, 0xe29dbdde2a789780, 0xd05be133837d8a4a,
-    0xf2657c5783404faa, 0xe4c60bef204ebf83, 0x8af681c946077603, 0xa4c30856371c7ea4, 0xfd8491493be53498, 0x65b4bb5c0b432d37, 0xf36cf84d1e69c2fc, 0x72540952b560db4c,
-    0x926fe399b48b06bd, 0xbe7bba0600877983, 0x78756a5857287bcf, 0x39344c4f631fab92, 0x8938f0d75f41bb00, 0x62950eb07231d85c, 0x151250c44835e534, 0xeaa6153d366040b6,
-    0x0399ff3ab9d2029b, 0x4f9291ac66bea780, 0x5538b8774466b317, 0x104a472bddd01ce6, 0xbb530a2727a7c317, 0x12a408915c974a92, 0x02d8e5447e228765, 0xbb6c944b06c2be01,
-    0x860518c2841ca8a0, 0x68edab4683438cfd, 0xd5764f712a25913f, 0x14a6ec6cfa7c3115, 0x6f0cc123ec798547, 0x19ae22cc367c885f, 0xd7be6d5f449e5951, 0x8555f4f8fd21152f,
-    0xf3335605e1495f41, 0xb2ea3183d8e360a9, 0xb6221434c5c90c63, 0xdf215d9c2e93390e, 0x98519ef2b0af8143, 0x06044c2d81e1edf6, 0x645f2661d1fc17e2, 0x469a5d2269c3b05f,
-    0xca70212744447558, 0x07a4eb3b4b8e8cfd, 0xef200622675d49f9, 0xd7024c3ac1a6d90c, 0x5c54fcec35596bf2, 0x030e135fcb8673a0, 0x9f1cc6537857af20, 0xbf75a9960af6a424,
-    0xa1ce52907049fd5f, 0xb85d9f1d69b9e757, 0x85beffbfcc396269, 0x0bdf4af30f73131a, 0x74e5c58ffc16a8fe, 0xc3cc87ed72fe0e64, 0x604c1bc18d443cba, 0x9a1b8fd3634f1d41,
-    0xa33795d2516fad6e, 0x99ac9eb1c2ada062, 0xa2713d9be0bcb94d, 0xfd2f6b2989fdf4ea, 0x55e33b2805a13f58, 0x2c7bd9290ee9b966, 0x81fd6f83134014ff, 0x179f8894deefcc6f,
-    0xc61c8e56d5fdb3c0, 0xa4e5343bc6afdde1, 0x36ad5e9310f6d4eb, 0xd5fd90a79e27cc78, 0xd8ccd606e4d48e8d, 0x25f66a9cc989fed6, 0x3d0402457fc4bae1, 0x612733dcf3d0d07b,
-    0xe38fd4832db05d6c, 0x8e2809b7ea934954, 0x52004f18865f4734, 0xbb8ee10a8dd754c1, 0x0fd0437b265a01b3, 0xad6498e5df9586e8, 0x8e143ecbe7db3bba, 0x17331ca3a86566a0,
-    0x50cf16807d23b56d, 0x7c52f40e61c17c15, 0x70aff594054aca7d, 0xa9005fada5801d62, 0xc2c62f1740a8a26d, 0xccccb11f991fb387, 0x2f38ade83ab14eac, 0x33a947c235f4d753,
-    0xa5625e617031d563, 0x4f964fabfa8b3b58, 0x84b4e9eaead9b63c, 0x6df29966734e4146, 0x11dd7ce026d0c29a, 0x9963e5fa15f8d521, 0x1e20c4ade063847d, 0xaed43f08f72a9080,
-    0x3dd7ce36cef85b37, 0x78e5e46f7874aed5, 0x5ded630f68dab2fa, 0x9e41471fb56fd63b, 0xda4d8c5b0c650d1c, 0x9939dd39cf15b48c, 0xc4caf8da2e6475b3, 0x783e1a913f0b79cb,
-    0xd6131558db68427a, 0x544774b505054d4c, 0xa30cadbbabc33d9d, 0xa8d250afca0b7a81, 0x36f07dfcde5fd8d0, 0xd25bb4feb8a0b5d6, 0x52cfde1125affcca, 0x95876763d947df39,
-    0x916a38f31aa8c326, 0x7fbdbbe0054a44be, 0xf26e36f7c5eb7a26, 0xdb7ba35f9caacbbd, 0x8de921ce9854cb9c, 0x83c48c8ba5f3ac18, 0xea86332217508916, 0x89d816e3efccd171,
-    0xea8314449612a664, 0xf3afd7b04e3e9dcd, 0x0265cf8252d368bc, 0xd9b9f2c5b09ab82e, 0x1be9d93315e7e8e8, 0x4e263044ea592f12, 0x4390a239830f4ecf, 0x55c249d481ef6a4c,
-    0xb263e1e7553222ef, 0x11ea971a5642c42c, 0x7894d600bebd1abb, 0xdd6fb6941031338f, 0x29568a2c0c94d52d, 0x01315555449edeb9, 0xb8a03366e13184df, 0xaafa5d4593a6277d,
-    0x066b638835960be2, 0xf5215adaeb2e42da, 0x020ebe86ab18e836, 0x1999e5c85d17cc7c, 0xf2d3af28af6c1437, 0x168c7ecd2b437f59, 0xeb96f37a2f474f63, 0x9de6b71e12e31189
+#define SM2_COMB_TEETH      8                       // scalar bits combined into one table index
+#define SM2_COMB_SPACING    32                      // distance between two teeth, 256 / SM2_COMB_TEETH
+#define SM2_COMB_BLOCKS     2                       // tables, each one shifted by SM2_COMB_COLUMNS bits
+#define SM2_COMB_COLUMNS    (SM2_COMB_SPACING / SM2_COMB_BLOCKS)
+#define SM2_COMB_POINTS     (1 << SM2_COMB_TEETH)
+
+/*
+ * Fixed-base comb table of the base point, two teeth blocks of 8 teeth spaced 32 bits apart.
+ * Entry 0 of each block stands for the point at infinity and is never added.
+ */
+static const uint64_t g_sm2CombTable[SM2_COMB_BLOCKS][SM2_COMB_POINTS * 8] __attribute__((aligned(64))) = {
+    {
+        /* T0[b] = sum(b_i * 2^(32 * i) * G), b = b_7...b_0 */
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x715a4589334c74c7, 0x8fe30bbff2660be1, 0x5f9904466a39c994, 0x32c4ae2c1f198119, 0x02df32e52139f0a0, 0xd0a9877cc62a4740, 0x59bdcee36b692153, 0xbc3736a2f4f6779c,
+        0x68a88405ae53c1e9, 0x51e46707fd558656, 0x71e834cf86896c10, 0x3d251b54e10d581f, 0x1884d5b0eeb19032, 0xeeaf729853e526fe, 0x5931f6831a8d8c11, 0x87891d33fb98b4d8,
+        0x9ccadc0cc7137662, 0xde95862862d2d396, 0x800402f03d98de85, 0xce612cd896f93c8b, 0xf4c88bdbdf5173e4, 0x0a7fe65a9da02341, 0xa8d78c84d9de9583, 0x65f0cfe4e0b293e4,
+        0xe18bd546b5824517, 0x673891d791caa486, 0xba220b99df9f9a14, 0x95afbd1155c1da54, 0x8e4450eb334acdcb, 0xc3c7d1898a53f20d, 0x2eee750f4053017c, 0xe8a6d82c517388c2,
+        0xf81c8da9b99fba55, 0x137f6c6149feef6e, 0xcb129aa494da9ad4, 0x82a0f5407d123db6, 0xfdeca00772c4dbc9, 0xa961b58f0cf58373, 0xecacab94e973f9c3, 0xf12fa4696a22ca3f,
+        0xdfd668f4c6dc1720, 0xee865a31c193f7fa, 0xd4352eb15b2be432, 0x614a69956dfd6a98, 0xb4a63b00d1437dd0, 0x88cecce5f3f5237a, 0x26d294a77c04fb05, 0x43285ddcf5e5aa38,
+        0x0b883e4479d789bb, 0xeafa16b8ea7ea43c, 0xb55b6782c96f1140, 0x4f568be96b49deec, 0x2c64d5492ef85b87, 0x6d540fc834fe8e8d, 0x7a629aa5db19f457, 0xf863399ca269b357,
+        0x9047673fcac14893, 0xf5df5d83bfb58659, 0x0a6230c81642e71a, 0xef14b33800777791, 0xcf1e99afa3386fca, 0x7ace937791313d53, 0x36fe159b6dcd01bb, 0xc9bc50d02e2b960a,
+        0xb6c5aa384395c47f, 0x04aa7f617cc06e33, 0xa3629dca41a5f08a, 0x6e8ce3d7d68001e1, 0x474ccf8d58c278e4, 0xaa10146563ccd49c, 0x48dc53fb92abb636, 0x1cb7e5db7fc3ab29,
+        0x716e5a7ee12e162d, 0xbbf9bb2c62dd5a00, 0xca235ccb4144dd05, 0xbcb7de0f8f70520e, 0x981e8964947cb8eb, 0x53c7102ea04de08d, 0xe9076332afc6a10d, 0x93d90f776b58c35d,
+        0x84ebc043347034f4, 0x24495295b516f902, 0x3e9775ec220d9005, 0xec0fc9c8f253f9e8, 0x359e29296e386d31, 0xbbff37bf96dc32a7, 0x0439676f78d5b2b2, 0xbff5db8dc0db7847,
+        0xdd3bb9a7c42af68d, 0x3f47bb74465f3438, 0x0b17d08cec57e896, 0x07abd1687ee10580, 0x234404a98101f205, 0xfae58b1f58760e7a, 0x760a5cd6891ec9c1, 0x73b0dc5f629cfc40,
+        0x5b09e0f770d30954, 0x4aab5f8faa47ddd6, 0xcaf40b204be28dd5, 0x6bfae4088a4086ee, 0x15269dab58753c09, 0x8f0f52fd4156c564, 0x1935b5ea8704924c, 0x6bb02e99d584c5f4,
+        0xca427c145d610b01, 0x4a1c0c5754cb787b, 0xa083178914e0de20, 0x1c5f181172c23b84, 0xba7ac56350210040, 0xb55a8efe62907442, 0x9442c052fa7e0d32, 0x85d9a742256f695a,
+        0x4341d8cb4eedb279, 0xb049d022d01b4aaa, 0x98794350a5d715f1, 0xb3fd75af8798cfe5, 0x74a745009a0cd96a, 0x2436a9550d20ee4d, 0xbe0307e70671210e, 0x28bfb0b62fe7e74e,
+        0xeae3d9a9d13a42ed, 0x2b2308f6484e1b38, 0x3db7b24888c21f3a, 0xb692e5b574d55da9, 0xd186469de295e5ab, 0xdb61ac1773438e6d, 0x5a924f85544926f9, 0xa175051b0f3fb613,
+        0xa72d084f62c8d58b, 0xe3d6467deaf48fd7, 0x8fe75e5a128a56a7, 0xc0023fe7ff2b68bd, 0x64f67782316815f9, 0xb52b6d9b19a69cd2, 0x5d1ed6fa89cbbade, 0x796c910ee7f4ccdb,
+        0x29e0942157c4cbe9, 0x6d67b8adb7d36e0c, 0x064ccaa013f23fe3, 0x2534c955192c29db, 0xe789e2561ee62042, 0x531a27b88f99b330, 0xa4cc0410c2017331, 0x68ad39f556287ed2,
+        0x92d56fbeb93c6f72, 0x7bccd634ca81c183, 0x0e0558ba3df0400e, 0x34a8d9ee6bc3b19b, 0x59538d45848ea2a5, 0x76c7942639505d0d, 0x8936d8549c207cab, 0x3d1bebb13e5e4103,
+        0x1b2150c1c5f13015, 0xdaaba91b5d952c9b, 0x0e8cc24c3f546142, 0x75a34b243705f260, 0x77d195421cef1339, 0x636644aa0c3a0623, 0x4683df176eeb2444, 0x642ce3bd3535e74d,
+        0x4a59ac2c6e7ecc08, 0xaf2b71164f191d63, 0x3622a87fb284554f, 0xd9eb397b441e9cd0, 0xa66b8a4893b6a54d, 0x26fb89a40b4a663a, 0xafa87501eedfc9f4, 0xf3f000bc66f98108,
+        0xb5d730c14b31af29, 0xf9c013174bd7a760, 0x347bea17bee8a261, 0x650eacd1f6832d66, 0x9e76dd600760b80c, 0x2ab0cfdfbbcdd644, 0x284d45710a288879, 0x5e01f4d85f688934,
+        0x764020d43b9441f0, 0x4850e7c14a126e03, 0x534e7f3043ae553f, 0x4a2843f12c59f731, 0xce874c57e84a4647, 0x13284091cb3fab3c, 0xd2925483c63d8798, 0x1bdf5b6b0b9eeed3,
+        0xa3819d13b81ba7c6, 0x991f9daf871d6c8a, 0xf935998e26775472, 0xe19f7807c45e9988, 0xede44b2743a71ba8, 0x36af78bf46032fec, 0x4444dc719f3c32a4, 0x614d0e5fe7eb094e,
+        0xed062e33de86f001, 0x2fdc6424abfef281, 0xe124ae1c91d77dcb, 0x43526fd7c2a34880, 0xef532756071fdb3b, 0x0ca9741319465136, 0x678ce80e3b579c15, 0x628eb4a13407afe9,
+        0x16778fec878a8712, 0x102efd170d3d2909, 0xaa05692cf6530006, 0xf9155d944b5b868e, 0xd06b777241eca31b, 0x91df2f8c3a4a8b6d, 0xdc0ccf18f35cd923, 0xad9234205280d286,
+        0x48ef20a85e2bf8ca, 0x544fb1b636d36431, 0x5da07c3ff6055e44, 0x1cb475124f00d6a1, 0x8a06d515088f3440, 0x6cafd6a262a0bf48, 0xf0aea5ee0ec21bbd, 0x8c143fc18016f86c,
+        0xc402c4ac5c9771d8, 0xeddbab5e794c840f, 0xdb39642a99bd834e, 0x856986a74de70a0e, 0x44760906df50cf57, 0x40ef4ec621a42fdf, 0xe1bbc8c471d26285, 0x33f82396128cb19f,
+        0xdae29b30b5216e54, 0x357cb16d51ed1149, 0x1e5ff7c3eaf6673e, 0xb94738f3f8d44d7d, 0x3a5a386e1b9e8ec7, 0x0734709c20c7ccb3, 0x36996e5e95e0bbf3, 0x2083adbd75f3216e,
+        0x330262136afe0067, 0x88922f87433df2e0, 0xe288ccb805d88704, 0x039fef564b387f47, 0x862f4934fa8784d3, 0x83e33014e4b662d7, 0xc9b0efe1618904dd, 0x9f3496f43e88e79c,
+        0xc538c5aa28b704e2, 0xe1d0987c7063f413, 0x2bd01a7821c19083, 0x33101889a4245b2c, 0x9347b781c46976c8, 0xbd79a442fd5c6a1d, 0x908ef218244c5e65, 0x0f7b104755b7a55c,
+        0x834dbff6678337ee, 0xc607e811fef0785a, 0xaaefc62be30a298b, 0xeb5ca335326afad3, 0x9774fe1384af54a8, 0xca4b6ef5785388b4, 0x1346c82d66f6c642, 0xedcc0c2aaa2d53ce,
+        0x4fd62ae52bb0896b, 0xacad1a4126e3e8c7, 0x65454d98132626ac, 0x29eaa241c9597579, 0xa12918310349f4b1, 0x3c253a198a1fd3f8, 0xb26f06e6831af575, 0x5e5031e4c9a29197,
+        0xb896b3f764b9e6f4, 0x47e4018c736fb3d0, 0xfc2fc86707413920, 0x1a8526428e1aeae7, 0x1386802650e2ae60, 0x7474dedc995384d0, 0x2c4cc396dd43b011, 0x63b0e9c7141de1b0,
+        0x2ee8a6a2e4828096, 0x6ca8ad1588a8e416, 0x5312674c01d86d26, 0xdf00476d240383eb, 0x3509c80b64d2a040, 0xc876e9274b3626d3, 0x03ef7fafcef4fb11, 0x4711848b1f105a77,
+        0x92a7b8b7d66fbaed, 0xc6d256f67390bc00, 0x72cd4676f7e34353, 0xda1f3528d55e6f0f, 0x891900cc6604933d, 0xe28867ab1c0fef56, 0x80d952ded5a75cda, 0x8b7b7bdc866238fd,
+        0x2320719a811ecce2, 0xc82f0c2637267b29, 0x94bd32409fe84081, 0x1102548ee9132e78, 0xf79e5392e8cecc38, 0x772cb127e6028f77, 0x7aeae34054c2cb22, 0x4a36363c79e7b219,
+        0x4da69ae2394f0b63, 0xdf01d6761f562132, 0xc089495d1a953fa8, 0xf11a76a460c35e5f, 0x52256f34c8dcd4eb, 0xc3f3d97a8e4f175e, 0xb9100e2fc99ddcd7, 0x3a181307e1cac7ee,
+        0x3e1d51adca60e6d7, 0x3cbd5b79b7c9a5ef, 0xa4c01c4543e0088d, 0x0fa5501a124064ab, 0xa73dd7b2f908e389, 0x0c0be5ae4e259ad2, 0x886ee68eedcf9cb6, 0x67668a56b496be51,
+        0xeb5fb3b369d17771, 0x1fe07b18933ed257, 0xdfc4c81ce3673912, 0x913614c66a91a647, 0x18aee853c0ba877f, 0x03109c2deceff091, 0x8532307e7e4ee08c, 0xcef0791a6e6ce0bb,
+        0xc3a03ba670d11b35, 0x8e35225d83fbb8ce, 0x63ecd48de92dfcb3, 0xd4479e99d69873e8, 0x18f5ca2a010a9e31, 0x3740d822df6543ae, 0xf158afbd804dde02, 0x028e1a3da1989840,
+        0xf0e9f5d8057a4a0f, 0xbbf7f8b49f125aa9, 0x51e8fdd6283187c2, 0xe0997d4759d36298, 0x67ec3c5c6f4221c3, 0x3ea275dbc860722f, 0x152d01e23859f5e2, 0xfb57404312680f44,
+        0x29cd6f471f63bc4d, 0xa4ed0dde8744051b, 0x42558148dce07a62, 0x03b0ae2d21eec6f7, 0xda4b03279e12e1be, 0x29d96210b390f120, 0x3bbe1a2569d4527a, 0x52c219d917e26e57,
+        0x5584308342ea7e5e, 0x5e6f418f300ab4ae, 0x66c60dbea889e5dd, 0x9ed76cf5243c1aa7, 0x4991f7e89b195e45, 0x3987e69bc0c472c9, 0x2ba1bd82e3c65e68, 0x9e9fae1bb05ffc06,
+        0xf5b743a58c143356, 0x9fbeb5b6e7c86b38, 0x569f38a1384bcbbd, 0xaa41e0750b4c366f, 0xa0e34d5526a7f02d, 0xbf01fee642ae1435, 0x739011935e087531, 0xd287b6f4133e24dc,
+        0x12baac09cab775b6, 0x947d18cd8933556e, 0x47fedbdc79f2bbb0, 0x4b121bdacbe95172, 0xc3fb5ce9604979c4, 0x573d783427e25899, 0xfca5d28c8df58d02, 0xe19518efe3dfddc5,
+        0x2f61dc2b51d1d5f3, 0xea28bd74d5c52222, 0x7dae267a01d9b29c, 0x9d9f099205baabf2, 0x99395d984c9d4137, 0xac2b2f4e93f979c9, 0x0bda4cfb221aa78f, 0x094f2f525508874d,
+        0x7669dc76585d8165, 0xadc87dbd4327f633, 0xee0f82eeb4a6c076, 0x691d1c7d92845c7e, 0x1f27cc3178967dd6, 0x6a3bb8828fb29ce6, 0xdf999bc62ebf457c, 0x2fcb34479ce9e1e4,
+        0xd20248332ba414a7, 0xc9a96e5732ce28bd, 0x519d940ecf272f36, 0x5d58151d23334ce9, 0x0603389f156d09a7, 0x9b69383e6c142f56, 0x9a1c6788c8a9c64c, 0x548613a39a9b7405,
+        0xdfeee917b1b37eba, 0x8d58e0b06e9eefec, 0x5b5fbb0455f521e1, 0x513c32d2cf14066f, 0xf532738bb1eeb40e, 0xde11b13d9150db1f, 0xb5ddabcbc94671d3, 0xb7e36bfcef42300d,
+        0xaf8b299c8d8a1684, 0x8b2d491ab4a7af3f, 0xf2767bd96809bb42, 0xc89a516e0c56a209, 0xe1f54be1755b4454, 0xb81786fa9f32108c, 0xa58642a57a0064b5, 0xad561cc32b1e649f,
+        0xa54f141343ad34ee, 0xbe56533001de03f0, 0xf274a55537f95416, 0xbe7ab23d78a39bee, 0xa52bf7ffdac8833c, 0x6a59682b0bdbb0bf, 0x3254807f1cecdd22, 0x5d4820fab9bf166a,
+        0xe5a68f17e18ff341, 0x4a0cd880ce8cf5b2, 0x66b4262f39468da0, 0xbf5e88e92ba69e23, 0x7fb59304600b0f69, 0xacf2c9117d686d36, 0x5c15b0914549435e, 0xe6d86c5266d74ace,
+        0x3315972e17876af1, 0x72a9a42d0b4dfbcf, 0x0c8601411d7803b8, 0x05baa8443708cdaf, 0x8e5e548cff2f0e46, 0x0ebf89e0bdd2fa71, 0x64fb26da7b33d292, 0x15b9e5b70a239bcd,
+        0x7ebc83c5f950e800, 0xbfcecf41087189c9, 0x302bf48e31dd2100, 0x568d259efdb0f88b, 0x868e48cbd1e2f7e2, 0x0c439aab04a71396, 0x04c5c119bbcaede6, 0xb5a2ecfb65e33518,
+        0xc8fc9409a42edfa1, 0x6c4c4b302e7c59e8, 0xcbbd90dcfa5689f0, 0xa46adbd78629777b, 0x0d70fa9a219a9771, 0x149cc61714393768, 0x04689d6e96c84295, 0x0be4c2f9768e191d,
+        0x4633b8a3c484aca1, 0x51f1f49afa639f7a, 0xb503f454bc693e96, 0x7ab2d4b57fd2f1f6, 0xf5b3e2e6028bbbda, 0x143c9bc24d8ef62c, 0xc3cc8335d33c75bf, 0x0691e240f49914fc,
+        0x7eca4b38ebadc6a8, 0x18dac0fc03b72aaa, 0x99a109cfd2d4ddd2, 0x3540c82f21402682, 0x48e7a313eb8f47a3, 0x5041576ccb496f43, 0xc76f7cb8a32c2456, 0x6524d3dfc62bdb87,
+        0x0be612ea1f639355, 0x23ac6c7e8193089a, 0x1ccd7679af3c0d64, 0xbc4a699f16bad77e, 0x96f3284b3776f76d, 0xaa7a0a81e5fb1d8d, 0xea63dedc797a935b, 0xa7e18ff9d605b5e2,
+        0xd85d0160a96727f0, 0x4e2e06a8e96408cd, 0xef7bb7951214ef13, 0x6f22fc97a31cb454, 0xe5f1fbbc0d9cb025, 0x27ecf7d690e75ccb, 0x2c0ab8efbf109f45, 0xa347377d860894d1,
+        0x8bd476b44be7c37e, 0x82dcb3399ac58eca, 0xa8c7ace916370a95, 0xaffe101477355eaf, 0x6f74fee3651009ff, 0x73e35bed7758c929, 0x886495f5e7c19aa6, 0x76ce82058adc3642,
+        0xd0b7ea16f734f5ac, 0xa9573d1ad976d910, 0x1f2c6af04f4995fb, 0x7a68bbece27b0474, 0x65e2e481425543a0, 0x660a4edc6d1c1f67, 0xfafda5ca8378e324, 0xbee38536cbc541c3,
+        0x8e91cf3c2b1fde04, 0x92faf00d1884339a, 0x30d1c37fef6071de, 0x7d03478959bee5e2, 0x409885236723f496, 0x0acf3936da0ff200, 0x4c4822f1db282569, 0x6d51008287a9b7f6,
+        0xad8bc68ce031d616, 0x16888d8ee4003187, 0x44c0757f3bb8b600, 0x793fae7af0164245, 0x210cd042973f333b, 0x08666ff52dbd25f9, 0x65c5b129f5f7ad5d, 0xe03d7a8d19b3219a,
+        0xd68bfbace0e00392, 0x261014f7d3445dc7, 0xd9f46b2714a071ee, 0x1b200af30810b682, 0x0d91d8b12ae69bcd, 0x74a08f17bf8cd981, 0xd822913cf0d2b82d, 0x248b7af0b05bfad2,
+        0x9214afb9f699347b, 0xfd7e39d972ec9510, 0x3eff5579b46137b0, 0x2e5f3201e84ed214, 0x157b4430f7e56618, 0x9b9affb48699d23b, 0xf08d012cba39e192, 0x88bb3ae5468d78f1,
+        0x34ab12d9892d7872, 0x0f9be833edd809a7, 0x7fb201bd23a97f7c, 0x69fc7cacf8eccaaf, 0x6bc9b52fca91aa64, 0x191ef071362b2303, 0xd7f5890fa6263a1e, 0x19b270e22fea172f,
+        0xba119a049e62f2e2, 0xf278e8a34df05ae5, 0xd269f3564eb5d180, 0x8e74ad0f4f957cb1, 0x112ff4dabd76e2dd, 0x91373f20630fdb7f, 0xf43eab474992904c, 0x55a5ccc7af3b6db4,
+        0x5ad104a8bdd23de9, 0xf5a9e515eb71c2c1, 0x390542a0ba95c174, 0x4c55fb20426491bf, 0x91525735ef626289, 0xd2ed977f88f09635, 0xfd48731b7a8a8521, 0x08f89a03b8fdebea,
+        0xa2e46efcfbb0556e, 0x2d3205579dcbef64, 0x1a316e95c586b5d2, 0x85c557dac1d9eb54, 0x8f2d7ae6ec181372, 0xf0d6866e2982cb9f, 0x8348a6dda00bfa0f, 0xa6c41df42e8b5ef3,
+        0x1f7cab4cfeac041d, 0x0c0f6a3087ebe0b8, 0x04995fc8ff5b2c2c, 0x790bc56092d7dd28, 0xfae96b9419a73113, 0x264622bd005da0d6, 0x1628e0bd7a82dd56, 0xd262373b9a0532d5,
+        0xc5a4799d59941f20, 0xdacb7ddd10e06591, 0xe07d87dcd4a67f6f, 0xd3ebf591c389ce89, 0xc858ef1764dda2a5, 0xae2f1dad23b25894, 0x4013602d02075d0c, 0x378433aa28e1b805,
+        0xb290a4ad22d611c2, 0xb4e02c00976746a9, 0xf7e6308f12111bd8, 0x6628fddeb33f8a7a, 0xce6503b3e9a60cb6, 0x282c15173ab1a183, 0xbee5b7f1ce0d426e, 0x4d495d4fa227d823,
+        0x07617afe04f0156c, 0x1340f0884292177c, 0x3fdf8d06577c0701, 0x1480c1edbc672792, 0xc695c8158889fd4c, 0x6a1c06526ac20d1e, 0x3b8ac9dc5cd353a1, 0x5acde46167777821,
+        0x03c54b0e0e1c607f, 0xb05d7bd5375e7b30, 0x0be93af830efeb1c, 0x48ed232cd2f642b7, 0xbc0e0ce5a5b43760, 0xcc22e056e0f1619a, 0xf52f2b34e1592f60, 0x645eed28ace4470c,
+        0xfe6a6d5ab3c389b7, 0x1bf95b2002513417, 0x73ca18e316895ded, 0x1eac8276a441556e, 0xf5ce65dfaf3ec4fb, 0xbadb9b15c088f0c0, 0x507d8b861cab189e, 0xad1c3793730543ef,
+        0x97ba52bafe445720, 0x1b15b3a94a5512a5, 0xe8eb5567f687a34c, 0x2e48dedf6d63cd9c, 0xe48445c97755a1b5, 0x696a4b15e57b541e, 0xadc1c879da8d8739, 0x9a2d0a60348f7d54,
+        0x12e93dc1b42f2ccb, 0x52b86f3e0a76a4e7, 0x380bb9f9b4081e3b, 0x754da7b9c5da7370, 0xf8c66e3b43db048f, 0xc33e5d0821be9c43, 0x0730367c806f5eb5, 0xe1d7f4a96e9a4eb5,
+        0x010d49cb468d9071, 0xbb12bb3e47374a85, 0xe8a2ab093da27913, 0x7c1d3c9f4e5ea8ce, 0xbc9d6bf341176f99, 0x7f390ba18ad5487b, 0x1947409ea6d33ef2, 0xf417bb56fd29de8c,
+        0x7e8e61ea35eb8e2e, 0x1bb2700db98a762c, 0xd81ea23b7738c17c, 0xf9def2a46dba26a3, 0x183a7912d05e329f, 0x34664a0896ccde0e, 0x56c22652614283bb, 0x91692899d5ff0513,
+        0x449d48d8f3bdbe19, 0xab95de03cc8510cb, 0xaef159463f8bfb25, 0xda72c379dae3ca8b, 0xcba9315ce82cc3ea, 0x4e524bac38a58020, 0x36ba2752538e348c, 0xb170d0da75ed450f,
+        0x126708fabb64a8e4, 0xca8dee955b705e51, 0xd8705b6dae33ba97, 0xd45f84f8e2106d96, 0xec4a9f5caf48e9ee, 0x21fac8cd037fc0e5, 0x31b324f2f4a5ffb5, 0xa2a376aa659a7eae,
+        0xe2c066286aa01567, 0x1597ab97f3165027, 0x0949b35c84cb4fcf, 0xa8f61b90807534c3, 0x95da841f7f9e7dbd, 0x1ad31c37b88fa5aa, 0xfbde005d7433cf59, 0xf893bbd808e02c7f,
+        0x947af0f52b4f8da6, 0x7eda17d917827976, 0x5ba79a0c705853a0, 0xa5d9873b3fb2ddc7, 0xc2a48162a5fd9ce9, 0x80ee8ae526f25f02, 0xf60c8ef6633be6a9, 0xe2e23f0229a84a35,
+        0xbc4945bd86bb6afb, 0x237eb711eba46fee, 0x7c1db58b7b86eb33, 0xd94eb728273b3ac7, 0xbe1717e59568d0a4, 0x4a6067cc45f70212, 0x19b32eb5afc2fb17, 0xbe3c1e7ac3ac9d3c,
+        0x6edb43c9756b4d34, 0xc067c1c6fe6e4ff9, 0x6d0ac52fac8dfcbc, 0x8d6204490ce5c085, 0xdb8843d019cffd25, 0xe593944eb343c2a1, 0x3bcf897c7365c615, 0x34e5566fa2e7658b,
+        0xae92f6586292ce09, 0xf4c1ef9d749c915e, 0xe7c9001facdbb21e, 0x62ca4e6a1475fff8, 0x7f1a19fd8f2ca8ca, 0xfdb0369e13105c1b, 0x7e3a98cb7b9c8b1f, 0x2a3e20d26a439254,
+        0x482c446b69aff7ad, 0x1e1fab8c3bf599ee, 0xae06b6ac816b6d3c, 0x0e8cd9b6e298f98f, 0xd9f070dba71f9bb3, 0x5f344ea0572f0b39, 0x421982f0b8d3ad4d, 0x7eca09103f87ae23,
+        0x6afc58a155ce435c, 0x565a34a1cf92afe5, 0x2b847edcf4b9d17b, 0xe4490b64b6fbf219, 0xf127ace080fad24f, 0xba92fd6738b331a3, 0xd8a1e6a52e2dcca4, 0x79dff87ec6428bd7,
+        0xf1f9be2be964a097, 0x055381bd83b47d9e, 0x0ac0a09b8acb813f, 0xa83684318409c3de, 0x6e9670926139b8a4, 0x514e4429a974f7de, 0x8375f77510dd73a8, 0x2b85525883c6b59a,
+        0x16bedc3f748056b4, 0x9442cd9cf67355be, 0x014f06e2d0eaa028, 0x0e86a8dbcb197690, 0xea665b641722ae0c, 0x6ea702074973efa8, 0xd8582893b7f5e902, 0xf76343c12887c32c,
+        0x8fdc4be8ff72fa79, 0x8adc191b5ed0157c, 0x8b8b48fe06be31cf, 0x9c968088ca616cd9, 0x725b600c215d8c27, 0xd4542a5ea1c1cb91, 0x7ef64d4a2c7279fa, 0xbc5f0f1ff0b65450,
+        0x31b9528b5d7fca4a, 0xe0911df11747abe8, 0xa259e5671a878e37, 0x0243489a6830c21a, 0x9501cbc25f29be0b, 0x3e382358b589c768, 0x294a9c538f800ad4, 0xc2b14f300f5a5421,
+        0x186f7d42dc4be255, 0x01eb0b2e47911153, 0x85761e88894478fe, 0x509ed814b2f39bf1, 0xafc07d25ba57ee85, 0x1c4e6978908ac450, 0x60575d15aee61368, 0xb396e8b10fe4f934,
+        0xbdb7069d306e6b15, 0x09cd8fb80203ef87, 0x9127a5f9b57b4200, 0xd111ef65a3817cc2, 0xb8669b5616dff9f0, 0x34012ca6396283ce, 0x0a3279edd4a052d6, 0x3b08b60c18285ca4,
+        0x9d16507fd41fb440, 0x8dbbc7b85cc6d511, 0x55a2be75dba5e138, 0x6df5da89f8acaa6e, 0xd7b31575f412f84d, 0xa2cebffcacfd3d37, 0x2af85dd72115791a, 0xdf299b1f0ee7e720,
+        0x03383bea266695e0, 0x2794e9a6e0950b7e, 0xd321fed41b74fb82, 0x5f427de782db9a64, 0x2fd11656c362ee9b, 0xea2489a1ad32f4e6, 0xc18f3e22cd6b3f89, 0xe3b7db917875ab01,
+        0x0355687eabd62399, 0xc33ce886561faaf9, 0xc27061c04a51d495, 0x03b65312d99aa379, 0x8dd282be60547029, 0x7e0a6a06f0287ac8, 0xe0dbce26df46445e, 0x26b6b1d468d75740,
+        0xe67d1d7c42d104e0, 0x1ba6cb0688405265, 0x52176e71355fb9ce, 0x8001e3c3fd51788d, 0x366427da1bfadcbf, 0xdceaea92dbf729c8, 0x2bea2189baf7e5cd, 0x4892fdd981292a63,
+        0xef5205a6c8b72623, 0xab51b8099f8100cb, 0x3e2bf9fafebb87db, 0x2684c0f2dbf0ba93, 0xfa7e56beb7b84243, 0xa6a4d1ee02512542, 0xcff74e7c9528c976, 0xf5db9719c5160fc9,
+        0x87fc872c35fdbb49, 0xb19e4b929b65d38f, 0x01bbd9fd5b905563, 0xca65811671a53685, 0x667ebee9b911cc7c, 0xa12fecc732bf87bf, 0x9780368a0923db82, 0x83847a45ecb89c44,
+        0xf4d993047e34a4c9, 0x8bce762b47a8e664, 0xf08cdf3fd5fc936d, 0x35ac92b11c750b56, 0x7cae21380dd7f6ba, 0xb91490ee4ccf7418, 0x24754d4ec4c9e2cf, 0x51b39d203194a92c,
+        0x94429bf398645d71, 0x72411d0e16ec93c4, 0xb225077c765315aa, 0x6bf5ae31ef03d6bc, 0x47f9aa4b0ca8bcdf, 0xddec7082d59e53a1, 0x1412eaba88cc6667, 0x7a35241837bbbee0,
+        0x3dddeed1107b56ae, 0x924333cd66fdd7b5, 0x21e94497ce8427fb, 0xed1403de12730fef, 0xb0658cec25b832e4, 0x9871b9e57708fceb, 0x7bf53233d66bcf6d, 0x2761d0a89f0db0b9,
+        0x29704b758c39e914, 0x5fb4fb1732eee7f6, 0x33a575ea9e2ade22, 0x806c8c1364da60c6, 0x90418298d62af1ae, 0x6a3dcfab8d5781ce, 0x04e3e8e0cc8c428e, 0x1a69dd9487dd6da6,
+        0xd9ccf487e8718076, 0xaf63b2ac25d9cd1a, 0x28f4cfaa703d309e, 0xebd26897e67b9c3d, 0x95bf8a283c2770e2, 0x140ce60d93718bf7, 0xb7dd0ce9710feb38, 0xd4f4df2cf7a15f5e,
+        0x0c30447fcbf379ee, 0x5c7ec5e3ab450698, 0xb7c38d873e580277, 0xc84d66fb0adc6b1f, 0xc43b3de89989050a, 0x44c07236ee3b0a5e, 0x588b3f705c239d80, 0x1781d95674be867c,
+        0x86e287a4f5edd26d, 0x9282b0bedb5b6642, 0xd52ace8eef481cd7, 0x2726576976a09214, 0x956e6648e90d2a73, 0x883e5b5af22a950f, 0x5014cf531f9be2ec, 0x12d6922697bcde6c,
+        0xdf554426372c98f8, 0x5cf8827436097a44, 0x86847240b07b08f8, 0xe41fcc4c8b39885a, 0x0b0695346bf488d1, 0x166ccf85717acf3d, 0xe15be3405da70170, 0x5f1ec3217af0b353,
+        0x5659e10eaec72d82, 0x6f34de282cb75e67, 0xfad6e4330bc260ee, 0x6ccf12864cc24950, 0xa8b53ce0d068ef20, 0x06b33801064e8e9b, 0xc0efdde6b0d17744, 0x29dcb53d999a02b5,
+        0x1ccc49e4d49374cf, 0x2e54138ef894689e, 0x2c7814f519ff77d4, 0x8a5c12c471601037, 0xd81a3943f9f90500, 0x47d7672ad04c5548, 0xd67dca4d72aba3b1, 0xc80846b6c070666e,
+        0x282fc9b0c3b363a3, 0x4eef9e128941373c, 0x8eca95766a8e643a, 0xf3d6011b170a9a24, 0xe63c3567809db39a, 0xea5f5dc51db0b230, 0x3bbdd2587a30c56e, 0xd72104ce8ed312c8,
+        0x6c110b602e5474bf, 0xc4208166185349ae, 0x744169ecbf24ff71, 0x9455edf6c9040b80, 0x12e0c5a2d948f29f, 0x7369ef55b3eb35e6, 0x9182daa475fb1f6c, 0xdcede25058b78d34,
+        0x4018093c3c6f4bf1, 0x378c629f8332c559, 0x4010763cd481a3ff, 0x4d7a156772f7db2e, 0x90d127bf7d2ebcdf, 0xc010ddd002250a16, 0x4030b6258412c839, 0x4d97a8a201ca1b95,
+        0xbd232e687224384c, 0x7d4d9e80cc0adac3, 0x1f4d29e006f85f20, 0xf9c4cf600325caa5, 0xd8ad32e396055828, 0xe579f3b3ac63aee2, 0x7ddd604d9b8fc244, 0x5254681f3fc88ce8,
+        0x5835a9bb5a1c2632, 0xbda6f5d58609eb60, 0x7bd358b4f28ebf80, 0xcc1af0d02538a421, 0xf0faf8b382da83bb, 0x6036e1981d62ffd5, 0x7ab4b812d799e2a6, 0xacc3212eba9778fb,
+        0x35627c5cc804d858, 0x6afcaaf099f4d6ca, 0xf51e93c1ab3cae9c, 0x774d2dcedc2ab5fb, 0x480105a9be84ee0c, 0x01a0baaac9d10c08, 0xf0a15ab70e060460, 0x7dfb1daa56edda80,
+        0x659e10aad68a6301, 0x315604d716fc7f72, 0xd0fd7856384c6c44, 0xe3d86f9b6cdb015e, 0xae0cc5a6a638dba5, 0xaa50d11bea9f2185, 0x449ac59e2bb00cd5, 0xea842d8203b831d1,
+        0xeca009d79caae031, 0xfefac396f975dc4b, 0xf2c9797615560eca, 0x4385bf43ec27a269, 0x5e1320bb1fdd39fd, 0xfaade51d012c2e51, 0x76f0a0f5ee32ad42, 0x8b604c3d3e58e67e,
+        0xeaf206877e0bac25, 0x6e4f5bbe2a152295, 0x9a30ef616f3fe3a3, 0x643b005f43aebd33, 0xdc8e406e41046ec5, 0x142c33914f62473f, 0x56a34a13e6d440f4, 0xa8922dfe3312d345,
+        0xf804b695d960f4f4, 0x3eedec4841ed3440, 0xcd2b059709158a54, 0x9c83ff17630e2339, 0x6c0dcc1e762c335a, 0x02f90978a3a5601e, 0xc0a8453a67a4ba1d, 0x09ee3349d37b5df3,
+        0xd4038805eb7db8ad, 0x0baabb1b390fe021, 0xa0e4f16ce39d0dac, 0xef9c007bac433913, 0x5e402fdab194221c, 0xf581a8ad3b4d3e9c, 0x1335b4b24c15032b, 0xce10dcc8fc77fa31,
+        0x382104b0b7e72514, 0x17e06b819567abc1, 0x4fdd6693d596df12, 0x12c7d51c476a7444, 0x589b30f71cf834f9, 0xc6310b50586d0466, 0x473f1bf39d869d9e, 0x173c04f2e7720a68,
+        0x9b18caad6a275164, 0x308f20344c9f7a32, 0xd021b89fb9a3384e, 0x0cae76e8a9f2b4b6, 0x3d18178274ab8581, 0x7ede8f57ea476c8b, 0x422e343a10a7e4e3, 0xc8b858a881c6261a,
+        0xf7a0e91e7af61cc7, 0x466868f423ae4d9b, 0x4d3f0f4c2f4a02a1, 0x8b0b8ef95409dc64, 0x3c8932477db53fbf, 0x14b4dbc9c7ab6fe6, 0x5814a5e178753f69, 0xc6852f549eb9087c,
+        0xdd86db0797b98a1a, 0x9ddaeb67d788fac8, 0x57c19c3f83edd2ce, 0x48cc27939e92bab8, 0xc16249bb8ce030db, 0xc7307a56665bbb2e, 0x25ff505fa27c4d35, 0x68c9d80c058f710c,
+        0xca96f2dc546f90ba, 0xfdcc45afcecacc2e, 0x577ff7beca323ca3, 0x0cc9680172cc7277, 0x8bd88d2e90178cc0, 0x2abab7de7aef3780, 0x959967bc24edf13e, 0x6a891dca45c71fcb,
+        0x21ac3df849be2a1f, 0x11006e9fc51d112f, 0x9151aa584775c857, 0x5159d218ba04a8d9, 0x98b7d1a925fd1866, 0x8f4753cafc2ad9d8, 0x8eb91ec1569c05a9, 0x4abbd1ae27e13f11,
+        0x0b84cf8b3c15e3eb, 0xe17f343d7b72a152, 0xde8ccd92a3a0d520, 0xf9913b59ccec12d4, 0xe60d3703a1beae6d, 0x8c75ce0b4bf452ff, 0x23efe3c19fddffc0, 0xdc0b7132eea03fc2,
+        0x616f6644b2c11f4c, 0x251cd7140e540758, 0xf927a40110f02017, 0x92ff3cc3c1c941b6, 0x3249906213f565fe, 0x4633e3ddeb9dbd4e, 0xea9a9d1ec402e6c2, 0xdc84ce34b14bb7cf,
+        0x0cfb5e52b7f84544, 0x584a7e66586a3a65, 0x1baac5c9bb296a5f, 0x3a39293519a49e50, 0x2241603f86dda9c4, 0x82593cdf8d72dada, 0x932f76452930a0f1, 0xd67a62ff8fda9806,
+        0x3c4c7ae5fc2b3100, 0xe5499db60c4a2fe6, 0xadd928516be495d6, 0x911fe7bcb82e069f, 0x5397d0f435929d33, 0xc809b5384d46bd88, 0x367ef5e8defd5011, 0x00fde6899bea1b7b,
+        0xe369b3eeae44a939, 0x980fa4d65e5deffe, 0xf18797a15a9abeaa, 0xf336411263e79e10, 0x76038cdd9368452c, 0x7ead24043d639c54, 0x175b2a028ee9e524, 0x70f0745c1bfe9e05,
+        0x40f3116d6523c813, 0xf43ccb3736b56b5f, 0x2a859b84b4def65e, 0x5f0ad155ba269dc8, 0x7831ecfa289a5c7b, 0x2bb92c450d800388, 0x8166bcc1ac541130, 0x1e70577d45669f90,
+        0x4c6b6f8f912a9c03, 0xf52f6dd6871f7ce4, 0xdd6e740a05fe24bb, 0xa3caf25456575ab3, 0xf6710316672540e8, 0x19aa3960d95f4423, 0x26bd4c7441251165, 0xf2d4fa6709139f5d,
+        0xa93e23e5436ff69a, 0x52dcb0a79b63efce, 0x34f6538a9e90cb41, 0x9cac08f200234bc0, 0x6661825b5174a02d, 0x07d4d06de036be57, 0x589d74610ae6bd27, 0xa296f5577fc91a93,
+        0x69ad8c656284f89e, 0xdc06f468424cc835, 0xb3061cd873ce20dc, 0xa65835fdc4952dc0, 0x882568f0ed32a868, 0xf19927612ca6697a, 0x24e2a3fb724d4a28, 0xb2f4982198006c19,
+        0x10acefa9d29721d0, 0x8b0f6b8bb5bcd340, 0x921d318c3d86785c, 0xd6916f3bc16aa378, 0x2a0d646a7ad84a0e, 0x7b93256c2fe7e97a, 0x5765e27626479e41, 0xae9da2272daaced3,
+        0x6444f54e1e18250b, 0x80d5b266e195e03e, 0x55b01b171d3315ea, 0x44b5d42cee4e1378, 0x3b7b98725b269c32, 0x399db501b628a68c, 0x5b496eb2f63bd0d5, 0xf0fde29bd2d5b842,
+        0x39b6033d3ff7b3f0, 0xd23ab74d776f437f, 0xa15fb9359f963b4b, 0xbbfe398102d8b9fa, 0x05010d6ccd8c8ab0, 0xced8b591bf6ed2fa, 0x8f176c8b876d4c53, 0xfd7eb8d6617767ce,
+        0xb8b75fb226d18dd9, 0x1a9a2d2a2b9f3c36, 0xde1d94e2b30e94a8, 0x4f03c4153368a8e0, 0xf0b10a6df2d34d47, 0x003c9a347bd2bc9e, 0xb5fb66c3f3c2f7f5, 0x82c9f11a451d6471,
+        0x78d364b03491842b, 0x995ed3d4dd73d72d, 0xcf37369c7dc52bbe, 0x76c641a287886092, 0x9fccb7cf503e2936, 0x18c2db4411304156, 0xb5a410ce08e5da1e, 0x18817987a8cc7a6d,
+        0xa11eb3195dd3abb7, 0x1a06314bf8f1a5ae, 0x483bb9fdf34c8639, 0x34dffd4b7762587d, 0x0c121391798ff1b2, 0xc731a68cb8945999, 0x0ad4fb058c6be44e, 0xdd170be937b33370,
+        0x3eb1d8380f63a7bb, 0xa1a008c6cd7f1d8d, 0xaa1e140bbe81dd88, 0x28189f43efa93bcd, 0xaddb5748c4035843, 0x32f4e5a5ecfd7f39, 0x8f292500778fd812, 0xdec93364f93b32eb,
+        0xb48d0393b4ad69f6, 0x334ac37ead903f16, 0xbaa0693ec536f19c, 0xfa8cc0afa71bf1f9, 0x9a2767f3e07fd4d7, 0x83cd785d739694ad, 0xb032c92550a9d27b, 0x233edc4c30b04002,
+        0x86eeca5f76c9dc18, 0xef1765d81b418ae0, 0x0cf514e4e5513f7b, 0x814e820e6ae37b2c, 0x48723281b57785c9, 0xb4dbcf8d93d74d2c, 0x7fd4473b448fe140, 0xd0fa4d1b95a731ce,
+        0xce26e01ca6a3576c, 0xd6ea7ae757e8e360, 0x9dd21d8f387e3655, 0x2219bcb41bb47b3c, 0x8103c6a772878af1, 0x2c3c169ab4828d3b, 0x753ff83ce7ea2d22, 0x5519cb8c3e6dbf85,
+        0xe80d21694b779179, 0x3654fcddc4ca4224, 0xf58f6c79d1ea8531, 0x94924c7489319947, 0x6c5055c1ee981779, 0xc9f6e98387acfab4, 0xc1bcbd33e9adb81f, 0xf0b067f6f60ab0fc,
+        0xf1ce9641ba684a75, 0x3cc9c68bbf4e511a, 0x2e7aaed26dea24e8, 0xb18c4f22bdb2f872, 0xa1f1343641ec7034, 0xd354adb77717de60, 0x6ed76af80b5d4028, 0xa27dee8414016959,
+        0x17b55dacff02d532, 0x8b164a8dc899647f, 0xc578bb1ea9c4cb88, 0x07f4878aff0686e7, 0xdcb890b6116eabe3, 0x1bec2a2199abd433, 0x5b4e102b61f23cb5, 0x74dd79705db47185,
+        0xd746f300ced3b5f3, 0x7cba8fb8a9c8dac5, 0x1dc1eaeae532969b, 0xe0061a215e485710, 0xa7c49069eba8cc77, 0x5f17543068534a68, 0xde0c170d839312a3, 0x7f3b2d4c684d3e7c,
+        0xebdd5e5e6e054e14, 0x0fb8524782c7a44b, 0xf88eb72dcc35a538, 0xee0ea74b4c305e26, 0xfe351f9f4b0cce8e, 0xa976970f880aee16, 0xdea512983423cbe5, 0xba468e5d8243bd08,
+        0x4a8611ddd27b0f48, 0x42b152401b2532c2, 0x5e7a3fd7774b8b4b, 0xb6171b961f0a45e2, 0x1b8c84a3ae3ee9ea, 0x92dfe312470a216a, 0x4f8e49d479a6d4a2, 0xc0f92f2be42516eb,
+        0xd3a5357c3ff429df, 0x0d38a545b963e2bc, 0xcdd947064aacb4fd, 0xccb9b76bd8d107de, 0x98684cf252602015, 0x7d0d119cc5f348f2, 0x365da9f50cb9b46d, 0xdd8aabc43be69919,
+        0xd723db37657052a1, 0x742b709d2dbe49a5, 0xfc1754515cdf4849, 0x742ecb2929f64694, 0xbd7b346545e62ffb, 0xaa65d0365e3efa14, 0xff5b90d7661bf3bd, 0xdcdd610ff75fe4b3,
+        0x3ab69bfc8c10d1f2, 0x497610f1f1bc0adb, 0x922ac73064a192e3, 0xd85281c12afd11f2, 0x27d5ede4bcce6923, 0x70d7403693c07b13, 0x782467f6836900ff, 0x4d669cd7c2e49c55,
+        0x7ba76b3247a5e33c, 0xee45a51995b1c045, 0xeca9c62c20c8918c, 0x81bdc2df08548570, 0xf58ab32241fb94e4, 0x3fd2655c4e438c1e, 0x275461134e3b72a3, 0xaec8a205d9dfbd00,
+        0xa257a89f5546a0ed, 0xc6cf2b150580c39a, 0x8d324dc33a88bf90, 0x4cd32e0e4b96abc7, 0x843399e9cd1799a5, 0x099aa4c3a4bc2ac3, 0x1d17e88227008a0a, 0x6f15fa8da0a2247d,
+        0x4455389929b3a4af, 0x8d78ad093150cdab, 0x26f5ad06829269b9, 0x26f0138a586c157c, 0x56b4bfe01c97e052, 0x72800e53c2d77142, 0x3b81e4040a35d51d, 0xf80494bdeac90887,
+        0x56fdc215f7f34ac5, 0xebcb4ff2da3877d3, 0x1eb96792aba6b832, 0x807ce6bea24741aa, 0xff1c10109c721fb4, 0xd187d4bc796353a7, 0x7639ae749af2d303, 0xaff6d783d56c9286,
+        0x042473ba1c3f1a04, 0x3b610f60c3eff9da, 0x0552767d2a9f8a33, 0x403b4c82cedec76c, 0xc2331671c983b58d, 0x27437fd70cd657c8, 0x259178e6003e02da, 0x3ee8a84d0f67e4d4,
+        0x6002d51b6290dd01, 0xcba3ab0099a836a5, 0x71776611e00d2528, 0xfaf2cb8c87fce119, 0xd445228bdf6882ae, 0xcbbfade17cbce919, 0x837b6335a2eb2453, 0x11ad7c4b8597f6b6,
+        0xe9ab3f8d8ef3455a, 0x526076c752b02ca2, 0x13cc306a5e4912ff, 0x638b6cc94bde8cad, 0xcccbe4366ce394d4, 0x06e6bfa63b1b1c72, 0xcc2b902053a89a9b, 0x588a1a7e6d54339e,
+        0x497791c31112fee8, 0xf0d6f8f6b379de56, 0x0572d501528a4b8a, 0x01080fbb0182673d, 0x3382712416dddbc9, 0xf17561e789b88ae4, 0xf5041c76b67c9111, 0x2b37ddddcbc57441,
+        0x488b6e30735094e1, 0xf591aae3a723e185, 0xe4711f05467b24bc, 0x97ed80e5b66be9e9, 0xe561349a009a5143, 0x502ad2c3388c97c2, 0xb3df7164b734c50b, 0x9953310aea0d22cd,
+        0x05a8138dc850f20b, 0xc5b512e71a057147, 0x2e91e143b483664b, 0xbefaa93c33d20d01, 0x4875948891aaa8c2, 0x7c783fc843ff64c0, 0x2aeb9c38a710a7d3, 0xb779e8675ad81625,
+        0x4a182986ce806e5b, 0x8f15e4b0979b0ac6, 0x39e9271e19708e46, 0xda9d2a3f73a3b33c, 0xb490b7d012549b5f, 0xd0e3ddf1adc5dd73, 0xbb31dfeda2132f2e, 0xd2bef496fd13a116,
+        0x48de8f368cf2e399, 0x7ae3d25630a74277, 0xdef1a9a6c505323f, 0xe55f203b4b8d9672, 0xc58d8f0d9a1e6e97, 0xe160e6d4b2737a76, 0xd60bd087d47cbdd8, 0x687d41364d5fef53,
+        0x4b2044574fa85580, 0x43ae71c7fb35cbf6, 0x583f9212be54414f, 0x16b58cad95746079, 0xbed56d1233e81d16, 0x5fab2d99453004a2, 0xb691c2d9222eabdc, 0x60ac8954c4cb460e,
+        0x83f21bbe056bbf9b, 0x4c2a9d120b4ba5ab, 0xff383d1845b64e4f, 0x8f13cc8d06dd7867, 0xf3a292d8424f0995, 0xfd2546eae7cbe44b, 0x67d14dee6c1e75a3, 0x53b49e6cc93fb5a8,
+        0x05d3f89f31696297, 0x99c373c7c1468063, 0x534d6861a9965427, 0x82891655b9280f0c, 0x515fb0a1e9ef77ca, 0xb3c7ac09a9896482, 0xfe48ee16128faf44, 0x01aa37dc500883d8,
+        0xf4766919ee03668a, 0x727c4dd3c3902a0f, 0x5b002722e5265106, 0xcb20350188b1d7f9, 0x163bc673f35e5ff0, 0xc37ff34c99e7a55c, 0x8395d6df860f2443, 0xed679c85aa464a39,
+        0x1c135a690cf49cb0, 0xd4e42bde9eb797d0, 0x2109025b76119b48, 0x36e616269c45055d, 0xa4356f191b369c7b, 0x3fa25bf0f2063fda, 0xef6e1d8a08728eab, 0x5a9ba9d3807ba046,
+        0xfd4291870ccb4046, 0x2e55465821af9f4a, 0xa9361102ace820ab, 0xda2abd989d82f567, 0x0008d3c59e964840, 0x65d7aadfc824370c, 0xc4a02c01d1d99970, 0x843a3838b7f4d6fe,
+        0x481c4f241522eb47, 0x70a7863e117f683b, 0x429866c21150d097, 0xf01411aa8058527e, 0x4254a30d22b918d3, 0x986aa010173caac7, 0x0ed3c0889a9a60d7, 0xdcb10f50260b324e,
+        0xc3478c77c8957b9c, 0x65bd705ad4430ead, 0xc6a6881b04557a93, 0x84993f4a31e25099, 0xeb6128b35236ad28, 0x05460c222418364c, 0x3f1fe366a9e2efed, 0x056bb3fd3a3eae45,
+        0xc953a86684b34178, 0x557d480e4c19325a, 0xa66b44925c113193, 0x2ac6b84aa907082a, 0xa33ba7b2dde27516, 0x3310b1209be876d0, 0xcbd2c5dd5a663490, 0x16f466fa8f391cae,
+        0x5e01012cde1fa11c, 0xb345a85202a85607, 0x0ac159a51cd139ce, 0xe8735376905ef702, 0x2eec9bd365fc7f70, 0x72d9bf50f781e1c9, 0xff0282fdc4a33cd7, 0x8aa45ae6ee91c5c8,
+        0x83d3a10704fa64a4, 0x19f5357b2f6263c2, 0xca81ad18d028b8a3, 0x447887dbd4b59386, 0xf3e0509f7ff5cdfe, 0xc5d664af7f96bc37, 0x27d921cfa81eedd9, 0x7fa913d8b4821605,
+        0x7235c4d5e7932ec1, 0x983a5d5cc5c92c01, 0x4fc96b3901a246c9, 0x9538a7091d06ef89, 0xb0a7b85435d474b8, 0x39878b377cc2b39c, 0x4940d96d766f98c7, 0xc9972cb173a8b1b9,
+        0xdfdbd6afbb9a2d16, 0xf2d8bfebd5eb546a, 0xfd8f38d12d10a36e, 0x0f7189c45e3bc9f9, 0xeca41351e03794da, 0xbe7acf9dd3625e89, 0xd29dc435fd1fbb01, 0xe64fc14f764209d3,
+        0x0292d48064ccdad2, 0x955996fd6280fe0c, 0x76418a79ef886b71, 0xcd91871e54f6cf8f, 0x55197c84060d0515, 0x33afd3af42f8472a, 0x58a773130ed0a6ad, 0x45c7a947c2c5f344,
+        0xb69081b978c28ff0, 0x2b1ecb59f883789a, 0xf4241ef024a84151, 0x906acc8af06c9ddf, 0xa2614fd7ccb31d0f, 0x60b0c2e993a7949c, 0xeb1378ad8d8ea9ec, 0x750dc902eae93d12,
+        0xac0e34fb194184b3, 0x7160bbb0f12e9e5f, 0xdbdfbf4604cf91c0, 0x1c00718cbfceba6f, 0x1f96e2a67cd0f133, 0x1f69c9d6526f946e, 0x8afc0d69d48bb81f, 0xf7fb6e7ab0e6c0e4,
+        0x0cf271b513d268a0, 0xef657354d91b7334, 0xfd4e9c72c8042b28, 0xa6b3ce7cd3afb8e3, 0xcfc15c521f4a6b72, 0x79c0b765cca69b1f, 0xbab591c178f73936, 0xecf84f51eb8ea31b,
+        0x30e034684d862541, 0x424aaa6d774c97fd, 0x583e9269021d5ed5, 0x66e871756ee139fa, 0x71f962431ca5d3bf, 0x896a3aa1fda508dd, 0x3ca3a8b286640dd1, 0x5f76ee9f0adaf7d5,
+        0xebe6e92480a99b23, 0xa3a4a8e172b67311, 0x788e3289c44989bd, 0x6bdda633ca6a8442, 0xf7a13679f48797e9, 0x671e4557ac27668a, 0x9fda0bffa5961a03, 0x5cfa4040cca65c77,
+        0x7c86016a267850c8, 0x5cb566f2139f9eab, 0x3bac64fa40a23ccb, 0x401d78c71b770223, 0x1bdc7332f13c63a8, 0x733773a3c3984ed3, 0xa973667de7d492ea, 0x87867986f347e820,
+        0x6a2d0e6e37c86295, 0xe03142236bad0935, 0xc5d2a7ab45dbee72, 0x30900639cbc4edbb, 0x75ced4651f86ec15, 0x8288bcf4252f051e, 0xc65ac0d4b7d6b023, 0x457fc24fe93342a7,
+        0x4de7001046e18a1b, 0xc73b722aa96404e5, 0xdcb78bf38f1e2440, 0xcd5fe016606ea750, 0x1f75c212a2961dca, 0x9736e9eb3d1c1bea, 0x6d0249009769609d, 0xc61fda4d5e954bfe,
+        0x8eaea37897158298, 0x22212083c4b64349, 0x18658b7a00145d94, 0x27e4b2dc0719adb2, 0x853a9d2dbededfc7, 0xc5adb003d4c1416f, 0xa24f135f31925f6c, 0x0baae558eaa1833c,
+        0x28a92880147b21aa, 0xd25f074c9880b826, 0xf9b9376970a24a03, 0x85b96e1de16bf3ab, 0xf9620410f8a5bd1e, 0xd7d8b4b25ba29314, 0x6d85b572cd8aaa14, 0x7b558f0d71368f79,
+        0x7fc1fc6e892a7df5, 0x48521f301b03655f, 0xe1748e35c2b248e3, 0xb7f1b17686f8baef, 0x9f6576c9a5785e5f, 0xbfd4736f1bc9855e, 0x201f396edfbf0a49, 0xadeb5eaad444044b,
+        0x28fc58fbaccd23a0, 0x90273ee62b8308d5, 0xa9034487f1d6d6c3, 0xc1d4772f718a8fe2, 0xd51457a745ffec1f, 0xdf2f845820542ae9, 0x0f73f0b9cfffb3fc, 0x829fb41d028979d0,
+        0x9189e86419606ed6, 0x083b82c81075bac0, 0xea0553dd727682dc, 0xc593c51d7e85b82f, 0x5c4db7dffbebdcd4, 0x279d5f2b9de5aba9, 0xa4e9da43b3aa0e4a, 0xc221a862e2628923,
+        0x3e6dbc64531cd97d, 0x9c2130d48b606087, 0xbbf16d92238f9a2f, 0x16930544a78d6e75, 0x678cab7ab4daab5a, 0x1ede58ae857f5612, 0x6d39c61054475002, 0xdc78410634c03a9d,
+        0x4227630965c20a56, 0xffb486e2efbd13ef, 0x2e4998361741fa89, 0x131075641efe8092, 0xc4dbd7af3d4c8c8d, 0x3e9ffd6cbe88ea44, 0x2e409ace978b380a, 0x0e66a47381bfab45,
+        0xbcbbfcb70b73949c, 0xe4013f62f3aed2e6, 0x61a35046da45b11f, 0x8565daae91585f9a, 0xcc201e80d977a8f2, 0x3f8bed121bb00d69, 0x76bd23b263259569, 0x27856ad1b51a2ab3,
+        0xa461dc94e625f05d, 0x926fd728db72295b, 0x00029255c4ec6cbd, 0x8c94c3f96e2e47f7, 0x1a0d2e06a21fc893, 0xc4d7ac39aeb3996e, 0x494c6f9ee39d7de7, 0x4414355d92c9a96a,
+        0x26eaf160f16b42e8, 0x0eaeef861cdf079c, 0xa872007e5af81c8e, 0x77a9d8741d1a390a, 0xf227463d90bbd446, 0xa6817b8055e9b0a1, 0x97ef7210b645b601, 0xadc4b274ab334e65,
+        0xf841654966ca0fff, 0x577933d3027077ed, 0x31fdc4f326516bc4, 0x463905acf58b3f6e, 0x0a6b34be1f466b44, 0xb37864c8aad848ca, 0x65a837b20dbc5ea6, 0xb852be418dbfb053,
+        0x9be097a235afd56f, 0x71df5ccb492467b0, 0x630816da88376670, 0x9bc748a300594031, 0x8e9f1be89f2ea12f, 0xbf9ff95a00ffc778, 0x52625a5c6c4eba16, 0xda620004d9f4115d,
+        0x36130a9f34d4589f, 0xa4336f2f05a129f5, 0x24292e93c4faf62e, 0x5d4f60d66ca50a1b, 0x1ea3867ea00472b8, 0xfd56692d94c0ccc9, 0xbb963829fa278467, 0xe9a01947e7029d9c,
+        0xe50f1e40b077974a, 0x9172b4e04e0cdc90, 0xb11826e880049f6c, 0x8b8b062fe0797ccb, 0x63b4862c5e0c2f24, 0x28965ed730efbf11, 0xb5f12fd0ceab595b, 0xdda327cd9d32c007,
+        0x5161ab23dfefb80f, 0xdc38d0d331bbc4dd, 0xa835dd4e77bbe5ca, 0x9764d04486821f77, 0x839179e06a26d50e, 0x43cc5219af06bc76, 0xe8c36ec58ac45817, 0xbc553304188628f1,
+        0xc601531e2ce47729, 0x791b574c82274e2f, 0x84bba64f3668ec30, 0x38c4760fdb4c1e40, 0x57d84905870dadf4, 0x0d5effdcef51f125, 0x512f6eaf4a9ed4d1, 0xd98d224670843b67,
+        0xe7d0d5f543b69177, 0xbc9166e24936fbaa, 0x5bcc3bc23b082b01, 0x5cf272381124d31f, 0x74ee3c56accab8e6, 0x86ad83cf70a7515d, 0xd164d7da4ac810c0, 0xccbfbace50d59853,
+        0xd4ce3e1ef26a3220, 0x075155d327b06d7a, 0x48793b5c03fc60aa, 0xd51f689d420b59d1, 0xd99de1f6e875241b, 0x93415d03968e1b3b, 0x0b579fa4f9a47e57, 0xe20557c7b20985fb,
+        0xb0a2b47ce56cfad9, 0x524f75a86fc3beff, 0x7d3cef05534135b1, 0xeb5f7b22bec8a799, 0x2ba8b6271f7d5eb1, 0x5cf70107442995e0, 0xa4e46f375a3a05c4, 0x95196ff44dec7088,
+        0xfa4e049a5f088c8e, 0xaa2bef5aa19cab4d, 0xf197687633717eee, 0x59a30de392c1f79f, 0xf8c202417be98154, 0xcfa7fd443be5100d, 0x7276b01a4b6a4283, 0x68f4308693f50fbe,
+        0xf3832c8ba6caa032, 0xc19f09b0f649f2ae, 0xeb2a29cb377cb31c, 0x6aa715f2aec38faa, 0x5841fde2df18db8a, 0x0264635c2218f798, 0x364a29b9f2490e21, 0x414f854028c3bdfa,
+        0x8252bac21401c4ef, 0x9569707520060764, 0x8eb8f15fe4c6b9a9, 0x542fe28522f2f2fe, 0x8e71b42964f6e1c6, 0x30071454cc9d7167, 0x5b8dfcb31b5c3db3, 0xd42bdf58f5fb1654,
+        0x35553b99ae185d5c, 0xd5f8f25790ae5380, 0xb49fd302b639b532, 0xcd907a4386ccda03, 0x2d636517a7f006c6, 0xe3b00775889accaf, 0xa0dfdb18b22a36d5, 0x77c7a813087151b9,
+        0x55c7dc8355ac1f92, 0x7f70ffa9c26a5407, 0x51036e3bf4bf9b0f, 0x5cb45e0f2558e29d, 0x721b34f0fe1415d8, 0xc9c8269ab4b5c905, 0x32bbc29ec9b29e00, 0x56e417cbc045a611,
+        0x52aceddc97a9106d, 0x1caffa6c2ba2596a, 0x17168466e18f18cd, 0x107e23b64a156dc2, 0xc4f30c3eb2bd9d72, 0x913839fc0a3c2c79, 0x18943c5b04a324bf, 0xc163abf20497017e,
+        0x08d02d8bc382fbcc, 0xe8380ec22a5d7174, 0x7ba087be0a2458e2, 0x847dcdfbd620d7ae, 0x117fc67c6d0a4e93, 0xd761d842b09ec474, 0x394f6d0ed49f4fe9, 0x1c9f8bc77a2eb469,
+        0x83c851439db942e3, 0xf7844fede3358f5a, 0x8483059e4a650f2d, 0x14a63c9fc085d39a, 0xac6c7536962f27c1, 0xf9419ff57e4cf01d, 0x46e82d67376baa75, 0x51f556f699fb05a2,
+        0x63d9073854bf8787, 0x1f1e04fe117bf553, 0xee31b1ce984b0d5c, 0xdd1fbbdd03f8d302, 0xd8c923c6719a0b8d, 0xa158d35eec1419b5, 0x9288d365ddfb5571, 0xf66196d91f6de0d7,
+        0x2e553eda1d99d75c, 0xda9e88c24f6f50bd, 0x08df297f8bd9bcc3, 0x8390842827f91a05, 0xe35ff5613240544e, 0xeebad27a1a221d79, 0x1979da5a3a4a6f42, 0x5ea3d6f9257017e6,
+        0xde67510a60e30072, 0xe6fc2e90bad19a3e, 0x7747661a148238f2, 0xf104efdcd09bc593, 0xb584248eb38c6ad6, 0x54947e0bc4875eb3, 0x564ee785747528bd, 0x1b0dbe5c1b75c7c4,
+        0x17b37ecc24e992a9, 0x7d581d1d460ea4e8, 0xc9a63846ee0eb75d, 0x6a13e254717c6b00, 0xe9c6ab211d1aba2f, 0xa2da2d6b3091eb7a, 0x104c6010c2df5582, 0x0b92aafde3fc0635,
+        0x15dc4f0eb38704a0, 0x11eb6b5693541ba4, 0x4c28e176fbbe1583, 0x58baf421a27abbff, 0xb79460ecb03c1bb4, 0xb9269f932b7abd93, 0x874e21965039bf7c, 0xc8c2396d8a1958fc,
+        0x3156debd6e163953, 0x30e9012e0bb0c3dc, 0x0a0df36e00531454, 0xc07442524a257493, 0x66261e9025af8e3f, 0x5bc6bf866a797a04, 0x7c2ecb7ff63d1c91, 0xe2c0b51eeca7083a,
+        0xc9b548fd15bc58ae, 0x5566593cb84cfe40, 0x79c134916e49ee81, 0xddcf73bd5c48b38c, 0x2897de0bc3c1ba9e, 0xd6817a2a236c0a45, 0x8c1e5f6671434d64, 0xa439cc29b6594a6a,
+        0xeab2127f3669b8f6, 0x8c10dc4dc0629ac6, 0xd272bd323a48e14b, 0x8d58ee891b2a1a2c, 0x74da096fd294d84f, 0xa42859cd053a11bd, 0x3b8afbb2d3b2b93a, 0x4dd012a835142b2a,
+        0xc72efd8893f1ba6a, 0x38721ae2502cb0da, 0x924c0df038e7cb89, 0x821f100c7d2aba73, 0xcd34b0ace8af5dcb, 0x1aa87094fb3d76bc, 0xf04f30aa88b702d1, 0xb7fe37d1df0a86b0,
+        0x8c3c5be440bb46c9, 0xee86430d376cca22, 0x78050e0d3e0f3d41, 0x8282fba3470f1191, 0x714d5eb975ca2af5, 0xa25eb98422a7d949, 0x70b5099174d06685, 0xbeb69c8f065774b5,
+        0xb8885b99af2e7936, 0x2f8e92e14ca26596, 0x3cfb11407666ff03, 0x237242f663b10e06, 0x6febbe6eaa072bff, 0x707c81093e890225, 0xf9e8cfbad72b52db, 0xc7c94b7687169fcd,
+        0x517d427ee344e27a, 0x793579e72885d6a8, 0x8b3121a8c3bff422, 0xb521be8cb97afc48, 0xad91a09cce031db0, 0x107d340a47afff92, 0x723d82ae8675689c, 0x2138bb15f45978bb,
+        0x55ff1b6132a77d5a, 0x883cfd3bdea1dba7, 0x73e3040706e50be8, 0x05444afc06c6c3a5, 0xddd578d5dd5d34f9, 0x4ab64354f647223e, 0xa3365711213f6f6c, 0x247d826a82c3c064,
+        0xb58c4c7462785b83, 0x13e97abe6ff2685e, 0x70046c5ed8b70808, 0xae2f94e21d95f28b, 0xddd4d93d2b001f1c, 0xac42ef6af4950033, 0xce5da176169c6076, 0xda20913f168b62fc,
+        0xd83e3abb93e72444, 0xa22bc04a7bc81903, 0x3f24951fc1cdb3b9, 0x1137f79800bd4fbc, 0x8afdefa6ffbfe816, 0x15d0692ec202bbc3, 0x152171c51dab21ff, 0xd67297a0141dc4cf,
+        0xd46e988441440656, 0xd73470cc81c0c996, 0x4fbd325ae5d252d0, 0x45be67eb1c43d483, 0x1e2f6875f4776680, 0xacf5456878029197, 0xc0d820055b6a94b4, 0xcf2798d0e89ba871,
+        0x8cf9bfce872afc66, 0xb80800a70d551246, 0x1c5cb2aa41340e5c, 0x62284b12376d8572, 0x63f06c00d2ff22a5, 0x516b62aac11cca0f, 0xcfc9b7da292a7a96, 0x2c58d6183be7363b,
+        0x14951687eb1b918c, 0x0309d487412aca40, 0x4b48d57ecc705ca4, 0xfc6ccb8d368f32c6, 0x6df5302a1262f645, 0x599796c83fef32ff, 0x890c305cf43c9fa1, 0x38c299b4f3f7283c,
+        0x2c9f8bdfc38da2e7, 0x51426d807d4c35b3, 0x79f7513f1ad4c947, 0x2cb78001f7373eb7, 0x2004b1ac6af15040, 0xcd3996dccca996e1, 0x388e8862635ae474, 0xb52b60d4d860bf6c,
+        0x706a4c12bb875374, 0x866e168fc38e452c, 0x0f17ee5183c63171, 0xe4e6fd994d0d779f, 0x2f5a86556ae6664d, 0xf253fe5ba06325e8, 0x46076d8916506520, 0x9a8b802e320af0b0,
+        0x8570e1f78f9e43b4, 0x88a2dee3d1b8a977, 0x9059e994a122e597, 0x9208110c654ce3c7, 0xee42d2cfd189de7d, 0x344bb031408a01b5, 0xf637d62b27ed794d, 0x316776f60ee22169,
+        0x4710e954bc7ba3b3, 0x54dd31709b8efd0d, 0xa6a690449793814a, 0x369527d55e400fed, 0xc99beac6f7519b4f, 0x9556674616a5de35, 0x857f8db616b358f2, 0xab2072212910680d,
+        0xb38c2e0ffc8d99bd, 0xb4989740f251da42, 0x18d922b967b97724, 0x7715541b2a9619ae, 0x5d6314b6e2bb3099, 0xfa8884d3999dea9c, 0x230f994f94ee0725, 0x959addd90acdff7d,
+        0x465d814485d56e0a, 0x0c9e6f7da0862e58, 0x783b0dff3cb4c0de, 0x71ae8023e5826d13, 0xb912cd7b06907a2b, 0xd33b2b7ad7fe0714, 0xc3f799a3a4ee5327, 0x92b2f4cdb57e0df1,
+        0xd322c60297b3fdc7, 0xa663bb6dd61c2ce1, 0xaf862351a3961176, 0xa8024cbb76158fbd, 0x38deb50f6f1819ed, 0xc7a52c143d0be459, 0x438cd04e28f29d00, 0xd76257a166e388a6,
+        0xe5382db407485d4c, 0x8f04ace9c93aac37, 0xd8598d0cf44e0a33, 0xf160f66c8b343d1d, 0xc2d9956cfd76f691, 0x343aff63cee86124, 0x5095a1f8645badd0, 0x3a22a5631490e14f,
+        0x796de920a725288e, 0xdcd816cf6d7e3043, 0x34daa93b8462653d, 0xdbe62139babc5d82, 0xd728ab3203a5df50, 0x9e5263cf88028abb, 0x614196f0dd10874b, 0x7411b3c520936362,
+        0x1acbe546d53eb925, 0x3420657fbba89344, 0x20f87ec7937ca7fe, 0x1e9e0e599c70594e, 0x2201cd98317d1bcb, 0xec2a0f857376937a, 0xc351bbe218ef17a1, 0x652ac7773c3d3eb6,
+        0x3cdba0b05a05de8e, 0xd72bd41d224fb532, 0x4f768b539835b2d3, 0x5acf9cf474f7c05b, 0x35acf3d30607d375, 0x42f387d8c7d747f3, 0x4c5ef2a1c78d45d0, 0x2c26a8c90806eae0,
+        0xd6f60b439995434d, 0x8aff4bcd82963f03, 0x73f248253ae49d79, 0xa07e8d9f5102befd, 0x09faa9c80e146be8, 0xe2218656f6104ad8, 0x618826d3c94137c5, 0x6f81395ab6662642,
+        0xcc14ac8190d913df, 0x0ef70dcd111aadfe, 0x5b04b72a229a7839, 0xe65dc7c72a6016ed, 0xabbe5f77fc15c519, 0x36d428049501fe15, 0x9dd1cb42c1ed640d, 0x6d397c8dac284962,
+        0x094c5d4dbc428094, 0xbfee65628d8fd9aa, 0xea52296bcc4f2153, 0x07e36e4c40cceeac, 0xed9372c12eaa546c, 0xc455f7fcc36af3e3, 0x007298d404a1e861, 0x7dc209f9fb1d2fa9,
+        0xc429f9372a4bcb3c, 0x773771412fb0ca86, 0x039343899f2865e1, 0x5d2fe63fe19031c8, 0x61496ba49114ecb1, 0x5f022f2699da788b, 0x4f525921c78ef440, 0x2edfb2de0121a28e,
+        0xe3e55f692adb70e4, 0x1e9dad3834a0b088, 0xef7f72627736a21e, 0x0b66cd928f7a7776, 0x08cec1b8a33b8644, 0x9adf4c49ad515bad, 0x2d9103dc01fdd5e3, 0x171ae4d02bcf1425,
+        0x06736c50043d80bb, 0x3144eba5743d952d, 0x7b483a39be6c6402, 0x45dc7e1117675fcd, 0x467ab81663c1de24, 0xfe3f270dda2650a6, 0xc087a92ab4ad10a9, 0x6d2379d0209b32a4,
+        0xe8da5098a18ffca7, 0xe3599246ad0100e8, 0xa5d02af6dabf9c10, 0x2659953d5a600837, 0xc6359f5540a2772d, 0xd0f231cbc990a80d, 0xb7d3656560133147, 0x186a12a29a3ea641,
+        0x993bde31b43f8e16, 0x00c31fbbfab5f37e, 0xee30650741ae55c2, 0x17792eb6d23c7d7c, 0x7896f6e74da44527, 0xc8d0a04a35f527cf, 0x986ec61f619005f8, 0xf1cc4d8f433f6a34,
+        0xb88ba04b73ae839b, 0xcf6014e99ed55a82, 0x190a1f205b31793f, 0xba94123c7c180823, 0x9af0238d57b90bae, 0x46d9f3f6037c2394, 0xd06aee987f38cd43, 0xfb3bfd4e77676741
+    },
+    {
+        /* T1[b] = 2^16 * sum(b_i * 2^(32 * i) * G), b = b_7...b_0 */
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x312d5ca67482d023, 0xb3541bd290bed320, 0xb118be112c2b8c73, 0x39d99bbf92f69b5b, 0x2b875a20cc7cbe33, 0x7f37974671487294, 0x2994db86931d3726, 0xa9c3cd42271b243c,
+        0x46b305b199233b13, 0x8a1ba49ed975a8b7, 0x4aca364f2fee77c0, 0xda471191557e63aa, 0xf5ea671c9e1c93d6, 0xec2cf231021f3291, 0xeb1c1908821111aa, 0xae1c9039f3f894c5,
+        0x276f024cba352193, 0x3a77ea8525c28d10, 0x5aba393d1c384fc6, 0x0c6e80b1c7f2c462, 0x04ec7b8634c965f3, 0x906658aaa2541fde, 0x1423279b41f5e5da, 0xaf7b75cca0cc2878,
+        0x92ec9fcbc11d186f, 0xa82acf836455f395, 0x141a0d74be00af09, 0xee6dffb61a7255a2, 0x6ea0ffd5c784268c, 0x0d75990fb8f5dd63, 0xeba0e4eec5f89aa0, 0x98d85a17a1e82ea9,
+        0xb225997e86752a81, 0x41de21bca25892f1, 0x1fda29b20fd00c61, 0xc4f4d568a57586f4, 0x7704a630ae3b0bea, 0x128702552126990f, 0xed1ff09dd5a7be14, 0x80655988305da103,
+        0xc2a83989c77517ea, 0xc507b78c2f784607, 0x14a3c7fe95683c41, 0x874944cc9f06664c, 0xbb69f78fc69f29f0, 0x33fd10e50590ec53, 0xc1af570b2a3f8ca9, 0x74e9149a6faf9ab0,
+        0xf9e58e3464f97a4e, 0x758d945065056f65, 0x26ff82553c21c89a, 0x8ddcba36a857b3d5, 0xf40d5eed48ea7dfe, 0xa70cbd2c6a7aaa9a, 0xab4f534ef68e4e6e, 0xb0e7cbf96c6d7ec1,
+        0x1e541c70512e770e, 0xf34cfca15ffcd925, 0xbf6badce03ce057d, 0xd328f255dfd4a0d3, 0xd440845886860fe3, 0x1845dc6fbea5d62f, 0xe44184dc9397c052, 0x421bd496560fcc71,
+        0x24c0f8c0810faae6, 0x4484dc79fc1c4f24, 0x8f57b892f47421ba, 0xd1780009a0666626, 0xa460722f3bead60a, 0xccf8fed6ee8d2743, 0x2e4a54755b1f517a, 0xbbaa60bef03cc019,
+        0x56fa4c385adb7e3f, 0xfc2f7533379027fd, 0xd39ccd5c72ece69a, 0xd73c8f663a31619a, 0x4da4c42477d2b6de, 0xd6c140af3b5bfa83, 0x95a290dd711a74fd, 0x5edb6bb2d4cabd9c,
+        0x2e0182300f241697, 0x8d6c8f13753fe2a5, 0x94c0418246ddec87, 0x656a2b95ff13cf98, 0x1becd77f8870ccb9, 0xab61fe7000833bc7, 0xee1dcf063250392e, 0x53893bffa4d4ac0f,
+        0xa4e11620e2877061, 0x3e92b39cce1a84fc, 0x2d2e1d413ce92b34, 0x3dc649b3c2a427dd, 0xa01159a9398bb799, 0xe64f3ea1005e8424, 0x4e5a02014fcf6d0b, 0x702aed6511712c6b,
+        0x834a722552f926ab, 0x591ed02d911e970a, 0xe0784efa01a6de1f, 0x90e8a72dbe000bc0, 0xac6ccf5056fb8d39, 0x9cdd040fa321c573, 0x225e16e3180f555f, 0xd2ab4119f68f49d9,
+        0x10e23316534049ad, 0xf4d94903325261c1, 0x4afbf14c2e65752c, 0xa138955fe503da93, 0x521790764f407359, 0xc3526f5c3f20860e, 0x01c2f16de6c96e85, 0xb212651241a84781,
+        0xec5f658dd15c68c1, 0xd05e07106d61571d, 0xa9cdccaa8c703000, 0x7ef1e6c3c84f81a7, 0x013a0390122dbe50, 0x498ba1548cd78d49, 0x8d89f9c3cb1adc3c, 0xb01c80d7578917a9,
+        0x792a5be3393fbf15, 0xe0b9865761cfdf77, 0x74f1c27eeb3cafe4, 0x77d193fef13edcb9, 0xe7f7c64cb420b8f8, 0x030a0480b9843eaf, 0x828c2d9d27fd1ef3, 0x8a354c4212ea5ff9,
+        0x9bb56be8cca4229f, 0x564d9bf1f18ae9e1, 0x05f6646f7c0fc7b7, 0xe09126405f762061, 0x072ea17974ca23f1, 0xa212288c91be1e53, 0x77bb35d6ada9cef1, 0xf3e406c0c76c34ab,
+        0x3e827271974d746d, 0x2a45e19dee064a9a, 0xb1370c3f06227abc, 0x1b5a9f422e788276, 0xf73b61c548d7d296, 0xc3ec1300c2f37e86, 0x3342178e29437f47, 0x10e3d91f73b4ddc5,
+        0xd4222e3c1af9c1bc, 0xb9afdd5f3d8e66bf, 0xfa5b73d5b72acba4, 0xa59e6e150edda7a9, 0xfbe89fcab89c801b, 0x9e648809fb89e173, 0x1edd3dca72560c19, 0x20033801cbb87168,
+        0x69866072d34a8989, 0x80b063df305e260a, 0xda7670473d6d24a5, 0x0986460dac282eec, 0xf91fdbf51286f15a, 0x1f9f3dfa4b11cf0b, 0x2549cca8ddfe7ec1, 0x98f1004dedf6811e,
+        0xae9840875cd22f44, 0xb799a5d2f7bfa035, 0x3e6f4ac7aaeca3e1, 0xeb860fb107c91236, 0xbbfb0b96ac977f02, 0xd7e7c36b105ccede, 0x1381b2fbdf87191e, 0x2299d23350970da0,
+        0xb9f3d8b9fdb8a3fc, 0xf93db82940e3e2d5, 0x1b057bcd2c6b1059, 0xb8507d8e2a026352, 0x077184319a31639c, 0x49ba36e08a676263, 0x807339ad0219bf50, 0xae8e80ae6e9d352e,
+        0x716c8d9ebb1d95ce, 0x5411739735f0b2a8, 0x0d35423254bcf359, 0x843ce7f8d04881a7, 0x0fb878583813c36e, 0x19eb62dc7367a956, 0x9104216e8627dddf, 0xeb25ef4d46bb9430,
+        0xb3405c956dfdf723, 0x4717220bf3944b9e, 0xe6c547fae23b8d01, 0xbc87a484259b551c, 0xafc414e077b1bf39, 0x9559ed9a5b343991, 0xb78f092c98194976, 0x7e5e6b74613685a4,
+        0x4137c286746062bd, 0xdc9cfdca49f5fe35, 0xf8864ae1df1e18e3, 0xe88abf8fba0ebf42, 0x3bdc5044da4cc298, 0x7bd200ce686399c5, 0x3151a55618831323, 0x5373286230abc1f8,
+        0x4f40d9c0ba95e34f, 0x5c7ab04dd270fb6d, 0x07fd9e3c48ccda90, 0x92b02682f81c688c, 0x30e7ff6f87124d6d, 0x93b37ed6aef2d35d, 0x04f07c71f7e3a0be, 0x24aafcf4be8819bd,
+        0x1dcc38b885ad4d48, 0x330828693efeb9ca, 0xfcc7b7fd91d99a88, 0xe4ac0ce7a6f080a3, 0x1545dc276d58324b, 0xeb90c52acbfe2939, 0xb87782ef6094032d, 0xd0ece55d30b6e59b,
+        0x8cd004c25f2baa29, 0xcc0e77a53ae84eff, 0x59ccdfab238fc283, 0x0727550f8283357e, 0xd927b45468ca53e2, 0x8d8a40b999052d1d, 0x6aeb98a90473f4e7, 0xc2ef2f52887e6a5d,
+        0x7cfba23f9a178b4e, 0x89fe706d2cbaee90, 0x0a453833a9301218, 0x7be06a525e73ef3e, 0x7db5338065f9cf33, 0x9ebf0fb50560b4ff, 0xe83922224bf2d5ed, 0x9e7fa0f3c0d2878d,
+        0x2d153f50dfe3f20d, 0xf894843e13b6cdd2, 0x422e3c32eb1451a2, 0xeff14bf6734dc50f, 0x17db6e2c5d6986f8, 0x61607ddec670da7e, 0xb32cfca293f6a4d7, 0x86ddd185d1920d62,
+        0x9b372df31270f495, 0x569fb6cee298fa2a, 0x00a44b2afa3b4f34, 0xad7ecd092cea5678, 0xd78d30c7a2b1ed43, 0xdcd4feb27d0fe709, 0xda65af14d08ed1b8, 0xce379a3fa894f379,
+        0xfe0c0696af16ea60, 0x67e04e815aca19e5, 0x506e57de98503ade, 0x4982dee131f9309f, 0x70622bf624c3a9fd, 0x373aba1de3f256b4, 0x7c5e8e1d2586fb41, 0xf2a2d3d383553c98,
+        0x4aca2437908d0be1, 0xf7601a14422ba3c8, 0x0b219bb61d7bea76, 0x97c1f9caf662d8b2, 0x58c44c25dc9a78f0, 0x7103a2d9eee012b6, 0x37fc8ebf142b5473, 0xc5b49837fe3f0e65,
+        0x4269d20e71835bab, 0x936f5321030c30e8, 0xc5600522f5a4ec0b, 0x0ef087cb92cae5a8, 0xf15847c6fa09cf4a, 0x8c79658c49eaeb60, 0x03214cf8de24ac44, 0x0fe31ff34e7f6cf3,
+        0xaf19d41c7d75e255, 0x871237ecaa7493b6, 0xc19e7ef52bd32a49, 0x00a7566617839064, 0x84f0c938e4a64c5f, 0xbbb1f2ef7bf0613c, 0xbd979573f7f26e53, 0x1d5e9d119b31d578,
+        0xa275d8f8d3681da4, 0xfb3c8814260fbc79, 0xbfdb17ba879588fd, 0x1df9f7d0cb4bb107, 0xd420ccb9a489ff3a, 0xc026ed66ccbdb7e1, 0x7229f79496f453bc, 0x7acd46e7914efebe,
+        0x90d997438aabaf83, 0x5c123547ef1db317, 0xea6c62722910c03f, 0x998cf85771632c55, 0xa6375f3395a5c239, 0xa4e4e4470d1c603a, 0xf6f023045ba6ff3f, 0x71d1d964581178fc,
+        0xb2890f9f8b41404d, 0x296088b874cf0e2d, 0x28bd9fcad7bac671, 0x6d76e1134f2ba1de, 0x0d239ef62e8e27d9, 0x2e1ce77ae3446ef8, 0xb52ff67de09ba2ed, 0x1d4b9a054fec55f0,
+        0x85cb9dee4bf48c06, 0xc2f2606ce94821ea, 0x29ee9cbfbc3188ec, 0xaf86c0000af3a42b, 0x6c3829cde41ee7b8, 0xb0fc5976a8965c03, 0x099e977ee3a25972, 0xd2973e5d4748deb6,
+        0xe453c959d0170386, 0x1d06c7152615e715, 0xc73d7246f1cb1da5, 0x0f0c3e4048b5cd14, 0x808706f700c8a33a, 0x3a0d23efd2c92711, 0xf5d8e02c00a153f1, 0xf9fd7ac0904e527c,
+        0xe22bc6f290586440, 0x655b3cbff9cf87b8, 0x9a0c9f190b4fa1c5, 0xc2a7cef2945aff35, 0x41dcd29db25b904c, 0xeee20339a32c7a21, 0xf36e064668b79403, 0xf281ec4abf8e633f,
+        0xa4a57c5922a6cfd9, 0x652ba15ae0bddbf4, 0xb57f8b422a669381, 0x1d11886c92341231, 0x1fdcf9ffb42f6ed3, 0x90c7e0985e910507, 0x2b65cc59d2149be5, 0x57913245ae22c27d,
+        0xb447bab0d17df043, 0xc2e9d09803c06a16, 0x056aa79a42f9bbcc, 0xb50b017921b06e09, 0x0843d98ee92b6038, 0xa56f37994591ccb3, 0x71cefbc3489fb6a8, 0x2f705a3a570d4691,
+        0x85cd2c2fcf0b6d9f, 0x72ab0baf36e9637c, 0x6c9e375b2201318c, 0x3ecd42d0d4e45417, 0x28d29dce09fb0f9c, 0x9988434ef817682a, 0x6a395bcc3e1d4ed5, 0x8bca9583bc5c83af,
+        0xdfce544ba2c0d483, 0x73f7195b126d635d, 0xaa144ba53d4600ef, 0xb3462e5366cb689c, 0xf6900eb27b9be816, 0x3a30a9014bf5fcf1, 0x0d7cf93878782796, 0x16a4632810aa788b,
+        0x294b4c6eb7ebbe57, 0x76eefa18651834c4, 0x42c119b7229c664c, 0x1dca3e3d73da345a, 0xbcccf6cb2eb589f0, 0xa5b7d1c9c87d9298, 0x813c32135661742c, 0x156db7cf231c5a5c,
+        0x20ffdd1c4cb01f71, 0xe1d06642864ecb19, 0xd6ca708ed51bfcca, 0x4f1b56a27e88e3c7, 0x9b7ff811a0e124fc, 0x58c68c8a1b0974c3, 0x6139392a8bab9849, 0xfb5827873368e8b1,
+        0x05426e3d85d9d46e, 0x370ae2335c774fa1, 0xadc2f3f99e332c39, 0x7caa69220b64f2af, 0xa7d6a5756b22e079, 0x4e417d715b9b0dfa, 0x7454a275c33e9339, 0x11ad91a0f2fa6d00,
+        0x0f52eed40d979424, 0x4723d3d3e4fffbe2, 0x811818e2dc6c2376, 0x7408d39f6a977273, 0x22bcdcf0dbfe9142, 0xd9191b2fbab94656, 0x3323fd1359b156ed, 0xfc0697adf9117a32,
+        0xdc416913bb3c19cf, 0xaa8db230b64ed46a, 0x798b1eba662f61a0, 0x9f3b9cc1562c77fc, 0x18fe3d31ff8112f1, 0x1e1369679b9d4cff, 0x5765c4df1f7cc04c, 0x2bbae1f57ed84e1e,
+        0x9f6078c2b8b0ba79, 0x0632c522438c679f, 0xf5a96e3754604e0e, 0xfe60e002643decbb, 0x74b731a05590223f, 0xcc05a48680b9fe9e, 0xc770a3b854436a94, 0xa2eddce858f67feb,
+        0x464b31c653ea0071, 0x17b8940cdb9accd9, 0x65bbdd2a5fbb67f3, 0x886858e897fcc081, 0xf423cd4552e93a79, 0xc75b2bd6457db21b, 0xe82afb8c41632b55, 0x054d5c42205fc070,
+        0x2f8fd098d2f69bb4, 0xae1cded2ede19ea1, 0xfadfe3f021aa6461, 0xdd6419221f9e55c5, 0x90d152f67915cec0, 0xeb9fd22a1359eb70, 0x772985c53242d672, 0xe6053605b955b37d,
+        0xb41605366cb6dd2e, 0xea155d12fd1c5697, 0x56dccb71e3028be8, 0xd006da52818a65c6, 0xddc69820f47b8d8d, 0x4995360539eb679b, 0x53e6c5fea9405256, 0xa0b7a2366f3900d4,
+        0x8fd55e0457d1de37, 0x62cf2f6dbf7e0f69, 0xe622ddd0c07ced8d, 0x7e3e30628ae35240, 0xa86c14d90f14eea0, 0x07af21f21b018b52, 0x7eadff8be0701e0f, 0xd5a3154e958e142f,
+        0xe8c0963d8410f335, 0x1512d9a70f53766d, 0x5765c6ac673d93ed, 0x8fcdcdf2fc6919d2, 0x4423e27de370545e, 0x414808b5a53de630, 0x54c8e278143f3f09, 0x16eeafc871512958,
+        0x28da616549a35511, 0x330e188a39795d0b, 0x44316f3e83f56731, 0xc671a35b6fb847f1, 0x255d251f22e9d33d, 0xffe7fb4e6f62442f, 0xb293b0eae20a56c7, 0x27615af4298177bc,
+        0x13bc00ff1bc99834, 0x135170608ef94544, 0x0fef30e553edd099, 0xb7f422cc60543a86, 0xb0116665b2880237, 0x6ac2b0b9f95ee21b, 0x3addac2592d343a1, 0x8b73de5daca683e8,
+        0xcfc1a289e72abef9, 0xaedd64b795bdae49, 0x5a9363d41c827b5f, 0xfdeda6a5fbe5aef9, 0xfdb47145c059007b, 0x18c3632f59c9192c, 0xce0a0003e08550ec, 0x0b091704c8cd6d8a,
+        0xdc9841561d921b85, 0x080a1172ac2a16ec, 0xe319829a50ef0e00, 0xfe39956f2704cff8, 0x9c3f8c4285919252, 0x23c9bb934f828294, 0x511a28bff6c12f4b, 0xa00a298585e0acfd,
+        0x90b54ed94934a86b, 0xc6f4d40d48a9201d, 0x894ef288f38bd8a2, 0xefb1e8aa8a678de6, 0x529dd5c9297be12e, 0xc2ac29b17f87a8fb, 0x2e3414fa90336413, 0x53b80bfe356caa22,
+        0x16efe452ff0d774a, 0x47ef6315211f6c57, 0xf9e833a59e12dae1, 0x618cf7e43774139c, 0xdc9da5329130f898, 0x20550fb37b4a8f1d, 0x8eb28c2dfe12a185, 0xa4bf69c0e4f1fcba,
+        0x2ea3cbd3d5f6904f, 0x6a373061e7f55c0f, 0x23dc3795cdd96dec, 0x04be12546caf7fa9, 0xd1674e2bfeab6da6, 0xcb23b9ed191b78a9, 0xf06b02a277ef2e1e, 0x1275b5fdcf5be726,
+        0x527bc06b69d3c6c3, 0x05498eba956c0576, 0x8af60ddc108e2cd7, 0x525cab2ffab7d9e4, 0x876279cb60382bbc, 0x35f80465ca2bea54, 0x1cb75708b47262b8, 0x454d184a787480a8,
+        0x0ba796091391c870, 0x0965c3d65454941c, 0x6e3612630af527eb, 0x5c59c347795881c4, 0xec55539a7a8b8b53, 0xd6609bf6310e3024, 0xa2263a1c6b3bb1aa, 0x01a763eda1060c35,
+        0x3c5042ffbdbc62e7, 0x6b8999b9da4090a0, 0xc36070718e2b339b, 0x3bc4875ba72832e5, 0x3f5808421b3e9edf, 0x1fe2c75af62e6181, 0x30fe5334408746d9, 0xadf5100557b7f025,
+        0x98bd7e3198a2b15f, 0xaf721f4f7d5c221b, 0xc6b607f4132a2e69, 0xea6d4a975f23698d, 0x853fdb99f2c5edaa, 0x29ae9e5ad7ace91e, 0xbc5937f4e59fc3f6, 0xce8e0d4644e293b9,
+        0x412eaefe05808527, 0xcd70a49e97f6a0fb, 0xdfc4ded3ea034012, 0xe457e2bc0be75657, 0x6f0129c73efba3d2, 0xbcda7cc174f696a9, 0xdbaecc8a8b91bac5, 0x1222fecf944585f1,
+        0x582977c80fe54bb4, 0x7e78749e2ff8522f, 0xc3a49c23444a4049, 0xce86432380787ea7, 0xa15c4b7aaa693a57, 0x53aea5d39818b89b, 0x73e26072742befb3, 0x0e32f673eb4eec2b,
+        0x10afdd8c518bc54d, 0xf13ee22587561c53, 0xedd6c1190e62398f, 0xe4ddc3e13b5fbdc8, 0xc2d346e8e17ac990, 0x6736acc09aea1cc7, 0xe1e0b9da356a6e7a, 0x0581c44ff4ce3603,
+        0xc1e3c526c79a46f7, 0xfc2b0e1faed551c8, 0xe4777bfa7bcc7da7, 0x65874fd393fa2e6b, 0xf066ee9b03421f49, 0xb455e82a685ad897, 0x81653d011cdea189, 0x81a78e79c5ff4e67,
+        0x005023a5e7abfee0, 0x5219af7739713038, 0x71358b2aeea78194, 0x44b055e8416a93d6, 0x89ff71b2058c6024, 0xf96bee39986525bd, 0x0887af8eefde8c7f, 0x304c6a29da20b555,
+        0x511fb8a18f9589fe, 0x3590acca8aea4ab0, 0xf86aaf27fce34cc0, 0x3cb7f603db94b27c, 0x1e50ad88a9b2d497, 0x6721fa7d5ef9956b, 0x98651317228d3fc5, 0x71b3aa7220e17ad8,
+        0xd1c92188bb54fb90, 0xf1c1288b1592acd2, 0x9b7aa56c2811cc39, 0x15b0a00cebef32fd, 0x0f01dcd901f60803, 0x792e058bbaa38176, 0x2c7a6ac4aaecd158, 0xc6476e39ea18a9ce,
+        0x2921952ed5cb116a, 0xf796e6db2d03aadd, 0xe256730a0d6aac7c, 0xd452ba8eb3efcb72, 0xad87c4604b1b2a20, 0xe2bd8b66a35db7cb, 0x62cb8ea21a20c908, 0x23721caa19a517c5,
+        0x69c6d6f281e450df, 0xc11c772aaab9066a, 0xad8fd0309783f960, 0xeea7a7b7b52d4bd3, 0xbe3221c06c38557c, 0x38d93e86e9e57ae2, 0x1adcb157ab1a44a2, 0xf26fedeb3ee89095,
+        0x8e0b2bfeaedea75d, 0xdf53b3460467df98, 0x7944da2d2a95a79d, 0xb5ea0c3efdd27d30, 0x91ec96a2df29053c, 0x5cc4b7f1bcd84058, 0x9b0963cad61e6d43, 0xf51e5d0428e3650c,
+        0x37cd7dc3dd28c665, 0x44c07e0474eb2734, 0x7f87a787a4ca2d19, 0x548a410a3a749127, 0x238e48e6fc5bfde1, 0xa5220d8c4403f6a7, 0xbf0be85d13423304, 0xa347494a93f1bc4d,
+        0x028acee4428cf311, 0x81bda0f7c6327369, 0xb32eb071443717db, 0x50de1b6abd68e191, 0x2c153a2ea5175559, 0xe73799bab7e4a048, 0xe2547f901000a982, 0xc522d43446372a86,
+        0x2881808d96d79f65, 0x3059269d3245be6b, 0xe9334c21a29a2a8c, 0x01ee45066091a2b6, 0x3f800c7e241de72b, 0x495b8d5a53186cb8, 0x135f1cea7ce7654c, 0x0e09b64b04ae7ca4,
+        0x521af30510aff6fa, 0x4aea7218cda3c9d6, 0x00e352f6cf0595e1, 0x3062a32b679975a6, 0x76f3ef519d1fab0f, 0x1aa3644773b226b2, 0xa3adda3ecd9b6a44, 0x2939c24a408bf6ba,
+        0x409927ec2ec72f1e, 0xffd119bf10d110f5, 0x12e85a00e512d287, 0x1738ad26b40fb7c0, 0xe8e2ac196298e0ba, 0x4ebcff50eae8ae64, 0xb2222719b48d462c, 0x5a472f91ab5bef4c,
+        0x8815299a666449ff, 0x65992e359a395b1d, 0x4385f41b2ab70d0e, 0xa06abda315e4999e, 0x1dac4c987b7e7c3e, 0xb84b22090b4dd208, 0x82d29c3434ad45d4, 0xa8c45a01d4ab8145,
+        0x0997a64a6bb8b566, 0xa4a1312c9744952f, 0x449c46a325105c8a, 0x77e5b3d971d1209c, 0x602742daab6baf40, 0x0aa198ce366712b8, 0x37a9911a4d60ea41, 0x67aa792a6cea647d,
+        0x955c4684f19721ab, 0x7410ec7312f31265, 0x1cf20cf27f2efff7, 0xd2d33bff97cb4dd8, 0x33caaf10de2d1444, 0x66086d21cf587a1f, 0xd5ea760064e01bc4, 0x742aa2cd7ad947be,
+        0x5286abbbfd9f19fa, 0xcf4ffc288617e993, 0xec5a7546c3658a08, 0x22e43c8f03a5529f, 0xb1efb8d3fff50fc6, 0xd544ba8e77489a55, 0x98b490d7bdbd29c3, 0xfc4e94a26e8bf523,
+        0x6c57b0783b4365bc, 0x198f6e3d3711af50, 0xb88131f6a372da95, 0x3c21e8620c82b6c4, 0x9a49cab2d065ad9a, 0x1bf14c01a345da2c, 0x7ce649e69365446a, 0x96c1cc7ee179022b,
+        0x1b4e6a2ee1bd5265, 0x2a7c6a11d457966d, 0xe00480fe833bc0d9, 0x8b2a4f4a32f1adc2, 0x971d8fa296bcc28b, 0xaa6659db9d95a60a, 0x4a20a3c94739b8e9, 0x5898164d57162756,
+        0x93630cfa38f8d1f7, 0x5cde4cb39fb7b887, 0x4b4781055f0fae7e, 0x2993d47be6e47559, 0x08743581c77ed237, 0x4ef11574ab37145e, 0x7d54f805f3646263, 0xcf3f18fb52dc3307,
+        0x9bb3450fb770b6b9, 0x484746f1bc436c7c, 0xc94f01adbdb53487, 0xe3bd726672ddbb45, 0x17b9d4a57e8d6fc7, 0x17d385153335890f, 0x7a9c7902c1a7406c, 0xe625e93bb7813170,
+        0xad905d9774009de1, 0x8ffd6d3b5d7b1b8e, 0xe411ecc52256f25a, 0xe9259be93629447d, 0x2066afb73edb3fae, 0xa06747b5baed6586, 0x3d549764d714a9c2, 0xe6a9bd628c1655f0,
+        0xd97dc3fff530e6d5, 0x2d7c56bb027a2bab, 0x1730dee8ca608b74, 0xbeeffe6d61fcee57, 0x8310bfc5dc415443, 0xc7751a5d0f828712, 0xcc84780a3d58b3c7, 0x45d2eb721620195d,
+        0x0d6b7bbac9c53b1c, 0x59efd40a8633c9b8, 0xde66c7d7293fbfb5, 0xb81d7657af5c8a0b, 0x6303974544001e48, 0xe7ba09d825a8af83, 0xc542d8ccb6de6352, 0xf77f88588d2dbcc9,
+        0xd337a2c01520029c, 0xf78c868d116001d3, 0xbb17298aab065a92, 0x675216766720f19e, 0x5f214ef81239a96a, 0xdb8526b58bba19f0, 0xacfbccf61769c5bd, 0xea910c634ed1aa51,
+        0xb5eba9e5e3fb0466, 0xd5f38613c4187db6, 0x75add0c962fd714d, 0xa3ee77c860f9822b, 0x78d94b5ac3e98581, 0xee31c6b9aab80445, 0x95059b9be60bd679, 0x3c2dfe44db8a2cdc,
+        0x487690dee6bf6016, 0x8151c26ceeff7c0f, 0xf2c911ded06ccb54, 0xdbe780b9f51763e6, 0xc1d45acda9789c0a, 0x9c3215834877d470, 0x0b3b7ebeaf3d5626, 0x6f8f5537c4bc508d,
+        0x58c7c67151ab14cc, 0x01ad41f62b1b92c8, 0xe27388746a1541fe, 0xa5087ab59d09375b, 0x6221a7dfeb072446, 0x66a1cec844e05008, 0xd7d729369f6f35bf, 0x31a0acb371328499,
+        0x283692c357190321, 0x95ac755c107991ab, 0xaa9592b37e349eb4, 0xb65d96fa185c6093, 0xb3a055bce6e17bc6, 0xe0eabc1626156925, 0xe8f57470df8f46ac, 0xfad3982ef8dad780,
+        0x5b31123e01438c08, 0xca4b7c472b71f105, 0x2954387a2866f51c, 0x1438399d9c35b272, 0xd6ca9694d7702b42, 0x18e1b416a2d40a4a, 0xa96da56e93bcfe8f, 0xe314bd2af7c5d797,
+        0x6b38f7b86e07251d, 0x3a47721534123768, 0x257a22cb27334fbf, 0x92036e4b7a69c499, 0xa734dcdc65fb1272, 0x866ae6ca9d534811, 0xdef9a764e5c34a31, 0x6edb667647e6eb26,
+        0x00e5ed91cc11f9be, 0xb56a905000d3c38d, 0xf57f296f9f67fda5, 0x6405428922dce516, 0x802c1e02d995b8ec, 0x0c8e3eba80d78f76, 0x5423449fb2ed754c, 0xf6a6ef4f50505a04,
+        0xb4e9b3036447467d, 0x973f6d450ad8a8b7, 0xc98f92339a935ee8, 0x82881793635bb05c, 0xffd3b77353fc0813, 0x07e7cebceb65c364, 0xe6a9ccb4b7128250, 0x994375e1d06c3e22,
+        0x69d36c6014781739, 0xd2598bc2330ccf92, 0x244f9041d1fb4961, 0x3c5579beb6b42528, 0xb7df2bb4f350ba53, 0x6f42e954093a49db, 0xbe40cfba03defc56, 0xe0b917eb588c1eb4,
+        0xba9fe8564f3a0b66, 0x49ef111805a8b226, 0x62905123c844cd63, 0x525380cfcc8290e6, 0x95924d368f1f2981, 0x56afeaf689abf7a9, 0xc2c47d236fd41b0f, 0xe933b5e3115e478a,
+        0x86d63eeadf867f7d, 0xb06d1671a746ec66, 0xad093fe29485fb97, 0xb0d3d4b0a56dd066, 0xc056494892488877, 0x80633545edf22df2, 0x6438ce49387306fa, 0x3a520513d82cc7cb,
+        0x93ca648acf1a1f1e, 0xad0a9ee16b3ec06a, 0xed4e8f712fc9c57a, 0x0829d6a5553dd30d, 0x95ea7e609fc924be, 0x411e93eb8fc415ff, 0x0b2872506754a912, 0x585b75d7a3c46f14,
+        0x3196ac816e9c2a86, 0x68e37bda9beaaf10, 0x2385887644a9300e, 0x263cf3427b70e506, 0x36d23daf49adf0f7, 0x249cb005c6e8f3eb, 0xe12e3f0c0e91f0cf, 0x29c3671ce2645ed2,
+        0x8929690a580e2b37, 0x0d538ab6d27b5967, 0x6736a57e6c73158c, 0xa554db0a795bf483, 0xc21a8006cb544418, 0xfe6e79e4df20ce63, 0xca67757cbdd7e6cb, 0x3511faf530b65c20,
+        0x6b24ba0fbd2e6f19, 0x1538aebe3b63fb85, 0x952079f88c51feab, 0xfe52c45f8839235f, 0x10a95caf4c2342e4, 0x95303b44838d7565, 0x6c4b6792dd53d5f4, 0xd1e5cffbdbfdfd63,
+        0x29ee8aed420a632a, 0xcd4abaa4de07699d, 0xd42b4a36a0ba727c, 0x39df3050ab800ec5, 0xc14be347cf8da9d6, 0x7553a30d892768bb, 0xb112fdc9c19538a8, 0x03a25496d6268084,
+        0x822e5827242742df, 0xc0f5fac2582b4afd, 0x9ade296c1cb081cc, 0x25fde7324685ab8e, 0xe952aed505cfb125, 0xd895d047692ea824, 0x0ecbaabf8207371b, 0x476fe11784ae2ae9,
+        0x07bce30cac408650, 0x9284cfd8b8f114e4, 0x93237464c6c4cec6, 0xbf07dc57994d1940, 0xb20f6c4e5c540fdb, 0xe4e38481017dc78f, 0xab5aea440c4dbb0a, 0x166b8b807799f56b,
+        0x7a29a6f9a82c6d98, 0xdb4b690c9b7e5dcf, 0xa92e00ede0672fac, 0x11a7eab1c430295a, 0x319fd3b66da39853, 0xb4dc2a4acbf8c1c7, 0x934b497bd9895c5d, 0x6baea85feec9f884,
+        0x2617baf6b2e482c2, 0x958618bbc83bac94, 0x773990057b3d53ed, 0x32ac1b0f3ac4d463, 0x0eb719e8eae6c708, 0xd95acea82ef0b658, 0xa59dbdb587b2161b, 0x23126075ccc77cdf,
+        0x84e3af239a93cdcf, 0x3d56fd6dfd0317d9, 0x1c426e0d591203c3, 0x11d4630fbfec8aca, 0x1f07ca2f3e5af102, 0x12a2f939f1277a51, 0x814c60b3e1e27082, 0xee78bd340cad4ffa,
+        0x04297e81595fe651, 0x2bb2db107d1d31e2, 0x7bb62c96dc5479dd, 0x339696fd3f9654ec, 0xdf5e1247ab6377bc, 0xada4b24b2be2c99a, 0x3f463df01b64e4af, 0x03f5957b2b7ca7f2,
+        0xa9458afef60aea23, 0xa64a9b382bc6b752, 0x2e005efac41e5bce, 0xae55cf9638ecd35f, 0x13a1224612db6555, 0xb8d70f863550ac9b, 0xd7551aca18bf7499, 0xf0dde35c00a83c4e,
+        0xb424cd1677b70876, 0x1bec705528176c01, 0x12edb3da366e6789, 0x2adf56aad4b53537, 0x20d6c1eb9358aeb8, 0x56ba12a9acb8d06b, 0xef8c45f2b11a2a57, 0x3a2a11a4273a3ed8,
+        0xedf2696b88866886, 0x3011ba1f7823ec82, 0xce50e553d11e066f, 0xbc1a1db4d4042d82, 0xe7834a52acf8820c, 0x10ed09c5b6dd3252, 0x3cc94db81cb6a251, 0xe89d53c2c8b33174,
+        0x8b1f428ad8c0d483, 0xff476ee76cb6e22e, 0x90a7750ba5d15c17, 0x1899496b3788764c, 0x3766b68c883f225c, 0x836508984a1c828f, 0xafa96ff284c7fa89, 0xc208da5825ba7a43,
+        0xeb156de4404183dd, 0xf86c44f338a24815, 0x3fa5fcb25d6715ca, 0x1fbc68c987504b50, 0xb82efecfaff945da, 0xcdafcc464ef070a4, 0x8783821c7e0a5121, 0xb6abd140932dd82a,
+        0x0617b7ab01182f38, 0x6abc672a30432090, 0xb20bd99509b4a975, 0x8690be95bc20f0b2, 0x82ebb4f1a150eabb, 0xb0f55cd3e456c087, 0x666b2e6ec23d6109, 0x7c05c50393c8088c,
+        0x3130c1201b4df012, 0x95dd0180a2e8b39b, 0x55fc2c59800084ae, 0x4ffc5c046fa4474d, 0x569105cd30c34fbd, 0x38fb4abe42b64bf5, 0xd6ef1909a9cb3797, 0xae610614bb3e7cd2,
+        0x5ab18fafdc2ccf57, 0x6b19de0491dc7cac, 0xeac5cf54c039d2e8, 0x2f293452a2db343d, 0x75588538ff5bcb85, 0xf8baeaf0b8cda657, 0x275379de625c307e, 0x39a15da58599a525,
+        0x634b0c2a771034cf, 0x4b2f7d6c4863eda3, 0xae0faac44ee778d9, 0x19b5968ce578bad1, 0xdcd6879a71027503, 0xe5d411962445797a, 0xa41adb1383754111, 0xeb8103644c00f66a,
+        0x1baf3134f68e6839, 0x4c2a4e8ec6c32361, 0xc5f817f3cc7819db, 0xdb6f3b03e00100fc, 0x4690ded57cc653b8, 0xaf2caba92b291149, 0x99954af3f56ffa35, 0xe027369347576f03,
+        0x10ea568720bdc646, 0x905f9a463a46b43a, 0x38597d8cb84ae74c, 0x1ddfdf0f5f9788cc, 0x3e061fa2778f6b82, 0xdc5b5a9df53e2a62, 0xec9fb103633f1a78, 0x0c87f5ffe25a9cbb,
+        0x568a5ada3d11fc00, 0xf16449014eb881a4, 0xfdb9a3a516062f82, 0x1eb2cc06c3a45f29, 0x0551f4d6abb5a6b8, 0x7ac9d46537ca1cc5, 0xb1d327b4a4225f64, 0x2fe98d3ccbf07cf9,
+        0xfc1a7408513836d7, 0xe6adfd44965054e4, 0x85ac9f0cc05b780d, 0xc4e2694efae3edff, 0xd203e5d020161181, 0x76d7b0357d0fc110, 0x0f6cb8513511864f, 0x925beedccf7984d3,
+        0x96067ca6db452905, 0x5f0bfeb339dd4cf9, 0x9fbdd6b8891a8e09, 0xa99f5c68ed847d40, 0xacd48bd75b00a780, 0xff265288a0835ed6, 0x87440d4df9a63c21, 0xfbe5e27faa263546,
+        0xa6561c70f303d453, 0x77e06a62b944168d, 0xe7c68d2caed88d9b, 0xa8ebbde787293ce9, 0x8bc261cafe92f759, 0x5ed93b5c5092158e, 0xeb493213c9c9a703, 0x93dab75f339d7161,
+        0x5617c831bb2b953e, 0xf06a006e622ec813, 0x871963d087f216e7, 0xac33d4852c166464, 0x1c21d1b0e2ff932b, 0x5cc5252304f44fbf, 0xc94399a8c8028377, 0xbdc13465d4807538,
+        0xc2006d2c7174f8cd, 0x6feeff15495e5a8e, 0xd43e06b70cefe6cf, 0xe7226986fe342f9a, 0xb049cbe88d52b56d, 0xbb128c02584a2990, 0x4dd6009420197f50, 0xeba4fb8fd858f872,
+        0x3533cf007c85d7ef, 0x6ef6c7976eedac34, 0xb55762ed9ade6ca7, 0x5d1a47d135a5da84, 0xf8adf112af9fb9a6, 0xc1e21b48524d0643, 0xd51dde35a3da4164, 0xb3cb3bde3dd1070a,
+        0xb60ac4ff1ca45ece, 0xcf637a1e91d9473f, 0xae3eebea672d70a4, 0xc0c6419dc069b693, 0xdada9ef1fb1d499a, 0x4280cbb7918e1201, 0x00be38b4fa3df0b6, 0x77146814b673477a,
+        0x3387e493c01dacf5, 0x2db6035549766876, 0x77f021633f26547e, 0x0f05f8248598c6ea, 0x26fc4463d6ba9f20, 0x70547a8e7988d760, 0x90bed8c0069e939d, 0xe04d82d1d02ef041,
+        0x68c23198ec73ac15, 0x42a5050ee1ea2e1c, 0x5566433acbe9bf3f, 0x6f1b8cb3580c916d, 0x7b5fb3869e78060f, 0xe291d4d30229b128, 0xfe1bb00bea88cb44, 0x2ac70550af8048fa,
+        0xf9cf01f498a342de, 0x5ee26453537cea54, 0xb949c5572874884f, 0xf42167480d47edb9, 0x60ed3fe87eab0910, 0x7240e726d6c3b34d, 0x1f1885bd40e35767, 0xdc66e28594890b0a,
+        0xb3c33b5b272de27b, 0x9b0e5657a9966aa6, 0x135a6cfcf5aae417, 0x7986152a9396d981, 0xc08839f967e729c2, 0xe433c24a3508b1a3, 0x5fe691e4dce662cc, 0x03068082cbdaf491,
+        0xb8dab87cf07c7fce, 0x49ed93373ae61e7b, 0x8eb92017580dec80, 0xda0c483c3b25ec70, 0xed1f4003dcd79a31, 0x1f6585ac77cb3cc2, 0x47aab7e223c9ad70, 0x9da40dcbe3c47742,
+        0x5171d6f19d950735, 0x4b9dca05b37c6dfe, 0xc9cc677c1984e7c9, 0x3b69e6b57f3fdd8f, 0x9cf45538c9ef12ae, 0x53109ebb8d7b9361, 0x070d9d65667525b7, 0x7b87f2b0391d9470,
+        0xea28cff24595ee8b, 0x0ac3a87e63adf12f, 0xe71e6eb6b7fb5480, 0xae5d095949216f7c, 0x157eb12e637c38ea, 0xc7be9337994a7c97, 0x28d7ff21c29c2048, 0xdbb3edb7abdf139f,
+        0x4f8417883e26de4e, 0x107ac5ffe4242fe8, 0xea23de524096c2ba, 0x20515c55b6db8588, 0xf78969202ad5fa95, 0x4c9f7ee12d67a4bb, 0x015d5d66deb8903d, 0xf065bd021db60c5b,
+        0xf191bf7f61f63f66, 0x3a5ca19f74aec2cd, 0x99c62e5c0ff4e57a, 0x33d3a5f622680f99, 0x8fa5793a0b4115fe, 0x9d0ea4ecb3cc9aba, 0xd5282aba7f8b412a, 0xc5536681b24f28b5,
+        0x1c4e8f8ec00ee187, 0x52fcfb1b809965f3, 0x2b8cd1c9096020a2, 0xda315b631c602af7, 0xdbecef00ee203b5f, 0xb496b627b3f30d8b, 0x95a3ecba3d6554de, 0xde750472f1dbc251,
+        0x1912af5d28e99012, 0x94d1cc3983f93ef9, 0x05e818cc6808901e, 0xc61a286ed600dd96, 0x9e4b1c964f3569af, 0x61bd8ccae5c485e5, 0x1779d233518e5d24, 0xfd37567fe21229d6,
+        0x6317058dd8ec6418, 0x7e864ca0278d0ff9, 0x8f15392b03e04343, 0x07a038068a44e157, 0xd0d0015254a16129, 0x9707e6361de78ffe, 0x411099e91c53c12c, 0x24d845ceb839af56,
+        0xca542b6a5a7ed14f, 0xd4efd4120e21ce62, 0xe5a1eb4e23d44039, 0x931921286dc1590e, 0x7abba6fd24d5cc22, 0xe7314812ff792aa7, 0x69b4454f397a0122, 0xb04ba6825c7a9e9c,
+        0xe97a545b5b49c02f, 0x0495202455c18b08, 0x0e6a0ca15d6b1eb4, 0x424e35fa80485d3f, 0x8d897776d5bbfc13, 0x7864db6ab7821d36, 0x848c37528671b452, 0xae4cbff3d67d014f,
+        0x5262da43e4b373b2, 0x4346076b4d650b3d, 0xe8094e2700c003bd, 0xd05b08a19f91a877, 0x6b33406201d79d5b, 0x3379904a8de053b4, 0x67f21954217fa2d5, 0x8ee332be09747d56,
+        0xd624d7639fe88564, 0x421ac59cca69ba00, 0x95de0569e7c7477b, 0xaaf8890c146c1671, 0x3c81908dbc502bc8, 0x7835c9ed18405800, 0x5d4bdeeeca4fbc05, 0x25975b713d424d28,
+        0xeca8a2230011ca04, 0x0efc7ca56acb3b56, 0x7eb3fb570222d0d2, 0x625279946fe9942b, 0x64f07d5ebe863ac6, 0x606892d4084f0da1, 0xac8a8bc8691cc39c, 0x4279d6224e0fae9f,
+        0x9c6169906615712c, 0xd552fe1399c97f1e, 0x36c317d4cad4c72b, 0x4a180025a0509c97, 0xa03ecec070ab792d, 0x80e3fc2a59c3d7f8, 0x84bf614655aa5bb8, 0x2e32fa0dd032f83a,
+        0xa434f694b5792eb6, 0xda808285ef75fb38, 0x6a84eec9bb3ee5fa, 0xe1f7a1faedfcacb3, 0xd45800f048c14979, 0x49724f9563140002, 0xe795ea7b6dbb8b60, 0x570483b421552361,
+        0xea124e767f59e67a, 0xbda5fbe9e9968ad8, 0xca3854f679cf1391, 0xd530b0be43d3c6ff, 0xc24f7b5088734d9d, 0x0491c6ae3bcfdf35, 0x60d9d42aae42cdb4, 0x32eee502c4a3e3b7,
+        0x012bc3c6fa664d0d, 0x2eeb6a19374266ea, 0x144c52f69d4d87aa, 0x9e6eecfff948456c, 0xb4f5c1a374404e38, 0x3197f1b399c4fcc7, 0xbb937e236eab5508, 0xfc438808634ee946,
+        0xfc40381d05a1c093, 0xdcbb520bc44193b6, 0x4840742ddc4e1255, 0x91f4ebff1b745cc4, 0x4bce2e782b61f90c, 0xbd8178542073aa5e, 0x55489ecf6fd3122d, 0x2517cf77a83c8111,
+        0xb6a464e1a9552be1, 0x4d86630197cc4ca5, 0xb87f83c3795ee48d, 0x6946c1b928d8f810, 0xbea184e73a47eea1, 0x04c7e021eacc2f31, 0xaa5218967acecba4, 0x6fa9c4999e1648f9,
+        0x3b1a73302bb15e9e, 0x5142ffcf27c41d82, 0x6f5db5179a8e7552, 0x45287ac8ae3b0b09, 0x4a979c2d8347671a, 0x0cbf8f8edc714278, 0x82d4df067cbb1835, 0x968a2dce8e09ca3c,
+        0x7aaee3c22b5a0698, 0xf71f57878227cf5d, 0x9e00dad8fbf4be88, 0x373ee7da8224a5e1, 0x936edc251d3a74e9, 0x4ebcdca7c37443a1, 0x327c75b981a3006c, 0xfb2e12f10e3de2c4,
+        0x8b4a461ff056d49a, 0x32a8b9b8c5f8b903, 0x1caef4e7b1b99932, 0x66b3103f1324d1a2, 0xd79263b69a9ca3bd, 0x3a6db5bc4381b796, 0x4208744513cb71b1, 0xa3ad8ac9e7d57c76,
+        0x4b94d2502ab5d7b6, 0xb488a14b26704a5a, 0xc7cf45b984ad3354, 0x9c27a15caee41f66, 0x38d57292c917ed13, 0x8dc012ee1556de04, 0xb842623fface98d4, 0xc01d442c560e8f3e,
+        0x5a21a3985b5b3d99, 0x26278751e9b27f5d, 0xecf1c74229db8a70, 0xd5554ab2ddd45828, 0x4f3a1ef16d71c738, 0xfc857c639469cb54, 0x1c1f3dcbc72e2b3c, 0x8f4f562fa94a3396,
+        0xf92c2fbd50f61366, 0x8b38725240e4e2ce, 0x7c62ebf2bfc07a2f, 0xc11597b0f8e08d3c, 0x99a02ceb27e8c590, 0xef3456104ce7a30d, 0xe9853f0796cde865, 0xeaa7fe1ec96c37ae,
+        0x1806155873d2e1c8, 0x936b8cb732be26cb, 0x60cae82a8ef3650d, 0xe9d5c108395e6931, 0x660219217bf7cf8a, 0xeeb152634581e588, 0xeecdb2378c442d16, 0xffa7cdd000c412bf,
+        0x5d6d83463171e617, 0x4239a5f7717c60da, 0xd1a0c6ba911253fa, 0x72627ee0d823d093, 0xf09b57c272c6aa46, 0x34833fe92bae86fe, 0xb33cdb28c0846a58, 0xd2953eb2b55be4db,
+        0x4152fe2820d2db6c, 0x494fd4b444f5e566, 0x080310f4bca1bf38, 0x4a024da6172636d2, 0x7a2c24471627b7ad, 0x0588ee09e2b948c8, 0x2d18c916c00c2230, 0xc6b9a9b56b58a6f2,
+        0xe68e99823b26197b, 0x4220776af2374014, 0xca458096e32b0ec1, 0x58b1049d6f540fcd, 0xdda13b4a1395e8ce, 0x5f8daf2430bd1988, 0xf73edab155caa02d, 0x45395ffb40be9b86,
+        0xd101876fb6e8db52, 0x9d9025e0fcbc7952, 0x14e24e2c0fe4775f, 0x8fa7ce151ada9f96, 0x1bb5a6f0d230637a, 0x80dcad959fa3fd09, 0x09a40cc9c5d85922, 0xe4d1d92fa40736d3,
+        0xe0c8b7eca1d1e7c2, 0x0bd21b37b498a9bc, 0x17c8f13d819c1486, 0x0cb7b3ea99289f74, 0xc48cf52c678e407b, 0x3ec0e1186248acc2, 0x79c4d5ed6d7b409c, 0x22a6c12d864c2b12,
+        0xeff73ac99526977b, 0x6395f3b89d07b01e, 0x4685f009af2ae682, 0x409aa59cbf432940, 0x7126f947be7c5fa1, 0xdbca42506e9b14a6, 0xd11285648a5eb886, 0x7f3890a442e25734,
+        0xb8ff1abd9a8c27e1, 0x00afb79a45e55908, 0xcafbb8902468219b, 0xc4d46ae5b181c5e6, 0x7e4875859d1258b8, 0x4f5e04188478c3af, 0x6e69bff3863a9b3b, 0xd425d73753f1d5c4,
+        0x0a67a48679234fad, 0xa4070ec20fbd8eb3, 0x9e238c56fc44640c, 0xd660acc8a89f3b30, 0xcbeaac526cd45735, 0x204d448f1955f753, 0x652403c3ea5880e9, 0xd9e3e48e00c02807,
+        0x1a2ccf570de97ace, 0x40d801a3a3e3cd68, 0xccc881eb3c21c35b, 0x330f0a074d51fa82, 0x3722fe71bbcd674a, 0x6f83efa4b14e1a4e, 0xb161b11271f5b132, 0x0c88170665037914,
+        0x457e63701003e0d5, 0xece7d5c810223aa7, 0x4fdd65af7131e4c7, 0x47be9a95dec4615b, 0x3fc1dc83e5360b03, 0xd618119d16e4dabc, 0x762cf59aed46a5e6, 0xc09a50ba76bd3246,
+        0x19ba6506fb6e04c5, 0x8641ab4f92b869dc, 0x0b8d5338211ed774, 0xc1b729ea6d9372e7, 0x79a3637be22a9d1c, 0x8c8707d294b6162e, 0x33c98b6119151fd3, 0x4b1b0b6cf54ca857,
+        0xed508f25279e34e2, 0xf0a10d5a1e0ec09a, 0xcbb1ebb89e3d5441, 0xc983cdb7a6b28a06, 0x3eb862eb0bb91d61, 0x7d58c5b01b4056fe, 0x61579e6e33e1b51c, 0x7e5732fd1150ece8,
+        0x86f0a3205c3bd2b9, 0x26b23c81828af1ed, 0xc49e54f23bc009f5, 0xba138037d9d43152, 0x279613a61f912650, 0xfe5501cbd7874e6a, 0xaffe02ae7babb07a, 0x4fefa70ac949facf,
+        0xee72abe5a89df844, 0xe4836799a6dc05af, 0xf4ff2d66e3871913, 0x1f591ea7bb2ee3bb, 0xe4ef094c5320178e, 0x42adf18c0983acbd, 0xcdd1aef4de0cc85e, 0x9415b8e5d1d20bb6,
+        0xe84939448f2cc7eb, 0xdd29f7afbed66217, 0x94550aa5a78a4ba3, 0xb2d27de3b4f12313, 0xc93c4eaaf4d34a96, 0x4ef75e21e6abc78e, 0xf4327cfcb12c698f, 0x54326449b0cc8c15,
+        0x9bbbd592b1d3d027, 0x99d3ce909e1d296e, 0x7762f9e3e14aa2f0, 0x85e5f32300ff57d9, 0x063637109b1456b2, 0x0f3c6e339ac45481, 0xb7a9e9f9c8aa1610, 0xc012b830cf3152ef,
+        0xa18ffa456254cc42, 0x2006b588c65ba4d1, 0xad65d7e66a8aed43, 0x396064260d799cf5, 0xe0e61722a3a16c54, 0xd6cd49f6092e27ec, 0x102e668d679cd4d4, 0x2db044d09536c178,
+        0x8f2adae7faa8522d, 0xfe2a42e4432bb136, 0x5e5240f99aeccb60, 0x3dac8cbbb88bb903, 0x8475eff35342dfaf, 0xc69ffacddafebb41, 0x782b2a7369bfbcf1, 0x11ba18b2471cefd3,
+        0x0a5aabbf9d7b44cd, 0x325899303043c00a, 0x1c6491ac94ac0402, 0x92a68dfecb1c01c8, 0x2bc19ff29cdd7eb4, 0xdce134df90ee2edb, 0x68db8fe761a3066e, 0x1380026fee7851c5,
+        0x1d0e8e6b5083ec2e, 0x9e452981ab8ad0d9, 0x5988c75b586aa530, 0x8dec2dc4d2c1bdff, 0x919b36c7a0ff0220, 0x9f0afea2ca8a02bb, 0xd370be4c491af370, 0x7da9be5478dcbdfd,
+        0xd89ef479ccfd649c, 0x3febc9ac234e330f, 0xa789702cd57b580a, 0x3929006b18b96f2f, 0xf5408419720460bf, 0x30a0b840366d8c81, 0xd0958b646bf932e1, 0xecfd8128f694e6b4,
+        0xe9ca945f55fc9d79, 0x5031689517dc5c30, 0x59bfdddc8572bb08, 0xad13fdfdc9b6341f, 0x3c37c60472f97c93, 0xecd556191f73bb91, 0x4ade8890883b6685, 0xf0c3d41667b04d8e,
+        0xe78167d29487f458, 0xdba9fde2c90bab1c, 0x68bbcbd7bdf87c99, 0xd7417f0863673ab4, 0xd709cc0e3364b94f, 0x60b22cea61629e68, 0x7d24721aa626f261, 0xe9a79baf2b907347,
+        0x9fa15704d740d21c, 0xf8e0dbd33a38e734, 0x2d3b988cca85c275, 0x550d4123c87995f0, 0xbef6808eb0f0d69f, 0x6f3012e643708ad8, 0xa7151cd863d61f0e, 0x3379c700cdf8afbe,
+        0x15af520249e33edf, 0x3f4cac7809ff7939, 0x5c0bee58557324d0, 0x95b093fa9d1d9b43, 0x84ae821a89782f36, 0xaac7b55c636a397a, 0xf128d7f3f9832a2d, 0xaddf8c9d479365d3,
+        0x9ccae92ffd92ef26, 0x0034808de454873b, 0xe827c7d614a769fa, 0x05f7e99adba72c21, 0x3398dafaccfed758, 0xa4b80bdbd10e8e33, 0x12e6a0673db81e8b, 0xee8645aed5d85ee1,
+        0x78f754f22c46e99d, 0x8372cfce8f6343cb, 0xc00089eadcccbaa6, 0x1f44ce6f75c42ae9, 0xe194c23b3ae1b965, 0xa2a53ff361e5c8a2, 0xcf57ac7dc959993d, 0x36bf6be86d79d2fa,
+        0xcc53e8d5fed72ff6, 0x4591f9a9437f385f, 0xac2c458e6794a4de, 0xbd4cecbc9a920cba, 0x42cad92d6b1b4ad8, 0x76afd0a008960ce1, 0xa1b35dfbb2bfceca, 0xc83c8e8d660cabbe,
+        0x041959e9a5e8b995, 0x0bbb82abfc728458, 0xb0d73de40752be7b, 0x847593edbbe66994, 0xe7c6b157ced9adeb, 0xa7e8c03d3abfc9b0, 0xa82f13704caf99a7, 0xb85001149cf6e85f,
+        0x6d4bc27369573130, 0x9d0bfc706a0de4e2, 0x2456c1890c7770bb, 0x9023337f6dc6310f, 0x5ac6a06fdd1f2c52, 0x2fd8e16453941c6e, 0x766d5c8fd9ddfbeb, 0x2e0d55a0ec4e2f3a,
+        0x0ffc71855228da95, 0xcd23f6f89a009cce, 0xb0756545b6a8dc91, 0x19c87e318dd0ec3f, 0xe30485021fed88a3, 0xe70c0139e3857046, 0x6dddd6414200423b, 0x01cd61e9a6b6f0ba,
+        0x64fa36c945dbb914, 0xc1ae84dc3e5ba795, 0x031e2bc12492acce, 0x79193fa07dba0bac, 0xed87ca72e7c225b5, 0x2b4ac0f220e9d0b6, 0xc44b4c36ea6d410b, 0x2e00623bf2073634,
+        0xe744be7f568e0982, 0xa7dd33a62c488bdb, 0x93dabb1b9fd58afe, 0x124aba8690a84a33, 0x382fffa7474739c5, 0x0e4181fcb3fa81d0, 0x9058364dd9aa8f45, 0x680812d020addfe5,
+        0xe95e871c83eebe15, 0x829db689b793db1a, 0x1306d1e764a40275, 0x3ca523ab963bbd1c, 0x4040f64e500e3178, 0xa1a8e434b5f6c866, 0x32525d5e5efdb47e, 0x47180ae762c5a831,
+        0xea0d8ae24c7bfb6d, 0xc6dd13e73064c456, 0x5fe24e20892e765d, 0x17fba396d58c99bc, 0x166230c58baf0642, 0x315743329d2ae936, 0xaddb4e43acac4f19, 0x038f012db4a452f5,
+        0x0039ffe220957053, 0x9cb7decbce4d06c4, 0x4dcbac793d7e81a6, 0x62e19dc510e80d21, 0x73b4983b4b2bb8fa, 0x3745442034f898ea, 0xc06142d9466e9e1a, 0xe4552f7b81defad9,
+        0x27b063f4e65e7b1a, 0x50ce8d272f2552be, 0xa387e7798d7671a3, 0xc951af782289c848, 0x9c5a98b85e589554, 0xb099bd041350235d, 0xce178f10b7ab0a64, 0x0a8c1b811e675456,
+        0x182d8fd3853d93fd, 0x8b24cefd6106b9de, 0xaee74a3583ae1ab2, 0xd7a8b1e3c7d704c7, 0x87b5d712afd7fdf7, 0x89bf5a0f332bc03c, 0xa97657f8cd17f25b, 0x8b8e74c06ba9043d,
+        0xbd6e1d084d6f1434, 0x4658cb4a332a195d, 0x920d78bf094ced52, 0x57808ce6c97347ed, 0x05befc21534d4410, 0x5f670b6b20004cd2, 0x765503a85c603bc0, 0x90e03b26e0dd70e0,
+        0xe24e9041e8c77d65, 0x5f76932fd18e2e54, 0x602d23703184721b, 0x3b262fa97e2566f2, 0x5fa48e3e742316a1, 0xc83e11ff2efa23f8, 0x7dd95b8b09f5eda0, 0x88d9077a70dde6b3,
+        0x7e7b3ac578b1abbc, 0xa611e8b314aac490, 0x04b77cb20d5970c8, 0x827e11cb9ad7cde0, 0x8af61fc5d7285ae9, 0x56b56231b780a42e, 0xa618b3613457a01c, 0xbc83a6f734c0c038,
+        0xbddb69e121117750, 0xbd1890a9c8245503, 0x22b135e46a883cb9, 0x5a6faf501527c542, 0x6cb59b4945e2c69a, 0x5ace3fb3080ae5ec, 0xd6ef3e02ed4775a3, 0x439aaf2bd970b8d1,
+        0xbc2f04e31541ed6e, 0xae1e1a62b7d35f41, 0x5bb024d9c415854c, 0x1f82d6eda3e6e4be, 0xc66e401bbde1cbf2, 0xc93d6a1ac5f92438, 0xf3bd52142e805b18, 0x3dd386c3db976c80,
+        0xac7379ccd01886ba, 0x2b94aabed0428aa1, 0x9837154c52e5f037, 0x5389b188f0f7c6b7, 0x33a1954c8da14c79, 0x36694d32f8097734, 0xf14cd4f86eb02701, 0x6308e927da185771,
+        0x8cf15ec053181978, 0x7742514fc3033ff3, 0x4708e5e2261d9405, 0x66f1d8cb26bc2c1b, 0xd9662abf782c2e0b, 0x02e2201fda1108a4, 0xa9217dbff961e84c, 0x43b2f00bf6044df9,
+        0xa876dd8a8fceae0a, 0x6eb5f3d6d538b627, 0x35172f1d717b0478, 0x62b7f5b0ee83d37e, 0x4fa0934532630d04, 0x899573358e54d71a, 0xe0beb2d1a8312c05, 0x9d644632b8fc64de,
+        0x86537322243d196b, 0xed5d9517f6406163, 0x304bbd4559343250, 0xdacabd5b6ca18e5f, 0x3382feec8c3a2683, 0x79f83a7dc7823699, 0x9494981afd4685f5, 0xf45ad7af11cc0cf4,
+        0x2b1ecb79b5464704, 0x046a054fa907dcc3, 0x38177c447121d298, 0x99bb1b559df3f19b, 0x3ac7e50756413ca8, 0x53ff5046b6dc33bf, 0x1d6f37c1f9d764eb, 0xedc59c89b55df9e1,
+        0x21f8006bbe23a116, 0x499bb5d759f5b2d6, 0x165a5c268e50b447, 0x49f8868bdce49dcc, 0xf153fe8a269293d8, 0x96e8c86a3a6387a8, 0xdc5117b1a7d67d6b, 0x7b717b0cc8d5370c,
+        0x900235628bfc90f7, 0x2e76bc5b30fbb963, 0xbb309ca9c94967a8, 0x54142f254defa92c, 0xb6779b56c25a411e, 0x84ea2314a49f6cf4, 0xe19be8848f0185c6, 0x74f17eefcf0c70ef,
+        0xeb4a3b34d71a98cc, 0xcb0c50e55c5ec758, 0xe438cbd18b12a97a, 0x97874ef02f7af30c, 0xbf47ab93df3403af, 0x0c5fe340995f12f1, 0x92d40818c4aa34a3, 0xe95ec2cc1233d740,
+        0x8cdda9f9d2ff1d5d, 0x3ab0fd7073e89b43, 0x8c4387523b4293a0, 0xfb27f58f5e4fc855, 0x666370367b1b000a, 0xdd2fd1438daeb615, 0xe1e98559d59d7ff5, 0xcb13eabe932e8a11,
+        0x645e82c0a92d6cd7, 0xe99ad6cb13e8523f, 0x92f1a80d6097fb06, 0xcd75793e6c1750be, 0x3e1e2faad46ae15d, 0xda31b512e9dd504f, 0x5dcbf67c89835aa2, 0xec1ea42bd26eb717,
+        0x4ef9525d0def7168, 0x821019c5c95ace62, 0xd9b0ea480696a0ae, 0x8a805aff16c0b4a8, 0xd553ec5f68d1f12c, 0xcabfc2a7b36721d3, 0xef6ac13f4420782a, 0xbf8d4b88652e52d5,
+        0x81a8a7f84eb0c6ee, 0x11d6f9179c02a33f, 0xd1baf9400811ca54, 0xa8c511966bf7eaf8, 0xbb3de4c7edeecdbd, 0xa6c309c647bbc022, 0x6d77b2ababa89879, 0x7031cc71a57695f8,
+        0x19db519e850a7a06, 0xbf64a1fb6a81e8e1, 0x97aa3cd9ce1ce1eb, 0x0414dab564fd3281, 0xa03b57077513ba00, 0x9d3dad382f3e9ed7, 0x38ed65ff6c9f6419, 0xff5c25d9ffa5fbf2,
+        0xd0e63f19bc86115d, 0x059e6927fb69feb5, 0xeb6df617a26d81cd, 0x927e725f27534261, 0x552f9fe9e2308045, 0x06ab09c1476d608b, 0x02f8baad081d1497, 0x3244da137f1c261a,
+        0x6623a1facffc7b52, 0xb0e39b88eef4fe5e, 0x0a37b375c921f0c5, 0x55a671574fc8f16c, 0x92af4f37f6a57939, 0x02563b45568bb69b, 0xf1082f4bf8b01c4b, 0x08e39d781be8174c,
+        0x31531ff2700788be, 0x820971fa26eb5e39, 0x593af69a06c37de7, 0x64329faccd2f4b78, 0x4744409653a54fc8, 0xd493e863276bc190, 0x4b2d55a7cf986d7c, 0x449c0a1b2148b284,
+        0x95d2d020931ac49b, 0x525e55cf84513bf7, 0x01569f4fc9a3f488, 0x5cf6708c02343b02, 0xf41db0f325e6c459, 0x9bda642b0687d8aa, 0x9078413fbd35d32a, 0xda22c80dc48aa669,
+        0x3560bfd99c98470e, 0xbd462a6102f413f5, 0xbf26d96ea80743fb, 0xe32d305d7019833a, 0x5686fdcd44c2a667, 0x0cd3fc8567fac2f5, 0xffe37471c166722d, 0xe1a021a2be2576ae,
+        0x6b6b888eb0f47ed0, 0xca1db722522d4658, 0x44c3d9005f7202aa, 0x0f160dd5faa1b606, 0xb4815159b15ed511, 0x67b2e86a9d282a04, 0x97b3833825dd2799, 0x2a732a6ca59de5ed,
+        0xe605fd596e3c3ba1, 0x285765cc6a77accc, 0xe83ded20f4be0b9b, 0x7104b22d41dae6c5, 0x5007710006f2d450, 0x4f13b6cdd713a1b6, 0x0d7c81722a99210a, 0xbf03a7e39b2e04f7,
+        0x5e410c9e32e98542, 0x8cc5eeff7a22e4a2, 0xa1c887daac2e004a, 0x5eac22269d15258a, 0xee97ad11c6ad17fd, 0xc12d6f1f6c2ee961, 0x6950a212f153d845, 0x527ecc48c1bbdac4,
+        0x836c8ab75b3e7517, 0x7309903be3a3aa45, 0x1645193693afc6cf, 0x9a10aafa17d5440a, 0x55de0d76851a1fa4, 0x08bebd34d39e59cb, 0x94e4bd7e0cac126a, 0xa0998faaca7d8928,
+        0x5ea9724850ccd2ee, 0x28f1efc20630feaf, 0x36aeb97ae5766dd1, 0x1aae5ddabbd1f79b, 0xd4738ebc556bfb4e, 0xd2bf894b37cf0a3a, 0x463491d82abef3fe, 0xe7036b066db55de5,
+        0x8a553acd09c342ac, 0xc283442203242f45, 0x647dd567c126ff62, 0xce14457f65aa9abc, 0x45f1d8ce95fbd0f2, 0xcba0fd99ab68f355, 0xe239604bc9bbba90, 0x0f1c5842dbc41f78,
+        0x7883ec7ff5d7f432, 0xc33a207c9c8b0c64, 0x2d85ed067c052e25, 0x8ed4796e3401cab9, 0x6990c76c9d4b5b2d, 0xea3b91d2f00510e2, 0x338242395aace838, 0x66f2b1d29228e9dc,
+        0x35e8937b9a630b90, 0xbc5235497dd7ac34, 0x5c84971d1cebd4ae, 0x03e78f0d20008af5, 0xaf42a3ced8c671e1, 0x7606d68febb7a94e, 0x041582a7de08f319, 0x4f257b750635934e,
+        0x33fd2ac67dbb3055, 0x4cc23c6683a7b4f5, 0xb9103a2ed9a809fb, 0x522730f037f7c233, 0x59fb6bfaca585e5c, 0x29f53ce96b623180, 0xeb754687669dc9d1, 0x2854cd0dddd94a61,
+        0x0911cada9d5bbe0b, 0x2674a9d6c5e4757b, 0x41d651a04958bb47, 0x31328ca22a08f7a2, 0x96617ec516229377, 0x30bb0607631e4018, 0xd5f7d107aa4d2273, 0x6c078133896c0150,
+        0x52c76fed716e77b8, 0x776e8284042fbc42, 0x98bc3cedc8120a2d, 0xeb2d8a5fbfd3268e, 0xbb8e39b01db3dae1, 0x988203e34b74dd5d, 0x82975c3ec7f5dd33, 0x60032a218c213a8d,
+        0x0efd65d3c2350a00, 0x66266af90085e938, 0x4031c1ae07e3ede9, 0x2a37e5013ee45e94, 0x0da9924b168b66b4, 0xc9bc69427fefa37f, 0x06b9871ed683d2b8, 0x4ffeb156e540521b,
+        0x53dc8b47ce1dc6b2, 0x3c5cdeca959f9d94, 0x8685d76d397d78aa, 0x6c72fe9fa3d3c3c7, 0x067b5365392267b4, 0xfca434f6ad34ebb2, 0x8ee78024587dcf7f, 0xdb0cbb9bcd7d29c5,
+        0x65afc9ae5ecffd83, 0xaf06106b0ef69f43, 0x3bb2a3a3779d4ee7, 0x06058600ea8599ac, 0xc37953e95b3e98f6, 0x8a629644a615aca3, 0xd63e2baca9c43a72, 0xebf8d5ab2ab8ac81,
+        0x2a59be9d4045be15, 0x8989c1feaba26cf5, 0xe296e0dff1395b36, 0xa9df3b22802ca90d, 0xa6b51c6a3ca303fe, 0xf12ac7637525f9bf, 0xfb9ce75dcb413843, 0x7b4eaa3f4206732c,
+        0xeb078dadfad21954, 0xe0e117a55440992e, 0x733b582bee586ea4, 0x0dfcf49974ba0e47, 0xbfc733ffbd658473, 0xa9c09dc16f675c39, 0xe53e2e1f2dac17f5, 0xea5e6967d266c10e,
+        0x1d0b7e304d333481, 0x5ebadc5b4ec528b1, 0xeef2677db8ddd0c6, 0x3e9102af6d8bb8e2, 0x4bd6b37a01a66f10, 0x8dc01cbe61d45c9b, 0x6dea04bc242acbe6, 0x6f54144d9aa057c7,
+        0x4853d485cd0123ba, 0x0edcae7bc821cdcb, 0x31ee2188e897ed24, 0x6e9ae3b57b736ea5, 0x49e0e0aab68c4904, 0xf826e40e63a98962, 0x0ca675eda8c1d7a8, 0x25ea8935dbf15698,
+        0x92f0269cdb70b2c8, 0xdb8fd285c2628873, 0xdbe1eedeab7cf103, 0x224c7bc50eab322c, 0x516e4b76d10dc9dd, 0xee2888f8dd7c4ebf, 0x19be3ff22d00f827, 0xae856331454abdd8,
+        0xecade7cdacbaa9a9, 0x78e2601c5c7f43bc, 0xb95eca1ed6e05729, 0xd6817876ba85daa6, 0xd9490f1d6dc8fd52, 0xea38738476607178, 0x27ab035c543a93b2, 0xbc29465f37daa30b,
+        0x5de9d96c4f4b3a91, 0xc6fbee43c53b9d18, 0x6ca2d24323b1a8e3, 0xf7414f414ed5aa9b, 0xd31cee094cc2dadd, 0xf3e3c1bc3b519f5e, 0x852a2b7f20c56f9a, 0xd7cc8c43584da312,
+        0x0a9765ea8b5d5c83, 0x592e829df66a7341, 0x8fc48c33a2cd2a29, 0x188e0683915f73e7, 0xba99a0f5c70327e6, 0xde3bb3acf94e81bf, 0x7f86e5186242cf13, 0x193a0350742e4d8d,
+        0xb30df8f6ddbd6e87, 0xf368d303fff57a17, 0xe7477d594ec28d2e, 0x0e80d81d8232af72, 0xd53f0eb01a5bb9d9, 0x7d79fa6ad8b7482b, 0xf5977d8a73370d47, 0x60d8e5cefef345c1,
+        0x8abee2fd6496e647, 0x3f53d5c20f5d8db8, 0x48ede6ca850ecf9c, 0x82502015ad88e623, 0xf20e6ee1beca9c6c, 0xbf36db195965f9a2, 0xe7f5e420ed0f224f, 0x6fa4273a5180059b,
+        0x08199087fea1605e, 0x2caa107f52667a77, 0xa1573b055292e040, 0x24886912709e624c, 0x5d83f0f2d90304aa, 0x7b2798b864898e05, 0xa8c7e51d986c57d7, 0x600b5a7e611756d0,
+        0xf4994c7ba9d31cdd, 0x5c1920049c7a7471, 0x64313c19f44b28f8, 0x7d0b471a000187d7, 0xea7eef3effd77598, 0x4511b392e446f9f7, 0x21672bf1a0bb1063, 0xede50026110c7fb5,
+        0x027442fb0a952831, 0x32e6c384014d08af, 0x429caab37e646852, 0x63fe39250769d89d, 0xafea66368375ae0d, 0x36ca216a0f4acd4f, 0x509f99d734919159, 0xeaf91af56405a759,
+        0x38e7e392fd59923d, 0x11c6e2530e8ae09f, 0xcbb93cfea56394f6, 0x462fd7e4c4804b5e, 0xb70c77e8621199e9, 0xa14a95bcdbcc0313, 0xf154932653d3ebbf, 0xd5a96bdc818e2f9a,
+        0x38965d35a0f51956, 0x7d354e93ac3f8331, 0x985339a7f0160b7b, 0x33deb838655d05a0, 0x8aae1f19a856e1d9, 0x57d773cbfd162c3f, 0x5d7518d76b083891, 0x01ebd045ae4dd421
+    }
 };
 #if defined(HITLS_SIXTY_FOUR_BITS)
 static const BN_UINT g_one[P256_SIZE] = {1, 0, 0, 0};
@@ -493,14 +763,8 @@ void ECP_Sm2PointDbl(P256_Point *r, const P256_Point *a)
     BN_UINT T1[P256_SIZE] __attribute__((aligned(32)));
     BN_UINT T2[P256_SIZE] __attribute__((aligned(32)));
     BN_UINT T3[P256_SIZE] __attribute__((aligned(32)));
-
-    /* zero-check a->z.value */
-    if (IsZeros(a->z.value)) {
-        for (i = 0; i < P256_SIZE; ++i)
-            r->z.value[i] = 0;
-
-        return;
-    }
+    /* all ones if a is the point at infinity, read before r is written as r may be a */
+    BN_UINT inf = (BN_UINT)0 - (BN_UINT)IsZeros(a->z.value);
 
     /* 4Mul + 4Sqr */
     ECP_Sm2Sqr(T1, a->z.value);                      /* Z1^2 */
@@ -520,6 +784,12 @@ void ECP_Sm2PointDbl(P256_Point *r, const P256_Point *a)
     ECP_Sm2Sub(T1, T3, r->x.value);                  /* T1 = lambda_2 - X3 */
     ECP_Sm2Mul(T1, T1, T2);
     ECP_Sm2Sub(r->y.value, T1, r->y.value);          /* Y3 = lambda_1*T1 - lambda_3 */
+
+    /* Z3 = 2*Y1*Z1 is already 0 for the point at infinity, clear X3 and Y3 without a branch. */
+    for (i = 0; i < P256_SIZE; ++i) {
+        r->x.value[i] &= ~inf;
+        r->y.value[i] &= ~inf;
+    }
 }
 
 int32_t ECP_Sm2PointDouble(const ECC_Para *para, ECC_Point *r, const ECC_Point *a)
@@ -670,35 +940,108 @@ ERR:
     return ret;
 }
 
+/* Collects the bits column, column + 32, ..., column + 224 of k into a comb table index. */
+static uint32_t Sm2CombIndex(const BN_UINT *k, uint32_t column)
+{
+    const uint32_t limbBits = (uint32_t)sizeof(BN_UINT) * 8;
+    uint32_t index = 0;
+    for (uint32_t i = 0; i < SM2_COMB_TEETH; i++) {
+        uint32_t bit = column + i * SM2_COMB_SPACING;
+        index |= (uint32_t)((k[bit / limbBits] >> (bit % limbBits)) & 1) << i;
+    }
+    return index;
+}
+
+/*
+ * Reads the table entry in constant time, every entry of the block is touched.
+ * Index 0 gives (0, 0), which stands for the point at infinity.
+ */
+static void Sm2CombSelect(P256_AffinePoint *r, uint32_t block, uint32_t index)
+{
+    BN_UINT *out = (BN_UINT *)r;
+    const uint32_t words = sizeof(P256_AffinePoint) / sizeof(BN_UINT);
+    (void)memset_s(r, sizeof(P256_AffinePoint), 0, sizeof(P256_AffinePoint));
+    for (uint32_t i = 1; i < SM2_COMB_POINTS; i++) {
+        BN_UINT mask = (BN_UINT)0 - (BN_UINT)(Uint32ConstTimeEqual(i, index) & 1);
+        const BN_UINT *entry = (const BN_UINT *)&g_sm2CombTable[block][i * 8]; // 8: 64-bit words per point
+        for (uint32_t j = 0; j < words; j++) {
+            out[j] |= entry[j] & mask;
+        }
+    }
+}
+
+/*
+ * r = a + b without branches on the points: the generic sum is always computed and the result is selected with
+ * masks when a is the point at infinity or b is (0, 0). a == b and a == -b are not handled, the comb never adds
+ * them for k < n as the multiples of G held by r and by the table entry are distinct and their sum is below n.
+ */
+static void Sm2CombAddAffine(P256_Point *r, const P256_Point *a, const P256_AffinePoint *b)
+{
+    P256_Point sum;
+    BN_UINT T1[P256_SIZE] __attribute__((aligned(32)));
+    BN_UINT T2[P256_SIZE] __attribute__((aligned(32)));
+    BN_UINT T3[P256_SIZE] __attribute__((aligned(32)));
+    BN_UINT T4[P256_SIZE] __attribute__((aligned(32)));
+    BN_UINT aInf = (BN_UINT)0 - (BN_UINT)IsZeros(a->z.value);
+    BN_UINT bInf = (BN_UINT)0 - (BN_UINT)(IsZeros(b->x.value) & IsZeros(b->y.value));
+
+    ECP_Sm2Sqr(T1, a->z.value);
+    ECP_Sm2Mul(T2, T1, a->z.value);
+    ECP_Sm2Mul(T1, T1, b->x.value);
+    ECP_Sm2Mul(T2, T2, b->y.value);
+    ECP_Sm2Sub(T1, T1, a->x.value);
+    ECP_Sm2Sub(T2, T2, a->y.value);
+    ECP_Sm2Mul(sum.z.value, a->z.value, T1);
+    ECP_Sm2Sqr(T3, T1);
+    ECP_Sm2Mul(T4, T3, T1);
+    ECP_Sm2Mul(T3, T3, a->x.value);
+    ECP_Sm2Add(T1, T3, T3);
+    ECP_Sm2Sqr(sum.x.value, T2);
+    ECP_Sm2Sub(sum.x.value, sum.x.value, T1);
+    ECP_Sm2Sub(sum.x.value, sum.x.value, T4);
+    ECP_Sm2Sub(T3, T3, sum.x.value);
+    ECP_Sm2Mul(T3, T3, T2);
+    ECP_Sm2Mul(T4, T4, a->y.value);
+    ECP_Sm2Sub(sum.y.value, T3, T4);
+
+    // b at infinity gives a, otherwise a at infinity gives (b.x, b.y, 1), otherwise the sum.
+    for (uint32_t i = 0; i < P256_SIZE; i++) {
+        BN_UINT x = (b->x.value[i] & aInf) | (sum.x.value[i] & ~aInf);
+        BN_UINT y = (b->y.value[i] & aInf) | (sum.y.value[i] & ~aInf);
+        BN_UINT z = (g_one[i] & aInf) | (sum.z.value[i] & ~aInf);
+        r->x.value[i] = (a->x.value[i] & bInf) | (x & ~bInf);
+        r->y.value[i] = (a->y.value[i] & bInf) | (y & ~bInf);
+        r->z.value[i] = (a->z.value[i] & bInf) | (z & ~bInf);
+    }
+}
+
+/* r = r + T[block][index] in constant time, r is unchanged when index is 0. */
+static void Sm2CombAdd(P256_Point *r, uint32_t block, uint32_t index)
+{
+    P256_AffinePoint entry;
+    Sm2CombSelect(&entry, block, index);
+    Sm2CombAddAffine(r, r, &entry);
+}
+
+/*
+ * k * G with the fixed-base comb: 15 doublings and 32 mixed additions, compared with the 256 doublings
+ * of a windowed method.
+ */
 void ECP_Sm2ScalarMulG(P256_Point *r, const BN_UINT *k)
 {
-    const BN_UINT *precompute = (const BN_UINT *)g_sm2Precompute;
-    uint32_t index, mask = 0xff;
-    for (int i = 31; i >= 0; --i) {
-        /* 'i / 8' is for split i to 4 parts(k is a 4 elements array)
-           '(8 * (i % 8))' is for the size of k's element is 64bits */
-#if defined(HITLS_SIXTY_FOUR_BITS)
-        index = (k[i / 8] >> (8 * (i % 8))) & mask;
-#else
-        index = (k[i / 4] >> (8 * (i % 4))) & mask;
-#endif
-        ECP_Sm2PointDbl(r, r);
-        ECP_Sm2PointDbl(r, r);
-        ECP_Sm2PointDbl(r, r);
-        ECP_Sm2PointDbl(r, r);
-        ECP_Sm2PointDbl(r, r);
-        ECP_Sm2PointDbl(r, r);
-        ECP_Sm2PointDbl(r, r);
-        ECP_Sm2PointDbl(r, r);
-        if (index) {
-#if defined(HITLS_SIXTY_FOUR_BITS)
-            index = index * 8; // 1 point has 64 bytes, which is 8*8 bytes
-#else
-            index = index * 16; // 1 point has 64 bytes, which is 8*8 bytes
-#endif
-            ECP_Sm2PointAddAffine(r, r, (const P256_AffinePoint *)&precompute[index]);
+    const BN_UINT zero[P256_SIZE] = {0};
+    BN_UINT kr[P256_SIZE];
+    ECP_Sm2AddModOrd(kr, k, zero); // k mod n, which keeps the comb additions away from the doubling case
+    BSL_SAL_CleanseData(r, sizeof(P256_Point));
+    for (int32_t column = SM2_COMB_COLUMNS - 1; column >= 0; column--) {
+        if (column != SM2_COMB_COLUMNS - 1) {
+            ECP_Sm2PointDbl(r, r);
+        }
+        for (uint32_t block = 0; block < SM2_COMB_BLOCKS; block++) {
+            Sm2CombAdd(r, block, Sm2CombIndex(kr, (uint32_t)column + block * SM2_COMB_COLUMNS));
         }
     }
+    BSL_SAL_CleanseData(kr, sizeof(kr));
 }
 
 int32_t ECP_Sm2WindowedMul(P256_Point *r, const BN_UINT *k, P256_AffinePoint *a)
@@ -788,4 +1131,55 @@ ERR:
     return ret;
 }
 
+static int32_t ECP_Sm2PointMulAddCheck(
+    ECC_Para *para, ECC_Point *r, const BN_BigNum *k1, const BN_BigNum *k2, const ECC_Point *pt)
+{
+    if (para == NULL || r == NULL || k1 == NULL || k2 == NULL || pt == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (para->id != CRYPT_ECC_SM2 || r->id != CRYPT_ECC_SM2 || pt->id != CRYPT_ECC_SM2) {
+        BSL_ERR_PUSH_ERROR(CRYPT_ECC_POINT_ERR_CURVE_ID);
+        return CRYPT_ECC_POINT_ERR_CURVE_ID;
+    }
+    if (BN_IsZero(pt->z)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_ECC_POINT_AT_INFINITY);
+        return CRYPT_ECC_POINT_AT_INFINITY;
+    }
+    return CRYPT_SUCCESS;
+}
+
+// r = k1 * G + k2 * pt, k1 * G uses the comb table and k2 * pt the windowed method.
+int32_t ECP_Sm2PointMulAdd(ECC_Para *para, ECC_Point *r, const BN_BigNum *k1, const BN_BigNum *k2,
+    const ECC_Point *pt)
+{
+    int32_t ret = ECP_Sm2PointMulAddCheck(para, r, k1, k2, pt);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    BN_UINT k1Arr[P256_SIZE] = {0};
+    BN_UINT k2Arr[P256_SIZE] = {0};
+    uint32_t klen = P256_SIZE;
+    P256_Point k1G = {0};
+    P256_Point k2Pt = {0};
+    P256_Point sm2Pt = {0};
+    P256_AffinePoint sm2Aff = {0};
+#if defined(HITLS_SIXTY_FOUR_BITS)
+    GOTO_ERR_IF_EX(BN_Bn2U64Array(k1, k1Arr, &klen), ret);
+    klen = P256_SIZE;
+    GOTO_ERR_IF_EX(BN_Bn2U64Array(k2, k2Arr, &klen), ret);
+#else
+    GOTO_ERR_IF_EX(BN_BN2Array(k1, k1Arr, klen), ret);
+    GOTO_ERR_IF_EX(BN_BN2Array(k2, k2Arr, klen), ret);
+#endif
+    GOTO_ERR_IF_EX(ECP_Sm2Point2Array(&sm2Pt, pt), ret);
+    GOTO_ERR_IF_EX(ECP_Sm2GetAffine(&sm2Aff, &sm2Pt), ret);
+    GOTO_ERR_IF_EX(ECP_Sm2WindowedMul(&k2Pt, k2Arr, &sm2Aff), ret);
+    ECP_Sm2ScalarMulG(&k1G, k1Arr);
+    ECP_Sm2PointAddJacob(&k1G, &k1G, &k2Pt);
+    GOTO_ERR_IF_EX(ECP_Sm2Array2Point(r, &k1G), ret);
+ERR:
+    return ret;
+}
+
 #endif
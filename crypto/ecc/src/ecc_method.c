@@ -44,7 +44,7 @@ static const ECC_Method EC_METHOD_NIST = {
 #ifdef HITLS_CRYPTO_SM2
 // method implementation of SM2
 static const ECC_Method EC_METHOD_SM2 = {
-    .pointMulAdd = ECP_PointMulAdd,
+    .pointMulAdd = ECP_Sm2PointMulAdd,
     .pointMul = ECP_Sm2PointMul,
     .pointAdd = ECP_Sm2PointAdd,
     .pointDouble = ECP_Sm2PointDouble,
@@ -40,6 +40,22 @@ extern "C" {
  */
 int32_t ECP_Sm2PointMul(ECC_Para *para, ECC_Point *r, const BN_BigNum *scalar, const ECC_Point *pt);
 
+/**
+ * @ingroup sm2
+ * @brief   Calculate r = k1 * G + k2 * pt
+ *
+ * @param   para [IN] Curve parameter information
+ * @param   r [OUT] Output point information
+ * @param   k1 [IN] Scalar of the base point
+ * @param   k2 [IN] Scalar of pt
+ * @param   pt [IN] Point data
+ *
+ * @retval CRYPT_SUCCESS    succeeded.
+ * @retval For details about other errors, see crypt_errno.h
+ */
+int32_t ECP_Sm2PointMulAdd(ECC_Para *para, ECC_Point *r, const BN_BigNum *k1, const BN_BigNum *k2,
+    const ECC_Point *pt);
+
 /**
  * @ingroup sm2
  * @brief   Calculate r = a + b, where a is the Jacobian coordinate system and b is the affine coordinate system.
@@ -37,6 +37,12 @@ int32_t ECP_Sm2PointMul(ECC_Para *para, ECC_Point *r, const BN_BigNum *scalar, c
     return ECP_PointMul(para, r, scalar, pt);
 }
 
+int32_t ECP_Sm2PointMulAdd(ECC_Para *para, ECC_Point *r, const BN_BigNum *k1, const BN_BigNum *k2,
+    const ECC_Point *pt)
+{
+    return ECP_PointMulAdd(para, r, k1, k2, pt);
+}
+
 int32_t ECP_Sm2Point2Affine(const ECC_Para *para, ECC_Point *r, const ECC_Point *a)
 {
     if (para == NULL || r == NULL || a == NULL) {
@@ -67,10 +67,29 @@ int32_t CRYPT_EAL_EncodeRsaPssAlgParam(CRYPT_RSA_PssPara *rsaPssParam, uint8_t *
 int32_t CRYPT_EAL_PriKeyParseFile(BSL_ParseFormat format, int32_t type, const char *path, uint8_t *pwd, uint32_t pwdlen,
     CRYPT_EAL_PkeyCtx **ealPriKey);
 
+/**
+ * Keys derived by PBKDF2 while decrypting PBES2 data, keyed by the password, salt, iteration count, PRF and key
+ * length. Sharing a cache between decryptions with the same password skips repeated derivations. The cache is
+ * thread safe when the SAL lock is available.
+ */
+typedef struct CRYPT_DeriveKeyCache CRYPT_DeriveKeyCache;
+
+CRYPT_DeriveKeyCache *CRYPT_DeriveKeyCacheNew(void);
+
+void CRYPT_DeriveKeyCacheFree(CRYPT_DeriveKeyCache *cache);
+
 // parse PKCS7-EncryptData：only support PBES2 + PBKDF2.
 int32_t CRYPT_EAL_ParseAsn1PKCS7EncryptedData(BSL_Buffer *encode, const uint8_t *pwd, uint32_t pwdlen,
     BSL_Buffer *encryptData);
 
+// parse PKCS7-EncryptData, reusing the derived keys of keyCache when it is not NULL.
+int32_t CRYPT_EAL_ParseAsn1PKCS7EncryptedDataEx(BSL_Buffer *encode, const uint8_t *pwd, uint32_t pwdlen,
+    CRYPT_DeriveKeyCache *keyCache, BSL_Buffer *encryptData);
+
+// parse an encrypted PKCS8 private key in DER, reusing the derived keys of keyCache when it is not NULL.
+int32_t CRYPT_EAL_ParseAsn1Pk8EncPriKey(BSL_Buffer *encode, const uint8_t *pwd, uint32_t pwdlen,
+    CRYPT_DeriveKeyCache *keyCache, CRYPT_EAL_PkeyCtx **ealPriKey);
+
 // encode PKCS7-EncryptData：only support PBES2 + PBKDF2.
 int32_t CRYPT_EAL_EncodePKCS7EncryptDataBuff(BSL_Buffer *data, const void *encodeParam, BSL_Buffer *encode);
 
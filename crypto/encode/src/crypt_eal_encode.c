@@ -908,8 +908,116 @@ typedef struct {
     BSL_Buffer *derivekeyData;
     BSL_Buffer *ivData;
     BSL_Buffer *enData;
+    CRYPT_DeriveKeyCache *keyCache;
 } EncryptPara;
 
+typedef struct DeriveKeyCacheEntry {
+    struct DeriveKeyCacheEntry *next;
+    int32_t prfId;
+    int32_t iter;
+    uint8_t *pwd;
+    uint32_t pwdLen;
+    uint8_t *salt;
+    uint32_t saltLen;
+    uint8_t *key;
+    uint32_t keyLen;
+} DeriveKeyCacheEntry;
+
+struct CRYPT_DeriveKeyCache {
+    DeriveKeyCacheEntry *entries;
+    BSL_SAL_ThreadLockHandle lock;
+};
+
+CRYPT_DeriveKeyCache *CRYPT_DeriveKeyCacheNew(void)
+{
+    CRYPT_DeriveKeyCache *cache = BSL_SAL_Calloc(1, sizeof(CRYPT_DeriveKeyCache));
+    if (cache == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return NULL;
+    }
+    int32_t ret = BSL_SAL_ThreadLockNew(&cache->lock);
+    if (ret != BSL_SUCCESS) {
+        BSL_SAL_Free(cache);
+        BSL_ERR_PUSH_ERROR(ret);
+        return NULL;
+    }
+    return cache;
+}
+
+static void DeriveKeyCacheEntryFree(DeriveKeyCacheEntry *entry)
+{
+    BSL_SAL_ClearFree(entry->pwd, entry->pwdLen);
+    BSL_SAL_Free(entry->salt);
+    BSL_SAL_ClearFree(entry->key, entry->keyLen);
+    BSL_SAL_Free(entry);
+}
+
+void CRYPT_DeriveKeyCacheFree(CRYPT_DeriveKeyCache *cache)
+{
+    if (cache == NULL) {
+        return;
+    }
+    DeriveKeyCacheEntry *entry = cache->entries;
+    while (entry != NULL) {
+        DeriveKeyCacheEntry *next = entry->next;
+        DeriveKeyCacheEntryFree(entry);
+        entry = next;
+    }
+    BSL_SAL_ThreadLockFree(cache->lock);
+    BSL_SAL_Free(cache);
+}
+
+static bool DeriveKeyCacheMatch(const DeriveKeyCacheEntry *entry, int32_t iter, int32_t prfId, const BSL_Buffer *salt,
+    const uint8_t *pwd, uint32_t pwdlen, uint32_t keyLen)
+{
+    return entry->iter == iter && entry->prfId == prfId && entry->keyLen == keyLen &&
+        entry->saltLen == salt->dataLen && entry->pwdLen == pwdlen &&
+        (salt->dataLen == 0 || memcmp(entry->salt, salt->data, salt->dataLen) == 0) &&
+        (pwdlen == 0 || memcmp(entry->pwd, pwd, pwdlen) == 0);
+}
+
+static bool DeriveKeyCacheGet(CRYPT_DeriveKeyCache *cache, int32_t iter, int32_t prfId, const BSL_Buffer *salt,
+    const uint8_t *pwd, uint32_t pwdlen, BSL_Buffer *key)
+{
+    bool found = false;
+    (void)BSL_SAL_ThreadReadLock(cache->lock);
+    for (DeriveKeyCacheEntry *entry = cache->entries; entry != NULL; entry = entry->next) {
+        if (DeriveKeyCacheMatch(entry, iter, prfId, salt, pwd, pwdlen, key->dataLen)) {
+            (void)memcpy_s(key->data, key->dataLen, entry->key, entry->keyLen);
+            found = true;
+            break;
+        }
+    }
+    (void)BSL_SAL_ThreadUnlock(cache->lock);
+    return found;
+}
+
+/* A failure to remember the key only costs a later derivation, so it is not reported. */
+static void DeriveKeyCacheAdd(CRYPT_DeriveKeyCache *cache, int32_t iter, int32_t prfId, const BSL_Buffer *salt,
+    const uint8_t *pwd, uint32_t pwdlen, const BSL_Buffer *key)
+{
+    DeriveKeyCacheEntry *entry = BSL_SAL_Calloc(1, sizeof(DeriveKeyCacheEntry));
+    if (entry == NULL) {
+        return;
+    }
+    entry->pwd = pwdlen == 0 ? NULL : BSL_SAL_Dump(pwd, pwdlen);
+    entry->salt = salt->dataLen == 0 ? NULL : BSL_SAL_Dump(salt->data, salt->dataLen);
+    entry->key = BSL_SAL_Dump(key->data, key->dataLen);
+    entry->pwdLen = pwdlen;
+    entry->saltLen = salt->dataLen;
+    entry->keyLen = key->dataLen;
+    if ((pwdlen != 0 && entry->pwd == NULL) || (salt->dataLen != 0 && entry->salt == NULL) || entry->key == NULL) {
+        DeriveKeyCacheEntryFree(entry);
+        return;
+    }
+    entry->iter = iter;
+    entry->prfId = prfId;
+    (void)BSL_SAL_ThreadWriteLock(cache->lock);
+    entry->next = cache->entries;
+    cache->entries = entry;
+    (void)BSL_SAL_ThreadUnlock(cache->lock);
+}
+
 static int32_t PbkdfDeriveKey(int32_t iter, int32_t prfId, BSL_Buffer *salt, const uint8_t *pwd, uint32_t pwdlen, BSL_Buffer *key)
 {
     int32_t ret;
@@ -956,11 +1064,16 @@ static int32_t ParseEncDataAsn1(BslCid symAlg, EncryptPara *encPara, const uint8
         return CRYPT_DECODE_PKCS8_INVALID_KEYLEN;
     }
     BSL_Buffer keyBuff = {key, symKeyLen};
-
-    ret = PbkdfDeriveKey(iter, prfId, &salt, pwd, pwdlen, &keyBuff);
-    if (ret != CRYPT_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        return ret;
+    CRYPT_DeriveKeyCache *cache = encPara->keyCache;
+    if (cache == NULL || !DeriveKeyCacheGet(cache, iter, prfId, &salt, pwd, pwdlen, &keyBuff)) {
+        ret = PbkdfDeriveKey(iter, prfId, &salt, pwd, pwdlen, &keyBuff);
+        if (ret != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+        if (cache != NULL) {
+            DeriveKeyCacheAdd(cache, iter, prfId, &salt, pwd, pwdlen, &keyBuff);
+        }
     }
 
     if (encPara->enData->dataLen != 0) {
@@ -986,7 +1099,7 @@ static int32_t ParseEncDataAsn1(BslCid symAlg, EncryptPara *encPara, const uint8
 }
 
 static int32_t ParsePk8EncPriKeyBuff(BSL_Buffer *buff, const uint8_t *pwd, uint32_t pwdlen,
-    CRYPT_EAL_PkeyCtx **ealPriKey)
+    CRYPT_DeriveKeyCache *keyCache, CRYPT_EAL_PkeyCtx **ealPriKey)
 {
     if (pwdlen > PWD_MAX_LEN || (pwd == NULL && pwdlen != 0)) {
         BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
@@ -1028,6 +1141,7 @@ static int32_t ParsePk8EncPriKeyBuff(BSL_Buffer *buff, const uint8_t *pwd, uint3
         .derivekeyData = &derivekeyData,
         .ivData = &ivData,
         .enData = &enData,
+        .keyCache = keyCache,
     };
     ret = ParseEncDataAsn1(symId, &encPara, pwd, pwdlen, &decode);
     if (ret != CRYPT_SUCCESS) {
@@ -1136,6 +1250,16 @@ int32_t CRYPT_EAL_PubKeyParseFile(BSL_ParseFormat format, int32_t type, const ch
     return ret;
 }
 
+int32_t CRYPT_EAL_ParseAsn1Pk8EncPriKey(BSL_Buffer *encode, const uint8_t *pwd, uint32_t pwdlen,
+    CRYPT_DeriveKeyCache *keyCache, CRYPT_EAL_PkeyCtx **ealPriKey)
+{
+    if (encode == NULL || encode->data == NULL || encode->dataLen == 0 || ealPriKey == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+        return CRYPT_INVALID_ARG;
+    }
+    return ParsePk8EncPriKeyBuff(encode, pwd, pwdlen, keyCache, ealPriKey);
+}
+
 int32_t CRYPT_EAL_ParseAsn1PriKey(int32_t type, BSL_Buffer *encode, const uint8_t *pwd, uint32_t pwdlen,
     CRYPT_EAL_PkeyCtx **ealPriKey)
 {
@@ -1147,7 +1271,7 @@ int32_t CRYPT_EAL_ParseAsn1PriKey(int32_t type, BSL_Buffer *encode, const uint8_
         case CRYPT_PRIKEY_PKCS8_UNENCRYPT:
             return ParsePk8PriKeyBuff(encode, ealPriKey);
         case CRYPT_PRIKEY_PKCS8_ENCRYPT:
-            return ParsePk8EncPriKeyBuff(encode, pwd, pwdlen, ealPriKey);
+            return ParsePk8EncPriKeyBuff(encode, pwd, pwdlen, NULL, ealPriKey);
         default:
             BSL_ERR_PUSH_ERROR(CRYPT_DECODE_NO_SUPPORT_TYPE);
             return CRYPT_DECODE_NO_SUPPORT_TYPE;
@@ -2305,7 +2429,7 @@ typedef enum {
 } HITLS_P7_ENC_CONTINFO_IDX;
 
 static int32_t ParsePKCS7EncryptedContentInfo(BSL_Buffer *encode, const uint8_t *pwd, uint32_t pwdlen,
-    BSL_Buffer *output)
+    CRYPT_DeriveKeyCache *keyCache, BSL_Buffer *output)
 {
     uint8_t *temp = encode->data;
     uint32_t  tempLen = encode->dataLen;
@@ -2346,6 +2470,7 @@ static int32_t ParsePKCS7EncryptedContentInfo(BSL_Buffer *encode, const uint8_t
         .derivekeyData = &derivekeyData,
         .ivData = &ivData,
         .enData = &enData,
+        .keyCache = keyCache,
     };
     ret = ParseEncDataAsn1(symId, &encPara, pwd, pwdlen, output);
     if (ret != CRYPT_SUCCESS) {
@@ -2386,6 +2511,12 @@ typedef enum {
 
 int32_t CRYPT_EAL_ParseAsn1PKCS7EncryptedData(BSL_Buffer *encode, const uint8_t *pwd, uint32_t pwdlen,
     BSL_Buffer *output)
+{
+    return CRYPT_EAL_ParseAsn1PKCS7EncryptedDataEx(encode, pwd, pwdlen, NULL, output);
+}
+
+int32_t CRYPT_EAL_ParseAsn1PKCS7EncryptedDataEx(BSL_Buffer *encode, const uint8_t *pwd, uint32_t pwdlen,
+    CRYPT_DeriveKeyCache *keyCache, BSL_Buffer *output)
 {
     if (encode == NULL || pwd == NULL || output == NULL) {
         BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
@@ -2421,7 +2552,7 @@ int32_t CRYPT_EAL_ParseAsn1PKCS7EncryptedData(BSL_Buffer *encode, const uint8_t
     }
     BSL_Buffer encryptInfo = {asn1[HITLS_P7_ENCRYPTDATA_ENCRYPTINFO_IDX].buff,
         asn1[HITLS_P7_ENCRYPTDATA_ENCRYPTINFO_IDX].len};
-    ret = ParsePKCS7EncryptedContentInfo(&encryptInfo, pwd, pwdlen, output);
+    ret = ParsePKCS7EncryptedContentInfo(&encryptInfo, pwd, pwdlen, keyCache, output);
     if (ret != BSL_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
     }
@@ -347,6 +347,10 @@ bool IsSupportAVX512F(void);
 bool IsSupportAVX512VL(void);
 bool IsSupportAVX512BW(void);
 bool IsSupportAVX512DQ(void);
+bool IsSupportAVX512IFMA(void);
+bool IsSupportVAES(void);
+bool IsSupportVPCLMULQDQ(void);
+bool IsSupportSHA(void);
 bool IsSupportXSAVE(void);
 bool IsSupportOSXSAVE(void);
 bool IsOSSupportAVX(void);
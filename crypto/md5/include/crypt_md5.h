@@ -48,6 +48,14 @@ CRYPT_MD5_Ctx *CRYPT_MD5_NewCtx(void);
  * @param ctx [IN] md handle
  */
 void CRYPT_MD5_FreeCtx(CRYPT_MD5_Ctx *ctx);
+
+/**
+ * @ingroup MD5
+ * @brief Size of the md context, used to place the context in memory provided by the caller.
+ *
+ * @retval Size of the context in bytes.
+ */
+uint32_t CRYPT_MD5_GetCtxSize(void);
 /**
  * @ingroup MD5
  * @brief This API is used to initialize the MD5 context.
@@ -55,6 +55,11 @@ void CRYPT_MD5_FreeCtx(CRYPT_MD5_Ctx *ctx)
     BSL_SAL_ClearFree(ctx, sizeof(CRYPT_MD5_Ctx));
 }
 
+uint32_t CRYPT_MD5_GetCtxSize(void)
+{
+    return sizeof(CRYPT_MD5_Ctx);
+}
+
 int32_t CRYPT_MD5_Init(CRYPT_MD5_Ctx *ctx, BSL_Param *param)
 {
     if (ctx == NULL) {
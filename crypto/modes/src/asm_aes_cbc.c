@@ -46,7 +46,15 @@ int32_t AES_CBC_DecryptBlock(MODES_CipherCommonCtx *ctx, const uint8_t *in, uint
         BSL_ERR_PUSH_ERROR(CRYPT_MODE_ERR_INPUT_LEN);
         return CRYPT_MODE_ERR_INPUT_LEN;
     }
-    (void)CRYPT_AES_CBC_Decrypt(ctx->ciphCtx, in, out, len, ctx->iv);
+    uint32_t offset = 0;
+#ifdef HITLS_CRYPTO_AES_X8664
+    if (CRYPT_AES_UseVaes(len)) {
+        // CBC encryption is serial, only the decryption profits from the wide registers.
+        offset = len & ~(uint32_t)(CRYPT_AES_VAES_BLOCK_LEN - 1);
+        (void)CRYPT_AES_CBC_DecryptVaes(ctx->ciphCtx, in, out, offset, ctx->iv);
+    }
+#endif
+    (void)CRYPT_AES_CBC_Decrypt(ctx->ciphCtx, in + offset, out + offset, len - offset, ctx->iv);
     return CRYPT_SUCCESS;
 }
 
@@ -28,10 +28,6 @@ extern "C" {
 
 void AesCcmEncryptAsm(void *key, uint8_t *nonce, const uint8_t *in, uint8_t *out, uint32_t len);
 void AesCcmDecryptAsm(void *key, uint8_t *nonce, const uint8_t *in, uint8_t *out, uint32_t len);
-void XorInDecrypt(XorCryptData *data, uint32_t len);
-void XorInEncrypt(XorCryptData *data, uint32_t len);
-void XorInEncryptBlock(XorCryptData *data);
-void XorInDecryptBlock(XorCryptData *data);
 
 #ifdef __cplusplus
 }
@@ -47,7 +47,14 @@ int32_t AES_CTR_EncryptBlock(MODES_CipherCommonCtx *ctx, const uint8_t *in, uint
         }
         // Shift leftwards by 4 bytes to obtain the length of the data involved in the calculation.
         uint32_t calLen = blocks << 4;
-        (void)CRYPT_AES_CTR_Encrypt(ctx->ciphCtx, tmpIn, tmpOut, calLen, ctx->iv);
+        uint32_t vaesLen = 0;
+#ifdef HITLS_CRYPTO_AES_X8664
+        if (CRYPT_AES_UseVaes(calLen)) {
+            vaesLen = calLen & ~(uint32_t)(CRYPT_AES_VAES_BLOCK_LEN - 1);
+            (void)CRYPT_AES_CTR_EncryptVaes(ctx->ciphCtx, tmpIn, tmpOut, vaesLen, ctx->iv);
+        }
+#endif
+        (void)CRYPT_AES_CTR_Encrypt(ctx->ciphCtx, tmpIn + vaesLen, tmpOut + vaesLen, calLen - vaesLen, ctx->iv);
         left -= calLen;
         tmpIn += calLen;
         tmpOut += calLen;
@@ -22,6 +22,24 @@
 #include "crypt_modes_ecb.h"
 #include "modes_local.h"
 
+#ifdef HITLS_CRYPTO_AES_X8664
+/* Hands the leading multiple of CRYPT_AES_VAES_BLOCK_LEN bytes to the VAES code, returns the processed length. */
+static uint32_t AES_ECB_VaesBlocks(const CRYPT_AES_Key *key, const uint8_t *in, uint8_t *out, uint32_t len,
+    bool enc)
+{
+    if (!CRYPT_AES_UseVaes(len)) {
+        return 0;
+    }
+    uint32_t vaesLen = len & ~(uint32_t)(CRYPT_AES_VAES_BLOCK_LEN - 1);
+    if (enc) {
+        (void)CRYPT_AES_ECB_EncryptVaes(key, in, out, vaesLen);
+    } else {
+        (void)CRYPT_AES_ECB_DecryptVaes(key, in, out, vaesLen);
+    }
+    return vaesLen;
+}
+#endif
+
 int32_t AES_ECB_EncryptBlock(MODES_CipherCommonCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len)
 {
     if (ctx->ciphCtx == NULL) {
@@ -32,7 +50,11 @@ int32_t AES_ECB_EncryptBlock(MODES_CipherCommonCtx *ctx, const uint8_t *in, uint
         BSL_ERR_PUSH_ERROR(CRYPT_MODE_ERR_INPUT_LEN);
         return CRYPT_MODE_ERR_INPUT_LEN;
     }
-    (void)CRYPT_AES_ECB_Encrypt(ctx->ciphCtx, in, out, len);
+    uint32_t offset = 0;
+#ifdef HITLS_CRYPTO_AES_X8664
+    offset = AES_ECB_VaesBlocks(ctx->ciphCtx, in, out, len, true);
+#endif
+    (void)CRYPT_AES_ECB_Encrypt(ctx->ciphCtx, in + offset, out + offset, len - offset);
     return CRYPT_SUCCESS;
 }
 
@@ -46,7 +68,11 @@ int32_t AES_ECB_DecryptBlock(MODES_CipherCommonCtx *ctx, const uint8_t *in, uint
         BSL_ERR_PUSH_ERROR(CRYPT_MODE_ERR_INPUT_LEN);
         return CRYPT_MODE_ERR_INPUT_LEN;
     }
-    (void)CRYPT_AES_ECB_Decrypt(ctx->ciphCtx, in, out, len);
+    uint32_t offset = 0;
+#ifdef HITLS_CRYPTO_AES_X8664
+    offset = AES_ECB_VaesBlocks(ctx->ciphCtx, in, out, len, false);
+#endif
+    (void)CRYPT_AES_ECB_Decrypt(ctx->ciphCtx, in + offset, out + offset, len - offset);
     return CRYPT_SUCCESS;
 }
 
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#if defined(HITLS_CRYPTO_AES) && defined(HITLS_CRYPTO_XTS)
+
+#include "bsl_err_internal.h"
+#include "bsl_sal.h"
+#include "crypt_aes.h"
+#include "crypt_utils.h"
+#include "crypt_errno.h"
+#include "crypt_modes_xts.h"
+#include "modes_local.h"
+
+#define AES_XTS_BLOCKSIZE 16
+
+// Whole blocks only. The VAES code takes the multiples of four blocks of long inputs, AES-NI the rest.
+static void AES_XTS_Blocks(const CRYPT_AES_Key *key, const uint8_t *in, uint8_t *out, uint32_t len,
+    uint8_t *tweak, bool enc)
+{
+    uint32_t offset = 0;
+    if (CRYPT_AES_UseVaes(len) && IsSupportVPCLMULQDQ()) {
+        offset = len & ~(uint32_t)(CRYPT_AES_VAES_BLOCK_LEN - 1);
+        if (enc) {
+            (void)CRYPT_AES_XTS_EncryptVaes(key, in, out, offset, tweak);
+        } else {
+            (void)CRYPT_AES_XTS_DecryptVaes(key, in, out, offset, tweak);
+        }
+    }
+    if (len == offset) {
+        return;
+    }
+    if (enc) {
+        (void)CRYPT_AES_XTS_Encrypt(key, in + offset, out + offset, len - offset, tweak);
+    } else {
+        (void)CRYPT_AES_XTS_Decrypt(key, in + offset, out + offset, len - offset, tweak);
+    }
+}
+
+static int32_t AES_XTS_Encrypt(MODES_CipherXTSCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    uint8_t pp[AES_XTS_BLOCKSIZE];
+    if (len < AES_XTS_BLOCKSIZE) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MODE_BUFF_LEN_NOT_ENOUGH);
+        return CRYPT_MODE_BUFF_LEN_NOT_ENOUGH;
+    }
+    uint32_t tailLen = len % AES_XTS_BLOCKSIZE;
+    uint32_t blocksLen = len - tailLen;
+    AES_XTS_Blocks(ctx->ciphCtx, in, out, blocksLen, ctx->tweak, true);
+    if (tailLen == 0) {
+        return CRYPT_SUCCESS;
+    }
+
+    // Ciphertext stealing: the last whole ciphertext block is moved to the end and lends its tail to the
+    // partial block, which is then encrypted with the next tweak in its place.
+    uint8_t *lastBlock = out + blocksLen - AES_XTS_BLOCKSIZE;
+    for (uint32_t i = 0; i < tailLen; i++) {
+        pp[i] = in[blocksLen + i];
+        out[blocksLen + i] = lastBlock[i];
+    }
+    for (uint32_t i = tailLen; i < AES_XTS_BLOCKSIZE; i++) {
+        pp[i] = lastBlock[i];
+    }
+    (void)CRYPT_AES_XTS_Encrypt(ctx->ciphCtx, pp, lastBlock, AES_XTS_BLOCKSIZE, ctx->tweak);
+    BSL_SAL_CleanseData(pp, sizeof(pp));
+    return CRYPT_SUCCESS;
+}
+
+static int32_t AES_XTS_Decrypt(MODES_CipherXTSCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    uint8_t pp[AES_XTS_BLOCKSIZE];
+    uint8_t t2[AES_XTS_BLOCKSIZE];
+    if (len < AES_XTS_BLOCKSIZE) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MODE_BUFF_LEN_NOT_ENOUGH);
+        return CRYPT_MODE_BUFF_LEN_NOT_ENOUGH;
+    }
+    uint32_t tailLen = len % AES_XTS_BLOCKSIZE;
+    if (tailLen == 0) {
+        AES_XTS_Blocks(ctx->ciphCtx, in, out, len, ctx->tweak, false);
+        return CRYPT_SUCCESS;
+    }
+    uint32_t blocksLen = len - tailLen - AES_XTS_BLOCKSIZE;
+    AES_XTS_Blocks(ctx->ciphCtx, in, out, blocksLen, ctx->tweak, false);
+
+    // The last whole ciphertext block was encrypted with the tweak of the partial block, which comes after.
+    for (uint32_t i = 0; i < AES_XTS_BLOCKSIZE; i++) {
+        t2[i] = ctx->tweak[i];
+    }
+    GF128Mul_IEEE(ctx->tweak, AES_XTS_BLOCKSIZE);
+    (void)CRYPT_AES_XTS_Decrypt(ctx->ciphCtx, in + blocksLen, pp, AES_XTS_BLOCKSIZE, ctx->tweak);
+    for (uint32_t i = 0; i < tailLen; i++) {
+        uint8_t c = in[blocksLen + AES_XTS_BLOCKSIZE + i];
+        out[blocksLen + AES_XTS_BLOCKSIZE + i] = pp[i];
+        pp[i] = c;
+    }
+    (void)CRYPT_AES_XTS_Decrypt(ctx->ciphCtx, pp, out + blocksLen, AES_XTS_BLOCKSIZE, t2);
+    BSL_SAL_CleanseData(pp, sizeof(pp));
+    BSL_SAL_CleanseData(t2, sizeof(t2));
+    return CRYPT_SUCCESS;
+}
+
+int32_t AES_XTS_Update(MODES_XTS_Ctx *modeCtx, const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen)
+{
+    return MODES_CipherStreamProcess(modeCtx->enc ? AES_XTS_Encrypt : AES_XTS_Decrypt, &modeCtx->xtsCtx,
+        in, inLen, out, outLen);
+}
+
+int32_t AES_XTS_InitCtx(MODES_XTS_Ctx *modeCtx, const uint8_t *key, uint32_t keyLen, const uint8_t *iv,
+    uint32_t ivLen, bool enc)
+{
+    return MODES_XTS_InitCtx(modeCtx, key, keyLen, iv, ivLen, enc);
+}
+#endif
@@ -0,0 +1,120 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#if defined(HITLS_CRYPTO_SM4) && defined(HITLS_CRYPTO_CCM)
+
+#include "bsl_err_internal.h"
+#include "crypt_utils.h"
+#include "crypt_errno.h"
+#include "crypt_sm4.h"
+#include "ccm_core.h"
+#include "crypt_modes_ccm.h"
+#include "modes_local.h"
+
+// CBC-MAC of whole blocks, chained through ctx->tag.
+static void Sm4CcmMacBlocks(MODES_CipherCCMCtx *ctx, const uint8_t *data, uint32_t blocks)
+{
+    const uint8_t *tmp = data;
+    for (uint32_t i = 0; i < blocks; i++) {
+        DATA64_XOR(tmp, ctx->tag, ctx->tag, CCM_BLOCKSIZE);
+        (void)ctx->ciphMeth->encryptBlock(ctx->ciphCtx, ctx->tag, ctx->tag, CCM_BLOCKSIZE);
+        tmp += CCM_BLOCKSIZE;
+    }
+}
+
+/*
+ * CTR of whole blocks with the multi-block SM4 kernel. The kernel increments the low 32 bits of the counter block,
+ * whereas the CCM counter is L = (flags & 7) + 1 bytes long, so each call stops where the low min(L, 4) bytes wrap
+ * and the carry is then moved into the counter bytes above them.
+ */
+static void Sm4CcmCtrBlocks(MODES_CipherCCMCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t blocks)
+{
+    uint32_t countLen = (ctx->nonce[0] & 0x07) + 1;
+    uint32_t lowLen = (countLen < sizeof(uint32_t)) ? countLen : sizeof(uint32_t);
+    uint64_t period = (uint64_t)1 << (lowLen * 8); // 8 bits per byte
+    uint32_t lowMask = (uint32_t)(period - 1);
+    const uint8_t *tmpIn = in;
+    uint8_t *tmpOut = out;
+    uint32_t left = blocks;
+    while (left > 0) {
+        uint32_t ctr = GET_UINT32_BE(ctx->nonce, 12); // 12: offset of the last 32 bits of the counter block
+        uint64_t room = period - (ctr & lowMask);
+        uint32_t num = ((uint64_t)left < room) ? left : (uint32_t)room;
+        (void)CRYPT_SM4_CTR_Encrypt(ctx->ciphCtx, tmpIn, tmpOut, num, ctx->nonce);
+        if (num == room) {
+            // The low counter bytes wrapped, drop the kernel's carry into the nonce and propagate it inside L bytes.
+            PUT_UINT32_BE(ctr & ~lowMask, ctx->nonce, 12);
+            if (countLen > sizeof(uint32_t)) {
+                MODE_IncCounter(ctx->nonce + CCM_BLOCKSIZE - countLen, countLen - sizeof(uint32_t));
+            }
+        }
+        left -= num;
+        tmpIn += num * CCM_BLOCKSIZE;
+        tmpOut += num * CCM_BLOCKSIZE;
+    }
+}
+
+static int32_t Sm4CcmBlocks(MODES_CipherCCMCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len, bool enc)
+{
+    if (ctx->ciphCtx == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    uint32_t blocks = len / CCM_BLOCKSIZE;
+    // The MAC is taken over the plaintext, which in-place encryption overwrites, so the order depends on enc.
+    if (enc) {
+        Sm4CcmMacBlocks(ctx, in, blocks);
+        Sm4CcmCtrBlocks(ctx, in, out, blocks);
+    } else {
+        Sm4CcmCtrBlocks(ctx, in, out, blocks);
+        Sm4CcmMacBlocks(ctx, out, blocks);
+    }
+    uint32_t tmpOffset = len & 0xfffffff0;
+    uint32_t dataLen = len & 0x0fU;
+    if (dataLen > 0) { // data processing with less than 16 bytes
+        XorCryptData data;
+        data.in = in + tmpOffset;
+        data.out = out + tmpOffset;
+        data.ctr = ctx->last;
+        data.tag = ctx->tag;
+        uint8_t countLen = (ctx->nonce[0] & 0x07) + 1;
+        (void)ctx->ciphMeth->encryptBlock(ctx->ciphCtx, ctx->nonce, ctx->last, CCM_BLOCKSIZE);
+        if (enc) {
+            XorInEncrypt(&data, dataLen);
+        } else {
+            XorInDecrypt(&data, dataLen);
+        }
+        MODE_IncCounter(ctx->nonce + CCM_BLOCKSIZE - countLen, countLen); // counter +1
+    }
+    return CRYPT_SUCCESS;
+}
+
+int32_t MODES_SM4_CCM_Encrypt(MODES_CipherCCMCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    return CcmCrypt(ctx, in, out, len, true, Sm4CcmBlocks);
+}
+
+int32_t MODES_SM4_CCM_Decrypt(MODES_CipherCCMCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    return CcmCrypt(ctx, in, out, len, false, Sm4CcmBlocks);
+}
+
+int32_t SM4_CCM_Update(MODES_CCM_Ctx *modeCtx, const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen)
+{
+    return MODES_CipherStreamProcess(modeCtx->enc ? MODES_SM4_CCM_Encrypt : MODES_SM4_CCM_Decrypt, &modeCtx->ccmCtx,
+        in, inLen, out, outLen);
+}
+#endif
@@ -69,6 +69,36 @@ static void GcmRemHandle(MODES_CipherGCMCtx *ctx, const uint8_t *in, uint8_t *ou
     ctx->lastLen = GCM_BLOCKSIZE - len;
 }
 
+// len is a multiple of GCM_BLOCKSIZE.
+static void Sm4GcmEncryptBlocks(MODES_CipherGCMCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    uint32_t done = 0;
+#ifdef HITLS_CRYPTO_SM4_X8664
+    // Groups of 16 blocks are encrypted and hashed in one pass.
+    done = CRYPT_SM4_GCM_Encrypt(ctx->ciphCtx, in, out, len / GCM_BLOCKSIZE, ctx->iv, ctx->ghash,
+        ctx->hTable) * GCM_BLOCKSIZE;
+#endif
+    if (done < len) {
+        (void)CRYPT_SM4_CTR_Encrypt(ctx->ciphCtx, in + done, out + done, (len - done) / GCM_BLOCKSIZE, ctx->iv);
+        GcmHashMultiBlock(ctx->ghash, ctx->hTable, out + done, len - done);
+    }
+}
+
+// len is a multiple of GCM_BLOCKSIZE.
+static void Sm4GcmDecryptBlocks(MODES_CipherGCMCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    uint32_t done = 0;
+#ifdef HITLS_CRYPTO_SM4_X8664
+    // Groups of 16 blocks are hashed and decrypted in one pass.
+    done = CRYPT_SM4_GCM_Decrypt(ctx->ciphCtx, in, out, len / GCM_BLOCKSIZE, ctx->iv, ctx->ghash,
+        ctx->hTable) * GCM_BLOCKSIZE;
+#endif
+    if (done < len) {
+        GcmHashMultiBlock(ctx->ghash, ctx->hTable, in + done, len - done);
+        (void)CRYPT_SM4_CTR_Encrypt(ctx->ciphCtx, in + done, out + done, (len - done) / GCM_BLOCKSIZE, ctx->iv);
+    }
+}
+
 int32_t MODES_SM4_GCM_EncryptBlock(MODES_CipherGCMCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len)
 {
     ctx->plaintextLen += len;
@@ -82,8 +112,7 @@ int32_t MODES_SM4_GCM_EncryptBlock(MODES_CipherGCMCtx *ctx, const uint8_t *in, u
     uint32_t clen = len - lastLen;
     if (clen >= GCM_BLOCKSIZE) {
         uint32_t calLen = clen & 0xfffffff0;
-        (void)CRYPT_SM4_CTR_Encrypt(ctx->ciphCtx, tmpIn, tmpOut, calLen / GCM_BLOCKSIZE, ctx->iv);
-        GcmHashMultiBlock(ctx->ghash, ctx->hTable, tmpOut, calLen);
+        Sm4GcmEncryptBlocks(ctx, tmpIn, tmpOut, calLen);
         clen -= calLen;
         tmpIn += calLen;
         tmpOut += calLen;
@@ -107,8 +136,7 @@ int32_t MODES_SM4_GCM_DecryptBlock(MODES_CipherGCMCtx *ctx, const uint8_t *in, u
     uint32_t clen = len - lastLen;
     if (clen >= GCM_BLOCKSIZE) {
         uint32_t calLen = clen & 0xfffffff0;
-        GcmHashMultiBlock(ctx->ghash, ctx->hTable, tmpIn, calLen);
-        (void)CRYPT_SM4_CTR_Encrypt(ctx->ciphCtx, tmpIn, tmpOut, calLen / GCM_BLOCKSIZE, ctx->iv);
+        Sm4GcmDecryptBlocks(ctx, tmpIn, tmpOut, calLen);
         tmpIn += calLen;
         tmpOut += calLen;
         clen -= calLen;
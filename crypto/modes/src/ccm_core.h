@@ -30,6 +30,11 @@ typedef int32_t (*CcmCore)(MODES_CipherCCMCtx *, const uint8_t *, uint8_t *, uin
 
 int32_t CcmCrypt(MODES_CipherCCMCtx *ctx, const uint8_t *in, uint8_t *out, uint32_t len, bool enc, const CcmCore func);
 
+void XorInDecrypt(XorCryptData *data, uint32_t len);
+void XorInEncrypt(XorCryptData *data, uint32_t len);
+void XorInEncryptBlock(XorCryptData *data);
+void XorInDecryptBlock(XorCryptData *data);
+
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
@@ -103,6 +103,7 @@ const EAL_SymMethod *MODES_GetSymMethod(int32_t algId)
         case CRYPT_CIPHER_AES128_GCM:
         case CRYPT_CIPHER_AES128_CFB:
         case CRYPT_CIPHER_AES128_OFB:
+        case CRYPT_CIPHER_AES128_XTS:
             return &AES128_METHOD;
         case CRYPT_CIPHER_AES192_CBC:
         case CRYPT_CIPHER_AES192_ECB:
@@ -119,6 +120,7 @@ const EAL_SymMethod *MODES_GetSymMethod(int32_t algId)
         case CRYPT_CIPHER_AES256_GCM:
         case CRYPT_CIPHER_AES256_CFB:
         case CRYPT_CIPHER_AES256_OFB:
+        case CRYPT_CIPHER_AES256_XTS:
             return &AES256_METHOD;
         case CRYPT_CIPHER_SM4_XTS:
         case CRYPT_CIPHER_SM4_CBC:
@@ -127,6 +129,7 @@ const EAL_SymMethod *MODES_GetSymMethod(int32_t algId)
         case CRYPT_CIPHER_SM4_GCM:
         case CRYPT_CIPHER_SM4_CFB:
         case CRYPT_CIPHER_SM4_OFB:
+        case CRYPT_CIPHER_SM4_CCM:
             return &SM4_METHOD;
         case CRYPT_CIPHER_CHACHA20_POLY1305:
             return &CHACHA20_METHOD;
@@ -216,6 +219,8 @@ int32_t MODE_CheckUpdateParam(uint8_t blockSize, uint32_t cacheLen, uint32_t inL
 static bool IfXts(CRYPT_CIPHER_AlgId id)
 {
     CRYPT_CIPHER_AlgId XTS_list[] = {
+        CRYPT_CIPHER_AES128_XTS,
+        CRYPT_CIPHER_AES256_XTS,
         CRYPT_CIPHER_SM4_XTS,
     };
     for (uint32_t i = 0; i < sizeof(XTS_list) / sizeof(XTS_list[0]); i++) {
@@ -612,6 +612,8 @@ int32_t MODES_CCM_UpdateEx(MODES_CCM_Ctx *modeCtx, const uint8_t *in, uint32_t i
         case CRYPT_CIPHER_AES192_CCM:
         case CRYPT_CIPHER_AES256_CCM:
             return AES_CCM_Update(modeCtx, in, inLen, out, outLen);
+        case CRYPT_CIPHER_SM4_CCM:
+            return SM4_CCM_Update(modeCtx, in, inLen, out, outLen);
         default:
             return MODES_CCM_Update(modeCtx, in, inLen, out, outLen);
     }
@@ -502,10 +502,12 @@ int32_t MODES_GCM_DeInitCtx(MODES_GCM_Ctx *modeCtx)
         return CRYPT_NULL_INPUT;
     }
 
+    int32_t algId = modeCtx->algId; // keeps the UpdateEx dispatch to the algorithm-specific implementation
     void *ciphCtx = modeCtx->gcmCtx.ciphCtx;
     const EAL_SymMethod *ciphMeth = modeCtx->gcmCtx.ciphMeth;
     BSL_SAL_CleanseData((void *)(ciphCtx), ciphMeth->ctxSize);
     BSL_SAL_CleanseData((void *)(modeCtx), sizeof(MODES_GCM_Ctx));
+    modeCtx->algId = algId;
     modeCtx->gcmCtx.ciphCtx = ciphCtx;
     modeCtx->gcmCtx.ciphMeth = ciphMeth;
     return CRYPT_SUCCESS;
@@ -78,6 +78,7 @@ typedef struct {
 struct ModesXTSCtx {
     int32_t algId;
     MODES_CipherXTSCtx xtsCtx;
+    uint32_t dataUnitLen;   /* 0: the input of one update is a single data unit */
     bool enc;
 };
 
@@ -249,6 +250,7 @@ int32_t MODES_GCM_SetIv(MODES_CipherGCMCtx *ctx, const uint8_t *iv, uint32_t ivL
 // xts
 int32_t MODES_XTS_CheckPara(const uint8_t *key, uint32_t len, const uint8_t *iv);
 int32_t MODES_XTS_SetIv(MODES_CipherXTSCtx *ctx, const uint8_t *val, uint32_t len);
+void GF128Mul_IEEE(uint8_t *a, uint32_t len);
 
 int32_t MODES_SetPaddingCheck(int32_t pad);
 
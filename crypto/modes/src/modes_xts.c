@@ -28,6 +28,8 @@
 
 #define MODES_XTS_BLOCKSIZE 16
 #define SM4_XTS_POLYNOMIAL 0xE1
+#define AES_XTS_POLYNOMIAL 0x87
+#define XTS_MAX_DATA_UNIT_LEN (1u << 24) // IEEE 1619 limits a data unit to 2^20 blocks
 #define XTS_UPDATE_VALUES(l, i, o, len) \
     do { \
         (l) -= (len); \
@@ -106,6 +108,37 @@ void GF128Mul_GM(uint8_t *a, uint32_t len)
     }
 }
 
+// IEEE 1619: the tweak is a little-endian 128-bit value and is multiplied by the primitive element alpha.
+void GF128Mul_IEEE(uint8_t *a, uint32_t len)
+{
+    uint8_t in = 0;
+    uint8_t out = 0;
+
+    for (uint32_t j = 0; j < len; j++) {
+        out = (a[j] >> 7) & 0x01; // the highest bit is carried into the next byte
+        a[j] = (uint8_t)((a[j] << 1) + in) & 0xFFu;
+        in = out;
+    }
+    if (out > 0) {
+        a[0] ^= AES_XTS_POLYNOMIAL; // x^128 = x^7 + x^2 + x + 1
+    }
+}
+
+static int32_t XTS_TweakMul(MODES_CipherXTSCtx *ctx)
+{
+    switch (ctx->ciphMeth->algId) {
+        case CRYPT_SYM_SM4:
+            GF128Mul_GM(ctx->tweak, ctx->blockSize);
+            return CRYPT_SUCCESS;
+        case CRYPT_SYM_AES128:
+        case CRYPT_SYM_AES256:
+            GF128Mul_IEEE(ctx->tweak, ctx->blockSize);
+            return CRYPT_SUCCESS;
+        default:
+            return CRYPT_NOT_SUPPORT;
+    }
+}
+
 int32_t BlockCrypt(MODES_CipherXTSCtx *ctx, const uint8_t *in, const uint8_t *t, uint8_t *pp, bool enc)
 {
     int32_t ret;
@@ -140,11 +173,8 @@ int32_t BlocksCrypt(MODES_CipherXTSCtx *ctx, const uint8_t **in, uint8_t **out,
         }
 
         XTS_UPDATE_VALUES(*tmpLen, tmpIn, tmpOut, blockSize);
-        if (ctx->ciphMeth->algId == CRYPT_SYM_SM4) {
-            GF128Mul_GM(ctx->tweak, blockSize);
-        } else {
-            return CRYPT_NOT_SUPPORT;
-        }
+        ret = XTS_TweakMul(ctx);
+        RETURN_RET_IF(ret != CRYPT_SUCCESS, ret);
     }
     *in = tmpIn;
     *out = tmpOut;
@@ -175,11 +205,8 @@ int32_t MODES_XTS_Encrypt(MODES_CipherXTSCtx *ctx, const uint8_t *in, uint8_t *o
     RETURN_RET_IF(ret != CRYPT_SUCCESS, ret);
     XTS_UPDATE_VALUES(tmpLen, tmpIn, tmpOut, blockSize);
 
-        if (ctx->ciphMeth->algId == CRYPT_SYM_SM4) {
-        GF128Mul_GM(ctx->tweak, blockSize);
-        } else {
-            return CRYPT_NOT_SUPPORT;
-        }
+    ret = XTS_TweakMul(ctx);
+    RETURN_RET_IF(ret != CRYPT_SUCCESS, ret);
     if (tmpLen == 0) {
         return CRYPT_SUCCESS;
     }
@@ -187,8 +214,8 @@ int32_t MODES_XTS_Encrypt(MODES_CipherXTSCtx *ctx, const uint8_t *in, uint8_t *o
     lastBlock = tmpOut - blockSize;
     // Process the subsequent two pieces of data.
     for (i = 0; i < tmpLen; i++) {
+        pp[i] = tmpIn[i]; // read before write, the output may overlap the input
         tmpOut[i] = lastBlock[i];
-        pp[i] = tmpIn[i];
     }
 
     for (i = tmpLen; i < blockSize; i++) {
@@ -233,28 +260,21 @@ int32_t MODES_XTS_Decrypt(MODES_CipherXTSCtx *ctx, const uint8_t *in, uint8_t *o
             BSL_ERR_PUSH_ERROR(ret);
             return ret;
         }
-        if (ctx->ciphMeth->algId == CRYPT_SYM_SM4) {
-            GF128Mul_GM(ctx->tweak, blockSize);
-        } else {
-            return CRYPT_NOT_SUPPORT;
-        }
-        return CRYPT_SUCCESS;
+        return XTS_TweakMul(ctx);
     }
 
     (void)memcpy_s(t2, MODES_XTS_BLOCKSIZE, ctx->tweak, blockSize);
 
-    if (ctx->ciphMeth->algId == CRYPT_SYM_SM4) {
-        GF128Mul_GM(ctx->tweak, blockSize);
-    } else {
-        return CRYPT_NOT_SUPPORT;
-    }
+    ret = XTS_TweakMul(ctx);
+    RETURN_RET_IF(ret != CRYPT_SUCCESS, ret);
     ret = BlockCrypt(ctx, tmpIn, ctx->tweak, pp, false);
     RETURN_RET_IF(ret != CRYPT_SUCCESS, ret);
     tmpLen -= blockSize;
 
     for (i = 0; i < tmpLen; i++) {
+        uint8_t c = tmpIn[i + blockSize]; // read before write, the output may overlap the input
         tmpOut[i + blockSize] = pp[i];
-        pp[i] = tmpIn[i + blockSize];
+        pp[i] = c;
     }
 
     ret = BlockCrypt(ctx, pp, t2, pp, false);
@@ -308,6 +328,43 @@ int32_t MODES_XTS_SetIv(MODES_CipherXTSCtx *ctx, const uint8_t *val, uint32_t le
     return CRYPT_SUCCESS;
 }
 
+// Move to the next data unit: the iv is the little-endian data unit sequence number of IEEE 1619.
+static int32_t XTS_NextDataUnit(MODES_CipherXTSCtx *ctx)
+{
+    for (uint32_t i = 0; i < ctx->blockSize; i++) {
+        ctx->iv[i]++;
+        if (ctx->iv[i] != 0) {
+            break;
+        }
+    }
+    int32_t ret = ctx->ciphMeth->encryptBlock((uint8_t*)ctx->ciphCtx + ctx->ciphMeth->ctxSize,
+        ctx->iv, ctx->tweak, ctx->blockSize);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    return CRYPT_SUCCESS;
+}
+
+static int32_t SetDataUnitLen(MODES_XTS_Ctx *modeCtx, const void *val, uint32_t len)
+{
+    if (val == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (len != sizeof(uint32_t)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MODE_ERR_INPUT_LEN);
+        return CRYPT_MODE_ERR_INPUT_LEN;
+    }
+    uint32_t dataUnitLen = *(const uint32_t *)val;
+    if (dataUnitLen != 0 && (dataUnitLen < MODES_XTS_BLOCKSIZE || dataUnitLen > XTS_MAX_DATA_UNIT_LEN)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MODE_ERR_INPUT_LEN);
+        return CRYPT_MODE_ERR_INPUT_LEN;
+    }
+    modeCtx->dataUnitLen = dataUnitLen;
+    return CRYPT_SUCCESS;
+}
+
 static int32_t GetIv(MODES_CipherXTSCtx *ctx, uint8_t *val, uint32_t len)
 {
     if (val == NULL) {
@@ -342,6 +399,8 @@ int32_t MODES_XTS_Ctrl(MODES_XTS_Ctx *modeCtx, int32_t cmd, void *val, uint32_t
             }
             *(int32_t *)val = 1;
             return CRYPT_SUCCESS;
+        case CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN:
+            return SetDataUnitLen(modeCtx, val, len);
         default:
             BSL_ERR_PUSH_ERROR(CRYPT_MODES_CTRL_TYPE_ERROR);
             return CRYPT_MODES_CTRL_TYPE_ERROR;
@@ -448,23 +507,69 @@ int32_t MODES_XTS_InitCtxEx(MODES_XTS_Ctx *modeCtx, const uint8_t *key, uint32_t
     switch (modeCtx->algId) {
         case CRYPT_CIPHER_SM4_XTS:
             return SM4_XTS_InitCtx(modeCtx, key, keyLen, iv, ivLen, enc);
+        case CRYPT_CIPHER_AES128_XTS:
+        case CRYPT_CIPHER_AES256_XTS:
+            return AES_XTS_InitCtx(modeCtx, key, keyLen, iv, ivLen, enc);
         default:
             return MODES_XTS_InitCtx(modeCtx, key, keyLen, iv, ivLen, enc);
     }
 }
 
+typedef int32_t (*XtsUpdate)(MODES_XTS_Ctx *modeCtx, const uint8_t *in, uint32_t inLen, uint8_t *out,
+    uint32_t *outLen);
+
+// Each data unit is processed with its own tweak, derived from the incrementing sequence number in the iv.
+static int32_t XTS_DataUnitsUpdate(MODES_XTS_Ctx *modeCtx, XtsUpdate update, const uint8_t *in, uint32_t inLen,
+    uint8_t *out, uint32_t *outLen)
+{
+    int32_t ret;
+    uint32_t unitLen = modeCtx->dataUnitLen;
+    if (inLen % unitLen != 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MODE_ERR_INPUT_LEN);
+        return CRYPT_MODE_ERR_INPUT_LEN;
+    }
+    if (inLen > *outLen) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MODE_BUFF_LEN_NOT_ENOUGH);
+        return CRYPT_MODE_BUFF_LEN_NOT_ENOUGH;
+    }
+    for (uint32_t offset = 0; offset < inLen; offset += unitLen) {
+        uint32_t tmpLen = unitLen;
+        ret = update(modeCtx, in + offset, unitLen, out + offset, &tmpLen);
+        if (ret != CRYPT_SUCCESS) {
+            return ret;
+        }
+        ret = XTS_NextDataUnit(&modeCtx->xtsCtx);
+        if (ret != CRYPT_SUCCESS) {
+            return ret;
+        }
+    }
+    *outLen = inLen;
+    return CRYPT_SUCCESS;
+}
+
 int32_t MODES_XTS_UpdateEx(MODES_XTS_Ctx *modeCtx, const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen)
 {
     if (modeCtx == NULL) {
         BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
         return CRYPT_NULL_INPUT;
     }
+    XtsUpdate update;
     switch (modeCtx->algId) {
         case CRYPT_CIPHER_SM4_XTS:
-            return SM4_XTS_Update(modeCtx, in, inLen, out, outLen);
+            update = SM4_XTS_Update;
+            break;
+        case CRYPT_CIPHER_AES128_XTS:
+        case CRYPT_CIPHER_AES256_XTS:
+            update = AES_XTS_Update;
+            break;
         default:
-            return MODES_XTS_Update(modeCtx, in, inLen, out, outLen);
+            update = MODES_XTS_Update;
+            break;
+    }
+    if (modeCtx->dataUnitLen == 0) {
+        return update(modeCtx, in, inLen, out, outLen);
     }
+    return XTS_DataUnitsUpdate(modeCtx, update, in, inLen, out, outLen);
 }
 
 #endif // HITLS_CRYPTO_XTS
@@ -125,9 +125,9 @@ int32_t CRYPT_PAILLIER_Gen(CRYPT_PAILLIER_Ctx *ctx);
 
 /**
  * @ingroup paillier
- * @brief Paillier public key encryption
+ * @brief Paillier public key encryption, with a randomizer of the pool when there is one left
  *
- * @param ctx [IN] Paillier context structure
+ * @param ctx [IN/OUT] Paillier context structure
  * @param input [IN] Information to be encrypted
  * @param inputLen [IN] Length of the information to be encrypted
  * @param out [OUT] Pointer to the encrypted information output.
@@ -142,12 +142,12 @@ int32_t CRYPT_PAILLIER_Gen(CRYPT_PAILLIER_Ctx *ctx);
  * @retval BN error                         An error occurs in the internal BigNum operation.
  * @retval CRYPT_SUCCESS                    encryption succeeded.
  */
-int32_t  CRYPT_PAILLIER_PubEnc(const CRYPT_PAILLIER_Ctx *ctx, const uint8_t *input, uint32_t inputLen,
+int32_t CRYPT_PAILLIER_PubEnc(CRYPT_PAILLIER_Ctx *ctx, const uint8_t *input, uint32_t inputLen,
     uint8_t *out, uint32_t *outLen);
 
 /**
  * @ingroup paillier
- * @brief Paillier private key decryption
+ * @brief Paillier private key decryption, modulo p^2 and q^2 when the prime factors are known
  *
  * @param ctx [IN] Paillier context structure
  * @param ciphertext [IN] Information to be decrypted
@@ -283,6 +283,79 @@ int32_t CRYPT_PAILLIER_Decrypt(CRYPT_PAILLIER_Ctx *ctx, const uint8_t *data, uin
  */
 int32_t CRYPT_PAILLIER_GetSecBits(const CRYPT_PAILLIER_Ctx *ctx);
 
+/**
+ * @ingroup paillier
+ * @brief Precompute num more randomizers r^n mod n^2 for the encryption with the public key.
+ *
+ * @param ctx [IN/OUT] PAILLIER context structure
+ * @param num [IN] Number of randomizers to add to the pool
+ *
+ * @retval CRYPT_NULL_INPUT                 Invalid null pointer input
+ * @retval CRYPT_PAILLIER_NO_KEY_INFO       does not contain the public key.
+ * @retval CRYPT_PAILLIER_ERR_INPUT_VALUE   num is 0 or the pool would exceed PAILLIER_MAX_RAND_POOL.
+ * @retval CRYPT_MEM_ALLOC_FAIL             Memory allocation failure
+ * @retval BN error                         An error occurs in the internal BigNum operation, the pool is unchanged.
+ * @retval CRYPT_SUCCESS                    The randomizers are generated.
+ */
+int32_t CRYPT_PAILLIER_GenRandPool(CRYPT_PAILLIER_Ctx *ctx, uint32_t num);
+
+/**
+ * @ingroup paillier
+ * @brief Obtain the number of randomizers left in the pool.
+ *
+ * @param ctx [IN] PAILLIER context structure
+ *
+ * @retval Number of randomizers, 0 if the input is incorrect.
+ */
+uint32_t CRYPT_PAILLIER_GetRandPoolSize(const CRYPT_PAILLIER_Ctx *ctx);
+
+/**
+ * @ingroup paillier
+ * @brief Encrypt the plaintexts batch->in with one Montgomery context of n^2.
+ *
+ * @param ctx [IN/OUT] PAILLIER context structure, the randomizers of the pool are used first
+ * @param batch [IN/OUT] Plaintexts and output ciphertexts, operand is not used
+ *
+ * @retval CRYPT_NULL_INPUT                     Invalid null pointer input
+ * @retval CRYPT_PAILLIER_NO_KEY_INFO           does not contain the public key.
+ * @retval CRYPT_PAILLIER_ERR_ENC_BITS          A plaintext is longer than n.
+ * @retval CRYPT_PAILLIER_ERR_INPUT_VALUE       A plaintext is not lower than n.
+ * @retval CRYPT_PAILLIER_BUFF_LEN_NOT_ENOUGH   An output buffer is insufficient.
+ * @retval CRYPT_MEM_ALLOC_FAIL                 Memory allocation failure
+ * @retval BN error                             An error occurs in the internal BigNum operation.
+ * @retval CRYPT_SUCCESS                        All the elements are processed. On failure, the processing stops
+ *                                              at the failed element.
+ */
+int32_t CRYPT_PAILLIER_EncryptBatch(CRYPT_PAILLIER_Ctx *ctx, const CRYPT_PaillierBatch *batch);
+
+/**
+ * @ingroup paillier
+ * @brief Homomorphic addition, out[i] = in[i] * operand[i] mod n^2 which decrypts to the sum of the plaintexts mod n.
+ *
+ * @param ctx [IN] PAILLIER context structure
+ * @param batch [IN/OUT] Ciphertexts in and operand, output ciphertexts
+ *
+ * @retval CRYPT_PAILLIER_ERR_DEC_BITS          A ciphertext is longer than n^2.
+ * @retval CRYPT_PAILLIER_ERR_INPUT_VALUE       A ciphertext is 0 or not lower than n^2.
+ * @retval Other error codes                    See CRYPT_PAILLIER_EncryptBatch.
+ */
+int32_t CRYPT_PAILLIER_AddBatch(CRYPT_PAILLIER_Ctx *ctx, const CRYPT_PaillierBatch *batch);
+
+/**
+ * @ingroup paillier
+ * @brief Homomorphic multiplication by a scalar, out[i] = in[i] ^ operand[i] mod n^2 with one Montgomery context of
+ *        n^2, which decrypts to the product of the plaintext and the scalar mod n.
+ *
+ * @param ctx [IN] PAILLIER context structure
+ * @param batch [IN/OUT] Ciphertexts in, scalars operand lower than n, output ciphertexts
+ *
+ * @retval CRYPT_PAILLIER_ERR_ENC_BITS          A scalar is longer than n.
+ * @retval CRYPT_PAILLIER_ERR_INPUT_VALUE       A scalar is not lower than n, or a ciphertext is 0 or not lower
+ *                                              than n^2.
+ * @retval Other error codes                    See CRYPT_PAILLIER_EncryptBatch.
+ */
+int32_t CRYPT_PAILLIER_MulBatch(CRYPT_PAILLIER_Ctx *ctx, const CRYPT_PaillierBatch *batch);
+
 /**
  * @ingroup paillier
  * @brief PAILLIER control function for various operations
@@ -0,0 +1,283 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#ifdef HITLS_CRYPTO_PAILLIER
+
+#include "crypt_utils.h"
+#include "crypt_paillier.h"
+#include "paillier_local.h"
+#include "crypt_errno.h"
+#include "bsl_sal.h"
+#include "securec.h"
+#include "bsl_err_internal.h"
+
+typedef enum {
+    PAILLIER_BATCH_ENCRYPT,
+    PAILLIER_BATCH_ADD,
+    PAILLIER_BATCH_MUL
+} PAILLIER_BatchType;
+
+void PAILLIER_FreeRandPool(CRYPT_PAILLIER_RandPool *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    for (uint32_t i = 0; i < pool->num; i++) {
+        BN_Destroy(pool->rn[i]);
+    }
+    BSL_SAL_Free(pool->rn);
+    BSL_SAL_Free(pool);
+}
+
+static int32_t PaillierRandPoolGrow(CRYPT_PAILLIER_RandPool *pool, const CRYPT_PAILLIER_PubKey *pubKey,
+    uint32_t num)
+{
+    uint32_t total = pool->num + num;
+    BN_BigNum **rn = (BN_BigNum **)BSL_SAL_Calloc(total, sizeof(BN_BigNum *));
+    BN_Optimizer *optimizer = BN_OptimizerCreate();
+    BN_Mont *mont = BN_MontCreate(pubKey->n2);
+    int32_t ret = CRYPT_SUCCESS;
+    if (rn == NULL || optimizer == NULL || mont == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        ret = CRYPT_MEM_ALLOC_FAIL;
+        goto OUT;
+    }
+    for (uint32_t i = pool->num; i < total; i++) {
+        rn[i] = BN_Create(BN_Bits(pubKey->n2));
+        if (rn[i] == NULL) {
+            BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+            ret = CRYPT_MEM_ALLOC_FAIL;
+            goto OUT;
+        }
+        // All the randomizers share one Montgomery context of n^2.
+        ret = Paillier_GenRandomizer(pubKey, rn[i], mont, optimizer);
+        if (ret != CRYPT_SUCCESS) {
+            goto OUT;
+        }
+    }
+    for (uint32_t j = 0; j < pool->num; j++) {
+        rn[j] = pool->rn[j];
+    }
+    BSL_SAL_Free(pool->rn);
+    pool->rn = rn;
+    pool->num = total;
+    rn = NULL;
+OUT:
+    if (rn != NULL) {
+        // The pool keeps its previous randomizers when the generation fails.
+        for (uint32_t j = pool->num; j < total; j++) {
+            BN_Destroy(rn[j]);
+        }
+        BSL_SAL_Free(rn);
+    }
+    BN_MontDestroy(mont);
+    BN_OptimizerDestroy(optimizer);
+    return ret;
+}
+
+int32_t CRYPT_PAILLIER_GenRandPool(CRYPT_PAILLIER_Ctx *ctx, uint32_t num)
+{
+    if (ctx == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (ctx->pubKey == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_NO_KEY_INFO);
+        return CRYPT_PAILLIER_NO_KEY_INFO;
+    }
+    uint32_t cur = (ctx->pool == NULL) ? 0 : ctx->pool->num;
+    if (num == 0 || num > PAILLIER_MAX_RAND_POOL - cur) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_INPUT_VALUE);
+        return CRYPT_PAILLIER_ERR_INPUT_VALUE;
+    }
+    if (ctx->pool == NULL) {
+        ctx->pool = (CRYPT_PAILLIER_RandPool *)BSL_SAL_Calloc(1, sizeof(CRYPT_PAILLIER_RandPool));
+        if (ctx->pool == NULL) {
+            BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+            return CRYPT_MEM_ALLOC_FAIL;
+        }
+    }
+    return PaillierRandPoolGrow(ctx->pool, ctx->pubKey, num);
+}
+
+uint32_t CRYPT_PAILLIER_GetRandPoolSize(const CRYPT_PAILLIER_Ctx *ctx)
+{
+    if (ctx == NULL || ctx->pool == NULL) {
+        return 0;
+    }
+    return ctx->pool->num;
+}
+
+static int32_t PaillierBatchCheck(const CRYPT_PAILLIER_Ctx *ctx, const CRYPT_PaillierBatch *batch,
+    PAILLIER_BatchType type)
+{
+    if (ctx == NULL || batch == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (batch->num == 0) {
+        return CRYPT_SUCCESS;
+    }
+    if (batch->in == NULL || batch->inLen == NULL || batch->out == NULL || batch->outLen == NULL ||
+        (type != PAILLIER_BATCH_ENCRYPT && (batch->operand == NULL || batch->operandLen == NULL))) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (ctx->pubKey == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_NO_KEY_INFO);
+        return CRYPT_PAILLIER_NO_KEY_INFO;
+    }
+    return CRYPT_SUCCESS;
+}
+
+/* A plaintext or a scalar, 0 <= a < n */
+static int32_t PaillierBatchGetPlain(const CRYPT_PAILLIER_PubKey *pubKey, BN_BigNum *a, const uint8_t *in,
+    uint32_t inLen)
+{
+    if (in == NULL && inLen != 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (inLen > BN_Bytes(pubKey->n)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_ENC_BITS);
+        return CRYPT_PAILLIER_ERR_ENC_BITS;
+    }
+    int32_t ret = BN_Bin2Bn(a, in, inLen);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    if (BN_Cmp(a, pubKey->n) >= 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_INPUT_VALUE);
+        return CRYPT_PAILLIER_ERR_INPUT_VALUE;
+    }
+    return CRYPT_SUCCESS;
+}
+
+/* A ciphertext, 0 < c < n^2 */
+static int32_t PaillierBatchGetCipher(const CRYPT_PAILLIER_PubKey *pubKey, BN_BigNum *c, const uint8_t *in,
+    uint32_t inLen, uint32_t cipherLen)
+{
+    if (in == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (inLen > cipherLen) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_DEC_BITS);
+        return CRYPT_PAILLIER_ERR_DEC_BITS;
+    }
+    int32_t ret = BN_Bin2Bn(c, in, inLen);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    if (BN_IsZero(c) || BN_Cmp(c, pubKey->n2) >= 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_INPUT_VALUE);
+        return CRYPT_PAILLIER_ERR_INPUT_VALUE;
+    }
+    return CRYPT_SUCCESS;
+}
+
+static int32_t PaillierBatchOne(CRYPT_PAILLIER_Ctx *ctx, const CRYPT_PaillierBatch *batch, uint32_t i,
+    PAILLIER_BatchType type, BN_BigNum *tmp[3], BN_Mont *mont, BN_Optimizer *optimizer)
+{
+    const CRYPT_PAILLIER_PubKey *pubKey = ctx->pubKey;
+    // Ciphertexts have the fixed length accepted by CRYPT_PAILLIER_Decrypt.
+    uint32_t cipherLen = BN_BITS_TO_BYTES(BN_Bits(pubKey->n)) * 2;
+    BN_BigNum *a = tmp[0];
+    BN_BigNum *b = tmp[1];
+    BN_BigNum *r = tmp[2];
+    int32_t ret;
+    if (batch->out[i] == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (batch->outLen[i] < cipherLen) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_BUFF_LEN_NOT_ENOUGH);
+        return CRYPT_PAILLIER_BUFF_LEN_NOT_ENOUGH;
+    }
+    switch (type) {
+        case PAILLIER_BATCH_ENCRYPT:
+            GOTO_ERR_IF_EX(PaillierBatchGetPlain(pubKey, a, batch->in[i], batch->inLen[i]), ret);
+            GOTO_ERR_IF_EX(Paillier_EncryptBn(ctx, r, a, mont, optimizer), ret);
+            break;
+        case PAILLIER_BATCH_ADD:
+            // E(m1) * E(m2) = E(m1 + m2)
+            GOTO_ERR_IF_EX(PaillierBatchGetCipher(pubKey, a, batch->in[i], batch->inLen[i], cipherLen), ret);
+            GOTO_ERR_IF_EX(PaillierBatchGetCipher(pubKey, b, batch->operand[i], batch->operandLen[i], cipherLen),
+                ret);
+            GOTO_ERR_IF(BN_ModMul(r, a, b, pubKey->n2, optimizer), ret);
+            break;
+        default:
+            // E(m)^k = E(k * m)
+            GOTO_ERR_IF_EX(PaillierBatchGetCipher(pubKey, a, batch->in[i], batch->inLen[i], cipherLen), ret);
+            GOTO_ERR_IF_EX(PaillierBatchGetPlain(pubKey, b, batch->operand[i], batch->operandLen[i]), ret);
+            GOTO_ERR_IF(BN_MontExp(r, a, b, mont, optimizer), ret);
+            break;
+    }
+    GOTO_ERR_IF(BN_Bn2BinFixZero(r, batch->out[i], cipherLen), ret);
+    batch->outLen[i] = cipherLen;
+ERR:
+    return ret;
+}
+
+static int32_t PaillierBatch(CRYPT_PAILLIER_Ctx *ctx, const CRYPT_PaillierBatch *batch, PAILLIER_BatchType type)
+{
+    int32_t ret = PaillierBatchCheck(ctx, batch, type);
+    if (ret != CRYPT_SUCCESS || batch->num == 0) {
+        return ret;
+    }
+    uint32_t bits = BN_Bits(ctx->pubKey->n2);
+    BN_Optimizer *optimizer = BN_OptimizerCreate();
+    BN_Mont *mont = BN_MontCreate(ctx->pubKey->n2);
+    BN_BigNum *tmp[3] = {BN_Create(bits), BN_Create(bits), BN_Create(bits)};
+    if (optimizer == NULL || mont == NULL || tmp[0] == NULL || tmp[1] == NULL || tmp[2] == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        ret = CRYPT_MEM_ALLOC_FAIL;
+        goto OUT;
+    }
+    // One Montgomery context of n^2 serves the whole vector.
+    for (uint32_t i = 0; i < batch->num; i++) {
+        ret = PaillierBatchOne(ctx, batch, i, type, tmp, mont, optimizer);
+        if (ret != CRYPT_SUCCESS) {
+            break;
+        }
+    }
+OUT:
+    BN_Destroy(tmp[0]);
+    BN_Destroy(tmp[1]);
+    BN_Destroy(tmp[2]);
+    BN_MontDestroy(mont);
+    BN_OptimizerDestroy(optimizer);
+    return ret;
+}
+
+int32_t CRYPT_PAILLIER_EncryptBatch(CRYPT_PAILLIER_Ctx *ctx, const CRYPT_PaillierBatch *batch)
+{
+    return PaillierBatch(ctx, batch, PAILLIER_BATCH_ENCRYPT);
+}
+
+int32_t CRYPT_PAILLIER_AddBatch(CRYPT_PAILLIER_Ctx *ctx, const CRYPT_PaillierBatch *batch)
+{
+    return PaillierBatch(ctx, batch, PAILLIER_BATCH_ADD);
+}
+
+int32_t CRYPT_PAILLIER_MulBatch(CRYPT_PAILLIER_Ctx *ctx, const CRYPT_PaillierBatch *batch)
+{
+    return PaillierBatch(ctx, batch, PAILLIER_BATCH_MUL);
+}
+
+#endif // HITLS_CRYPTO_PAILLIER
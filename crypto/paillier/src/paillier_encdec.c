@@ -24,59 +24,54 @@
 #include "securec.h"
 #include "bsl_err_internal.h"
 
-int32_t  CRYPT_PAILLIER_PubEnc(const CRYPT_PAILLIER_Ctx *ctx, const uint8_t *input, uint32_t inputLen,
-    uint8_t *out, uint32_t *outLen)
+/* gm = g^m mod n^2, which is 1 + m * n when g = n + 1 */
+static int32_t Paillier_CalcGm(const CRYPT_PAILLIER_PubKey *pubKey, BN_BigNum *gm, const BN_BigNum *m,
+    BN_Mont *mont, BN_Optimizer *optimizer)
 {
-    int32_t ret;
-    CRYPT_PAILLIER_PubKey *pubKey = ctx->pubKey;
-    if (pubKey == NULL) {
-        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
-        return CRYPT_NULL_INPUT;
-    }
-
-    uint32_t bits = CRYPT_PAILLIER_GetBits(ctx);
-    BN_Optimizer *optimizer = BN_OptimizerCreate();
-    if (optimizer == NULL) {
-        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
-        return CRYPT_MEM_ALLOC_FAIL;
+    int32_t ret = BN_AddLimb(gm, pubKey->n, 1);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
     }
-
-    BN_BigNum *m = BN_Create(bits);
-    BN_BigNum *r = BN_Create(bits);
-
-    BN_BigNum *gm = BN_Create(bits);
-    BN_BigNum *rn = BN_Create(bits);
-
-    BN_BigNum *result = BN_Create(bits);
-    BN_BigNum *gcd_result = BN_Create(bits);
-
-    bool createFailed = (m == NULL || r == NULL || gm == NULL || rn == NULL || result == NULL || gcd_result == NULL);
-    if (createFailed) {
-        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
-        ret = CRYPT_MEM_ALLOC_FAIL;
-        goto OUT;
+    if (BN_Cmp(gm, pubKey->g) != 0) {
+        ret = BN_MontExp(gm, pubKey->g, m, mont, optimizer);
+        if (ret != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+        }
+        return ret;
     }
-
-    ret = BN_Bin2Bn(m, input, inputLen);
+    // m < n, so 1 + m * n < n^2 needs no reduction.
+    ret = BN_Mul(gm, m, pubKey->n, optimizer);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
-        goto OUT;
-    }
-
-    // Check whether m is less than n and non-negative
-    if (BN_Cmp(m, pubKey->n) >= 0 || BN_IsNegative(m)) {
-        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_INPUT_VALUE);
-        ret = CRYPT_PAILLIER_ERR_INPUT_VALUE;
-        goto OUT;
+        return ret;
     }
-
-    ret = BN_RandRange(r, pubKey->n);
+    ret = BN_AddLimb(gm, gm, 1);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
+    }
+    return ret;
+}
+
+int32_t Paillier_GenRandomizer(const CRYPT_PAILLIER_PubKey *pubKey, BN_BigNum *rn, BN_Mont *mont,
+    BN_Optimizer *optimizer)
+{
+    uint32_t bits = BN_Bits(pubKey->n);
+    BN_BigNum *r = BN_Create(bits);
+    BN_BigNum *gcd_result = BN_Create(bits);
+    int32_t ret;
+    if (r == NULL || gcd_result == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        ret = CRYPT_MEM_ALLOC_FAIL;
         goto OUT;
     }
 
     while (true) {
+        ret = BN_RandRange(r, pubKey->n);
+        if (ret != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            goto OUT;
+        }
         // Check whether r is relatively prime to n, if not, regenerate r
         ret = BN_Gcd(gcd_result, r, pubKey->n, optimizer);
         if (ret != CRYPT_SUCCESS) {
@@ -86,47 +81,195 @@ int32_t  CRYPT_PAILLIER_PubEnc(const CRYPT_PAILLIER_Ctx *ctx, const uint8_t *inp
         if (BN_IsOne(gcd_result)) {
             break;
         }
-        ret = BN_RandRange(r, pubKey->n);
+    }
+
+    ret = BN_MontExp(rn, r, pubKey->n, mont, optimizer);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+    }
+OUT :
+    BN_Destroy(r);
+    BN_Destroy(gcd_result);
+    return ret;
+}
+
+int32_t Paillier_EncryptBn(CRYPT_PAILLIER_Ctx *ctx, BN_BigNum *c, const BN_BigNum *m, BN_Mont *mont,
+    BN_Optimizer *optimizer)
+{
+    CRYPT_PAILLIER_PubKey *pubKey = ctx->pubKey;
+    BN_BigNum *gm = BN_Create(BN_Bits(pubKey->n2));
+    BN_BigNum *rn = NULL;
+    int32_t ret;
+    if (gm == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    if (ctx->pool != NULL && ctx->pool->num > 0) {
+        // A precomputed randomizer is used once and released.
+        ctx->pool->num--;
+        rn = ctx->pool->rn[ctx->pool->num];
+        ctx->pool->rn[ctx->pool->num] = NULL;
+    } else {
+        rn = BN_Create(BN_Bits(pubKey->n2));
+        if (rn == NULL) {
+            BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+            ret = CRYPT_MEM_ALLOC_FAIL;
+            goto OUT;
+        }
+        ret = Paillier_GenRandomizer(pubKey, rn, mont, optimizer);
         if (ret != CRYPT_SUCCESS) {
-            BSL_ERR_PUSH_ERROR(ret);
             goto OUT;
         }
     }
 
-    ret = BN_ModExp(gm, pubKey->g, m, pubKey->n2, optimizer);
+    ret = Paillier_CalcGm(pubKey, gm, m, mont, optimizer);
     if (ret != CRYPT_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
         goto OUT;
     }
 
-    ret = BN_ModExp(rn, r, pubKey->n, pubKey->n2, optimizer);
+    ret = BN_ModMul(c, gm, rn, pubKey->n2, optimizer);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
+    }
+OUT :
+    BN_Destroy(gm);
+    BN_Destroy(rn);
+    return ret;
+}
+
+int32_t CRYPT_PAILLIER_PubEnc(CRYPT_PAILLIER_Ctx *ctx, const uint8_t *input, uint32_t inputLen,
+    uint8_t *out, uint32_t *outLen)
+{
+    int32_t ret;
+    CRYPT_PAILLIER_PubKey *pubKey = ctx->pubKey;
+    if (pubKey == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+
+    uint32_t bits = CRYPT_PAILLIER_GetBits(ctx);
+    uint32_t cipherLen = BN_BITS_TO_BYTES(bits) * 2;
+    BN_Optimizer *optimizer = BN_OptimizerCreate();
+    BN_Mont *mont = BN_MontCreate(pubKey->n2);
+    BN_BigNum *m = BN_Create(bits);
+    BN_BigNum *result = BN_Create(bits);
+
+    bool createFailed = (optimizer == NULL || mont == NULL || m == NULL || result == NULL);
+    if (createFailed) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        ret = CRYPT_MEM_ALLOC_FAIL;
         goto OUT;
     }
 
-    ret = BN_ModMul(result, gm, rn, pubKey->n2, optimizer);
+    ret = BN_Bin2Bn(m, input, inputLen);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
         goto OUT;
     }
 
-    ret = BN_Bn2Bin(result, out, outLen);
+    // Check whether m is less than n and non-negative
+    if (BN_Cmp(m, pubKey->n) >= 0 || BN_IsNegative(m)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_INPUT_VALUE);
+        ret = CRYPT_PAILLIER_ERR_INPUT_VALUE;
+        goto OUT;
+    }
+
+    ret = Paillier_EncryptBn(ctx, result, m, mont, optimizer);
+    if (ret != CRYPT_SUCCESS) {
+        goto OUT;
+    }
+
+    // The ciphertext always takes the full length of n^2, which is what decryption expects.
+    if (*outLen < cipherLen) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_BUFF_LEN_NOT_ENOUGH);
+        ret = CRYPT_PAILLIER_BUFF_LEN_NOT_ENOUGH;
+        goto OUT;
+    }
+    ret = BN_Bn2BinFixZero(result, out, cipherLen);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
         goto OUT;
     }
+    *outLen = cipherLen;
 OUT :
     BN_Destroy(m);
-    BN_Destroy(r);
-    BN_Destroy(gm);
-    BN_Destroy(rn);
     BN_Destroy(result);
-    BN_Destroy(gcd_result);
+    BN_MontDestroy(mont);
     BN_OptimizerDestroy(optimizer);
     return ret;
 }
 
+/* mp = L_p(c^(p-1) mod p^2) * hp mod p, which is m mod p */
+static int32_t PaillierCrtDecPart(BN_BigNum *mp, const BN_BigNum *c, const BN_BigNum *prime,
+    const BN_BigNum *prime2, const BN_BigNum *exp, const BN_BigNum *h, BN_Optimizer *optimizer)
+{
+    uint32_t bits = BN_Bits(prime2);
+    BN_BigNum *base = BN_Create(bits);
+    BN_BigNum *x = BN_Create(bits);
+    BN_Mont *mont = BN_MontCreate(prime2);
+    int32_t ret;
+    if (base == NULL || x == NULL || mont == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        ret = CRYPT_MEM_ALLOC_FAIL;
+        goto ERR;
+    }
+    GOTO_ERR_IF(BN_Mod(base, c, prime2, optimizer), ret);
+    // The exponent depends on the prime factor.
+    GOTO_ERR_IF(BN_MontExpConsttime(x, base, exp, mont, optimizer), ret);
+    GOTO_ERR_IF(BN_SubLimb(x, x, 1), ret);
+    GOTO_ERR_IF(BN_Div(x, NULL, x, prime, optimizer), ret);
+    GOTO_ERR_IF(BN_ModMul(mp, x, h, prime, optimizer), ret);
+ERR:
+    BN_Destroy(base);
+    BN_Destroy(x);
+    BN_MontDestroy(mont);
+    return ret;
+}
+
+/* m = mp + p * ((mq - mp) * p^-1 mod q) */
+static int32_t PaillierCrtDec(const CRYPT_PAILLIER_CrtPara *crt, BN_BigNum *m, const BN_BigNum *c,
+    BN_Optimizer *optimizer)
+{
+    uint32_t bits = BN_Bits(crt->p2);
+    BN_BigNum *mp = BN_Create(bits);
+    BN_BigNum *mq = BN_Create(bits);
+    int32_t ret;
+    if (mp == NULL || mq == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        ret = CRYPT_MEM_ALLOC_FAIL;
+        goto ERR;
+    }
+    GOTO_ERR_IF(PaillierCrtDecPart(mp, c, crt->p, crt->p2, crt->pMinus1, crt->hp, optimizer), ret);
+    GOTO_ERR_IF(PaillierCrtDecPart(mq, c, crt->q, crt->q2, crt->qMinus1, crt->hq, optimizer), ret);
+    GOTO_ERR_IF(BN_ModSub(mq, mq, mp, crt->q, optimizer), ret);
+    GOTO_ERR_IF(BN_ModMul(mq, mq, crt->pInv, crt->q, optimizer), ret);
+    GOTO_ERR_IF(BN_Mul(m, mq, crt->p, optimizer), ret);
+    GOTO_ERR_IF(BN_Add(m, m, mp), ret);
+ERR:
+    BN_Destroy(mp);
+    BN_Destroy(mq);
+    return ret;
+}
+
+/* m = L(c^lambda mod n^2) * mu mod n */
+static int32_t PaillierLambdaDec(const CRYPT_PAILLIER_PrvKey *prvKey, BN_BigNum *m, const BN_BigNum *c,
+    BN_Optimizer *optimizer)
+{
+    BN_BigNum *x = BN_Create(BN_Bits(prvKey->n2));
+    if (x == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    int32_t ret;
+    GOTO_ERR_IF(BN_ModExp(x, c, prvKey->lambda, prvKey->n2, optimizer), ret);
+    GOTO_ERR_IF(BN_SubLimb(x, x, 1), ret);
+    GOTO_ERR_IF(BN_Div(x, NULL, x, prvKey->n, optimizer), ret);
+    GOTO_ERR_IF(BN_ModMul(m, x, prvKey->mu, prvKey->n, optimizer), ret);
+ERR:
+    BN_Destroy(x);
+    return ret;
+}
+
 int32_t CRYPT_PAILLIER_PrvDec(const CRYPT_PAILLIER_Ctx *ctx, const BN_BigNum *ciphertext, uint32_t bits,
     uint8_t *out, uint32_t *outLen)
 {
@@ -143,38 +286,20 @@ int32_t CRYPT_PAILLIER_PrvDec(const CRYPT_PAILLIER_Ctx *ctx, const BN_BigNum *ci
         return CRYPT_MEM_ALLOC_FAIL;
     }
 
-    BN_BigNum *m = BN_Create(bits);
     BN_BigNum *result = BN_Create(bits);
-
-    bool createFailed = (m == NULL || result == NULL);
-    
-    if (createFailed) {
+    if (result == NULL) {
         BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
         ret = CRYPT_MEM_ALLOC_FAIL;
         goto OUT;
     }
 
-    ret = BN_ModExp(m, ciphertext, prvKey->lambda, prvKey->n2, optimizer);
-    if (ret != CRYPT_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        goto OUT;
+    if (prvKey->crt != NULL) {
+        // Two exponentiations modulo p^2 and q^2 with half-length exponents replace lambda modulo n^2.
+        ret = PaillierCrtDec(prvKey->crt, result, ciphertext, optimizer);
+    } else {
+        ret = PaillierLambdaDec(prvKey, result, ciphertext, optimizer);
     }
-
-    ret = BN_SubLimb(result, m, 1);
     if (ret != CRYPT_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        goto OUT;
-    }
-
-    ret = BN_Div(result, NULL, result, prvKey->n, optimizer);
-    if (ret != CRYPT_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        goto OUT;
-    }
-
-    ret = BN_ModMul(result, result, prvKey->mu, prvKey->n, optimizer);
-    if (ret != CRYPT_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
         goto OUT;
     }
 
@@ -184,7 +309,6 @@ int32_t CRYPT_PAILLIER_PrvDec(const CRYPT_PAILLIER_Ctx *ctx, const BN_BigNum *ci
         goto OUT;
     }
 OUT :
-    BN_Destroy(m);
     BN_Destroy(result);
     BN_OptimizerDestroy(optimizer);
     return ret;
@@ -339,6 +463,21 @@ static int32_t CRYPT_PAILLIER_GetLen(const CRYPT_PAILLIER_Ctx *ctx, GetLenFunc f
     return CRYPT_SUCCESS;
 }
 
+static int32_t CRYPT_PAILLIER_BatchCtrl(CRYPT_PAILLIER_Ctx *ctx, int32_t opt, void *val, uint32_t len)
+{
+    if (val == NULL || len != sizeof(CRYPT_PaillierBatch)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (opt == CRYPT_CTRL_PAILLIER_ENCRYPT_BATCH) {
+        return CRYPT_PAILLIER_EncryptBatch(ctx, val);
+    }
+    if (opt == CRYPT_CTRL_PAILLIER_ADD_BATCH) {
+        return CRYPT_PAILLIER_AddBatch(ctx, val);
+    }
+    return CRYPT_PAILLIER_MulBatch(ctx, val);
+}
+
 int32_t CRYPT_PAILLIER_Ctrl(CRYPT_PAILLIER_Ctx *ctx, int32_t opt, void *val, uint32_t len)
 {
     if (ctx == NULL) {
@@ -350,6 +489,18 @@ int32_t CRYPT_PAILLIER_Ctrl(CRYPT_PAILLIER_Ctx *ctx, int32_t opt, void *val, uin
             return CRYPT_PAILLIER_GetLen(ctx, (GetLenFunc)CRYPT_PAILLIER_GetBits, val, len);
         case CRYPT_CTRL_GET_SECBITS:
             return CRYPT_PAILLIER_GetLen(ctx, (GetLenFunc)CRYPT_PAILLIER_GetSecBits, val, len);
+        case CRYPT_CTRL_GEN_PAILLIER_RAND_POOL:
+            if (val == NULL || len != sizeof(uint32_t)) {
+                BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+                return CRYPT_NULL_INPUT;
+            }
+            return CRYPT_PAILLIER_GenRandPool(ctx, *(uint32_t *)val);
+        case CRYPT_CTRL_GET_PAILLIER_RAND_POOL_SIZE:
+            return CRYPT_PAILLIER_GetLen(ctx, (GetLenFunc)CRYPT_PAILLIER_GetRandPoolSize, val, len);
+        case CRYPT_CTRL_PAILLIER_ENCRYPT_BATCH:
+        case CRYPT_CTRL_PAILLIER_ADD_BATCH:
+        case CRYPT_CTRL_PAILLIER_MUL_BATCH:
+            return CRYPT_PAILLIER_BatchCtrl(ctx, opt, val, len);
         default:
             BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_CTRL_NOT_SUPPORT_ERROR);
             return CRYPT_PAILLIER_CTRL_NOT_SUPPORT_ERROR;
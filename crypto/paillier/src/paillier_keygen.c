@@ -62,6 +62,30 @@ ERR :
     return NULL;
 }
 
+static CRYPT_PAILLIER_CrtPara *PaillierCrtParaDup(const CRYPT_PAILLIER_CrtPara *crt)
+{
+    CRYPT_PAILLIER_CrtPara *newCrt = (CRYPT_PAILLIER_CrtPara *)BSL_SAL_Calloc(1, sizeof(CRYPT_PAILLIER_CrtPara));
+    if (newCrt == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return NULL;
+    }
+
+    GOTO_ERR_IF_SRC_NOT_NULL(newCrt->p, crt->p, BN_Dup(crt->p), CRYPT_MEM_ALLOC_FAIL);
+    GOTO_ERR_IF_SRC_NOT_NULL(newCrt->q, crt->q, BN_Dup(crt->q), CRYPT_MEM_ALLOC_FAIL);
+    GOTO_ERR_IF_SRC_NOT_NULL(newCrt->p2, crt->p2, BN_Dup(crt->p2), CRYPT_MEM_ALLOC_FAIL);
+    GOTO_ERR_IF_SRC_NOT_NULL(newCrt->q2, crt->q2, BN_Dup(crt->q2), CRYPT_MEM_ALLOC_FAIL);
+    GOTO_ERR_IF_SRC_NOT_NULL(newCrt->pMinus1, crt->pMinus1, BN_Dup(crt->pMinus1), CRYPT_MEM_ALLOC_FAIL);
+    GOTO_ERR_IF_SRC_NOT_NULL(newCrt->qMinus1, crt->qMinus1, BN_Dup(crt->qMinus1), CRYPT_MEM_ALLOC_FAIL);
+    GOTO_ERR_IF_SRC_NOT_NULL(newCrt->hp, crt->hp, BN_Dup(crt->hp), CRYPT_MEM_ALLOC_FAIL);
+    GOTO_ERR_IF_SRC_NOT_NULL(newCrt->hq, crt->hq, BN_Dup(crt->hq), CRYPT_MEM_ALLOC_FAIL);
+    GOTO_ERR_IF_SRC_NOT_NULL(newCrt->pInv, crt->pInv, BN_Dup(crt->pInv), CRYPT_MEM_ALLOC_FAIL);
+
+    return newCrt;
+ERR :
+    PAILLIER_FreeCrtPara(newCrt);
+    return NULL;
+}
+
 static CRYPT_PAILLIER_PrvKey *PaillierPrvKeyDupCtx(CRYPT_PAILLIER_PrvKey *prvKey)
 {
     CRYPT_PAILLIER_PrvKey *newPrvKey = (CRYPT_PAILLIER_PrvKey *)BSL_SAL_Malloc(sizeof(CRYPT_PAILLIER_PrvKey));
@@ -76,6 +100,7 @@ static CRYPT_PAILLIER_PrvKey *PaillierPrvKeyDupCtx(CRYPT_PAILLIER_PrvKey *prvKey
     GOTO_ERR_IF_SRC_NOT_NULL(newPrvKey->lambda, prvKey->lambda, BN_Dup(prvKey->lambda), CRYPT_MEM_ALLOC_FAIL);
     GOTO_ERR_IF_SRC_NOT_NULL(newPrvKey->mu, prvKey->mu, BN_Dup(prvKey->mu), CRYPT_MEM_ALLOC_FAIL);
     GOTO_ERR_IF_SRC_NOT_NULL(newPrvKey->n2, prvKey->n2, BN_Dup(prvKey->n2), CRYPT_MEM_ALLOC_FAIL);
+    GOTO_ERR_IF_SRC_NOT_NULL(newPrvKey->crt, prvKey->crt, PaillierCrtParaDup(prvKey->crt), CRYPT_MEM_ALLOC_FAIL);
 
     return newPrvKey;
 ERR :
@@ -122,6 +147,7 @@ CRYPT_PAILLIER_Ctx *CRYPT_PAILLIER_DupCtx(CRYPT_PAILLIER_Ctx *keyCtx)
     GOTO_ERR_IF_SRC_NOT_NULL(newKeyCtx->prvKey, keyCtx->prvKey, PaillierPrvKeyDupCtx(keyCtx->prvKey), CRYPT_MEM_ALLOC_FAIL);
     GOTO_ERR_IF_SRC_NOT_NULL(newKeyCtx->pubKey, keyCtx->pubKey, PaillierPubKeyDupCtx(keyCtx->pubKey), CRYPT_MEM_ALLOC_FAIL);
     GOTO_ERR_IF_SRC_NOT_NULL(newKeyCtx->para, keyCtx->para, PaillierParaDupCtx(keyCtx->para), CRYPT_MEM_ALLOC_FAIL);
+    // The randomizers are not copied, an r shared by two contexts would link their ciphertexts.
     BSL_SAL_ReferencesInit(&(newKeyCtx->references));
     return newKeyCtx;
 
@@ -232,6 +258,7 @@ void CRYPT_PAILLIER_FreeCtx(CRYPT_PAILLIER_Ctx *ctx)
     PAILLIER_FREE_PRV_KEY(ctx->prvKey);
     PAILLIER_FREE_PUB_KEY(ctx->pubKey);
     PAILLIER_FREE_PARA(ctx->para);
+    PAILLIER_FREE_RAND_POOL(ctx->pool);
     BSL_SAL_Free(ctx);
 }
 
@@ -254,9 +281,27 @@ void PAILLIER_FreePrvKey(CRYPT_PAILLIER_PrvKey *prvKey)
     BN_Destroy(prvKey->lambda);
     BN_Destroy(prvKey->mu);
     BN_Destroy(prvKey->n2);
+    PAILLIER_FreeCrtPara(prvKey->crt);
     BSL_SAL_Free(prvKey);
 }
 
+void PAILLIER_FreeCrtPara(CRYPT_PAILLIER_CrtPara *crt)
+{
+    if (crt == NULL) {
+        return;
+    }
+    BN_Destroy(crt->p);
+    BN_Destroy(crt->q);
+    BN_Destroy(crt->p2);
+    BN_Destroy(crt->q2);
+    BN_Destroy(crt->pMinus1);
+    BN_Destroy(crt->qMinus1);
+    BN_Destroy(crt->hp);
+    BN_Destroy(crt->hq);
+    BN_Destroy(crt->pInv);
+    BSL_SAL_Free(crt);
+}
+
 void PAILLIER_FreePubKey(CRYPT_PAILLIER_PubKey *pubKey)
 {
     if (pubKey == NULL) {
@@ -320,6 +365,7 @@ int32_t CRYPT_PAILLIER_SetPara(CRYPT_PAILLIER_Ctx *ctx, const BSL_Param *param)
     PAILLIER_FREE_PARA(ctx->para);
     PAILLIER_FREE_PUB_KEY(ctx->pubKey);
     PAILLIER_FREE_PRV_KEY(ctx->prvKey);
+    PAILLIER_FREE_RAND_POOL(ctx->pool);
     ctx->para = para;
     return CRYPT_SUCCESS;
 }
@@ -329,14 +375,15 @@ uint32_t CRYPT_PAILLIER_GetBits(const CRYPT_PAILLIER_Ctx *ctx)
     if (ctx == NULL) {
         return 0;
     }
-    if (ctx->para != NULL) {
-        return ctx->para->bits;
+    // The bits of the para are the bits of the prime factors, the keys give the bits of the modulus.
+    if (ctx->pubKey != NULL) {
+        return BN_Bits(ctx->pubKey->n);
     }
     if (ctx->prvKey != NULL) {
-        return BN_Bits(ctx->prvKey->lambda);
+        return BN_Bits(ctx->prvKey->n);
     }
-    if (ctx->pubKey != NULL) {
-        return BN_Bits(ctx->pubKey->n);
+    if (ctx->para != NULL) {
+        return ctx->para->bits;
     }
     return 0;
 }
@@ -352,6 +399,7 @@ CRYPT_PAILLIER_PrvKey *Paillier_NewPrvKey(uint32_t bits)
     prvKey->lambda = BN_Create(bits);
     prvKey->mu = BN_Create(bits);
     prvKey->n2 = BN_Create(bits);
+    prvKey->crt = NULL;
     if (prvKey->n == NULL || prvKey->lambda == NULL || prvKey->mu == NULL || prvKey->n2 == NULL) {
         BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
         PAILLIER_FREE_PRV_KEY(prvKey);
@@ -487,6 +535,93 @@ OUT :
     return ret;
 }
 
+/* h = L(g^(prime - 1) mod prime^2)^-1 mod prime = -(mu * lambda * other^-1) mod prime, valid for any g */
+static int32_t Paillier_CalcH(BN_BigNum *h, const BN_BigNum *muLambda, const BN_BigNum *prime,
+    const BN_BigNum *otherInv, BN_Optimizer *optimizer)
+{
+    int32_t ret = BN_ModMul(h, muLambda, otherInv, prime, optimizer);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    if (BN_IsZero(h)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_INPUT_VALUE);
+        return CRYPT_PAILLIER_ERR_INPUT_VALUE;
+    }
+    ret = BN_Sub(h, prime, h);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+    }
+    return ret;
+}
+
+static int32_t Paillier_CalcCrtValues(CRYPT_PAILLIER_CrtPara *crt, const CRYPT_PAILLIER_PrvKey *prvKey,
+    BN_Optimizer *optimizer)
+{
+    int32_t ret;
+    uint32_t bits = BN_Bits(prvKey->n2);
+    BN_BigNum *muLambda = BN_Create(bits);
+    BN_BigNum *qInv = BN_Create(bits);
+    if (muLambda == NULL || qInv == NULL) {
+        ret = CRYPT_MEM_ALLOC_FAIL;
+        BSL_ERR_PUSH_ERROR(ret);
+        goto ERR;
+    }
+    GOTO_ERR_IF(BN_Mul(muLambda, crt->p, crt->q, optimizer), ret);
+    if (BN_Cmp(muLambda, prvKey->n) != 0) {
+        ret = CRYPT_PAILLIER_ERR_INPUT_VALUE;
+        BSL_ERR_PUSH_ERROR(ret);
+        goto ERR;
+    }
+    GOTO_ERR_IF(BN_Sqr(crt->p2, crt->p, optimizer), ret);
+    GOTO_ERR_IF(BN_Sqr(crt->q2, crt->q, optimizer), ret);
+    GOTO_ERR_IF(BN_SubLimb(crt->pMinus1, crt->p, 1), ret);
+    GOTO_ERR_IF(BN_SubLimb(crt->qMinus1, crt->q, 1), ret);
+    GOTO_ERR_IF(BN_ModInv(crt->pInv, crt->p, crt->q, optimizer), ret);
+    GOTO_ERR_IF(BN_ModInv(qInv, crt->q, crt->p, optimizer), ret);
+    GOTO_ERR_IF(BN_Mul(muLambda, prvKey->mu, prvKey->lambda, optimizer), ret);
+    GOTO_ERR_IF(Paillier_CalcH(crt->hp, muLambda, crt->p, qInv, optimizer), ret);
+    GOTO_ERR_IF(Paillier_CalcH(crt->hq, muLambda, crt->q, crt->pInv, optimizer), ret);
+ERR:
+    BN_Destroy(muLambda);
+    BN_Destroy(qInv);
+    return ret;
+}
+
+int32_t Paillier_CalcCrtPara(CRYPT_PAILLIER_PrvKey *prvKey, const BN_BigNum *p, const BN_BigNum *q,
+    BN_Optimizer *optimizer)
+{
+    uint32_t bits = BN_Bits(prvKey->n);
+    CRYPT_PAILLIER_CrtPara *crt = (CRYPT_PAILLIER_CrtPara *)BSL_SAL_Calloc(1, sizeof(CRYPT_PAILLIER_CrtPara));
+    if (crt == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    crt->p = BN_Dup(p);
+    crt->q = BN_Dup(q);
+    crt->p2 = BN_Create(bits);
+    crt->q2 = BN_Create(bits);
+    crt->pMinus1 = BN_Create(bits);
+    crt->qMinus1 = BN_Create(bits);
+    crt->hp = BN_Create(bits);
+    crt->hq = BN_Create(bits);
+    crt->pInv = BN_Create(bits);
+    if (crt->p == NULL || crt->q == NULL || crt->p2 == NULL || crt->q2 == NULL || crt->pMinus1 == NULL ||
+        crt->qMinus1 == NULL || crt->hp == NULL || crt->hq == NULL || crt->pInv == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+        PAILLIER_FreeCrtPara(crt);
+        return CRYPT_MEM_ALLOC_FAIL;
+    }
+    int32_t ret = Paillier_CalcCrtValues(crt, prvKey, optimizer);
+    if (ret != CRYPT_SUCCESS) {
+        PAILLIER_FreeCrtPara(crt);
+        return ret;
+    }
+    PAILLIER_FreeCrtPara(prvKey->crt);
+    prvKey->crt = crt;
+    return CRYPT_SUCCESS;
+}
+
 int32_t Paillier_CalcPrvKey(CRYPT_PAILLIER_Ctx *ctx, BN_Optimizer *optimizer)
 {
     int32_t ret = Paillier_CalcLambda(ctx->prvKey->lambda, ctx->para, optimizer);
@@ -553,10 +688,12 @@ int32_t CRYPT_PAILLIER_Gen(CRYPT_PAILLIER_Ctx *ctx)
     
     GOTO_ERR_IF(BN_Copy(newCtx->prvKey->n, newCtx->pubKey->n), ret);
     GOTO_ERR_IF(BN_Copy(newCtx->prvKey->n2, newCtx->pubKey->n2), ret);
+    GOTO_ERR_IF(Paillier_CalcCrtPara(newCtx->prvKey, newCtx->para->p, newCtx->para->q, optimizer), ret);
 
     PAILLIER_FREE_PARA(ctx->para);
     PAILLIER_FREE_PRV_KEY(ctx->prvKey);
     PAILLIER_FREE_PUB_KEY(ctx->pubKey);
+    PAILLIER_FREE_RAND_POOL(ctx->pool);
     BSL_SAL_ReferencesFree(&(newCtx->references));
 
     ctx->prvKey = newCtx->prvKey;
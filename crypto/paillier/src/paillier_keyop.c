@@ -31,6 +31,8 @@ typedef struct {
     BSL_Param *lambda; /**< Paillier private key parameter marked as lambda */
     BSL_Param *mu;     /**< Paillier private key parameter marked as mu */
     BSL_Param *n2;     /**< Paillier private key parameter marked as n2 */
+    BSL_Param *p;      /**< Paillier private key parameter marked as p, optional */
+    BSL_Param *q;      /**< Paillier private key parameter marked as q, optional */
 } CRYPT_PaillierPrvParam;
 
 typedef struct {
@@ -111,6 +113,32 @@ static int32_t SetPrvPara(const CRYPT_PAILLIER_PrvKey *prvKey, const CRYPT_Paill
     return ret;
 }
 
+static int32_t SetPrvCrtPara(CRYPT_PAILLIER_PrvKey *prvKey, const CRYPT_PaillierPrvParam *prv)
+{
+    int32_t ret;
+    BN_BigNum *p = BN_Create(prv->p->valueLen * 8); // Bit length is obtained by multiplying byte length by 8.
+    BN_BigNum *q = BN_Create(prv->q->valueLen * 8);
+    BN_Optimizer *optimizer = BN_OptimizerCreate();
+    if (p == NULL || q == NULL || optimizer == NULL) {
+        ret = CRYPT_MEM_ALLOC_FAIL;
+        BSL_ERR_PUSH_ERROR(ret);
+        goto ERR;
+    }
+    GOTO_ERR_IF(BN_Bin2Bn(p, prv->p->value, prv->p->valueLen), ret);
+    GOTO_ERR_IF(BN_Bin2Bn(q, prv->q->value, prv->q->valueLen), ret);
+    if (BN_IsZero(p) || BN_IsZero(q)) {
+        ret = CRYPT_PAILLIER_ERR_INPUT_VALUE;
+        BSL_ERR_PUSH_ERROR(ret);
+        goto ERR;
+    }
+    ret = Paillier_CalcCrtPara(prvKey, p, q, optimizer);
+ERR:
+    BN_Destroy(p);
+    BN_Destroy(q);
+    BN_OptimizerDestroy(optimizer);
+    return ret;
+}
+
 static int32_t SetPrvBasicCheck(const CRYPT_PAILLIER_Ctx *ctx, BSL_Param *para, CRYPT_PaillierPrvParam *prv)
 {
     if (ctx == NULL || para == NULL) {
@@ -126,6 +154,19 @@ static int32_t SetPrvBasicCheck(const CRYPT_PAILLIER_Ctx *ctx, BSL_Param *para,
         BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_INPUT_VALUE);
         return CRYPT_PAILLIER_ERR_INPUT_VALUE;
     }
+    // The prime factors are optional and enable the decryption modulo p^2 and q^2.
+    prv->p = BSL_PARAM_FindParam(para, CRYPT_PARAM_PAILLIER_P);
+    prv->q = BSL_PARAM_FindParam(para, CRYPT_PARAM_PAILLIER_Q);
+    if (PARAMISNULL(prv->p) || prv->p->valueLen == 0) {
+        prv->p = NULL;
+    }
+    if (PARAMISNULL(prv->q) || prv->q->valueLen == 0) {
+        prv->q = NULL;
+    }
+    if ((prv->p == NULL) != (prv->q == NULL)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_INPUT_VALUE);
+        return CRYPT_PAILLIER_ERR_INPUT_VALUE;
+    }
     return CRYPT_SUCCESS;
 }
 
@@ -153,6 +194,13 @@ int32_t CRYPT_PAILLIER_SetPrvKey(CRYPT_PAILLIER_Ctx *ctx, const BSL_Param *para)
         BSL_ERR_PUSH_ERROR(ret);
         goto ERR;
     }
+    if (prv.p != NULL) {
+        ret = SetPrvCrtPara(newCtx->prvKey, &prv);
+        if (ret != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            goto ERR;
+        }
+    }
 
     PAILLIER_FREE_PRV_KEY(ctx->prvKey);
     ctx->prvKey = newCtx->prvKey;
@@ -208,6 +256,7 @@ int32_t CRYPT_PAILLIER_SetPubKey(CRYPT_PAILLIER_Ctx *ctx, const BSL_Param *para)
     GOTO_ERR_IF(CheckSquare(newPub->n2, newPub->n, pub.n->valueLen * 8), ret);
 
     PAILLIER_FREE_PUB_KEY(ctx->pubKey);
+    PAILLIER_FREE_RAND_POOL(ctx->pool);
     ctx->pubKey = newPub;
     return ret;
 ERR:
@@ -225,6 +274,8 @@ static int32_t GetPrvBasicCheck(const CRYPT_PAILLIER_Ctx *ctx, BSL_Param *para,
     prv->lambda = BSL_PARAM_FindParam(para, CRYPT_PARAM_PAILLIER_LAMBDA);
     prv->mu = BSL_PARAM_FindParam(para, CRYPT_PARAM_PAILLIER_MU);
     prv->n2 = BSL_PARAM_FindParam(para, CRYPT_PARAM_PAILLIER_N2);
+    prv->p = BSL_PARAM_FindParam(para, CRYPT_PARAM_PAILLIER_P);
+    prv->q = BSL_PARAM_FindParam(para, CRYPT_PARAM_PAILLIER_Q);
     if (PARAMISNULL(prv->lambda) || PARAMISNULL(prv->mu)) {
         BSL_ERR_PUSH_ERROR(CRYPT_PAILLIER_ERR_INPUT_VALUE);
         return CRYPT_PAILLIER_ERR_INPUT_VALUE;
@@ -252,6 +303,17 @@ int32_t CRYPT_PAILLIER_GetPrvKey(const CRYPT_PAILLIER_Ctx *ctx, BSL_Param *para)
         prv.n2->useLen = prv.n2->valueLen;
         GOTO_ERR_IF(BN_Bn2Bin(ctx->prvKey->n2, prv.n2->value, &(prv.n2->useLen)), ret);
     }
+    // The prime factors are only known if the key was generated or set with them.
+    if (!PARAMISNULL(prv.p) && !PARAMISNULL(prv.q)) {
+        prv.p->useLen = 0;
+        prv.q->useLen = 0;
+        if (ctx->prvKey->crt != NULL) {
+            prv.p->useLen = prv.p->valueLen;
+            GOTO_ERR_IF(BN_Bn2Bin(ctx->prvKey->crt->p, prv.p->value, &(prv.p->useLen)), ret);
+            prv.q->useLen = prv.q->valueLen;
+            GOTO_ERR_IF(BN_Bn2Bin(ctx->prvKey->crt->q, prv.q->value, &(prv.q->useLen)), ret);
+        }
+    }
     return CRYPT_SUCCESS;
 ERR:
     if (!PARAMISNULL(prv.lambda) && prv.lambda->useLen != 0) {
@@ -270,6 +332,14 @@ ERR:
         BSL_SAL_CleanseData(prv.n2->value, prv.n2->useLen);
         prv.n2->useLen = 0;
     }
+    if (!PARAMISNULL(prv.p) && prv.p->useLen != 0) {
+        BSL_SAL_CleanseData(prv.p->value, prv.p->useLen);
+        prv.p->useLen = 0;
+    }
+    if (!PARAMISNULL(prv.q) && prv.q->useLen != 0) {
+        BSL_SAL_CleanseData(prv.q->value, prv.q->useLen);
+        prv.q->useLen = 0;
+    }
     return ret;
 }
 
@@ -34,13 +34,35 @@ typedef struct {
     BN_BigNum *n2; // square of n
 } CRYPT_PAILLIER_PubKey;
 
+/* Values of the decryption modulo p^2 and q^2, computed once when the prime factors are known */
+typedef struct {
+    BN_BigNum *p;       // prime factor p
+    BN_BigNum *q;       // prime factor q
+    BN_BigNum *p2;      // square of p
+    BN_BigNum *q2;      // square of q
+    BN_BigNum *pMinus1; // p - 1, exponent modulo p^2
+    BN_BigNum *qMinus1; // q - 1, exponent modulo q^2
+    BN_BigNum *hp;      // L_p(g^(p-1) mod p^2)^-1 mod p
+    BN_BigNum *hq;      // L_q(g^(q-1) mod q^2)^-1 mod q
+    BN_BigNum *pInv;    // p^-1 mod q
+} CRYPT_PAILLIER_CrtPara;
+
 typedef struct {
     BN_BigNum *n;       // pub key n needed for decryption
     BN_BigNum *lambda;  // modulo Value - converted.Not in char
     BN_BigNum *mu;      // modulo Value -converted.Not in char
     BN_BigNum *n2;      // pub key n2 needed for decryption
+    CRYPT_PAILLIER_CrtPara *crt; // NULL if the prime factors are unknown
 } CRYPT_PAILLIER_PrvKey;
 
+#define PAILLIER_MAX_RAND_POOL (1U << 24)
+
+/* Precomputed randomizers r^n mod n^2 of the public key, each one is used by a single encryption */
+typedef struct {
+    BN_BigNum **rn;
+    uint32_t num;
+} CRYPT_PAILLIER_RandPool;
+
 struct PAILLIER_Para {
     BN_BigNum *p;   // prime factor p
     BN_BigNum *q;   // prime factor q
@@ -51,6 +73,7 @@ struct PAILLIER_Ctx {
     CRYPT_PAILLIER_PubKey *pubKey;
     CRYPT_PAILLIER_PrvKey *prvKey;
     CRYPT_PAILLIER_Para *para;
+    CRYPT_PAILLIER_RandPool *pool;
     BSL_SAL_RefCount references;
 };
 
@@ -59,6 +82,20 @@ CRYPT_PAILLIER_PubKey *Paillier_NewPubKey(uint32_t bits);
 void PAILLIER_FreePrvKey(CRYPT_PAILLIER_PrvKey *prvKey);
 void PAILLIER_FreePubKey(CRYPT_PAILLIER_PubKey *pubKey);
 CRYPT_PAILLIER_Para *CRYPT_Paillier_DupPara(const CRYPT_PAILLIER_Para *para);
+void PAILLIER_FreeCrtPara(CRYPT_PAILLIER_CrtPara *crt);
+void PAILLIER_FreeRandPool(CRYPT_PAILLIER_RandPool *pool);
+
+/* Compute the CRT values of prvKey from the prime factors p and q, p * q must be equal to n */
+int32_t Paillier_CalcCrtPara(CRYPT_PAILLIER_PrvKey *prvKey, const BN_BigNum *p, const BN_BigNum *q,
+    BN_Optimizer *opt);
+
+/* c = g^m * r^n mod n^2 with 0 <= m < n, r^n is taken from the pool of ctx when there is one left */
+int32_t Paillier_EncryptBn(CRYPT_PAILLIER_Ctx *ctx, BN_BigNum *c, const BN_BigNum *m, BN_Mont *mont,
+    BN_Optimizer *opt);
+
+/* rn = r^n mod n^2 for a random r coprime to n */
+int32_t Paillier_GenRandomizer(const CRYPT_PAILLIER_PubKey *pubKey, BN_BigNum *rn, BN_Mont *mont,
+    BN_Optimizer *opt);
 
 #define PAILLIER_FREE_PRV_KEY(prvKey_)               \
 do {                                            \
@@ -78,6 +115,12 @@ do {                                            \
         (para_) = NULL;                         \
     } while (0)
 
+#define PAILLIER_FREE_RAND_POOL(pool_)               \
+    do {                                        \
+        PAILLIER_FreeRandPool((pool_));              \
+        (pool_) = NULL;                         \
+    } while (0)
+
 #ifdef __cplusplus
 }
 #endif
@@ -148,6 +148,13 @@ int32_t CRYPT_PBKDF2_GenDk(const CRYPT_PBKDF2_Ctx *pCtx, uint8_t *dk, uint32_t d
     uint32_t i;
     int32_t ret;
 
+#ifdef PBKDF2_HAS_MD_CORE
+    ret = CRYPT_PBKDF2_MdGenDk(pCtx->macId, pCtx->password, pCtx->passLen, pCtx->salt, pCtx->saltLen,
+        pCtx->iterCnt, dk, dkLen);
+    if (ret != CRYPT_NOT_SUPPORT) {
+        return ret;
+    }
+#endif
     ret = pCtx->macMeth->init(pCtx->macCtx, pCtx->password, pCtx->passLen, NULL);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
@@ -204,6 +211,7 @@ int32_t CRYPT_PBKDF2_HMAC(const EAL_MacMethod *macMeth, CRYPT_MAC_AlgId macId, c
         return CRYPT_MEM_ALLOC_FAIL;
     }
 
+    pCtx.macId = macId;
     pCtx.macMeth = macMeth;
     pCtx.macCtx = macCtx;
     pCtx.password = (uint8_t *)(uintptr_t)key;
@@ -49,6 +49,29 @@ int32_t CRYPT_PBKDF2_HMAC(const EAL_MacMethod *macMeth, CRYPT_MAC_AlgId macId, c
     const uint8_t *salt, uint32_t saltLen,
     uint32_t iterCnt, uint8_t *out, uint32_t len);
 
+#if defined(HITLS_CRYPTO_SHA1) || defined(HITLS_CRYPTO_SHA256) || defined(HITLS_CRYPTO_SHA512)
+#define PBKDF2_HAS_MD_CORE
+
+/**
+ * @brief PBKDF2 with HMAC-SHA1, HMAC-SHA256 or HMAC-SHA512 computed on precomputed HMAC midstates with the raw
+ *        compression function of the digest, instead of going through the MAC method.
+ *
+ * @param macId [IN] HMAC algorithm ID
+ * @param key [IN] Password
+ * @param keyLen [IN] Password length
+ * @param salt [IN] Salt value
+ * @param saltLen [IN] Salt value length
+ * @param iterCnt [IN] Iteration times, not 0
+ * @param dk [OUT] Derived key
+ * @param dkLen [IN] Length of the derived key, not 0
+ *
+ * @return Success: CRYPT_SUCCESS
+ *         CRYPT_NOT_SUPPORT: macId has no such implementation, the MAC method has to be used.
+ */
+int32_t CRYPT_PBKDF2_MdGenDk(CRYPT_MAC_AlgId macId, const uint8_t *key, uint32_t keyLen,
+    const uint8_t *salt, uint32_t saltLen, uint32_t iterCnt, uint8_t *dk, uint32_t dkLen);
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,328 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#ifdef HITLS_CRYPTO_PBKDF2
+
+#include <stdint.h>
+#include "securec.h"
+#include "bsl_sal.h"
+#include "crypt_errno.h"
+#include "crypt_utils.h"
+#include "crypt_algid.h"
+#include "pbkdf2_local.h"
+
+#ifdef PBKDF2_HAS_MD_CORE
+
+#ifdef HITLS_CRYPTO_SHA1
+#include "crypt_sha1.h"
+#endif
+#if defined(HITLS_CRYPTO_SHA256) || defined(HITLS_CRYPTO_SHA512)
+#include "crypt_sha2.h"
+#endif
+
+/*
+ * PBKDF2 with HMAC evaluated on the raw compression function:
+ * - H(K ^ ipad) and H(K ^ opad) are compressed once per derivation and every HMAC starts from these midstates.
+ * - The complete blocks of the salt are compressed once for all T blocks.
+ * - Every Un is one inner and one outer compression of a prebuilt block, U(n-1) || padding, because
+ *   hLen + 1 + length field always fits in one block for SHA1, SHA256 and SHA512.
+ * - When the hash offers a two state compression, two T blocks are computed side by side.
+ */
+
+#define PBKDF2_MD_MAX_BLOCKSIZE 128
+#define PBKDF2_MD_MAX_DIGESTSIZE 64
+#define PBKDF2_MD_LANES 2
+#define PBKDF2_MD_IPAD 0x36
+#define PBKDF2_MD_OPAD 0x5c
+
+typedef union {
+    uint32_t w32[8];
+    uint64_t w64[8];
+} PBKDF2_MdState;
+
+typedef struct {
+    CRYPT_MAC_AlgId macId;
+    uint32_t blockSize;
+    uint32_t mdSize;
+    uint32_t lenSize;       /* bytes of the message length field of the padding */
+    void (*initState)(PBKDF2_MdState *state);
+    void (*compress)(PBKDF2_MdState *state, const uint8_t *in, uint32_t num);
+    /* Optional, one block into each of two states. */
+    void (*compressTwo)(PBKDF2_MdState *stateA, const uint8_t *inA, PBKDF2_MdState *stateB, const uint8_t *inB);
+    void (*output)(const PBKDF2_MdState *state, uint8_t *out);
+} PBKDF2_MdCore;
+
+typedef struct {
+    const PBKDF2_MdCore *core;
+    PBKDF2_MdState inner;       /* state after K ^ ipad */
+    PBKDF2_MdState outer;       /* state after K ^ opad */
+    PBKDF2_MdState salted;      /* inner state after the complete blocks of the salt */
+    const uint8_t *saltTail;
+    uint32_t saltTailLen;
+    uint32_t saltLen;
+} PBKDF2_MdKey;
+
+#ifdef HITLS_CRYPTO_SHA1
+static void Sha1InitState(PBKDF2_MdState *state)
+{
+    CRYPT_SHA1_InitState(state->w32);
+}
+
+static void Sha1Compress(PBKDF2_MdState *state, const uint8_t *in, uint32_t num)
+{
+    CRYPT_SHA1_Compress(state->w32, in, num);
+}
+
+static void Sha1Output(const PBKDF2_MdState *state, uint8_t *out)
+{
+    for (uint32_t i = 0; i < CRYPT_SHA1_DIGESTSIZE / sizeof(uint32_t); i++) {
+        PUT_UINT32_BE(state->w32[i], out, i * sizeof(uint32_t));
+    }
+}
+#endif
+
+#ifdef HITLS_CRYPTO_SHA256
+static void Sha256InitState(PBKDF2_MdState *state)
+{
+    CRYPT_SHA2_256_InitState(state->w32);
+}
+
+static void Sha256Compress(PBKDF2_MdState *state, const uint8_t *in, uint32_t num)
+{
+    CRYPT_SHA2_256_Compress(state->w32, in, num);
+}
+
+static void Sha256CompressTwo(PBKDF2_MdState *stateA, const uint8_t *inA, PBKDF2_MdState *stateB,
+    const uint8_t *inB)
+{
+    CRYPT_SHA2_256_CompressTwo(stateA->w32, inA, stateB->w32, inB);
+}
+
+static void Sha256Output(const PBKDF2_MdState *state, uint8_t *out)
+{
+    for (uint32_t i = 0; i < CRYPT_SHA2_256_DIGESTSIZE / sizeof(uint32_t); i++) {
+        PUT_UINT32_BE(state->w32[i], out, i * sizeof(uint32_t));
+    }
+}
+#endif
+
+#ifdef HITLS_CRYPTO_SHA512
+static void Sha512InitState(PBKDF2_MdState *state)
+{
+    CRYPT_SHA2_512_InitState(state->w64);
+}
+
+static void Sha512Compress(PBKDF2_MdState *state, const uint8_t *in, uint32_t num)
+{
+    CRYPT_SHA2_512_Compress(state->w64, in, num);
+}
+
+static void Sha512Output(const PBKDF2_MdState *state, uint8_t *out)
+{
+    for (uint32_t i = 0; i < CRYPT_SHA2_512_DIGESTSIZE / sizeof(uint64_t); i++) {
+        PUT_UINT32_BE((uint32_t)(state->w64[i] >> 32), out, i * sizeof(uint64_t));
+        PUT_UINT32_BE((uint32_t)state->w64[i], out, i * sizeof(uint64_t) + sizeof(uint32_t));
+    }
+}
+#endif
+
+static const PBKDF2_MdCore PBKDF2_MD_CORES[] = {
+#ifdef HITLS_CRYPTO_SHA1
+    {CRYPT_MAC_HMAC_SHA1, CRYPT_SHA1_BLOCKSIZE, CRYPT_SHA1_DIGESTSIZE, 8,
+        Sha1InitState, Sha1Compress, NULL, Sha1Output},
+#endif
+#ifdef HITLS_CRYPTO_SHA256
+    {CRYPT_MAC_HMAC_SHA256, CRYPT_SHA2_256_BLOCKSIZE, CRYPT_SHA2_256_DIGESTSIZE, 8,
+        Sha256InitState, Sha256Compress, Sha256CompressTwo, Sha256Output},
+#endif
+#ifdef HITLS_CRYPTO_SHA512
+    {CRYPT_MAC_HMAC_SHA512, CRYPT_SHA2_512_BLOCKSIZE, CRYPT_SHA2_512_DIGESTSIZE, 16,
+        Sha512InitState, Sha512Compress, NULL, Sha512Output},
+#endif
+};
+
+static const PBKDF2_MdCore *FindMdCore(CRYPT_MAC_AlgId macId)
+{
+    for (uint32_t i = 0; i < sizeof(PBKDF2_MD_CORES) / sizeof(PBKDF2_MD_CORES[0]); i++) {
+        if (PBKDF2_MD_CORES[i].macId == macId) {
+            return &PBKDF2_MD_CORES[i];
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Pad the used bytes at the start of block for a message of totalLen bytes. block holds two blocks,
+ * the number of blocks to compress is returned.
+ */
+static uint32_t MdPad(const PBKDF2_MdCore *core, uint8_t *block, uint32_t used, uint64_t totalLen)
+{
+    uint32_t end = (used + 1 + core->lenSize > core->blockSize) ? (core->blockSize * 2) : core->blockSize;
+    uint64_t bits = totalLen << SHIFTS_PER_BYTE;
+    block[used] = 0x80;
+    (void)memset_s(block + used + 1, end - used - 1, 0, end - used - 1);
+    PUT_UINT32_BE((uint32_t)(bits >> 32), block, end - 8); /* 8: low 64 bits of the length field */
+    PUT_UINT32_BE((uint32_t)bits, block, end - 4);        /* 4: low 32 bits of the length field */
+    return end / core->blockSize;
+}
+
+/* Compress the trailing bytes of a message whose complete blocks are already in state. */
+static void MdFinish(const PBKDF2_MdCore *core, PBKDF2_MdState *state, uint8_t *block, uint32_t used,
+    uint64_t totalLen)
+{
+    core->compress(state, block, MdPad(core, block, used, totalLen));
+}
+
+static void MdKeySetup(PBKDF2_MdKey *mk, const PBKDF2_MdCore *core, const uint8_t *key, uint32_t keyLen,
+    const uint8_t *salt, uint32_t saltLen)
+{
+    uint8_t k[PBKDF2_MD_MAX_BLOCKSIZE] = {0};
+    uint8_t block[PBKDF2_MD_MAX_BLOCKSIZE * 2];
+    uint32_t bs = core->blockSize;
+
+    /* Keys longer than one block are replaced by their digest, RFC 2104 section 2. */
+    if (keyLen > bs) {
+        PBKDF2_MdState st;
+        uint32_t full = keyLen / bs;
+        core->initState(&st);
+        core->compress(&st, key, full);
+        (void)memcpy_s(block, sizeof(block), key + full * bs, keyLen - full * bs);
+        MdFinish(core, &st, block, keyLen - full * bs, keyLen);
+        core->output(&st, k);
+        BSL_SAL_CleanseData(&st, sizeof(st));
+    } else if (keyLen > 0) {
+        (void)memcpy_s(k, sizeof(k), key, keyLen);
+    }
+
+    for (uint32_t i = 0; i < bs; i++) {
+        block[i] = k[i] ^ PBKDF2_MD_IPAD;
+    }
+    core->initState(&mk->inner);
+    core->compress(&mk->inner, block, 1);
+    for (uint32_t i = 0; i < bs; i++) {
+        block[i] = k[i] ^ PBKDF2_MD_OPAD;
+    }
+    core->initState(&mk->outer);
+    core->compress(&mk->outer, block, 1);
+
+    mk->salted = mk->inner;
+    if (saltLen >= bs) {
+        core->compress(&mk->salted, salt, saltLen / bs);
+    }
+    mk->core = core;
+    mk->saltTail = (saltLen == 0) ? NULL : salt + (saltLen / bs) * bs;
+    mk->saltTailLen = saltLen % bs;
+    mk->saltLen = saltLen;
+
+    BSL_SAL_CleanseData(k, sizeof(k));
+    BSL_SAL_CleanseData(block, sizeof(block));
+}
+
+/* st[l] = from, then compress block[l] into it and write the digest back to the start of block[l]. */
+static void MdLanesStep(const PBKDF2_MdCore *core, const PBKDF2_MdState *from, PBKDF2_MdState *st,
+    uint8_t block[][PBKDF2_MD_MAX_BLOCKSIZE * 2], uint32_t lanes)
+{
+    for (uint32_t l = 0; l < lanes; l++) {
+        st[l] = *from;
+    }
+    if (lanes == PBKDF2_MD_LANES && core->compressTwo != NULL) {
+        core->compressTwo(&st[0], block[0], &st[1], block[1]);
+    } else {
+        for (uint32_t l = 0; l < lanes; l++) {
+            core->compress(&st[l], block[l], 1);
+        }
+    }
+    for (uint32_t l = 0; l < lanes; l++) {
+        core->output(&st[l], block[l]);
+    }
+}
+
+/* T(index + l) for l < lanes. */
+static void MdCalcT(const PBKDF2_MdKey *mk, uint32_t index, uint32_t lanes, uint32_t iterCnt,
+    uint8_t t[][PBKDF2_MD_MAX_DIGESTSIZE])
+{
+    const PBKDF2_MdCore *core = mk->core;
+    uint32_t bs = core->blockSize;
+    uint32_t md = core->mdSize;
+    uint8_t block[PBKDF2_MD_LANES][PBKDF2_MD_MAX_BLOCKSIZE * 2];
+    PBKDF2_MdState st[PBKDF2_MD_LANES];
+
+    /* U1 = PRF(P, S || INT_32_BE(i)), the inner hash continues from the salted midstate. */
+    for (uint32_t l = 0; l < lanes; l++) {
+        st[l] = mk->salted;
+        if (mk->saltTailLen > 0) {
+            (void)memcpy_s(block[l], sizeof(block[l]), mk->saltTail, mk->saltTailLen);
+        }
+        PUT_UINT32_BE(index + l, block[l], mk->saltTailLen);
+        MdFinish(core, &st[l], block[l], mk->saltTailLen + sizeof(uint32_t),
+            (uint64_t)bs + mk->saltLen + sizeof(uint32_t));
+        /* From here on every message is the previous digest after one block of key, it fits in one block. */
+        (void)MdPad(core, block[l], md, (uint64_t)bs + md);
+        core->output(&st[l], block[l]);
+    }
+    MdLanesStep(core, &mk->outer, st, block, lanes);
+    for (uint32_t l = 0; l < lanes; l++) {
+        (void)memcpy_s(t[l], PBKDF2_MD_MAX_DIGESTSIZE, block[l], md);
+    }
+
+    for (uint32_t n = 1; n < iterCnt; n++) {
+        MdLanesStep(core, &mk->inner, st, block, lanes);
+        MdLanesStep(core, &mk->outer, st, block, lanes);
+        for (uint32_t l = 0; l < lanes; l++) {
+            DATA_XOR(t[l], block[l], t[l], md);
+        }
+    }
+    BSL_SAL_CleanseData(block, sizeof(block));
+    BSL_SAL_CleanseData(st, sizeof(st));
+}
+
+int32_t CRYPT_PBKDF2_MdGenDk(CRYPT_MAC_AlgId macId, const uint8_t *key, uint32_t keyLen,
+    const uint8_t *salt, uint32_t saltLen, uint32_t iterCnt, uint8_t *dk, uint32_t dkLen)
+{
+    const PBKDF2_MdCore *core = FindMdCore(macId);
+    if (core == NULL) {
+        return CRYPT_NOT_SUPPORT;
+    }
+    PBKDF2_MdKey mk;
+    uint8_t t[PBKDF2_MD_LANES][PBKDF2_MD_MAX_DIGESTSIZE];
+    uint32_t lanesMax = (core->compressTwo != NULL) ? PBKDF2_MD_LANES : 1;
+    uint32_t md = core->mdSize;
+    uint32_t index = 1;
+    uint32_t curLen = dkLen;
+    uint8_t *out = dk;
+
+    MdKeySetup(&mk, core, key, keyLen, salt, saltLen);
+    /* DK = T1 + T2 + ⋯ + Tdklen/hlen */
+    while (curLen > 0) {
+        uint32_t blocks = (curLen + md - 1) / md;
+        uint32_t lanes = (blocks < lanesMax) ? blocks : lanesMax;
+        MdCalcT(&mk, index, lanes, iterCnt, t);
+        for (uint32_t l = 0; l < lanes; l++) {
+            uint32_t len = (curLen > md) ? md : curLen;
+            (void)memcpy_s(out, curLen, t[l], len);
+            out += len;
+            curLen -= len;
+        }
+        index += lanes;
+    }
+    BSL_SAL_CleanseData(&mk, sizeof(mk));
+    BSL_SAL_CleanseData(t, sizeof(t));
+    return CRYPT_SUCCESS;
+}
+
+#endif // PBKDF2_HAS_MD_CORE
+
+#endif // HITLS_CRYPTO_PBKDF2
@@ -53,6 +53,8 @@ static void *CRYPT_EAL_DefCipherNewCtx(void *provCtx, int32_t algId)
         {CRYPT_CIPHER_AES128_OFB, MODES_OFB_NewCtx},
         {CRYPT_CIPHER_AES192_OFB, MODES_OFB_NewCtx},
         {CRYPT_CIPHER_AES256_OFB, MODES_OFB_NewCtx},
+        {CRYPT_CIPHER_AES128_XTS, MODES_XTS_NewCtx},
+        {CRYPT_CIPHER_AES256_XTS, MODES_XTS_NewCtx},
         {CRYPT_CIPHER_CHACHA20_POLY1305, MODES_CHACHA20POLY1305_NewCtx},
         {CRYPT_CIPHER_SM4_XTS, MODES_XTS_NewCtx},
         {CRYPT_CIPHER_SM4_CBC, MODES_CBC_NewCtx},
@@ -61,6 +63,7 @@ static void *CRYPT_EAL_DefCipherNewCtx(void *provCtx, int32_t algId)
         {CRYPT_CIPHER_SM4_GCM, MODES_GCM_NewCtx},
         {CRYPT_CIPHER_SM4_CFB, MODES_CFB_NewCtx},
         {CRYPT_CIPHER_SM4_OFB, MODES_OFB_NewCtx},
+        {CRYPT_CIPHER_SM4_CCM, MODES_CCM_NewCtx},
     };
     for (size_t i = 0; i < sizeof(cipherNewCtxFunc)/sizeof(cipherNewCtxFunc[0]); i++) {
         if (cipherNewCtxFunc[i].id == algId) {
@@ -199,6 +199,7 @@ static int32_t AddProviderToList(CRYPT_EAL_LibCtx *libCtx, CRYPT_EAL_ProvMgrCtx
         BSL_ERR_PUSH_ERROR(ret);
         return ret;
     }
+    CRYPT_EAL_ProvCacheFlush(libCtx);
 
     (void)BSL_SAL_ThreadUnlock(libCtx->lock);
 
@@ -372,6 +373,7 @@ int32_t CRYPT_EAL_ProviderUnload(CRYPT_EAL_LibCtx *libCtx, BSL_SAL_ConverterCmd
 
     if (refCount <= 0) {
         RemoveAndFreeProvider(libCtx->providers, providerMgr);
+        CRYPT_EAL_ProvCacheFlush(libCtx);
     }
     (void)BSL_SAL_ThreadUnlock(libCtx->lock);
     BSL_SAL_FREE(providerFullName);
@@ -0,0 +1,163 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#ifdef HITLS_CRYPTO_PROVIDER
+
+#include <string.h>
+#include "securec.h"
+#include "bsl_sal.h"
+#include "crypt_provider_local.h"
+
+/*
+ * The lookup cache is a direct mapped table, every entry is protected by its own sequence counter. Writers are
+ * serialized by the lock of the library context and make the counter odd while they change the entry. A reader
+ * that sees an odd counter, or a counter that changed while it copied the entry, takes it as a miss and falls back
+ * to the locked lookup. Adding or removing a provider bumps the generation of the library context, which drops
+ * every entry at once.
+ */
+#if defined(__GNUC__) && defined(__ATOMIC_ACQUIRE)
+#define PROV_CACHE_LOCK_FREE
+#define PROV_CACHE_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define PROV_CACHE_STORE(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define PROV_CACHE_FENCE_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define PROV_CACHE_FENCE_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#endif
+
+#ifdef PROV_CACHE_LOCK_FREE
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+// Get the memoized length of the attribute, false if the attribute is too long to be memoized
+static bool ProvCacheAttrLen(const char *attribute, uint32_t *attrLen)
+{
+    if (attribute == NULL) {
+        *attrLen = 0;
+        return true;
+    }
+    uint32_t len = BSL_SAL_Strnlen(attribute, EAL_PROV_CACHE_ATTR_LEN);
+    if (len >= EAL_PROV_CACHE_ATTR_LEN) {
+        return false;
+    }
+    *attrLen = len + 1;
+    return true;
+}
+
+static EAL_ProvCacheEntry *ProvCacheEntry(CRYPT_EAL_LibCtx *libCtx, int32_t operaId, int32_t algId,
+    const char *attribute, uint32_t attrLen)
+{
+    uint32_t h = FNV_OFFSET_BASIS;
+    h = (h ^ (uint32_t)operaId) * FNV_PRIME;
+    h = (h ^ (uint32_t)algId) * FNV_PRIME;
+    for (uint32_t i = 0; i < attrLen; i++) {
+        h = (h ^ (uint8_t)attribute[i]) * FNV_PRIME;
+    }
+    h ^= h >> 16; // fold the high bits into the index
+    return &libCtx->cache[h & (EAL_PROV_CACHE_SIZE - 1)];
+}
+
+bool CRYPT_EAL_ProvCacheFind(CRYPT_EAL_LibCtx *libCtx, int32_t operaId, int32_t algId, const char *attribute,
+    const CRYPT_EAL_Func **funcs, void **provCtx)
+{
+    uint32_t attrLen;
+    if (!ProvCacheAttrLen(attribute, &attrLen)) {
+        return false;
+    }
+    EAL_ProvCacheEntry *entry = ProvCacheEntry(libCtx, operaId, algId, attribute, attrLen);
+    uint32_t seq = PROV_CACHE_LOAD(&entry->seq);
+    if ((seq & 1) != 0) {
+        return false;
+    }
+    bool hit = entry->gen == PROV_CACHE_LOAD(&libCtx->cacheGen) && entry->operaId == operaId &&
+        entry->algId == algId && entry->attrLen == attrLen &&
+        (attrLen == 0 || memcmp(entry->attr, attribute, attrLen) == 0);
+    const CRYPT_EAL_Func *tmpFuncs = entry->funcs;
+    void *tmpCtx = entry->provCtx;
+    PROV_CACHE_FENCE_ACQUIRE();
+    if (!hit || PROV_CACHE_LOAD(&entry->seq) != seq) {
+        return false;
+    }
+    *funcs = tmpFuncs;
+    if (provCtx != NULL) {
+        *provCtx = tmpCtx;
+    }
+    return true;
+}
+
+void CRYPT_EAL_ProvCacheAdd(CRYPT_EAL_LibCtx *libCtx, int32_t operaId, int32_t algId, const char *attribute,
+    const CRYPT_EAL_Func *funcs, void *provCtx)
+{
+    uint32_t attrLen;
+    if (!ProvCacheAttrLen(attribute, &attrLen)) {
+        return;
+    }
+    EAL_ProvCacheEntry *entry = ProvCacheEntry(libCtx, operaId, algId, attribute, attrLen);
+    uint32_t seq = entry->seq;
+    PROV_CACHE_STORE(&entry->seq, seq + 1);
+    PROV_CACHE_FENCE_RELEASE();
+    entry->gen = libCtx->cacheGen;
+    entry->operaId = operaId;
+    entry->algId = algId;
+    entry->funcs = funcs;
+    entry->provCtx = provCtx;
+    entry->attrLen = attrLen;
+    if (attrLen != 0) {
+        (void)memcpy_s(entry->attr, sizeof(entry->attr), attribute, attrLen);
+    }
+    PROV_CACHE_STORE(&entry->seq, seq + 2); // 2: back to an even counter
+}
+
+void CRYPT_EAL_ProvCacheFlush(CRYPT_EAL_LibCtx *libCtx)
+{
+    // Generation 0 marks the empty entries
+    if (__atomic_add_fetch(&libCtx->cacheGen, 1, __ATOMIC_RELEASE) == 0) {
+        (void)__atomic_add_fetch(&libCtx->cacheGen, 1, __ATOMIC_RELEASE);
+    }
+}
+
+#else
+
+bool CRYPT_EAL_ProvCacheFind(CRYPT_EAL_LibCtx *libCtx, int32_t operaId, int32_t algId, const char *attribute,
+    const CRYPT_EAL_Func **funcs, void **provCtx)
+{
+    (void)libCtx;
+    (void)operaId;
+    (void)algId;
+    (void)attribute;
+    (void)funcs;
+    (void)provCtx;
+    return false;
+}
+
+void CRYPT_EAL_ProvCacheAdd(CRYPT_EAL_LibCtx *libCtx, int32_t operaId, int32_t algId, const char *attribute,
+    const CRYPT_EAL_Func *funcs, void *provCtx)
+{
+    (void)libCtx;
+    (void)operaId;
+    (void)algId;
+    (void)attribute;
+    (void)funcs;
+    (void)provCtx;
+}
+
+void CRYPT_EAL_ProvCacheFlush(CRYPT_EAL_LibCtx *libCtx)
+{
+    (void)libCtx;
+}
+
+#endif // PROV_CACHE_LOCK_FREE
+
+#endif // HITLS_CRYPTO_PROVIDER
@@ -150,6 +150,8 @@ CRYPT_EAL_LibCtx *CRYPT_EAL_LibCtxNewInternal()
         BSL_LIST_FREE(libCtx->providers, NULL);
         goto ERR;
     }
+    // Generation 0 is reserved for the empty cache entries
+    libCtx->cacheGen = 1;
 
     return libCtx;
 ERR:
@@ -193,6 +195,7 @@ int32_t CRYPT_EAL_LoadPreDefinedProvider(CRYPT_EAL_LibCtx *libCtx)
         return ret;
     }
     mgrCtx->libCtx = libCtx;
+    CRYPT_EAL_ProvCacheFlush(libCtx);
     ret = CRYPT_EAL_InitProviderMethod(mgrCtx, NULL, CRYPT_EAL_DefaultProvInit);
     if (ret != BSL_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
@@ -453,6 +453,9 @@ int32_t CRYPT_EAL_CompareAlgAndAttr(CRYPT_EAL_LibCtx *localCtx, int32_t operaId,
     void *ctx = NULL;
     InputAttributeStrInfo attrInfo = {0};
 
+    if (CRYPT_EAL_ProvCacheFind(localCtx, operaId, algId, attribute, funcs, provCtx)) {
+        return CRYPT_SUCCESS;
+    }
     if (attribute != NULL) {
         attrInfo.attribute = attribute;
         ret = ParseAttributeString(&attrInfo);
@@ -469,6 +472,9 @@ int32_t CRYPT_EAL_CompareAlgAndAttr(CRYPT_EAL_LibCtx *localCtx, int32_t operaId,
     }
     
     FindHighestScoreFunc(localCtx, operaId, algId, attrInfo, &implFunc, &ctx);
+    if (implFunc != NULL) {
+        CRYPT_EAL_ProvCacheAdd(localCtx, operaId, algId, attribute, implFunc, ctx);
+    }
 
     BSL_SAL_ThreadUnlock(localCtx->lock);
     BSL_HASH_Destory(attrInfo.hash);
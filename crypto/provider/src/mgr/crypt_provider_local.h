@@ -24,6 +24,7 @@
 
 #ifdef HITLS_CRYPTO_PROVIDER
 #include <stdint.h>
+#include <stdbool.h>
 #include "sal_atomic.h"
 #include "crypt_eal_implprovider.h"
 #include "bsl_list.h"
@@ -32,10 +33,29 @@
 extern "C" {
 #endif // __cplusplus
 
+// Number of memoized lookups of a library context, a power of 2
+#define EAL_PROV_CACHE_SIZE 64
+// Attribute strings of this length or longer are not memoized
+#define EAL_PROV_CACHE_ATTR_LEN 64
+
+// A memoized result of CRYPT_EAL_CompareAlgAndAttr, read without the lock of the library context
+typedef struct {
+    uint32_t seq;  // odd while the entry is being written
+    uint32_t gen;  // provider generation the result belongs to, 0 for an empty entry
+    int32_t operaId;
+    int32_t algId;
+    const CRYPT_EAL_Func *funcs;
+    void *provCtx;
+    uint32_t attrLen;  // length of attr including the terminator, 0 for a NULL attribute
+    char attr[EAL_PROV_CACHE_ATTR_LEN];
+} EAL_ProvCacheEntry;
+
 struct EAL_LibCtx {
     BslList *providers; // managing providers
     BSL_SAL_ThreadLockHandle lock;
     char *searchProviderPath;
+    uint32_t cacheGen; // provider generation, changes whenever a provider is added or removed
+    EAL_ProvCacheEntry cache[EAL_PROV_CACHE_SIZE];
 };
 
 struct EAL_ProviderMgrCtx {
@@ -60,6 +80,17 @@ CRYPT_EAL_LibCtx *CRYPT_EAL_LibCtxNewInternal();
 int32_t CRYPT_EAL_CompareAlgAndAttr(CRYPT_EAL_LibCtx *localCtx, int32_t operaId,
     int32_t algId, const char *attribute, const CRYPT_EAL_Func **funcs, void **provCtx);
 
+/* Look up a memoized result without taking the lock of the library context, return true on a hit */
+bool CRYPT_EAL_ProvCacheFind(CRYPT_EAL_LibCtx *libCtx, int32_t operaId, int32_t algId, const char *attribute,
+    const CRYPT_EAL_Func **funcs, void **provCtx);
+
+/* Memoize a lookup result, the caller holds the write lock of the library context */
+void CRYPT_EAL_ProvCacheAdd(CRYPT_EAL_LibCtx *libCtx, int32_t operaId, int32_t algId, const char *attribute,
+    const CRYPT_EAL_Func *funcs, void *provCtx);
+
+/* Drop every memoized result, called with the lock held whenever the provider list changes */
+void CRYPT_EAL_ProvCacheFlush(CRYPT_EAL_LibCtx *libCtx);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -339,6 +339,32 @@ int32_t CRYPT_RSA_VerifyData(CRYPT_RSA_Ctx *ctx, const uint8_t *data, uint32_t d
 int32_t CRYPT_RSA_Verify(CRYPT_RSA_Ctx *ctx, int32_t algId, const uint8_t *data, uint32_t dataLen,
     const uint8_t *sign, uint32_t signLen);
 
+typedef struct {
+    CRYPT_RSA_Ctx *ctx;
+    const uint8_t *data;
+    uint32_t dataLen;
+    const uint8_t *sign;
+    uint32_t signLen;
+} CRYPT_RSA_VerifyItem;
+
+/**
+ * @ingroup rsa
+ * @brief RSA batch verification
+ *
+ * The public key operations of the items with the same public exponent are computed by one BN_MontExpBatch with
+ * the Montgomery contexts of the keys, with AVX-512 IFMA eight signatures are exponentiated at once.
+ *
+ * @param items   [IN] RSA contexts with public keys and padding, messages and signatures
+ * @param num     [IN] Number of items
+ * @param algId   [IN] md algId
+ * @param results [OUT] Result of each item, as returned by CRYPT_RSA_Verify, num elements
+ *
+ * @retval CRYPT_SUCCESS                    All signatures are verified successfully.
+ * @retval CRYPT_NULL_INPUT                 items or results is NULL.
+ * @retval Other error codes                Result of the first failed item, see CRYPT_RSA_Verify.
+ */
+int32_t CRYPT_RSA_BatchVerify(const CRYPT_RSA_VerifyItem *items, uint32_t num, int32_t algId, int32_t *results);
+
 int32_t CRYPT_RSA_SignData(CRYPT_RSA_Ctx *ctx, const uint8_t *data, uint32_t dataLen,
     uint8_t *sign, uint32_t *signLen);
 
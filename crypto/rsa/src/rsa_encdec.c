@@ -664,11 +664,38 @@ static int32_t VerifyInputCheck(const CRYPT_RSA_Ctx *ctx, const uint8_t *data, u
     return CRYPT_SUCCESS;
 }
 
+/* Check the encoded message recovered from the signature against the hash */
+static int32_t VerifyPad(const CRYPT_RSA_Ctx *ctx, const uint8_t *data, uint32_t dataLen,
+    const uint8_t *pad, uint32_t padLen)
+{
+    int32_t ret;
+    uint32_t saltLen = (uint32_t)ctx->pad.para.pss.saltLen;
+    switch (ctx->pad.type) {
+        case EMSA_PKCSV15:
+            ret = CRYPT_RSA_VerifyPkcsV15Type1(ctx->pad.para.pkcsv15.mdId, pad, padLen,
+                data, dataLen);
+            break;
+        case EMSA_PSS:
+            if (ctx->pad.para.pss.saltLen == CRYPT_RSA_SALTLEN_TYPE_HASHLEN) { // saltLen is -1
+                saltLen = (uint32_t)ctx->pad.para.pss.mdMeth->mdSize;
+            } else if (ctx->pad.para.pss.saltLen == CRYPT_RSA_SALTLEN_TYPE_MAXLEN) { // saltLen is -2
+                saltLen = (uint32_t)(padLen - ctx->pad.para.pss.mdMeth->mdSize - 2); // salt, obtains DRBG
+            }
+            ret = CRYPT_RSA_VerifyPss(ctx->pad.para.pss.mdMeth, ctx->pad.para.pss.mgfMeth,
+                CRYPT_RSA_GetBits(ctx), saltLen, data, dataLen, pad, padLen);
+            break;
+        default: // This branch cannot be entered because it's been verified before.
+            ret = CRYPT_RSA_PAD_NO_SET_ERROR;
+            BSL_ERR_PUSH_ERROR(ret);
+            break;
+    }
+    return ret;
+}
+
 int32_t CRYPT_RSA_VerifyData(CRYPT_RSA_Ctx *ctx, const uint8_t *data, uint32_t dataLen,
     const uint8_t *sign, uint32_t signLen)
 {
     uint8_t *pad = NULL;
-    uint32_t saltLen = 0;
     int32_t ret = VerifyInputCheck(ctx, data, dataLen, sign);
     if (ret != CRYPT_SUCCESS) {
         return ret;
@@ -686,26 +713,7 @@ int32_t CRYPT_RSA_VerifyData(CRYPT_RSA_Ctx *ctx, const uint8_t *data, uint32_t d
         BSL_ERR_PUSH_ERROR(ret);
         goto ERR;
     }
-    saltLen = (uint32_t)ctx->pad.para.pss.saltLen;
-    switch (ctx->pad.type) {
-        case EMSA_PKCSV15:
-            ret = CRYPT_RSA_VerifyPkcsV15Type1(ctx->pad.para.pkcsv15.mdId, pad, padLen,
-                data, dataLen);
-            break;
-        case EMSA_PSS:
-            if (ctx->pad.para.pss.saltLen == CRYPT_RSA_SALTLEN_TYPE_HASHLEN) { // saltLen is -1
-                saltLen = (uint32_t)ctx->pad.para.pss.mdMeth->mdSize;
-            } else if (ctx->pad.para.pss.saltLen == CRYPT_RSA_SALTLEN_TYPE_MAXLEN) { // saltLen is -2
-                saltLen = (uint32_t)(padLen - ctx->pad.para.pss.mdMeth->mdSize - 2); // salt, obtains DRBG
-            }
-            ret = CRYPT_RSA_VerifyPss(ctx->pad.para.pss.mdMeth, ctx->pad.para.pss.mgfMeth,
-                bits, saltLen, data, dataLen, pad, padLen);
-            break;
-        default: // This branch cannot be entered because it's been verified before.
-            ret = CRYPT_RSA_PAD_NO_SET_ERROR;
-            BSL_ERR_PUSH_ERROR(ret);
-            goto ERR;
-    }
+    ret = VerifyPad(ctx, data, dataLen, pad, padLen);
 ERR:
     (void)memset_s(pad, padLen, 0, padLen);
     BSL_SAL_FREE(pad);
@@ -725,6 +733,141 @@ int32_t CRYPT_RSA_Verify(CRYPT_RSA_Ctx *ctx, int32_t algId, const uint8_t *data,
     return CRYPT_RSA_VerifyData(ctx, hash, hashLen, sign, signLen);
 }
 
+/* Items of CRYPT_RSA_BatchVerify handled together, their public key operations share the exponentiations */
+#define RSA_BATCH_NUM 32
+
+typedef struct {
+    uint8_t hash[64]; // 64 is max hash len
+    uint32_t hashLen;
+    BN_BigNum *sign;
+    BN_BigNum *result;
+} RSA_BatchItem;
+
+/* The steps of CRYPT_RSA_Verify before the public key operation */
+static int32_t BatchVerifyReady(const CRYPT_RSA_VerifyItem *item, int32_t algId, RSA_BatchItem *st)
+{
+    st->hashLen = sizeof(st->hash) / sizeof(st->hash[0]);
+    int32_t ret = EAL_Md(algId, item->data, item->dataLen, st->hash, &st->hashLen);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    ret = VerifyInputCheck(item->ctx, st->hash, st->hashLen, item->sign);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    ret = AllocResultAndInputBN(CRYPT_RSA_GetBits(item->ctx), &st->result, &st->sign, item->sign, item->signLen);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    return InputRangeCheck(st->sign, item->ctx->pubKey->n);
+}
+
+/* Public key operations of the ready items, the items with the same public exponent form one batch */
+static void BatchVerifyExp(const CRYPT_RSA_VerifyItem *items, RSA_BatchItem *st, uint32_t num, int32_t *results,
+    BN_Optimizer *opt)
+{
+    uint32_t pending[RSA_BATCH_NUM];
+    uint32_t pendingNum = 0;
+    uint32_t i, k;
+    for (i = 0; i < num; i++) {
+        if (results[i] == CRYPT_SUCCESS) {
+            pending[pendingNum++] = i;
+        }
+    }
+    while (pendingNum > 0) {
+        BN_BigNum *r[RSA_BATCH_NUM];
+        const BN_BigNum *a[RSA_BATCH_NUM];
+        BN_Mont *mont[RSA_BATCH_NUM];
+        uint32_t index[RSA_BATCH_NUM];
+        uint32_t cnt = 0;
+        uint32_t rest = 0;
+        const BN_BigNum *e = items[pending[0]].ctx->pubKey->e;
+        for (k = 0; k < pendingNum; k++) {
+            i = pending[k];
+            if (BN_Cmp(items[i].ctx->pubKey->e, e) != 0) {
+                pending[rest++] = i;
+                continue;
+            }
+            r[cnt] = st[i].result;
+            a[cnt] = st[i].sign;
+            // pubKey->mont: Ensure that this value is not empty when the public key is set or generated.
+            mont[cnt] = items[i].ctx->pubKey->mont;
+            index[cnt++] = i;
+        }
+        pendingNum = rest;
+        int32_t ret = BN_MontExpBatch(r, a, e, mont, cnt, opt);
+        for (k = 0; ret != CRYPT_SUCCESS && k < cnt; k++) {
+            results[index[k]] = ret;
+        }
+    }
+}
+
+static int32_t BatchVerifyPad(const CRYPT_RSA_VerifyItem *item, const RSA_BatchItem *st, uint8_t *pad)
+{
+    uint32_t bits = CRYPT_RSA_GetBits(item->ctx);
+    uint32_t padLen = BN_BITS_TO_BYTES(bits);
+    int32_t ret = ResultToOut(bits, st->result, pad, &padLen);
+    if (ret == CRYPT_SUCCESS) {
+        ret = VerifyPad(item->ctx, st->hash, st->hashLen, pad, padLen);
+    }
+    (void)memset_s(pad, padLen, 0, padLen);
+    return ret;
+}
+
+static void BatchVerifyWindow(const CRYPT_RSA_VerifyItem *items, uint32_t num, int32_t algId, int32_t *results)
+{
+    RSA_BatchItem st[RSA_BATCH_NUM];
+    uint32_t padLen = 0;
+    uint32_t i;
+    (void)memset_s(st, sizeof(st), 0, sizeof(st));
+    for (i = 0; i < num; i++) {
+        results[i] = BatchVerifyReady(&items[i], algId, &st[i]);
+        if (results[i] == CRYPT_SUCCESS && BN_BITS_TO_BYTES(CRYPT_RSA_GetBits(items[i].ctx)) > padLen) {
+            padLen = BN_BITS_TO_BYTES(CRYPT_RSA_GetBits(items[i].ctx));
+        }
+    }
+    if (padLen != 0) {
+        BN_Optimizer *opt = BN_OptimizerCreate();
+        uint8_t *pad = BSL_SAL_Malloc(padLen);
+        if (opt == NULL || pad == NULL) {
+            BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
+            for (i = 0; i < num; i++) {
+                results[i] = (results[i] == CRYPT_SUCCESS) ? CRYPT_MEM_ALLOC_FAIL : results[i];
+            }
+        } else {
+            BatchVerifyExp(items, st, num, results, opt);
+            for (i = 0; i < num; i++) {
+                results[i] = (results[i] == CRYPT_SUCCESS) ? BatchVerifyPad(&items[i], &st[i], pad) : results[i];
+            }
+        }
+        BSL_SAL_FREE(pad);
+        BN_OptimizerDestroy(opt);
+    }
+    for (i = 0; i < num; i++) {
+        BN_Destroy(st[i].sign);
+        BN_Destroy(st[i].result);
+    }
+}
+
+int32_t CRYPT_RSA_BatchVerify(const CRYPT_RSA_VerifyItem *items, uint32_t num, int32_t algId, int32_t *results)
+{
+    if (items == NULL || results == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    uint32_t i;
+    for (i = 0; i < num; i += RSA_BATCH_NUM) {
+        BatchVerifyWindow(items + i, (num - i < RSA_BATCH_NUM) ? (num - i) : RSA_BATCH_NUM, algId, results + i);
+    }
+    for (i = 0; i < num; i++) {
+        if (results[i] != CRYPT_SUCCESS) {
+            return results[i];
+        }
+    }
+    return CRYPT_SUCCESS;
+}
+
 static int32_t EncryptInputCheck(const CRYPT_RSA_Ctx *ctx, const uint8_t *input, uint32_t inputLen,
     const uint8_t *out, const uint32_t *outLen)
 {
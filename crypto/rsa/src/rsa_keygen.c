@@ -461,34 +461,88 @@ ERR:
     return ret;
 }
 
-static int32_t RsaPGen(CRYPT_RSA_Para *para, CRYPT_RSA_PrvKey *priKey, BN_Optimizer *optimizer)
+static int32_t RsaPrimeGen(const CRYPT_RSA_Para *para, BN_BigNum *prime, uint32_t bits, BN_Optimizer *optimizer)
 {
-    uint32_t pBits = (para->bits + 1) / 2;
-    int32_t ret = BN_GenPrime(priKey->p, pBits, true, optimizer, NULL);
+    int32_t ret = BN_GenPrime(prime, bits, true, optimizer, NULL);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
         return ret;
     }
-    return RSA_Filter(priKey->p, pBits, para->e, optimizer);
+    return RSA_Filter(prime, bits, para->e, optimizer);
+}
+
+// FIPS 186-4 B.3.3 4.7 and 5.8, retry 5(nlen/2) times
+static int32_t RsaPrimeGenRetry(const CRYPT_RSA_Para *para, BN_BigNum *prime, uint32_t bits, BN_Optimizer *optimizer)
+{
+    int32_t ret = CRYPT_BN_RAND_GEN_FAIL;
+    uint32_t i;
+    for (i = 0; i < 5 * (para->bits / 2); i++) {
+        ret = RsaPrimeGen(para, prime, bits, optimizer);
+        if (ret == CRYPT_SUCCESS) {
+            break;
+        }
+    }
+    return ret;
 }
 
-static int32_t RsaQGen(CRYPT_RSA_Para *para, CRYPT_RSA_PrvKey *priKey, BN_Optimizer *optimizer)
+#if defined(HITLS_BSL_SAL_THREAD) && defined(HITLS_BSL_SAL_LOCK)
+typedef struct {
+    const CRYPT_RSA_Para *para;
+    BN_BigNum *prime;
+    uint32_t bits;
+    int32_t ret;
+} RSA_PrimeJob;
+
+static void *RsaPrimeThread(void *arg)
+{
+    RSA_PrimeJob *job = (RSA_PrimeJob *)arg;
+    BN_Optimizer *optimizer = BN_OptimizerCreate();
+    if (optimizer == NULL) {
+        job->ret = CRYPT_MEM_ALLOC_FAIL;
+    } else {
+        job->ret = RsaPrimeGenRetry(job->para, job->prime, job->bits, optimizer);
+        BN_OptimizerDestroy(optimizer);
+    }
+    // job->ret carries the result back, the error stack of the worker is dropped with it.
+    BSL_ERR_RemoveErrorStack(false);
+    return NULL;
+}
+#endif
+
+/* With parallel set, p is searched for on a worker thread while this thread searches for q. */
+static int32_t RsaTwoPrimesGen(const CRYPT_RSA_Para *para, CRYPT_RSA_PrvKey *priKey, bool parallel,
+    BN_Optimizer *optimizer)
 {
     uint32_t pBits = (para->bits + 1) / 2;
     uint32_t qBits = para->bits - pBits;
-    int32_t ret = BN_GenPrime(priKey->q, qBits, true, optimizer, NULL);
+#if defined(HITLS_BSL_SAL_THREAD) && defined(HITLS_BSL_SAL_LOCK)
+    RSA_PrimeJob job = {para, priKey->p, pBits, CRYPT_SUCCESS};
+    BSL_SAL_ThreadId thread = NULL;
+    if (parallel && BSL_SAL_ThreadCreate(&thread, RsaPrimeThread, &job) == BSL_SUCCESS) {
+        int32_t ret = RsaPrimeGenRetry(para, priKey->q, qBits, optimizer);
+        BSL_SAL_ThreadClose(thread);
+        if (ret == CRYPT_SUCCESS && job.ret != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(job.ret);
+            ret = job.ret;
+        }
+        return ret;
+    }
+#else
+    (void)parallel;
+#endif
+    int32_t ret = RsaPrimeGenRetry(para, priKey->p, pBits, optimizer);
     if (ret != CRYPT_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
         return ret;
     }
-    return RSA_Filter(priKey->q, qBits, para->e, optimizer);
+    return RsaPrimeGenRetry(para, priKey->q, qBits, optimizer);
 }
 
-static int32_t RsaPQGen(CRYPT_RSA_Para *para, CRYPT_RSA_PrvKey *priKey, BN_Optimizer *optimizer)
+static int32_t RsaPQGen(CRYPT_RSA_Para *para, CRYPT_RSA_PrvKey *priKey, bool parallel, BN_Optimizer *optimizer)
 {
     int32_t ret = CRYPT_BN_RAND_GEN_FAIL;
     uint32_t i;
     uint32_t halfBits = para->bits / 2;
+    uint32_t qBits = para->bits - (para->bits + 1) / 2;
     BN_BigNum *val = BN_Create(halfBits - 100);
     BN_BigNum *sub = BN_Create(para->bits);
     if (val == NULL || sub == NULL) {
@@ -498,30 +552,29 @@ static int32_t RsaPQGen(CRYPT_RSA_Para *para, CRYPT_RSA_PrvKey *priKey, BN_Optim
     // FIPS 186-4 B.3.3 5.4, compare with 2^(nlen/2-100)
     GOTO_ERR_IF(BN_SetBit(val, halfBits - 100), ret);
 
-    // FIPS 186-4 B.3.3 4.7, retry 5(nlen/2) times
-    for (i = 0; i < 5 * halfBits; i++) {
-        ret = RsaPGen(para, priKey, optimizer);
-        if (ret == CRYPT_SUCCESS) {
-            break;
-        }
-    }
+    ret = RsaTwoPrimesGen(para, priKey, parallel, optimizer);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
         goto ERR;
     }
 
-    // FIPS 186-4 B.3.3 5.8, retry 5(nlen/2) times
+    // FIPS 186-4 B.3.3 5.4, |p - q| > 2^(nlen/2-100), otherwise q is generated again.
     for (i = 0; i < 5 * halfBits; i++) {
-        ret = RsaQGen(para, priKey, optimizer);
-        if (ret != CRYPT_SUCCESS) {
-            continue;
-        }
         GOTO_ERR_IF(BN_Sub(sub, priKey->p, priKey->q), ret);
         GOTO_ERR_IF(BN_SetSign(sub, false), ret);
-        if (BN_Cmp(sub, val) <= 0) {
-            continue;
+        if (BN_Cmp(sub, val) > 0) {
+            break;
         }
-        break;
+        ret = RsaPrimeGenRetry(para, priKey->q, qBits, optimizer);
+        if (ret != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            goto ERR;
+        }
+    }
+    if (i == 5 * halfBits) {
+        ret = CRYPT_RSA_NOR_KEYGEN_FAIL;
+        BSL_ERR_PUSH_ERROR(ret);
+        goto ERR;
     }
     if (BN_Cmp(priKey->p, priKey->q) < 0) {
         BN_BigNum *tmp = priKey->p;
@@ -659,7 +712,7 @@ int32_t CRYPT_RSA_Gen(CRYPT_RSA_Ctx *ctx)
         BSL_ERR_PUSH_ERROR(ret);
         goto ERR;
     }
-    ret = RsaPQGen(newCtx->para, newCtx->prvKey, optimizer);
+    ret = RsaPQGen(newCtx->para, newCtx->prvKey, (ctx->flags & CRYPT_RSA_PARALLEL_KEYGEN) != 0, optimizer);
     if (ret != CRYPT_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
         goto ERR;
@@ -52,6 +52,14 @@ CRYPT_SHA1_Ctx *CRYPT_SHA1_NewCtx(void);
  */
 void CRYPT_SHA1_FreeCtx(CRYPT_SHA1_Ctx *ctx);
 
+/**
+ * @ingroup SHA1
+ * @brief Size of the md context, used to place the context in memory provided by the caller.
+ *
+ * @retval Size of the context in bytes.
+ */
+uint32_t CRYPT_SHA1_GetCtxSize(void);
+
 /**
  * @ingroup SHA1
  * @brief This API is invoked to initialize the SHA-1 context.
@@ -115,6 +123,23 @@ int32_t CRYPT_SHA1_CopyCtx(CRYPT_SHA1_Ctx *dst, const CRYPT_SHA1_Ctx *src);
  */
 CRYPT_SHA1_Ctx *CRYPT_SHA1_DupCtx(const CRYPT_SHA1_Ctx *src);
 
+/**
+ * @ingroup SHA1
+ * @brief Write the SHA1 initial hash value to state.
+ * @param state [out] Raw SHA1 state, 5 words.
+ */
+void CRYPT_SHA1_InitState(uint32_t state[5]);
+
+/**
+ * @ingroup SHA1
+ * @brief Run the SHA1 compression function over num complete blocks, without padding or length counting.
+ *        Used by callers that keep precomputed midstates, for example HMAC based KDFs.
+ * @param state [in,out] Raw SHA1 state, 5 words.
+ * @param in [in] num * CRYPT_SHA1_BLOCKSIZE bytes of input.
+ * @param num [in] Number of blocks.
+ */
+void CRYPT_SHA1_Compress(uint32_t state[5], const uint8_t *in, uint32_t num);
+
 #ifdef __cplusplus
 }
 #endif /* __cpluscplus */
@@ -54,6 +54,40 @@ void CRYPT_SHA1_FreeCtx(CRYPT_SHA1_Ctx *ctx)
     BSL_SAL_ClearFree(ctx, sizeof(CRYPT_SHA1_Ctx));
 }
 
+uint32_t CRYPT_SHA1_GetCtxSize(void)
+{
+    return sizeof(CRYPT_SHA1_Ctx);
+}
+
+void CRYPT_SHA1_InitState(uint32_t state[5])
+{
+    /**
+     *  RFC3174 6.1 Initialize the H constants of the input ctx
+     *  These constants are provided by the standard
+     */
+    state[0] = 0x67452301;
+    state[1] = 0xefcdab89;
+    state[2] = 0x98badcfe;
+    state[3] = 0x10325476;
+    state[4] = 0xc3d2e1f0;
+}
+
+static const uint8_t *SHA1_Compress(const uint8_t *input, uint32_t len, uint32_t *h)
+{
+#ifdef HITLS_CRYPTO_SHA1_X8664
+    // The cpuid state is filled in by CRYPT_EAL_Init, before that the AVX2 code is used.
+    if (IsSupportSHA()) {
+        return SHA1_StepNi(input, len, h);
+    }
+#endif
+    return SHA1_Step(input, len, h);
+}
+
+void CRYPT_SHA1_Compress(uint32_t state[5], const uint8_t *in, uint32_t num)
+{
+    (void)SHA1_Compress(in, num * CRYPT_SHA1_BLOCKSIZE, state);
+}
+
 /* e767 is because H is defined in SHA1 and MD5.
 But the both the macros are different. So masked
 this error */
@@ -66,15 +100,7 @@ int32_t CRYPT_SHA1_Init(CRYPT_SHA1_Ctx *ctx, BSL_Param *param)
     (void) param;
     (void)memset_s(ctx, sizeof(CRYPT_SHA1_Ctx), 0, sizeof(CRYPT_SHA1_Ctx));
 
-    /**
-     *  RFC3174 6.1 Initialize the H constants of the input ctx
-     *  These constants are provided by the standard
-     */
-    ctx->h[0] = 0x67452301;
-    ctx->h[1] = 0xefcdab89;
-    ctx->h[2] = 0x98badcfe;
-    ctx->h[3] = 0x10325476;
-    ctx->h[4] = 0xc3d2e1f0;
+    CRYPT_SHA1_InitState(ctx->h);
     return CRYPT_SUCCESS;
 }
 
@@ -175,14 +201,14 @@ int32_t CRYPT_SHA1_Update(CRYPT_SHA1_Ctx *ctx, const uint8_t *in, uint32_t len)
     /* Preferentially process the buf data and form a block with the user input data. */
     if (start != 0) {
         (void)memcpy_s(&ctx->m[start], left, data, left);
-        (void)SHA1_Step(ctx->m, CRYPT_SHA1_BLOCKSIZE, ctx->h);
+        (void)SHA1_Compress(ctx->m, CRYPT_SHA1_BLOCKSIZE, ctx->h);
         dataLen -= left;
         data += left;
         ctx->count = 0;
     }
 
     /* Cyclically process the input data */
-    data = SHA1_Step(data, dataLen, ctx->h);
+    data = SHA1_Compress(data, dataLen, ctx->h);
     dataLen = len - (data - in);
 
     /* The remaining data is less than one block and stored in the buf. */
@@ -227,7 +253,7 @@ int32_t CRYPT_SHA1_Final(CRYPT_SHA1_Ctx *ctx, uint8_t *out, uint32_t *len)
 
     /* If here is one complete data block, one complete data block is processed first. */
     if (ctx->count == CRYPT_SHA1_BLOCKSIZE) {
-        (void)SHA1_Step(ctx->m, CRYPT_SHA1_BLOCKSIZE, ctx->h);
+        (void)SHA1_Compress(ctx->m, CRYPT_SHA1_BLOCKSIZE, ctx->h);
         ctx->count = 0;
     }
 
@@ -239,13 +265,13 @@ int32_t CRYPT_SHA1_Final(CRYPT_SHA1_Ctx *ctx, uint8_t *out, uint32_t *len)
         (void)memset_s(&ctx->m[padPos], padLen, 0, padLen);
         padPos = 0;
         padLen = CRYPT_SHA1_BLOCKSIZE;
-        (void)SHA1_Step(ctx->m, CRYPT_SHA1_BLOCKSIZE, ctx->h);
+        (void)SHA1_Compress(ctx->m, CRYPT_SHA1_BLOCKSIZE, ctx->h);
     }
     /* offset 8 bytes, reserved for storing the data length */
     (void)memset_s(&ctx->m[padPos], (padLen - 8), 0, (padLen - 8));
     PUT_UINT32_BE(ctx->hNum, ctx->m, 56);    /* The 56th byte starts to store the upper 32-bit data. */
     PUT_UINT32_BE(ctx->lNum, ctx->m, 60);    /* The 60th byte starts to store the lower 32-bit data. */
-    (void)SHA1_Step(ctx->m, CRYPT_SHA1_BLOCKSIZE, ctx->h);
+    (void)SHA1_Compress(ctx->m, CRYPT_SHA1_BLOCKSIZE, ctx->h);
 
     PUT_UINT32_BE(ctx->h[0], out, 0);
     PUT_UINT32_BE(ctx->h[1], out, 4);
@@ -27,6 +27,10 @@ extern "C" {
 
 const uint8_t *SHA1_Step(const uint8_t *input, uint32_t len, uint32_t *h);
 
+#ifdef HITLS_CRYPTO_SHA1_X8664
+const uint8_t *SHA1_StepNi(const uint8_t *input, uint32_t len, uint32_t *h);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -171,6 +171,14 @@ CRYPT_SHA2_256_Ctx *CRYPT_SHA2_256_NewCtx(void);
  */
 void CRYPT_SHA2_256_FreeCtx(CRYPT_SHA2_256_Ctx *ctx);
 
+/**
+ * @ingroup SHA2_256
+ * @brief Size of the md context, used to place the context in memory provided by the caller. SHA2_224 uses the same context.
+ *
+ * @retval Size of the context in bytes.
+ */
+uint32_t CRYPT_SHA2_256_GetCtxSize(void);
+
 /**
  * @defgroup CRYPT_SHA2_256_Init
  * @ingroup LLF Low Level Functions
@@ -375,6 +383,14 @@ CRYPT_SHA2_512_Ctx *CRYPT_SHA2_512_NewCtx(void);
  */
 void CRYPT_SHA2_512_FreeCtx(CRYPT_SHA2_512_Ctx *ctx);
 
+/**
+ * @ingroup SHA2_512
+ * @brief Size of the md context, used to place the context in memory provided by the caller. SHA2_384 uses the same context.
+ *
+ * @retval Size of the context in bytes.
+ */
+uint32_t CRYPT_SHA2_512_GetCtxSize(void);
+
 /**
  * @ingroup LLF Low Level Functions
  * @par Prototype
@@ -502,6 +518,34 @@ int32_t CRYPT_SHA2_256_CopyCtx(CRYPT_SHA2_256_Ctx *dst, const CRYPT_SHA2_256_Ctx
  * @param src [in]   Pointer to the original SHA256 context.
  */
 CRYPT_SHA2_256_Ctx *CRYPT_SHA2_256_DupCtx(const CRYPT_SHA2_256_Ctx *src);
+
+/**
+ * @ingroup SHA256
+ * @brief Write the SHA256 initial hash value H(0) to state.
+ * @param state [out] Raw SHA256 state, 8 words.
+ */
+void CRYPT_SHA2_256_InitState(uint32_t state[8]);
+
+/**
+ * @ingroup SHA256
+ * @brief Run the SHA256 compression function over num complete blocks, without padding or length counting.
+ *        Used by callers that keep precomputed midstates, for example HMAC based KDFs.
+ * @param state [in,out] Raw SHA256 state, 8 words.
+ * @param in [in] num * CRYPT_SHA2_256_BLOCKSIZE bytes of input.
+ * @param num [in] Number of blocks.
+ */
+void CRYPT_SHA2_256_Compress(uint32_t state[8], const uint8_t *in, uint32_t num);
+
+/**
+ * @ingroup SHA256
+ * @brief Compress one block into each of two independent SHA256 states. With the SHA extensions both
+ *        compressions are interleaved, otherwise this is two CRYPT_SHA2_256_Compress calls.
+ * @param stateA [in,out] First raw SHA256 state.
+ * @param inA [in] Block of the first state.
+ * @param stateB [in,out] Second raw SHA256 state.
+ * @param inB [in] Block of the second state.
+ */
+void CRYPT_SHA2_256_CompressTwo(uint32_t stateA[8], const uint8_t *inA, uint32_t stateB[8], const uint8_t *inB);
 #endif // HITLS_CRYPTO_SHA256
 
 #ifdef HITLS_CRYPTO_SHA384
@@ -554,6 +598,22 @@ int32_t CRYPT_SHA2_512_CopyCtx(CRYPT_SHA2_512_Ctx *dst, const CRYPT_SHA2_512_Ctx
  * @param src [in]   Pointer to the original SHA512 context.
  */
 CRYPT_SHA2_512_Ctx *CRYPT_SHA2_512_DupCtx(const CRYPT_SHA2_512_Ctx *src);
+
+/**
+ * @ingroup SHA512
+ * @brief Write the SHA512 initial hash value H(0) to state.
+ * @param state [out] Raw SHA512 state, 8 words.
+ */
+void CRYPT_SHA2_512_InitState(uint64_t state[8]);
+
+/**
+ * @ingroup SHA512
+ * @brief Run the SHA512 compression function over num complete blocks, without padding or length counting.
+ * @param state [in,out] Raw SHA512 state, 8 words.
+ * @param in [in] num * CRYPT_SHA2_512_BLOCKSIZE bytes of input.
+ * @param num [in] Number of blocks.
+ */
+void CRYPT_SHA2_512_Compress(uint64_t state[8], const uint8_t *in, uint32_t num);
 #endif // HITLS_CRYPTO_SHA512
 
 #ifdef __cplusplus
@@ -48,14 +48,13 @@ void CRYPT_SHA2_256_FreeCtx(CRYPT_SHA2_256_Ctx *ctx)
     BSL_SAL_ClearFree(ctx, sizeof(CRYPT_SHA2_256_Ctx));
 }
 
-int32_t CRYPT_SHA2_256_Init(CRYPT_SHA2_256_Ctx *ctx, BSL_Param *param)
+uint32_t CRYPT_SHA2_256_GetCtxSize(void)
+{
+    return sizeof(CRYPT_SHA2_256_Ctx);
+}
+
+void CRYPT_SHA2_256_InitState(uint32_t state[8])
 {
-    if (ctx == NULL) {
-        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
-        return CRYPT_NULL_INPUT;
-    }
-    (void) param;
-    (void)memset_s(ctx, sizeof(CRYPT_SHA2_256_Ctx), 0, sizeof(CRYPT_SHA2_256_Ctx));
     /**
      * @RFC 4634 6.1 SHA-224 and SHA-256 Initialization
      * SHA-256, the initial hash value, H(0):
@@ -68,14 +67,56 @@ int32_t CRYPT_SHA2_256_Init(CRYPT_SHA2_256_Ctx *ctx, BSL_Param *param)
      * H(0)6 = 1f83d9ab
      * H(0)7 = 5be0cd19
      */
-    ctx->h[0] = 0x6a09e667UL;
-    ctx->h[1] = 0xbb67ae85UL;
-    ctx->h[2] = 0x3c6ef372UL;
-    ctx->h[3] = 0xa54ff53aUL;
-    ctx->h[4] = 0x510e527fUL;
-    ctx->h[5] = 0x9b05688cUL;
-    ctx->h[6] = 0x1f83d9abUL;
-    ctx->h[7] = 0x5be0cd19UL;
+    state[0] = 0x6a09e667UL;
+    state[1] = 0xbb67ae85UL;
+    state[2] = 0x3c6ef372UL;
+    state[3] = 0xa54ff53aUL;
+    state[4] = 0x510e527fUL;
+    state[5] = 0x9b05688cUL;
+    state[6] = 0x1f83d9abUL;
+    state[7] = 0x5be0cd19UL;
+}
+
+#ifdef HITLS_CRYPTO_SHA2_X8664
+static bool SHA256_UseNi(void)
+{
+    // The cpuid state is filled in by CRYPT_EAL_Init, before that the AVX2 code is used.
+    return IsSupportSHA();
+}
+#endif
+
+void CRYPT_SHA2_256_Compress(uint32_t state[8], const uint8_t *in, uint32_t num)
+{
+#ifdef HITLS_CRYPTO_SHA2_X8664
+    if (SHA256_UseNi()) {
+        SHA256CompressMultiBlocksNi(state, in, num);
+        return;
+    }
+#endif
+    SHA256CompressMultiBlocks(state, in, num);
+}
+
+void CRYPT_SHA2_256_CompressTwo(uint32_t stateA[8], const uint8_t *inA, uint32_t stateB[8], const uint8_t *inB)
+{
+#ifdef HITLS_CRYPTO_SHA2_X8664
+    if (SHA256_UseNi()) {
+        SHA256CompressTwoNi(stateA, inA, stateB, inB);
+        return;
+    }
+#endif
+    SHA256CompressMultiBlocks(stateA, inA, 1);
+    SHA256CompressMultiBlocks(stateB, inB, 1);
+}
+
+int32_t CRYPT_SHA2_256_Init(CRYPT_SHA2_256_Ctx *ctx, BSL_Param *param)
+{
+    if (ctx == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    (void) param;
+    (void)memset_s(ctx, sizeof(CRYPT_SHA2_256_Ctx), 0, sizeof(CRYPT_SHA2_256_Ctx));
+    CRYPT_SHA2_256_InitState(ctx->h);
     ctx->outlen = CRYPT_SHA2_256_DIGESTSIZE;
     return CRYPT_SUCCESS;
 }
@@ -185,7 +226,7 @@ int32_t CRYPT_SHA2_256_Update(CRYPT_SHA2_256_Ctx *ctx, const uint8_t *data, uint
             BSL_ERR_PUSH_ERROR(CRYPT_SECUREC_FAIL);
             return CRYPT_SECUREC_FAIL;
         }
-        SHA256CompressMultiBlocks(ctx->h, p, 1);
+        CRYPT_SHA2_256_Compress(ctx->h, p, 1);
         n = CRYPT_SHA2_256_BLOCKSIZE - n;
         d += n;
         left -= n;
@@ -195,7 +236,7 @@ int32_t CRYPT_SHA2_256_Update(CRYPT_SHA2_256_Ctx *ctx, const uint8_t *data, uint
 
     n = (uint32_t)(left / CRYPT_SHA2_256_BLOCKSIZE);
     if (n > 0) {
-        SHA256CompressMultiBlocks(ctx->h, d, n);
+        CRYPT_SHA2_256_Compress(ctx->h, d, n);
         n *= CRYPT_SHA2_256_BLOCKSIZE;
         d += n;
         left -= n;
@@ -245,7 +286,7 @@ int32_t CRYPT_SHA2_256_Final(CRYPT_SHA2_256_Ctx *ctx, uint8_t *digest, uint32_t
     if (n > (CRYPT_SHA2_256_BLOCKSIZE - 8)) { /* 8 bytes to save bits of input */
         (void)memset_s(p + n, CRYPT_SHA2_256_BLOCKSIZE - n, 0, CRYPT_SHA2_256_BLOCKSIZE - n);
         n = 0;
-        SHA256CompressMultiBlocks(ctx->h, p, 1);
+        CRYPT_SHA2_256_Compress(ctx->h, p, 1);
     }
     (void)memset_s(p + n, CRYPT_SHA2_256_BLOCKSIZE - n, 0,
         CRYPT_SHA2_256_BLOCKSIZE - 8 - n); /* 8 bytes to save bits of input */
@@ -256,7 +297,7 @@ int32_t CRYPT_SHA2_256_Final(CRYPT_SHA2_256_Ctx *ctx, uint8_t *digest, uint32_t
     PUT_UINT32_BE(ctx->lNum, p, 0);
     p += sizeof(uint32_t);
     p -= CRYPT_SHA2_256_BLOCKSIZE;
-    SHA256CompressMultiBlocks(ctx->h, p, 1);
+    CRYPT_SHA2_256_Compress(ctx->h, p, 1);
     ctx->blocklen = 0;
     (void)memset_s(p, CRYPT_SHA2_256_BLOCKSIZE, 0, CRYPT_SHA2_256_BLOCKSIZE);
 
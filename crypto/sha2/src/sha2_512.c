@@ -87,6 +87,29 @@ void CRYPT_SHA2_512_FreeCtx(CRYPT_SHA2_512_Ctx *ctx)
     BSL_SAL_ClearFree(ctx, sizeof(CRYPT_SHA2_512_Ctx));
 }
 
+uint32_t CRYPT_SHA2_512_GetCtxSize(void)
+{
+    return sizeof(CRYPT_SHA2_512_Ctx);
+}
+
+void CRYPT_SHA2_512_InitState(uint64_t state[8])
+{
+    // see RFC6234 chapter 6.3
+    state[0] = U64(0x6a09e667f3bcc908);
+    state[1] = U64(0xbb67ae8584caa73b);
+    state[2] = U64(0x3c6ef372fe94f82b);
+    state[3] = U64(0xa54ff53a5f1d36f1);
+    state[4] = U64(0x510e527fade682d1);
+    state[5] = U64(0x9b05688c2b3e6c1f);
+    state[6] = U64(0x1f83d9abfb41bd6b);
+    state[7] = U64(0x5be0cd19137e2179);
+}
+
+void CRYPT_SHA2_512_Compress(uint64_t state[8], const uint8_t *in, uint32_t num)
+{
+    SHA512CompressMultiBlocks(state, in, num);
+}
+
 int32_t CRYPT_SHA2_512_Init(CRYPT_SHA2_512_Ctx *ctx, BSL_Param *param)
 {
     if (ctx == NULL) {
@@ -97,15 +120,7 @@ int32_t CRYPT_SHA2_512_Init(CRYPT_SHA2_512_Ctx *ctx, BSL_Param *param)
 
     (void)memset_s(ctx, sizeof(CRYPT_SHA2_512_Ctx), 0, sizeof(CRYPT_SHA2_512_Ctx));
 
-    // see RFC6234 chapter 6.3
-    ctx->h[0] = U64(0x6a09e667f3bcc908);
-    ctx->h[1] = U64(0xbb67ae8584caa73b);
-    ctx->h[2] = U64(0x3c6ef372fe94f82b);
-    ctx->h[3] = U64(0xa54ff53a5f1d36f1);
-    ctx->h[4] = U64(0x510e527fade682d1);
-    ctx->h[5] = U64(0x9b05688c2b3e6c1f);
-    ctx->h[6] = U64(0x1f83d9abfb41bd6b);
-    ctx->h[7] = U64(0x5be0cd19137e2179);
+    CRYPT_SHA2_512_InitState(ctx->h);
     ctx->mdlen = CRYPT_SHA2_512_DIGESTSIZE;
 
     return CRYPT_SUCCESS;
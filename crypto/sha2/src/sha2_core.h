@@ -28,6 +28,10 @@ extern "C" {
 
 #ifdef HITLS_CRYPTO_SHA256
 void SHA256CompressMultiBlocks(uint32_t hash[8], const uint8_t *in, uint32_t num);
+#ifdef HITLS_CRYPTO_SHA2_X8664
+void SHA256CompressMultiBlocksNi(uint32_t hash[8], const uint8_t *in, uint32_t num);
+void SHA256CompressTwoNi(uint32_t hashA[8], const uint8_t *inA, uint32_t hashB[8], const uint8_t *inB);
+#endif
 #endif
 
 #ifdef HITLS_CRYPTO_SHA512
@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include "crypt_types.h"
+#include "crypt_algid.h"
 #include "bsl_params.h"
 
 #ifdef __cplusplus
@@ -84,6 +85,9 @@ void CRYPT_SHA3_512_FreeCtx(CRYPT_SHA3_512_Ctx* ctx);
 void CRYPT_SHAKE128_FreeCtx(CRYPT_SHAKE128_Ctx* ctx);
 void CRYPT_SHAKE256_FreeCtx(CRYPT_SHAKE256_Ctx* ctx);
 
+// size of the context shared by all SHA3 and SHAKE algorithms
+uint32_t CRYPT_SHA3_GetCtxSize(void);
+
 // free context
 
 // Initialize the context
@@ -145,6 +149,36 @@ CRYPT_SHA3_384_Ctx *CRYPT_SHA3_384_DupCtx(const CRYPT_SHA3_384_Ctx *src);
 CRYPT_SHA3_512_Ctx *CRYPT_SHA3_512_DupCtx(const CRYPT_SHA3_512_Ctx *src);
 CRYPT_SHA3_384_Ctx *CRYPT_SHAKE128_DupCtx(const CRYPT_SHA3_384_Ctx *src);
 CRYPT_SHA3_512_Ctx *CRYPT_SHAKE256_DupCtx(const CRYPT_SHA3_512_Ctx *src);
+
+/* Maximum number of SHAKE instances processed together by the CRYPT_SHAKE_Mb* functions. */
+#define CRYPT_SHAKE_MB_MAX_NUM 8
+
+/* Up to CRYPT_SHAKE_MB_MAX_NUM independent SHAKE128 or SHAKE256 instances that absorb inputs of
+ * the same length and squeeze outputs of the same length together. The Keccak permutations of
+ * the instances run in the AVX2 (4 instances) or AVX-512 (8 instances) lanes when available. */
+typedef struct CryptShakeMbCtx CRYPT_SHAKE_MbCtx;
+
+CRYPT_SHAKE_MbCtx *CRYPT_SHAKE_MbNewCtx(void);
+void CRYPT_SHAKE_MbFreeCtx(CRYPT_SHAKE_MbCtx *ctx);
+
+/**
+ * @brief Initialize num instances of CRYPT_MD_SHAKE128 or CRYPT_MD_SHAKE256, num is in [1, CRYPT_SHAKE_MB_MAX_NUM].
+ */
+int32_t CRYPT_SHAKE_MbInit(CRYPT_SHAKE_MbCtx *ctx, CRYPT_MD_AlgId id, uint32_t num);
+
+/**
+ * @brief Absorb len bytes of in[i] into the instance i, for each instance.
+ *        Returns CRYPT_SHA3_ERR_STATE once the output has been squeezed.
+ */
+int32_t CRYPT_SHAKE_MbUpdate(CRYPT_SHAKE_MbCtx *ctx, const uint8_t *const *in, uint32_t len);
+
+/**
+ * @brief Squeeze the next len bytes of the instance i into out[i], for each instance.
+ *        The first call pads the inputs, it can be called repeatedly to extend the outputs.
+ */
+int32_t CRYPT_SHAKE_MbSqueeze(CRYPT_SHAKE_MbCtx *ctx, uint8_t *const *out, uint32_t len);
+
+void CRYPT_SHAKE_MbDeinit(CRYPT_SHAKE_MbCtx *ctx);
 #ifdef __cplusplus
 }
 #endif
@@ -50,6 +50,11 @@ static void CRYPT_SHA3_FreeCtx(CRYPT_SHA3_Ctx *ctx)
     BSL_SAL_ClearFree(ctx, sizeof(CRYPT_SHA3_Ctx));
 }
 
+uint32_t CRYPT_SHA3_GetCtxSize(void)
+{
+    return sizeof(CRYPT_SHA3_Ctx);
+}
+
 static int32_t CRYPT_SHA3_Init(CRYPT_SHA3_Ctx *ctx, uint32_t mdSize, uint32_t blockSize, uint8_t padChr)
 {
     if (ctx == NULL) {
@@ -25,9 +25,25 @@
 extern "C" {
 #endif
 
+// Maximum number of states permuted together by SHA3_KeccakMb.
+#define SHA3_MB_MAX_NUM 8
+
 const uint8_t *SHA3_Absorb(uint8_t *state, const uint8_t *in, uint32_t inLen, uint32_t r);
 void SHA3_Squeeze(uint8_t *state, uint8_t *out, uint32_t outLen, uint32_t r);
 
+// Keccak-f[1600] permutation of the 200 bytes state.
+void SHA3_Keccak(uint8_t *state);
+
+// Keccak-f[1600] permutation of the first num (<= SHA3_MB_MAX_NUM) interleaved states,
+// lane i of state j is state[i * SHA3_MB_MAX_NUM + j].
+void SHA3_KeccakMb(uint64_t *state, uint32_t num);
+
+#ifdef HITLS_CRYPTO_SHA3_X8664
+void SHA3_KeccakAvx512(uint8_t *state);
+void SHA3_KeccakX8Avx512(uint64_t *state);
+void SHA3_KeccakX4Avx2(uint64_t *state);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
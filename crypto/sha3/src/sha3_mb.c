@@ -0,0 +1,218 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#ifdef HITLS_CRYPTO_SHA3
+
+#include <stdbool.h>
+#include "securec.h"
+#include "crypt_errno.h"
+#include "crypt_utils.h"
+#include "bsl_err_internal.h"
+#include "bsl_sal.h"
+#include "sha3_core.h"
+#include "crypt_sha3.h"
+
+#define SHAKE_PAD_CHR 0x1F
+
+struct CryptShakeMbCtx {
+    uint64_t state[25 * SHA3_MB_MAX_NUM];     // Interleaved states, lane i of instance j is state[i * 8 + j]
+    uint8_t buf[SHA3_MB_MAX_NUM][CRYPT_SHAKE128_BLOCKSIZE]; // Non-integer multiple data cache of each instance
+    uint32_t num;           // Number of instances
+    uint32_t blockSize;     // 168 for shake128, 136 for shake256
+    uint32_t pos;           // Data length in buf when absorbing, bytes used from the current block when squeezing
+    bool squeezing;
+};
+
+CRYPT_SHAKE_MbCtx *CRYPT_SHAKE_MbNewCtx(void)
+{
+    return BSL_SAL_Calloc(1, sizeof(CRYPT_SHAKE_MbCtx));
+}
+
+void CRYPT_SHAKE_MbFreeCtx(CRYPT_SHAKE_MbCtx *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    BSL_SAL_ClearFree(ctx, sizeof(CRYPT_SHAKE_MbCtx));
+}
+
+int32_t CRYPT_SHAKE_MbInit(CRYPT_SHAKE_MbCtx *ctx, CRYPT_MD_AlgId id, uint32_t num)
+{
+    if (ctx == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (id != CRYPT_MD_SHAKE128 && id != CRYPT_MD_SHAKE256) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NOT_SUPPORT);
+        return CRYPT_NOT_SUPPORT;
+    }
+    if (num == 0 || num > CRYPT_SHAKE_MB_MAX_NUM) {
+        BSL_ERR_PUSH_ERROR(CRYPT_INVALID_ARG);
+        return CRYPT_INVALID_ARG;
+    }
+    (void)memset_s(ctx, sizeof(CRYPT_SHAKE_MbCtx), 0, sizeof(CRYPT_SHAKE_MbCtx));
+    ctx->num = num;
+    ctx->blockSize = (id == CRYPT_MD_SHAKE128) ? CRYPT_SHAKE128_BLOCKSIZE : CRYPT_SHAKE256_BLOCKSIZE;
+    return CRYPT_SUCCESS;
+}
+
+// XOR one block of each instance into its state, then permute all states.
+static void ShakeMbAbsorbBlock(CRYPT_SHAKE_MbCtx *ctx, const uint8_t *const *in, uint32_t offset)
+{
+    uint32_t laneNum = ctx->blockSize / 8;
+    for (uint32_t j = 0; j < ctx->num; j++) {
+        const uint8_t *data = in[j] + offset;
+        for (uint32_t i = 0; i < laneNum; i++) {
+            ctx->state[i * SHA3_MB_MAX_NUM + j] ^= GET_UINT64_LE(data, i << 3); // left shift by 3 equals i * 8.
+        }
+    }
+    SHA3_KeccakMb(ctx->state, ctx->num);
+}
+
+static void ShakeMbAbsorbBuf(CRYPT_SHAKE_MbCtx *ctx)
+{
+    const uint8_t *bufs[SHA3_MB_MAX_NUM];
+    for (uint32_t j = 0; j < ctx->num; j++) {
+        bufs[j] = ctx->buf[j];
+    }
+    ShakeMbAbsorbBlock(ctx, bufs, 0);
+}
+
+static bool ShakeMbInputIsValid(const uint8_t *const *data, uint32_t num)
+{
+    if (data == NULL) {
+        return false;
+    }
+    for (uint32_t j = 0; j < num; j++) {
+        if (data[j] == NULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t CRYPT_SHAKE_MbUpdate(CRYPT_SHAKE_MbCtx *ctx, const uint8_t *const *in, uint32_t len)
+{
+    if (ctx == NULL || (len != 0 && !ShakeMbInputIsValid(in, ctx->num))) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (ctx->num == 0 || ctx->squeezing) {
+        BSL_ERR_PUSH_ERROR(CRYPT_SHA3_ERR_STATE);
+        return CRYPT_SHA3_ERR_STATE;
+    }
+    uint32_t offset = 0;
+    uint32_t left = ctx->blockSize - ctx->pos;
+    if (ctx->pos != 0) {
+        uint32_t copyLen = (len < left) ? len : left;
+        for (uint32_t j = 0; j < ctx->num; j++) {
+            (void)memcpy_s(ctx->buf[j] + ctx->pos, left, in[j], copyLen);
+        }
+        ctx->pos += copyLen;
+        if (ctx->pos < ctx->blockSize) {
+            return CRYPT_SUCCESS;
+        }
+        ShakeMbAbsorbBuf(ctx);
+        offset = copyLen;
+        ctx->pos = 0;
+    }
+    while (len - offset >= ctx->blockSize) {
+        ShakeMbAbsorbBlock(ctx, in, offset);
+        offset += ctx->blockSize;
+    }
+    if (len != offset) {
+        // copy the remaining data to the cache array
+        for (uint32_t j = 0; j < ctx->num; j++) {
+            (void)memcpy_s(ctx->buf[j], ctx->blockSize, in[j] + offset, len - offset);
+        }
+        ctx->pos = len - offset;
+    }
+    return CRYPT_SUCCESS;
+}
+
+static void ShakeMbPad(CRYPT_SHAKE_MbCtx *ctx)
+{
+    uint32_t left = ctx->blockSize - ctx->pos;
+    for (uint32_t j = 0; j < ctx->num; j++) {
+        (void)memset_s(ctx->buf[j] + ctx->pos, left, 0, left);
+        ctx->buf[j][ctx->pos] = SHAKE_PAD_CHR;
+        ctx->buf[j][ctx->blockSize - 1] |= 0x80; // 0x80 is the last 1 of pad 10*1 mode
+    }
+    ShakeMbAbsorbBuf(ctx);
+    ctx->pos = 0;
+    ctx->squeezing = true;
+}
+
+// Copy len bytes of the instance j from the byte pos of its state.
+static void ShakeMbExtract(const uint64_t *state, uint32_t j, uint32_t pos, uint8_t *out, uint32_t len)
+{
+    uint8_t lane[8];
+    uint32_t done = 0;
+    if ((pos & 7) == 0) {
+        // Whole lanes are written directly.
+        const uint64_t *src = state + (pos >> 3) * SHA3_MB_MAX_NUM + j;
+        for (; len - done >= 8; done += 8, src += SHA3_MB_MAX_NUM) {
+            PUT_UINT64_LE(*src, out, done);
+        }
+    }
+    while (done < len) {
+        uint32_t off = (pos + done) & 7;
+        uint32_t copyLen = (8 - off < len - done) ? (8 - off) : (len - done);
+        PUT_UINT64_LE(state[((pos + done) >> 3) * SHA3_MB_MAX_NUM + j], lane, 0);
+        (void)memcpy_s(out + done, len - done, lane + off, copyLen);
+        done += copyLen;
+    }
+}
+
+int32_t CRYPT_SHAKE_MbSqueeze(CRYPT_SHAKE_MbCtx *ctx, uint8_t *const *out, uint32_t len)
+{
+    if (ctx == NULL || (len != 0 && !ShakeMbInputIsValid((const uint8_t *const *)out, ctx->num))) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (ctx->num == 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_SHA3_ERR_STATE);
+        return CRYPT_SHA3_ERR_STATE;
+    }
+    if (!ctx->squeezing) {
+        ShakeMbPad(ctx);
+    }
+    uint32_t done = 0;
+    while (done < len) {
+        if (ctx->pos == ctx->blockSize) {
+            SHA3_KeccakMb(ctx->state, ctx->num);
+            ctx->pos = 0;
+        }
+        uint32_t copyLen = ctx->blockSize - ctx->pos;
+        copyLen = (copyLen < len - done) ? copyLen : (len - done);
+        for (uint32_t j = 0; j < ctx->num; j++) {
+            ShakeMbExtract(ctx->state, j, ctx->pos, out[j] + done, copyLen);
+        }
+        ctx->pos += copyLen;
+        done += copyLen;
+    }
+    return CRYPT_SUCCESS;
+}
+
+void CRYPT_SHAKE_MbDeinit(CRYPT_SHAKE_MbCtx *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    BSL_SAL_CleanseData(ctx, sizeof(CRYPT_SHAKE_MbCtx));
+}
+
+#endif // HITLS_CRYPTO_SHA3
@@ -175,7 +175,7 @@ int32_t CRYPT_SM2_Encrypt(CRYPT_SM2_Ctx *ctx, const uint8_t *data, uint32_t data
         GOTO_ERR_IF(ParaCheckAndCalculate(ctx, tmp, k), ret);
         GOTO_ERR_IF(ECC_EncodePoint(ctx->pkey->para, tmp, tmpBuf, &buflen, CRYPT_POINT_UNCOMPRESSED), ret);
         // Calculate the kdf.
-        GOTO_ERR_IF(KdfGmt0032012(c2, &datalen, tmpBuf + 1, buflen - 1, ctx->hashMethod), ret);
+        GOTO_ERR_IF(KdfGmt0032012(c2, &datalen, tmpBuf + 1, buflen - 1), ret);
         if (IsDataZero(c2, datalen) == CRYPT_SUCCESS) {
             break;
         }
@@ -285,7 +285,7 @@ int32_t CRYPT_SM2_Decrypt(CRYPT_SM2_Ctx *ctx, const uint8_t *data, uint32_t data
     // Extract x and y of the point tmp and save them to tmpbuf.
     GOTO_ERR_IF(ECC_EncodePoint(ctx->pkey->para, tmp, tmpBuf, &tmplen, CRYPT_POINT_UNCOMPRESSED), ret);
     // Calculate kdf(x2 || y2, klen), klen is msglen
-    GOTO_ERR_IF(KdfGmt0032012(t, &klen, tmpBuf + 1, tmplen - 1, ctx->hashMethod), ret);
+    GOTO_ERR_IF(KdfGmt0032012(t, &klen, tmpBuf + 1, tmplen - 1), ret);
     // Check whether t is all 0s. If yes, report an error and exit.
     GOTO_ERR_IF(IsDataZero(t, klen), ret);
     // Calculate M' = C2 ^ t
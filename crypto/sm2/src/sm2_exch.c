@@ -28,50 +28,17 @@
 #include "crypt_ecc_pkey.h"
 #include "crypt_local_types.h"
 #include "crypt_sm2.h"
+#include "crypt_sm3.h"
 #include "sm2_local.h"
 
 /*  GM/T003_2012 Defined Key Derive Function  */
-int32_t KdfGmt0032012(uint8_t *out, const uint32_t *outlen, const uint8_t *z, uint32_t zlen,
-    const EAL_MdMethod *hashMethod)
+int32_t KdfGmt0032012(uint8_t *out, const uint32_t *outlen, const uint8_t *z, uint32_t zlen)
 {
-    if (out == NULL || outlen == NULL || *outlen == 0 || (z == NULL && zlen != 0)  ||  hashMethod == NULL) {
+    if (out == NULL || outlen == NULL || *outlen == 0 || (z == NULL && zlen != 0)) {
         BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
         return CRYPT_NULL_INPUT;
     }
-    uint32_t counter;
-    uint8_t ctr[4];
-    uint32_t mdlen;
-    int32_t ret;
-    uint32_t len = MAX_MD_SIZE;
-    void *mdCtx = hashMethod->newCtx();
-    uint8_t dgst[MAX_MD_SIZE];
-    uint8_t *tmp = out;
-    uint32_t tmplen = *outlen;
-    if (mdCtx == NULL) {
-        ret = CRYPT_MEM_ALLOC_FAIL;
-        BSL_ERR_PUSH_ERROR(CRYPT_MEM_ALLOC_FAIL);
-        goto ERR;
-    }
-    mdlen = (uint32_t)hashMethod->mdSize;
-    for (counter = 1;; counter++) {
-        GOTO_ERR_IF(hashMethod->init(mdCtx, NULL), ret);
-        PUT_UINT32_BE(counter, ctr, 0);
-        GOTO_ERR_IF(hashMethod->update(mdCtx, z, zlen), ret);
-        GOTO_ERR_IF(hashMethod->update(mdCtx, ctr, sizeof(ctr)), ret);
-        GOTO_ERR_IF(hashMethod->final(mdCtx, dgst, &len), ret);
-        if (tmplen > mdlen) {
-            (void)memcpy_s(tmp, tmplen, dgst, mdlen);
-            tmp += mdlen;
-            tmplen -= mdlen;
-        } else {
-            (void)memcpy_s(tmp, tmplen, dgst, tmplen);
-            (void)memset_s(dgst, mdlen, 0, mdlen);
-            break;
-        }
-    }
-ERR:
-    hashMethod->freeCtx(mdCtx);
-    return ret;
+    return CRYPT_SM3_Kdf(z, zlen, out, *outlen);
 }
 
 void Sm2CleanR(CRYPT_SM2_Ctx *ctx)
@@ -118,7 +85,7 @@ static int32_t Sm2CalculateKey(const CRYPT_SM2_Ctx *selfCtx, const CRYPT_SM2_Ctx
         GOTO_ERR_IF_EX(Sm2ComputeZDigest(selfCtx, buf + dataLen, &curLen), ret);
         dataLen += curLen;
     }
-    GOTO_ERR_IF(KdfGmt0032012(out, outlen, (const uint8_t *)(buf + 1), dataLen - 1, selfCtx->hashMethod), ret);
+    GOTO_ERR_IF(KdfGmt0032012(out, outlen, (const uint8_t *)(buf + 1), dataLen - 1), ret);
 ERR:
     BSL_SAL_FREE(buf);
     return ret;
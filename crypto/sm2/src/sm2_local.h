@@ -52,12 +52,15 @@ struct SM2_Ctx {
     uint8_t sumCheck[SM3_MD_SIZE]; // Hash value used as a check
     uint8_t sumSend[SM3_MD_SIZE]; // Hash value sent to the peer end
     uint8_t isSumValid; // Indicates whether the checksum is valid. 1: valid; 0: invalid.
+    uint8_t zDigest[SM3_MD_SIZE]; // Z digest of the public key and user ID, computed when either of them is set.
+    uint8_t isZValid; // Indicates whether zDigest matches the current public key and user ID. 1: valid; 0: invalid.
     BSL_SAL_RefCount references;
 };
 
 /**
  * @ingroup sm2
  * @brief The sm2 invokes the SM3 to calculate the hash value.
+ *        The Z digest computed when the public key or user ID was set is used if it is valid.
  *
  * @param ctx [IN] sm2 context structure
  * @param out [IN/OUT] Hash value
@@ -71,19 +74,17 @@ int32_t Sm2ComputeZDigest(const CRYPT_SM2_Ctx *ctx, uint8_t *out, uint32_t *outL
 #if defined(HITLS_CRYPTO_SM2_EXCH) || defined(HITLS_CRYPTO_SM2_CRYPT)
 /**
  * @ingroup sm2
- * @brief sm2 kdf function
+ * @brief sm2 kdf function, built on SM3
  *
  * @param out [IN/OUT] Calculation result
  * @param outlen [IN/OUT] Output data length
  * @param z [IN] Input data
  * @param zlen [IN] Length of the input data
- * @param hashMethod [IN] hash method
  *
  * @retval CRYPT_SUCCESS    calculated successfully.
  * @retval Other: The calculation fails. For details about the return value type, see crypt_errno.h.
  */
-int32_t KdfGmt0032012(uint8_t *out, const uint32_t *outlen, const uint8_t *z, uint32_t zlen,
-    const EAL_MdMethod *hashMethod);
+int32_t KdfGmt0032012(uint8_t *out, const uint32_t *outlen, const uint8_t *z, uint32_t zlen);
 #endif
 
 #ifdef __cplusplus
@@ -96,9 +96,11 @@ CRYPT_SM2_Ctx *CRYPT_SM2_DupCtx(CRYPT_SM2_Ctx *ctx)
     newCtx->hashMethod = ctx->hashMethod;
     newCtx->server = ctx->server;
     newCtx->isSumValid = ctx->isSumValid;
+    newCtx->isZValid = ctx->isZValid;
     BSL_SAL_ReferencesInit(&(newCtx->references));
     (void)memcpy_s(newCtx->sumCheck, SM3_MD_SIZE, ctx->sumCheck, SM3_MD_SIZE);
     (void)memcpy_s(newCtx->sumSend, SM3_MD_SIZE, ctx->sumSend, SM3_MD_SIZE);
+    (void)memcpy_s(newCtx->zDigest, SM3_MD_SIZE, ctx->zDigest, SM3_MD_SIZE);
 
     return newCtx;
 ERR:
@@ -126,7 +128,7 @@ void CRYPT_SM2_FreeCtx(CRYPT_SM2_Ctx *ctx)
     return;
 }
 
-int32_t Sm2ComputeZDigest(const CRYPT_SM2_Ctx *ctx, uint8_t *out, uint32_t *outLen)
+static int32_t Sm2CalcZDigest(const CRYPT_SM2_Ctx *ctx, uint8_t *out, uint32_t *outLen)
 {
     int32_t ret;
     if (ctx->userIdLen >= (UINT16_MAX / 8)) {
@@ -185,6 +187,33 @@ ERR:
     return ret;
 }
 
+int32_t Sm2ComputeZDigest(const CRYPT_SM2_Ctx *ctx, uint8_t *out, uint32_t *outLen)
+{
+    if (ctx->isZValid == 1 && *outLen >= SM3_MD_SIZE) {
+        (void)memcpy_s(out, *outLen, ctx->zDigest, SM3_MD_SIZE);
+        *outLen = SM3_MD_SIZE;
+        return CRYPT_SUCCESS;
+    }
+    // No public key was set, it is derived from the private key when signing.
+    return Sm2CalcZDigest(ctx, out, outLen);
+}
+
+// Recompute the Z digest after the public key or user ID is changed.
+static int32_t Sm2UpdateZDigest(CRYPT_SM2_Ctx *ctx)
+{
+    ctx->isZValid = 0;
+    if (ctx->pkey->pubkey == NULL) {
+        return CRYPT_SUCCESS;
+    }
+    uint32_t len = SM3_MD_SIZE;
+    int32_t ret = Sm2CalcZDigest(ctx, ctx->zDigest, &len);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    ctx->isZValid = 1;
+    return CRYPT_SUCCESS;
+}
+
 #ifdef HITLS_CRYPTO_SM2_SIGN
 static int32_t Sm2ComputeMsgHash(const CRYPT_SM2_Ctx *ctx, const uint8_t *msg, uint32_t msgLen, BN_BigNum *e)
 {
@@ -233,7 +262,11 @@ int32_t CRYPT_SM2_SetPubKey(CRYPT_SM2_Ctx *ctx, const BSL_Param *para)
         BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
         return CRYPT_NULL_INPUT;
     }
-    return ECC_PkeySetPubKey(ctx->pkey, para);
+    int32_t ret = ECC_PkeySetPubKey(ctx->pkey, para);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    return Sm2UpdateZDigest(ctx);
 }
 
 int32_t CRYPT_SM2_GetPrvKey(const CRYPT_SM2_Ctx *ctx, BSL_Param *para)
@@ -263,7 +296,12 @@ int32_t CRYPT_SM2_Gen(CRYPT_SM2_Ctx *ctx)
         return CRYPT_NULL_INPUT;
     }
 
-    return ECC_PkeyGen(ctx->pkey);
+    ctx->isZValid = 0;
+    int32_t ret = ECC_PkeyGen(ctx->pkey);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    return Sm2UpdateZDigest(ctx);
 }
 
 #ifdef HITLS_CRYPTO_SM2_SIGN
@@ -769,7 +807,12 @@ static int32_t CtrlUserId(CRYPT_SM2_Ctx *ctx, const void *val, uint32_t len)
         return CRYPT_ECC_PKEY_ERR_CTRL_LEN;
     }
     BSL_SAL_FREE(ctx->userId);
-    return Sm2SetUserId(ctx, val, len);
+    ctx->isZValid = 0;
+    int32_t ret = Sm2SetUserId(ctx, val, len);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    return Sm2UpdateZDigest(ctx);
 }
 
 static int32_t Sm2SetPKG(CRYPT_SM2_Ctx *ctx, const void *val, uint32_t len)
@@ -851,6 +894,12 @@ int32_t CRYPT_SM2_Ctrl(CRYPT_SM2_Ctx *ctx, int32_t opt, void *val, uint32_t len)
         case CRYPT_CTRL_UP_REFERENCES:
             ret = SM2UpReferences(ctx, val, len);
             break;
+        case CRYPT_CTRL_GEN_ECC_PUBLICKEY:
+            ret = ECC_PkeyCtrl(ctx->pkey, opt, val, len);
+            if (ret == CRYPT_SUCCESS) {
+                ret = Sm2UpdateZDigest(ctx);
+            }
+            break;
         default:
             ret = ECC_PkeyCtrl(ctx->pkey, opt, val, len);
             break;
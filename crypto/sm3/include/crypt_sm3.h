@@ -50,6 +50,14 @@ CRYPT_SM3_Ctx *CRYPT_SM3_NewCtx(void);
  */
 void CRYPT_SM3_FreeCtx(CRYPT_SM3_Ctx *ctx);
 
+/**
+ * @ingroup SM3
+ * @brief Size of the md context, used to place the context in memory provided by the caller.
+ *
+ * @retval Size of the context in bytes.
+ */
+uint32_t CRYPT_SM3_GetCtxSize(void);
+
 /**
  * @ingroup SM3
  * @brief This API is used to initialize the SM3 context.
@@ -112,6 +120,19 @@ int32_t CRYPT_SM3_CopyCtx(CRYPT_SM3_Ctx *dst, const CRYPT_SM3_Ctx *src);
  */
 CRYPT_SM3_Ctx *CRYPT_SM3_DupCtx(const CRYPT_SM3_Ctx *src);
 
+/**
+ * @ingroup SM3
+ * @brief GM/T 0003-2012 key derivation function: out = SM3(z || 1) || SM3(z || 2) || ..., truncated to outLen.
+ *        z is absorbed once, each counter block then costs one or two calls of the compression function.
+ * @param z [in]   Shared data.
+ * @param zLen [in]   Length of the shared data.
+ * @param out [out]   Derived key.
+ * @param outLen [in]   Length of the derived key.
+ * @retval #CRYPT_SUCCESS    Succeeded.
+ * @retval #CRYPT_NULL_INPUT    The pointer is NULL.
+ */
+int32_t CRYPT_SM3_Kdf(const uint8_t *z, uint32_t zLen, uint8_t *out, uint32_t outLen);
+
 #ifdef __cplusplus
 }
 #endif /* __cpluscplus */
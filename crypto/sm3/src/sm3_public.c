@@ -49,6 +49,11 @@ void CRYPT_SM3_FreeCtx(CRYPT_SM3_Ctx *ctx)
     BSL_SAL_ClearFree(ctx, sizeof(CRYPT_SM3_Ctx));
 }
 
+uint32_t CRYPT_SM3_GetCtxSize(void)
+{
+    return sizeof(CRYPT_SM3_Ctx);
+}
+
 int32_t CRYPT_SM3_Init(CRYPT_SM3_Ctx *ctx, BSL_Param *param)
 {
     if (ctx == NULL) {
@@ -238,4 +243,53 @@ CRYPT_SM3_Ctx *CRYPT_SM3_DupCtx(const CRYPT_SM3_Ctx *src)
     return newCtx;
 }
 
+int32_t CRYPT_SM3_Kdf(const uint8_t *z, uint32_t zLen, uint8_t *out, uint32_t outLen)
+{
+    if ((z == NULL && zLen != 0) || out == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    CRYPT_SM3_Ctx ctx;
+    (void)CRYPT_SM3_Init(&ctx, NULL);
+    int32_t ret = CRYPT_SM3_Update(&ctx, z, zLen);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_SAL_CleanseData(&ctx, sizeof(ctx));
+        return ret;
+    }
+    /* The tail holds the bytes of z left in the context, the counter, the padding and the length in bits. */
+    uint8_t tail[CRYPT_SM3_BLOCKSIZE * 2] = {0};
+    uint32_t num = ctx.num;
+    uint32_t tailLen = (num + sizeof(uint32_t) + 1 + 8 <= CRYPT_SM3_BLOCKSIZE) ? CRYPT_SM3_BLOCKSIZE : sizeof(tail);
+    uint64_t bits = ((uint64_t)zLen + sizeof(uint32_t)) << SHIFTS_PER_BYTE;
+    (void)memcpy_s(tail, sizeof(tail), ctx.block, num);
+    tail[num + sizeof(uint32_t)] = 0x80;
+    PUT_UINT32_BE((uint32_t)(bits >> 32), tail, tailLen - 8);
+    PUT_UINT32_BE((uint32_t)bits, tail, tailLen - 4);
+
+    uint32_t state[CRYPT_SM3_DIGESTSIZE / sizeof(uint32_t)];
+    uint8_t dgst[CRYPT_SM3_DIGESTSIZE];
+    uint8_t *tmp = out;
+    uint32_t left = outLen;
+    for (uint32_t counter = 1; left > 0; counter++) {
+        PUT_UINT32_BE(counter, tail, num);
+        (void)memcpy_s(state, sizeof(state), ctx.h, sizeof(ctx.h));
+        SM3_Compress(state, tail, tailLen / CRYPT_SM3_BLOCKSIZE);
+        uint8_t *dst = (left >= CRYPT_SM3_DIGESTSIZE) ? tmp : dgst;
+        for (uint32_t i = 0; i < CRYPT_SM3_DIGESTSIZE / sizeof(uint32_t); i++) {
+            PUT_UINT32_BE(state[i], dst, i * sizeof(uint32_t));
+        }
+        uint32_t cpyLen = (left >= CRYPT_SM3_DIGESTSIZE) ? CRYPT_SM3_DIGESTSIZE : left;
+        if (dst == dgst) {
+            (void)memcpy_s(tmp, left, dgst, cpyLen);
+        }
+        tmp += cpyLen;
+        left -= cpyLen;
+    }
+    BSL_SAL_CleanseData(&ctx, sizeof(ctx));
+    BSL_SAL_CleanseData(tail, sizeof(tail));
+    BSL_SAL_CleanseData(state, sizeof(state));
+    BSL_SAL_CleanseData(dgst, sizeof(dgst));
+    return CRYPT_SUCCESS;
+}
+
 #endif /* HITLS_CRYPTO_SM3 */
@@ -237,7 +237,7 @@ int32_t CRYPT_SM4_CBC_Encrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *ou
 int32_t CRYPT_SM4_CBC_Decrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *out, uint32_t len, uint8_t *iv);
 #endif
 
-#if defined(HITLS_CRYPTO_CTR) || defined(HITLS_CRYPTO_GCM)
+#if defined(HITLS_CRYPTO_CTR) || defined(HITLS_CRYPTO_GCM) || defined(HITLS_CRYPTO_CCM)
 /**
  * @brief SM4 CTR mode encryption (optimized).
  * @param ctx [IN] sm4 Context
@@ -265,6 +265,40 @@ int32_t CRYPT_SM4_CTR_Encrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *ou
 int32_t CRYPT_SM4_CTR_Decrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *out, uint32_t len, uint8_t *iv);
 #endif
 
+#if defined(HITLS_CRYPTO_GCM) && defined(HITLS_CRYPTO_SM4_X8664)
+/**
+ * @brief SM4 GCM encryption, CTR encryption and GHASH of the ciphertext are done in a single pass.
+ *        Only whole groups of 16 blocks are processed, the remaining blocks are left to the caller.
+ * @param ctx [IN] sm4 Context
+ * @param in [IN] Data to be encrypted
+ * @param out [OUT] Encrypted data
+ * @param blocks [IN] Number of 16-byte blocks
+ * @param iv [IN/OUT] Counter block, updated
+ * @param ghash [IN/OUT] GHASH state, updated
+ * @param hTable [IN] GHASH key table generated by GcmTableGen4bit
+ *
+ * @return Number of blocks processed
+ */
+uint32_t CRYPT_SM4_GCM_Encrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *out, uint32_t blocks, uint8_t *iv,
+    uint8_t *ghash, const void *hTable);
+
+/**
+ * @brief SM4 GCM decryption, GHASH of the ciphertext and CTR decryption are done in a single pass.
+ *        Only whole groups of 16 blocks are processed, the remaining blocks are left to the caller.
+ * @param ctx [IN] sm4 Context
+ * @param in [IN] Data to be decrypted
+ * @param out [OUT] Decrypted data
+ * @param blocks [IN] Number of 16-byte blocks
+ * @param iv [IN/OUT] Counter block, updated
+ * @param ghash [IN/OUT] GHASH state, updated
+ * @param hTable [IN] GHASH key table generated by GcmTableGen4bit
+ *
+ * @return Number of blocks processed
+ */
+uint32_t CRYPT_SM4_GCM_Decrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *out, uint32_t blocks, uint8_t *iv,
+    uint8_t *ghash, const void *hTable);
+#endif
+
 #ifdef HITLS_CRYPTO_OFB
 /**
  * @brief SM4 OFB mode encryption (optimized).
@@ -207,7 +207,7 @@ int32_t CRYPT_SM4_CFB_Decrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *ou
     return CRYPT_SUCCESS;
 }
 #endif
-#if defined(HITLS_CRYPTO_CTR) || defined(HITLS_CRYPTO_GCM)
+#if defined(HITLS_CRYPTO_CTR) || defined(HITLS_CRYPTO_GCM) || defined(HITLS_CRYPTO_CCM)
 int32_t CRYPT_SM4_CTR_Encrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *out, uint32_t len, uint8_t *iv)
 {
     Vpsm4Ctr32EncryptBlocks(in, out, len, ctx->rk, iv);
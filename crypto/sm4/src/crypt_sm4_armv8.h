@@ -52,7 +52,7 @@ void Vpsm4EcbEncrypt(const uint8_t *in, uint8_t *out, uint64_t len, const uint32
 void Vpsm4Cfb128Encrypt(const uint8_t *in, uint8_t *out, uint64_t len, const uint32_t *key, uint8_t *iv, int *num);
 void Vpsm4Cfb128Decrypt(const uint8_t *in, uint8_t *out, uint64_t len, const uint32_t *key, uint8_t *iv, int *num);
 #endif
-#if defined(HITLS_CRYPTO_CTR) || defined(HITLS_CRYPTO_GCM)
+#if defined(HITLS_CRYPTO_CTR) || defined(HITLS_CRYPTO_GCM) || defined(HITLS_CRYPTO_CCM)
 void Vpsm4Ctr32EncryptBlocks(const uint8_t *in, uint8_t *out, uint64_t blocks, const uint32_t *key, uint8_t *iv);
 #endif
 
@@ -29,6 +29,7 @@
 #define LAST_BLOCK_HEAD 240
 #define BYTE_MOST_SIG 128
 #define BYTE 8
+#define SM4_GCM_PASS_BLOCKS 16 // blocks ciphered and hashed per pass of the fused GCM kernel
 
 void SM4_XTS_Calculate_Tweak(unsigned char *t, const unsigned int idx)
 {
@@ -458,7 +459,7 @@ int32_t CRYPT_SM4_CFB_Decrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *ou
 }
 #endif
 
-#if defined(HITLS_CRYPTO_CTR) || defined(HITLS_CRYPTO_GCM)
+#if defined(HITLS_CRYPTO_CTR) || defined(HITLS_CRYPTO_GCM) || defined(HITLS_CRYPTO_CCM)
 int32_t CRYPT_SM4_CTR_Encrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *out, uint32_t len, uint8_t *iv)
 {
     if (ctx == NULL) {
@@ -480,4 +481,22 @@ int32_t CRYPT_SM4_CTR_Decrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *ou
 }
 #endif
 
+#ifdef HITLS_CRYPTO_GCM
+uint32_t CRYPT_SM4_GCM_Encrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *out, uint32_t blocks, uint8_t *iv,
+    uint8_t *ghash, const void *hTable)
+{
+    uint32_t done = blocks & ~(uint32_t)(SM4_GCM_PASS_BLOCKS - 1);
+    SM4_GCM_EncryptBlocks(in, out, done, ctx->rk, iv, ghash, hTable);
+    return done;
+}
+
+uint32_t CRYPT_SM4_GCM_Decrypt(CRYPT_SM4_Ctx *ctx, const uint8_t *in, uint8_t *out, uint32_t blocks, uint8_t *iv,
+    uint8_t *ghash, const void *hTable)
+{
+    uint32_t done = blocks & ~(uint32_t)(SM4_GCM_PASS_BLOCKS - 1);
+    SM4_GCM_DecryptBlocks(in, out, done, ctx->rk, iv, ghash, hTable);
+    return done;
+}
+#endif
+
 #endif /* HITLS_CRYPTO_SM4 */
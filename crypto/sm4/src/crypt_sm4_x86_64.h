@@ -49,5 +49,13 @@ void SM4_CFB128_Encrypt(const uint8_t *in, uint8_t *out, uint64_t len, const uin
 void SM4_CFB128_Decrypt(const uint8_t *in, uint8_t *out, uint64_t len, const uint32_t *key, uint8_t *iv, int *num);
 void SM4_CTR_EncryptBlocks(const uint8_t *in, uint8_t *out, uint64_t blocks, const uint32_t *key, const uint8_t *iv);
 
+#ifdef HITLS_CRYPTO_GCM
+// SM4 GCM: CTR encryption and GHASH in one pass, whole groups of 16 blocks only
+void SM4_GCM_EncryptBlocks(const uint8_t *in, uint8_t *out, uint64_t blocks, const uint32_t *key, uint8_t *iv,
+    uint8_t *ghash, const void *hTable);
+void SM4_GCM_DecryptBlocks(const uint8_t *in, uint8_t *out, uint64_t blocks, const uint32_t *key, uint8_t *iv,
+    uint8_t *ghash, const void *hTable);
+#endif
+
 #endif /* HITLS_CRYPTO_SM4 */
 #endif
\ No newline at end of file
@@ -105,6 +105,7 @@ enum BSL_ERROR {
     BSL_UIO_WRITE_NOT_ALLOWED,
     BSL_UIO_MEM_GROW_FAIL,
     BSL_UIO_MEM_NOT_NULL,
+    BSL_UIO_KTLS_NOT_SUPPORT,               /**< The kernel TLS offload is not available. */
 
     /* The return value of the LIST submodule starts from 0x03070001. */
     BSL_LIST_INVALID_LIST_CURRENT = 0x03060001, /**< Current node pointer is NULL */
@@ -63,6 +63,8 @@ typedef enum {
     BSL_CID_AES128_CCM,
     BSL_CID_AES192_CCM,
     BSL_CID_AES256_CCM,
+    BSL_CID_AES128_XTS,             /**< Identifies the AES128 algorithm in XTS mode */
+    BSL_CID_AES256_XTS,             /**< Identifies the AES256 algorithm in XTS mode */
 
     // sm4
     BSL_CID_SM4_XTS = 116,
@@ -72,6 +74,7 @@ typedef enum {
     BSL_CID_SM4_CFB,
     BSL_CID_SM4_OFB,
     BSL_CID_SM4_ECB,
+    BSL_CID_SM4_CCM,
 
     /* asymmetrical algorithm */
     BSL_CID_RSA = 5001,              /**< identifies the RSA algorithm */
@@ -262,6 +265,9 @@ typedef enum {
     BSL_CID_FRIENDLYNAME = 130801,
     BSL_CID_LOCALKEYID,
     BSL_CID_X509CERTIFICATE,
+    BSL_CID_CONTENTTYPE,
+    BSL_CID_MESSAGEDIGEST,
+    BSL_CID_SIGNINGTIME,
 
     /* rfc7292 */
     BSL_CID_KEYBAG = 130901, // kind of safeBag.
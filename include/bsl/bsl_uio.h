@@ -115,8 +115,51 @@ typedef enum {
     BSL_UIO_MEM_SET_EOF,
     BSL_UIO_MEM_GET_EOF,
     BSL_UIO_MEM_GET_INFO,
+
+    /* TCP kernel TLS offload uses 0x5XX */
+    BSL_UIO_TCP_KTLS_ENABLE_TX = 0x500,
+    BSL_UIO_TCP_KTLS_ENABLE_RX,
+    BSL_UIO_TCP_KTLS_SET_RECORD_TYPE,
+    BSL_UIO_TCP_KTLS_GET_RECORD_TYPE,
+    BSL_UIO_TCP_KTLS_SENDFILE,
 } BSL_UIO_CtrlParameter;
 
+/**
+ * @ingroup bsl_uio
+ * @brief   Record protection algorithms that can be offloaded to the kernel TLS module.
+ */
+typedef enum {
+    BSL_UIO_KTLS_AES_128_GCM,
+    BSL_UIO_KTLS_AES_256_GCM,
+    BSL_UIO_KTLS_CHACHA20_POLY1305,
+} BSL_UIO_KtlsCipher;
+
+/**
+ * @ingroup bsl_uio
+ * @brief   Traffic key material transferred by BSL_UIO_TCP_KTLS_ENABLE_TX/BSL_UIO_TCP_KTLS_ENABLE_RX.
+ *          For TLS1.2 AES-GCM, iv is the 4-byte implicit salt. Otherwise iv is the 12-byte static IV.
+ */
+typedef struct {
+    uint16_t version;           /* Negotiated protocol version, TLS1.2 or TLS1.3 */
+    uint8_t cipher;             /* BSL_UIO_KtlsCipher */
+    uint8_t keyLen;
+    uint8_t ivLen;
+    const uint8_t *key;
+    const uint8_t *iv;
+    uint64_t seq;               /* Sequence number of the next record */
+} BSL_UIO_KtlsCryptoInfo;
+
+/**
+ * @ingroup bsl_uio
+ * @brief   Parameter of BSL_UIO_TCP_KTLS_SENDFILE.
+ */
+typedef struct {
+    int32_t fd;                 /* File descriptor of the content to be sent */
+    int64_t offset;             /* Offset in the file */
+    uint32_t len;               /* Number of bytes to be sent */
+    uint32_t sentLen;           /* OUT: number of bytes actually sent */
+} BSL_UIO_KtlsSendFileParam;
+
 #define BSL_UIO_FILE_READ             0x02
 #define BSL_UIO_FILE_WRITE            0x04
 #define BSL_UIO_FILE_APPEND           0x08
@@ -332,6 +375,30 @@ int32_t BSL_UIO_Read(BSL_UIO *uio, void *data, uint32_t len, uint32_t *readLen);
  * @param cmd [IN] BSL_UIO_SCTP_SET_APP_STREAM_ID
  * @param larg [IN] App stream ID. The value ranges from 0 to 65535
  * @param parg [IN] NULL
+ *
+ * @brief Hand the record protection of one direction of a TCP UIO over to the kernel TLS module.
+ *
+ * After success, data written to (read from) the UIO is plaintext and the kernel encrypts (decrypts) the records.
+ * BSL_UIO_KTLS_NOT_SUPPORT is returned if the tls ULP or the algorithm is unavailable, the UIO is then unchanged.
+ *
+ * @param uio [IN] UIO object
+ * @param cmd [IN] BSL_UIO_TCP_KTLS_ENABLE_TX or BSL_UIO_TCP_KTLS_ENABLE_RX
+ * @param larg [IN] sizeof(BSL_UIO_KtlsCryptoInfo)
+ * @param parg [IN] BSL_UIO_KtlsCryptoInfo *
+ *
+ * @brief Set the record type of subsequent writes, or obtain the record type of the last read, on a kTLS UIO.
+ *
+ * @param uio [IN] UIO object
+ * @param cmd [IN] BSL_UIO_TCP_KTLS_SET_RECORD_TYPE or BSL_UIO_TCP_KTLS_GET_RECORD_TYPE
+ * @param larg [IN] sizeof(uint8_t)
+ * @param parg [IN/OUT] uint8_t *
+ *
+ * @brief Send file content as application data records without copying it to user space.
+ *
+ * @param uio [IN] UIO object whose transmit direction is offloaded
+ * @param cmd [IN] BSL_UIO_TCP_KTLS_SENDFILE
+ * @param larg [IN] sizeof(BSL_UIO_KtlsSendFileParam)
+ * @param parg [IN/OUT] BSL_UIO_KtlsSendFileParam *
  */
 int32_t BSL_UIO_Ctrl(BSL_UIO *uio, int32_t cmd, int32_t larg, void *parg);
 
@@ -145,6 +145,9 @@ typedef enum {
     CRYPT_CIPHER_AES192_GCM = BSL_CID_AES192_GCM,
     CRYPT_CIPHER_AES256_GCM = BSL_CID_AES256_GCM,
 
+    CRYPT_CIPHER_AES128_XTS = BSL_CID_AES128_XTS,
+    CRYPT_CIPHER_AES256_XTS = BSL_CID_AES256_XTS,
+
     CRYPT_CIPHER_CHACHA20_POLY1305 = BSL_CID_CHACHA20_POLY1305,
 
     CRYPT_CIPHER_SM4_XTS = BSL_CID_SM4_XTS,
@@ -154,6 +157,7 @@ typedef enum {
     CRYPT_CIPHER_SM4_GCM = BSL_CID_SM4_GCM,
     CRYPT_CIPHER_SM4_CFB = BSL_CID_SM4_CFB,
     CRYPT_CIPHER_SM4_OFB = BSL_CID_SM4_OFB,
+    CRYPT_CIPHER_SM4_CCM = BSL_CID_SM4_CCM,
 
     CRYPT_CIPHER_AES128_CFB = BSL_CID_AES128_CFB,
     CRYPT_CIPHER_AES192_CFB = BSL_CID_AES192_CFB,
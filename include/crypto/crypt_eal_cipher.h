@@ -131,7 +131,7 @@ int32_t CRYPT_EAL_CipherReinit(CRYPT_EAL_CipherCtx *ctx, const uint8_t *iv, uint
  *
  * Continuously enter encrypted and decrypted data.
  * CRYPT_EAL_CipherUpdate should be used in conjunction with CRYPT_EAL_CipherFinal, after one or more calls to
- * CRYPT_EAL_CipherUpdate, Call CRYPT_EAL_CipherFinal. With the exception of SM4_XTS mode, multiple calls to
+ * CRYPT_EAL_CipherUpdate, Call CRYPT_EAL_CipherFinal. With the exception of XTS mode, multiple calls to
  * CRYPT_EAL_CipherUpdate and CRYPT_EAL_CipherFinal are not supported.
  *
  * @attention If the function is called by an external user and the error stack is concerned, it is recommended
@@ -160,8 +160,9 @@ int32_t CRYPT_EAL_CipherReinit(CRYPT_EAL_CipherCtx *ctx, const uint8_t *iv, uint
  * plus the buffer is less than 32 blocks, the output is 0.
  *     1. When data is input for the first time, outLen = (inLen / 16 - 2) * 16.
  *     2. Enter the encrypted data for multiple times. At this time, outLen = ((inLen + cache) / 16 - 2) * 16.
- *     In SM4_XTS mode, after calling CRYPT_EAL_CipherUpdate, you need to use CRYPT_EAL_CipherInit or
- * CRYPT_EAL_CipherReinit to reset the key or iv.
+ *     In XTS mode, after calling CRYPT_EAL_CipherUpdate, you need to use CRYPT_EAL_CipherInit or
+ * CRYPT_EAL_CipherReinit to reset the key or iv. If a data unit length is set by CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN,
+ * inLen must be a multiple of it, each data unit uses the next sequence number and the updates can be continued.
  * @retval  #CRYPT_SUCCESS, success.
  *          Other error codes see the crypt_errno.h.
  */
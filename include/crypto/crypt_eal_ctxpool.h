@@ -0,0 +1,140 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+/**
+ * @defgroup crypt_eal_ctxpool
+ * @ingroup crypt
+ * @brief pool of reusable md, mac and cipher contexts of crypto module
+ */
+
+#ifndef CRYPT_EAL_CTXPOOL_H
+#define CRYPT_EAL_CTXPOOL_H
+
+#include <stdint.h>
+#include "crypt_algid.h"
+#include "crypt_eal_provider.h"
+#include "crypt_eal_md.h"
+#include "crypt_eal_mac.h"
+#include "crypt_eal_cipher.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @ingroup crypt_eal_ctxpool
+ *
+ * Pool of idle contexts. A context that is put back is deinitialized and handed out again by the next get of the
+ * same algorithm, which saves the allocation and the provider lookup of a new context.
+ * The pool is not thread safe, use one pool per thread or per connection.
+ */
+typedef struct EAL_CtxPool CRYPT_EAL_CtxPool;
+
+/**
+ * @ingroup crypt_eal_ctxpool
+ * @brief   Create a context pool.
+ *
+ * @param   libCtx [IN] Library context of the new contexts, if NULL, use the default one
+ * @param   attrName [IN] Attribute of the new contexts, can be NULL
+ * @param   maxNum [IN] Maximum number of idle contexts kept by the pool, 0 is not allowed
+ *
+ * @retval  CRYPT_EAL_CtxPool pointer.
+ *          NULL, if the operation fails.
+ */
+CRYPT_EAL_CtxPool *CRYPT_EAL_CtxPoolNew(CRYPT_EAL_LibCtx *libCtx, const char *attrName, uint32_t maxNum);
+
+/**
+ * @ingroup crypt_eal_ctxpool
+ * @brief   Release the pool and the idle contexts. The contexts that are not put back are not affected.
+ *
+ * @param   pool [IN] Context pool, set NULL by caller.
+ */
+void CRYPT_EAL_CtxPoolFree(CRYPT_EAL_CtxPool *pool);
+
+/**
+ * @ingroup crypt_eal_ctxpool
+ * @brief   Get a MD context from the pool, a new one is created if there is no idle context of the algorithm.
+ *
+ * The context is in the same state as the one returned by CRYPT_EAL_MdNewCtx, call CRYPT_EAL_MdInit before use.
+ *
+ * @param   pool [IN] Context pool
+ * @param   id [IN] Algorithm ID
+ *
+ * @retval  CRYPT_EAL_MdCTX pointer.
+ *          NULL, if the operation fails.
+ */
+CRYPT_EAL_MdCTX *CRYPT_EAL_CtxPoolGetMd(CRYPT_EAL_CtxPool *pool, CRYPT_MD_AlgId id);
+
+/**
+ * @ingroup crypt_eal_ctxpool
+ * @brief   Put a MD context back to the pool, the context is freed if the pool is full.
+ *
+ * @param   pool [IN] Context pool
+ * @param   ctx [IN] MD context, which must not be used by the caller after this call
+ */
+void CRYPT_EAL_CtxPoolPutMd(CRYPT_EAL_CtxPool *pool, CRYPT_EAL_MdCTX *ctx);
+
+/**
+ * @ingroup crypt_eal_ctxpool
+ * @brief   Get a MAC context from the pool, a new one is created if there is no idle context of the algorithm.
+ *
+ * The key is wiped when the context is put back, call CRYPT_EAL_MacInit before use.
+ *
+ * @param   pool [IN] Context pool
+ * @param   id [IN] Algorithm ID
+ *
+ * @retval  CRYPT_EAL_MacCtx pointer.
+ *          NULL, if the operation fails.
+ */
+CRYPT_EAL_MacCtx *CRYPT_EAL_CtxPoolGetMac(CRYPT_EAL_CtxPool *pool, CRYPT_MAC_AlgId id);
+
+/**
+ * @ingroup crypt_eal_ctxpool
+ * @brief   Put a MAC context back to the pool, the context is freed if the pool is full.
+ *
+ * @param   pool [IN] Context pool
+ * @param   ctx [IN] MAC context, which must not be used by the caller after this call
+ */
+void CRYPT_EAL_CtxPoolPutMac(CRYPT_EAL_CtxPool *pool, CRYPT_EAL_MacCtx *ctx);
+
+/**
+ * @ingroup crypt_eal_ctxpool
+ * @brief   Get a cipher context from the pool, a new one is created if there is no idle context of the algorithm.
+ *
+ * The key is wiped when the context is put back, call CRYPT_EAL_CipherInit before use. Settings made by
+ * CRYPT_EAL_CipherCtrl or CRYPT_EAL_CipherSetPadding may be kept, set them again after the get.
+ *
+ * @param   pool [IN] Context pool
+ * @param   id [IN] Algorithm ID
+ *
+ * @retval  CRYPT_EAL_CipherCtx pointer.
+ *          NULL, if the operation fails.
+ */
+CRYPT_EAL_CipherCtx *CRYPT_EAL_CtxPoolGetCipher(CRYPT_EAL_CtxPool *pool, CRYPT_CIPHER_AlgId id);
+
+/**
+ * @ingroup crypt_eal_ctxpool
+ * @brief   Put a cipher context back to the pool, the context is freed if the pool is full.
+ *
+ * @param   pool [IN] Context pool
+ * @param   ctx [IN] Cipher context, which must not be used by the caller after this call
+ */
+void CRYPT_EAL_CtxPoolPutCipher(CRYPT_EAL_CtxPool *pool, CRYPT_EAL_CipherCtx *ctx);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // CRYPT_EAL_CTXPOOL_H
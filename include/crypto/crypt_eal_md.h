@@ -46,6 +46,37 @@ typedef struct EAL_MdCtx CRYPT_EAL_MdCTX;
  */
 CRYPT_EAL_MdCTX *CRYPT_EAL_MdNewCtx(CRYPT_MD_AlgId id);
 
+/**
+ * @ingroup crypt_eal_md
+ *
+ * Size of the caller provided memory that holds a MD context, see CRYPT_EAL_MdInitCtxIn.
+ */
+#define CRYPT_EAL_MD_CTX_BUF_SIZE 640
+
+/**
+ * @ingroup crypt_eal_md
+ *
+ * Caller provided memory for a MD context, for example on the stack. The content is opaque.
+ */
+typedef struct {
+    uint64_t buf[CRYPT_EAL_MD_CTX_BUF_SIZE / sizeof(uint64_t)];
+} CRYPT_EAL_MdCtxBuf;
+
+/**
+ * @ingroup crypt_eal_md
+ * @brief   Create and initialize a MD context in the memory provided by the caller, without any allocation.
+ *
+ * Only the default implementation of the algorithms is supported. The context is ready for CRYPT_EAL_MdUpdate.
+ * CRYPT_EAL_MdFreeCtx wipes the buffer and does not release it. The context can not be the destination of
+ * CRYPT_EAL_MdCopyCtx, and it is valid as long as the buffer is.
+ *
+ * @param   buf [OUT] Memory that holds the context
+ * @param   id [IN] Algorithm ID
+ * @retval  CRYPT_EAL_MdCTX, MD context pointer, which points into buf.
+ *          NULL, if the operation fails.
+ */
+CRYPT_EAL_MdCTX *CRYPT_EAL_MdInitCtxIn(CRYPT_EAL_MdCtxBuf *buf, CRYPT_MD_AlgId id);
+
 /**
  * @ingroup crypt_eal_md
  * @brief   Create a md context in the providers.
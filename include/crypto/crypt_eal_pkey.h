@@ -213,6 +213,22 @@ int32_t CRYPT_EAL_PkeySetParaById(CRYPT_EAL_PkeyCtx *pkey, CRYPT_PKEY_ParaId id)
  */
 int32_t CRYPT_EAL_PkeyGen(CRYPT_EAL_PkeyCtx *pkey);
 
+/**
+ * @ingroup crypt_eal_pkey
+ * @brief   Generate the key data of num key sessions.
+ *
+ * X25519 key pairs are generated together, eight public keys at a time on CPUs with AVX-512 IFMA. The key
+ * sessions of other algorithms are generated by CRYPT_EAL_PkeyGen. Every session is processed even if an
+ * earlier one fails.
+ *
+ * @param   pkeys [IN/OUT] num key pair structures for receiving key data.
+ * @param   num   [IN] Number of key sessions
+ *
+ * @retval  #CRYPT_SUCCESS, all key pairs are generated.
+ *          Otherwise the error code of the first failed session, for other error codes, see crypt_errno.h.
+ */
+int32_t CRYPT_EAL_PkeyGenBatch(CRYPT_EAL_PkeyCtx *const *pkeys, uint32_t num);
+
 /**
  * @ingroup crypt_eal_pkey
  * @brief   Set the public key. The caller applies for and releases memory for the public key marked as "key".
@@ -297,6 +313,40 @@ int32_t CRYPT_EAL_PkeySign(const CRYPT_EAL_PkeyCtx *pkey, CRYPT_MD_AlgId id, con
 int32_t CRYPT_EAL_PkeyVerify(const CRYPT_EAL_PkeyCtx *pkey, CRYPT_MD_AlgId id, const uint8_t *data,
     uint32_t dataLen, const uint8_t *sign, uint32_t signLen);
 
+/**
+ * @ingroup crypt_eal_pkey
+ *
+ * One signature of a batch verification.
+ */
+typedef struct {
+    const CRYPT_EAL_PkeyCtx *pkey; /**< Key session with the public key */
+    const uint8_t *data;           /**< Plaintext data */
+    uint32_t dataLen;              /**< Plaintext length */
+    const uint8_t *sign;           /**< Signature data */
+    uint32_t signLen;              /**< Length of the signature data */
+} CRYPT_EAL_PkeyVerifyItem;
+
+/**
+ * @ingroup crypt_eal_pkey
+ * @brief   Batch signature verification interface
+ *
+ * Ed25519 signatures are checked together by one random linear combination and the failed signatures are found
+ * by verifying a failed batch one by one. A batch passes on the cofactored equation, so an Ed25519 signature that
+ * only differs by a small order component is accepted here but rejected by CRYPT_EAL_PkeyVerify, honest signers
+ * never produce such signatures. The RSA public key operations reuse the Montgomery contexts of the keys and run
+ * eight signatures at once with AVX-512 IFMA. Other algorithms are verified by CRYPT_EAL_PkeyVerify.
+ *
+ * @param   items     [IN] Key sessions, plaintexts and signatures
+ * @param   num       [IN] Number of items
+ * @param   id        [IN] Hash algorithm ID.
+ * @param   results   [OUT] Result of each item as returned by CRYPT_EAL_PkeyVerify, num elements, can be NULL
+ *
+ * @retval  #CRYPT_SUCCESS, all signatures are verified successfully.
+ *          Otherwise the error code of the first failed item, for other error codes, see crypt_errno.h.
+ */
+int32_t CRYPT_EAL_PkeyBatchVerify(const CRYPT_EAL_PkeyVerifyItem *items, uint32_t num, CRYPT_MD_AlgId id,
+    int32_t *results);
+
 /**
  * @ingroup crypt_eal_pkey
  * @brief   Sign hash data
@@ -302,6 +302,8 @@ enum CRYPT_ERROR {
     CRYPT_ECC_KEY_PUBKEY_NOT_EQUAL,                   /**< ECC public keys are not equal. */
 
     CRYPT_SHA3_OUT_BUFF_LEN_NOT_ENOUGH = 0x01140001,  /**< Insufficient buffer length for storing output results. */
+    CRYPT_SHA3_ERR_STATE,                             /**< The context is not initialized, or data is absorbed
+                                                           after the output has been squeezed. */
 
     CRYPT_ECDH_ERR_EMPTY_KEY = 0x01150001,            /**< Key is null. */
     CRYPT_ECDH_ERR_INVALID_COFACTOR,                  /**< Invalid cofactor value. */
@@ -78,6 +78,7 @@ typedef struct {
 
 typedef enum {
     CRYPT_RSA_BLINDING = 0x00000001,            /**< Enable the RSA blinding function for signature. */
+    CRYPT_RSA_PARALLEL_KEYGEN = 0x00000002,     /**< Search for p and q on two threads during key generation. */
     CRYPT_RSA_MAXFLAG
 } CRYPT_RSA_Flag;
 
@@ -141,6 +142,10 @@ typedef struct {
     uint32_t lambdaLen; /**< Length of the Paillier private key parameter marked as lambda */
     uint32_t muLen; /**< Length of the Paillier private key parameter marked as mu */
     uint32_t n2Len; /**< Length of the Paillier private key parameter marked as n2 */
+    uint8_t *p;      /**< Paillier private key prime factor p, optional, enables the CRT decryption */
+    uint8_t *q;      /**< Paillier private key prime factor q, optional, enables the CRT decryption */
+    uint32_t pLen;   /**< Length of the Paillier private key prime factor p */
+    uint32_t qLen;   /**< Length of the Paillier private key prime factor q */
 } CRYPT_PaillierPrv;
 
 /**
@@ -319,6 +324,22 @@ typedef struct {
     uint32_t bits; /**< Bits of para. */
 } CRYPT_PaillierPara;
 
+/**
+ * @ingroup crypt_types
+ *
+ * Vector operation of the Paillier algorithm, element i reads in[i] and operand[i] and writes out[i].
+ * The output ciphertexts are 2 * ceil(bits(n) / 8) bytes, padded with leading zeros.
+ */
+typedef struct {
+    const uint8_t *const *in;      /**< Plaintexts to encrypt, or ciphertexts to add to or to multiply */
+    const uint32_t *inLen;         /**< Lengths of in */
+    const uint8_t *const *operand; /**< Ciphertexts added to in or scalars multiplying in, unused by the encryption */
+    const uint32_t *operandLen;    /**< Lengths of operand */
+    uint8_t *const *out;           /**< Output ciphertexts, out[i] may be equal to in[i] or operand[i] */
+    uint32_t *outLen;              /**< IN: sizes of the out buffers, OUT: lengths of the ciphertexts */
+    uint32_t num;                  /**< Number of elements */
+} CRYPT_PaillierBatch;
+
 /**
  * @ingroup crypt_types
  *
@@ -410,6 +431,10 @@ typedef enum {
     CRYPT_CTRL_SET_PADDING,       /**< Set the padding mode of the algorithm. */
     CRYPT_CTRL_GET_PADDING,       /**< Obtain the padding mode of thealgorithm. */
     CRYPT_CTRL_REINIT_STATUS,     /**< Reinitialize the status of the algorithm. */
+    CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN, /**< Set the data unit length in XTS mode, the data type is uint32_t.
+                                       The input of an update is then split into data units of this length,
+                                       the iv being the little-endian sequence number of the first one, as in
+                                       IEEE 1619. 0 (the default) treats the whole input as one data unit. */
     CRYPT_CTRL_MAX
 } CRYPT_CipherCtrl;
 
@@ -469,6 +494,27 @@ typedef enum {
     CRYPT_CTRL_SM2_DO_CHECK,            /* SM2 check the shared key. */
     CRYPT_CTRL_SM2_GENE_R,              /* SM2 obtain the R value. */
     CRYPT_CTRL_GEN_ECC_PUBLICKEY,       /**< Use prikey generate pubkey. */
+
+    // dh, dsa
+    CRYPT_CTRL_SET_FIXED_BASE_TABLE = 400, /**< DH and DSA precompute a fixed-base table of the generator g for the
+                                             key generation and signature, no input data. The table is kept with
+                                             the parameters and shared by the contexts duplicated from this one. */
+    CRYPT_CTRL_SET_DH_PRVKEY_BITS,      /**< DH set the bits of the generated private key, the data type is uint32_t.
+                                             Only for the named safe-prime groups, 0 restores the full range. */
+
+    // paillier
+    CRYPT_CTRL_GEN_PAILLIER_RAND_POOL = 500, /**< Paillier precompute randomizers r^n mod n^2 of the public key, the
+                                             data type is uint32_t, the number to add to the pool. The encryption
+                                             takes one from the pool while there are any, each is used only once
+                                             and the pool is not copied by the duplication. */
+    CRYPT_CTRL_GET_PAILLIER_RAND_POOL_SIZE, /**< Paillier get the number of randomizers left, the data type is
+                                             uint32_t. */
+    CRYPT_CTRL_PAILLIER_ENCRYPT_BATCH,  /**< Paillier encrypt a vector of plaintexts, the data type is
+                                             CRYPT_PaillierBatch. */
+    CRYPT_CTRL_PAILLIER_ADD_BATCH,      /**< Paillier homomorphic addition of two vectors of ciphertexts, the data
+                                             type is CRYPT_PaillierBatch. */
+    CRYPT_CTRL_PAILLIER_MUL_BATCH,      /**< Paillier homomorphic multiplication of a vector of ciphertexts by
+                                             scalars lower than n, the data type is CRYPT_PaillierBatch. */
 } CRYPT_PkeyCtrl;
 
 /**
@@ -50,6 +50,8 @@ typedef struct _HITLS_PKCS12 HITLS_PKCS12;
 
 typedef struct _HITLS_PKCS12_Bag HITLS_PKCS12_Bag;
 
+typedef struct _HITLS_CMS_SignedData HITLS_CMS_SignedData;
+
 #define HITLS_CERT_VERSION_1 0
 #define HITLS_CERT_VERSION_2 1
 #define HITLS_CERT_VERSION_3 2
@@ -440,10 +442,13 @@ int32_t HITLS_X509_CertParseFile(int32_t format, const char *path, HITLS_X509_Ce
  * @par Description: Parse multiple CERTs in the file.
  *  If the encoding is successful, the memory for the certlist is requested from within the function,
  *  and the user needs to free it after using it.
- * @attention None
+ * @attention The names, public key and extensions of each CERT are decoded on first access, so an error in
+ *  them is reported by the interface that first uses them rather than by this function.
+ *  The parsed CERTs may be shared and read from several threads, the decoding on first access is serialized
+ *  internally and each part is decoded only once. Modifying a CERT through the set interfaces is not thread safe.
  * @param format  [IN] Encoding format: BSL_FORMAT_PEM/BSL_FORMAT_ASN1/BSL_FORMAT_UNKNOWN.
- * @param path    [IN] CRL file path.
- * @param crllist [OUT] CRL list after parse.
+ * @param path    [IN] CERT file path.
+ * @param certlist [OUT] CERT list after parse.
  * @return #HITLS_X509_SUCCESS, success.
  *         Error codes can be found in hitls_pki_errno.h
  */
@@ -746,6 +751,40 @@ void HITLS_X509_StoreCtxFree(HITLS_X509_StoreCtx *storeCtx);
  */
 int32_t HITLS_X509_StoreCtxCtrl(HITLS_X509_StoreCtx *storeCtx, int32_t cmd, void *val, int32_t valLen);
 
+/**
+ * @ingroup pki
+ * @brief Load the CA certificates of a bundle file into the StoreCtx.
+ * @par Description: The file is split at certificate boundaries and the certificates are parsed on up to
+ *  threadNum threads, then added to the StoreCtx in file order. Certificates already in the StoreCtx are skipped.
+ * @attention If any certificate is not a CA, nothing is added. The extra threads are only used when the
+ *  thread feature is enabled, 0 or 1 parse on the calling thread.
+ * @param storeCtx [IN] StoreCtx.
+ * @param format [IN] Encoding format: BSL_FORMAT_PEM/BSL_FORMAT_ASN1/BSL_FORMAT_UNKNOWN.
+ * @param path [IN] CERT file path.
+ * @param threadNum [IN] Maximum number of threads used for parsing, including the calling thread.
+ * @retval #HITLS_X509_SUCCESS, success.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_X509_StoreCtxLoadCaFile(HITLS_X509_StoreCtx *storeCtx, int32_t format, const char *path,
+    uint32_t threadNum);
+
+/**
+ * @ingroup pki
+ * @brief Load the CRLs of a file into the StoreCtx.
+ * @par Description: The file is split at CRL boundaries and the CRLs are parsed on up to threadNum threads,
+ *  then added to the StoreCtx in file order. CRLs already in the StoreCtx are skipped.
+ * @attention Each CRL is parsed by a single thread. The extra threads are only used when the thread feature
+ *  is enabled, 0 or 1 parse on the calling thread.
+ * @param storeCtx [IN] StoreCtx.
+ * @param format [IN] Encoding format: BSL_FORMAT_PEM/BSL_FORMAT_ASN1/BSL_FORMAT_UNKNOWN.
+ * @param path [IN] CRL file path.
+ * @param threadNum [IN] Maximum number of threads used for parsing, including the calling thread.
+ * @retval #HITLS_X509_SUCCESS, success.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_X509_StoreCtxLoadCrlFile(HITLS_X509_StoreCtx *storeCtx, int32_t format, const char *path,
+    uint32_t threadNum);
+
 /**
  * @ingroup pki
  * @brief Certificate chain verify function.
@@ -1025,6 +1064,26 @@ int32_t HITLS_PKCS12_Ctrl(HITLS_PKCS12 *p12, int32_t cmd, void *val, int32_t val
 int32_t HITLS_PKCS12_ParseBuff(int32_t format, BSL_Buffer *encode, const HITLS_PKCS12_PwdParam *pwdParam,
     HITLS_PKCS12 **p12, bool needMacVerify);
 
+/**
+ * @ingroup pkcs12
+ * @brief pkcs12 parse with several threads
+ * @par Description: Same as HITLS_PKCS12_ParseBuff, but the MAC verification and the decryption of each
+ *  contentInfo run as independent tasks on up to threadNum threads. The bags are then converted in file order,
+ *  so the result and the reported error are the same as those of HITLS_PKCS12_ParseBuff.
+ *
+ * @attention The extra threads are only used when the thread feature is enabled, 0 or 1 parse on the calling thread.
+ * @param format         [IN] Decoding format: BSL_FORMAT_ASN1/BSL_FORMAT_UNKNOWN.
+ * @param encode         [IN] encode data
+ * @param pwdParam       [IN] include MAC-pwd, enc-pwd, they can be different.
+ * @param p12            [OUT] the p12 struct.
+ * @param needMacVerify  [IN] true, need verify mac; false, skip mac check.
+ * @param threadNum      [IN] Maximum number of threads used for parsing, including the calling thread.
+ * @retval #HITLS_X509_SUCCESS, success.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_PKCS12_ParseBuffEx(int32_t format, BSL_Buffer *encode, const HITLS_PKCS12_PwdParam *pwdParam,
+    HITLS_PKCS12 **p12, bool needMacVerify, uint32_t threadNum);
+
 /**
  * @ingroup pkcs12
  * @par Description: parse p12 file, and set the p12 struct.
@@ -1074,6 +1133,114 @@ int32_t HITLS_PKCS12_GenBuff(int32_t format, HITLS_PKCS12 *p12, const HITLS_PKCS
 int32_t HITLS_PKCS12_GenFile(int32_t format, HITLS_PKCS12 *p12, const HITLS_PKCS12_EncodeParam *encodeParam,
     bool isNeedMac, const char *path);
 
+/**
+ * @ingroup cms
+ * @brief Allocate a detached CMS SignedData, used for signing or for verifying.
+ *
+ * @retval HITLS_CMS_SignedData *
+ */
+HITLS_CMS_SignedData *HITLS_CMS_SignedDataNew(void);
+
+/**
+ * @ingroup cms
+ * @brief Release a CMS SignedData.
+ *
+ * @param signedData [IN] The SignedData to be released.
+ */
+void HITLS_CMS_SignedDataFree(HITLS_CMS_SignedData *signedData);
+
+/**
+ * @ingroup cms
+ * @brief Add a signer to a SignedData which is going to be signed.
+ *
+ * @attention The signers can use different digest algorithms, the content is still read only once.
+ *            The certificate and the private key are referenced by the SignedData until it is released.
+ * @param signedData [IN] The SignedData.
+ * @param cert       [IN] The certificate of the signer, it is identified by its issuer and serial number.
+ * @param prvKey     [IN] The private key of the signer: RSA, ECDSA or SM2.
+ * @param mdId       [IN] The digest algorithm of the content and of the signature.
+ * @param algParam   [IN] The signature parameters, can be NULL.
+ * @retval #HITLS_X509_SUCCESS, success.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_CMS_SignedDataAddSigner(HITLS_CMS_SignedData *signedData, HITLS_X509_Cert *cert,
+    CRYPT_EAL_PkeyCtx *prvKey, uint32_t mdId, const HITLS_X509_SignAlgParam *algParam);
+
+/**
+ * @ingroup cms
+ * @brief Start signing, the digests of all signers are initialized.
+ *
+ * @param signedData [IN] The SignedData, with at least one signer.
+ * @retval #HITLS_X509_SUCCESS, success.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_CMS_SignedDataSignInit(HITLS_CMS_SignedData *signedData);
+
+/**
+ * @ingroup cms
+ * @brief Feed the next part of the content to be signed.
+ *
+ * @param signedData [IN] The SignedData.
+ * @param data       [IN] The next part of the content.
+ * @param dataLen    [IN] The length of data.
+ * @retval #HITLS_X509_SUCCESS, success.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_CMS_SignedDataSignUpdate(HITLS_CMS_SignedData *signedData, const uint8_t *data, uint32_t dataLen);
+
+/**
+ * @ingroup cms
+ * @brief Finish signing and encode the detached SignedData.
+ *
+ * @attention Each signer signs the contentType and messageDigest signed attributes, and the signingTime when the
+ *            system time is available. The signer certificates are carried by the SignedData.
+ * @param signedData [IN] The SignedData.
+ * @param encode     [OUT] The DER encoded ContentInfo, which is released by the caller.
+ * @retval #HITLS_X509_SUCCESS, success.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_CMS_SignedDataSignFinal(HITLS_CMS_SignedData *signedData, BSL_Buffer *encode);
+
+/**
+ * @ingroup cms
+ * @brief Parse a detached SignedData and start verifying, a digest is initialized for each digest algorithm used by
+ *        the signers.
+ *
+ * @attention Only the signers identified by issuer and serial number and with signed attributes are supported.
+ * @param signedData [IN] The SignedData, just allocated.
+ * @param encode     [IN] The DER encoded ContentInfo.
+ * @retval #HITLS_X509_SUCCESS, success.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_CMS_SignedDataVerifyInit(HITLS_CMS_SignedData *signedData, const BSL_Buffer *encode);
+
+/**
+ * @ingroup cms
+ * @brief Feed the next part of the detached content to be verified.
+ *
+ * @param signedData [IN] The SignedData.
+ * @param data       [IN] The next part of the content.
+ * @param dataLen    [IN] The length of data.
+ * @retval #HITLS_X509_SUCCESS, success.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_CMS_SignedDataVerifyUpdate(HITLS_CMS_SignedData *signedData, const uint8_t *data, uint32_t dataLen);
+
+/**
+ * @ingroup cms
+ * @brief Finish verifying: the messageDigest of every signer is compared with the digest of the content, and the
+ *        signature over the signed attributes is checked.
+ *
+ * @attention The signer certificates are looked up in certs if it is not NULL, in the certificates carried by the
+ *            SignedData otherwise. The latter are not trusted by themselves, their chain should be verified by the
+ *            caller.
+ * @param signedData [IN] The SignedData.
+ * @param certs      [IN] The trusted signer certificates, can be NULL.
+ * @retval #HITLS_X509_SUCCESS, all the signatures are valid.
+ *         Error codes can be found in hitls_pki_errno.h
+ */
+int32_t HITLS_CMS_SignedDataVerifyFinal(HITLS_CMS_SignedData *signedData, HITLS_X509_List *certs);
+
 #ifdef __cplusplus
 }
 #endif
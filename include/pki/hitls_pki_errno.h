@@ -123,6 +123,15 @@ typedef enum {
     HITLS_CMS_ERR_INVALID_DATA,
     HITLS_CMS_ERR_INVALID_ALGO,
     HITLS_CMS_ERR_PARSE_TYPE,
+    HITLS_CMS_ERR_INVALID_PARAM,
+    HITLS_CMS_ERR_STATE,
+    HITLS_CMS_ERR_NO_SIGNER,
+    HITLS_CMS_ERR_SIGNER_NOT_FOUND,
+    HITLS_CMS_ERR_UNSUPPORTED_SID,
+    HITLS_CMS_ERR_NO_SIGNED_ATTRS,
+    HITLS_CMS_ERR_ATTACHED_CONTENT,
+    HITLS_CMS_ERR_CONTENT_TYPE,
+    HITLS_CMS_ERR_DIGEST_MISMATCH,
 
     HITLS_PKCS12_ERR_NULL_POINTER = 0x04070001,
     HITLS_PKCS12_ERR_INVALID_PARAM,
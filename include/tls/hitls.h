@@ -1288,6 +1288,69 @@ int32_t HITLS_SetFlightTransmitSwitch(HITLS_Ctx *ctx, uint8_t isEnable);
  */
 int32_t HITLS_GetFlightTransmitSwitch(const HITLS_Ctx *ctx, uint8_t *isEnable);
 
+/**
+ * @ingroup hitls
+ * @brief   The transmit direction of the connection is protected by the kernel TLS module.
+ */
+#define HITLS_KTLS_TX 0x01u
+
+/**
+ * @ingroup hitls
+ * @brief   The receive direction of the connection is protected by the kernel TLS module.
+ */
+#define HITLS_KTLS_RX 0x02u
+
+/**
+ * @ingroup hitls
+ * @brief   Sets whether to offload the record protection to the kernel TLS module after the handshake.
+ *
+ * @attention This function must be called before the handshake is complete.
+ * @param   ctx [IN/OUT] TLS connection handle.
+ * @param   isEnable [IN] 0 indicates disable, other values indicate enable.
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is NULL.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_SetKtlsSwitch(HITLS_Ctx *ctx, uint8_t isEnable);
+
+/**
+ * @ingroup hitls
+ * @brief   Obtains whether to offload the record protection to the kernel TLS module after the handshake.
+ *
+ * @param   ctx [IN] TLS connection handle.
+ * @param   isEnable [OUT] Indicates whether kernel TLS offload is enabled.
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is NULL.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_GetKtlsSwitch(const HITLS_Ctx *ctx, uint8_t *isEnable);
+
+/**
+ * @ingroup hitls
+ * @brief   Obtains the directions of the connection that are actually protected by the kernel TLS module.
+ *
+ * @param   ctx [IN] TLS connection handle.
+ * @param   state [OUT] Combination of HITLS_KTLS_TX and HITLS_KTLS_RX, 0 if nothing is offloaded.
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is NULL.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_GetKtlsState(const HITLS_Ctx *ctx, uint8_t *state);
+
+/**
+ * @ingroup hitls
+ * @brief   Sends file content as application data without copying it to the user space.
+ *
+ * @attention The transmit direction must be offloaded to the kernel TLS module, see HITLS_GetKtlsState.
+ * @param   ctx [IN] TLS connection handle.
+ * @param   fd [IN] File descriptor of the content.
+ * @param   offset [IN] Offset in the file.
+ * @param   len [IN] Number of bytes to be sent.
+ * @param   sentLen [OUT] Number of bytes actually sent.
+ * @retval  HITLS_SUCCESS, if successful.
+ * @retval  HITLS_REC_NORMAL_IO_BUSY, the socket is busy, call the function again.
+ * @retval  HITLS_REC_ERR_KTLS_NOT_SUPPORT, the transmit direction is not offloaded.
+ * @retval  For other error codes, see hitls_error.h.
+ */
+int32_t HITLS_SendFile(HITLS_Ctx *ctx, int32_t fd, int64_t offset, uint32_t len, uint32_t *sentLen);
+
 /**
  * @ingroup hitls
  * @brief   set the max empty records number can be received
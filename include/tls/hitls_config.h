@@ -197,6 +197,9 @@ typedef enum {
     HITLS_CHACHA20_POLY1305_SHA256 = 0x1303,
     HITLS_AES_128_CCM_SHA256 = 0x1304,
     HITLS_AES_128_CCM_8_SHA256 = 0x1305,
+    /* TLS1.3 ShangMi cipher suite (RFC 8998) */
+    HITLS_SM4_GCM_SM3 = 0x00C6,
+    HITLS_SM4_CCM_SM3 = 0x00C7,
     /* TLCP 1.1 cipher suite */
     HITLS_ECDHE_SM4_CBC_SM3 = 0xE011,
     HITLS_ECC_SM4_CBC_SM3 = 0xE013,
@@ -1157,6 +1160,69 @@ int32_t HITLS_CFG_SetFlightTransmitSwitch(HITLS_Config *config, uint8_t isEnable
  */
 int32_t HITLS_CFG_GetFlightTransmitSwitch(const HITLS_Config *config, uint8_t *isEnable);
 
+/**
+ * @ingroup hitls_config
+ * @brief   Sets whether to offload the record protection to the kernel TLS module after the handshake.
+ *
+ * The offload takes effect only for TLS1.2 and TLS1.3 with AES-GCM or ChaCha20-Poly1305 on a TCP UIO. If the kernel
+ * does not provide the tls module, the connection silently keeps the user space record layer.
+ * Renegotiation is not available on an offloaded connection.
+ *
+ * @param   config [IN/OUT] TLS link configuration
+ * @param   isEnable [IN] 0 indicates that the function is disabled. Other values indicate that it is enabled.
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_CFG_SetKtlsSwitch(HITLS_Config *config, uint8_t isEnable);
+
+/**
+ * @ingroup hitls_config
+ * @brief   Obtains whether the record protection is offloaded to the kernel TLS module after the handshake.
+ *
+ * @param   config [IN] TLS link configuration.
+ * @param   isEnable [OUT] Indicates whether kernel TLS offload is enabled.
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_CFG_GetKtlsSwitch(const HITLS_Config *config, uint8_t *isEnable);
+
+/**
+ * @ingroup hitls_config
+ * @brief   Keeps pregenerated ephemeral keys of the server for the given groups.
+ *
+ * The server takes the key of the TLS1.3 key share and of the TLS1.2 ECDHE ServerKeyExchange from the pool instead
+ * of generating it during the handshake. Every key is used once. A background thread tops a group up to keyNum keys
+ * when it has drained to half and exits again once the pool is full. When the pool of a group is empty, the key is
+ * generated during the handshake as before.
+ * The first key of every group is generated before the function returns, which also checks that the group can be
+ * used. The pool is released together with the config.
+ *
+ * @attention Call it before the config is used by any HITLS_Ctx.
+ * @param   config [OUT] TLS link configuration
+ * @param   groups [IN] Groups to pregenerate, the HITLS_NamedGroup values, for example HITLS_EC_GROUP_CURVE25519.
+ * @param   groupsSize [IN] Number of groups. 0 releases the pool.
+ * @param   keyNum [IN] Number of keys kept for each group, 1 to HITLS_CFG_MAX_SIZE.
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null.
+ * @retval  HITLS_CONFIG_INVALID_LENGTH, groupsSize or keyNum is out of range.
+ * @retval  HITLS_CONFIG_INVALID_SET, a group is given twice.
+ * @retval  HITLS_CRYPT_ERR_ENCODE_ECDH_KEY, the keys of a group cannot be generated.
+ * @retval  HITLS_SUCCESS, if successful.
+ *          For details about other error codes, see hitls_error.h.
+ */
+int32_t HITLS_CFG_SetKeySharePool(HITLS_Config *config, const uint16_t *groups, uint32_t groupsSize, uint32_t keyNum);
+
+/**
+ * @ingroup hitls_config
+ * @brief   Obtains the number of pregenerated keys of a group that are ready in the key share pool.
+ *
+ * @param   config [IN] TLS link configuration
+ * @param   group [IN] Group
+ * @param   keyNum [OUT] Number of ready keys, 0 if the pool does not keep the group.
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_CFG_GetKeySharePoolKeyNum(const HITLS_Config *config, uint16_t group, uint32_t *keyNum);
+
 /**
  * @ingroup hitls_config
  * @brief   Set the max empty records number can be received
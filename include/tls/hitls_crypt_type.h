@@ -84,6 +84,8 @@ typedef enum {
     HITLS_CIPHER_AES_256_CCM8,
     HITLS_CIPHER_CHACHA20_POLY1305,
     HITLS_CIPHER_SM4_CBC,
+    HITLS_CIPHER_SM4_GCM,
+    HITLS_CIPHER_SM4_CCM,
     HITLS_CIPHER_BUTT = 255
 } HITLS_CipherAlgo;
 
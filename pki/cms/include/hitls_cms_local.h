@@ -18,6 +18,10 @@
 
 #include "bsl_type.h"
 #include "bsl_obj.h"
+#include "bsl_asn1.h"
+#include "crypt_eal_md.h"
+#include "crypt_eal_pkey.h"
+#include "hitls_x509_local.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +36,55 @@ int32_t HITLS_CMS_ParseDigestInfo(BSL_Buffer *encode, BslCid *cid, BSL_Buffer *d
 // encode PKCS7-DigestInfo：only support hash.
 int32_t HITLS_CMS_EncodeDigestInfoBuff(BslCid cid, BSL_Buffer *in, BSL_Buffer *encode);
 
+#define HITLS_CMS_MAX_MD_SIZE 64
+
+typedef enum {
+    HITLS_CMS_SIGNEDDATA_STATE_NEW = 0,
+    HITLS_CMS_SIGNEDDATA_STATE_SIGN,   // SignInit has been called, the content is being digested
+    HITLS_CMS_SIGNEDDATA_STATE_VERIFY, // VerifyInit has been called, the content is being digested
+    HITLS_CMS_SIGNEDDATA_STATE_FINAL,
+} HITLS_CMS_SIGNEDDATA_STATE;
+
+/* One digest algorithm of a SignedData. Every digest is computed once, whatever the number of signers using it. */
+typedef struct {
+    BslCid mdId;
+    CRYPT_EAL_MdCTX *mdCtx;
+    uint8_t digest[HITLS_CMS_MAX_MD_SIZE];
+    uint32_t digestLen;
+} HITLS_CMS_Digest;
+
+typedef struct {
+    HITLS_X509_Cert *cert;
+    BslCid mdId;
+    HITLS_CMS_Digest *digest; // The digest of the content with mdId, an item of the digest list.
+
+    /* Signing only. */
+    CRYPT_EAL_PkeyCtx *prvKey;
+    HITLS_X509_SignAlgParam algParam;
+
+    /* Decoded from a SignerInfo, pointing into the rawData of the SignedData. */
+    BSL_ASN1_Buffer issuer;
+    BSL_ASN1_Buffer serialNum;
+    BSL_ASN1_Buffer signedAttrs;
+    HITLS_X509_Asn1AlgId signAlgId;
+    BSL_ASN1_Buffer signature;
+} HITLS_CMS_SignerInfo;
+
+/*
+ * A detached SignedData defined in RFC 5652. The content never passes through this object as a whole, it is only
+ * fed to the digests by the update functions, so the memory used does not depend on the size of the content.
+ */
+typedef struct _HITLS_CMS_SignedData {
+    uint8_t state;
+    BslList *digests;   // Item is HITLS_CMS_Digest.
+    BslList *signers;   // Item is HITLS_CMS_SignerInfo.
+    HITLS_X509_List *certs; // The certificates carried by the SignedData.
+    BSL_ASN1_Buffer contentType; // The eContentType of a parsed SignedData.
+
+    uint8_t *rawData;   // The parsed SignedData.
+    uint32_t rawDataLen;
+} HITLS_CMS_SignedData;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,1194 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include <stdlib.h>
+#include "securec.h"
+#include "bsl_sal.h"
+#include "bsl_list.h"
+#include "bsl_err_internal.h"
+#include "bsl_asn1.h"
+#include "bsl_obj_internal.h"
+#include "crypt_errno.h"
+#include "crypt_eal_md.h"
+#include "crypt_eal_pkey.h"
+#include "hitls_pki_errno.h"
+#include "hitls_cert_local.h"
+#include "hitls_cms_local.h"
+
+#define HITLS_CMS_CTX_SPECIFIC_TAG_0 0
+#define HITLS_CMS_CTX_SPECIFIC_TAG_1 1
+#define HITLS_CMS_SIGNEDDATA_VERSION 1
+#define HITLS_CMS_SIGNERINFO_VERSION 1
+
+/**
+ * ContentInfo ::= SEQUENCE {
+ *     contentType ContentType,
+ *     content [0] EXPLICIT ANY DEFINED BY contentType }
+ *
+ * SignedData ::= SEQUENCE {
+ *     version CMSVersion,
+ *     digestAlgorithms DigestAlgorithmIdentifiers,
+ *     encapContentInfo EncapsulatedContentInfo,
+ *     certificates [0] IMPLICIT CertificateSet OPTIONAL,
+ *     crls [1] IMPLICIT RevocationInfoChoices OPTIONAL,
+ *     signerInfos SignerInfos }
+ *
+ * EncapsulatedContentInfo ::= SEQUENCE {
+ *     eContentType ContentType,
+ *     eContent [0] EXPLICIT OCTET STRING OPTIONAL }
+ *
+ * https://datatracker.ietf.org/doc/html/rfc5652#section-5.1
+ */
+static BSL_ASN1_TemplateItem g_cmsSignedDataTempl[] = {
+    {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 0},
+        {BSL_ASN1_TAG_OBJECT_ID, 0, 1},
+        {BSL_ASN1_CLASS_CTX_SPECIFIC | BSL_ASN1_TAG_CONSTRUCTED | HITLS_CMS_CTX_SPECIFIC_TAG_0, 0, 1},
+            {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 2},
+                /* version */
+                {BSL_ASN1_TAG_INTEGER, 0, 3},
+                /* digestAlgorithms */
+                {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, BSL_ASN1_FLAG_HEADERONLY, 3},
+                /* encapContentInfo, parsed with g_cmsEncapContentInfoTempl */
+                {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, BSL_ASN1_FLAG_HEADERONLY, 3},
+                /* certificates */
+                {BSL_ASN1_CLASS_CTX_SPECIFIC | BSL_ASN1_TAG_CONSTRUCTED | HITLS_CMS_CTX_SPECIFIC_TAG_0,
+                    BSL_ASN1_FLAG_OPTIONAL | BSL_ASN1_FLAG_HEADERONLY, 3},
+                /* crls */
+                {BSL_ASN1_CLASS_CTX_SPECIFIC | BSL_ASN1_TAG_CONSTRUCTED | HITLS_CMS_CTX_SPECIFIC_TAG_1,
+                    BSL_ASN1_FLAG_OPTIONAL | BSL_ASN1_FLAG_HEADERONLY, 3},
+                /* signerInfos */
+                {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, BSL_ASN1_FLAG_HEADERONLY, 3},
+};
+
+typedef enum {
+    HITLS_CMS_SIGNEDDATA_TYPE_IDX,
+    HITLS_CMS_SIGNEDDATA_VERSION_IDX,
+    HITLS_CMS_SIGNEDDATA_DIGESTALGS_IDX,
+    HITLS_CMS_SIGNEDDATA_ENCAPCONTENT_IDX,
+    HITLS_CMS_SIGNEDDATA_CERTS_IDX,
+    HITLS_CMS_SIGNEDDATA_CRLS_IDX,
+    HITLS_CMS_SIGNEDDATA_SIGNERINFOS_IDX,
+    HITLS_CMS_SIGNEDDATA_MAX_IDX,
+} HITLS_CMS_SIGNEDDATA_IDX;
+
+/*
+ * The optional eContent [0] has the same tag as the certificates [0] that follows the encapContentInfo, so the
+ * encapContentInfo is decoded on its own, bounded by its length.
+ */
+static BSL_ASN1_TemplateItem g_cmsEncapContentInfoTempl[] = {
+    {BSL_ASN1_TAG_OBJECT_ID, 0, 0},
+    {BSL_ASN1_CLASS_CTX_SPECIFIC | BSL_ASN1_TAG_CONSTRUCTED | HITLS_CMS_CTX_SPECIFIC_TAG_0,
+        BSL_ASN1_FLAG_OPTIONAL | BSL_ASN1_FLAG_HEADERONLY, 0},
+};
+
+typedef enum {
+    HITLS_CMS_ENCAPCONTENT_TYPE_IDX,
+    HITLS_CMS_ENCAPCONTENT_CONTENT_IDX,
+    HITLS_CMS_ENCAPCONTENT_MAX_IDX,
+} HITLS_CMS_ENCAPCONTENT_IDX;
+
+/**
+ * SignerInfo ::= SEQUENCE {
+ *     version CMSVersion,
+ *     sid SignerIdentifier,
+ *     digestAlgorithm DigestAlgorithmIdentifier,
+ *     signedAttrs [0] IMPLICIT SignedAttributes OPTIONAL,
+ *     signatureAlgorithm SignatureAlgorithmIdentifier,
+ *     signature SignatureValue,
+ *     unsignedAttrs [1] IMPLICIT UnsignedAttributes OPTIONAL }
+ *
+ * IssuerAndSerialNumber ::= SEQUENCE {
+ *     issuer Name,
+ *     serialNumber CertificateSerialNumber }
+ *
+ * https://datatracker.ietf.org/doc/html/rfc5652#section-5.3
+ */
+static BSL_ASN1_TemplateItem g_cmsSignerInfoTempl[] = {
+    /* version */
+    {BSL_ASN1_TAG_INTEGER, 0, 0},
+    /* sid: only issuerAndSerialNumber */
+    {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 0},
+        {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, BSL_ASN1_FLAG_HEADERONLY, 1},
+        {BSL_ASN1_TAG_INTEGER, 0, 1},
+    /* digestAlgorithm */
+    {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 0},
+        {BSL_ASN1_TAG_OBJECT_ID, 0, 1},
+        {BSL_ASN1_TAG_ANY, BSL_ASN1_FLAG_OPTIONAL, 1},
+    /* signedAttrs */
+    {BSL_ASN1_CLASS_CTX_SPECIFIC | BSL_ASN1_TAG_CONSTRUCTED | HITLS_CMS_CTX_SPECIFIC_TAG_0,
+        BSL_ASN1_FLAG_OPTIONAL | BSL_ASN1_FLAG_HEADERONLY, 0},
+    /* signatureAlgorithm */
+    {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 0},
+        {BSL_ASN1_TAG_OBJECT_ID, 0, 1},
+        {BSL_ASN1_TAG_ANY, BSL_ASN1_FLAG_OPTIONAL, 1},
+    /* signature */
+    {BSL_ASN1_TAG_OCTETSTRING, 0, 0},
+    /* unsignedAttrs */
+    {BSL_ASN1_CLASS_CTX_SPECIFIC | BSL_ASN1_TAG_CONSTRUCTED | HITLS_CMS_CTX_SPECIFIC_TAG_1,
+        BSL_ASN1_FLAG_OPTIONAL | BSL_ASN1_FLAG_HEADERONLY, 0},
+};
+
+typedef enum {
+    HITLS_CMS_SIGNERINFO_VERSION_IDX,
+    HITLS_CMS_SIGNERINFO_ISSUER_IDX,
+    HITLS_CMS_SIGNERINFO_SERIAL_IDX,
+    HITLS_CMS_SIGNERINFO_MD_OID_IDX,
+    HITLS_CMS_SIGNERINFO_MD_PARAM_IDX,
+    HITLS_CMS_SIGNERINFO_SIGNEDATTRS_IDX,
+    HITLS_CMS_SIGNERINFO_SIGNALG_OID_IDX,
+    HITLS_CMS_SIGNERINFO_SIGNALG_PARAM_IDX,
+    HITLS_CMS_SIGNERINFO_SIGNATURE_IDX,
+    HITLS_CMS_SIGNERINFO_UNSIGNEDATTRS_IDX,
+    HITLS_CMS_SIGNERINFO_MAX_IDX,
+} HITLS_CMS_SIGNERINFO_IDX;
+
+/* The SignerInfo generated: the parameters of the digest algorithm are absent as RFC 5754 recommends. */
+static BSL_ASN1_TemplateItem g_cmsSignerInfoEncTempl[] = {
+    {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 0},
+        {BSL_ASN1_TAG_INTEGER, 0, 1},
+        {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 1},
+            {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, BSL_ASN1_FLAG_HEADERONLY, 2},
+            {BSL_ASN1_TAG_INTEGER, 0, 2},
+        {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 1},
+            {BSL_ASN1_TAG_OBJECT_ID, 0, 2},
+        {BSL_ASN1_CLASS_CTX_SPECIFIC | BSL_ASN1_TAG_CONSTRUCTED | HITLS_CMS_CTX_SPECIFIC_TAG_0,
+            BSL_ASN1_FLAG_HEADERONLY, 1},
+        {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, BSL_ASN1_FLAG_HEADERONLY, 1},
+        {BSL_ASN1_TAG_OCTETSTRING, 0, 1},
+};
+
+#define HITLS_CMS_SIGNERINFO_ENC_NUM 7
+
+/**
+ * SignedAttributes ::= SET SIZE (1..MAX) OF Attribute
+ * Attribute ::= SEQUENCE {
+ *     attrType OBJECT IDENTIFIER,
+ *     attrValues SET OF AttributeValue }
+ *
+ * The encodings of the three attributes only differ in their length, which grows from contentType to signingTime
+ * to messageDigest, so this order is the DER order of the SET OF.
+ */
+static BSL_ASN1_TemplateItem g_cmsSignedAttrsTempl[] = {
+    {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, 0, 0},
+        /* contentType */
+        {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 1},
+            {BSL_ASN1_TAG_OBJECT_ID, 0, 2},
+            {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, 0, 2},
+                {BSL_ASN1_TAG_OBJECT_ID, 0, 3},
+        /* signingTime, left out if the system time is not available */
+        {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, BSL_ASN1_FLAG_OPTIONAL, 1},
+            {BSL_ASN1_TAG_OBJECT_ID, 0, 2},
+            {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, 0, 2},
+                {BSL_ASN1_TAG_CHOICE, 0, 3},
+        /* messageDigest */
+        {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 1},
+            {BSL_ASN1_TAG_OBJECT_ID, 0, 2},
+            {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, 0, 2},
+                {BSL_ASN1_TAG_OCTETSTRING, 0, 3},
+};
+
+typedef enum {
+    HITLS_CMS_SIGNEDATTRS_CONTENTTYPE_OID_IDX,
+    HITLS_CMS_SIGNEDATTRS_CONTENTTYPE_IDX,
+    HITLS_CMS_SIGNEDATTRS_SIGNINGTIME_OID_IDX,
+    HITLS_CMS_SIGNEDATTRS_SIGNINGTIME_IDX,
+    HITLS_CMS_SIGNEDATTRS_MESSAGEDIGEST_OID_IDX,
+    HITLS_CMS_SIGNEDATTRS_MESSAGEDIGEST_IDX,
+    HITLS_CMS_SIGNEDATTRS_MAX_IDX,
+} HITLS_CMS_SIGNEDATTRS_IDX;
+
+static BSL_ASN1_TemplateItem g_cmsAttrTempl[] = {
+    {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 0},
+        {BSL_ASN1_TAG_OBJECT_ID, 0, 1},
+        {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, BSL_ASN1_FLAG_HEADERONLY, 1},
+};
+
+typedef enum {
+    HITLS_CMS_ATTR_OID_IDX,
+    HITLS_CMS_ATTR_VALUES_IDX,
+    HITLS_CMS_ATTR_MAX_IDX,
+} HITLS_CMS_ATTR_IDX;
+
+static BSL_ASN1_TemplateItem g_cmsDigestAlgTempl[] = {
+    {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, 0},
+        {BSL_ASN1_TAG_OBJECT_ID, 0, 1},
+};
+
+static int32_t CMS_TagGetOrCheck(int32_t type, int32_t idx, void *data, void *expVal)
+{
+    (void)idx;
+    if (type != BSL_ASN1_TYPE_GET_ANY_TAG) {
+        return HITLS_CMS_ERR_INVALID_DATA;
+    }
+    BSL_ASN1_Buffer *param = (BSL_ASN1_Buffer *)data;
+    BslOidString oidStr = {param->len, (char *)param->buff, 0};
+    BslCid cid = BSL_OBJ_GetCIDFromOid(&oidStr);
+    if (cid == BSL_CID_UNKNOWN) {
+        return HITLS_CMS_ERR_INVALID_ALGO;
+    }
+    *(uint8_t *)expVal = (cid == BSL_CID_RSASSAPSS) ? (BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE) :
+        BSL_ASN1_TAG_NULL;
+    return BSL_SUCCESS;
+}
+
+static void CMS_DigestFree(HITLS_CMS_Digest *digest)
+{
+    if (digest == NULL) {
+        return;
+    }
+    CRYPT_EAL_MdFreeCtx(digest->mdCtx);
+    BSL_SAL_Free(digest);
+}
+
+static void CMS_SignerInfoFree(HITLS_CMS_SignerInfo *signer)
+{
+    if (signer == NULL) {
+        return;
+    }
+    HITLS_X509_CertFree(signer->cert);
+    CRYPT_EAL_PkeyFreeCtx(signer->prvKey);
+    if (signer->algParam.algId == BSL_CID_SM2DSAWITHSM3) {
+        BSL_SAL_FREE(signer->algParam.sm2UserId.data);
+    }
+    BSL_SAL_Free(signer);
+}
+
+static void CMS_SignedDataClear(HITLS_CMS_SignedData *signedData)
+{
+    BSL_LIST_DeleteAll(signedData->digests, (BSL_LIST_PFUNC_FREE)CMS_DigestFree);
+    BSL_LIST_DeleteAll(signedData->signers, (BSL_LIST_PFUNC_FREE)CMS_SignerInfoFree);
+    BSL_LIST_FREE(signedData->certs, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+    BSL_SAL_FREE(signedData->rawData);
+    signedData->rawDataLen = 0;
+    (void)memset_s(&signedData->contentType, sizeof(BSL_ASN1_Buffer), 0, sizeof(BSL_ASN1_Buffer));
+    signedData->state = HITLS_CMS_SIGNEDDATA_STATE_NEW;
+}
+
+HITLS_CMS_SignedData *HITLS_CMS_SignedDataNew(void)
+{
+    HITLS_CMS_SignedData *signedData = BSL_SAL_Calloc(1, sizeof(HITLS_CMS_SignedData));
+    if (signedData == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return NULL;
+    }
+    signedData->digests = BSL_LIST_New(sizeof(HITLS_CMS_Digest));
+    signedData->signers = BSL_LIST_New(sizeof(HITLS_CMS_SignerInfo));
+    if (signedData->digests == NULL || signedData->signers == NULL) {
+        BSL_SAL_Free(signedData->digests);
+        BSL_SAL_Free(signedData->signers);
+        BSL_SAL_Free(signedData);
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return NULL;
+    }
+    return signedData;
+}
+
+void HITLS_CMS_SignedDataFree(HITLS_CMS_SignedData *signedData)
+{
+    if (signedData == NULL) {
+        return;
+    }
+    CMS_SignedDataClear(signedData);
+    BSL_SAL_Free(signedData->digests);
+    BSL_SAL_Free(signedData->signers);
+    BSL_SAL_Free(signedData);
+}
+
+static HITLS_CMS_Digest *CMS_FindDigest(BslList *digests, BslCid mdId)
+{
+    HITLS_CMS_Digest *digest = BSL_LIST_GET_FIRST(digests);
+    while (digest != NULL) {
+        if (digest->mdId == mdId) {
+            return digest;
+        }
+        digest = BSL_LIST_GET_NEXT(digests);
+    }
+    return NULL;
+}
+
+/* The signers using the same digest algorithm share its context, so the content is hashed once per algorithm. */
+static int32_t CMS_AddDigest(BslList *digests, HITLS_CMS_SignerInfo *signer)
+{
+    HITLS_CMS_Digest *digest = CMS_FindDigest(digests, signer->mdId);
+    if (digest != NULL) {
+        signer->digest = digest;
+        return HITLS_X509_SUCCESS;
+    }
+    digest = BSL_SAL_Calloc(1, sizeof(HITLS_CMS_Digest));
+    if (digest == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    digest->mdId = signer->mdId;
+    digest->mdCtx = CRYPT_EAL_MdNewCtx((CRYPT_MD_AlgId)signer->mdId);
+    if (digest->mdCtx == NULL) {
+        BSL_SAL_Free(digest);
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_ALGO);
+        return HITLS_CMS_ERR_INVALID_ALGO;
+    }
+    int32_t ret = BSL_LIST_AddElement(digests, digest, BSL_LIST_POS_END);
+    if (ret != BSL_SUCCESS) {
+        CMS_DigestFree(digest);
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    signer->digest = digest;
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t CMS_InitDigests(HITLS_CMS_SignedData *signedData)
+{
+    BSL_LIST_DeleteAll(signedData->digests, (BSL_LIST_PFUNC_FREE)CMS_DigestFree);
+    int32_t ret;
+    HITLS_CMS_SignerInfo *signer = BSL_LIST_GET_FIRST(signedData->signers);
+    while (signer != NULL) {
+        ret = CMS_AddDigest(signedData->digests, signer);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
+        signer = BSL_LIST_GET_NEXT(signedData->signers);
+    }
+    HITLS_CMS_Digest *digest = BSL_LIST_GET_FIRST(signedData->digests);
+    while (digest != NULL) {
+        ret = CRYPT_EAL_MdInit(digest->mdCtx);
+        if (ret != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+        digest = BSL_LIST_GET_NEXT(signedData->digests);
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t CMS_UpdateDigests(HITLS_CMS_SignedData *signedData, uint8_t state, const uint8_t *data,
+    uint32_t dataLen)
+{
+    if (signedData == NULL || (data == NULL && dataLen != 0)) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_NULL_POINTER);
+        return HITLS_CMS_ERR_NULL_POINTER;
+    }
+    if (signedData->state != state) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_STATE);
+        return HITLS_CMS_ERR_STATE;
+    }
+    if (dataLen == 0) {
+        return HITLS_X509_SUCCESS;
+    }
+    HITLS_CMS_Digest *digest = BSL_LIST_GET_FIRST(signedData->digests);
+    while (digest != NULL) {
+        int32_t ret = CRYPT_EAL_MdUpdate(digest->mdCtx, data, dataLen);
+        if (ret != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+        digest = BSL_LIST_GET_NEXT(signedData->digests);
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t CMS_FinalDigests(HITLS_CMS_SignedData *signedData)
+{
+    HITLS_CMS_Digest *digest = BSL_LIST_GET_FIRST(signedData->digests);
+    while (digest != NULL) {
+        digest->digestLen = HITLS_CMS_MAX_MD_SIZE;
+        int32_t ret = CRYPT_EAL_MdFinal(digest->mdCtx, digest->digest, &digest->digestLen);
+        if (ret != CRYPT_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+        digest = BSL_LIST_GET_NEXT(signedData->digests);
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t CMS_CopyAlgParam(HITLS_X509_SignAlgParam *dest, const HITLS_X509_SignAlgParam *src)
+{
+    if (src == NULL) {
+        return HITLS_X509_SUCCESS;
+    }
+    *dest = *src;
+    if (src->algId != BSL_CID_SM2DSAWITHSM3 || src->sm2UserId.data == NULL) {
+        return HITLS_X509_SUCCESS;
+    }
+    dest->sm2UserId.data = BSL_SAL_Dump(src->sm2UserId.data, src->sm2UserId.dataLen);
+    if (dest->sm2UserId.data == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_DUMP_FAIL);
+        return BSL_DUMP_FAIL;
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+int32_t HITLS_CMS_SignedDataAddSigner(HITLS_CMS_SignedData *signedData, HITLS_X509_Cert *cert,
+    CRYPT_EAL_PkeyCtx *prvKey, uint32_t mdId, const HITLS_X509_SignAlgParam *algParam)
+{
+    if (signedData == NULL || cert == NULL || prvKey == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_NULL_POINTER);
+        return HITLS_CMS_ERR_NULL_POINTER;
+    }
+    if (signedData->state != HITLS_CMS_SIGNEDDATA_STATE_NEW || signedData->rawData != NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_STATE);
+        return HITLS_CMS_ERR_STATE;
+    }
+    if (cert->rawData == NULL || cert->tbs.serialNum.buff == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_PARAM);
+        return HITLS_CMS_ERR_INVALID_PARAM;
+    }
+    if (BSL_OBJ_GetOidFromCID((BslCid)mdId) == NULL || CRYPT_EAL_MdGetDigestSize((CRYPT_MD_AlgId)mdId) == 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_ALGO);
+        return HITLS_CMS_ERR_INVALID_ALGO;
+    }
+    HITLS_CMS_SignerInfo *signer = BSL_SAL_Calloc(1, sizeof(HITLS_CMS_SignerInfo));
+    if (signer == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    int32_t ret = CMS_CopyAlgParam(&signer->algParam, algParam);
+    if (ret != HITLS_X509_SUCCESS) {
+        BSL_SAL_Free(signer);
+        return ret;
+    }
+    int ref;
+    ret = HITLS_X509_CertCtrl(cert, HITLS_X509_REF_UP, &ref, sizeof(int));
+    if (ret != HITLS_X509_SUCCESS) {
+        CMS_SignerInfoFree(signer);
+        return ret;
+    }
+    signer->cert = cert;
+    ret = CRYPT_EAL_PkeyUpRef(prvKey);
+    if (ret != CRYPT_SUCCESS) {
+        CMS_SignerInfoFree(signer);
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    signer->prvKey = prvKey;
+    signer->mdId = (BslCid)mdId;
+    ret = BSL_LIST_AddElement(signedData->signers, signer, BSL_LIST_POS_END);
+    if (ret != BSL_SUCCESS) {
+        CMS_SignerInfoFree(signer);
+        BSL_ERR_PUSH_ERROR(ret);
+    }
+    return ret;
+}
+
+int32_t HITLS_CMS_SignedDataSignInit(HITLS_CMS_SignedData *signedData)
+{
+    if (signedData == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_NULL_POINTER);
+        return HITLS_CMS_ERR_NULL_POINTER;
+    }
+    if (signedData->rawData != NULL || signedData->state == HITLS_CMS_SIGNEDDATA_STATE_VERIFY) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_STATE);
+        return HITLS_CMS_ERR_STATE;
+    }
+    if (BSL_LIST_COUNT(signedData->signers) == 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_NO_SIGNER);
+        return HITLS_CMS_ERR_NO_SIGNER;
+    }
+    int32_t ret = CMS_InitDigests(signedData);
+    if (ret != HITLS_X509_SUCCESS) {
+        signedData->state = HITLS_CMS_SIGNEDDATA_STATE_FINAL;
+        return ret;
+    }
+    signedData->state = HITLS_CMS_SIGNEDDATA_STATE_SIGN;
+    return HITLS_X509_SUCCESS;
+}
+
+int32_t HITLS_CMS_SignedDataSignUpdate(HITLS_CMS_SignedData *signedData, const uint8_t *data, uint32_t dataLen)
+{
+    return CMS_UpdateDigests(signedData, HITLS_CMS_SIGNEDDATA_STATE_SIGN, data, dataLen);
+}
+
+static void CMS_FreeAsnArr(BSL_ASN1_Buffer *asnArr, uint32_t num)
+{
+    if (asnArr == NULL) {
+        return;
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        BSL_SAL_Free(asnArr[i].buff);
+    }
+    BSL_SAL_Free(asnArr);
+}
+
+static int32_t CMS_DerCmp(const void *a, const void *b)
+{
+    const BSL_ASN1_Buffer *left = (const BSL_ASN1_Buffer *)a;
+    const BSL_ASN1_Buffer *right = (const BSL_ASN1_Buffer *)b;
+    uint32_t len = left->len < right->len ? left->len : right->len;
+    int32_t res = memcmp(left->buff, right->buff, len);
+    if (res != 0) {
+        return res;
+    }
+    return (left->len > right->len) - (left->len < right->len);
+}
+
+/* Concatenate the DER encoded elements of a SET OF, in the ascending order required by DER. */
+static int32_t CMS_EncodeSetOf(BSL_ASN1_Buffer *elems, uint32_t num, uint8_t tag, BSL_ASN1_Buffer *out)
+{
+    uint32_t len = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        if (elems[i].len > UINT32_MAX - len) {
+            BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_DATA);
+            return HITLS_CMS_ERR_INVALID_DATA;
+        }
+        len += elems[i].len;
+    }
+    qsort(elems, num, sizeof(BSL_ASN1_Buffer), CMS_DerCmp);
+    uint8_t *buff = BSL_SAL_Malloc(len);
+    if (buff == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        (void)memcpy_s(buff + offset, len - offset, elems[i].buff, elems[i].len);
+        offset += elems[i].len;
+    }
+    out->tag = tag;
+    out->buff = buff;
+    out->len = len;
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t CMS_EncodeSignedAttrs(const HITLS_CMS_Digest *digest, BSL_TIME *signingTime, BSL_ASN1_Buffer *attrs)
+{
+    BslOidString *contentTypeOid = BSL_OBJ_GetOidFromCID(BSL_CID_CONTENTTYPE);
+    BslOidString *dataOid = BSL_OBJ_GetOidFromCID(BSL_CID_DATA);
+    BslOidString *signingTimeOid = BSL_OBJ_GetOidFromCID(BSL_CID_SIGNINGTIME);
+    BslOidString *messageDigestOid = BSL_OBJ_GetOidFromCID(BSL_CID_MESSAGEDIGEST);
+    if (contentTypeOid == NULL || dataOid == NULL || signingTimeOid == NULL || messageDigestOid == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_ALGO);
+        return HITLS_CMS_ERR_INVALID_ALGO;
+    }
+    BSL_ASN1_Buffer asnArr[HITLS_CMS_SIGNEDATTRS_MAX_IDX] = {
+        {BSL_ASN1_TAG_OBJECT_ID, contentTypeOid->octetLen, (uint8_t *)contentTypeOid->octs},
+        {BSL_ASN1_TAG_OBJECT_ID, dataOid->octetLen, (uint8_t *)dataOid->octs},
+        {0, 0, NULL},
+        {0, 0, NULL},
+        {BSL_ASN1_TAG_OBJECT_ID, messageDigestOid->octetLen, (uint8_t *)messageDigestOid->octs},
+        {BSL_ASN1_TAG_OCTETSTRING, digest->digestLen, (uint8_t *)(uintptr_t)digest->digest},
+    };
+    if (signingTime != NULL) {
+        asnArr[HITLS_CMS_SIGNEDATTRS_SIGNINGTIME_OID_IDX].tag = BSL_ASN1_TAG_OBJECT_ID;
+        asnArr[HITLS_CMS_SIGNEDATTRS_SIGNINGTIME_OID_IDX].len = signingTimeOid->octetLen;
+        asnArr[HITLS_CMS_SIGNEDATTRS_SIGNINGTIME_OID_IDX].buff = (uint8_t *)signingTimeOid->octs;
+        // RFC 5652 section 11.3: UTCTime for the years 1950 through 2049.
+        asnArr[HITLS_CMS_SIGNEDATTRS_SIGNINGTIME_IDX].tag = signingTime->year <= BSL_TIME_UTC_MAX_YEAR ?
+            BSL_ASN1_TAG_UTCTIME : BSL_ASN1_TAG_GENERALIZEDTIME;
+        asnArr[HITLS_CMS_SIGNEDATTRS_SIGNINGTIME_IDX].len = sizeof(BSL_TIME);
+        asnArr[HITLS_CMS_SIGNEDATTRS_SIGNINGTIME_IDX].buff = (uint8_t *)signingTime;
+    }
+    BSL_ASN1_Template templ = {g_cmsSignedAttrsTempl, sizeof(g_cmsSignedAttrsTempl) / sizeof(g_cmsSignedAttrsTempl[0])};
+    int32_t ret = BSL_ASN1_EncodeTemplate(&templ, asnArr, HITLS_CMS_SIGNEDATTRS_MAX_IDX, &attrs->buff, &attrs->len);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    attrs->tag = BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET;
+    return HITLS_X509_SUCCESS;
+}
+
+typedef struct {
+    HITLS_CMS_SignerInfo *signer;
+    BSL_ASN1_Buffer *signedAttrs; // The DER encoded SET of the signed attributes, which is signed.
+    BSL_ASN1_Buffer *encode;      // The SignerInfo generated.
+} CMS_SignParam;
+
+static int32_t CMS_EncodeSignerInfo(CMS_SignParam *param, BSL_ASN1_Buffer *signAlg, BSL_ASN1_Buffer *signature)
+{
+    HITLS_X509_Cert *cert = param->signer->cert;
+    BSL_ASN1_Buffer issuer = cert->tbs.issuerAsn;
+    int32_t ret;
+    if (issuer.buff == NULL) { // A generated certificate.
+        ret = HITLS_X509_EncodeNameList(cert->tbs.issuerName, &issuer);
+        if (ret != HITLS_X509_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+    }
+    // The signed attributes are signed with the tag of SET, and carried with the tag [0] IMPLICIT.
+    BSL_ASN1_Buffer signedAttrs = *param->signedAttrs;
+    uint32_t valLen = 0;
+    ret = BSL_ASN1_DecodeTagLen(signedAttrs.tag, &signedAttrs.buff, &signedAttrs.len, &valLen);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        goto EXIT;
+    }
+    BslOidString *mdOid = BSL_OBJ_GetOidFromCID(param->signer->mdId);
+    uint8_t version = HITLS_CMS_SIGNERINFO_VERSION;
+    BSL_ASN1_Buffer asnArr[HITLS_CMS_SIGNERINFO_ENC_NUM] = {
+        {BSL_ASN1_TAG_INTEGER, sizeof(version), &version},
+        issuer,
+        cert->tbs.serialNum,
+        {BSL_ASN1_TAG_OBJECT_ID, mdOid->octetLen, (uint8_t *)mdOid->octs},
+        {BSL_ASN1_CLASS_CTX_SPECIFIC | BSL_ASN1_TAG_CONSTRUCTED | HITLS_CMS_CTX_SPECIFIC_TAG_0, valLen,
+            signedAttrs.buff},
+        *signAlg,
+        *signature,
+    };
+    BSL_ASN1_Template templ = {g_cmsSignerInfoEncTempl,
+        sizeof(g_cmsSignerInfoEncTempl) / sizeof(g_cmsSignerInfoEncTempl[0])};
+    ret = BSL_ASN1_EncodeTemplate(&templ, asnArr, HITLS_CMS_SIGNERINFO_ENC_NUM, &param->encode->buff,
+        &param->encode->len);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        goto EXIT;
+    }
+    param->encode->tag = BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE;
+EXIT:
+    if (issuer.buff != cert->tbs.issuerAsn.buff) {
+        BSL_SAL_Free(issuer.buff);
+    }
+    return ret;
+}
+
+static int32_t CMS_SignCb(uint32_t mdId, CRYPT_EAL_PkeyCtx *prvKey, HITLS_X509_Asn1AlgId *signAlgId, void *obj)
+{
+    CMS_SignParam *param = (CMS_SignParam *)obj;
+    BSL_ASN1_Buffer signAlg = {0};
+    BSL_ASN1_Buffer signature = {BSL_ASN1_TAG_OCTETSTRING, CRYPT_EAL_PkeyGetSignLen(prvKey), NULL};
+    int32_t ret;
+    signature.buff = BSL_SAL_Malloc(signature.len);
+    if (signature.buff == NULL) {
+        ret = BSL_MALLOC_FAIL;
+        BSL_ERR_PUSH_ERROR(ret);
+        goto EXIT;
+    }
+    ret = CRYPT_EAL_PkeySign(prvKey, (CRYPT_MD_AlgId)mdId, param->signedAttrs->buff, param->signedAttrs->len,
+        signature.buff, &signature.len);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        goto EXIT;
+    }
+    ret = HITLS_X509_EncodeSignAlgInfo(signAlgId, &signAlg);
+    if (ret != HITLS_X509_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        goto EXIT;
+    }
+    ret = CMS_EncodeSignerInfo(param, &signAlg, &signature);
+EXIT:
+    BSL_SAL_Free(signature.buff);
+    BSL_SAL_Free(signAlg.buff);
+    if (signAlgId->algId == BSL_CID_SM2DSAWITHSM3) {
+        BSL_SAL_FREE(signAlgId->sm2UserId.data); // Only referenced by the SignerInfo being generated.
+    }
+    return ret;
+}
+
+static int32_t CMS_SignSignerInfo(HITLS_CMS_SignerInfo *signer, BSL_TIME *signingTime, BSL_ASN1_Buffer *encode)
+{
+    BSL_ASN1_Buffer signedAttrs = {0};
+    int32_t ret = CMS_EncodeSignedAttrs(signer->digest, signingTime, &signedAttrs);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    CMS_SignParam param = {signer, &signedAttrs, encode};
+    const HITLS_X509_SignAlgParam *algParam = signer->algParam.algId == 0 ? NULL : &signer->algParam;
+    ret = HITLS_X509_Sign(signer->mdId, signer->prvKey, algParam, &param, CMS_SignCb);
+    BSL_SAL_Free(signedAttrs.buff);
+    return ret;
+}
+
+static int32_t CMS_EncodeSignerInfos(HITLS_CMS_SignedData *signedData, BSL_ASN1_Buffer *signerInfos)
+{
+    BSL_TIME signingTime = {0};
+    BSL_TIME *time = BSL_SAL_SysTimeGet(&signingTime) == BSL_SUCCESS ? &signingTime : NULL;
+    uint32_t num = (uint32_t)BSL_LIST_COUNT(signedData->signers);
+    BSL_ASN1_Buffer *elems = BSL_SAL_Calloc(num, sizeof(BSL_ASN1_Buffer));
+    if (elems == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    int32_t ret = HITLS_X509_SUCCESS;
+    uint32_t i = 0;
+    HITLS_CMS_SignerInfo *signer = BSL_LIST_GET_FIRST(signedData->signers);
+    while (signer != NULL && i < num) {
+        ret = CMS_SignSignerInfo(signer, time, &elems[i]);
+        if (ret != HITLS_X509_SUCCESS) {
+            goto EXIT;
+        }
+        i++;
+        signer = BSL_LIST_GET_NEXT(signedData->signers);
+    }
+    ret = CMS_EncodeSetOf(elems, num, BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, signerInfos);
+EXIT:
+    CMS_FreeAsnArr(elems, num);
+    return ret;
+}
+
+static int32_t CMS_EncodeDigestAlgs(HITLS_CMS_SignedData *signedData, BSL_ASN1_Buffer *digestAlgs)
+{
+    uint32_t num = (uint32_t)BSL_LIST_COUNT(signedData->digests);
+    BSL_ASN1_Buffer *elems = BSL_SAL_Calloc(num, sizeof(BSL_ASN1_Buffer));
+    if (elems == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    int32_t ret = HITLS_X509_SUCCESS;
+    uint32_t i = 0;
+    BSL_ASN1_Template templ = {g_cmsDigestAlgTempl, sizeof(g_cmsDigestAlgTempl) / sizeof(g_cmsDigestAlgTempl[0])};
+    HITLS_CMS_Digest *digest = BSL_LIST_GET_FIRST(signedData->digests);
+    while (digest != NULL && i < num) {
+        BslOidString *oid = BSL_OBJ_GetOidFromCID(digest->mdId);
+        if (oid == NULL) {
+            ret = HITLS_CMS_ERR_INVALID_ALGO;
+            BSL_ERR_PUSH_ERROR(ret);
+            goto EXIT;
+        }
+        BSL_ASN1_Buffer asn = {BSL_ASN1_TAG_OBJECT_ID, oid->octetLen, (uint8_t *)oid->octs};
+        ret = BSL_ASN1_EncodeTemplate(&templ, &asn, 1, &elems[i].buff, &elems[i].len);
+        if (ret != BSL_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            goto EXIT;
+        }
+        i++;
+        digest = BSL_LIST_GET_NEXT(signedData->digests);
+    }
+    ret = CMS_EncodeSetOf(elems, num, BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, digestAlgs);
+EXIT:
+    CMS_FreeAsnArr(elems, num);
+    return ret;
+}
+
+/* The certificates of the signers, a certificate shared by several signers is carried once. */
+static int32_t CMS_EncodeCerts(HITLS_CMS_SignedData *signedData, BSL_ASN1_Buffer *certs)
+{
+    uint32_t num = (uint32_t)BSL_LIST_COUNT(signedData->signers);
+    BSL_ASN1_Buffer *elems = BSL_SAL_Calloc(num, sizeof(BSL_ASN1_Buffer));
+    if (elems == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    uint32_t count = 0;
+    HITLS_CMS_SignerInfo *signer = BSL_LIST_GET_FIRST(signedData->signers);
+    while (signer != NULL && count < num) {
+        uint32_t i = 0;
+        while (i < count && elems[i].buff != signer->cert->rawData) {
+            i++;
+        }
+        if (i == count) {
+            elems[count].buff = signer->cert->rawData;
+            elems[count].len = signer->cert->rawDataLen;
+            count++;
+        }
+        signer = BSL_LIST_GET_NEXT(signedData->signers);
+    }
+    int32_t ret = CMS_EncodeSetOf(elems, count,
+        BSL_ASN1_CLASS_CTX_SPECIFIC | BSL_ASN1_TAG_CONSTRUCTED | HITLS_CMS_CTX_SPECIFIC_TAG_0, certs);
+    BSL_SAL_Free(elems); // The elements point to the certificates.
+    return ret;
+}
+
+static int32_t CMS_EncodeSignedData(BSL_ASN1_Buffer *digestAlgs, BSL_ASN1_Buffer *certs,
+    BSL_ASN1_Buffer *signerInfos, BSL_Buffer *encode)
+{
+    BslOidString *signedDataOid = BSL_OBJ_GetOidFromCID(BSL_CID_SIGENEDDATA);
+    BslOidString *dataOid = BSL_OBJ_GetOidFromCID(BSL_CID_DATA);
+    if (signedDataOid == NULL || dataOid == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_ALGO);
+        return HITLS_CMS_ERR_INVALID_ALGO;
+    }
+    BSL_ASN1_Buffer encapArr[HITLS_CMS_ENCAPCONTENT_MAX_IDX] = {
+        {BSL_ASN1_TAG_OBJECT_ID, dataOid->octetLen, (uint8_t *)dataOid->octs},
+        {0, 0, NULL}, // The content is detached.
+    };
+    BSL_ASN1_Buffer encap = {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, 0, NULL};
+    BSL_ASN1_Template templ = {g_cmsEncapContentInfoTempl,
+        sizeof(g_cmsEncapContentInfoTempl) / sizeof(g_cmsEncapContentInfoTempl[0])};
+    int32_t ret = BSL_ASN1_EncodeTemplate(&templ, encapArr, HITLS_CMS_ENCAPCONTENT_MAX_IDX, &encap.buff, &encap.len);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    uint8_t version = HITLS_CMS_SIGNEDDATA_VERSION;
+    BSL_ASN1_Buffer asnArr[HITLS_CMS_SIGNEDDATA_MAX_IDX] = {
+        {BSL_ASN1_TAG_OBJECT_ID, signedDataOid->octetLen, (uint8_t *)signedDataOid->octs},
+        {BSL_ASN1_TAG_INTEGER, sizeof(version), &version},
+        *digestAlgs,
+        encap,
+        *certs,
+        {0, 0, NULL},
+        *signerInfos,
+    };
+    templ.templItems = g_cmsSignedDataTempl;
+    templ.templNum = sizeof(g_cmsSignedDataTempl) / sizeof(g_cmsSignedDataTempl[0]);
+    ret = BSL_ASN1_EncodeTemplate(&templ, asnArr, HITLS_CMS_SIGNEDDATA_MAX_IDX, &encode->data, &encode->dataLen);
+    BSL_SAL_Free(encap.buff);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+    }
+    return ret;
+}
+
+int32_t HITLS_CMS_SignedDataSignFinal(HITLS_CMS_SignedData *signedData, BSL_Buffer *encode)
+{
+    if (signedData == NULL || encode == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_NULL_POINTER);
+        return HITLS_CMS_ERR_NULL_POINTER;
+    }
+    if (encode->data != NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_PARAM);
+        return HITLS_CMS_ERR_INVALID_PARAM;
+    }
+    if (signedData->state != HITLS_CMS_SIGNEDDATA_STATE_SIGN) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_STATE);
+        return HITLS_CMS_ERR_STATE;
+    }
+    signedData->state = HITLS_CMS_SIGNEDDATA_STATE_FINAL;
+    int32_t ret = CMS_FinalDigests(signedData);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    BSL_ASN1_Buffer digestAlgs = {0};
+    BSL_ASN1_Buffer certs = {0};
+    BSL_ASN1_Buffer signerInfos = {0};
+    ret = CMS_EncodeSignerInfos(signedData, &signerInfos);
+    if (ret != HITLS_X509_SUCCESS) {
+        goto EXIT;
+    }
+    ret = CMS_EncodeDigestAlgs(signedData, &digestAlgs);
+    if (ret != HITLS_X509_SUCCESS) {
+        goto EXIT;
+    }
+    ret = CMS_EncodeCerts(signedData, &certs);
+    if (ret != HITLS_X509_SUCCESS) {
+        goto EXIT;
+    }
+    ret = CMS_EncodeSignedData(&digestAlgs, &certs, &signerInfos, encode);
+EXIT:
+    BSL_SAL_Free(digestAlgs.buff);
+    BSL_SAL_Free(certs.buff);
+    BSL_SAL_Free(signerInfos.buff);
+    return ret;
+}
+
+static int32_t CMS_ParseSignerInfo(BSL_ASN1_Buffer *asn, HITLS_CMS_SignerInfo *signer)
+{
+    uint8_t *temp = asn->buff;
+    uint32_t tempLen = asn->len;
+    BSL_ASN1_Buffer version = {0};
+    int32_t ret = BSL_ASN1_DecodeItem(&temp, &tempLen, &version);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    // The subjectKeyIdentifier is [0] IMPLICIT, which comes with the version 3.
+    if (tempLen == 0 || *temp != (BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE)) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_UNSUPPORTED_SID);
+        return HITLS_CMS_ERR_UNSUPPORTED_SID;
+    }
+    temp = asn->buff;
+    tempLen = asn->len;
+    BSL_ASN1_Buffer asnArr[HITLS_CMS_SIGNERINFO_MAX_IDX] = {0};
+    BSL_ASN1_Template templ = {g_cmsSignerInfoTempl, sizeof(g_cmsSignerInfoTempl) / sizeof(g_cmsSignerInfoTempl[0])};
+    ret = BSL_ASN1_DecodeTemplate(&templ, CMS_TagGetOrCheck, &temp, &tempLen, asnArr, HITLS_CMS_SIGNERINFO_MAX_IDX);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    if (asnArr[HITLS_CMS_SIGNERINFO_SIGNEDATTRS_IDX].len == 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_NO_SIGNED_ATTRS);
+        return HITLS_CMS_ERR_NO_SIGNED_ATTRS;
+    }
+    BslOidString mdOid = {asnArr[HITLS_CMS_SIGNERINFO_MD_OID_IDX].len,
+        (char *)asnArr[HITLS_CMS_SIGNERINFO_MD_OID_IDX].buff, 0};
+    signer->mdId = BSL_OBJ_GetCIDFromOid(&mdOid);
+    if (signer->mdId == BSL_CID_UNKNOWN || CRYPT_EAL_MdGetDigestSize((CRYPT_MD_AlgId)signer->mdId) == 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_ALGO);
+        return HITLS_CMS_ERR_INVALID_ALGO;
+    }
+    ret = HITLS_X509_ParseSignAlgInfo(&asnArr[HITLS_CMS_SIGNERINFO_SIGNALG_OID_IDX],
+        &asnArr[HITLS_CMS_SIGNERINFO_SIGNALG_PARAM_IDX], &signer->signAlgId);
+    if (ret != HITLS_X509_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    // RFC 3370 section 3.2: rsaEncryption may be used, the digest algorithm of the signer applies then.
+    if (signer->signAlgId.algId == BSL_CID_RSA) {
+        signer->signAlgId.algId = BSL_OBJ_GetSignIdFromHashAndAsymId(BSL_CID_RSA, signer->mdId);
+        if (signer->signAlgId.algId == BSL_CID_UNKNOWN) {
+            BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_ALGO);
+            return HITLS_CMS_ERR_INVALID_ALGO;
+        }
+    }
+    signer->issuer = asnArr[HITLS_CMS_SIGNERINFO_ISSUER_IDX];
+    signer->serialNum = asnArr[HITLS_CMS_SIGNERINFO_SERIAL_IDX];
+    signer->signedAttrs = asnArr[HITLS_CMS_SIGNERINFO_SIGNEDATTRS_IDX];
+    signer->signature = asnArr[HITLS_CMS_SIGNERINFO_SIGNATURE_IDX];
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t CMS_ParseSignerInfoAsnItem(uint32_t layer, BSL_ASN1_Buffer *asn, void *param, BSL_ASN1_List *list)
+{
+    (void)layer;
+    HITLS_CMS_SignerInfo *signer = BSL_SAL_Calloc(1, sizeof(HITLS_CMS_SignerInfo));
+    if (signer == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    int32_t ret = CMS_ParseSignerInfo(asn, signer);
+    if (ret != HITLS_X509_SUCCESS) {
+        BSL_SAL_Free(signer);
+        return ret;
+    }
+    ret = CMS_AddDigest((BslList *)param, signer);
+    if (ret != HITLS_X509_SUCCESS) {
+        BSL_SAL_Free(signer);
+        return ret;
+    }
+    ret = BSL_LIST_AddElement(list, signer, BSL_LIST_POS_END);
+    if (ret != BSL_SUCCESS) {
+        BSL_SAL_Free(signer);
+        BSL_ERR_PUSH_ERROR(ret);
+    }
+    return ret;
+}
+
+static int32_t CMS_ParseEncapContentInfo(BSL_ASN1_Buffer *encap, BSL_ASN1_Buffer *contentType)
+{
+    uint8_t *temp = encap->buff;
+    uint32_t tempLen = encap->len;
+    BSL_ASN1_Buffer asnArr[HITLS_CMS_ENCAPCONTENT_MAX_IDX] = {0};
+    BSL_ASN1_Template templ = {g_cmsEncapContentInfoTempl,
+        sizeof(g_cmsEncapContentInfoTempl) / sizeof(g_cmsEncapContentInfoTempl[0])};
+    int32_t ret = BSL_ASN1_DecodeTemplate(&templ, NULL, &temp, &tempLen, asnArr, HITLS_CMS_ENCAPCONTENT_MAX_IDX);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    if (tempLen != 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_DATA);
+        return HITLS_CMS_ERR_INVALID_DATA;
+    }
+    // Only the detached form is supported.
+    if (asnArr[HITLS_CMS_ENCAPCONTENT_CONTENT_IDX].tag != 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_ATTACHED_CONTENT);
+        return HITLS_CMS_ERR_ATTACHED_CONTENT;
+    }
+    *contentType = asnArr[HITLS_CMS_ENCAPCONTENT_TYPE_IDX];
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t CMS_ParseSignedData(HITLS_CMS_SignedData *signedData)
+{
+    uint8_t *temp = signedData->rawData;
+    uint32_t tempLen = signedData->rawDataLen;
+    BSL_ASN1_Buffer asnArr[HITLS_CMS_SIGNEDDATA_MAX_IDX] = {0};
+    BSL_ASN1_Template templ = {g_cmsSignedDataTempl, sizeof(g_cmsSignedDataTempl) / sizeof(g_cmsSignedDataTempl[0])};
+    int32_t ret = BSL_ASN1_DecodeTemplate(&templ, NULL, &temp, &tempLen, asnArr, HITLS_CMS_SIGNEDDATA_MAX_IDX);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    BslOidString typeOid = {asnArr[HITLS_CMS_SIGNEDDATA_TYPE_IDX].len,
+        (char *)asnArr[HITLS_CMS_SIGNEDDATA_TYPE_IDX].buff, 0};
+    if (BSL_OBJ_GetCIDFromOid(&typeOid) != BSL_CID_SIGENEDDATA) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_PARSE_TYPE);
+        return HITLS_CMS_ERR_PARSE_TYPE;
+    }
+    ret = CMS_ParseEncapContentInfo(&asnArr[HITLS_CMS_SIGNEDDATA_ENCAPCONTENT_IDX], &signedData->contentType);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    if (asnArr[HITLS_CMS_SIGNEDDATA_CERTS_IDX].len != 0) {
+        BSL_Buffer certs = {asnArr[HITLS_CMS_SIGNEDDATA_CERTS_IDX].buff, asnArr[HITLS_CMS_SIGNEDDATA_CERTS_IDX].len};
+        ret = HITLS_X509_CertMulParseBuff(BSL_FORMAT_ASN1, &certs, &signedData->certs);
+        if (ret != HITLS_X509_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+    }
+    uint8_t expTag = BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE;
+    BSL_ASN1_DecodeListParam listParam = {1, &expTag};
+    ret = BSL_ASN1_DecodeListItem(&listParam, &asnArr[HITLS_CMS_SIGNEDDATA_SIGNERINFOS_IDX],
+        CMS_ParseSignerInfoAsnItem, signedData->digests, signedData->signers);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    if (BSL_LIST_COUNT(signedData->signers) == 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_NO_SIGNER);
+        return HITLS_CMS_ERR_NO_SIGNER;
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+int32_t HITLS_CMS_SignedDataVerifyInit(HITLS_CMS_SignedData *signedData, const BSL_Buffer *encode)
+{
+    if (signedData == NULL || encode == NULL || encode->data == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_NULL_POINTER);
+        return HITLS_CMS_ERR_NULL_POINTER;
+    }
+    if (encode->dataLen == 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_DATA);
+        return HITLS_CMS_ERR_INVALID_DATA;
+    }
+    if (signedData->state != HITLS_CMS_SIGNEDDATA_STATE_NEW || BSL_LIST_COUNT(signedData->signers) != 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_STATE);
+        return HITLS_CMS_ERR_STATE;
+    }
+    signedData->rawData = BSL_SAL_Dump(encode->data, encode->dataLen);
+    if (signedData->rawData == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_DUMP_FAIL);
+        return BSL_DUMP_FAIL;
+    }
+    signedData->rawDataLen = encode->dataLen;
+    int32_t ret = CMS_ParseSignedData(signedData);
+    if (ret != HITLS_X509_SUCCESS) {
+        CMS_SignedDataClear(signedData);
+        return ret;
+    }
+    HITLS_CMS_Digest *digest = BSL_LIST_GET_FIRST(signedData->digests);
+    while (digest != NULL) {
+        ret = CRYPT_EAL_MdInit(digest->mdCtx);
+        if (ret != CRYPT_SUCCESS) {
+            CMS_SignedDataClear(signedData);
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+        digest = BSL_LIST_GET_NEXT(signedData->digests);
+    }
+    signedData->state = HITLS_CMS_SIGNEDDATA_STATE_VERIFY;
+    return HITLS_X509_SUCCESS;
+}
+
+int32_t HITLS_CMS_SignedDataVerifyUpdate(HITLS_CMS_SignedData *signedData, const uint8_t *data, uint32_t dataLen)
+{
+    return CMS_UpdateDigests(signedData, HITLS_CMS_SIGNEDDATA_STATE_VERIFY, data, dataLen);
+}
+
+/* RFC 5652 section 5.6: the contentType and messageDigest attributes must be present, once each. */
+static int32_t CMS_CheckSignedAttrs(HITLS_CMS_SignedData *signedData, HITLS_CMS_SignerInfo *signer)
+{
+    bool hasContentType = false;
+    bool hasMessageDigest = false;
+    uint8_t *temp = signer->signedAttrs.buff;
+    uint32_t tempLen = signer->signedAttrs.len;
+    BSL_ASN1_Template templ = {g_cmsAttrTempl, sizeof(g_cmsAttrTempl) / sizeof(g_cmsAttrTempl[0])};
+    while (tempLen > 0) {
+        BSL_ASN1_Buffer asnArr[HITLS_CMS_ATTR_MAX_IDX] = {0};
+        int32_t ret = BSL_ASN1_DecodeTemplate(&templ, NULL, &temp, &tempLen, asnArr, HITLS_CMS_ATTR_MAX_IDX);
+        if (ret != BSL_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+        BslOidString oid = {asnArr[HITLS_CMS_ATTR_OID_IDX].len, (char *)asnArr[HITLS_CMS_ATTR_OID_IDX].buff, 0};
+        BslCid cid = BSL_OBJ_GetCIDFromOid(&oid);
+        if (cid != BSL_CID_CONTENTTYPE && cid != BSL_CID_MESSAGEDIGEST) {
+            continue;
+        }
+        bool *found = cid == BSL_CID_CONTENTTYPE ? &hasContentType : &hasMessageDigest;
+        uint8_t tag = cid == BSL_CID_CONTENTTYPE ? BSL_ASN1_TAG_OBJECT_ID : BSL_ASN1_TAG_OCTETSTRING;
+        const uint8_t *exp = cid == BSL_CID_CONTENTTYPE ? signedData->contentType.buff : signer->digest->digest;
+        uint32_t expLen = cid == BSL_CID_CONTENTTYPE ? signedData->contentType.len : signer->digest->digestLen;
+        uint8_t *value = asnArr[HITLS_CMS_ATTR_VALUES_IDX].buff;
+        uint32_t valueLen = asnArr[HITLS_CMS_ATTR_VALUES_IDX].len;
+        uint32_t len = 0;
+        ret = BSL_ASN1_DecodeTagLen(tag, &value, &valueLen, &len);
+        if (ret != BSL_SUCCESS || *found || len != valueLen) { // A single value is allowed.
+            BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_DATA);
+            return HITLS_CMS_ERR_INVALID_DATA;
+        }
+        if (len != expLen || memcmp(value, exp, len) != 0) {
+            ret = cid == BSL_CID_CONTENTTYPE ? HITLS_CMS_ERR_CONTENT_TYPE : HITLS_CMS_ERR_DIGEST_MISMATCH;
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+        *found = true;
+    }
+    if (!hasContentType || !hasMessageDigest) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_INVALID_DATA);
+        return HITLS_CMS_ERR_INVALID_DATA;
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+static HITLS_X509_Cert *CMS_FindSignerCert(HITLS_X509_List *certs, HITLS_CMS_SignerInfo *signer)
+{
+    HITLS_X509_Cert *cert = BSL_LIST_GET_FIRST(certs);
+    while (cert != NULL) {
+        if (cert->tbs.serialNum.len == signer->serialNum.len &&
+            cert->tbs.issuerAsn.len == signer->issuer.len &&
+            memcmp(cert->tbs.serialNum.buff, signer->serialNum.buff, signer->serialNum.len) == 0 &&
+            memcmp(cert->tbs.issuerAsn.buff, signer->issuer.buff, signer->issuer.len) == 0) {
+            return cert;
+        }
+        cert = BSL_LIST_GET_NEXT(certs);
+    }
+    return NULL;
+}
+
+static int32_t CMS_VerifySignerInfo(HITLS_CMS_SignedData *signedData, HITLS_X509_List *certs,
+    HITLS_CMS_SignerInfo *signer)
+{
+    int32_t ret = CMS_CheckSignedAttrs(signedData, signer);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    HITLS_X509_Cert *cert = CMS_FindSignerCert(certs, signer);
+    if (cert == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_SIGNER_NOT_FOUND);
+        return HITLS_CMS_ERR_SIGNER_NOT_FOUND;
+    }
+    ret = HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_PUBKEY);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    ret = HITLS_X509_CheckAlg(cert->tbs.ealPubKey, &signer->signAlgId);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    // The signature is computed over the signed attributes with the tag of SET instead of [0] IMPLICIT.
+    BSL_ASN1_TemplateItem attrsItem = {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, BSL_ASN1_FLAG_HEADERONLY, 0};
+    BSL_ASN1_Template templ = {&attrsItem, 1};
+    BSL_ASN1_Buffer attrs = {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SET, signer->signedAttrs.len,
+        signer->signedAttrs.buff};
+    BSL_Buffer raw = {0};
+    ret = BSL_ASN1_EncodeTemplate(&templ, &attrs, 1, &raw.data, &raw.dataLen);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    BSL_ASN1_BitString signature = {signer->signature.buff, signer->signature.len, 0};
+    ret = HITLS_X509_CheckSignature(cert->tbs.ealPubKey, raw.data, raw.dataLen, &signer->signAlgId, &signature);
+    BSL_SAL_Free(raw.data);
+    return ret;
+}
+
+int32_t HITLS_CMS_SignedDataVerifyFinal(HITLS_CMS_SignedData *signedData, HITLS_X509_List *certs)
+{
+    if (signedData == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_NULL_POINTER);
+        return HITLS_CMS_ERR_NULL_POINTER;
+    }
+    if (signedData->state != HITLS_CMS_SIGNEDDATA_STATE_VERIFY) {
+        BSL_ERR_PUSH_ERROR(HITLS_CMS_ERR_STATE);
+        return HITLS_CMS_ERR_STATE;
+    }
+    signedData->state = HITLS_CMS_SIGNEDDATA_STATE_FINAL;
+    int32_t ret = CMS_FinalDigests(signedData);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    HITLS_X509_List *signerCerts = certs != NULL ? certs : signedData->certs;
+    HITLS_CMS_SignerInfo *signer = BSL_LIST_GET_FIRST(signedData->signers);
+    while (signer != NULL) {
+        ret = CMS_VerifySignerInfo(signedData, signerCerts, signer);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
+        signer = BSL_LIST_GET_NEXT(signedData->signers);
+    }
+    return HITLS_X509_SUCCESS;
+}
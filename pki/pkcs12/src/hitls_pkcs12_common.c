@@ -252,11 +252,10 @@ err:
 }
 
 static int32_t ParsePKCS8ShroudedKeyBags(HITLS_PKCS12 *p12, const uint8_t *pwd, uint32_t pwdlen,
-    HITLS_PKCS12_SafeBag *safeBag)
+    CRYPT_DeriveKeyCache *keyCache, HITLS_PKCS12_SafeBag *safeBag)
 {
     CRYPT_EAL_PkeyCtx *prikey = NULL;
-    int32_t ret = CRYPT_EAL_DecodeBuffKey(BSL_FORMAT_ASN1, CRYPT_PRIKEY_PKCS8_ENCRYPT,
-        safeBag->bag, pwd, pwdlen, &prikey);
+    int32_t ret = CRYPT_EAL_ParseAsn1Pk8EncPriKey(safeBag->bag, pwd, pwdlen, keyCache, &prikey);
     if (ret != HITLS_X509_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
         return ret;
@@ -308,9 +307,8 @@ static int32_t ParseCertBagAndAddList(HITLS_PKCS12 *p12, HITLS_PKCS12_SafeBag *s
     return ret;
 }
 
-/* Parse a SafeBag to the data we need, such as a private key, etc */
-int32_t HITLS_PKCS12_ConvertSafeBag(HITLS_PKCS12_SafeBag *safeBag, const uint8_t *pwd, uint32_t pwdlen,
-    HITLS_PKCS12 *p12)
+static int32_t ConvertSafeBag(HITLS_PKCS12_SafeBag *safeBag, const uint8_t *pwd, uint32_t pwdlen,
+    CRYPT_DeriveKeyCache *keyCache, HITLS_PKCS12 *p12)
 {
     if (safeBag == NULL) {
         BSL_ERR_PUSH_ERROR(HITLS_PKCS12_ERR_NULL_POINTER);
@@ -321,7 +319,7 @@ int32_t HITLS_PKCS12_ConvertSafeBag(HITLS_PKCS12_SafeBag *safeBag, const uint8_t
             if (p12->key != NULL) {
                 return HITLS_X509_SUCCESS;
             }
-            return ParsePKCS8ShroudedKeyBags(p12, pwd, pwdlen, safeBag);
+            return ParsePKCS8ShroudedKeyBags(p12, pwd, pwdlen, keyCache, safeBag);
         case BSL_CID_CERTBAG:
             return ParseCertBagAndAddList(p12, safeBag);
         default:
@@ -330,6 +328,13 @@ int32_t HITLS_PKCS12_ConvertSafeBag(HITLS_PKCS12_SafeBag *safeBag, const uint8_t
     }
 }
 
+/* Parse a SafeBag to the data we need, such as a private key, etc */
+int32_t HITLS_PKCS12_ConvertSafeBag(HITLS_PKCS12_SafeBag *safeBag, const uint8_t *pwd, uint32_t pwdlen,
+    HITLS_PKCS12 *p12)
+{
+    return ConvertSafeBag(safeBag, pwd, pwdlen, NULL, p12);
+}
+
 /*
  * Defined in RFC 2531
  * ContentInfo ::= SEQUENCE {
@@ -351,7 +356,8 @@ typedef enum {
     HITLS_PKCS12_CONTENT_MAX_IDX,
 } HITLS_PKCS12_CONTENT_IDX;
 
-int32_t HITLS_PKCS12_ParseContentInfo(BSL_Buffer *encode, const uint8_t *password, uint32_t passLen, BSL_Buffer *data)
+static int32_t ParseContentInfo(BSL_Buffer *encode, const uint8_t *password, uint32_t passLen,
+    CRYPT_DeriveKeyCache *keyCache, BSL_Buffer *data)
 {
     uint8_t *temp = encode->data;
     uint32_t tempLen = encode->dataLen;
@@ -374,16 +380,20 @@ int32_t HITLS_PKCS12_ParseContentInfo(BSL_Buffer *encode, const uint8_t *passwor
         case BSL_CID_DATA:
             return HITLS_CMS_ParseAsn1Data(&asnArrData, data);
         case BSL_CID_ENCRYPTEDDATA:
-            return CRYPT_EAL_ParseAsn1PKCS7EncryptedData(&asnArrData, password, passLen, data);
+            return CRYPT_EAL_ParseAsn1PKCS7EncryptedDataEx(&asnArrData, password, passLen, keyCache, data);
         default:
             BSL_ERR_PUSH_ERROR(HITLS_PKCS12_ERR_INVALID_SAFEBAG_TYPE);
             return HITLS_PKCS12_ERR_INVALID_SAFEBAG_TYPE;
     }
 }
 
-/* Parse each safeBag from list, and extract the data we need, such as a private key, etc */
-int32_t HITLS_PKCS12_ParseSafeBagList(BSL_ASN1_List *bagList, const uint8_t *password,
-    uint32_t passLen, HITLS_PKCS12 *p12)
+int32_t HITLS_PKCS12_ParseContentInfo(BSL_Buffer *encode, const uint8_t *password, uint32_t passLen, BSL_Buffer *data)
+{
+    return ParseContentInfo(encode, password, passLen, NULL, data);
+}
+
+static int32_t ParseSafeBagListEx(BSL_ASN1_List *bagList, const uint8_t *password, uint32_t passLen,
+    CRYPT_DeriveKeyCache *keyCache, HITLS_PKCS12 *p12)
 {
     if (BSL_LIST_COUNT(bagList) == 0) {
         return HITLS_X509_SUCCESS;
@@ -391,7 +401,7 @@ int32_t HITLS_PKCS12_ParseSafeBagList(BSL_ASN1_List *bagList, const uint8_t *pas
     int32_t ret;
     HITLS_PKCS12_SafeBag *node = BSL_LIST_GET_FIRST(bagList);
     while (node != NULL) {
-        ret = HITLS_PKCS12_ConvertSafeBag(node, password, passLen, p12);
+        ret = ConvertSafeBag(node, password, passLen, keyCache, p12);
         if (ret != HITLS_X509_SUCCESS) {
             BSL_ERR_PUSH_ERROR(ret);
             return ret;
@@ -401,6 +411,13 @@ int32_t HITLS_PKCS12_ParseSafeBagList(BSL_ASN1_List *bagList, const uint8_t *pas
     return HITLS_X509_SUCCESS;
 }
 
+/* Parse each safeBag from list, and extract the data we need, such as a private key, etc */
+int32_t HITLS_PKCS12_ParseSafeBagList(BSL_ASN1_List *bagList, const uint8_t *password,
+    uint32_t passLen, HITLS_PKCS12 *p12)
+{
+    return ParseSafeBagListEx(bagList, password, passLen, NULL, p12);
+}
+
 static BSL_Buffer *FindLocatedId(HITLS_X509_Attrs *attributes)
 {
     if (attributes == NULL) {
@@ -451,10 +468,11 @@ static int32_t SetEntityCert(HITLS_PKCS12 *p12)
     return HITLS_PKCS12_ERR_NO_ENTITYCERT;
 }
 
-static int32_t ParseSafeBagList(BSL_Buffer *node, const uint8_t *password, uint32_t passLen, BSL_ASN1_List *bagLists)
+static int32_t ParseSafeBagList(BSL_Buffer *node, const uint8_t *password, uint32_t passLen,
+    CRYPT_DeriveKeyCache *keyCache, BSL_ASN1_List *bagLists)
 {
     BSL_Buffer safeContent = {0};
-    int32_t ret = HITLS_PKCS12_ParseContentInfo(node, password, passLen, &safeContent);
+    int32_t ret = ParseContentInfo(node, password, passLen, keyCache, &safeContent);
     if (ret != HITLS_X509_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
         return ret;
@@ -473,6 +491,7 @@ int32_t HITLS_PKCS12_ParseAuthSafeData(BSL_Buffer *encode, const uint8_t *passwo
 {
     BSL_ASN1_List *bagLists = NULL;
     BSL_Buffer *node = NULL;
+    CRYPT_DeriveKeyCache *keyCache = NULL;
     BSL_ASN1_List *contentList = BSL_LIST_New(sizeof(BSL_Buffer));
     if (contentList == NULL) {
         BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
@@ -483,6 +502,12 @@ int32_t HITLS_PKCS12_ParseAuthSafeData(BSL_Buffer *encode, const uint8_t *passwo
         BSL_ERR_PUSH_ERROR(ret);
         goto err;
     }
+    // The contents and the key bags protected with the same password and PBES2 parameters derive the key once.
+    keyCache = CRYPT_DeriveKeyCacheNew();
+    if (keyCache == NULL) {
+        ret = BSL_MALLOC_FAIL;
+        goto err;
+    }
 
     bagLists = BSL_LIST_New(sizeof(HITLS_PKCS12_SafeBag));
     if (bagLists == NULL) {
@@ -493,18 +518,19 @@ int32_t HITLS_PKCS12_ParseAuthSafeData(BSL_Buffer *encode, const uint8_t *passwo
 
     node = BSL_LIST_GET_FIRST(contentList);
     while (node != NULL) {
-        ret = ParseSafeBagList(node, password, passLen, bagLists);
+        ret = ParseSafeBagList(node, password, passLen, keyCache, bagLists);
         if (ret != HITLS_X509_SUCCESS) {
             goto err;
         }
         node = BSL_LIST_GET_NEXT(contentList);
     }
-    ret = HITLS_PKCS12_ParseSafeBagList(bagLists, password, passLen, p12);
+    ret = ParseSafeBagListEx(bagLists, password, passLen, keyCache, p12);
     if (ret != HITLS_X509_SUCCESS) {
         goto err;
     }
     ret = SetEntityCert(p12);
 err:
+    CRYPT_DeriveKeyCacheFree(keyCache);
     BSL_LIST_DeleteAll(bagLists, (BSL_LIST_PFUNC_FREE)HITLS_PKCS12_SafeBagFree);
     BSL_SAL_FREE(bagLists);
     BSL_LIST_DeleteAll(contentList, NULL);
@@ -714,8 +740,189 @@ static int32_t ParseMacDataAndVerify(BSL_Buffer *initData, BSL_Buffer *macData,
     return HITLS_X509_SUCCESS;
 }
 
+#if defined(HITLS_BSL_SAL_THREAD) && defined(HITLS_BSL_SAL_LOCK)
+typedef struct {
+    BSL_Buffer *content;        // NULL marks the MAC verification
+    BSL_ASN1_List *bagList;
+    int32_t ret;
+} PKCS12_ParseTask;
+
+typedef struct {
+    PKCS12_ParseTask *tasks;
+    uint32_t num;
+    uint32_t next;              // The next task to be claimed by a worker, protected by lock.
+    const HITLS_PKCS12_PwdParam *pwdParam;
+    BSL_Buffer *initData;
+    BSL_Buffer *macData;
+    HITLS_PKCS12_MacData *p12Mac;
+    CRYPT_DeriveKeyCache *keyCache;
+    BSL_SAL_ThreadLockHandle lock;
+} PKCS12_ParseJob;
+
+static void PKCS12_RunParseTask(PKCS12_ParseJob *job, PKCS12_ParseTask *task)
+{
+    if (task->content == NULL) {
+        task->ret = ParseMacDataAndVerify(job->initData, job->macData, job->pwdParam, job->p12Mac);
+        return;
+    }
+    task->bagList = BSL_LIST_New(sizeof(HITLS_PKCS12_SafeBag));
+    if (task->bagList == NULL) {
+        task->ret = BSL_MALLOC_FAIL;
+        return;
+    }
+    task->ret = ParseSafeBagList(task->content, job->pwdParam->encPwd->data, job->pwdParam->encPwd->dataLen,
+        job->keyCache, task->bagList);
+}
+
+static void *PKCS12_ParseWorker(void *arg)
+{
+    PKCS12_ParseJob *job = (PKCS12_ParseJob *)arg;
+    while (true) {
+        (void)BSL_SAL_ThreadWriteLock(job->lock);
+        uint32_t idx = job->next++;
+        (void)BSL_SAL_ThreadUnlock(job->lock);
+        if (idx >= job->num) {
+            break;
+        }
+        PKCS12_RunParseTask(job, &job->tasks[idx]);
+    }
+    return NULL;
+}
+
+static void *PKCS12_ParseThread(void *arg)
+{
+    (void)PKCS12_ParseWorker(arg);
+    // Errors pushed on this thread are not visible to the caller, the merge reports them instead.
+    BSL_ERR_RemoveErrorStack(false);
+    return NULL;
+}
+
+/* The caller thread takes part in the parsing, so threadNum - 1 threads are started at most. */
+static void PKCS12_RunParseJob(PKCS12_ParseJob *job, uint32_t threadNum)
+{
+    uint32_t num = (threadNum > job->num) ? job->num : threadNum;
+    BSL_SAL_ThreadId *threads = (num > 1) ? BSL_SAL_Calloc(num - 1, sizeof(BSL_SAL_ThreadId)) : NULL;
+    uint32_t started = 0;
+    if (threads != NULL && BSL_SAL_ThreadLockNew(&job->lock) == BSL_SUCCESS) {
+        for (; started < num - 1; started++) {
+            if (BSL_SAL_ThreadCreate(&threads[started], PKCS12_ParseThread, job) != BSL_SUCCESS) {
+                break;
+            }
+        }
+    }
+    (void)PKCS12_ParseWorker(job);
+    for (uint32_t i = 0; i < started; i++) {
+        BSL_SAL_ThreadClose(threads[i]);
+    }
+    BSL_SAL_ThreadLockFree(job->lock);
+    job->lock = NULL;
+    BSL_SAL_Free(threads);
+}
+
+/*
+ * The results are used in the serial order: the MAC first, then the contents. The key bags are converted on the
+ * caller thread, only the first one is decrypted.
+ */
+static int32_t PKCS12_MergeParseJob(PKCS12_ParseJob *job, HITLS_PKCS12 *p12)
+{
+    for (uint32_t i = 0; i < job->num; i++) {
+        if (job->tasks[i].ret != HITLS_X509_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(job->tasks[i].ret);
+            return job->tasks[i].ret;
+        }
+    }
+    for (uint32_t i = 0; i < job->num; i++) {
+        if (job->tasks[i].content == NULL) {
+            continue;
+        }
+        int32_t ret = ParseSafeBagListEx(job->tasks[i].bagList, job->pwdParam->encPwd->data,
+            job->pwdParam->encPwd->dataLen, job->keyCache, p12);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
+    }
+    return SetEntityCert(p12);
+}
+
+static int32_t PKCS12_InitParseJob(BSL_ASN1_List *contentList, bool needMacVerify, PKCS12_ParseJob *job)
+{
+    uint32_t num = (uint32_t)BSL_LIST_COUNT(contentList) + (needMacVerify ? 1 : 0);
+    job->tasks = BSL_SAL_Calloc(num, sizeof(PKCS12_ParseTask));
+    if (job->tasks == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    job->num = num;
+    uint32_t idx = needMacVerify ? 1 : 0;
+    for (BSL_Buffer *node = BSL_LIST_GET_FIRST(contentList); node != NULL; node = BSL_LIST_GET_NEXT(contentList)) {
+        job->tasks[idx++].content = node;
+    }
+    job->keyCache = CRYPT_DeriveKeyCacheNew();
+    if (job->keyCache == NULL) {
+        return BSL_MALLOC_FAIL;
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+/* The MAC verification and the decryption of each content run as independent tasks on up to threadNum threads. */
+static int32_t ParseAuthSafeParallel(BSL_Buffer *initData, BSL_Buffer *macData, const HITLS_PKCS12_PwdParam *pwdParam,
+    bool needMacVerify, uint32_t threadNum, HITLS_PKCS12 *p12)
+{
+    PKCS12_ParseJob job = {0};
+    job.pwdParam = pwdParam;
+    job.initData = initData;
+    job.macData = macData;
+    job.p12Mac = p12->macData;
+    BSL_ASN1_List *contentList = BSL_LIST_New(sizeof(BSL_Buffer));
+    if (contentList == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    int32_t ret = HITLS_PKCS12_ParseAsn1AddList(initData, contentList, BSL_CID_CONTENTINFO);
+    if (ret != HITLS_X509_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        goto EXIT;
+    }
+    ret = PKCS12_InitParseJob(contentList, needMacVerify, &job);
+    if (ret != HITLS_X509_SUCCESS) {
+        goto EXIT;
+    }
+    PKCS12_RunParseJob(&job, threadNum);
+    ret = PKCS12_MergeParseJob(&job, p12);
+EXIT:
+    for (uint32_t i = 0; i < job.num; i++) {
+        BSL_LIST_DeleteAll(job.tasks[i].bagList, (BSL_LIST_PFUNC_FREE)HITLS_PKCS12_SafeBagFree);
+        BSL_SAL_Free(job.tasks[i].bagList);
+    }
+    BSL_SAL_Free(job.tasks);
+    CRYPT_DeriveKeyCacheFree(job.keyCache);
+    BSL_LIST_DeleteAll(contentList, NULL);
+    BSL_SAL_Free(contentList);
+    return ret;
+}
+#endif
+
+static int32_t ParseAuthSafe(BSL_Buffer *initData, BSL_Buffer *macData, const HITLS_PKCS12_PwdParam *pwdParam,
+    bool needMacVerify, uint32_t threadNum, HITLS_PKCS12 *p12)
+{
+#if defined(HITLS_BSL_SAL_THREAD) && defined(HITLS_BSL_SAL_LOCK)
+    if (threadNum > 1) {
+        return ParseAuthSafeParallel(initData, macData, pwdParam, needMacVerify, threadNum, p12);
+    }
+#else
+    (void)threadNum;
+#endif
+    if (needMacVerify) {
+        int32_t ret = ParseMacDataAndVerify(initData, macData, pwdParam, p12->macData);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret; // has pushed error code.
+        }
+    }
+    return HITLS_PKCS12_ParseAuthSafeData(initData, pwdParam->encPwd->data, pwdParam->encPwd->dataLen, p12);
+}
+
 static int32_t ParseAsn1PKCS12(BSL_Buffer *encode, const HITLS_PKCS12_PwdParam *pwdParam,
-    HITLS_PKCS12 *p12, bool needMacVerify)
+    HITLS_PKCS12 *p12, bool needMacVerify, uint32_t threadNum)
 {
     uint32_t version = 0;
     uint8_t *temp = encode->data;
@@ -746,14 +953,7 @@ static int32_t ParseAsn1PKCS12(BSL_Buffer *encode, const HITLS_PKCS12_PwdParam *
     if (ret != HITLS_X509_SUCCESS) {
         return ret; // has pushed error code.
     }
-    if (needMacVerify) {
-        ret = ParseMacDataAndVerify(&initData, &macData, pwdParam, p12Mac);
-        if (ret != HITLS_X509_SUCCESS) {
-            BSL_SAL_Free(initData.data);
-            return ret; // has pushed error code.
-        }
-    }
-    ret = HITLS_PKCS12_ParseAuthSafeData(&initData, pwdParam->encPwd->data, pwdParam->encPwd->dataLen, p12);
+    ret = ParseAuthSafe(&initData, &macData, pwdParam, needMacVerify, threadNum, p12);
     BSL_SAL_Free(initData.data);
     if (ret != HITLS_X509_SUCCESS) {
         ClearMacData(p12Mac);
@@ -763,8 +963,8 @@ static int32_t ParseAsn1PKCS12(BSL_Buffer *encode, const HITLS_PKCS12_PwdParam *
     return HITLS_X509_SUCCESS;
 }
 
-int32_t HITLS_PKCS12_ParseBuff(int32_t format, BSL_Buffer *encode, const HITLS_PKCS12_PwdParam *pwdParam,
-    HITLS_PKCS12 **p12, bool needMacVerify)
+int32_t HITLS_PKCS12_ParseBuffEx(int32_t format, BSL_Buffer *encode, const HITLS_PKCS12_PwdParam *pwdParam,
+    HITLS_PKCS12 **p12, bool needMacVerify, uint32_t threadNum)
 {
     if (encode == NULL || encode->data == NULL || encode->dataLen == 0 ||
         pwdParam == NULL || pwdParam->encPwd == NULL || pwdParam->encPwd->data == NULL || p12 == NULL) {
@@ -783,7 +983,7 @@ int32_t HITLS_PKCS12_ParseBuff(int32_t format, BSL_Buffer *encode, const HITLS_P
     }
     switch (format) {
         case BSL_FORMAT_ASN1:
-            ret = ParseAsn1PKCS12(encode, pwdParam, temP12, needMacVerify);
+            ret = ParseAsn1PKCS12(encode, pwdParam, temP12, needMacVerify, threadNum);
             break;
         default:
             ret = HITLS_PKCS12_ERR_NOT_SUPPORT_FORMAT;
@@ -798,6 +998,12 @@ int32_t HITLS_PKCS12_ParseBuff(int32_t format, BSL_Buffer *encode, const HITLS_P
     return HITLS_X509_SUCCESS;
 }
 
+int32_t HITLS_PKCS12_ParseBuff(int32_t format, BSL_Buffer *encode, const HITLS_PKCS12_PwdParam *pwdParam,
+    HITLS_PKCS12 **p12, bool needMacVerify)
+{
+    return HITLS_PKCS12_ParseBuffEx(format, encode, pwdParam, p12, needMacVerify, 1);
+}
+
 int32_t HITLS_PKCS12_ParseFile(int32_t format, const char *path, const HITLS_PKCS12_PwdParam *pwdParam,
     HITLS_PKCS12 **p12, bool needMacVerify)
 {
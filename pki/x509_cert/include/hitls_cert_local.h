@@ -40,8 +40,20 @@ typedef struct {
 
     void *ealPubKey;
     HITLS_X509_Ext ext;
+
+    /* Encodings of the parts that a lazy parse leaves undecoded, they point into the rawData of the cert. */
+    BSL_ASN1_Buffer issuerAsn;
+    BSL_ASN1_Buffer subjectAsn;
+    BSL_ASN1_Buffer pubKeyAsn;
+    BSL_ASN1_Buffer extAsn;
 } HITLS_X509_CertTbs;
 
+/* Parts of a lazily parsed certificate which are decoded on first access. */
+#define HITLS_X509_CERT_LAZY_NAME   0x01 // issuer and subject name lists
+#define HITLS_X509_CERT_LAZY_PUBKEY 0x02 // subject public key
+#define HITLS_X509_CERT_LAZY_EXT    0x04 // extensions
+#define HITLS_X509_CERT_LAZY_ALL    (HITLS_X509_CERT_LAZY_NAME | HITLS_X509_CERT_LAZY_PUBKEY | HITLS_X509_CERT_LAZY_EXT)
+
 typedef enum {
     HITLS_X509_CERT_STATE_NEW = 0,
     HITLS_X509_CERT_STATE_SET,
@@ -52,6 +64,7 @@ typedef enum {
 typedef struct _HITLS_X509_Cert {
     uint8_t flag; // Used to mark certificate parsing or generation, indicating resource release behavior.
     uint8_t state;
+    uint8_t lazyParts; // HITLS_X509_CERT_LAZY_XXX parts which are recorded but not decoded yet
 
     uint8_t *rawData;
     uint32_t rawDataLen;
@@ -60,12 +73,33 @@ typedef struct _HITLS_X509_Cert {
     BSL_ASN1_BitString signature;
 
     BSL_SAL_RefCount references;
+    BSL_SAL_ThreadLockHandle lazyLock; // serializes HITLS_X509_CertLoad, only created for lazily parsed certs
 } HITLS_X509_Cert;
 
 int32_t HITLS_X509_CheckIssued(HITLS_X509_Cert *issue, HITLS_X509_Cert *subject, bool *res);
 bool HITLS_X509_CertIsCA(HITLS_X509_Cert *cert);
 int32_t HITLS_X509_CertMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X509_List **certlist);
 
+/**
+ * Decode the given HITLS_X509_CERT_LAZY_XXX parts of a lazily parsed certificate, if not done yet.
+ * A lazily parsed certificate may be shared by threads through a store, so the decoding is done under the lazyLock
+ * of the certificate, the decoded parts are not changed afterwards.
+ */
+int32_t HITLS_X509_CertLoad(HITLS_X509_Cert *cert, uint8_t parts);
+
+/**
+ * Parse a certificate bundle lazily: only the DER structure, version, serial number, signature algorithms and
+ * validity are decoded, names, public key and extensions are decoded by HITLS_X509_CertLoad on first access.
+ */
+int32_t HITLS_X509_CertMulParseBuffLazy(int32_t format, BSL_Buffer *encode, HITLS_X509_List **certlist);
+
+/**
+ * Parse a certificate bundle on up to threadNum threads. The extensions are decoded by the workers as well since
+ * every CA is checked for them, names and public key are left for first access as in HITLS_X509_CertMulParseBuffLazy.
+ */
+int32_t HITLS_X509_CertMulParseBuffParallel(int32_t format, BSL_Buffer *encode, uint32_t threadNum,
+    HITLS_X509_List **certlist);
+
 #ifdef __cplusplus
 }
 #endif
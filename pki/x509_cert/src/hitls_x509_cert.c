@@ -183,6 +183,7 @@ void HITLS_X509_CertFree(HITLS_X509_Cert *cert)
     X509_ExtFree(&cert->tbs.ext, false);
     BSL_SAL_FREE(cert->rawData);
     CRYPT_EAL_PkeyFreeCtx(cert->tbs.ealPubKey);
+    BSL_SAL_ThreadLockFree(cert->lazyLock);
     BSL_SAL_ReferencesFree(&(cert->references));
     BSL_SAL_Free(cert);
 }
@@ -223,6 +224,106 @@ ERR:
     return NULL;
 }
 
+static int32_t X509_CertDecodeName(HITLS_X509_Cert *cert)
+{
+    int32_t ret = HITLS_X509_ParseNameList(&cert->tbs.issuerAsn, cert->tbs.issuerName);
+    if (ret != HITLS_X509_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        goto ERR;
+    }
+    ret = HITLS_X509_ParseNameList(&cert->tbs.subjectAsn, cert->tbs.subjectName);
+    if (ret != HITLS_X509_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        goto ERR;
+    }
+    return ret;
+ERR:
+    BSL_LIST_DeleteAll(cert->tbs.issuerName, NULL);
+    BSL_LIST_DeleteAll(cert->tbs.subjectName, NULL);
+    return ret;
+}
+
+static int32_t X509_CertDecodePubKey(HITLS_X509_Cert *cert)
+{
+    int32_t ret = CRYPT_EAL_ParseAsn1SubPubkey(cert->tbs.pubKeyAsn.buff, cert->tbs.pubKeyAsn.len,
+        &cert->tbs.ealPubKey, false);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+    }
+    return ret;
+}
+
+static int32_t X509_CertDecodeExt(HITLS_X509_Cert *cert)
+{
+    int32_t ret = HITLS_X509_ParseExt(&cert->tbs.extAsn, &cert->tbs.ext);
+    if (ret != HITLS_X509_SUCCESS) {
+        // The extensions decoded before the failure have already been recorded in extData.
+        (void)memset_s(cert->tbs.ext.extData, sizeof(HITLS_X509_CertExt), 0, sizeof(HITLS_X509_CertExt));
+        BSL_ERR_PUSH_ERROR(ret);
+    }
+    return ret;
+}
+
+static void X509_CertPartsLoaded(HITLS_X509_Cert *cert, uint8_t part)
+{
+#ifdef HITLS_X509_LAZY_STORE
+    HITLS_X509_LAZY_STORE(&cert->lazyParts, (uint8_t)(cert->lazyParts & ~part));
+#else
+    cert->lazyParts &= (uint8_t)~part;
+#endif
+}
+
+static int32_t X509_CertLoadParts(HITLS_X509_Cert *cert, uint8_t parts)
+{
+    int32_t ret;
+    uint8_t todo = cert->lazyParts & parts;
+    if ((todo & HITLS_X509_CERT_LAZY_NAME) != 0) {
+        ret = X509_CertDecodeName(cert);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
+        X509_CertPartsLoaded(cert, HITLS_X509_CERT_LAZY_NAME);
+    }
+    if ((todo & HITLS_X509_CERT_LAZY_PUBKEY) != 0) {
+        ret = X509_CertDecodePubKey(cert);
+        if (ret != CRYPT_SUCCESS) {
+            return ret;
+        }
+        X509_CertPartsLoaded(cert, HITLS_X509_CERT_LAZY_PUBKEY);
+    }
+    if ((todo & HITLS_X509_CERT_LAZY_EXT) != 0) {
+        ret = X509_CertDecodeExt(cert);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
+        X509_CertPartsLoaded(cert, HITLS_X509_CERT_LAZY_EXT);
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+int32_t HITLS_X509_CertLoad(HITLS_X509_Cert *cert, uint8_t parts)
+{
+    // The lock is created before the cert is handed out and never changed, eagerly parsed certs have none.
+    if (cert->lazyLock == NULL) {
+        return X509_CertLoadParts(cert, parts);
+    }
+#ifdef HITLS_X509_LAZY_LOAD
+    // Once decoded, a part is never changed again, so readers of decoded parts do not contend for the lock.
+    if ((HITLS_X509_LAZY_LOAD(&cert->lazyParts) & parts) == 0) {
+        return HITLS_X509_SUCCESS;
+    }
+#endif
+    int32_t ret = BSL_SAL_ThreadWriteLock(cert->lazyLock);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    // X509_CertLoadParts re-checks lazyParts, another thread may have decoded the parts meanwhile.
+    ret = X509_CertLoadParts(cert, parts);
+    (void)BSL_SAL_ThreadUnlock(cert->lazyLock);
+    return ret;
+}
+
 int32_t HITLS_X509_ParseCertTbs(BSL_ASN1_Buffer *asnArr, HITLS_X509_Cert *cert)
 {
     int32_t ret;
@@ -246,55 +347,35 @@ int32_t HITLS_X509_ParseCertTbs(BSL_ASN1_Buffer *asnArr, HITLS_X509_Cert *cert)
         return ret;
     }
 
-    // issuer name
-    ret = HITLS_X509_ParseNameList(&asnArr[HITLS_X509_CERT_ISSUER_IDX], cert->tbs.issuerName);
-    if (ret != HITLS_X509_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        return ret;
-    }
-
     // validity
     ret = HITLS_X509_ParseTime(&asnArr[HITLS_X509_CERT_BEFORE_VALID_IDX], &asnArr[HITLS_X509_CERT_AFTER_VALID_IDX],
         &cert->tbs.validTime);
     if (ret != BSL_SUCCESS) {
         BSL_ERR_PUSH_ERROR(ret);
-        goto ERR;
-    }
-
-    // subject name
-    ret = HITLS_X509_ParseNameList(&asnArr[HITLS_X509_CERT_SUBJECT_IDX], cert->tbs.subjectName);
-    if (ret != HITLS_X509_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        goto ERR;
-    }
-
-    // subject public key info
-    ret = CRYPT_EAL_ParseAsn1SubPubkey(asnArr[HITLS_X509_CERT_SUBKEYINFO_IDX].buff,
-        asnArr[HITLS_X509_CERT_SUBKEYINFO_IDX].len, &cert->tbs.ealPubKey, false);
-    if (ret != CRYPT_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        goto ERR;
-    }
-
-    // ext
-    ret = HITLS_X509_ParseExt(&asnArr[HITLS_X509_CERT_EXT_IDX], &cert->tbs.ext);
-    if (ret != BSL_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        goto ERR;
+        return ret;
     }
 
+    // issuer name, subject name, subject public key info and ext are recorded, see HITLS_X509_CertLoad
+    cert->tbs.issuerAsn = asnArr[HITLS_X509_CERT_ISSUER_IDX];
+    cert->tbs.subjectAsn = asnArr[HITLS_X509_CERT_SUBJECT_IDX];
+    cert->tbs.pubKeyAsn = asnArr[HITLS_X509_CERT_SUBKEYINFO_IDX];
+    cert->tbs.extAsn = asnArr[HITLS_X509_CERT_EXT_IDX];
+    cert->lazyParts = HITLS_X509_CERT_LAZY_ALL;
     return ret;
-ERR:
-    if (cert->tbs.ealPubKey != NULL) {
-        CRYPT_EAL_PkeyFreeCtx(cert->tbs.ealPubKey);
-        cert->tbs.ealPubKey = NULL;
-    }
+}
+
+static void X509_CertTbsClear(HITLS_X509_Cert *cert)
+{
+    CRYPT_EAL_PkeyFreeCtx(cert->tbs.ealPubKey);
+    cert->tbs.ealPubKey = NULL;
     BSL_LIST_DeleteAll(cert->tbs.issuerName, NULL);
     BSL_LIST_DeleteAll(cert->tbs.subjectName, NULL);
-    return ret;
+    BSL_LIST_DeleteAll(cert->tbs.ext.extList, NULL);
+    cert->lazyParts = 0;
 }
 
-int32_t HITLS_X509_ParseAsn1Cert(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_Cert *cert)
+/* parts: the HITLS_X509_CERT_LAZY_XXX parts decoded right away, the others are left to HITLS_X509_CertLoad. */
+static int32_t X509_ParseAsn1Cert(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_Cert *cert, uint8_t parts)
 {
     uint8_t *temp = *encode;
     uint32_t tempLen = *encodeLen;
@@ -324,6 +405,12 @@ int32_t HITLS_X509_ParseAsn1Cert(uint8_t **encode, uint32_t *encodeLen, HITLS_X5
         BSL_ERR_PUSH_ERROR(ret);
         return ret;
     }
+    if (parts != 0) {
+        ret = HITLS_X509_CertLoad(cert, parts);
+        if (ret != HITLS_X509_SUCCESS) {
+            goto ERR;
+        }
+    }
     // parse sign alg
     ret = HITLS_X509_ParseSignAlgInfo(&asnArr[HITLS_X509_CERT_SIGNALG_IDX],
         &asnArr[HITLS_X509_CERT_SIGNALG_ANY_IDX], &cert->signAlgId);
@@ -337,6 +424,13 @@ int32_t HITLS_X509_ParseAsn1Cert(uint8_t **encode, uint32_t *encodeLen, HITLS_X5
         BSL_ERR_PUSH_ERROR(ret);
         goto ERR;
     }
+    if (cert->lazyParts != 0) {
+        ret = BSL_SAL_ThreadLockNew(&cert->lazyLock);
+        if (ret != BSL_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            goto ERR;
+        }
+    }
 
     cert->rawData = *encode;
     cert->rawDataLen = *encodeLen - tempLen;
@@ -345,16 +439,27 @@ int32_t HITLS_X509_ParseAsn1Cert(uint8_t **encode, uint32_t *encodeLen, HITLS_X5
     cert->flag |= HITLS_X509_CERT_PARSE_FLAG;
     return HITLS_X509_SUCCESS;
 ERR:
-    CRYPT_EAL_PkeyFreeCtx(cert->tbs.ealPubKey);
-    cert->tbs.ealPubKey = NULL;
-    BSL_LIST_DeleteAll(cert->tbs.issuerName, NULL);
-    BSL_LIST_DeleteAll(cert->tbs.subjectName, NULL);
-    BSL_LIST_DeleteAll(cert->tbs.ext.extList, NULL);
+    X509_CertTbsClear(cert);
     return ret;
 }
 
+int32_t HITLS_X509_ParseAsn1Cert(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_Cert *cert)
+{
+    return X509_ParseAsn1Cert(encode, encodeLen, cert, HITLS_X509_CERT_LAZY_ALL);
+}
 
-int32_t HITLS_X509_CertMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X509_List **certlist)
+static int32_t X509_ParseAsn1CertLazy(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_Cert *cert)
+{
+    return X509_ParseAsn1Cert(encode, encodeLen, cert, 0);
+}
+
+static int32_t X509_ParseAsn1CertWithExt(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_Cert *cert)
+{
+    return X509_ParseAsn1Cert(encode, encodeLen, cert, HITLS_X509_CERT_LAZY_EXT);
+}
+
+static int32_t X509_CertMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X509_Asn1Parse asn1Parse,
+    uint32_t threadNum, HITLS_X509_List **certlist)
 {
     int32_t ret;
     if (encode == NULL || encode->data == NULL || encode->dataLen == 0 || certlist == NULL) {
@@ -362,7 +467,7 @@ int32_t HITLS_X509_CertMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X5
         return HITLS_X509_ERR_INVALID_PARAM;
     }
     X509_ParseFuncCbk certCbk = {
-        (HITLS_X509_Asn1Parse)HITLS_X509_ParseAsn1Cert,
+        asn1Parse,
         (HITLS_X509_New)HITLS_X509_CertNew,
         (HITLS_X509_Free)HITLS_X509_CertFree
     };
@@ -372,7 +477,7 @@ int32_t HITLS_X509_CertMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X5
         return BSL_MALLOC_FAIL;
     }
 
-    ret = HITLS_X509_ParseX509(format, encode, true, &certCbk, list);
+    ret = HITLS_X509_ParseX509Ex(format, encode, true, &certCbk, threadNum, list);
     if (ret != HITLS_X509_SUCCESS) {
         BSL_LIST_FREE(list, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
         BSL_ERR_PUSH_ERROR(ret);
@@ -382,6 +487,23 @@ int32_t HITLS_X509_CertMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X5
     return ret;
 }
 
+int32_t HITLS_X509_CertMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X509_List **certlist)
+{
+    return X509_CertMulParseBuff(format, encode, (HITLS_X509_Asn1Parse)HITLS_X509_ParseAsn1Cert, 1, certlist);
+}
+
+int32_t HITLS_X509_CertMulParseBuffLazy(int32_t format, BSL_Buffer *encode, HITLS_X509_List **certlist)
+{
+    return X509_CertMulParseBuff(format, encode, (HITLS_X509_Asn1Parse)X509_ParseAsn1CertLazy, 1, certlist);
+}
+
+int32_t HITLS_X509_CertMulParseBuffParallel(int32_t format, BSL_Buffer *encode, uint32_t threadNum,
+    HITLS_X509_List **certlist)
+{
+    return X509_CertMulParseBuff(format, encode, (HITLS_X509_Asn1Parse)X509_ParseAsn1CertWithExt, threadNum,
+        certlist);
+}
+
 int32_t HITLS_X509_CertParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X509_Cert **cert)
 {
     HITLS_X509_List *list = NULL;
@@ -431,7 +553,7 @@ int32_t HITLS_X509_CertMulParseFile(int32_t format, const char *path, HITLS_X509
     }
 
     BSL_Buffer encode = {data, dataLen};
-    ret = HITLS_X509_CertMulParseBuff(format, &encode, certlist);
+    ret = HITLS_X509_CertMulParseBuffLazy(format, &encode, certlist);
     BSL_SAL_Free(data);
     return ret;
 }
@@ -442,6 +564,10 @@ static int32_t X509_KeyUsageCheck(HITLS_X509_Cert *cert, bool *val, int32_t valL
         BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_INVALID_PARAM);
         return HITLS_X509_ERR_INVALID_PARAM;
     }
+    int32_t ret = HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_EXT);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
     HITLS_X509_CertExt *certExt = (HITLS_X509_CertExt *)cert->tbs.ext.extData;
     *val = (certExt->keyUsage & exp);
     return HITLS_X509_SUCCESS;
@@ -493,6 +619,10 @@ static int32_t X509_GetDistinguishNameStr(HITLS_X509_Cert *cert, BSL_Buffer *val
         BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_INVALID_PARAM);
         return HITLS_X509_ERR_INVALID_PARAM;
     }
+    int32_t ret = HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_NAME);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
     switch (opt) {
         case HITLS_X509_ISSUER_DN_NAME:
             return GetDistinguishNameStrFromList(cert->tbs.issuerName, val);
@@ -595,19 +725,23 @@ static int32_t X509_GetAsn1BslTimeStr(HITLS_X509_Cert *cert, BSL_Buffer *val, in
 
 static int32_t X509_CertGetCtrl(HITLS_X509_Cert *cert, int32_t cmd, void *val, int32_t valLen)
 {
+    int32_t ret;
     switch (cmd) {
         case HITLS_X509_GET_ENCODELEN:
             return HITLS_X509_GetEncodeLen(cert->rawDataLen, val, valLen);
         case HITLS_X509_GET_ENCODE:
             return HITLS_X509_GetEncodeData(cert->rawData, val);
         case HITLS_X509_GET_PUBKEY:
-            return HITLS_X509_GetPubKey(cert->tbs.ealPubKey, val);
+            ret = HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_PUBKEY);
+            return ret != HITLS_X509_SUCCESS ? ret : HITLS_X509_GetPubKey(cert->tbs.ealPubKey, val);
         case HITLS_X509_GET_SIGNALG:
             return HITLS_X509_GetSignAlg(cert->signAlgId.algId, val, valLen);
         case HITLS_X509_GET_SUBJECT_DN:
-            return HITLS_X509_GetList(cert->tbs.subjectName, val, valLen);
+            ret = HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_NAME);
+            return ret != HITLS_X509_SUCCESS ? ret : HITLS_X509_GetList(cert->tbs.subjectName, val, valLen);
         case HITLS_X509_GET_ISSUER_DN:
-            return HITLS_X509_GetList(cert->tbs.issuerName, val, valLen);
+            ret = HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_NAME);
+            return ret != HITLS_X509_SUCCESS ? ret : HITLS_X509_GetList(cert->tbs.issuerName, val, valLen);
         case HITLS_X509_GET_SUBJECT_DN_STR:
             return X509_GetDistinguishNameStr(cert, val, HITLS_X509_SUBJECT_DN_NAME);
         case HITLS_X509_GET_ISSUER_DN_STR:
@@ -772,6 +906,10 @@ int32_t HITLS_X509_CertCtrl(HITLS_X509_Cert *cert, int32_t cmd, void *val, int32
             BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_EXT_NOT_SUPPORT);
             return HITLS_X509_ERR_EXT_NOT_SUPPORT;
         }
+        int32_t ret = HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_EXT);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
         return X509_ExtCtrl(&cert->tbs.ext, cmd, val, valLen);
     } else {
         BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_INVALID_PARAM);
@@ -804,11 +942,28 @@ HITLS_X509_Cert *HITLS_X509_CertDup(HITLS_X509_Cert *src)
  */
 int32_t HITLS_X509_CheckIssued(HITLS_X509_Cert *issue, HITLS_X509_Cert *subject, bool *res)
 {
-    int32_t ret = HITLS_X509_CmpNameNode(issue->tbs.subjectName, subject->tbs.issuerName);
+    int32_t ret = HITLS_X509_CertLoad(issue, HITLS_X509_CERT_LAZY_NAME);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    ret = HITLS_X509_CertLoad(subject, HITLS_X509_CERT_LAZY_NAME);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    ret = HITLS_X509_CmpNameNode(issue->tbs.subjectName, subject->tbs.issuerName);
     if (ret != HITLS_X509_SUCCESS) {
         *res = false;
         return HITLS_X509_SUCCESS;
     }
+    // Only a candidate whose name matches needs its key and extensions.
+    ret = HITLS_X509_CertLoad(issue, HITLS_X509_CERT_LAZY_ALL);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    ret = HITLS_X509_CertLoad(subject, HITLS_X509_CERT_LAZY_EXT);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
     if (issue->tbs.version == HITLS_CERT_VERSION_3 && subject->tbs.version == HITLS_CERT_VERSION_3) {
         ret = HITLS_X509_CheckAki(&issue->tbs.ext, &subject->tbs.ext, issue->tbs.subjectName, &issue->tbs.serialNum);
         if (ret != HITLS_X509_SUCCESS && ret != HITLS_X509_ERR_VFY_AKI_SKI_NOT_MATCH) {
@@ -854,6 +1009,9 @@ int32_t HITLS_X509_CheckIssued(HITLS_X509_Cert *issue, HITLS_X509_Cert *subject,
 
 bool HITLS_X509_CertIsCA(HITLS_X509_Cert *cert)
 {
+    if (HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_EXT) != HITLS_X509_SUCCESS) {
+        return false;
+    }
     HITLS_X509_CertExt *certExt = (HITLS_X509_CertExt *)cert->tbs.ext.extData;
     if (cert->tbs.version == HITLS_CERT_VERSION_3) {
         if (!(certExt->extFlags & HITLS_X509_EXT_FLAG_BCONS)) {
@@ -48,6 +48,15 @@ extern "C" {
         }                                        \
     } while (0)
 
+/**
+ * The lazily decoded parts of a shared certificate or crl are decoded under its lock and marked done with a release
+ * store, so a reader that sees the part done with an acquire load may use it without the lock.
+ */
+#if defined(__GNUC__) && defined(__ATOMIC_ACQUIRE)
+#define HITLS_X509_LAZY_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define HITLS_X509_LAZY_STORE(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#endif
+
 /**
  * RFC 5280: section 4.1.2.5.1
  */
@@ -203,6 +212,15 @@ int32_t HITLS_X509_ParseTime(BSL_ASN1_Buffer *before, BSL_ASN1_Buffer *after, HI
 
 int32_t HITLS_X509_ParseX509(int32_t format, BSL_Buffer *encode, bool isCert, X509_ParseFuncCbk *parsefun,
     HITLS_X509_List *list);
+
+/**
+ * Same as HITLS_X509_ParseX509, but the elements are parsed on up to threadNum threads when the thread feature is
+ * enabled. The input is split at element boundaries first, and the results are added to the list in input order,
+ * so the list and the returned error are the same as those of the serial parser.
+ * The asn1Parse callback must be safe to run on several elements concurrently.
+ */
+int32_t HITLS_X509_ParseX509Ex(int32_t format, BSL_Buffer *encode, bool isCert, X509_ParseFuncCbk *parsefun,
+    uint32_t threadNum, HITLS_X509_List *list);
 int32_t HITLS_X509_CmpNameNode(BSL_ASN1_List *nameOri, BSL_ASN1_List *name);
 
 int32_t HITLS_X509_CheckAlg(CRYPT_EAL_PkeyCtx *pubkey, HITLS_X509_Asn1AlgId *subAlg);
@@ -260,6 +278,8 @@ int32_t HITLS_X509_GetExt(BslList *ext, BslCid cid, BSL_Buffer *val, uint32_t ex
 
 HITLS_X509_ExtEntry *X509_DupExtEntry(const HITLS_X509_ExtEntry *src);
 
+int32_t X509_ParseCrlNumber(HITLS_X509_ExtEntry *extEntry, HITLS_X509_ExtCrlNumber *crlNumber);
+
 bool X509_IsValidHashAlg(CRYPT_MD_AlgId id);
 
 int32_t HITLS_X509_EncodeExtEntry(BSL_ASN1_List *list, BSL_ASN1_Buffer *ext);
@@ -343,7 +343,9 @@ static int32_t X509_ParseAndAddRes(BSL_Buffer *asn1Buf, X509_ParseFuncCbk *parse
     }
     ret = BSL_LIST_AddElement(list, res, BSL_LIST_POS_AFTER);
     if (ret != BSL_SUCCESS) {
+        // The parsed object owns the encoding and frees it, asn1Buf has been moved past the encoding.
         parsefun->x509Free(res);
+        asn1Buf->data = NULL;
         BSL_ERR_PUSH_ERROR(ret);
         return ret;
     }
@@ -429,6 +431,245 @@ int32_t HITLS_X509_ParseX509(int32_t format, BSL_Buffer *encode, bool isCert, X5
     }
 }
 
+#if defined(HITLS_BSL_SAL_THREAD) && defined(HITLS_BSL_SAL_LOCK)
+#define X509_PARSE_RECORD_INIT_NUM 64
+
+typedef struct {
+    uint8_t *data;      // DER element or PEM body inside the input, NULL marks a split error
+    uint32_t dataLen;
+    void *res;
+    int32_t ret;
+    bool isDecodeErr;   // The PEM body is not valid base64, the serial parser stops at such a block.
+} X509_ParseRecord;
+
+typedef struct {
+    X509_ParseRecord *records;
+    uint32_t num;
+    uint32_t size;
+    uint32_t next;      // The next record to be claimed by a worker, protected by lock.
+    bool isPem;
+    X509_ParseFuncCbk *parsefun;
+    BSL_SAL_ThreadLockHandle lock;
+} X509_ParseJob;
+
+static int32_t X509_AddParseRecord(X509_ParseJob *job, uint8_t *data, uint32_t dataLen, int32_t ret)
+{
+    if (job->num == job->size) {
+        uint32_t size = (job->size == 0) ? X509_PARSE_RECORD_INIT_NUM : job->size * 2;
+        if (size > UINT32_MAX / sizeof(X509_ParseRecord)) {
+            BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+            return BSL_MALLOC_FAIL;
+        }
+        X509_ParseRecord *records = BSL_SAL_Realloc(job->records, size * sizeof(X509_ParseRecord),
+            job->size * sizeof(X509_ParseRecord));
+        if (records == NULL) {
+            BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+            return BSL_MALLOC_FAIL;
+        }
+        job->records = records;
+        job->size = size;
+    }
+    X509_ParseRecord *record = &job->records[job->num++];
+    record->data = data;
+    record->dataLen = dataLen;
+    record->res = NULL;
+    record->ret = ret;
+    record->isDecodeErr = false;
+    return HITLS_X509_SUCCESS;
+}
+
+/* Only the element boundaries are located here, the same way HITLS_X509_ParseAsn1 walks the input. */
+static int32_t X509_SplitAsn1(BSL_Buffer *encode, X509_ParseJob *job)
+{
+    uint8_t *data = encode->data;
+    uint32_t dataLen = encode->dataLen;
+    while (dataLen > 0) {
+        uint32_t elemLen = dataLen;
+        int32_t ret = BSL_ASN1_GetCompleteLen(data, &elemLen);
+        if (ret != HITLS_X509_SUCCESS) {
+            // Reported when the merge reaches it, so that errors of earlier elements win as in the serial parser.
+            return X509_AddParseRecord(job, NULL, 0, ret);
+        }
+        ret = X509_AddParseRecord(job, data, elemLen, HITLS_X509_SUCCESS);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
+        data += elemLen;
+        dataLen -= elemLen;
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t X509_SplitPem(BSL_Buffer *encode, bool isCert, X509_ParseJob *job)
+{
+    char *nextEncode = (char *)(encode->data);
+    uint32_t nextEncodeLen = encode->dataLen;
+    BSL_PEM_Symbol symbol = {0};
+    X509_GetPemSymbol(isCert, &symbol);
+    while (nextEncodeLen > 0) {
+        char *realEncode = NULL;
+        uint32_t realLen = 0;
+        if (BSL_PEM_GetPemRealEncode(&nextEncode, &nextEncodeLen, &symbol, &realEncode, &realLen) != BSL_SUCCESS) {
+            break;
+        }
+        int32_t ret = X509_AddParseRecord(job, (uint8_t *)realEncode, realLen, HITLS_X509_SUCCESS);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+static void X509_ParseOneRecord(X509_ParseJob *job, X509_ParseRecord *record)
+{
+    BSL_Buffer asn1Buf = {0};
+    if (job->isPem) {
+        record->ret = BSL_PEM_GetAsn1Encode((char *)record->data, record->dataLen, &asn1Buf.data, &asn1Buf.dataLen);
+        if (record->ret != BSL_SUCCESS) {
+            record->isDecodeErr = true;
+            return;
+        }
+    } else {
+        asn1Buf.data = BSL_SAL_Dump(record->data, record->dataLen);
+        if (asn1Buf.data == NULL) {
+            record->ret = BSL_DUMP_FAIL;
+            return;
+        }
+        asn1Buf.dataLen = record->dataLen;
+    }
+    void *res = job->parsefun->x509New();
+    if (res == NULL) {
+        BSL_SAL_Free(asn1Buf.data);
+        record->ret = BSL_MALLOC_FAIL;
+        return;
+    }
+    record->ret = job->parsefun->asn1Parse(&asn1Buf.data, &asn1Buf.dataLen, res);
+    if (record->ret != HITLS_X509_SUCCESS) {
+        job->parsefun->x509Free(res);
+        BSL_SAL_Free(asn1Buf.data);
+        return;
+    }
+    record->res = res;
+}
+
+static void *X509_ParseWorker(void *arg)
+{
+    X509_ParseJob *job = (X509_ParseJob *)arg;
+    while (true) {
+        (void)BSL_SAL_ThreadWriteLock(job->lock);
+        uint32_t idx = job->next++;
+        (void)BSL_SAL_ThreadUnlock(job->lock);
+        if (idx >= job->num) {
+            break;
+        }
+        if (job->records[idx].data != NULL) {
+            X509_ParseOneRecord(job, &job->records[idx]);
+        }
+    }
+    return NULL;
+}
+
+static void *X509_ParseThread(void *arg)
+{
+    (void)X509_ParseWorker(arg);
+    // Errors pushed by the parsers on this thread are not visible to the caller, the merge reports them instead.
+    BSL_ERR_RemoveErrorStack(false);
+    return NULL;
+}
+
+/* The caller thread takes part in the parsing, so threadNum - 1 threads are started at most. */
+static void X509_RunParseJob(X509_ParseJob *job, uint32_t threadNum)
+{
+    uint32_t num = (threadNum > job->num) ? job->num : threadNum;
+    BSL_SAL_ThreadId *threads = (num > 1) ? BSL_SAL_Calloc(num - 1, sizeof(BSL_SAL_ThreadId)) : NULL;
+    uint32_t started = 0;
+    if (threads != NULL && BSL_SAL_ThreadLockNew(&job->lock) == BSL_SUCCESS) {
+        for (; started < num - 1; started++) {
+            if (BSL_SAL_ThreadCreate(&threads[started], X509_ParseThread, job) != BSL_SUCCESS) {
+                break;
+            }
+        }
+    }
+    // Without workers the loop below simply parses every record on this thread.
+    (void)X509_ParseWorker(job);
+    for (uint32_t i = 0; i < started; i++) {
+        BSL_SAL_ThreadClose(threads[i]);
+    }
+    BSL_SAL_ThreadLockFree(job->lock);
+    job->lock = NULL;
+    BSL_SAL_Free(threads);
+}
+
+/* Add the results in input order, stopping where the serial parser would have stopped. */
+static int32_t X509_MergeParseJob(X509_ParseJob *job, HITLS_X509_List *list)
+{
+    for (uint32_t i = 0; i < job->num; i++) {
+        X509_ParseRecord *record = &job->records[i];
+        if (record->isDecodeErr) {
+            break;
+        }
+        if (record->ret != HITLS_X509_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(record->ret);
+            return record->ret;
+        }
+        int32_t ret = BSL_LIST_AddElement(list, record->res, BSL_LIST_POS_AFTER);
+        if (ret != BSL_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+        record->res = NULL;
+    }
+    if (job->isPem && BSL_LIST_COUNT(list) == 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_PARSE_NO_ELEMENT);
+        return HITLS_X509_ERR_PARSE_NO_ELEMENT;
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t X509_ParseX509Parallel(bool isPem, BSL_Buffer *encode, bool isCert, X509_ParseFuncCbk *parsefun,
+    uint32_t threadNum, HITLS_X509_List *list)
+{
+    X509_ParseJob job = {0};
+    job.isPem = isPem;
+    job.parsefun = parsefun;
+    int32_t ret = isPem ? X509_SplitPem(encode, isCert, &job) : X509_SplitAsn1(encode, &job);
+    if (ret == HITLS_X509_SUCCESS) {
+        X509_RunParseJob(&job, threadNum);
+        ret = X509_MergeParseJob(&job, list);
+    }
+    for (uint32_t i = 0; i < job.num; i++) {
+        if (job.records[i].res != NULL) {
+            parsefun->x509Free(job.records[i].res);
+        }
+    }
+    BSL_SAL_Free(job.records);
+    return ret;
+}
+#endif
+
+int32_t HITLS_X509_ParseX509Ex(int32_t format, BSL_Buffer *encode, bool isCert, X509_ParseFuncCbk *parsefun,
+    uint32_t threadNum, HITLS_X509_List *list)
+{
+#if defined(HITLS_BSL_SAL_THREAD) && defined(HITLS_BSL_SAL_LOCK)
+    if (threadNum > 1) {
+        switch (format) {
+            case BSL_FORMAT_ASN1:
+                return X509_ParseX509Parallel(false, encode, isCert, parsefun, threadNum, list);
+            case BSL_FORMAT_PEM:
+                return X509_ParseX509Parallel(true, encode, isCert, parsefun, threadNum, list);
+            case BSL_FORMAT_UNKNOWN:
+                return X509_ParseX509Parallel(BSL_PEM_IsPemFormat((char *)(encode->data), encode->dataLen), encode,
+                    isCert, parsefun, threadNum, list);
+            default:
+                break;
+        }
+    }
+#else
+    (void)threadNum;
+#endif
+    return HITLS_X509_ParseX509(format, encode, isCert, parsefun, list);
+}
+
 static int32_t X509_NodeNameCompare(BSL_ASN1_Buffer *src, BSL_ASN1_Buffer *dest)
 {
     if (src->tag != dest->tag) {
@@ -28,6 +28,10 @@ extern "C" {
 
 #define HITLS_X509_CRL_PARSE_FLAG  0x01
 #define HITLS_X509_CRL_GEN_FLAG    0x02
+#define HITLS_X509_CRL_LAZY_REVOKED 0x04 // The revoked list is decoded from revokedAsn on first use.
+
+/* CRLReason removeFromCRL as encoded on the wire, RFC 5280 section 5.3.1. */
+#define HITLS_X509_CRL_REASON_REMOVE_FROM_CRL 8
 
 #define BSL_TIME_REVOKE_TIME_IS_GMT  0x4
 
@@ -49,9 +53,33 @@ typedef struct {
     HITLS_X509_ValidTime validTime;
 
     BSL_ASN1_List *revokedCerts;
+    BSL_ASN1_Buffer revokedAsn; // Content of revokedCertificates, points into rawData.
     HITLS_X509_Ext crlExt;
 } HITLS_X509_CrlTbs;
 
+/**
+ * One revoked entry of a parsed crl. The entry is borrowed from rawData and only the serial number is located,
+ * the revocation date and the entry extensions are decoded on a hit.
+ */
+typedef struct {
+    const uint8_t *entry; // Content of the revokedCertificate SEQUENCE.
+    uint32_t entryLen;
+    uint16_t serialLen;
+    uint8_t serialOff;    // Offset of the userCertificate content in entry.
+    uint8_t reserved;
+} HITLS_X509_CrlIndexItem;
+
+/* Revoked entries sorted by serial number (length first, then bytes) for binary search. */
+typedef struct {
+    HITLS_X509_CrlIndexItem *items;
+    uint32_t num;
+} HITLS_X509_CrlIndex;
+
+typedef struct {
+    BSL_TIME time;  // revocationDate
+    int32_t reason; // CRLReason as encoded, -1 if the entry has no reason code.
+} HITLS_X509_CrlRevokedInfo;
+
 typedef enum {
     HITLS_X509_CRL_STATE_NEW = 0,
     HITLS_X509_CRL_STATE_SET,
@@ -68,11 +96,42 @@ typedef struct _HITLS_X509_Crl {
     HITLS_X509_CrlTbs tbs;
     HITLS_X509_Asn1AlgId signAlgId;
     BSL_ASN1_BitString signature;
+    HITLS_X509_CrlIndex revokedIdx;
 
     BSL_SAL_RefCount references;
+    BSL_SAL_ThreadLockHandle lazyLock; // serializes the decoding of the revoked list, only created for lazy crls
 } HITLS_X509_Crl;
 
 int32_t HITLS_X509_CrlMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X509_List **crllist);
+
+/**
+ * Parse a CRL bundle on up to threadNum threads, each CRL is parsed by a single thread.
+ */
+int32_t HITLS_X509_CrlMulParseBuffParallel(int32_t format, BSL_Buffer *encode, uint32_t threadNum,
+    HITLS_X509_List **crllist);
+
+/**
+ * Same as HITLS_X509_CrlMulParseBuffParallel, but the revoked list of each crl is left undecoded. Lookups go
+ * through the serial index, and the list is decoded on the first HITLS_X509_GET_REVOKELIST.
+ */
+int32_t HITLS_X509_CrlMulParseBuffLazy(int32_t format, BSL_Buffer *encode, uint32_t threadNum,
+    HITLS_X509_List **crllist);
+
+/**
+ * Look up a certificate serial number in the crl, in O(log n) for parsed crls.
+ * info is optional, it is only filled in when the serial number is revoked.
+ */
+int32_t HITLS_X509_CrlFindRevoked(HITLS_X509_Crl *crl, const BSL_ASN1_Buffer *serial, bool *isRevoked,
+    HITLS_X509_CrlRevokedInfo *info);
+
+/**
+ * Get the CRLNumber (BSL_CID_CE_CRLNUMBER) or the BaseCRLNumber (BSL_CID_CE_DELTACRLINDICATOR) of the crl.
+ * HITLS_X509_ERR_EXT_NOT_FOUND is returned without an error pushed if the extension is absent.
+ */
+int32_t HITLS_X509_CrlGetNumber(const HITLS_X509_Crl *crl, BslCid cid, BSL_Buffer *number);
+
+/* Compare two non-negative DER INTEGER contents, such as crl numbers. */
+int32_t HITLS_X509_CrlNumberCmp(const BSL_Buffer *a, const BSL_Buffer *b);
 #ifdef __cplusplus
 }
 #endif
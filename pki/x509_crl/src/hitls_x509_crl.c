@@ -13,6 +13,7 @@
  * See the Mulan PSL v2 for more details.
  */
 
+#include <stdlib.h>
 #include "hitls_pki.h"
 #include "bsl_sal.h"
 #include "sal_file.h"
@@ -127,7 +128,9 @@ void HITLS_X509_CrlFree(HITLS_X509_Crl *crl)
         BSL_SAL_FREE(crl->signAlgId.sm2UserId.data);
     }
     BSL_LIST_FREE(crl->tbs.revokedCerts, (BSL_LIST_PFUNC_FREE)HITLS_X509_CrlRevokedFree);
+    BSL_SAL_FREE(crl->revokedIdx.items);
     X509_ExtFree(&crl->tbs.crlExt, false);
+    BSL_SAL_ThreadLockFree(crl->lazyLock);
     BSL_SAL_ReferencesFree(&(crl->references));
     BSL_SAL_FREE(crl->rawData);
     BSL_SAL_Free(crl);
@@ -327,6 +330,130 @@ int32_t HITLS_X509_ParseCrlList(BSL_ASN1_Buffer *crl, BSL_ASN1_List *list)
     return ret;
 }
 
+/* Serial numbers are ordered by length first, then by bytes, that is enough for an exact match. */
+static int32_t X509_CrlSerialCmp(const uint8_t *serial, uint32_t serialLen, const HITLS_X509_CrlIndexItem *item)
+{
+    if (serialLen != item->serialLen) {
+        return serialLen < item->serialLen ? -1 : 1;
+    }
+    return memcmp(serial, item->entry + item->serialOff, serialLen);
+}
+
+static int32_t X509_CrlIndexItemCmp(const void *a, const void *b)
+{
+    const HITLS_X509_CrlIndexItem *itemA = (const HITLS_X509_CrlIndexItem *)a;
+    return X509_CrlSerialCmp(itemA->entry + itemA->serialOff, itemA->serialLen, (const HITLS_X509_CrlIndexItem *)b);
+}
+
+static int32_t X509_CrlIndexEntry(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_CrlIndexItem *item)
+{
+    uint32_t entryLen = 0;
+    int32_t ret = BSL_ASN1_DecodeTagLen(BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, encode, encodeLen, &entryLen);
+    if (ret != BSL_SUCCESS) {
+        return ret;
+    }
+    uint8_t *entry = *encode;
+    uint8_t *temp = entry;
+    uint32_t tempLen = entryLen;
+    uint32_t serialLen = 0;
+    ret = BSL_ASN1_DecodeTagLen(BSL_ASN1_TAG_INTEGER, &temp, &tempLen, &serialLen);
+    if (ret != BSL_SUCCESS) {
+        return ret;
+    }
+    if (serialLen == 0 || serialLen > UINT16_MAX) {
+        return HITLS_X509_ERR_CRL_ENTRY;
+    }
+    item->entry = entry;
+    item->entryLen = entryLen;
+    item->serialLen = (uint16_t)serialLen;
+    item->serialOff = (uint8_t)(temp - entry); // tag and at most 5 bytes of length
+    *encode += entryLen;
+    *encodeLen -= entryLen;
+    return HITLS_X509_SUCCESS;
+}
+
+/**
+ * Build the sorted serial index of a parsed crl. Each item is 16 bytes and borrows the entry from rawData, so a
+ * crl with millions of entries can be searched without decoding the revoked list.
+ */
+static int32_t X509_CrlBuildIndex(HITLS_X509_Crl *crl)
+{
+    BSL_ASN1_Buffer *revoked = &crl->tbs.revokedAsn;
+    if (revoked->tag == 0 || revoked->len == 0) {
+        return HITLS_X509_SUCCESS;
+    }
+    HITLS_X509_CrlIndexItem item = {0};
+    uint8_t *temp = revoked->buff;
+    uint32_t tempLen = revoked->len;
+    uint32_t num = 0;
+    int32_t ret;
+    while (tempLen > 0) {
+        ret = X509_CrlIndexEntry(&temp, &tempLen, &item);
+        if (ret != HITLS_X509_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            return ret;
+        }
+        num++;
+    }
+    HITLS_X509_CrlIndexItem *items = BSL_SAL_Malloc(num * sizeof(HITLS_X509_CrlIndexItem));
+    if (items == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    temp = revoked->buff;
+    tempLen = revoked->len;
+    for (uint32_t i = 0; i < num; i++) {
+        (void)X509_CrlIndexEntry(&temp, &tempLen, &items[i]); // checked by the first pass
+    }
+    qsort(items, num, sizeof(HITLS_X509_CrlIndexItem), X509_CrlIndexItemCmp);
+    crl->revokedIdx.items = items;
+    crl->revokedIdx.num = num;
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t X509_CrlDecodeRevoked(HITLS_X509_Crl *crl)
+{
+    if ((crl->flag & HITLS_X509_CRL_LAZY_REVOKED) == 0) {
+        return HITLS_X509_SUCCESS;
+    }
+    int32_t ret = HITLS_X509_ParseCrlList(&crl->tbs.revokedAsn, crl->tbs.revokedCerts);
+    if (ret != HITLS_X509_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+#ifdef HITLS_X509_LAZY_STORE
+    HITLS_X509_LAZY_STORE(&crl->flag, (uint8_t)(crl->flag & ~HITLS_X509_CRL_LAZY_REVOKED));
+#else
+    crl->flag &= (uint8_t)~HITLS_X509_CRL_LAZY_REVOKED;
+#endif
+    return HITLS_X509_SUCCESS;
+}
+
+/*
+ * Decode the revoked list that a lazy parse has left to the index only. A lazy crl may be shared by threads through
+ * a store, so the list is decoded under its lazyLock and not changed afterwards.
+ */
+static int32_t X509_CrlLoadRevoked(HITLS_X509_Crl *crl)
+{
+    // The lock is created before the crl is handed out and never changed, eagerly parsed crls have none.
+    if (crl->lazyLock == NULL) {
+        return X509_CrlDecodeRevoked(crl);
+    }
+#ifdef HITLS_X509_LAZY_LOAD
+    if ((HITLS_X509_LAZY_LOAD(&crl->flag) & HITLS_X509_CRL_LAZY_REVOKED) == 0) {
+        return HITLS_X509_SUCCESS;
+    }
+#endif
+    int32_t ret = BSL_SAL_ThreadWriteLock(crl->lazyLock);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    ret = X509_CrlDecodeRevoked(crl);
+    (void)BSL_SAL_ThreadUnlock(crl->lazyLock);
+    return ret;
+}
+
 int32_t HITLS_X509_ParseCrlTbs(BSL_ASN1_Buffer *asnArr, HITLS_X509_Crl *crl)
 {
     int32_t ret;
@@ -363,11 +490,18 @@ int32_t HITLS_X509_ParseCrlTbs(BSL_ASN1_Buffer *asnArr, HITLS_X509_Crl *crl)
         goto ERR;
     }
 
-    // crl list
-    ret = HITLS_X509_ParseCrlList(&asnArr[HITLS_X509_CRL_CRL_LIST_IDX], crl->tbs.revokedCerts);
+    // crl list, the index is always built, a lazy parse leaves the list to X509_CrlLoadRevoked
+    crl->tbs.revokedAsn = asnArr[HITLS_X509_CRL_CRL_LIST_IDX];
+    ret = X509_CrlBuildIndex(crl);
     if (ret != HITLS_X509_SUCCESS) {
-        BSL_ERR_PUSH_ERROR(ret);
-        return ret;
+        goto ERR;
+    }
+    if ((crl->flag & HITLS_X509_CRL_LAZY_REVOKED) == 0) {
+        ret = HITLS_X509_ParseCrlList(&asnArr[HITLS_X509_CRL_CRL_LIST_IDX], crl->tbs.revokedCerts);
+        if (ret != HITLS_X509_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            goto ERR;
+        }
     }
     // ext
     ret = HITLS_X509_ParseCrlExt(&asnArr[HITLS_X509_CRL_EXT_IDX], crl);
@@ -381,6 +515,8 @@ ERR:
 
     BSL_LIST_DeleteAll(crl->tbs.issuerName, NULL);
     BSL_LIST_DeleteAll(crl->tbs.revokedCerts, NULL);
+    BSL_SAL_FREE(crl->revokedIdx.items);
+    crl->revokedIdx.num = 0;
     return ret;
 }
 
@@ -755,7 +891,7 @@ int32_t HITLS_X509_CrlGenFile(int32_t format, HITLS_X509_Crl *crl, const char *p
     return ret;
 }
 
-int32_t HITLS_X509_ParseAsn1Crl(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_Crl *crl)
+static int32_t X509_ParseAsn1Crl(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_Crl *crl, bool isLazy)
 {
     uint8_t *temp = *encode;
     uint32_t tempLen = *encodeLen;
@@ -763,6 +899,9 @@ int32_t HITLS_X509_ParseAsn1Crl(uint8_t **encode, uint32_t *encodeLen, HITLS_X50
         BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_INVALID_PARAM);
         return HITLS_X509_ERR_INVALID_PARAM;
     }
+    if (isLazy) {
+        crl->flag |= HITLS_X509_CRL_LAZY_REVOKED;
+    }
 
     // template parse
     BSL_ASN1_Buffer asnArr[HITLS_X509_CRL_MAX_IDX] = {0};
@@ -782,6 +921,7 @@ int32_t HITLS_X509_ParseAsn1Crl(uint8_t **encode, uint32_t *encodeLen, HITLS_X50
     // parse tbs
     ret = HITLS_X509_ParseCrlTbs(asnArr, crl);
     if (ret != HITLS_X509_SUCCESS) {
+        crl->flag &= (uint8_t)~HITLS_X509_CRL_LAZY_REVOKED;
         return ret;
     }
     // parse sign alg
@@ -797,6 +937,13 @@ int32_t HITLS_X509_ParseAsn1Crl(uint8_t **encode, uint32_t *encodeLen, HITLS_X50
         BSL_ERR_PUSH_ERROR(ret);
         goto ERR;
     }
+    if (isLazy) {
+        ret = BSL_SAL_ThreadLockNew(&crl->lazyLock);
+        if (ret != BSL_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(ret);
+            goto ERR;
+        }
+    }
 
     crl->rawData = *encode;
     crl->rawDataLen = *encodeLen - tempLen;
@@ -808,10 +955,24 @@ ERR:
     BSL_LIST_DeleteAll(crl->tbs.issuerName, NULL);
     BSL_LIST_DeleteAll(crl->tbs.revokedCerts, NULL);
     BSL_LIST_DeleteAll(crl->tbs.crlExt.extList, NULL);
+    BSL_SAL_FREE(crl->revokedIdx.items);
+    crl->revokedIdx.num = 0;
+    crl->flag &= (uint8_t)~HITLS_X509_CRL_LAZY_REVOKED;
     return ret;
 }
 
-int32_t HITLS_X509_CrlMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X509_List **crllist)
+int32_t HITLS_X509_ParseAsn1Crl(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_Crl *crl)
+{
+    return X509_ParseAsn1Crl(encode, encodeLen, crl, false);
+}
+
+static int32_t X509_ParseAsn1CrlLazy(uint8_t **encode, uint32_t *encodeLen, HITLS_X509_Crl *crl)
+{
+    return X509_ParseAsn1Crl(encode, encodeLen, crl, true);
+}
+
+static int32_t X509_CrlMulParseBuff(int32_t format, BSL_Buffer *encode, uint32_t threadNum,
+    HITLS_X509_Asn1Parse asn1Parse, HITLS_X509_List **crllist)
 {
     if (encode == NULL || encode->data == NULL || encode->dataLen == 0 || crllist == NULL) {
         BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_INVALID_PARAM);
@@ -819,7 +980,7 @@ int32_t HITLS_X509_CrlMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X50
     }
 
     X509_ParseFuncCbk crlCbk = {
-        (HITLS_X509_Asn1Parse)HITLS_X509_ParseAsn1Crl,
+        asn1Parse,
         (HITLS_X509_New)HITLS_X509_CrlNew,
         (HITLS_X509_Free)HITLS_X509_CrlFree,
     };
@@ -828,7 +989,7 @@ int32_t HITLS_X509_CrlMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X50
         BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
         return BSL_MALLOC_FAIL;
     }
-    int32_t ret = HITLS_X509_ParseX509(format, encode, false, &crlCbk, list);
+    int32_t ret = HITLS_X509_ParseX509Ex(format, encode, false, &crlCbk, threadNum, list);
     if (ret != HITLS_X509_SUCCESS) {
         BSL_LIST_FREE(list, (BSL_LIST_PFUNC_FREE)HITLS_X509_CrlFree);
         BSL_ERR_PUSH_ERROR(ret);
@@ -838,6 +999,23 @@ int32_t HITLS_X509_CrlMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X50
     return HITLS_X509_SUCCESS;
 }
 
+int32_t HITLS_X509_CrlMulParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X509_List **crllist)
+{
+    return X509_CrlMulParseBuff(format, encode, 1, (HITLS_X509_Asn1Parse)HITLS_X509_ParseAsn1Crl, crllist);
+}
+
+int32_t HITLS_X509_CrlMulParseBuffParallel(int32_t format, BSL_Buffer *encode, uint32_t threadNum,
+    HITLS_X509_List **crllist)
+{
+    return X509_CrlMulParseBuff(format, encode, threadNum, (HITLS_X509_Asn1Parse)HITLS_X509_ParseAsn1Crl, crllist);
+}
+
+int32_t HITLS_X509_CrlMulParseBuffLazy(int32_t format, BSL_Buffer *encode, uint32_t threadNum,
+    HITLS_X509_List **crllist)
+{
+    return X509_CrlMulParseBuff(format, encode, threadNum, (HITLS_X509_Asn1Parse)X509_ParseAsn1CrlLazy, crllist);
+}
+
 int32_t HITLS_X509_CrlParseBuff(int32_t format, BSL_Buffer *encode, HITLS_X509_Crl **crl)
 {
     HITLS_X509_List *list = NULL;
@@ -886,7 +1064,7 @@ int32_t HITLS_X509_CrlMulParseFile(int32_t format, const char *path, HITLS_X509_
     }
 
     BSL_Buffer encode = {data, dataLen};
-    ret = HITLS_X509_CrlMulParseBuff(format, &encode, crllist);
+    ret = HITLS_X509_CrlMulParseBuffLazy(format, &encode, 1, crllist);
     BSL_SAL_Free(data);
     return ret;
 }
@@ -953,6 +1131,10 @@ static int32_t X509_CrlGetRevokeList(HITLS_X509_Crl *crl, BSL_ASN1_List **val, i
         BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_CRL_REVOKELIST_UNEXIST);
         return HITLS_X509_ERR_CRL_REVOKELIST_UNEXIST;
     }
+    int32_t ret = X509_CrlLoadRevoked(crl);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
 
     *val = crl->tbs.revokedCerts;
     return HITLS_X509_SUCCESS;
@@ -1477,6 +1659,141 @@ int32_t HITLS_X509_CrlRevokedCtrl(HITLS_X509_CrlEntry *revoked, int32_t cmd, voi
     }
 }
 
+static HITLS_X509_ExtEntry *X509_CrlFindExt(BslList *extList, BslCid cid)
+{
+    HITLS_X509_ExtEntry *extEntry = NULL;
+    for (extEntry = BSL_LIST_GET_FIRST(extList); extEntry != NULL; extEntry = BSL_LIST_GET_NEXT(extList)) {
+        if (extEntry->cid == cid) {
+            return extEntry;
+        }
+    }
+    return NULL;
+}
+
+static int32_t X509_CrlEntryInfo(HITLS_X509_CrlEntry *entry, HITLS_X509_CrlRevokedInfo *info)
+{
+    info->time = entry->time;
+    info->reason = -1;
+    HITLS_X509_ExtEntry *extEntry = X509_CrlFindExt(entry->extList, BSL_CID_CE_CRLREASON);
+    if (extEntry == NULL) {
+        return HITLS_X509_SUCCESS;
+    }
+    return DecodeExtReason(extEntry, &info->reason);
+}
+
+static int32_t X509_CrlIndexInfo(const HITLS_X509_CrlIndexItem *item, HITLS_X509_CrlRevokedInfo *info)
+{
+    HITLS_X509_CrlEntry entry = {0};
+    BSL_ASN1_Buffer asn = {BSL_ASN1_TAG_CONSTRUCTED | BSL_ASN1_TAG_SEQUENCE, item->entryLen,
+        (uint8_t *)(uintptr_t)item->entry};
+    int32_t ret = HITLS_CRL_ParseCrlEntry(&asn, &entry);
+    if (ret == HITLS_X509_SUCCESS) {
+        ret = X509_CrlEntryInfo(&entry, info);
+    }
+    BSL_LIST_FREE(entry.extList, NULL);
+    return ret;
+}
+
+static const HITLS_X509_CrlIndexItem *X509_CrlIndexSearch(const HITLS_X509_CrlIndex *index, const uint8_t *serial,
+    uint32_t serialLen)
+{
+    uint32_t low = 0;
+    uint32_t high = index->num;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2; // 2: half
+        int32_t cmp = X509_CrlSerialCmp(serial, serialLen, &index->items[mid]);
+        if (cmp == 0) {
+            return &index->items[mid];
+        }
+        if (cmp < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return NULL;
+}
+
+int32_t HITLS_X509_CrlFindRevoked(HITLS_X509_Crl *crl, const BSL_ASN1_Buffer *serial, bool *isRevoked,
+    HITLS_X509_CrlRevokedInfo *info)
+{
+    if (crl == NULL || serial == NULL || isRevoked == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_INVALID_PARAM);
+        return HITLS_X509_ERR_INVALID_PARAM;
+    }
+    *isRevoked = false;
+    if (serial->tag != BSL_ASN1_TAG_INTEGER || serial->buff == NULL || serial->len == 0) {
+        return HITLS_X509_SUCCESS;
+    }
+    if ((crl->flag & HITLS_X509_CRL_PARSE_FLAG) != 0) {
+        const HITLS_X509_CrlIndexItem *item = X509_CrlIndexSearch(&crl->revokedIdx, serial->buff, serial->len);
+        if (item == NULL) {
+            return HITLS_X509_SUCCESS;
+        }
+        *isRevoked = true;
+        return info == NULL ? HITLS_X509_SUCCESS : X509_CrlIndexInfo(item, info);
+    }
+    // A crl being generated has no index, it is small enough for a scan.
+    HITLS_X509_CrlEntry *entry = NULL;
+    BSL_ASN1_List *revokedCerts = crl->tbs.revokedCerts;
+    for (entry = BSL_LIST_GET_FIRST(revokedCerts); entry != NULL; entry = BSL_LIST_GET_NEXT(revokedCerts)) {
+        if (entry->serialNumber.len == serial->len &&
+            memcmp(entry->serialNumber.buff, serial->buff, serial->len) == 0) {
+            *isRevoked = true;
+            return info == NULL ? HITLS_X509_SUCCESS : X509_CrlEntryInfo(entry, info);
+        }
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+int32_t HITLS_X509_CrlGetNumber(const HITLS_X509_Crl *crl, BslCid cid, BSL_Buffer *number)
+{
+    if (crl == NULL || number == NULL ||
+        (cid != (BslCid)BSL_CID_CE_CRLNUMBER && cid != (BslCid)BSL_CID_CE_DELTACRLINDICATOR)) {
+        BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_INVALID_PARAM);
+        return HITLS_X509_ERR_INVALID_PARAM;
+    }
+    HITLS_X509_ExtEntry *extEntry = X509_CrlFindExt(crl->tbs.crlExt.extList, cid);
+    if (extEntry == NULL) {
+        return HITLS_X509_ERR_EXT_NOT_FOUND;
+    }
+    // BaseCRLNumber is a CRLNumber as well
+    HITLS_X509_ExtCrlNumber crlNumber = {0};
+    int32_t ret = X509_ParseCrlNumber(extEntry, &crlNumber);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    *number = crlNumber.crlNumber;
+    return HITLS_X509_SUCCESS;
+}
+
+static void X509_CrlNumberStrip(const BSL_Buffer *num, const uint8_t **data, uint32_t *dataLen)
+{
+    *data = num->data;
+    *dataLen = num->dataLen;
+    while (*dataLen > 0 && **data == 0) {
+        (*data)++;
+        (*dataLen)--;
+    }
+}
+
+int32_t HITLS_X509_CrlNumberCmp(const BSL_Buffer *a, const BSL_Buffer *b)
+{
+    const uint8_t *dataA = NULL;
+    const uint8_t *dataB = NULL;
+    uint32_t lenA = 0;
+    uint32_t lenB = 0;
+    X509_CrlNumberStrip(a, &dataA, &lenA);
+    X509_CrlNumberStrip(b, &dataB, &lenB);
+    if (lenA != lenB) {
+        return lenA < lenB ? -1 : 1;
+    }
+    if (lenA == 0) {
+        return 0;
+    }
+    return memcmp(dataA, dataB, lenA);
+}
+
 static int32_t CrlSignCb(uint32_t mdId, CRYPT_EAL_PkeyCtx *prvKey, HITLS_X509_Asn1AlgId *signAlgId, HITLS_X509_Crl *crl)
 {
     BSL_Buffer signBuff = {0};
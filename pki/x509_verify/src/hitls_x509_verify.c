@@ -13,6 +13,7 @@
  * See the Mulan PSL v2 for more details.
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include "securec.h"
 #include "hitls_pki.h"
@@ -28,6 +29,7 @@
 #include "bsl_list.h"
 #include "bsl_list_internal.h"
 #include "hitls_x509_verify.h"
+#include "sal_file.h"
 
 typedef int32_t (*HITLS_X509_TrvListCallBack)(void *ctx, void *node);
 typedef int32_t (*HITLS_X509_TrvListWithParentCallBack)(void *ctx, void *node, void *parent);
@@ -103,9 +105,7 @@ static int32_t X509_CertCmp(HITLS_X509_Cert *certOri, HITLS_X509_Cert *cert)
     if (certOri == cert) {
         return 0;
     }
-    if (HITLS_X509_CmpNameNode(certOri->tbs.subjectName, cert->tbs.subjectName) != 0) {
-        return 1;
-    }
+    // Equal tbs encodings imply equal subjects, so the names of lazily parsed certs need not be decoded.
     if (certOri->tbs.tbsRawDataLen != cert->tbs.tbsRawDataLen) {
         return 1;
     }
@@ -282,6 +282,221 @@ static int32_t X509_SetCRL(HITLS_X509_StoreCtx *storeCtx, void *val, int32_t val
     return ret;
 }
 
+/* Sort key of a cert or CRL, equal tbs encodings are the same entry, see X509_CertCmp and X509_CrlCmp. */
+typedef struct {
+    const uint8_t *tbs;
+    uint32_t tbsLen;
+    uint32_t pos; // 0 for an entry of the store, else 1 + the index in the loaded list
+} X509_LoadKey;
+
+static int X509_LoadKeyTbsCmp(const X509_LoadKey *a, const X509_LoadKey *b)
+{
+    if (a->tbsLen != b->tbsLen) {
+        return a->tbsLen < b->tbsLen ? -1 : 1;
+    }
+    return memcmp(a->tbs, b->tbs, a->tbsLen);
+}
+
+static int X509_LoadKeyCmp(const void *a, const void *b)
+{
+    const X509_LoadKey *keyA = (const X509_LoadKey *)a;
+    const X509_LoadKey *keyB = (const X509_LoadKey *)b;
+    int ret = X509_LoadKeyTbsCmp(keyA, keyB);
+    if (ret != 0) {
+        return ret;
+    }
+    return keyA->pos < keyB->pos ? -1 : (keyA->pos > keyB->pos ? 1 : 0);
+}
+
+/*
+ * keys holds the entries of the store followed by the loaded ones. After sorting, an entry is new if it is the
+ * first one of its tbs encoding, so entries already in the store and repeats within the list are dropped in
+ * O(n log n) instead of a search of the store per entry.
+ */
+static void X509_MarkNewEntries(X509_LoadKey *keys, uint32_t keyNum, bool *isNew)
+{
+    qsort(keys, keyNum, sizeof(X509_LoadKey), X509_LoadKeyCmp);
+    for (uint32_t i = 0; i < keyNum; i++) {
+        if (keys[i].pos != 0) {
+            isNew[keys[i].pos - 1] = (i == 0 || X509_LoadKeyTbsCmp(&keys[i - 1], &keys[i]) != 0);
+        }
+    }
+}
+
+/* The new entries are added at the beginning of the store, so a failure removes the first addNum entries. */
+static void X509_RollbackLoad(HITLS_X509_List *store, uint32_t addNum, BSL_LIST_PFUNC_FREE freeFunc)
+{
+    for (uint32_t i = 0; i < addNum; i++) {
+        (void)BSL_LIST_GET_FIRST(store);
+        BSL_LIST_DeleteCurrent(store, freeFunc);
+    }
+}
+
+/* All certs are checked and the store is rolled back on failure, so a rejected bundle leaves the store as it was. */
+static int32_t X509_LoadCaList(HITLS_X509_StoreCtx *storeCtx, HITLS_X509_List *certList)
+{
+    HITLS_X509_Cert *cert = NULL;
+    for (cert = BSL_LIST_GET_FIRST(certList); cert != NULL; cert = BSL_LIST_GET_NEXT(certList)) {
+        if (!HITLS_X509_CertIsCA(cert)) {
+            BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_CERT_NOT_CA);
+            return HITLS_X509_ERR_CERT_NOT_CA;
+        }
+    }
+    uint32_t storeNum = (uint32_t)BSL_LIST_COUNT(storeCtx->store);
+    uint32_t num = (uint32_t)BSL_LIST_COUNT(certList);
+    if (num == 0) {
+        return HITLS_X509_SUCCESS;
+    }
+    X509_LoadKey *keys = BSL_SAL_Malloc((storeNum + num) * sizeof(X509_LoadKey));
+    bool *isNew = BSL_SAL_Calloc(num, sizeof(bool));
+    if (keys == NULL || isNew == NULL) {
+        BSL_SAL_Free(keys);
+        BSL_SAL_Free(isNew);
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    uint32_t i = 0;
+    for (cert = BSL_LIST_GET_FIRST(storeCtx->store); cert != NULL; cert = BSL_LIST_GET_NEXT(storeCtx->store), i++) {
+        keys[i] = (X509_LoadKey){cert->tbs.tbsRawData, cert->tbs.tbsRawDataLen, 0};
+    }
+    for (cert = BSL_LIST_GET_FIRST(certList); cert != NULL; cert = BSL_LIST_GET_NEXT(certList), i++) {
+        keys[i] = (X509_LoadKey){cert->tbs.tbsRawData, cert->tbs.tbsRawDataLen, i - storeNum + 1};
+    }
+    X509_MarkNewEntries(keys, storeNum + num, isNew);
+    BSL_SAL_Free(keys);
+
+    int32_t ret = HITLS_X509_SUCCESS;
+    uint32_t addNum = 0;
+    i = 0;
+    for (cert = BSL_LIST_GET_FIRST(certList); cert != NULL; cert = BSL_LIST_GET_NEXT(certList), i++) {
+        // Bundles often repeat a CA, that is not an error here.
+        if (!isNew[i]) {
+            continue;
+        }
+        int ref;
+        ret = HITLS_X509_CertCtrl(cert, HITLS_X509_REF_UP, &ref, sizeof(int));
+        if (ret != HITLS_X509_SUCCESS) {
+            break;
+        }
+        ret = BSL_LIST_AddElement(storeCtx->store, cert, BSL_LIST_POS_BEGIN);
+        if (ret != BSL_SUCCESS) {
+            HITLS_X509_CertFree(cert);
+            BSL_ERR_PUSH_ERROR(ret);
+            break;
+        }
+        addNum++;
+    }
+    BSL_SAL_Free(isNew);
+    if (ret != HITLS_X509_SUCCESS) {
+        X509_RollbackLoad(storeCtx->store, addNum, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+    }
+    return ret;
+}
+
+/* Like X509_LoadCaList, a failure leaves the CRLs of the store as they were. */
+static int32_t X509_LoadCrlList(HITLS_X509_StoreCtx *storeCtx, HITLS_X509_List *crlList)
+{
+    HITLS_X509_Crl *crl = NULL;
+    uint32_t storeNum = (uint32_t)BSL_LIST_COUNT(storeCtx->crl);
+    uint32_t num = (uint32_t)BSL_LIST_COUNT(crlList);
+    if (num == 0) {
+        return HITLS_X509_SUCCESS;
+    }
+    X509_LoadKey *keys = BSL_SAL_Malloc((storeNum + num) * sizeof(X509_LoadKey));
+    bool *isNew = BSL_SAL_Calloc(num, sizeof(bool));
+    if (keys == NULL || isNew == NULL) {
+        BSL_SAL_Free(keys);
+        BSL_SAL_Free(isNew);
+        BSL_ERR_PUSH_ERROR(BSL_MALLOC_FAIL);
+        return BSL_MALLOC_FAIL;
+    }
+    uint32_t i = 0;
+    for (crl = BSL_LIST_GET_FIRST(storeCtx->crl); crl != NULL; crl = BSL_LIST_GET_NEXT(storeCtx->crl), i++) {
+        keys[i] = (X509_LoadKey){crl->tbs.tbsRawData, crl->tbs.tbsRawDataLen, 0};
+    }
+    for (crl = BSL_LIST_GET_FIRST(crlList); crl != NULL; crl = BSL_LIST_GET_NEXT(crlList), i++) {
+        keys[i] = (X509_LoadKey){crl->tbs.tbsRawData, crl->tbs.tbsRawDataLen, i - storeNum + 1};
+    }
+    X509_MarkNewEntries(keys, storeNum + num, isNew);
+    BSL_SAL_Free(keys);
+
+    int32_t ret = HITLS_X509_SUCCESS;
+    uint32_t addNum = 0;
+    i = 0;
+    for (crl = BSL_LIST_GET_FIRST(crlList); crl != NULL; crl = BSL_LIST_GET_NEXT(crlList), i++) {
+        if (!isNew[i]) {
+            continue;
+        }
+        int ref;
+        ret = HITLS_X509_CrlCtrl(crl, HITLS_X509_REF_UP, &ref, sizeof(int));
+        if (ret != HITLS_X509_SUCCESS) {
+            break;
+        }
+        ret = BSL_LIST_AddElement(storeCtx->crl, crl, BSL_LIST_POS_BEGIN);
+        if (ret != BSL_SUCCESS) {
+            HITLS_X509_CrlFree(crl);
+            BSL_ERR_PUSH_ERROR(ret);
+            break;
+        }
+        addNum++;
+    }
+    BSL_SAL_Free(isNew);
+    if (ret != HITLS_X509_SUCCESS) {
+        X509_RollbackLoad(storeCtx->crl, addNum, (BSL_LIST_PFUNC_FREE)HITLS_X509_CrlFree);
+    }
+    return ret;
+}
+
+int32_t HITLS_X509_StoreCtxLoadCaFile(HITLS_X509_StoreCtx *storeCtx, int32_t format, const char *path,
+    uint32_t threadNum)
+{
+    if (storeCtx == NULL || path == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_INVALID_PARAM);
+        return HITLS_X509_ERR_INVALID_PARAM;
+    }
+    uint8_t *data = NULL;
+    uint32_t dataLen = 0;
+    int32_t ret = BSL_SAL_ReadFile(path, &data, &dataLen);
+    if (ret != BSL_SUCCESS) {
+        return ret;
+    }
+    BSL_Buffer encode = {data, dataLen};
+    HITLS_X509_List *certList = NULL;
+    ret = HITLS_X509_CertMulParseBuffParallel(format, &encode, threadNum, &certList);
+    BSL_SAL_Free(data);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    ret = X509_LoadCaList(storeCtx, certList);
+    BSL_LIST_FREE(certList, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+    return ret;
+}
+
+int32_t HITLS_X509_StoreCtxLoadCrlFile(HITLS_X509_StoreCtx *storeCtx, int32_t format, const char *path,
+    uint32_t threadNum)
+{
+    if (storeCtx == NULL || path == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_INVALID_PARAM);
+        return HITLS_X509_ERR_INVALID_PARAM;
+    }
+    uint8_t *data = NULL;
+    uint32_t dataLen = 0;
+    int32_t ret = BSL_SAL_ReadFile(path, &data, &dataLen);
+    if (ret != BSL_SUCCESS) {
+        return ret;
+    }
+    BSL_Buffer encode = {data, dataLen};
+    HITLS_X509_List *crlList = NULL;
+    ret = HITLS_X509_CrlMulParseBuffLazy(format, &encode, threadNum, &crlList);
+    BSL_SAL_Free(data);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    ret = X509_LoadCrlList(storeCtx, crlList);
+    BSL_LIST_FREE(crlList, (BSL_LIST_PFUNC_FREE)HITLS_X509_CrlFree);
+    return ret;
+}
+
 static int32_t X509_RefUp(HITLS_X509_StoreCtx *storeCtx, void *val, int32_t valLen)
 {
     if (valLen != sizeof(int)) {
@@ -528,6 +743,10 @@ int32_t HITLS_X509_CertChainBuild(HITLS_X509_StoreCtx *storeCtx, bool isWithRoot
 
 static int32_t HITLS_X509_SecBitsCheck(HITLS_X509_StoreCtx *storeCtx, HITLS_X509_Cert *cert)
 {
+    int32_t ret = HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_PUBKEY);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
     uint32_t secBits = CRYPT_EAL_PkeyGetSecurityBits(cert->tbs.ealPubKey);
     if (secBits < storeCtx->verifyParam.securityBits) {
         BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_VFY_CHECK_SECBITS);
@@ -561,6 +780,10 @@ static int32_t HITLS_X509_CheckCertExt(void *ctx, HITLS_X509_Cert *cert)
     if (cert->tbs.version != 2) { // no ext v1 cert
         return HITLS_X509_SUCCESS;
     }
+    int32_t ret = HITLS_X509_CertLoad(cert, HITLS_X509_CERT_LAZY_EXT);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
     return HITLS_X509_TrvList(cert->tbs.ext.extList,
         (HITLS_X509_TrvListCallBack)HITLS_X509_CheckCertExtNode, NULL);
 }
@@ -574,12 +797,93 @@ int32_t HITLS_X509_VerifyParamAndExt(HITLS_X509_StoreCtx *storeCtx, HITLS_X509_L
     return HITLS_X509_TrvList(chain, (HITLS_X509_TrvListCallBack)HITLS_X509_CheckCertExt, NULL);
 }
 
-int32_t HITLS_X509_CheckCertRevoked(HITLS_X509_Cert *cert, HITLS_X509_CrlEntry *crlEntry)
+static int32_t X509_CheckCrlExtNode(void *ctx, HITLS_X509_ExtEntry *extNode)
 {
-    if (cert->tbs.serialNum.tag == crlEntry->serialNumber.tag &&
-        cert->tbs.serialNum.len == crlEntry->serialNumber.len &&
-        memcmp(cert->tbs.serialNum.buff, crlEntry->serialNumber.buff, crlEntry->serialNumber.len) == 0) {
-        return HITLS_X509_ERR_VFY_CERT_REVOKED;
+    // The delta crl indicator is processed by X509_CheckCrlDelta.
+    if (extNode->cid == BSL_CID_CE_DELTACRLINDICATOR) {
+        return HITLS_X509_SUCCESS;
+    }
+    return HITLS_X509_CheckCertExtNode(ctx, extNode);
+}
+
+/* Revocation state of a cert collected over the complete and delta crls of its issuer. */
+typedef struct {
+    bool baseFound;
+    bool isRevoked;
+    BSL_Buffer baseNum;     // highest CRLNumber of the complete crls
+    HITLS_X509_Crl *delta;  // delta crl with the highest CRLNumber
+    BSL_Buffer deltaNum;
+    BSL_Buffer deltaBase;   // BaseCRLNumber of the delta crl
+} X509_CrlCheckState;
+
+static int32_t X509_CrlCollectDelta(HITLS_X509_Crl *crl, const BSL_Buffer *deltaBase, X509_CrlCheckState *state)
+{
+    BSL_Buffer num = {0};
+    int32_t ret = HITLS_X509_CrlGetNumber(crl, BSL_CID_CE_CRLNUMBER, &num);
+    if (ret == HITLS_X509_ERR_EXT_NOT_FOUND) {
+        return HITLS_X509_SUCCESS; // RFC 5280 5.2.4, a delta crl without a CRLNumber is not usable.
+    }
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    if (state->delta == NULL || HITLS_X509_CrlNumberCmp(&num, &state->deltaNum) > 0) {
+        state->delta = crl;
+        state->deltaNum = num;
+        state->deltaBase = *deltaBase;
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t X509_CrlCollect(HITLS_X509_Crl *crl, HITLS_X509_Cert *cert, X509_CrlCheckState *state)
+{
+    BSL_Buffer num = {0};
+    int32_t ret = HITLS_X509_CrlGetNumber(crl, BSL_CID_CE_DELTACRLINDICATOR, &num);
+    if (ret == HITLS_X509_SUCCESS) {
+        return X509_CrlCollectDelta(crl, &num, state);
+    }
+    if (ret != HITLS_X509_ERR_EXT_NOT_FOUND) {
+        return ret;
+    }
+    bool isRevoked = false;
+    ret = HITLS_X509_CrlFindRevoked(crl, &cert->tbs.serialNum, &isRevoked, NULL);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    state->baseFound = true;
+    state->isRevoked = state->isRevoked || isRevoked;
+    ret = HITLS_X509_CrlGetNumber(crl, BSL_CID_CE_CRLNUMBER, &num);
+    if (ret == HITLS_X509_ERR_EXT_NOT_FOUND) {
+        return HITLS_X509_SUCCESS;
+    }
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    if (state->baseNum.data == NULL || HITLS_X509_CrlNumberCmp(&num, &state->baseNum) > 0) {
+        state->baseNum = num;
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+/**
+ * RFC 5280 6.3.3: a delta crl applies on top of a complete crl whose CRLNumber is at least its BaseCRLNumber.
+ * An entry in the delta crl revokes the cert, unless its reason is removeFromCRL. The delta crl is searched through
+ * its own index, the complete crls are not decoded again.
+ */
+static int32_t X509_CheckCrlDelta(HITLS_X509_Cert *cert, X509_CrlCheckState *state)
+{
+    if (state->delta == NULL || state->baseNum.data == NULL ||
+        HITLS_X509_CrlNumberCmp(&state->baseNum, &state->deltaBase) < 0 ||
+        HITLS_X509_CrlNumberCmp(&state->deltaNum, &state->baseNum) <= 0) {
+        return HITLS_X509_SUCCESS;
+    }
+    bool isRevoked = false;
+    HITLS_X509_CrlRevokedInfo info = {0};
+    int32_t ret = HITLS_X509_CrlFindRevoked(state->delta, &cert->tbs.serialNum, &isRevoked, &info);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    if (isRevoked) {
+        state->isRevoked = info.reason != HITLS_X509_CRL_REASON_REMOVE_FROM_CRL;
     }
     return HITLS_X509_SUCCESS;
 }
@@ -606,7 +910,11 @@ static int32_t X509_StoreCheckSignature(const BSL_Buffer *sm2UserId, const CRYPT
 
 int32_t HITLS_X509_CheckCertCrl(HITLS_X509_StoreCtx *storeCtx, HITLS_X509_Cert *cert, HITLS_X509_Cert *parent)
 {
-    int32_t ret = HITLS_X509_ERR_CRL_NOT_FOUND;
+    int32_t ret = HITLS_X509_CertLoad(parent, HITLS_X509_CERT_LAZY_ALL);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    X509_CrlCheckState state = {0};
     HITLS_X509_Crl *crl = BSL_LIST_GET_FIRST(storeCtx->crl);
     HITLS_X509_CertExt *certExt = (HITLS_X509_CertExt *)parent->tbs.ext.extData;
     if (certExt->extFlags & HITLS_X509_EXT_FLAG_KUSAGE) {
@@ -632,7 +940,7 @@ int32_t HITLS_X509_CheckCertCrl(HITLS_X509_StoreCtx *storeCtx, HITLS_X509_Cert *
             continue;
         }
         ret = HITLS_X509_TrvList(crl->tbs.crlExt.extList,
-            (HITLS_X509_TrvListCallBack)HITLS_X509_CheckCertExtNode, NULL);
+            (HITLS_X509_TrvListCallBack)X509_CheckCrlExtNode, NULL);
         if (ret != HITLS_X509_SUCCESS) {
             BSL_ERR_PUSH_ERROR(ret);
             return ret;
@@ -644,15 +952,24 @@ int32_t HITLS_X509_CheckCertCrl(HITLS_X509_StoreCtx *storeCtx, HITLS_X509_Cert *
             BSL_ERR_PUSH_ERROR(ret);
             return ret;
         }
-        ret = HITLS_X509_TrvList(crl->tbs.revokedCerts,
-            (HITLS_X509_TrvListCallBack)HITLS_X509_CheckCertRevoked, cert);
+        ret = X509_CrlCollect(crl, cert, &state);
         if (ret != HITLS_X509_SUCCESS) {
-            BSL_ERR_PUSH_ERROR(ret);
             return ret;
         }
         crl = BSL_LIST_GET_NEXT(storeCtx->crl);
     }
-    return ret;
+    if (!state.baseFound) {
+        return HITLS_X509_ERR_CRL_NOT_FOUND;
+    }
+    ret = X509_CheckCrlDelta(cert, &state);
+    if (ret != HITLS_X509_SUCCESS) {
+        return ret;
+    }
+    if (state.isRevoked) {
+        BSL_ERR_PUSH_ERROR(HITLS_X509_ERR_VFY_CERT_REVOKED);
+        return HITLS_X509_ERR_VFY_CERT_REVOKED;
+    }
+    return HITLS_X509_SUCCESS;
 }
 
 int32_t HITLS_X509_VerifyCrl(HITLS_X509_StoreCtx *storeCtx, HITLS_X509_List *chain)
@@ -689,6 +1006,10 @@ int32_t X509_VerifyChainCert(HITLS_X509_StoreCtx *storeCtx, HITLS_X509_List *cha
                 return ret;
             }
         }
+        ret = HITLS_X509_CertLoad(issue, HITLS_X509_CERT_LAZY_PUBKEY);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
         ret = X509_StoreCheckSignature(&storeCtx->verifyParam.sm2UserId, issue->tbs.ealPubKey, cur->tbs.tbsRawData,
             cur->tbs.tbsRawDataLen, &cur->signAlgId, &cur->signature);
         if (ret != HITLS_X509_SUCCESS) {
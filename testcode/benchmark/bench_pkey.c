@@ -0,0 +1,319 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "crypt_errno.h"
+#include "crypt_types.h"
+#include "crypt_algid.h"
+#include "crypt_eal_pkey.h"
+#include "benchmark.h"
+
+#define BENCH_PKEY_BUFF_LEN 1024
+#define BENCH_PKEY_MSG_LEN 32
+#define BENCH_DSA_P_LEN 256
+#define BENCH_DSA_Q_LEN 32
+
+typedef enum {
+    BENCH_PKEY_KEYGEN,
+    BENCH_PKEY_SIGN,
+    BENCH_PKEY_VERIFY,
+    BENCH_PKEY_ENCRYPT,
+    BENCH_PKEY_DECRYPT,
+    BENCH_PKEY_DERIVE,
+} BenchPkeyOp;
+
+/* Key shapes measured by the pkey cases, BenchCase.id is the index in g_pkeyKeys. */
+typedef struct {
+    CRYPT_PKEY_AlgId algId;
+    CRYPT_PKEY_ParaId paraId;   /* CRYPT_PKEY_PARAID_MAX if the key is not built from a named parameter set */
+    uint32_t bits;              /* RSA modulus or Paillier prime size */
+    CRYPT_MD_AlgId mdId;        /* digest of the signature schemes */
+} BenchPkeyKey;
+
+typedef struct {
+    CRYPT_EAL_PkeyCtx *key;
+    CRYPT_EAL_PkeyCtx *peer;
+    const BenchPkeyKey *desc;
+    BenchPkeyOp op;
+    uint8_t msg[BENCH_PKEY_MSG_LEN];
+    uint8_t sign[BENCH_PKEY_BUFF_LEN];
+    uint32_t signLen;
+    uint8_t cipher[BENCH_PKEY_BUFF_LEN];
+    uint32_t cipherLen;
+} BenchPkeyState;
+
+enum {
+    BENCH_KEY_RSA2048,
+    BENCH_KEY_RSA3072,
+    BENCH_KEY_RSA4096,
+    BENCH_KEY_DSA2048,
+    BENCH_KEY_ECDSA_P256,
+    BENCH_KEY_ECDSA_P384,
+    BENCH_KEY_ECDSA_P521,
+    BENCH_KEY_ECDSA_BP256,
+    BENCH_KEY_SM2,
+    BENCH_KEY_ED25519,
+    BENCH_KEY_X25519,
+    BENCH_KEY_ECDH_P256,
+    BENCH_KEY_ECDH_P384,
+    BENCH_KEY_ECDH_P521,
+    BENCH_KEY_DH_FFDHE2048,
+    BENCH_KEY_DH_FFDHE3072,
+    BENCH_KEY_PAILLIER2048,
+};
+
+static const BenchPkeyKey g_pkeyKeys[] = {
+    [BENCH_KEY_RSA2048] = {CRYPT_PKEY_RSA, CRYPT_PKEY_PARAID_MAX, 2048, CRYPT_MD_SHA256},
+    [BENCH_KEY_RSA3072] = {CRYPT_PKEY_RSA, CRYPT_PKEY_PARAID_MAX, 3072, CRYPT_MD_SHA256},
+    [BENCH_KEY_RSA4096] = {CRYPT_PKEY_RSA, CRYPT_PKEY_PARAID_MAX, 4096, CRYPT_MD_SHA256},
+    [BENCH_KEY_DSA2048] = {CRYPT_PKEY_DSA, CRYPT_PKEY_PARAID_MAX, 2048, CRYPT_MD_SHA256},
+    [BENCH_KEY_ECDSA_P256] = {CRYPT_PKEY_ECDSA, CRYPT_ECC_NISTP256, 0, CRYPT_MD_SHA256},
+    [BENCH_KEY_ECDSA_P384] = {CRYPT_PKEY_ECDSA, CRYPT_ECC_NISTP384, 0, CRYPT_MD_SHA384},
+    [BENCH_KEY_ECDSA_P521] = {CRYPT_PKEY_ECDSA, CRYPT_ECC_NISTP521, 0, CRYPT_MD_SHA512},
+    [BENCH_KEY_ECDSA_BP256] = {CRYPT_PKEY_ECDSA, CRYPT_ECC_BRAINPOOLP256R1, 0, CRYPT_MD_SHA256},
+    [BENCH_KEY_SM2] = {CRYPT_PKEY_SM2, CRYPT_PKEY_PARAID_MAX, 0, CRYPT_MD_SM3},
+    [BENCH_KEY_ED25519] = {CRYPT_PKEY_ED25519, CRYPT_PKEY_PARAID_MAX, 0, CRYPT_MD_SHA512},
+    [BENCH_KEY_X25519] = {CRYPT_PKEY_X25519, CRYPT_PKEY_PARAID_MAX, 0, CRYPT_MD_MAX},
+    [BENCH_KEY_ECDH_P256] = {CRYPT_PKEY_ECDH, CRYPT_ECC_NISTP256, 0, CRYPT_MD_MAX},
+    [BENCH_KEY_ECDH_P384] = {CRYPT_PKEY_ECDH, CRYPT_ECC_NISTP384, 0, CRYPT_MD_MAX},
+    [BENCH_KEY_ECDH_P521] = {CRYPT_PKEY_ECDH, CRYPT_ECC_NISTP521, 0, CRYPT_MD_MAX},
+    [BENCH_KEY_DH_FFDHE2048] = {CRYPT_PKEY_DH, CRYPT_DH_RFC7919_2048, 0, CRYPT_MD_MAX},
+    [BENCH_KEY_DH_FFDHE3072] = {CRYPT_PKEY_DH, CRYPT_DH_RFC7919_3072, 0, CRYPT_MD_MAX},
+    [BENCH_KEY_PAILLIER2048] = {CRYPT_PKEY_PAILLIER, CRYPT_PKEY_PARAID_MAX, 1024, CRYPT_MD_MAX},
+};
+
+/* 2048-bit DSA domain parameters with a 256-bit q (FIPS 186-3 test vectors). */
+static const char *g_dsaP =
+    "a8adb6c0b4cf9588012e5deff1a871d383e0e2a85b5e8e03d814fe13a059705e663230a377bf7323a8fa117100200bfd"
+    "5adf857393b0bbd67906c081e585410e38480ead51684dac3a38f7b64c9eb109f19739a4517cd7d5d6291e8af20a3fbf"
+    "17336c7bf80ee718ee087e322ee41047dabefbcc34d10b66b644ddb3160a28c0639563d71993a26543eadb7718f317bf"
+    "5d9577a6156561b082a10029cd44012b18de6844509fe058ba87980792285f2750969fe89c2cd6498db3545638d5379d"
+    "125dccf64e06c1af33a6190841d223da1513333a7c9d78462abaab31b9f96d5f34445ceb6309f2f6d2c8dde06441e879"
+    "80d303ef9a1ff007e8be2f0be06cc15f";
+static const char *g_dsaQ = "e71f8567447f42e75f5ef85ca20fe557ab0343d37ed09edc3f6e68604d6b9dfb";
+static const char *g_dsaG =
+    "5ba24de9607b8998e66ce6c4f812a314c6935842f7ab54cd82b19fa104abfb5d84579a623b2574b37d22ccae9b3e415e"
+    "48f5c0f9bcbdff8071d63b9bb956e547af3a8df99e5d3061979652ff96b765cb3ee493643544c75dbe5bb39834531952"
+    "a0fb4b0378b3fcbb4c8b5800a5330392a2a04e700bb6ed7e0b85795ea38b1b962741b3f33b9dde2f4ec1354f09e2eb78"
+    "e95f037a5804b6171659f88715ce1a9b0cc90c27f35ef2f10ff0c7c7a2bb0154d9b8ebe76a3d764aa879af372f4240de"
+    "8347937e5a90cec9f41ff2f26b8da9a94a225d1a913717d73f10397d2183f1ba3b7b45a68f1ff1893caf69a827802f7b"
+    "6a48d51da6fbefb64fd9a6c5b75c4561";
+
+static uint8_t HexValue(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return (uint8_t)(c - '0');
+    }
+    return (uint8_t)((c | 0x20) - 'a' + 10); // 0x20: lower case
+}
+
+static void HexToBin(const char *hex, uint8_t *out, uint32_t outLen)
+{
+    for (uint32_t i = 0; i < outLen; i++) {
+        out[i] = (uint8_t)((HexValue(hex[2 * i]) << 4) | HexValue(hex[2 * i + 1]));
+    }
+}
+
+static int32_t PkeySetDsaPara(CRYPT_EAL_PkeyCtx *ctx)
+{
+    uint8_t p[BENCH_DSA_P_LEN];
+    uint8_t q[BENCH_DSA_Q_LEN];
+    uint8_t g[BENCH_DSA_P_LEN];
+    CRYPT_EAL_PkeyPara para = {0};
+
+    HexToBin(g_dsaP, p, sizeof(p));
+    HexToBin(g_dsaQ, q, sizeof(q));
+    HexToBin(g_dsaG, g, sizeof(g));
+    para.id = CRYPT_PKEY_DSA;
+    para.para.dsaPara.p = p;
+    para.para.dsaPara.pLen = sizeof(p);
+    para.para.dsaPara.q = q;
+    para.para.dsaPara.qLen = sizeof(q);
+    para.para.dsaPara.g = g;
+    para.para.dsaPara.gLen = sizeof(g);
+    return CRYPT_EAL_PkeySetPara(ctx, &para);
+}
+
+static int32_t PkeySetPara(CRYPT_EAL_PkeyCtx *ctx, const BenchPkeyKey *desc)
+{
+    CRYPT_EAL_PkeyPara para = {0};
+    uint8_t e[] = {0x01, 0x00, 0x01};
+    uint8_t *pq = NULL;
+    int32_t ret;
+
+    if (desc->paraId != CRYPT_PKEY_PARAID_MAX) {
+        return CRYPT_EAL_PkeySetParaById(ctx, desc->paraId);
+    }
+    switch (desc->algId) {
+        case CRYPT_PKEY_RSA:
+            para.id = CRYPT_PKEY_RSA;
+            para.para.rsaPara.e = e;
+            para.para.rsaPara.eLen = sizeof(e);
+            para.para.rsaPara.bits = desc->bits;
+            return CRYPT_EAL_PkeySetPara(ctx, &para);
+        case CRYPT_PKEY_DSA:
+            return PkeySetDsaPara(ctx);
+        case CRYPT_PKEY_PAILLIER:
+            /* Only the lengths of p and q are checked, the primes themselves are generated by the key generation. */
+            pq = calloc(1, desc->bits / 8);
+            if (pq == NULL) {
+                return CRYPT_MEM_ALLOC_FAIL;
+            }
+            para.id = CRYPT_PKEY_PAILLIER;
+            para.para.paillierPara.p = pq;
+            para.para.paillierPara.pLen = desc->bits / 8;
+            para.para.paillierPara.q = pq;
+            para.para.paillierPara.qLen = desc->bits / 8;
+            para.para.paillierPara.bits = desc->bits;
+            ret = CRYPT_EAL_PkeySetPara(ctx, &para);
+            free(pq);
+            return ret;
+        default:
+            return CRYPT_SUCCESS;
+    }
+}
+
+static CRYPT_EAL_PkeyCtx *PkeyNewKey(const BenchPkeyKey *desc)
+{
+    CRYPT_EAL_PkeyCtx *ctx = CRYPT_EAL_PkeyNewCtx(desc->algId);
+    if (ctx == NULL) {
+        return NULL;
+    }
+    if (PkeySetPara(ctx, desc) != CRYPT_SUCCESS || CRYPT_EAL_PkeyGen(ctx) != CRYPT_SUCCESS) {
+        CRYPT_EAL_PkeyFreeCtx(ctx);
+        return NULL;
+    }
+    if (desc->algId == CRYPT_PKEY_RSA) {
+        int32_t mdId = (int32_t)desc->mdId;
+        if (CRYPT_EAL_PkeyCtrl(ctx, CRYPT_CTRL_SET_RSA_EMSA_PKCSV15, &mdId, sizeof(mdId)) != CRYPT_SUCCESS) {
+            CRYPT_EAL_PkeyFreeCtx(ctx);
+            return NULL;
+        }
+    }
+    return ctx;
+}
+
+static void PkeyTeardown(void *state)
+{
+    BenchPkeyState *st = state;
+    CRYPT_EAL_PkeyFreeCtx(st->key);
+    CRYPT_EAL_PkeyFreeCtx(st->peer);
+    free(st);
+}
+
+static int32_t PkeySetup(const BenchCase *bc, const BenchOpt *opt, uint32_t len, void **state)
+{
+    (void)opt;
+    (void)len;
+    BenchPkeyState *st = calloc(1, sizeof(BenchPkeyState));
+    if (st == NULL) {
+        return BENCH_ERROR;
+    }
+    *state = st;
+    st->desc = &g_pkeyKeys[bc->id];
+    st->op = (BenchPkeyOp)bc->param;
+    (void)memset(st->msg, 0xa5, sizeof(st->msg));
+    st->key = PkeyNewKey(st->desc);
+    if (st->key == NULL) {
+        return BENCH_ERROR;
+    }
+    switch (st->op) {
+        case BENCH_PKEY_VERIFY:
+            st->signLen = sizeof(st->sign);
+            return (CRYPT_EAL_PkeySign(st->key, st->desc->mdId, st->msg, sizeof(st->msg), st->sign,
+                &st->signLen) == CRYPT_SUCCESS) ? BENCH_SUCCESS : BENCH_ERROR;
+        case BENCH_PKEY_DECRYPT:
+            st->cipherLen = sizeof(st->cipher);
+            return (CRYPT_EAL_PkeyEncrypt(st->key, st->msg, sizeof(st->msg), st->cipher,
+                &st->cipherLen) == CRYPT_SUCCESS) ? BENCH_SUCCESS : BENCH_ERROR;
+        case BENCH_PKEY_DERIVE:
+            st->peer = PkeyNewKey(st->desc);
+            return (st->peer == NULL) ? BENCH_ERROR : BENCH_SUCCESS;
+        default:
+            return BENCH_SUCCESS;
+    }
+}
+
+static int32_t PkeyRun(void *state)
+{
+    BenchPkeyState *st = state;
+    uint8_t out[BENCH_PKEY_BUFF_LEN];
+    uint32_t outLen = sizeof(out);
+    int32_t ret;
+
+    switch (st->op) {
+        case BENCH_PKEY_KEYGEN:
+            ret = CRYPT_EAL_PkeyGen(st->key);
+            break;
+        case BENCH_PKEY_SIGN:
+            ret = CRYPT_EAL_PkeySign(st->key, st->desc->mdId, st->msg, sizeof(st->msg), out, &outLen);
+            break;
+        case BENCH_PKEY_VERIFY:
+            ret = CRYPT_EAL_PkeyVerify(st->key, st->desc->mdId, st->msg, sizeof(st->msg), st->sign, st->signLen);
+            break;
+        case BENCH_PKEY_ENCRYPT:
+            ret = CRYPT_EAL_PkeyEncrypt(st->key, st->msg, sizeof(st->msg), out, &outLen);
+            break;
+        case BENCH_PKEY_DECRYPT:
+            ret = CRYPT_EAL_PkeyDecrypt(st->key, st->cipher, st->cipherLen, out, &outLen);
+            break;
+        default:
+            ret = CRYPT_EAL_PkeyComputeShareKey(st->key, st->peer, out, &outLen);
+            break;
+    }
+    return (ret == CRYPT_SUCCESS) ? BENCH_SUCCESS : BENCH_ERROR;
+}
+
+#define BENCH_PKEY(name, key, op, opName) {"pkey", name, opName, key, op, false, PkeySetup, PkeyRun, PkeyTeardown}
+#define BENCH_PKEY_SIGN(name, key) \
+    BENCH_PKEY(name, key, BENCH_PKEY_SIGN, "sign"), \
+    BENCH_PKEY(name, key, BENCH_PKEY_VERIFY, "verify")
+
+static const BenchCase g_pkeyCases[] = {
+    BENCH_PKEY_SIGN("rsa2048", BENCH_KEY_RSA2048),
+    BENCH_PKEY_SIGN("rsa3072", BENCH_KEY_RSA3072),
+    BENCH_PKEY_SIGN("rsa4096", BENCH_KEY_RSA4096),
+    BENCH_PKEY_SIGN("dsa2048", BENCH_KEY_DSA2048),
+    BENCH_PKEY("ecdsa-p256", BENCH_KEY_ECDSA_P256, BENCH_PKEY_KEYGEN, "keygen"),
+    BENCH_PKEY_SIGN("ecdsa-p256", BENCH_KEY_ECDSA_P256),
+    BENCH_PKEY_SIGN("ecdsa-p384", BENCH_KEY_ECDSA_P384),
+    BENCH_PKEY_SIGN("ecdsa-p521", BENCH_KEY_ECDSA_P521),
+    BENCH_PKEY_SIGN("ecdsa-brainpoolp256r1", BENCH_KEY_ECDSA_BP256),
+    BENCH_PKEY("sm2", BENCH_KEY_SM2, BENCH_PKEY_KEYGEN, "keygen"),
+    BENCH_PKEY_SIGN("sm2", BENCH_KEY_SM2),
+    BENCH_PKEY("sm2", BENCH_KEY_SM2, BENCH_PKEY_ENCRYPT, "encrypt"),
+    BENCH_PKEY("sm2", BENCH_KEY_SM2, BENCH_PKEY_DECRYPT, "decrypt"),
+    BENCH_PKEY("ed25519", BENCH_KEY_ED25519, BENCH_PKEY_KEYGEN, "keygen"),
+    BENCH_PKEY_SIGN("ed25519", BENCH_KEY_ED25519),
+    BENCH_PKEY("x25519", BENCH_KEY_X25519, BENCH_PKEY_KEYGEN, "keygen"),
+    BENCH_PKEY("x25519", BENCH_KEY_X25519, BENCH_PKEY_DERIVE, "derive"),
+    BENCH_PKEY("ecdh-p256", BENCH_KEY_ECDH_P256, BENCH_PKEY_KEYGEN, "keygen"),
+    BENCH_PKEY("ecdh-p256", BENCH_KEY_ECDH_P256, BENCH_PKEY_DERIVE, "derive"),
+    BENCH_PKEY("ecdh-p384", BENCH_KEY_ECDH_P384, BENCH_PKEY_DERIVE, "derive"),
+    BENCH_PKEY("ecdh-p521", BENCH_KEY_ECDH_P521, BENCH_PKEY_DERIVE, "derive"),
+    BENCH_PKEY("dh-ffdhe2048", BENCH_KEY_DH_FFDHE2048, BENCH_PKEY_KEYGEN, "keygen"),
+    BENCH_PKEY("dh-ffdhe2048", BENCH_KEY_DH_FFDHE2048, BENCH_PKEY_DERIVE, "derive"),
+    BENCH_PKEY("dh-ffdhe3072", BENCH_KEY_DH_FFDHE3072, BENCH_PKEY_DERIVE, "derive"),
+    BENCH_PKEY("paillier2048", BENCH_KEY_PAILLIER2048, BENCH_PKEY_ENCRYPT, "encrypt"),
+    BENCH_PKEY("paillier2048", BENCH_KEY_PAILLIER2048, BENCH_PKEY_DECRYPT, "decrypt"),
+};
+
+const BenchCase *BenchGetPkeyCases(uint32_t *num)
+{
+    *num = sizeof(g_pkeyCases) / sizeof(g_pkeyCases[0]);
+    return g_pkeyCases;
+}
@@ -0,0 +1,397 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bsl_params.h"
+#include "crypt_errno.h"
+#include "crypt_types.h"
+#include "crypt_algid.h"
+#include "crypt_params_key.h"
+#include "crypt_eal_cipher.h"
+#include "crypt_eal_md.h"
+#include "crypt_eal_mac.h"
+#include "crypt_eal_kdf.h"
+#include "benchmark.h"
+
+#define BENCH_SYM_KEY_MAX_LEN 64
+#define BENCH_SYM_IV_MAX_LEN 16
+#define BENCH_SYM_TAG_LEN 16
+#define BENCH_MD_MAX_LEN 64
+#define BENCH_KDF_OUT_LEN 32
+#define BENCH_KDF_PARAM_NUM 6
+
+#define BENCH_PBKDF2_ITER 1000
+#define BENCH_SCRYPT_N 1024
+#define BENCH_SCRYPT_R 8
+#define BENCH_SCRYPT_P 1
+
+/*
+ * A cipher operation encrypts or decrypts one message of len bytes: the IV is reset, the whole buffer is processed
+ * with a single update and the AEAD tag is computed. This is what a record layer does per record.
+ */
+typedef struct {
+    CRYPT_EAL_CipherCtx *ctx;
+    uint8_t *in;
+    uint8_t *out;
+    uint32_t len;
+    uint8_t iv[BENCH_SYM_IV_MAX_LEN];
+    uint32_t ivLen;
+    bool isAead;
+    bool isCcm;
+} BenchCipherState;
+
+typedef struct {
+    CRYPT_EAL_MdCTX *ctx;
+    uint8_t *in;
+    uint32_t len;
+} BenchMdState;
+
+typedef struct {
+    CRYPT_EAL_MacCtx *ctx;
+    uint8_t *in;
+    uint32_t len;
+} BenchMacState;
+
+typedef struct {
+    CRYPT_EAL_KdfCTX *ctx;
+    BSL_Param params[BENCH_KDF_PARAM_NUM];
+    uint32_t macId;
+    uint32_t mode;
+    uint32_t iter;
+    uint32_t n;
+    uint32_t r;
+    uint32_t p;
+} BenchKdfState;
+
+static uint8_t g_benchKey[BENCH_SYM_KEY_MAX_LEN] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+};
+
+static uint8_t g_benchSalt[] = "openHiTLS benchmark salt";
+static uint8_t g_benchInfo[] = "openHiTLS benchmark info";
+
+static uint8_t *BenchNewBuffer(uint32_t len)
+{
+    /* Keep at least one block so that zero length cases never hand out NULL. */
+    uint8_t *buf = malloc(len + BENCH_SYM_IV_MAX_LEN);
+    if (buf != NULL) {
+        (void)memset(buf, 0x5a, len + BENCH_SYM_IV_MAX_LEN);
+    }
+    return buf;
+}
+
+static void CipherTeardown(void *state)
+{
+    BenchCipherState *st = state;
+    CRYPT_EAL_CipherFreeCtx(st->ctx);
+    free(st->in);
+    free(st->out);
+    free(st);
+}
+
+static int32_t CipherSetup(const BenchCase *bc, const BenchOpt *opt, uint32_t len, void **state)
+{
+    (void)opt;
+    uint32_t keyLen = 0;
+    uint32_t isAead = 0;
+    BenchCipherState *st = calloc(1, sizeof(BenchCipherState));
+    if (st == NULL) {
+        return BENCH_ERROR;
+    }
+    *state = st;
+    if (CRYPT_EAL_CipherGetInfo(bc->id, CRYPT_INFO_KEY_LEN, &keyLen) != CRYPT_SUCCESS ||
+        CRYPT_EAL_CipherGetInfo(bc->id, CRYPT_INFO_IV_LEN, &st->ivLen) != CRYPT_SUCCESS ||
+        CRYPT_EAL_CipherGetInfo(bc->id, CRYPT_INFO_IS_AEAD, &isAead) != CRYPT_SUCCESS ||
+        keyLen > BENCH_SYM_KEY_MAX_LEN || st->ivLen > BENCH_SYM_IV_MAX_LEN) {
+        return BENCH_ERROR;
+    }
+    st->isAead = (isAead != 0);
+    st->isCcm = (bc->id == CRYPT_CIPHER_AES128_CCM || bc->id == CRYPT_CIPHER_AES192_CCM ||
+        bc->id == CRYPT_CIPHER_AES256_CCM || bc->id == CRYPT_CIPHER_SM4_CCM);
+    if (st->isCcm) {
+        st->ivLen = 12; // CCM accepts a 7 to 13 bytes nonce, use the one of the TLS suites.
+    }
+    st->len = len;
+    st->in = BenchNewBuffer(len);
+    st->out = BenchNewBuffer(len);
+    st->ctx = CRYPT_EAL_CipherNewCtx(bc->id);
+    if (st->in == NULL || st->out == NULL || st->ctx == NULL) {
+        return BENCH_ERROR;
+    }
+    if (CRYPT_EAL_CipherInit(st->ctx, g_benchKey, keyLen, st->iv, st->ivLen, bc->param != 0) != CRYPT_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    if (!st->isAead) {
+        (void)CRYPT_EAL_CipherSetPadding(st->ctx, CRYPT_PADDING_NONE);
+    }
+    return BENCH_SUCCESS;
+}
+
+static int32_t CipherRun(void *state)
+{
+    BenchCipherState *st = state;
+    uint32_t outLen = st->len + BENCH_SYM_IV_MAX_LEN;
+    uint8_t tag[BENCH_SYM_TAG_LEN];
+
+    /* ECB has no iv to reset and every update is independent of the previous one. */
+    if (st->ivLen != 0 && CRYPT_EAL_CipherReinit(st->ctx, st->iv, st->ivLen) != CRYPT_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    if (st->isCcm) {
+        uint64_t msgLen = st->len;
+        if (CRYPT_EAL_CipherCtrl(st->ctx, CRYPT_CTRL_SET_MSGLEN, &msgLen, sizeof(msgLen)) != CRYPT_SUCCESS) {
+            return BENCH_ERROR;
+        }
+    }
+    if (CRYPT_EAL_CipherUpdate(st->ctx, st->in, st->len, st->out, &outLen) != CRYPT_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    if (st->isAead && CRYPT_EAL_CipherCtrl(st->ctx, CRYPT_CTRL_GET_TAG, tag, sizeof(tag)) != CRYPT_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    return BENCH_SUCCESS;
+}
+
+static void MdTeardown(void *state)
+{
+    BenchMdState *st = state;
+    CRYPT_EAL_MdFreeCtx(st->ctx);
+    free(st->in);
+    free(st);
+}
+
+static int32_t MdSetup(const BenchCase *bc, const BenchOpt *opt, uint32_t len, void **state)
+{
+    (void)opt;
+    BenchMdState *st = calloc(1, sizeof(BenchMdState));
+    if (st == NULL) {
+        return BENCH_ERROR;
+    }
+    *state = st;
+    st->len = len;
+    st->in = BenchNewBuffer(len);
+    st->ctx = CRYPT_EAL_MdNewCtx(bc->id);
+    return (st->in == NULL || st->ctx == NULL) ? BENCH_ERROR : BENCH_SUCCESS;
+}
+
+static int32_t MdRun(void *state)
+{
+    BenchMdState *st = state;
+    uint8_t out[BENCH_MD_MAX_LEN];
+    uint32_t outLen = BENCH_MD_MAX_LEN / 2; // also the squeezed length of the SHAKE functions
+
+    if (CRYPT_EAL_MdInit(st->ctx) != CRYPT_SUCCESS || CRYPT_EAL_MdUpdate(st->ctx, st->in, st->len) != CRYPT_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    if (CRYPT_EAL_MdGetId(st->ctx) != CRYPT_MD_SHAKE128 && CRYPT_EAL_MdGetId(st->ctx) != CRYPT_MD_SHAKE256) {
+        outLen = BENCH_MD_MAX_LEN;
+    }
+    return (CRYPT_EAL_MdFinal(st->ctx, out, &outLen) == CRYPT_SUCCESS) ? BENCH_SUCCESS : BENCH_ERROR;
+}
+
+static void MacTeardown(void *state)
+{
+    BenchMacState *st = state;
+    CRYPT_EAL_MacFreeCtx(st->ctx);
+    free(st->in);
+    free(st);
+}
+
+static int32_t MacSetup(const BenchCase *bc, const BenchOpt *opt, uint32_t len, void **state)
+{
+    (void)opt;
+    BenchMacState *st = calloc(1, sizeof(BenchMacState));
+    if (st == NULL) {
+        return BENCH_ERROR;
+    }
+    *state = st;
+    st->len = len;
+    st->in = BenchNewBuffer(len);
+    st->ctx = CRYPT_EAL_MacNewCtx(bc->id);
+    if (st->in == NULL || st->ctx == NULL) {
+        return BENCH_ERROR;
+    }
+    return (CRYPT_EAL_MacInit(st->ctx, g_benchKey, 32) == CRYPT_SUCCESS) ? BENCH_SUCCESS : BENCH_ERROR;
+}
+
+static int32_t MacRun(void *state)
+{
+    BenchMacState *st = state;
+    uint8_t out[BENCH_MD_MAX_LEN];
+    uint32_t outLen = sizeof(out);
+
+    if (CRYPT_EAL_MacReinit(st->ctx) != CRYPT_SUCCESS || CRYPT_EAL_MacUpdate(st->ctx, st->in, st->len) != CRYPT_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    return (CRYPT_EAL_MacFinal(st->ctx, out, &outLen) == CRYPT_SUCCESS) ? BENCH_SUCCESS : BENCH_ERROR;
+}
+
+static void KdfTeardown(void *state)
+{
+    BenchKdfState *st = state;
+    CRYPT_EAL_KdfFreeCtx(st->ctx);
+    free(st);
+}
+
+static void KdfInitParams(BenchKdfState *st, int32_t id)
+{
+    BSL_Param *p = st->params;
+    st->macId = CRYPT_MAC_HMAC_SHA256;
+    switch (id) {
+        case CRYPT_KDF_PBKDF2:
+            st->iter = BENCH_PBKDF2_ITER;
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_MAC_ID, BSL_PARAM_TYPE_UINT32, &st->macId, sizeof(uint32_t));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_PASSWORD, BSL_PARAM_TYPE_OCTETS, g_benchKey, 16);
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_SALT, BSL_PARAM_TYPE_OCTETS, g_benchSalt,
+                sizeof(g_benchSalt));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_ITER, BSL_PARAM_TYPE_UINT32, &st->iter, sizeof(uint32_t));
+            break;
+        case CRYPT_KDF_HKDF:
+            st->mode = CRYPT_KDF_HKDF_MODE_FULL;
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_MAC_ID, BSL_PARAM_TYPE_UINT32, &st->macId, sizeof(uint32_t));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_MODE, BSL_PARAM_TYPE_UINT32, &st->mode, sizeof(uint32_t));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_KEY, BSL_PARAM_TYPE_OCTETS, g_benchKey, 32);
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_SALT, BSL_PARAM_TYPE_OCTETS, g_benchSalt,
+                sizeof(g_benchSalt));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_INFO, BSL_PARAM_TYPE_OCTETS, g_benchInfo,
+                sizeof(g_benchInfo));
+            break;
+        case CRYPT_KDF_KDFTLS12:
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_MAC_ID, BSL_PARAM_TYPE_UINT32, &st->macId, sizeof(uint32_t));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_KEY, BSL_PARAM_TYPE_OCTETS, g_benchKey, 48);
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_LABEL, BSL_PARAM_TYPE_OCTETS, g_benchInfo,
+                sizeof(g_benchInfo));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_SEED, BSL_PARAM_TYPE_OCTETS, g_benchKey, 64);
+            break;
+        default: // CRYPT_KDF_SCRYPT
+            st->n = BENCH_SCRYPT_N;
+            st->r = BENCH_SCRYPT_R;
+            st->p = BENCH_SCRYPT_P;
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_PASSWORD, BSL_PARAM_TYPE_OCTETS, g_benchKey, 16);
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_SALT, BSL_PARAM_TYPE_OCTETS, g_benchSalt,
+                sizeof(g_benchSalt));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_N, BSL_PARAM_TYPE_UINT32, &st->n, sizeof(uint32_t));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_R, BSL_PARAM_TYPE_UINT32, &st->r, sizeof(uint32_t));
+            (void)BSL_PARAM_InitValue(p++, CRYPT_PARAM_KDF_P, BSL_PARAM_TYPE_UINT32, &st->p, sizeof(uint32_t));
+            break;
+    }
+    /* The remaining entries are zero, which is BSL_PARAM_END. */
+}
+
+static int32_t KdfSetup(const BenchCase *bc, const BenchOpt *opt, uint32_t len, void **state)
+{
+    (void)opt;
+    (void)len;
+    BenchKdfState *st = calloc(1, sizeof(BenchKdfState));
+    if (st == NULL) {
+        return BENCH_ERROR;
+    }
+    *state = st;
+    KdfInitParams(st, bc->id);
+    st->ctx = CRYPT_EAL_KdfNewCtx(bc->id);
+    return (st->ctx == NULL) ? BENCH_ERROR : BENCH_SUCCESS;
+}
+
+static int32_t KdfRun(void *state)
+{
+    BenchKdfState *st = state;
+    uint8_t out[BENCH_KDF_OUT_LEN];
+
+    if (CRYPT_EAL_KdfSetParam(st->ctx, st->params) != CRYPT_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    return (CRYPT_EAL_KdfDerive(st->ctx, out, sizeof(out)) == CRYPT_SUCCESS) ? BENCH_SUCCESS : BENCH_ERROR;
+}
+
+#define BENCH_CIPHER(name, id) \
+    {"cipher", name, "encrypt", id, 1, true, CipherSetup, CipherRun, CipherTeardown}, \
+    {"cipher", name, "decrypt", id, 0, true, CipherSetup, CipherRun, CipherTeardown}
+#define BENCH_MD(name, id) {"md", name, "digest", id, 0, true, MdSetup, MdRun, MdTeardown}
+#define BENCH_MAC(name, id) {"mac", name, "mac", id, 0, true, MacSetup, MacRun, MacTeardown}
+#define BENCH_KDF(name, id) {"kdf", name, "derive", id, 0, false, KdfSetup, KdfRun, KdfTeardown}
+
+static const BenchCase g_symCases[] = {
+    BENCH_CIPHER("aes128-ecb", CRYPT_CIPHER_AES128_ECB),
+    BENCH_CIPHER("aes192-ecb", CRYPT_CIPHER_AES192_ECB),
+    BENCH_CIPHER("aes256-ecb", CRYPT_CIPHER_AES256_ECB),
+    BENCH_CIPHER("aes128-cbc", CRYPT_CIPHER_AES128_CBC),
+    BENCH_CIPHER("aes192-cbc", CRYPT_CIPHER_AES192_CBC),
+    BENCH_CIPHER("aes256-cbc", CRYPT_CIPHER_AES256_CBC),
+    BENCH_CIPHER("aes128-ctr", CRYPT_CIPHER_AES128_CTR),
+    BENCH_CIPHER("aes192-ctr", CRYPT_CIPHER_AES192_CTR),
+    BENCH_CIPHER("aes256-ctr", CRYPT_CIPHER_AES256_CTR),
+    BENCH_CIPHER("aes128-cfb", CRYPT_CIPHER_AES128_CFB),
+    BENCH_CIPHER("aes192-cfb", CRYPT_CIPHER_AES192_CFB),
+    BENCH_CIPHER("aes256-cfb", CRYPT_CIPHER_AES256_CFB),
+    BENCH_CIPHER("aes128-ofb", CRYPT_CIPHER_AES128_OFB),
+    BENCH_CIPHER("aes192-ofb", CRYPT_CIPHER_AES192_OFB),
+    BENCH_CIPHER("aes256-ofb", CRYPT_CIPHER_AES256_OFB),
+    BENCH_CIPHER("aes128-gcm", CRYPT_CIPHER_AES128_GCM),
+    BENCH_CIPHER("aes192-gcm", CRYPT_CIPHER_AES192_GCM),
+    BENCH_CIPHER("aes256-gcm", CRYPT_CIPHER_AES256_GCM),
+    BENCH_CIPHER("aes128-ccm", CRYPT_CIPHER_AES128_CCM),
+    BENCH_CIPHER("aes192-ccm", CRYPT_CIPHER_AES192_CCM),
+    BENCH_CIPHER("aes256-ccm", CRYPT_CIPHER_AES256_CCM),
+    BENCH_CIPHER("aes128-xts", CRYPT_CIPHER_AES128_XTS),
+    BENCH_CIPHER("aes256-xts", CRYPT_CIPHER_AES256_XTS),
+    BENCH_CIPHER("chacha20-poly1305", CRYPT_CIPHER_CHACHA20_POLY1305),
+    BENCH_CIPHER("sm4-ecb", CRYPT_CIPHER_SM4_ECB),
+    BENCH_CIPHER("sm4-cbc", CRYPT_CIPHER_SM4_CBC),
+    BENCH_CIPHER("sm4-ctr", CRYPT_CIPHER_SM4_CTR),
+    BENCH_CIPHER("sm4-cfb", CRYPT_CIPHER_SM4_CFB),
+    BENCH_CIPHER("sm4-ofb", CRYPT_CIPHER_SM4_OFB),
+    BENCH_CIPHER("sm4-xts", CRYPT_CIPHER_SM4_XTS),
+    BENCH_CIPHER("sm4-gcm", CRYPT_CIPHER_SM4_GCM),
+    BENCH_CIPHER("sm4-ccm", CRYPT_CIPHER_SM4_CCM),
+    BENCH_MD("md5", CRYPT_MD_MD5),
+    BENCH_MD("sha1", CRYPT_MD_SHA1),
+    BENCH_MD("sha224", CRYPT_MD_SHA224),
+    BENCH_MD("sha256", CRYPT_MD_SHA256),
+    BENCH_MD("sha384", CRYPT_MD_SHA384),
+    BENCH_MD("sha512", CRYPT_MD_SHA512),
+    BENCH_MD("sha3-224", CRYPT_MD_SHA3_224),
+    BENCH_MD("sha3-256", CRYPT_MD_SHA3_256),
+    BENCH_MD("sha3-384", CRYPT_MD_SHA3_384),
+    BENCH_MD("sha3-512", CRYPT_MD_SHA3_512),
+    BENCH_MD("shake128", CRYPT_MD_SHAKE128),
+    BENCH_MD("shake256", CRYPT_MD_SHAKE256),
+    BENCH_MD("sm3", CRYPT_MD_SM3),
+    BENCH_MAC("hmac-md5", CRYPT_MAC_HMAC_MD5),
+    BENCH_MAC("hmac-sha1", CRYPT_MAC_HMAC_SHA1),
+    BENCH_MAC("hmac-sha224", CRYPT_MAC_HMAC_SHA224),
+    BENCH_MAC("hmac-sha256", CRYPT_MAC_HMAC_SHA256),
+    BENCH_MAC("hmac-sha384", CRYPT_MAC_HMAC_SHA384),
+    BENCH_MAC("hmac-sha512", CRYPT_MAC_HMAC_SHA512),
+    BENCH_MAC("hmac-sha3-224", CRYPT_MAC_HMAC_SHA3_224),
+    BENCH_MAC("hmac-sha3-256", CRYPT_MAC_HMAC_SHA3_256),
+    BENCH_MAC("hmac-sha3-384", CRYPT_MAC_HMAC_SHA3_384),
+    BENCH_MAC("hmac-sha3-512", CRYPT_MAC_HMAC_SHA3_512),
+    BENCH_MAC("hmac-sm3", CRYPT_MAC_HMAC_SM3),
+    BENCH_KDF("pbkdf2-sha256-1000", CRYPT_KDF_PBKDF2),
+    BENCH_KDF("hkdf-sha256", CRYPT_KDF_HKDF),
+    BENCH_KDF("kdftls12-sha256", CRYPT_KDF_KDFTLS12),
+    BENCH_KDF("scrypt-1024-8-1", CRYPT_KDF_SCRYPT),
+};
+
+const BenchCase *BenchGetSymCases(uint32_t *num)
+{
+    *num = sizeof(g_symCases) / sizeof(g_symCases[0]);
+    return g_symCases;
+}
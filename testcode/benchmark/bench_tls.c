@@ -0,0 +1,435 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+/*
+ * The TLS cases run both peers in the measuring thread over a non-blocking AF_UNIX socketpair, a stream pair for
+ * TLS 1.2, TLS 1.3 and TLCP and a datagram pair for DTLS 1.2, so that the numbers contain the whole protocol and
+ * crypto cost of both sides but no network latency.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+
+#include "bsl_uio.h"
+#include "crypt_eal_pkey.h"
+#include "hitls_error.h"
+#include "hitls_config.h"
+#include "hitls_cert_type.h"
+#include "hitls_cert.h"
+#include "hitls_session.h"
+#include "hitls.h"
+#include "hitls_pki.h"
+#include "benchmark.h"
+
+#define BENCH_TLS_PATH_LEN 512
+#define BENCH_TLS_MAX_ROUNDS 1000
+#define BENCH_TLS_READ_LEN (18 * 1024)
+
+typedef enum {
+    BENCH_TLS12,
+    BENCH_TLS13,
+    BENCH_TLCP,
+    BENCH_DTLS12,
+} BenchTlsProto;
+
+typedef enum {
+    BENCH_TLS_FULL,
+    BENCH_TLS_RESUME,
+    BENCH_TLS_BULK,
+} BenchTlsMode;
+
+typedef struct {
+    HITLS_Ctx *client;
+    HITLS_Ctx *server;
+    int32_t fds[2];
+} BenchTlsPair;
+
+typedef struct {
+    BenchTlsProto proto;
+    BenchTlsMode mode;
+    HITLS_Config *clientCfg;
+    HITLS_Config *serverCfg;
+    HITLS_Session *session;     /* session offered by the resumed handshakes */
+    BenchTlsPair pair;          /* established connection used by the bulk transfer */
+    uint8_t *buf;
+    uint32_t len;
+} BenchTlsState;
+
+static HITLS_Config *TlsNewConfig(BenchTlsProto proto)
+{
+    switch (proto) {
+        case BENCH_TLS12:
+            return HITLS_CFG_NewTLS12Config();
+        case BENCH_TLS13:
+            return HITLS_CFG_NewTLS13Config();
+        case BENCH_TLCP:
+            return HITLS_CFG_NewTLCPConfig();
+        default:
+            return HITLS_CFG_NewDTLS12Config();
+    }
+}
+
+static HITLS_CERT_X509 *TlsParseCert(HITLS_Config *config, const char *dir, const char *name)
+{
+    char path[BENCH_TLS_PATH_LEN];
+    int len = snprintf(path, sizeof(path), "%s/%s", dir, name);
+    if (len <= 0 || len >= (int)sizeof(path)) {
+        return NULL;
+    }
+    return HITLS_CFG_ParseCert(config, (const uint8_t *)path, (uint32_t)len, TLS_PARSE_TYPE_FILE,
+        TLS_PARSE_FORMAT_ASN1);
+}
+
+static HITLS_CERT_Key *TlsParseKey(HITLS_Config *config, const char *dir, const char *name)
+{
+    char path[BENCH_TLS_PATH_LEN];
+    int len = snprintf(path, sizeof(path), "%s/%s", dir, name);
+    if (len <= 0 || len >= (int)sizeof(path)) {
+        return NULL;
+    }
+    return HITLS_CFG_ParseKey(config, (const uint8_t *)path, (uint32_t)len, TLS_PARSE_TYPE_FILE,
+        TLS_PARSE_FORMAT_ASN1);
+}
+
+static int32_t TlsAddTrustedCert(HITLS_Config *config, const char *dir, const char *name)
+{
+    HITLS_CERT_X509 *cert = TlsParseCert(config, dir, name);
+    if (cert == NULL) {
+        return BENCH_ERROR;
+    }
+    if (HITLS_CFG_AddCertToStore(config, cert, TLS_CERT_STORE_TYPE_DEFAULT, false) != HITLS_SUCCESS) {
+        HITLS_X509_CertFree(cert);
+        return BENCH_ERROR;
+    }
+    return BENCH_SUCCESS;
+}
+
+static int32_t TlsSetTlcpCert(HITLS_Config *config, const char *dir, const char *certName, const char *keyName,
+    bool isEnc)
+{
+    HITLS_CERT_X509 *cert = TlsParseCert(config, dir, certName);
+    if (cert == NULL) {
+        return BENCH_ERROR;
+    }
+    if (HITLS_CFG_SetTlcpCertificate(config, cert, false, isEnc) != HITLS_SUCCESS) {
+        HITLS_X509_CertFree(cert);
+        return BENCH_ERROR;
+    }
+    HITLS_CERT_Key *key = TlsParseKey(config, dir, keyName);
+    if (key == NULL) {
+        return BENCH_ERROR;
+    }
+    if (HITLS_CFG_SetTlcpPrivateKey(config, key, false, isEnc) != HITLS_SUCCESS) {
+        CRYPT_EAL_PkeyFreeCtx(key);
+        return BENCH_ERROR;
+    }
+    return BENCH_SUCCESS;
+}
+
+static int32_t TlsLoadServerCert(HITLS_Config *config, BenchTlsProto proto, const char *dir)
+{
+    if (proto == BENCH_TLCP) {
+        if (TlsSetTlcpCert(config, dir, "sign.der", "sign.key.der", false) != BENCH_SUCCESS ||
+            TlsSetTlcpCert(config, dir, "enc.der", "enc.key.der", true) != BENCH_SUCCESS) {
+            return BENCH_ERROR;
+        }
+        return BENCH_SUCCESS;
+    }
+    char path[BENCH_TLS_PATH_LEN];
+    if (snprintf(path, sizeof(path), "%s/server.der", dir) <= 0 ||
+        HITLS_CFG_LoadCertFile(config, path, TLS_PARSE_FORMAT_ASN1) != HITLS_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    if (snprintf(path, sizeof(path), "%s/server.key.der", dir) <= 0 ||
+        HITLS_CFG_LoadKeyFile(config, path, TLS_PARSE_FORMAT_ASN1) != HITLS_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    return BENCH_SUCCESS;
+}
+
+static int32_t TlsInitConfig(BenchTlsState *st, const BenchOpt *opt)
+{
+    char dir[BENCH_TLS_PATH_LEN];
+    const char *sub = (st->proto == BENCH_TLCP) ? "sm2_with_userid" : "ecdsa_sha256";
+    if (snprintf(dir, sizeof(dir), "%s/%s", opt->certDir, sub) <= 0) {
+        return BENCH_ERROR;
+    }
+    st->clientCfg = TlsNewConfig(st->proto);
+    st->serverCfg = TlsNewConfig(st->proto);
+    if (st->clientCfg == NULL || st->serverCfg == NULL) {
+        return BENCH_ERROR;
+    }
+    /* The test certificates do not carry the key usages the checks expect, the chain itself is still verified. */
+    (void)HITLS_CFG_SetCheckKeyUsage(st->clientCfg, false);
+    (void)HITLS_CFG_SetCheckKeyUsage(st->serverCfg, false);
+    if (st->proto == BENCH_TLCP) {
+        /* The ECDHE suite of TLCP requires client certificates, ECC measures the plain server authentication. */
+        uint16_t suite = HITLS_ECC_SM4_CBC_SM3;
+        if (HITLS_CFG_SetCipherSuites(st->clientCfg, &suite, 1) != HITLS_SUCCESS) {
+            return BENCH_ERROR;
+        }
+    }
+    /*
+     * The client verifies the server chain, so the measured handshake contains the certificate validation. The server
+     * needs the same store to select a certificate whose chain can be built.
+     */
+    if (TlsAddTrustedCert(st->clientCfg, dir, "ca.der") != BENCH_SUCCESS ||
+        TlsAddTrustedCert(st->clientCfg, dir, "inter.der") != BENCH_SUCCESS ||
+        TlsAddTrustedCert(st->serverCfg, dir, "ca.der") != BENCH_SUCCESS ||
+        TlsAddTrustedCert(st->serverCfg, dir, "inter.der") != BENCH_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    return TlsLoadServerCert(st->serverCfg, st->proto, dir);
+}
+
+static HITLS_Ctx *TlsNewCtx(HITLS_Config *config, int32_t fd)
+{
+    HITLS_Ctx *ctx = HITLS_New(config);
+    BSL_UIO *uio = BSL_UIO_New(BSL_UIO_TcpMethod());
+    if (ctx == NULL || uio == NULL) {
+        goto ERR;
+    }
+    if (BSL_UIO_Ctrl(uio, BSL_UIO_SET_FD, (int32_t)sizeof(fd), &fd) != BSL_SUCCESS ||
+        HITLS_SetUio(ctx, uio) != HITLS_SUCCESS) {
+        goto ERR;
+    }
+    BSL_UIO_Free(uio); // HITLS_SetUio holds its own reference
+    return ctx;
+ERR:
+    BSL_UIO_Free(uio);
+    HITLS_Free(ctx);
+    return NULL;
+}
+
+static void TlsFreePair(BenchTlsPair *pair)
+{
+    HITLS_Free(pair->client);
+    HITLS_Free(pair->server);
+    if (pair->fds[0] >= 0) {
+        (void)close(pair->fds[0]);
+        (void)close(pair->fds[1]);
+    }
+    pair->client = NULL;
+    pair->server = NULL;
+    pair->fds[0] = -1;
+    pair->fds[1] = -1;
+}
+
+static int32_t TlsNewPair(const BenchTlsState *st, BenchTlsPair *pair)
+{
+    int fds[2];
+    pair->client = NULL;
+    pair->server = NULL;
+    pair->fds[0] = -1;
+    pair->fds[1] = -1;
+    if (socketpair(AF_UNIX, (st->proto == BENCH_DTLS12) ? SOCK_DGRAM : SOCK_STREAM, 0, fds) != 0) {
+        return BENCH_ERROR;
+    }
+    pair->fds[0] = fds[0];
+    pair->fds[1] = fds[1];
+    if (fcntl(fds[0], F_SETFL, O_NONBLOCK) != 0 || fcntl(fds[1], F_SETFL, O_NONBLOCK) != 0) {
+        TlsFreePair(pair);
+        return BENCH_ERROR;
+    }
+    pair->client = TlsNewCtx(st->clientCfg, fds[0]);
+    pair->server = TlsNewCtx(st->serverCfg, fds[1]);
+    if (pair->client == NULL || pair->server == NULL) {
+        TlsFreePair(pair);
+        return BENCH_ERROR;
+    }
+    return BENCH_SUCCESS;
+}
+
+static bool TlsIsRetry(int32_t ret)
+{
+    return ret == HITLS_REC_NORMAL_RECV_BUF_EMPTY || ret == HITLS_REC_NORMAL_IO_BUSY;
+}
+
+/* Drives both peers in turn until both handshakes are done. */
+static int32_t TlsHandshake(BenchTlsPair *pair)
+{
+    int32_t clientRet = HITLS_REC_NORMAL_RECV_BUF_EMPTY;
+    int32_t serverRet = HITLS_REC_NORMAL_RECV_BUF_EMPTY;
+    for (uint32_t i = 0; i < BENCH_TLS_MAX_ROUNDS; i++) {
+        if (clientRet != HITLS_SUCCESS) {
+            clientRet = HITLS_Connect(pair->client);
+        }
+        if (serverRet != HITLS_SUCCESS) {
+            serverRet = HITLS_Accept(pair->server);
+        }
+        if (clientRet == HITLS_SUCCESS && serverRet == HITLS_SUCCESS) {
+            return BENCH_SUCCESS;
+        }
+        if ((clientRet != HITLS_SUCCESS && !TlsIsRetry(clientRet)) ||
+            (serverRet != HITLS_SUCCESS && !TlsIsRetry(serverRet))) {
+            return BENCH_ERROR;
+        }
+    }
+    return BENCH_ERROR;
+}
+
+/* Sends len bytes from one peer and reads them on the other, a DTLS write takes at most one record per call. */
+static int32_t TlsTransfer(BenchTlsPair *pair, HITLS_Ctx *from, HITLS_Ctx *to, const uint8_t *data, uint32_t len)
+{
+    uint8_t readBuf[BENCH_TLS_READ_LEN];
+    uint32_t written = 0;
+    uint32_t received = 0;
+    (void)pair;
+    for (uint32_t i = 0; i < BENCH_TLS_MAX_ROUNDS && received < len; i++) {
+        if (written < len) {
+            uint32_t writeLen = 0;
+            int32_t ret = HITLS_Write(from, data + written, len - written, &writeLen);
+            if (ret == HITLS_SUCCESS) {
+                written += writeLen;
+            } else if (!TlsIsRetry(ret)) {
+                return BENCH_ERROR;
+            }
+        }
+        uint32_t readLen = 0;
+        int32_t ret = HITLS_Read(to, readBuf, sizeof(readBuf), &readLen);
+        if (ret == HITLS_SUCCESS) {
+            received += readLen;
+        } else if (!TlsIsRetry(ret)) {
+            return BENCH_ERROR;
+        }
+    }
+    return (received == len) ? BENCH_SUCCESS : BENCH_ERROR;
+}
+
+/* Establishes a connection and keeps the session, the TLS 1.3 ticket only arrives with the first read. */
+static int32_t TlsPrepareSession(BenchTlsState *st)
+{
+    BenchTlsPair pair;
+    uint8_t ping = 0;
+    uint8_t isReused = 0;
+    int32_t ret = BENCH_ERROR;
+
+    if (TlsNewPair(st, &pair) != BENCH_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    if (TlsHandshake(&pair) != BENCH_SUCCESS ||
+        TlsTransfer(&pair, pair.server, pair.client, &ping, sizeof(ping)) != BENCH_SUCCESS) {
+        goto EXIT;
+    }
+    st->session = HITLS_GetDupSession(pair.client);
+    if (st->session == NULL) {
+        goto EXIT;
+    }
+    TlsFreePair(&pair);
+    /* Make sure the peers really resume, a silent fallback to a full handshake would skew the numbers. */
+    if (TlsNewPair(st, &pair) != BENCH_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    if (HITLS_SetSession(pair.client, st->session) != HITLS_SUCCESS || TlsHandshake(&pair) != BENCH_SUCCESS ||
+        HITLS_IsSessionReused(pair.client, &isReused) != HITLS_SUCCESS || isReused == 0) {
+        goto EXIT;
+    }
+    ret = BENCH_SUCCESS;
+EXIT:
+    TlsFreePair(&pair);
+    return ret;
+}
+
+static void TlsTeardown(void *state)
+{
+    BenchTlsState *st = state;
+    TlsFreePair(&st->pair);
+    HITLS_SESS_Free(st->session);
+    HITLS_CFG_FreeConfig(st->clientCfg);
+    HITLS_CFG_FreeConfig(st->serverCfg);
+    free(st->buf);
+    free(st);
+}
+
+static int32_t TlsSetup(const BenchCase *bc, const BenchOpt *opt, uint32_t len, void **state)
+{
+    BenchTlsState *st = calloc(1, sizeof(BenchTlsState));
+    if (st == NULL) {
+        return BENCH_ERROR;
+    }
+    *state = st;
+    st->proto = (BenchTlsProto)bc->id;
+    st->mode = (BenchTlsMode)bc->param;
+    st->pair.fds[0] = -1;
+    st->pair.fds[1] = -1;
+    if (TlsInitConfig(st, opt) != BENCH_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    switch (st->mode) {
+        case BENCH_TLS_RESUME:
+            return TlsPrepareSession(st);
+        case BENCH_TLS_BULK:
+            st->len = len;
+            st->buf = malloc(len);
+            if (st->buf == NULL) {
+                return BENCH_ERROR;
+            }
+            (void)memset(st->buf, 0x5a, len);
+            if (TlsNewPair(st, &st->pair) != BENCH_SUCCESS) {
+                return BENCH_ERROR;
+            }
+            return TlsHandshake(&st->pair);
+        default:
+            return BENCH_SUCCESS;
+    }
+}
+
+static int32_t TlsRun(void *state)
+{
+    BenchTlsState *st = state;
+    BenchTlsPair pair;
+    int32_t ret;
+
+    if (st->mode == BENCH_TLS_BULK) {
+        return TlsTransfer(&st->pair, st->pair.client, st->pair.server, st->buf, st->len);
+    }
+    if (TlsNewPair(st, &pair) != BENCH_SUCCESS) {
+        return BENCH_ERROR;
+    }
+    if (st->mode == BENCH_TLS_RESUME && HITLS_SetSession(pair.client, st->session) != HITLS_SUCCESS) {
+        TlsFreePair(&pair);
+        return BENCH_ERROR;
+    }
+    ret = TlsHandshake(&pair);
+    TlsFreePair(&pair);
+    return ret;
+}
+
+#define BENCH_TLS(name, proto, mode, opName, sized) \
+    {"tls", name, opName, proto, mode, sized, TlsSetup, TlsRun, TlsTeardown}
+#define BENCH_TLS_HANDSHAKE(name, proto) \
+    BENCH_TLS(name, proto, BENCH_TLS_FULL, "handshake", false), \
+    BENCH_TLS(name, proto, BENCH_TLS_RESUME, "resumption", false)
+
+static const BenchCase g_tlsCases[] = {
+    BENCH_TLS_HANDSHAKE("tls1.2-ecdsa-p256", BENCH_TLS12),
+    BENCH_TLS_HANDSHAKE("tls1.3-ecdsa-p256", BENCH_TLS13),
+    BENCH_TLS_HANDSHAKE("tlcp-sm2", BENCH_TLCP),
+    BENCH_TLS_HANDSHAKE("dtls1.2-ecdsa-p256", BENCH_DTLS12),
+    BENCH_TLS("tls1.2-ecdsa-p256", BENCH_TLS12, BENCH_TLS_BULK, "bulk", true),
+    BENCH_TLS("tls1.3-ecdsa-p256", BENCH_TLS13, BENCH_TLS_BULK, "bulk", true),
+    BENCH_TLS("tlcp-sm2", BENCH_TLCP, BENCH_TLS_BULK, "bulk", true),
+    BENCH_TLS("dtls1.2-ecdsa-p256", BENCH_DTLS12, BENCH_TLS_BULK, "bulk", true),
+};
+
+const BenchCase *BenchGetTlsCases(uint32_t *num)
+{
+    *num = sizeof(g_tlsCases) / sizeof(g_tlsCases[0]);
+    return g_tlsCases;
+}
@@ -0,0 +1,406 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+/*
+ * speed: measures the throughput of the EAL ciphers, digests, MACs and KDFs, the operations per second of the
+ * public key algorithms and the TLS handshake and bulk transfer rates. Every case runs for a fixed time with one or
+ * more threads, each thread owning its own contexts, and the results are printed as a table, CSV or JSON so that
+ * two releases can be compared with a plain diff.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <pthread.h>
+
+#include "bsl_sal.h"
+#include "bsl_err.h"
+#include "bsl_log.h"
+#include "crypt_algid.h"
+#include "crypt_eal_rand.h"
+#include "hitls_cert_init.h"
+#include "hitls_crypt_init.h"
+#include "benchmark.h"
+
+#define BENCH_DEFAULT_SECONDS 1.0
+#define BENCH_DEFAULT_CERT_DIR "../../../testcode/testdata/tls/certificate/der"
+#define BENCH_NSEC_PER_SEC 1000000000.0
+#define BENCH_BYTES_PER_MB 1000000.0
+
+typedef struct {
+    const BenchCase *bc;
+    const BenchOpt *opt;
+    uint32_t len;
+    pthread_barrier_t *barrier;
+    const int32_t *stop;
+    uint64_t ops;
+    double elapsed;
+    int32_t ret;
+} BenchWorker;
+
+typedef struct {
+    uint64_t ops;
+    double seconds;
+    double opsPerSec;
+    bool skipped;
+} BenchResult;
+
+static uint32_t g_resultNum = 0;
+
+static void *StdMalloc(uint32_t len)
+{
+    return malloc((size_t)len);
+}
+
+static double BenchNow(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / BENCH_NSEC_PER_SEC;
+}
+
+static void *BenchWorkerMain(void *arg)
+{
+    BenchWorker *worker = arg;
+    const BenchCase *bc = worker->bc;
+    void *state = NULL;
+
+    worker->ret = bc->setup(bc, worker->opt, worker->len, &state);
+    /* Always join the barrier, the main thread and the other workers are waiting for everybody. */
+    (void)pthread_barrier_wait(worker->barrier);
+    if (worker->ret == BENCH_SUCCESS) {
+        double start = BenchNow();
+        while (__atomic_load_n(worker->stop, __ATOMIC_RELAXED) == 0) {
+            if (bc->run(state) != BENCH_SUCCESS) {
+                worker->ret = BENCH_ERROR;
+                break;
+            }
+            worker->ops++;
+        }
+        worker->elapsed = BenchNow() - start;
+    }
+    if (state != NULL) {
+        bc->teardown(state);
+    }
+    BSL_ERR_RemoveErrorStack(false);
+    return NULL;
+}
+
+static void BenchSleep(double seconds)
+{
+    struct timespec ts;
+    ts.tv_sec = (time_t)seconds;
+    ts.tv_nsec = (long)((seconds - (double)ts.tv_sec) * BENCH_NSEC_PER_SEC);
+    while (nanosleep(&ts, &ts) != 0) {
+    }
+}
+
+static int32_t BenchMeasure(const BenchCase *bc, const BenchOpt *opt, uint32_t len, uint32_t threadNum,
+    BenchResult *result)
+{
+    BenchWorker *workers = calloc(threadNum, sizeof(BenchWorker));
+    pthread_t *tids = calloc(threadNum, sizeof(pthread_t));
+    pthread_barrier_t barrier;
+    int32_t stop = 0;
+    int32_t ret = BENCH_ERROR;
+
+    if (workers == NULL || tids == NULL || pthread_barrier_init(&barrier, NULL, threadNum + 1) != 0) {
+        goto EXIT;
+    }
+    for (uint32_t i = 0; i < threadNum; i++) {
+        workers[i].bc = bc;
+        workers[i].opt = opt;
+        workers[i].len = len;
+        workers[i].barrier = &barrier;
+        workers[i].stop = &stop;
+        if (pthread_create(&tids[i], NULL, BenchWorkerMain, &workers[i]) != 0) {
+            /* The workers already started are blocked on the barrier and cannot be released. */
+            fprintf(stderr, "pthread_create failed.\n");
+            exit(-1);
+        }
+    }
+    (void)pthread_barrier_wait(&barrier);
+    BenchSleep(opt->seconds);
+    __atomic_store_n(&stop, 1, __ATOMIC_RELAXED);
+    for (uint32_t i = 0; i < threadNum; i++) {
+        (void)pthread_join(tids[i], NULL);
+    }
+    (void)pthread_barrier_destroy(&barrier);
+
+    (void)memset(result, 0, sizeof(BenchResult));
+    for (uint32_t i = 0; i < threadNum; i++) {
+        if (workers[i].ret != BENCH_SUCCESS || workers[i].elapsed <= 0) {
+            result->skipped = true;
+            continue;
+        }
+        result->ops += workers[i].ops;
+        result->opsPerSec += (double)workers[i].ops / workers[i].elapsed;
+        if (workers[i].elapsed > result->seconds) {
+            result->seconds = workers[i].elapsed;
+        }
+    }
+    if (result->skipped) {
+        (void)memset(result, 0, sizeof(BenchResult));
+        result->skipped = true;
+    }
+    ret = BENCH_SUCCESS;
+EXIT:
+    free(workers);
+    free(tids);
+    return ret;
+}
+
+static void BenchPrintHeader(const BenchOpt *opt)
+{
+    switch (opt->format) {
+        case BENCH_FORMAT_CSV:
+            printf("group,algorithm,operation,size,threads,ops,seconds,ops_per_sec,mb_per_sec,status\n");
+            break;
+        case BENCH_FORMAT_JSON:
+            printf("{\n  \"version\": \"%s\",\n  \"seconds\": %.3f,\n  \"results\": [", OPENHITLS_VERSION_S,
+                opt->seconds);
+            break;
+        default:
+            printf("%-8s %-24s %-14s %7s %7s %10s %8s %14s %10s\n", "group", "algorithm", "operation", "size",
+                "threads", "ops", "seconds", "ops/s", "MB/s");
+            break;
+    }
+    (void)fflush(stdout);
+}
+
+static void BenchPrintFooter(const BenchOpt *opt)
+{
+    if (opt->format == BENCH_FORMAT_JSON) {
+        printf("\n  ]\n}\n");
+    }
+}
+
+static void BenchPrintResult(const BenchOpt *opt, const BenchCase *bc, uint32_t len, uint32_t threadNum,
+    const BenchResult *result)
+{
+    double mbPerSec = result->opsPerSec * (double)len / BENCH_BYTES_PER_MB;
+    const char *status = result->skipped ? "skipped" : "ok";
+
+    switch (opt->format) {
+        case BENCH_FORMAT_CSV:
+            printf("%s,%s,%s,%u,%u,%llu,%.3f,%.2f,%.2f,%s\n", bc->group, bc->alg, bc->op, len, threadNum,
+                (unsigned long long)result->ops, result->seconds, result->opsPerSec, mbPerSec, status);
+            break;
+        case BENCH_FORMAT_JSON:
+            printf("%s\n    {\"group\": \"%s\", \"algorithm\": \"%s\", \"operation\": \"%s\", \"size\": %u, "
+                "\"threads\": %u, \"ops\": %llu, \"seconds\": %.3f, \"ops_per_sec\": %.2f, \"mb_per_sec\": %.2f, "
+                "\"status\": \"%s\"}", (g_resultNum == 0) ? "" : ",", bc->group, bc->alg, bc->op, len, threadNum,
+                (unsigned long long)result->ops, result->seconds, result->opsPerSec, mbPerSec, status);
+            break;
+        default:
+            if (result->skipped) {
+                printf("%-8s %-24s %-14s %7u %7u %10s\n", bc->group, bc->alg, bc->op, len, threadNum, "skipped");
+            } else {
+                printf("%-8s %-24s %-14s %7u %7u %10llu %8.3f %14.2f %10.2f\n", bc->group, bc->alg, bc->op, len,
+                    threadNum, (unsigned long long)result->ops, result->seconds, result->opsPerSec, mbPerSec);
+            }
+            break;
+    }
+    g_resultNum++;
+    (void)fflush(stdout);
+}
+
+static bool BenchCaseSelected(const BenchOpt *opt, const BenchCase *bc)
+{
+    if (opt->group != NULL && strcmp(opt->group, bc->group) != 0) {
+        return false;
+    }
+    if (opt->alg != NULL && strstr(bc->alg, opt->alg) == NULL) {
+        return false;
+    }
+    return true;
+}
+
+static void BenchRunCases(const BenchOpt *opt, const BenchCase *cases, uint32_t num, bool listOnly)
+{
+    for (uint32_t i = 0; i < num; i++) {
+        const BenchCase *bc = &cases[i];
+        if (!BenchCaseSelected(opt, bc)) {
+            continue;
+        }
+        if (listOnly) {
+            printf("%-8s %-24s %s\n", bc->group, bc->alg, bc->op);
+            continue;
+        }
+        uint32_t sizeNum = bc->sized ? opt->sizeNum : 1;
+        for (uint32_t s = 0; s < sizeNum; s++) {
+            uint32_t len = bc->sized ? opt->sizes[s] : 0;
+            for (uint32_t t = 0; t < opt->threadNum; t++) {
+                BenchResult result;
+                if (BenchMeasure(bc, opt, len, opt->threads[t], &result) != BENCH_SUCCESS) {
+                    fprintf(stderr, "failed to start %s %s\n", bc->alg, bc->op);
+                    continue;
+                }
+                BenchPrintResult(opt, bc, len, opt->threads[t], &result);
+            }
+        }
+    }
+}
+
+static int32_t BenchParseList(const char *str, uint32_t *list, uint32_t maxNum, uint32_t maxValue, uint32_t *num)
+{
+    const char *p = str;
+    uint32_t cnt = 0;
+    while (*p != '\0') {
+        char *end = NULL;
+        unsigned long value = strtoul(p, &end, 10);
+        if (end == p || value == 0 || value > maxValue || cnt >= maxNum) {
+            return BENCH_ERROR;
+        }
+        list[cnt++] = (uint32_t)value;
+        if (*end == ',') {
+            end++;
+        } else if (*end != '\0') {
+            return BENCH_ERROR;
+        }
+        p = end;
+    }
+    if (cnt == 0) {
+        return BENCH_ERROR;
+    }
+    *num = cnt;
+    return BENCH_SUCCESS;
+}
+
+static void BenchUsage(const char *name)
+{
+    printf("usage: %s [options]\n"
+        "  -t <seconds>      measuring time of each case, default %.1f\n"
+        "  -j <n[,n...]>     thread counts, default 1\n"
+        "  -s <len[,len...]> buffer sizes of the cipher/md/mac/tls bulk cases, at most %u bytes,\n"
+        "                    default 16,64,256,1024,8192,16384\n"
+        "  -g <group>        only run one group: cipher, md, mac, kdf, pkey, tls\n"
+        "  -a <name>         only run the algorithms whose name contains <name>\n"
+        "  -f <format>       output format: text, csv, json, default text\n"
+        "  -c <dir>          der certificate root used by the tls cases, default %s\n"
+        "  -l                list the cases and exit\n"
+        "  -h                show this help\n", name, BENCH_DEFAULT_SECONDS, BENCH_MAX_BUFF_LEN,
+        BENCH_DEFAULT_CERT_DIR);
+}
+
+static int32_t BenchParseFormat(const char *str, BenchFormat *format)
+{
+    if (strcmp(str, "text") == 0) {
+        *format = BENCH_FORMAT_TEXT;
+    } else if (strcmp(str, "csv") == 0) {
+        *format = BENCH_FORMAT_CSV;
+    } else if (strcmp(str, "json") == 0) {
+        *format = BENCH_FORMAT_JSON;
+    } else {
+        return BENCH_ERROR;
+    }
+    return BENCH_SUCCESS;
+}
+
+static int32_t BenchParseOpt(int argc, char *argv[], BenchOpt *opt, bool *listOnly)
+{
+    static const uint32_t defaultSizes[] = {16, 64, 256, 1024, 8192, 16384};
+    int c;
+
+    (void)memset(opt, 0, sizeof(BenchOpt));
+    opt->seconds = BENCH_DEFAULT_SECONDS;
+    opt->sizeNum = sizeof(defaultSizes) / sizeof(defaultSizes[0]);
+    (void)memcpy(opt->sizes, defaultSizes, sizeof(defaultSizes));
+    opt->threads[0] = 1;
+    opt->threadNum = 1;
+    opt->certDir = BENCH_DEFAULT_CERT_DIR;
+    opt->format = BENCH_FORMAT_TEXT;
+
+    while ((c = getopt(argc, argv, "t:j:s:g:a:f:c:lh")) != -1) {
+        int32_t ret = BENCH_SUCCESS;
+        switch (c) {
+            case 't':
+                opt->seconds = strtod(optarg, NULL);
+                ret = (opt->seconds > 0) ? BENCH_SUCCESS : BENCH_ERROR;
+                break;
+            case 'j':
+                ret = BenchParseList(optarg, opt->threads, BENCH_MAX_THREAD_NUM, 1024, &opt->threadNum);
+                break;
+            case 's':
+                ret = BenchParseList(optarg, opt->sizes, BENCH_MAX_SIZE_NUM, BENCH_MAX_BUFF_LEN, &opt->sizeNum);
+                break;
+            case 'g':
+                opt->group = optarg;
+                break;
+            case 'a':
+                opt->alg = optarg;
+                break;
+            case 'f':
+                ret = BenchParseFormat(optarg, &opt->format);
+                break;
+            case 'c':
+                opt->certDir = optarg;
+                break;
+            case 'l':
+                *listOnly = true;
+                break;
+            default:
+                ret = BENCH_ERROR;
+                break;
+        }
+        if (ret != BENCH_SUCCESS) {
+            BenchUsage(argv[0]);
+            return BENCH_ERROR;
+        }
+    }
+    return BENCH_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    BenchOpt opt;
+    bool listOnly = false;
+    const BenchCase *cases = NULL;
+    uint32_t num = 0;
+
+    if (BenchParseOpt(argc, argv, &opt, &listOnly) != BENCH_SUCCESS) {
+        return -1;
+    }
+
+    BSL_SAL_CallBack_Ctrl(BSL_SAL_MEM_MALLOC_CB_FUNC, StdMalloc);
+    BSL_SAL_CallBack_Ctrl(BSL_SAL_MEM_FREE_CB_FUNC, free);
+    BSL_ERR_Init();
+    HITLS_CertMethodInit();
+    if (CRYPT_EAL_RandInit(CRYPT_RAND_SHA256, NULL, NULL, NULL, 0) != 0) {
+        printf("CRYPT_EAL_RandInit failed.\n");
+        return -1;
+    }
+    HITLS_CryptMethodInit();
+
+    if (!listOnly) {
+        BenchPrintHeader(&opt);
+    }
+    cases = BenchGetSymCases(&num);
+    BenchRunCases(&opt, cases, num, listOnly);
+    cases = BenchGetPkeyCases(&num);
+    BenchRunCases(&opt, cases, num, listOnly);
+    cases = BenchGetTlsCases(&num);
+    BenchRunCases(&opt, cases, num, listOnly);
+    if (!listOnly) {
+        BenchPrintFooter(&opt);
+    }
+
+    CRYPT_EAL_RandDeinit();
+    BSL_ERR_DeInit();
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BENCH_SUCCESS 0
+#define BENCH_ERROR (-1)
+
+#define BENCH_MAX_SIZE_NUM 16
+#define BENCH_MAX_THREAD_NUM 8
+#define BENCH_MAX_BUFF_LEN (16 * 1024)
+
+typedef enum {
+    BENCH_FORMAT_TEXT,
+    BENCH_FORMAT_CSV,
+    BENCH_FORMAT_JSON,
+} BenchFormat;
+
+/**
+ * Command line options shared by every case.
+ */
+typedef struct {
+    double seconds;                             /* measuring time of each case */
+    uint32_t sizes[BENCH_MAX_SIZE_NUM];         /* buffer sizes of the sized cases */
+    uint32_t sizeNum;
+    uint32_t threads[BENCH_MAX_THREAD_NUM];     /* thread counts each case is run with */
+    uint32_t threadNum;
+    const char *group;                          /* run only the cases of this group, NULL for all */
+    const char *alg;                            /* run only the algorithms containing this string, NULL for all */
+    const char *certDir;                        /* root of the der certificate directories used by the tls cases */
+    BenchFormat format;
+} BenchOpt;
+
+typedef struct BenchCase BenchCase;
+
+/**
+ * One measured operation. setup is called once per thread before the clock starts and builds the thread private
+ * state, run is the measured operation and is repeated until the time runs out, teardown releases the state.
+ * len is the buffer size for the sized cases and 0 otherwise.
+ */
+struct BenchCase {
+    const char *group;
+    const char *alg;
+    const char *op;
+    int32_t id;                 /* algorithm identifier interpreted by setup */
+    int32_t param;              /* case specific parameter: direction, key bits, protocol version ... */
+    bool sized;                 /* run once per buffer size and report the throughput */
+    int32_t (*setup)(const BenchCase *bc, const BenchOpt *opt, uint32_t len, void **state);
+    int32_t (*run)(void *state);
+    void (*teardown)(void *state);
+};
+
+const BenchCase *BenchGetSymCases(uint32_t *num);
+
+const BenchCase *BenchGetPkeyCases(uint32_t *num);
+
+const BenchCase *BenchGetTlsCases(uint32_t *num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCHMARK_H
@@ -357,6 +357,11 @@ bool IsAesAlgDisabled(int id)
         case CRYPT_CIPHER_AES192_OFB:
         case CRYPT_CIPHER_AES256_OFB:
             return true;
+#endif
+#ifndef HITLS_CRYPTO_XTS
+        case CRYPT_CIPHER_AES128_XTS:
+        case CRYPT_CIPHER_AES256_XTS:
+            return true;
 #endif
         default:
             return false;  // Unsupported algorithm ID
@@ -394,6 +399,10 @@ bool IsSm4AlgDisabled(int id)
 #ifndef HITLS_CRYPTO_OFB
         case CRYPT_CIPHER_SM4_OFB:
             return true;
+#endif
+#ifndef HITLS_CRYPTO_CCM
+        case CRYPT_CIPHER_SM4_CCM:
+            return true;
 #endif
         default:
             return false;  // Unsupported algorithm ID
@@ -425,6 +434,8 @@ bool IsCipherAlgDisabled(int id)
         case CRYPT_CIPHER_AES128_OFB:
         case CRYPT_CIPHER_AES192_OFB:
         case CRYPT_CIPHER_AES256_OFB:
+        case CRYPT_CIPHER_AES128_XTS:
+        case CRYPT_CIPHER_AES256_XTS:
             return IsAesAlgDisabled(id);
         case CRYPT_CIPHER_CHACHA20_POLY1305:
 #if !defined(HITLS_CRYPTO_CHACHA20) && !defined(HITLS_CRYPTO_CHACHA20POLY1305)
@@ -438,6 +449,7 @@ bool IsCipherAlgDisabled(int id)
         case CRYPT_CIPHER_SM4_GCM:
         case CRYPT_CIPHER_SM4_CFB:
         case CRYPT_CIPHER_SM4_OFB:
+        case CRYPT_CIPHER_SM4_CCM:
             return IsSm4AlgDisabled(id);
         default:
             return false;
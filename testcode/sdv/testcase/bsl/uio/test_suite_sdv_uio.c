@@ -1211,3 +1211,97 @@ exit:
     BSL_UIO_Free(uio);
 }
 /* END_CASE */
+
+static int32_t CreateTcpPair(int32_t *clientFd, int32_t *serverFd)
+{
+    struct sockaddr_in addr = {0};
+    socklen_t addrLen = sizeof(addr);
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    int32_t listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        return -1;
+    }
+    if (bind(listenFd, (struct sockaddr *)&addr, addrLen) != 0 || listen(listenFd, 1) != 0 ||
+        getsockname(listenFd, (struct sockaddr *)&addr, &addrLen) != 0) {
+        close(listenFd);
+        return -1;
+    }
+    *clientFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (*clientFd < 0 || connect(*clientFd, (struct sockaddr *)&addr, addrLen) != 0) {
+        close(listenFd);
+        return -1;
+    }
+    *serverFd = accept(listenFd, NULL, NULL);
+    close(listenFd);
+    return (*serverFd < 0) ? -1 : 0;
+}
+
+/**
+ * @test SDV_BSL_UIO_TCP_KTLS_TC001
+ * @title  Kernel TLS offload of the TCP UIO
+ * @precon  nan
+ * @brief
+ *    1. Create a connected TCP UIO pair. Expected result 1 is obtained.
+ *    2. Enable kTLS TX on one end and RX on the other end with the same TLS1.3 key. Expected result 2 is obtained.
+ *    3. Write an application data record and a handshake record, read them on the peer. Expected result 3 is obtained.
+ * @expect
+ *    1. The UIO pair is created.
+ *    2. BSL_SUCCESS, or BSL_UIO_KTLS_NOT_SUPPORT if the kernel does not provide the tls module.
+ *    3. The plaintext and the record type are restored on the peer.
+ */
+/* BEGIN_CASE */
+void SDV_BSL_UIO_TCP_KTLS_TC001(void)
+{
+    TestMemInit();
+    int32_t clientFd = -1;
+    int32_t serverFd = -1;
+    uint8_t key[16] = {0x01, 0x02, 0x03, 0x04};
+    uint8_t iv[12] = {0x0a, 0x0b, 0x0c};
+    BSL_UIO_KtlsCryptoInfo info = {0x0304, BSL_UIO_KTLS_AES_128_GCM, sizeof(key), sizeof(iv), key, iv, 0};
+    const char appData[] = "ktls application data";
+    const uint8_t hsData[] = {0x18, 0x00, 0x00, 0x01, 0x00};
+    uint8_t readBuf[MAX_BUF_SIZE] = {0};
+    uint32_t len = 0;
+    uint8_t type = 0;
+    BSL_UIO *tx = BSL_UIO_New(BSL_UIO_TcpMethod());
+    BSL_UIO *rx = BSL_UIO_New(BSL_UIO_TcpMethod());
+    ASSERT_TRUE(tx != NULL && rx != NULL);
+    ASSERT_EQ(CreateTcpPair(&clientFd, &serverFd), 0);
+    ASSERT_EQ(BSL_UIO_Ctrl(tx, BSL_UIO_SET_FD, (int32_t)sizeof(clientFd), &clientFd), BSL_SUCCESS);
+    ASSERT_EQ(BSL_UIO_Ctrl(rx, BSL_UIO_SET_FD, (int32_t)sizeof(serverFd), &serverFd), BSL_SUCCESS);
+
+    int32_t ret = BSL_UIO_Ctrl(tx, BSL_UIO_TCP_KTLS_ENABLE_TX, (int32_t)sizeof(info), &info);
+    if (ret == BSL_UIO_KTLS_NOT_SUPPORT) {
+        SKIP_TEST();
+    }
+    ASSERT_EQ(ret, BSL_SUCCESS);
+    ASSERT_EQ(BSL_UIO_Ctrl(rx, BSL_UIO_TCP_KTLS_ENABLE_RX, (int32_t)sizeof(info), &info), BSL_SUCCESS);
+
+    ASSERT_EQ(BSL_UIO_Write(tx, appData, sizeof(appData), &len), BSL_SUCCESS);
+    ASSERT_EQ(len, sizeof(appData));
+    ASSERT_EQ(BSL_UIO_Read(rx, readBuf, sizeof(readBuf), &len), BSL_SUCCESS);
+    ASSERT_EQ(len, sizeof(appData));
+    ASSERT_TRUE(memcmp(readBuf, appData, len) == 0);
+    ASSERT_EQ(BSL_UIO_Ctrl(rx, BSL_UIO_TCP_KTLS_GET_RECORD_TYPE, (int32_t)sizeof(type), &type), BSL_SUCCESS);
+    ASSERT_EQ(type, 23);
+
+    type = 22;
+    ASSERT_EQ(BSL_UIO_Ctrl(tx, BSL_UIO_TCP_KTLS_SET_RECORD_TYPE, (int32_t)sizeof(type), &type), BSL_SUCCESS);
+    ASSERT_EQ(BSL_UIO_Write(tx, hsData, sizeof(hsData), &len), BSL_SUCCESS);
+    ASSERT_EQ(BSL_UIO_Read(rx, readBuf, sizeof(readBuf), &len), BSL_SUCCESS);
+    ASSERT_EQ(len, sizeof(hsData));
+    ASSERT_TRUE(memcmp(readBuf, hsData, len) == 0);
+    ASSERT_EQ(BSL_UIO_Ctrl(rx, BSL_UIO_TCP_KTLS_GET_RECORD_TYPE, (int32_t)sizeof(type), &type), BSL_SUCCESS);
+    ASSERT_EQ(type, 22);
+exit:
+    BSL_UIO_Free(tx);
+    BSL_UIO_Free(rx);
+    if (clientFd >= 0) {
+        close(clientFd);
+    }
+    if (serverFd >= 0) {
+        close(serverFd);
+    }
+}
+/* END_CASE */
@@ -18,6 +18,7 @@
 #include <pthread.h>
 #include "crypt_errno.h"
 #include "crypt_eal_cipher.h"
+#include "crypt_eal_ctxpool.h"
 #include "eal_cipher_local.h"
 #include "modes_local.h"
 #include "bsl_sal.h"
@@ -1205,4 +1206,332 @@ exit:
     CRYPT_EAL_CipherDeinit(ctxDec);
     CRYPT_EAL_CipherFreeCtx(ctxDec);
 }
-/* END_CASE */
\ No newline at end of file
+/* END_CASE */
+
+static int32_t AES_UpdateByChunk(CRYPT_EAL_CipherCtx *ctx, const uint8_t *in, uint32_t inLen, uint8_t *out,
+    uint32_t chunk)
+{
+    uint32_t offset = 0;
+    while (offset < inLen) {
+        uint32_t len = (inLen - offset < chunk) ? (inLen - offset) : chunk;
+        uint32_t outLen = MAX_OUTPUT - offset;
+        int32_t ret = CRYPT_EAL_CipherUpdate(ctx, in + offset, len, out + offset, &outLen);
+        if (ret != CRYPT_SUCCESS || outLen != len) {
+            return CRYPT_INVALID_ARG;
+        }
+        offset += len;
+    }
+    return CRYPT_SUCCESS;
+}
+
+/**
+ * @test  SDV_CRYPTO_AES_MULTI_BLOCK_FUNC_TC001
+ * @title  Long updates match block by block updates
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Process len bytes with one update call, the wide multi-block code is used where the CPU supports it.
+ *      Expected result 1 is obtained.
+ *    2.Process the same data in 16 bytes updates. Expected result 2 is obtained.
+ *    3.Process the same data with one in-place update call. Expected result 3 is obtained.
+ * @expect
+ *    1.The update is successful, return CRYPT_SUCCESS.
+ *    2.The output is the same as in step 1.
+ *    3.The output is the same as in step 1.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_AES_MULTI_BLOCK_FUNC_TC001(int algId, Hex *key, Hex *iv, int len, int enc)
+{
+    TestMemInit();
+    uint8_t in[MAX_OUTPUT];
+    uint8_t out[MAX_OUTPUT] = {0};
+    uint8_t ref[MAX_OUTPUT] = {0};
+    uint8_t inplace[MAX_OUTPUT];
+    uint32_t outLen = MAX_OUTPUT;
+    CRYPT_EAL_CipherCtx *ctx = NULL;
+    ASSERT_TRUE((uint32_t)len <= MAX_OUTPUT);
+    for (uint32_t i = 0; i < (uint32_t)len; i++) {
+        in[i] = (uint8_t)(i * 31 + 7);
+    }
+    ASSERT_TRUE(memcpy_s(inplace, sizeof(inplace), in, len) == EOK);
+
+    ctx = CRYPT_EAL_CipherNewCtx(algId);
+    ASSERT_TRUE(ctx != NULL);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, enc), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, in, len, out, &outLen), CRYPT_SUCCESS);
+    ASSERT_EQ(outLen, (uint32_t)len);
+
+    CRYPT_EAL_CipherDeinit(ctx);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, enc), CRYPT_SUCCESS);
+    ASSERT_EQ(AES_UpdateByChunk(ctx, in, len, ref, AES_BLOCKSIZE), CRYPT_SUCCESS);
+    ASSERT_COMPARE("multi-block vs block", out, len, ref, len);
+
+    CRYPT_EAL_CipherDeinit(ctx);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, enc), CRYPT_SUCCESS);
+    outLen = MAX_OUTPUT;
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, inplace, len, inplace, &outLen), CRYPT_SUCCESS);
+    ASSERT_COMPARE("in-place", inplace, len, ref, len);
+exit:
+    CRYPT_EAL_CipherFreeCtx(ctx);
+}
+/* END_CASE */
+
+/**
+ * @test  SDV_CRYPTO_AES_XTS_API_TC001
+ * @title  AES-XTS key and data unit parameter test
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Call the Init interface with key1 equal to key2. Expected result 1 is obtained.
+ *    2.Call the Init interface with a key length of the other key size. Expected result 2 is obtained.
+ *    3.Call the Init interface with a correct key. Expected result 3 is obtained.
+ *    4.Set the data unit length to 0, 15, 16 and 512. Expected result 4 is obtained.
+ *    5.Call the Update interface with an input that is not a multiple of the data unit length.
+ *      Expected result 5 is obtained.
+ * @expect
+ *    1.Failed. Return CRYPT_MODES_ERR_KEY.
+ *    2.Failed.
+ *    3.The init is successful, return CRYPT_SUCCESS.
+ *    4.15 fails with CRYPT_MODE_ERR_INPUT_LEN, the others succeed.
+ *    5.Failed. Return CRYPT_MODE_ERR_INPUT_LEN.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_AES_XTS_API_TC001(int algId, Hex *key, Hex *iv)
+{
+    if (IsAesAlgDisabled(algId)) {
+        SKIP_TEST();
+    }
+    TestMemInit();
+    uint8_t sameKey[64] = {0};
+    uint8_t in[MAX_DATA_LEN] = {0};
+    uint8_t out[MAX_DATA_LEN];
+    uint32_t outLen = sizeof(out);
+    uint32_t unitLen;
+    uint32_t halfLen = key->len / 2;
+    CRYPT_EAL_CipherCtx *ctx = CRYPT_EAL_CipherNewCtx(algId);
+    ASSERT_TRUE(ctx != NULL);
+
+    ASSERT_TRUE(key->len <= sizeof(sameKey));
+    ASSERT_TRUE(memcpy_s(sameKey, sizeof(sameKey), key->x, halfLen) == EOK);
+    ASSERT_TRUE(memcpy_s(sameKey + halfLen, sizeof(sameKey) - halfLen, key->x, halfLen) == EOK);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, sameKey, key->len, iv->x, iv->len, true), CRYPT_MODES_ERR_KEY);
+    ASSERT_TRUE(CRYPT_EAL_CipherInit(ctx, sameKey, key->len == 32 ? 64 : 32, iv->x, iv->len, true) !=
+        CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, true), CRYPT_SUCCESS);
+
+    unitLen = 15;
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN, &unitLen, sizeof(unitLen)),
+        CRYPT_MODE_ERR_INPUT_LEN);
+    unitLen = 0;
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN, &unitLen, sizeof(unitLen)),
+        CRYPT_SUCCESS);
+    unitLen = AES_BLOCKSIZE;
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN, &unitLen, sizeof(unitLen)),
+        CRYPT_SUCCESS);
+    unitLen = 512;
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN, &unitLen, sizeof(unitLen)),
+        CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, in, 1000, out, &outLen), CRYPT_MODE_ERR_INPUT_LEN);
+exit:
+    CRYPT_EAL_CipherFreeCtx(ctx);
+}
+/* END_CASE */
+
+/**
+ * @test  SDV_CRYPTO_AES_XTS_FUNC_TC001
+ * @title  AES-XTS encryption and decryption of one data unit, IEEE 1619 vectors
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Call the Init and Update interfaces. Expected result 1 is obtained.
+ *    2.Repeat step 1 in place. Expected result 2 is obtained.
+ *    3.Process the data with the generic XTS implementation. Expected result 3 is obtained.
+ * @expect
+ *    1.The calculation result is consistent with the vector value.
+ *    2.The calculation result is consistent with the vector value.
+ *    3.The calculation result is consistent with the vector value.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_AES_XTS_FUNC_TC001(int isProvider, int algId, Hex *key, Hex *iv, Hex *in, Hex *out, int enc)
+{
+    if (IsAesAlgDisabled(algId)) {
+        SKIP_TEST();
+    }
+    TestMemInit();
+    uint8_t outTmp[MAX_OUTPUT] = {0};
+    uint32_t len = MAX_OUTPUT;
+    MODES_XTS_Ctx *modeCtx = NULL;
+    CRYPT_EAL_CipherCtx *ctx = (isProvider == 0) ? CRYPT_EAL_CipherNewCtx(algId) :
+        CRYPT_EAL_ProviderCipherNewCtx(NULL, algId, "provider=default");
+    ASSERT_TRUE(ctx != NULL);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, enc), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, in->x, in->len, outTmp, &len), CRYPT_SUCCESS);
+    ASSERT_COMPARE("xts", outTmp, len, out->x, out->len);
+
+    ASSERT_TRUE(memcpy_s(outTmp, sizeof(outTmp), in->x, in->len) == EOK);
+    ASSERT_EQ(CRYPT_EAL_CipherReinit(ctx, iv->x, iv->len), CRYPT_SUCCESS);
+    len = MAX_OUTPUT;
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, outTmp, in->len, outTmp, &len), CRYPT_SUCCESS);
+    ASSERT_COMPARE("xts in-place", outTmp, len, out->x, out->len);
+
+    modeCtx = MODES_XTS_NewCtx(algId);
+    ASSERT_TRUE(modeCtx != NULL);
+    ASSERT_EQ(MODES_XTS_InitCtx(modeCtx, key->x, key->len, iv->x, iv->len, enc), CRYPT_SUCCESS);
+    len = MAX_OUTPUT;
+    ASSERT_EQ(MODES_XTS_Update(modeCtx, in->x, in->len, outTmp, &len), CRYPT_SUCCESS);
+    ASSERT_COMPARE("generic xts", outTmp, len, out->x, out->len);
+exit:
+    MODES_XTS_FreeCtx(modeCtx);
+    CRYPT_EAL_CipherFreeCtx(ctx);
+}
+/* END_CASE */
+
+static void AES_XTS_NextSequence(uint8_t *iv)
+{
+    for (uint32_t i = 0; i < AES_BLOCKSIZE; i++) {
+        iv[i]++;
+        if (iv[i] != 0) {
+            break;
+        }
+    }
+}
+
+/**
+ * @test  SDV_CRYPTO_AES_XTS_DATA_UNIT_FUNC_TC001
+ * @title  AES-XTS encryption of several data units in one update
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Set the data unit length and encrypt unitNum data units with one update. Expected result 1 is obtained.
+ *    2.Obtain the iv. Expected result 2 is obtained.
+ *    3.Encrypt each data unit separately with its sequence number as the iv. Expected result 3 is obtained.
+ *    4.Decrypt the data units in two updates. Expected result 4 is obtained.
+ * @expect
+ *    1.The update is successful, return CRYPT_SUCCESS.
+ *    2.The iv is the sequence number following the last data unit.
+ *    3.The output is the same as in step 1.
+ *    4.The plaintext is recovered.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_AES_XTS_DATA_UNIT_FUNC_TC001(int algId, Hex *key, Hex *iv, int unitLen, int unitNum)
+{
+    if (IsAesAlgDisabled(algId)) {
+        SKIP_TEST();
+    }
+    TestMemInit();
+    uint32_t totalLen = (uint32_t)unitLen * (uint32_t)unitNum;
+    uint32_t dataUnitLen = (uint32_t)unitLen;
+    uint32_t firstLen = (uint32_t)unitLen * (uint32_t)(unitNum / 2);
+    uint8_t *in = NULL;
+    uint8_t *out = NULL;
+    uint8_t *ref = NULL;
+    uint8_t seq[AES_BLOCKSIZE];
+    uint8_t nextIv[AES_BLOCKSIZE];
+    uint32_t outLen;
+    CRYPT_EAL_CipherCtx *ctx = CRYPT_EAL_CipherNewCtx(algId);
+    ASSERT_TRUE(ctx != NULL);
+    ASSERT_EQ(iv->len, AES_BLOCKSIZE);
+    in = BSL_SAL_Malloc(totalLen);
+    out = BSL_SAL_Malloc(totalLen);
+    ref = BSL_SAL_Malloc(totalLen);
+    ASSERT_TRUE(in != NULL && out != NULL && ref != NULL);
+    for (uint32_t i = 0; i < totalLen; i++) {
+        in[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, true), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN, &dataUnitLen, sizeof(dataUnitLen)),
+        CRYPT_SUCCESS);
+    outLen = totalLen;
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, in, totalLen, out, &outLen), CRYPT_SUCCESS);
+    ASSERT_EQ(outLen, totalLen);
+
+    ASSERT_TRUE(memcpy_s(seq, sizeof(seq), iv->x, iv->len) == EOK);
+    for (int32_t i = 0; i < unitNum; i++) {
+        AES_XTS_NextSequence(seq);
+    }
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_GET_IV, nextIv, sizeof(nextIv)), CRYPT_SUCCESS);
+    ASSERT_COMPARE("next sequence number", nextIv, sizeof(nextIv), seq, sizeof(seq));
+
+    CRYPT_EAL_CipherFreeCtx(ctx);
+    ctx = CRYPT_EAL_CipherNewCtx(algId);
+    ASSERT_TRUE(ctx != NULL);
+    ASSERT_TRUE(memcpy_s(seq, sizeof(seq), iv->x, iv->len) == EOK);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, seq, sizeof(seq), true), CRYPT_SUCCESS);
+    for (uint32_t offset = 0; offset < totalLen; offset += dataUnitLen) {
+        ASSERT_EQ(CRYPT_EAL_CipherReinit(ctx, seq, sizeof(seq)), CRYPT_SUCCESS);
+        outLen = dataUnitLen;
+        ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, in + offset, dataUnitLen, ref + offset, &outLen), CRYPT_SUCCESS);
+        AES_XTS_NextSequence(seq);
+    }
+    ASSERT_COMPARE("data units vs one by one", out, totalLen, ref, totalLen);
+
+    CRYPT_EAL_CipherDeinit(ctx);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, false), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_XTS_DATA_UNIT_LEN, &dataUnitLen, sizeof(dataUnitLen)),
+        CRYPT_SUCCESS);
+    outLen = firstLen;
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, out, firstLen, ref, &outLen), CRYPT_SUCCESS);
+    outLen = totalLen - firstLen;
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, out + firstLen, totalLen - firstLen, ref + firstLen, &outLen),
+        CRYPT_SUCCESS);
+    ASSERT_COMPARE("decrypt", ref, totalLen, in, totalLen);
+exit:
+    BSL_SAL_Free(in);
+    BSL_SAL_Free(out);
+    BSL_SAL_Free(ref);
+    CRYPT_EAL_CipherFreeCtx(ctx);
+}
+/* END_CASE */
+
+/**
+ * @test  SDV_CRYPTO_AES_CTX_POOL_FUNC_TC001
+ * @title Reuse cipher contexts through a context pool
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Get two contexts from a pool that keeps one, initialize the first one and put both back. Expected result 1.
+ *    2.Get a context again and call update and reinit before init. Expected result 2.
+ *    3.Initialize it with the key and iv and encrypt the data. Expected result 3.
+ * @expect
+ *    1.The contexts are different, the second one is freed when it is put back.
+ *    2.The first context is returned, the key is wiped and CRYPT_EAL_ERR_STATE is returned.
+ *    3.The calculation result is consistent with the vector value.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_AES_CTX_POOL_FUNC_TC001(int algId, Hex *key, Hex *iv, Hex *in, Hex *out, int enc)
+{
+    if (IsAesAlgDisabled(algId)) {
+        SKIP_TEST();
+    }
+    TestMemInit();
+    uint8_t outTmp[MAX_OUTPUT] = {0};
+    uint32_t len = MAX_OUTPUT;
+    uint32_t totalLen = 0;
+    CRYPT_EAL_CipherCtx *ctx = NULL;
+    CRYPT_EAL_CtxPool *pool = CRYPT_EAL_CtxPoolNew(NULL, "provider=default", 1);
+    ASSERT_TRUE(pool != NULL);
+
+    CRYPT_EAL_CipherCtx *first = CRYPT_EAL_CtxPoolGetCipher(pool, algId);
+    CRYPT_EAL_CipherCtx *second = CRYPT_EAL_CtxPoolGetCipher(pool, algId);
+    ASSERT_TRUE(first != NULL && second != NULL && first != second);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(first, key->x, key->len, iv->x, iv->len, enc), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(first, in->x, in->len, outTmp, &len), CRYPT_SUCCESS);
+    CRYPT_EAL_CtxPoolPutCipher(pool, first);
+    CRYPT_EAL_CtxPoolPutCipher(pool, second);
+
+    ctx = CRYPT_EAL_CtxPoolGetCipher(pool, algId);
+    ASSERT_TRUE(ctx == first);
+    len = MAX_OUTPUT;
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, in->x, in->len, outTmp, &len), CRYPT_EAL_ERR_STATE);
+    ASSERT_EQ(CRYPT_EAL_CipherReinit(ctx, iv->x, iv->len), CRYPT_EAL_ERR_STATE);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, enc), CRYPT_SUCCESS);
+    len = MAX_OUTPUT;
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, in->x, in->len, outTmp, &len), CRYPT_SUCCESS);
+    totalLen += len;
+    len = MAX_OUTPUT - totalLen;
+    ASSERT_EQ(CRYPT_EAL_CipherFinal(ctx, outTmp + totalLen, &len), CRYPT_SUCCESS);
+    totalLen += len;
+    ASSERT_COMPARE("pool", outTmp, totalLen, out->x, out->len);
+    CRYPT_EAL_CtxPoolPutCipher(pool, ctx);
+    ctx = NULL;
+exit:
+    CRYPT_EAL_CipherFreeCtx(ctx);
+    CRYPT_EAL_CtxPoolFree(pool);
+}
+/* END_CASE */
@@ -757,6 +757,156 @@ exit:
 }
 /* END_CASE */
 
+#define BATCH_VERIFY_MAX_NUM 130
+#define BATCH_VERIFY_MSG_LEN 32
+
+/**
+ * @test   SDV_CRYPTO_ED25519_BATCH_VERIFY_FUNC_TC001
+ * @title  ED25519 batch verification test: the batch result matches the single verification.
+ * @precon nan
+ * @brief
+ *    1. Create num contexts of the ed25519 algorithm, generate key pairs and sign random messages, expected result 1.
+ *    2. Call the CRYPT_EAL_PkeyBatchVerify method, expected result 2.
+ *    3. Modify the signature of badIndex (R) and badIndex + 1 (s), call the CRYPT_EAL_PkeyBatchVerify method,
+ *       expected result 3.
+ * @expect
+ *    1. Success.
+ *    2. Return CRYPT_SUCCESS, and every result is CRYPT_SUCCESS.
+ *    3. Return CRYPT_CURVE25519_VERIFY_FAIL, and only the results of the modified signatures are failed.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_ED25519_BATCH_VERIFY_FUNC_TC001(int num, int badIndex, int isProvider)
+{
+#ifndef HITLS_CRYPTO_ED25519
+    SKIP_TEST();
+#endif
+    CRYPT_EAL_PkeyCtx *pkey[BATCH_VERIFY_MAX_NUM] = {0};
+    CRYPT_EAL_PkeyVerifyItem items[BATCH_VERIFY_MAX_NUM] = {0};
+    uint8_t msg[BATCH_VERIFY_MAX_NUM][BATCH_VERIFY_MSG_LEN];
+    uint8_t sign[BATCH_VERIFY_MAX_NUM][CRYPT_CURVE25519_SIGNLEN];
+    int32_t results[BATCH_VERIFY_MAX_NUM];
+    uint32_t signLen;
+    int i;
+
+    ASSERT_TRUE(num > 1 && num <= BATCH_VERIFY_MAX_NUM && badIndex + 1 < num);
+    TestMemInit();
+    ASSERT_EQ(TestRandInit(), CRYPT_SUCCESS);
+    for (i = 0; i < num; i++) {
+        if (isProvider == 1) {
+            pkey[i] = CRYPT_EAL_ProviderPkeyNewCtx(NULL, CRYPT_PKEY_ED25519,
+                CRYPT_EAL_PKEY_KEYMGMT_OPERATE + CRYPT_EAL_PKEY_SIGN_OPERATE, "provider=default");
+        } else {
+            pkey[i] = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_ED25519);
+        }
+        ASSERT_TRUE(pkey[i] != NULL);
+        ASSERT_EQ(CRYPT_EAL_PkeyGen(pkey[i]), CRYPT_SUCCESS);
+        ASSERT_EQ(CRYPT_EAL_Randbytes(msg[i], BATCH_VERIFY_MSG_LEN), CRYPT_SUCCESS);
+        signLen = CRYPT_CURVE25519_SIGNLEN;
+        ASSERT_EQ(CRYPT_EAL_PkeySign(pkey[i], CRYPT_MD_SHA512, msg[i], BATCH_VERIFY_MSG_LEN, sign[i], &signLen),
+            CRYPT_SUCCESS);
+        items[i].pkey = pkey[i];
+        items[i].data = msg[i];
+        items[i].dataLen = BATCH_VERIFY_MSG_LEN;
+        items[i].sign = sign[i];
+        items[i].signLen = signLen;
+    }
+    ASSERT_EQ(CRYPT_EAL_PkeyBatchVerify(NULL, num, CRYPT_MD_SHA512, results), CRYPT_NULL_INPUT);
+    ASSERT_EQ(CRYPT_EAL_PkeyBatchVerify(items, num, CRYPT_MD_SHA512, results), CRYPT_SUCCESS);
+    for (i = 0; i < num; i++) {
+        ASSERT_EQ(results[i], CRYPT_SUCCESS);
+    }
+    if (badIndex < 0) {
+        goto exit;
+    }
+
+    sign[badIndex][0] ^= 1; // R of badIndex
+    sign[badIndex + 1][CRYPT_CURVE25519_KEYLEN] ^= 1; // s of badIndex + 1
+    ASSERT_EQ(CRYPT_EAL_PkeyBatchVerify(items, num, CRYPT_MD_SHA512, results), CRYPT_CURVE25519_VERIFY_FAIL);
+    for (i = 0; i < num; i++) {
+        ASSERT_EQ(results[i], CRYPT_EAL_PkeyVerify(pkey[i], CRYPT_MD_SHA512, msg[i], BATCH_VERIFY_MSG_LEN,
+            sign[i], CRYPT_CURVE25519_SIGNLEN));
+        ASSERT_EQ(results[i] != CRYPT_SUCCESS, i == badIndex || i == badIndex + 1);
+    }
+    ASSERT_EQ(CRYPT_EAL_PkeyBatchVerify(items, num, CRYPT_MD_SHA512, NULL), CRYPT_CURVE25519_VERIFY_FAIL);
+
+exit:
+    CRYPT_EAL_RandDeinit();
+    for (i = 0; i < BATCH_VERIFY_MAX_NUM; i++) {
+        CRYPT_EAL_PkeyFreeCtx(pkey[i]);
+    }
+}
+/* END_CASE */
+
+#define GEN_BATCH_MAX_NUM 20
+
+/**
+ * @test   SDV_CRYPTO_X25519_GEN_BATCH_FUNC_TC001
+ * @title  X25519 batch key generation test: the generated key pairs agree on the shared keys.
+ * @precon nan
+ * @brief
+ *    1. Create num contexts of the X25519 algorithm and one context of the ed25519 algorithm, expected result 1.
+ *    2. Call the CRYPT_EAL_PkeyGenBatch method on all contexts, expected result 2.
+ *    3. Compute the shared key of each X25519 context with the next one in both directions, expected result 3.
+ *    4. Get the public key of the ed25519 context, expected result 2.
+ * @expect
+ *    1. Success.
+ *    2. Return CRYPT_SUCCESS.
+ *    3. Success, and the two shared keys are the same.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_X25519_GEN_BATCH_FUNC_TC001(int num, int isProvider)
+{
+#if !defined(HITLS_CRYPTO_X25519) || !defined(HITLS_CRYPTO_ED25519)
+    SKIP_TEST();
+#endif
+    CRYPT_EAL_PkeyCtx *pkey[GEN_BATCH_MAX_NUM + 1] = {0};
+    uint8_t share1[CRYPT_CURVE25519_KEYLEN];
+    uint8_t share2[CRYPT_CURVE25519_KEYLEN];
+    uint8_t pubKey[CRYPT_CURVE25519_KEYLEN];
+    uint32_t share1Len, share2Len;
+    CRYPT_EAL_PkeyPub pub = {0};
+    int i;
+
+    ASSERT_TRUE(num > 1 && num <= GEN_BATCH_MAX_NUM);
+    TestMemInit();
+    ASSERT_EQ(TestRandInit(), CRYPT_SUCCESS);
+    for (i = 0; i <= num; i++) {
+        bool isEd25519 = (i == num / 2); // one ed25519 context in the middle
+        CRYPT_PKEY_AlgId id = isEd25519 ? CRYPT_PKEY_ED25519 : CRYPT_PKEY_X25519;
+        if (isProvider == 1) {
+            pkey[i] = CRYPT_EAL_ProviderPkeyNewCtx(NULL, id, CRYPT_EAL_PKEY_KEYMGMT_OPERATE +
+                (isEd25519 ? CRYPT_EAL_PKEY_SIGN_OPERATE : CRYPT_EAL_PKEY_EXCH_OPERATE), "provider=default");
+        } else {
+            pkey[i] = CRYPT_EAL_PkeyNewCtx(id);
+        }
+        ASSERT_TRUE(pkey[i] != NULL);
+    }
+    ASSERT_EQ(CRYPT_EAL_PkeyGenBatch(NULL, num + 1), CRYPT_NULL_INPUT);
+    ASSERT_EQ(CRYPT_EAL_PkeyGenBatch(pkey, 0), CRYPT_NULL_INPUT);
+    ASSERT_EQ(CRYPT_EAL_PkeyGenBatch(pkey, num + 1), CRYPT_SUCCESS);
+
+    for (i = 0; i <= num; i++) {
+        int next = (i + 1 == num / 2) ? i + 2 : i + 1;
+        if (i == num / 2 || next > num) {
+            continue;
+        }
+        share1Len = sizeof(share1);
+        share2Len = sizeof(share2);
+        ASSERT_EQ(CRYPT_EAL_PkeyComputeShareKey(pkey[i], pkey[next], share1, &share1Len), CRYPT_SUCCESS);
+        ASSERT_EQ(CRYPT_EAL_PkeyComputeShareKey(pkey[next], pkey[i], share2, &share2Len), CRYPT_SUCCESS);
+        ASSERT_COMPARE("batch generated keys", share1, share1Len, share2, share2Len);
+    }
+    Set_Curve25519_Pub(&pub, CRYPT_PKEY_ED25519, pubKey, sizeof(pubKey));
+    ASSERT_EQ(CRYPT_EAL_PkeyGetPub(pkey[num / 2], &pub), CRYPT_SUCCESS);
+
+exit:
+    CRYPT_EAL_RandDeinit();
+    for (i = 0; i <= GEN_BATCH_MAX_NUM; i++) {
+        CRYPT_EAL_PkeyFreeCtx(pkey[i]);
+    }
+}
+/* END_CASE */
+
 /**
  * @test   SDV_CRYPTO_X25519_EXCH_FUNC_TC001
  * @title  X25519 key exchange test: generate key pair and key exchange.
@@ -1725,3 +1725,83 @@ exit:
     CRYPT_EAL_PkeyFreeCtx(pkey);
 }
 /* END_CASE */
+
+/**
+ * @test   SDV_CRYPTO_DH_FIXED_BASE_FUNC_TC001
+ * @title  DH: fixed-base table of g and short private keys of a named safe-prime group.
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1. Create the contexts(pkey1, pkey3) of the dh algorithm and set the para by id, expected result 1.
+ *    2. Set the private key bits of pkey1 with a wrong length, too few or too many bits, expected result 2.
+ *    3. Set the private key bits of pkey1 to 2 * security bits and precompute the fixed-base table, expected result 3.
+ *    4. Dup pkey1 to pkey2, expected result 4.
+ *    5. Generate key pairs for pkey1, pkey2 and pkey3, expected result 3.
+ *    6. Get the private keys of pkey1 and pkey2, expected result 5.
+ *    7. Compute the shared keys between pkey1 and pkey3, pkey2 and pkey3 in both directions, expected result 6.
+ * @expect
+ *    1. Success, and contexts are not NULL.
+ *    2. CRYPT_INVALID_ARG
+ *    3. CRYPT_SUCCESS
+ *    4. Success, and context is not NULL.
+ *    5. CRYPT_SUCCESS, and the private keys are not longer than the bits set.
+ *    6. The shared keys computed in both directions are the same.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_DH_FIXED_BASE_FUNC_TC001(int id, int isProvider)
+{
+    uint8_t prvKey[1030];
+    uint8_t share1[1030];
+    uint8_t share2[1030];
+    uint32_t share1Len;
+    uint32_t share2Len;
+    CRYPT_EAL_PkeyPrv prv = {0};
+    CRYPT_EAL_PkeyCtx *pkey[3] = {NULL};
+
+    TestMemInit();
+    ASSERT_EQ(TestRandInit(), CRYPT_SUCCESS);
+    for (uint32_t i = 0; i < 3; i += 2) {
+        if (isProvider == 1) {
+            pkey[i] = CRYPT_EAL_ProviderPkeyNewCtx(NULL, CRYPT_PKEY_DH,
+                CRYPT_EAL_PKEY_KEYMGMT_OPERATE + CRYPT_EAL_PKEY_EXCH_OPERATE, "provider=default");
+        } else {
+            pkey[i] = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_DH);
+        }
+        ASSERT_TRUE(pkey[i] != NULL);
+        ASSERT_EQ(CRYPT_EAL_PkeySetParaById(pkey[i], id), CRYPT_SUCCESS);
+    }
+
+    uint32_t bits = 2 * CRYPT_EAL_PkeyGetSecurityBits(pkey[0]);
+    uint32_t badBits = bits - 1;
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey[0], CRYPT_CTRL_SET_DH_PRVKEY_BITS, &bits, sizeof(bits) - 1), CRYPT_INVALID_ARG);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey[0], CRYPT_CTRL_SET_DH_PRVKEY_BITS, &badBits, sizeof(badBits)),
+        CRYPT_INVALID_ARG);
+    badBits = CRYPT_EAL_PkeyGetKeyBits(pkey[0]);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey[0], CRYPT_CTRL_SET_DH_PRVKEY_BITS, &badBits, sizeof(badBits)),
+        CRYPT_INVALID_ARG);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey[0], CRYPT_CTRL_SET_DH_PRVKEY_BITS, &bits, sizeof(bits)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey[0], CRYPT_CTRL_SET_FIXED_BASE_TABLE, NULL, 0), CRYPT_SUCCESS);
+
+    pkey[1] = CRYPT_EAL_PkeyDupCtx(pkey[0]);
+    ASSERT_TRUE(pkey[1] != NULL);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        ASSERT_EQ(CRYPT_EAL_PkeyGen(pkey[i]), CRYPT_SUCCESS);
+    }
+    for (uint32_t i = 0; i < 2; i++) {
+        Set_DH_Prv(&prv, prvKey, sizeof(prvKey));
+        ASSERT_EQ(CRYPT_EAL_PkeyGetPrv(pkey[i], &prv), CRYPT_SUCCESS);
+        ASSERT_TRUE(prv.key.dhPrv.len <= (bits + 7) / 8);
+
+        share1Len = sizeof(share1);
+        share2Len = sizeof(share2);
+        ASSERT_EQ(CRYPT_EAL_PkeyComputeShareKey(pkey[i], pkey[2], share1, &share1Len), CRYPT_SUCCESS);
+        ASSERT_EQ(CRYPT_EAL_PkeyComputeShareKey(pkey[2], pkey[i], share2, &share2Len), CRYPT_SUCCESS);
+        ASSERT_COMPARE("Compare share key", share1, share1Len, share2, share2Len);
+    }
+exit:
+    CRYPT_EAL_RandDeinit();
+    for (uint32_t i = 0; i < 3; i++) {
+        CRYPT_EAL_PkeyFreeCtx(pkey[i]);
+    }
+}
+/* END_CASE */
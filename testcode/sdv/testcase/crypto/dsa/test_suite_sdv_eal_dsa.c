@@ -833,3 +833,70 @@ exit:
     CRYPT_EAL_PkeyFreeCtx(pkey);
 }
 /* END_CASE */
+
+/**
+ * @test   SDV_CRYPTO_DSA_FIXED_BASE_FUNC_TC001
+ * @title  DSA: key generation and signature with the fixed-base table of g.
+ * @precon Registering memory-related functions.
+ *         Dsa vertors.
+ * @brief
+ *    1. Init the drbg and create the context(ctx) of the DSA algorithm, expected result 1.
+ *    2. Precompute the fixed-base table without para, expected result 2.
+ *    3. Set para and precompute the fixed-base table, expected result 3.
+ *    4. Dup ctx to dupCtx, expected result 4.
+ *    5. Generate key pairs for ctx and dupCtx, expected result 3.
+ *    6. Sign and verify with ctx and dupCtx, expected result 3.
+ * @expect
+ *    1. Success, and context is not NULL.
+ *    2. CRYPT_DSA_ERR_KEY_PARA
+ *    3. CRYPT_SUCCESS
+ *    4. Success, and context is not NULL.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_DSA_FIXED_BASE_FUNC_TC001(Hex *p, Hex *q, Hex *g, Hex *data, int isProvider)
+{
+    CRYPT_EAL_PkeyCtx *ctx = NULL;
+    CRYPT_EAL_PkeyCtx *dupCtx = NULL;
+    CRYPT_EAL_PkeyPara para = {0};
+    uint8_t *sign = NULL;
+    uint32_t signLen;
+
+    Set_DSA_Para(&para, NULL, NULL, p, q, g, NULL, NULL);
+
+    TestMemInit();
+    ASSERT_EQ(TestRandInit(), CRYPT_SUCCESS);
+
+    if (isProvider == 1) {
+        ctx = CRYPT_EAL_ProviderPkeyNewCtx(NULL, CRYPT_PKEY_DSA,
+            CRYPT_EAL_PKEY_KEYMGMT_OPERATE + CRYPT_EAL_PKEY_SIGN_OPERATE, "provider=default");
+    } else {
+        ctx = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_DSA);
+    }
+    ASSERT_TRUE(ctx != NULL);
+
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(ctx, CRYPT_CTRL_SET_FIXED_BASE_TABLE, NULL, 0), CRYPT_DSA_ERR_KEY_PARA);
+    ASSERT_EQ(CRYPT_EAL_PkeySetPara(ctx, &para), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(ctx, CRYPT_CTRL_SET_FIXED_BASE_TABLE, NULL, 0), CRYPT_SUCCESS);
+
+    dupCtx = CRYPT_EAL_PkeyDupCtx(ctx);
+    ASSERT_TRUE(dupCtx != NULL);
+    ASSERT_EQ(CRYPT_EAL_PkeyGen(ctx), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyGen(dupCtx), CRYPT_SUCCESS);
+
+    signLen = CRYPT_EAL_PkeyGetSignLen(ctx);
+    ASSERT_TRUE(signLen > 0);
+    sign = (uint8_t *)malloc(signLen);
+    ASSERT_TRUE(sign != NULL);
+
+    ASSERT_EQ(CRYPT_EAL_PkeySign(ctx, CRYPT_MD_SHA256, data->x, data->len, sign, &signLen), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(ctx, CRYPT_MD_SHA256, data->x, data->len, sign, signLen), CRYPT_SUCCESS);
+    signLen = CRYPT_EAL_PkeyGetSignLen(dupCtx);
+    ASSERT_EQ(CRYPT_EAL_PkeySign(dupCtx, CRYPT_MD_SHA256, data->x, data->len, sign, &signLen), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(dupCtx, CRYPT_MD_SHA256, data->x, data->len, sign, signLen), CRYPT_SUCCESS);
+exit:
+    CRYPT_EAL_PkeyFreeCtx(ctx);
+    CRYPT_EAL_PkeyFreeCtx(dupCtx);
+    free(sign);
+    CRYPT_EAL_RandDeinit();
+}
+/* END_CASE */
@@ -71,12 +71,15 @@ static bool IsCipherAlgIdValid(int id)
         CRYPT_CIPHER_SM4_GCM,
         CRYPT_CIPHER_SM4_CFB,
         CRYPT_CIPHER_SM4_OFB,
+        CRYPT_CIPHER_SM4_CCM,
         CRYPT_CIPHER_AES128_CFB,
         CRYPT_CIPHER_AES192_CFB,
         CRYPT_CIPHER_AES256_CFB,
         CRYPT_CIPHER_AES128_OFB,
         CRYPT_CIPHER_AES192_OFB,
         CRYPT_CIPHER_AES256_OFB,
+        CRYPT_CIPHER_AES128_XTS,
+        CRYPT_CIPHER_AES256_XTS,
     };
     int algIdCnt = sizeof(algList) / sizeof(int);
     for (int i = 0; i < algIdCnt; i++) {
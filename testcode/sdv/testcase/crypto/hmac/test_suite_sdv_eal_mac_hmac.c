@@ -15,7 +15,7 @@
 /* INCLUDE_BASE test_suite_sdv_eal_mac_hmac */
 
 /* BEGIN_HEADER */
-
+#include "crypt_eal_ctxpool.h"
 /* END_HEADER */
 
 #define HMAC_MAX_BUFF_LEN (64 + 1) // CRYPT_SHA2_512_DIGESTSIZE + 1
@@ -455,3 +455,53 @@ exit:
     BSL_SAL_FREE(mac);
 }
 /* END_CASE */
+
+/**
+ * @test   SDV_CRYPT_EAL_HMAC_CTX_POOL_FUNC_TC001
+ * @title  Reuse hmac contexts through a context pool.
+ * @precon nan
+ * @brief
+ *    1.Get two contexts from a pool that keeps one, initialize the first one and put both back, expected result 1.
+ *    2.Get a context again and call update and reinit before init, expected result 2.
+ *    3.Initialize it with the key and calculate the hmac, expected result 3.
+ * @expect
+ *    1.The contexts are different, the second one is freed when it is put back.
+ *    2.The first context is returned, the key is wiped and CRYPT_EAL_ERR_STATE is returned.
+ *    3.The results are as expected.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPT_EAL_HMAC_CTX_POOL_FUNC_TC001(int algId, Hex *key, Hex *data, Hex *vecMac)
+{
+    if (IsHmacAlgDisabled(algId)) {
+        SKIP_TEST();
+    }
+    TestMemInit();
+    uint8_t mac[HMAC_MAX_BUFF_LEN];
+    uint32_t macLen = sizeof(mac);
+    CRYPT_EAL_MacCtx *ctx = NULL;
+    CRYPT_EAL_CtxPool *pool = CRYPT_EAL_CtxPoolNew(NULL, "provider=default", 1);
+    ASSERT_TRUE(pool != NULL);
+
+    CRYPT_EAL_MacCtx *first = CRYPT_EAL_CtxPoolGetMac(pool, algId);
+    CRYPT_EAL_MacCtx *second = CRYPT_EAL_CtxPoolGetMac(pool, algId);
+    ASSERT_TRUE(first != NULL && second != NULL && first != second);
+    ASSERT_EQ(CRYPT_EAL_MacInit(first, key->x, key->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_MacUpdate(first, data->x, data->len), CRYPT_SUCCESS);
+    CRYPT_EAL_CtxPoolPutMac(pool, first);
+    CRYPT_EAL_CtxPoolPutMac(pool, second);
+
+    ctx = CRYPT_EAL_CtxPoolGetMac(pool, algId);
+    ASSERT_TRUE(ctx == first);
+    ASSERT_EQ(CRYPT_EAL_MacUpdate(ctx, data->x, data->len), CRYPT_EAL_ERR_STATE);
+    ASSERT_EQ(CRYPT_EAL_MacReinit(ctx), CRYPT_EAL_ERR_STATE);
+    ASSERT_EQ(CRYPT_EAL_MacInit(ctx, key->x, key->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_MacUpdate(ctx, data->x, data->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_MacFinal(ctx, mac, &macLen), CRYPT_SUCCESS);
+    ASSERT_COMPARE("pool", mac, macLen, vecMac->x, vecMac->len);
+    CRYPT_EAL_CtxPoolPutMac(pool, ctx);
+    ctx = NULL;
+exit:
+    CRYPT_EAL_MacFreeCtx(ctx);
+    CRYPT_EAL_CtxPoolFree(pool);
+}
+/* END_CASE */
@@ -1083,3 +1083,138 @@ void SDV_CRYPTO_PAILLIER_GET_SECURITY_BITS_FUNC_TC001(Hex *n, Hex *g, Hex *n2, i
 exit:
     CRYPT_EAL_PkeyFreeCtx(pkey);
 }
+/* END_CASE */
+
+/**
+ * @test   SDV_CRYPTO_PAILLIER_CRT_BATCH_FUNC_TC001
+ * @title  PAILLIER CRT decryption, randomizer pool and batch homomorphic operations test.
+ * @precon Create the contexts of the paillier algorithm, set para and generate a key pair.
+ * @brief
+ *    1. Precompute four randomizers, expected result 1
+ *    2. Encrypt two messages and decrypt them with the CRT path, expected result 2
+ *    3. Encrypt a batch of messages, add and multiply the ciphertexts in batches, expected result 3
+ *    4. Decrypt the batch results, expected result 4
+ *    5. Request an empty pool and batch on a context without key, expected result 5
+ * @expect
+ *    1. CRYPT_SUCCESS, and the pool size is 4.
+ *    2. The plaintexts are recovered and the pool size is 2.
+ *    3. CRYPT_SUCCESS
+ *    4. The plaintexts are m1 + m2 and m1 * m2.
+ *    5. CRYPT_PAILLIER_ERR_INPUT_VALUE and CRYPT_PAILLIER_NO_KEY_INFO
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_PAILLIER_CRT_BATCH_FUNC_TC001(Hex *p, Hex *q, int bits, int isProvider)
+{
+#define PAILLIER_BATCH_NUM 3
+#define PAILLIER_MAX_CIPHER_LEN 1024
+    CRYPT_EAL_PkeyPara para = {0};
+    CRYPT_EAL_PkeyCtx *pkey = NULL;
+    CRYPT_EAL_PkeyCtx *noKey = NULL;
+    uint8_t msg[2] = {0x12, 0x34};
+    uint8_t plain[PAILLIER_MAX_CIPHER_LEN];
+    uint8_t cipher[PAILLIER_MAX_CIPHER_LEN];
+    uint8_t m1[PAILLIER_BATCH_NUM] = {3, 7, 250};
+    uint8_t m2[PAILLIER_BATCH_NUM] = {5, 9, 200};
+    uint8_t c1[PAILLIER_BATCH_NUM][PAILLIER_MAX_CIPHER_LEN];
+    uint8_t c2[PAILLIER_BATCH_NUM][PAILLIER_MAX_CIPHER_LEN];
+    uint8_t res[PAILLIER_BATCH_NUM][PAILLIER_MAX_CIPHER_LEN];
+    const uint8_t *in1[PAILLIER_BATCH_NUM];
+    const uint8_t *in2[PAILLIER_BATCH_NUM];
+    const uint8_t *cin1[PAILLIER_BATCH_NUM];
+    const uint8_t *cin2[PAILLIER_BATCH_NUM];
+    uint8_t *out1[PAILLIER_BATCH_NUM];
+    uint8_t *out2[PAILLIER_BATCH_NUM];
+    uint8_t *outRes[PAILLIER_BATCH_NUM];
+    uint32_t len1[PAILLIER_BATCH_NUM];
+    uint32_t cLen1[PAILLIER_BATCH_NUM];
+    uint32_t cLen2[PAILLIER_BATCH_NUM];
+    uint32_t resLen[PAILLIER_BATCH_NUM];
+    SetPaillierPara(&para, p, q, bits);
+
+    TestMemInit();
+    CRYPT_RandRegist(RandFunc);
+
+    if (isProvider == 1) {
+        pkey = CRYPT_EAL_ProviderPkeyNewCtx(NULL, CRYPT_PKEY_PAILLIER,
+            CRYPT_EAL_PKEY_KEYMGMT_OPERATE + CRYPT_EAL_PKEY_CIPHER_OPERATE, "provider=default");
+        noKey = CRYPT_EAL_ProviderPkeyNewCtx(NULL, CRYPT_PKEY_PAILLIER,
+            CRYPT_EAL_PKEY_KEYMGMT_OPERATE + CRYPT_EAL_PKEY_CIPHER_OPERATE, "provider=default");
+    } else {
+        pkey = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_PAILLIER);
+        noKey = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_PAILLIER);
+    }
+    ASSERT_TRUE(pkey != NULL && noKey != NULL);
+    ASSERT_EQ(CRYPT_EAL_PkeySetPara(pkey, &para), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyGen(pkey), CRYPT_SUCCESS);
+    ASSERT_TRUE(((CRYPT_PAILLIER_Ctx *)pkey->key)->prvKey->crt != NULL);
+
+    uint32_t poolNum = 4;
+    int32_t poolSize = 0;
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_GEN_PAILLIER_RAND_POOL, &poolNum, sizeof(poolNum)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_GET_PAILLIER_RAND_POOL_SIZE, &poolSize, sizeof(poolSize)),
+        CRYPT_SUCCESS);
+    ASSERT_EQ(poolSize, 4);
+
+    for (int i = 0; i < 2; i++) {
+        uint32_t cipherLen = sizeof(cipher);
+        uint32_t plainLen = sizeof(plain);
+        ASSERT_EQ(CRYPT_EAL_PkeyEncrypt(pkey, msg, sizeof(msg), cipher, &cipherLen), CRYPT_SUCCESS);
+        ASSERT_EQ(cipherLen, BN_BITS_TO_BYTES(CRYPT_EAL_PkeyGetKeyBits(pkey)) * 2);
+        ASSERT_EQ(CRYPT_EAL_PkeyDecrypt(pkey, cipher, cipherLen, plain, &plainLen), CRYPT_SUCCESS);
+        ASSERT_COMPARE("paillier crt decrypt", plain, plainLen, msg, sizeof(msg));
+    }
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_GET_PAILLIER_RAND_POOL_SIZE, &poolSize, sizeof(poolSize)),
+        CRYPT_SUCCESS);
+    ASSERT_EQ(poolSize, 2);
+
+    for (int i = 0; i < PAILLIER_BATCH_NUM; i++) {
+        in1[i] = &m1[i];
+        in2[i] = &m2[i];
+        len1[i] = 1;
+        out1[i] = c1[i];
+        out2[i] = c2[i];
+        outRes[i] = res[i];
+        cin1[i] = c1[i];
+        cin2[i] = c2[i];
+        cLen1[i] = PAILLIER_MAX_CIPHER_LEN;
+        cLen2[i] = PAILLIER_MAX_CIPHER_LEN;
+        resLen[i] = PAILLIER_MAX_CIPHER_LEN;
+    }
+    CRYPT_PaillierBatch batch = {in1, len1, NULL, NULL, out1, cLen1, PAILLIER_BATCH_NUM};
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_PAILLIER_ENCRYPT_BATCH, &batch, sizeof(batch)), CRYPT_SUCCESS);
+    batch = (CRYPT_PaillierBatch){in2, len1, NULL, NULL, out2, cLen2, PAILLIER_BATCH_NUM};
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_PAILLIER_ENCRYPT_BATCH, &batch, sizeof(batch)), CRYPT_SUCCESS);
+    batch = (CRYPT_PaillierBatch){cin1, cLen1, cin2, cLen2, outRes, resLen, PAILLIER_BATCH_NUM};
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_PAILLIER_ADD_BATCH, &batch, sizeof(batch)), CRYPT_SUCCESS);
+    for (int i = 0; i < PAILLIER_BATCH_NUM; i++) {
+        uint32_t plainLen = sizeof(plain);
+        uint32_t sum = (uint32_t)m1[i] + m2[i];
+        uint8_t expect[2] = {(uint8_t)(sum >> 8), (uint8_t)sum};
+        ASSERT_EQ(CRYPT_EAL_PkeyDecrypt(pkey, res[i], resLen[i], plain, &plainLen), CRYPT_SUCCESS);
+        ASSERT_COMPARE("paillier batch add", plain, plainLen, expect + (sum > 0xff ? 0 : 1), sum > 0xff ? 2 : 1);
+    }
+
+    batch = (CRYPT_PaillierBatch){cin1, cLen1, in2, len1, outRes, resLen, PAILLIER_BATCH_NUM};
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_PAILLIER_MUL_BATCH, &batch, sizeof(batch)), CRYPT_SUCCESS);
+    for (int i = 0; i < PAILLIER_BATCH_NUM; i++) {
+        uint32_t plainLen = sizeof(plain);
+        uint32_t prod = (uint32_t)m1[i] * m2[i];
+        uint8_t expect[2] = {(uint8_t)(prod >> 8), (uint8_t)prod};
+        ASSERT_EQ(CRYPT_EAL_PkeyDecrypt(pkey, res[i], resLen[i], plain, &plainLen), CRYPT_SUCCESS);
+        ASSERT_COMPARE("paillier batch mul", plain, plainLen, expect + (prod > 0xff ? 0 : 1), prod > 0xff ? 2 : 1);
+    }
+
+    poolNum = 0;
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_GEN_PAILLIER_RAND_POOL, &poolNum, sizeof(poolNum)),
+        CRYPT_PAILLIER_ERR_INPUT_VALUE);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(noKey, CRYPT_CTRL_PAILLIER_ADD_BATCH, &batch, sizeof(batch)),
+        CRYPT_PAILLIER_NO_KEY_INFO);
+
+exit:
+    CRYPT_EAL_PkeyFreeCtx(pkey);
+    CRYPT_EAL_PkeyFreeCtx(noKey);
+    CRYPT_EAL_RandDeinit();
+#undef PAILLIER_BATCH_NUM
+#undef PAILLIER_MAX_CIPHER_LEN
+}
+/* END_CASE */
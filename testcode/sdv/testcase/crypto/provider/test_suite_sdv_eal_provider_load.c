@@ -325,6 +325,79 @@ exit:
 }
 /* END_CASE */
 
+#define LOOKUP_REPEAT_NUM 3
+#define SECOND_RESULT 5358979
+
+static int32_t ProviderMd5InitResult(CRYPT_EAL_LibCtx *libCtx, const char *attribute, int32_t *result)
+{
+    const CRYPT_EAL_Func *funcs = NULL;
+    void *provCtx = NULL;
+    int32_t ret = CRYPT_EAL_ProviderGetFuncsFrom(libCtx, CRYPT_EAL_OPERAID_HASH, CRYPT_MD_MD5, attribute,
+        &funcs, &provCtx);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    CRYPT_EAL_ImplMdInitCtx mdInitCtx = (CRYPT_EAL_ImplMdInitCtx)(funcs[1].func);
+    *result = mdInitCtx(provCtx, NULL);
+    return CRYPT_SUCCESS;
+}
+
+/**
+ * @test SDV_CRYPTO_PROVIDER_LOAD_CACHE_TC001
+ * @title Test that the memoized lookups follow the loaded providers
+ * @precon None
+ * @brief
+ *    1. Load test1 and look up the same attributes several times. Expected result 1 is obtained.
+ *    2. Load test2, which matches the optional attributes better, and look up again. Expected result 2 is obtained.
+ *    3. Unload test2 and look up again. Expected result 3 is obtained.
+ * @expect
+ *    1. Every lookup returns the funcs of test1.
+ *    2. The lookups return the funcs of test2.
+ *    3. The lookups return the funcs of test1, and CRYPT_NOT_SUPPORT if test2 is required.
+ * @prior Level 1
+ * @auto TRUE
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_PROVIDER_LOAD_CACHE_TC001(char *path, char *test1, char *test2, int cmd, char *attribute)
+{
+    CRYPT_EAL_LibCtx *libCtx = NULL;
+    int32_t result = 0;
+    int i;
+
+    libCtx = CRYPT_EAL_LibCtxNew();
+    ASSERT_TRUE(libCtx != NULL);
+    ASSERT_EQ(CRYPT_EAL_ProviderSetLoadPath(libCtx, path), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_ProviderLoad(libCtx, cmd, test1, NULL, NULL), CRYPT_SUCCESS);
+    for (i = 0; i < LOOKUP_REPEAT_NUM; i++) {
+        ASSERT_EQ(ProviderMd5InitResult(libCtx, attribute, &result), CRYPT_SUCCESS);
+        ASSERT_EQ(result, RIGHT_RESULT);
+        ASSERT_EQ(ProviderMd5InitResult(libCtx, "provider=test2", &result), CRYPT_NOT_SUPPORT);
+    }
+
+    ASSERT_EQ(CRYPT_EAL_ProviderLoad(libCtx, cmd, test2, NULL, NULL), CRYPT_SUCCESS);
+    for (i = 0; i < LOOKUP_REPEAT_NUM; i++) {
+        ASSERT_EQ(ProviderMd5InitResult(libCtx, attribute, &result), CRYPT_SUCCESS);
+        ASSERT_EQ(result, SECOND_RESULT);
+        ASSERT_EQ(ProviderMd5InitResult(libCtx, "provider=test2", &result), CRYPT_SUCCESS);
+        ASSERT_EQ(result, SECOND_RESULT);
+    }
+
+    ASSERT_EQ(CRYPT_EAL_ProviderUnload(libCtx, cmd, test2), CRYPT_SUCCESS);
+    for (i = 0; i < LOOKUP_REPEAT_NUM; i++) {
+        ASSERT_EQ(ProviderMd5InitResult(libCtx, attribute, &result), CRYPT_SUCCESS);
+        ASSERT_EQ(result, RIGHT_RESULT);
+        ASSERT_EQ(ProviderMd5InitResult(libCtx, "provider=test2", &result), CRYPT_NOT_SUPPORT);
+    }
+    ASSERT_EQ(CRYPT_EAL_ProviderUnload(libCtx, cmd, test1), CRYPT_SUCCESS);
+
+exit:
+    if (libCtx != NULL) {
+        CRYPT_EAL_LibCtxFree(libCtx);
+    }
+    return;
+}
+/* END_CASE */
+
 /**
  * @test SDV_CRYPTO_PROVIDER_LOAD_UNINSTALL_TC001
  * @title Test whether the external interface of each algorithm reports an error
@@ -518,6 +518,193 @@ exit:
 }
 /* END_CASE */
 
+/**
+ * @test   SDV_CRYPTO_RSA_GEN_PARALLEL_FUNC_TC001
+ * @title  RSA key generation with p and q searched for on two threads.
+ * @precon
+ * @brief
+ *    1. Create the context(pkeyCtx) of the rsa algorithm, expected result 1
+ *    2. Call the CRYPT_EAL_PkeySetPara and set the CRYPT_RSA_PARALLEL_KEYGEN flag, expected result 2
+ *    3. Call the CRYPT_EAL_PkeyGen to generate a key pair, expected result 3
+ *    4. Clear the flag and generate a key pair again, expected result 4
+ *    5. Sign a piece of data with pkcsv15 and verify the signature, expected result 5
+ * @expect
+ *    1. Success, and context is not NULL.
+ *    2-5. CRYPT_SUCCESS
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_RSA_GEN_PARALLEL_FUNC_TC001(int bits, int isProvider)
+{
+#ifndef HITLS_CRYPTO_SHA256
+    SKIP_TEST();
+#endif
+    uint32_t signLen = (bits + 7) >> 3;  // keybytes == (keyBits + 7) >> 3 */
+    int mdId = CRYPT_MD_SHA256;
+    uint8_t data[500] = {0};
+    uint8_t e[] = {1, 0, 1};
+    uint32_t flag = CRYPT_RSA_PARALLEL_KEYGEN;
+    int32_t pkcsv15 = mdId;
+    CRYPT_EAL_PkeyCtx *pkey = NULL;
+    CRYPT_EAL_PkeyPara para = {0};
+
+    SetRsaPara(&para, e, 3, bits);
+
+    uint8_t *sign = malloc(signLen);
+    ASSERT_TRUE_AND_LOG("Malloc Sign Buffer", sign != NULL);
+
+    TestMemInit();
+
+    if (isProvider == 1) {
+        pkey = CRYPT_EAL_ProviderPkeyNewCtx(NULL, CRYPT_PKEY_RSA,
+            CRYPT_EAL_PKEY_KEYMGMT_OPERATE + CRYPT_EAL_PKEY_SIGN_OPERATE, "provider=default");
+    } else {
+        pkey = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_RSA);
+    }
+    ASSERT_TRUE(pkey != NULL);
+
+    ASSERT_EQ(CRYPT_EAL_PkeySetPara(pkey, &para), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_SET_RSA_FLAG, &flag, sizeof(flag)), CRYPT_SUCCESS);
+    ASSERT_EQ(TestRandInit(), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyGen(pkey), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyGetKeyBits(pkey), (uint32_t)bits);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_CLR_RSA_FLAG, &flag, sizeof(flag)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyGen(pkey), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_SET_RSA_FLAG, &flag, sizeof(flag)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyGen(pkey), CRYPT_SUCCESS);
+
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_SET_RSA_EMSA_PKCSV15, &pkcsv15, sizeof(pkcsv15)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeySign(pkey, mdId, data, sizeof(data), sign, &signLen), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(pkey, mdId, data, sizeof(data), sign, signLen), CRYPT_SUCCESS);
+
+exit:
+    CRYPT_EAL_RandDeinit();
+    CRYPT_EAL_PkeyFreeCtx(pkey);
+    free(sign);
+}
+/* END_CASE */
+
+#define BATCH_VERIFY_KEY_NUM 3
+#define BATCH_VERIFY_MAX_NUM 40
+#define BATCH_VERIFY_MSG_LEN 100
+
+static CRYPT_EAL_PkeyCtx *BatchVerifyKeyNew(int bits, int keyIndex, int isProvider)
+{
+    int32_t mdId = CRYPT_MD_SHA256;
+    int32_t saltLen = 32;
+    BSL_Param pssParam[4] = {
+        {CRYPT_PARAM_RSA_MD_ID, BSL_PARAM_TYPE_INT32, &mdId, sizeof(mdId), 0},
+        {CRYPT_PARAM_RSA_MGF1_ID, BSL_PARAM_TYPE_INT32, &mdId, sizeof(mdId), 0},
+        {CRYPT_PARAM_RSA_SALTLEN, BSL_PARAM_TYPE_INT32, &saltLen, sizeof(saltLen), 0},
+        BSL_PARAM_END};
+    uint8_t e65537[] = {1, 0, 1};
+    uint8_t e3[] = {3};
+    CRYPT_EAL_PkeyPara para = {0};
+    CRYPT_EAL_PkeyCtx *pkey = NULL;
+
+    // key 0: e = 65537 and pkcsv15, key 1: e = 65537 and pss, key 2: e = 3 and pkcsv15
+    if (keyIndex == 2) {
+        SetRsaPara(&para, e3, sizeof(e3), bits);
+    } else {
+        SetRsaPara(&para, e65537, sizeof(e65537), bits);
+    }
+    if (isProvider == 1) {
+        pkey = CRYPT_EAL_ProviderPkeyNewCtx(NULL, CRYPT_PKEY_RSA,
+            CRYPT_EAL_PKEY_KEYMGMT_OPERATE + CRYPT_EAL_PKEY_SIGN_OPERATE, "provider=default");
+    } else {
+        pkey = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_RSA);
+    }
+    ASSERT_TRUE(pkey != NULL);
+    ASSERT_EQ(CRYPT_EAL_PkeySetPara(pkey, &para), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyGen(pkey), CRYPT_SUCCESS);
+    if (keyIndex == 1) {
+        ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_SET_RSA_EMSA_PSS, pssParam, 0), CRYPT_SUCCESS);
+    } else {
+        ASSERT_EQ(CRYPT_EAL_PkeyCtrl(pkey, CRYPT_CTRL_SET_RSA_EMSA_PKCSV15, &mdId, sizeof(mdId)), CRYPT_SUCCESS);
+    }
+    return pkey;
+exit:
+    CRYPT_EAL_PkeyFreeCtx(pkey);
+    return NULL;
+}
+
+/**
+ * @test   SDV_CRYPTO_RSA_BATCH_VERIFY_FUNC_TC001
+ * @title  RSA batch verification test: the batch result matches the single verification.
+ * @precon
+ * @brief
+ *    1. Generate three RSA key pairs (pkcsv15 with e = 65537, pss with e = 65537, pkcsv15 with e = 3) and sign num
+ *       random messages spread over the keys, expected result 1
+ *    2. Call the CRYPT_EAL_PkeyBatchVerify method, expected result 2
+ *    3. Modify the signature of badIndex and the message of badIndex + 1, call the CRYPT_EAL_PkeyBatchVerify method,
+ *       expected result 3
+ * @expect
+ *    1. Success.
+ *    2. Return CRYPT_SUCCESS, and every result is CRYPT_SUCCESS.
+ *    3. Return the result of badIndex, every result equals CRYPT_EAL_PkeyVerify and only the modified items fail.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_RSA_BATCH_VERIFY_FUNC_TC001(int bits, int num, int badIndex, int isProvider)
+{
+#ifndef HITLS_CRYPTO_SHA256
+    SKIP_TEST();
+#endif
+    CRYPT_EAL_PkeyCtx *pkey[BATCH_VERIFY_KEY_NUM] = {0};
+    CRYPT_EAL_PkeyVerifyItem items[BATCH_VERIFY_MAX_NUM] = {0};
+    uint8_t msg[BATCH_VERIFY_MAX_NUM][BATCH_VERIFY_MSG_LEN];
+    uint8_t *sign[BATCH_VERIFY_MAX_NUM] = {0};
+    int32_t results[BATCH_VERIFY_MAX_NUM];
+    uint32_t keyLen = (bits + 7) >> 3;  // keybytes == (keyBits + 7) >> 3 */
+    uint32_t signLen;
+    int i;
+
+    ASSERT_TRUE(num > 1 && num <= BATCH_VERIFY_MAX_NUM && badIndex + 1 < num);
+    TestMemInit();
+    ASSERT_EQ(TestRandInit(), CRYPT_SUCCESS);
+    for (i = 0; i < BATCH_VERIFY_KEY_NUM; i++) {
+        pkey[i] = BatchVerifyKeyNew(bits, i, isProvider);
+        ASSERT_TRUE(pkey[i] != NULL);
+    }
+    for (i = 0; i < num; i++) {
+        sign[i] = malloc(keyLen);
+        ASSERT_TRUE(sign[i] != NULL);
+        ASSERT_EQ(CRYPT_EAL_Randbytes(msg[i], BATCH_VERIFY_MSG_LEN), CRYPT_SUCCESS);
+        signLen = keyLen;
+        ASSERT_EQ(CRYPT_EAL_PkeySign(pkey[i % BATCH_VERIFY_KEY_NUM], CRYPT_MD_SHA256, msg[i], BATCH_VERIFY_MSG_LEN,
+            sign[i], &signLen), CRYPT_SUCCESS);
+        items[i].pkey = pkey[i % BATCH_VERIFY_KEY_NUM];
+        items[i].data = msg[i];
+        items[i].dataLen = BATCH_VERIFY_MSG_LEN;
+        items[i].sign = sign[i];
+        items[i].signLen = signLen;
+    }
+    ASSERT_EQ(CRYPT_EAL_PkeyBatchVerify(items, num, CRYPT_MD_SHA256, results), CRYPT_SUCCESS);
+    for (i = 0; i < num; i++) {
+        ASSERT_EQ(results[i], CRYPT_SUCCESS);
+    }
+    if (badIndex < 0) {
+        goto exit;
+    }
+
+    sign[badIndex][keyLen - 1] ^= 1;
+    msg[badIndex + 1][0] ^= 1;
+    ASSERT_EQ(CRYPT_EAL_PkeyBatchVerify(items, num, CRYPT_MD_SHA256, results), results[badIndex]);
+    for (i = 0; i < num; i++) {
+        ASSERT_EQ(results[i], CRYPT_EAL_PkeyVerify(items[i].pkey, CRYPT_MD_SHA256, msg[i], BATCH_VERIFY_MSG_LEN,
+            sign[i], items[i].signLen));
+        ASSERT_EQ(results[i] != CRYPT_SUCCESS, i == badIndex || i == badIndex + 1);
+    }
+
+exit:
+    CRYPT_EAL_RandDeinit();
+    for (i = 0; i < BATCH_VERIFY_KEY_NUM; i++) {
+        CRYPT_EAL_PkeyFreeCtx(pkey[i]);
+    }
+    for (i = 0; i < BATCH_VERIFY_MAX_NUM; i++) {
+        free(sign[i]);
+    }
+}
+/* END_CASE */
+
 /**
  * @test   SDV_CRYPTO_RSA_GEN_SIGN_VERIFY_PSS_FUNC_TC001
  * @title  RSA EAL signData/verifyData: pss, sha256, saltLen=32bytes
@@ -18,6 +18,7 @@
 #include <pthread.h>
 #include "eal_md_local.h"
 #include "crypt_eal_md.h"
+#include "crypt_eal_ctxpool.h"
 #include "crypt_errno.h"
 #include "bsl_sal.h"
 /* END_HEADER */
@@ -481,3 +482,109 @@ exit:
     CRYPT_EAL_MdFreeCtx(ctx);
 }
 /* END_CASE */
+
+/**
+ * @test   SDV_CRYPTO_SHA2_INPLACE_CTX_FUNC_TC001
+ * @title  Context in the memory of the caller.
+ * @precon nan
+ * @brief
+ *    1. Call to CRYPT_EAL_MdInitCtxIn to create the ctx in a buffer on the stack, expected result 1
+ *    2. Update the first byte, then duplicate the ctx, expected result 2
+ *    3. Finish the hash of msg with both contexts and compare them with hash vector, expected result 3
+ *    4. Call to CRYPT_EAL_MdCopyCtx with the in-place ctx as destination, expected result 4
+ *    5. Free the in-place ctx, expected result 5
+ * @expect
+ *    1. Success, the context points into the buffer.
+ *    2. Success, the duplicated context is not null.
+ *    3. Success, the hashs are the same.
+ *    4. CRYPT_INCONSISTENT_OPERATION
+ *    5. The buffer is wiped.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_SHA2_INPLACE_CTX_FUNC_TC001(int id, Hex *msg, Hex *hash)
+{
+    TestMemInit();
+    CRYPT_EAL_MdCtxBuf buf;
+    CRYPT_EAL_MdCtxBuf zero = {0};
+    CRYPT_EAL_MdCTX *dupCtx = NULL;
+    uint8_t output[SHA2_OUTPUT_MAXSIZE];
+    uint32_t outLen = SHA2_OUTPUT_MAXSIZE;
+
+    ASSERT_TRUE(CRYPT_EAL_MdInitCtxIn(NULL, id) == NULL);
+    ASSERT_TRUE(CRYPT_EAL_MdInitCtxIn(&buf, CRYPT_MD_MAX) == NULL);
+    CRYPT_EAL_MdCTX *ctx = CRYPT_EAL_MdInitCtxIn(&buf, id);
+    ASSERT_TRUE(ctx == (CRYPT_EAL_MdCTX *)&buf);
+    ASSERT_EQ(CRYPT_EAL_MdGetId(ctx), id);
+
+    ASSERT_TRUE(msg->len > 0);
+    ASSERT_EQ(CRYPT_EAL_MdUpdate(ctx, msg->x, 1), CRYPT_SUCCESS);
+    dupCtx = CRYPT_EAL_MdDupCtx(ctx);
+    ASSERT_TRUE(dupCtx != NULL);
+
+    ASSERT_EQ(CRYPT_EAL_MdUpdate(ctx, msg->x + 1, msg->len - 1), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_MdFinal(ctx, output, &outLen), CRYPT_SUCCESS);
+    ASSERT_COMPARE("in-place", output, outLen, hash->x, hash->len);
+
+    outLen = SHA2_OUTPUT_MAXSIZE;
+    ASSERT_EQ(CRYPT_EAL_MdUpdate(dupCtx, msg->x + 1, msg->len - 1), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_MdFinal(dupCtx, output, &outLen), CRYPT_SUCCESS);
+    ASSERT_COMPARE("dup", output, outLen, hash->x, hash->len);
+
+    ASSERT_EQ(CRYPT_EAL_MdCopyCtx(ctx, dupCtx), CRYPT_INCONSISTENT_OPERATION);
+    CRYPT_EAL_MdFreeCtx(ctx);
+    ASSERT_EQ(memcmp(&buf, &zero, sizeof(buf)), 0);
+exit:
+    CRYPT_EAL_MdFreeCtx(dupCtx);
+}
+/* END_CASE */
+
+/**
+ * @test   SDV_CRYPTO_SHA2_CTX_POOL_FUNC_TC001
+ * @title  Reuse of the contexts of a pool.
+ * @precon nan
+ * @brief
+ *    1. Create a pool that keeps one context, expected result 1
+ *    2. Get two contexts, leave one in the middle of a hash and put both back, expected result 2
+ *    3. Get a context of the algorithm again, expected result 3
+ *    4. Calculate the hash of msg, and compare the calculated result with hash vector, expected result 4
+ * @expect
+ *    1. Success, the pool is not null.
+ *    2. Success, the second context is freed because the pool is full.
+ *    3. The context first put back is returned and it must be initialized again.
+ *    4. Success, the hashs are the same.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_SHA2_CTX_POOL_FUNC_TC001(int id, Hex *msg, Hex *hash)
+{
+    TestMemInit();
+    uint8_t output[SHA2_OUTPUT_MAXSIZE];
+    uint32_t outLen = SHA2_OUTPUT_MAXSIZE;
+    CRYPT_EAL_MdCTX *ctx = NULL;
+    CRYPT_EAL_CtxPool *pool = NULL;
+
+    ASSERT_TRUE(CRYPT_EAL_CtxPoolNew(NULL, NULL, 0) == NULL);
+    pool = CRYPT_EAL_CtxPoolNew(NULL, "provider=default", 1);
+    ASSERT_TRUE(pool != NULL);
+
+    CRYPT_EAL_MdCTX *first = CRYPT_EAL_CtxPoolGetMd(pool, id);
+    CRYPT_EAL_MdCTX *second = CRYPT_EAL_CtxPoolGetMd(pool, id);
+    ASSERT_TRUE(first != NULL && second != NULL && first != second);
+    ASSERT_EQ(CRYPT_EAL_MdInit(first), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_MdUpdate(first, msg->x, msg->len), CRYPT_SUCCESS);
+    CRYPT_EAL_CtxPoolPutMd(pool, first);
+    CRYPT_EAL_CtxPoolPutMd(pool, second);
+
+    ctx = CRYPT_EAL_CtxPoolGetMd(pool, id);
+    ASSERT_TRUE(ctx == first);
+    ASSERT_EQ(CRYPT_EAL_MdUpdate(ctx, msg->x, msg->len), CRYPT_EAL_ERR_STATE);
+    ASSERT_EQ(CRYPT_EAL_MdInit(ctx), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_MdUpdate(ctx, msg->x, msg->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_MdFinal(ctx, output, &outLen), CRYPT_SUCCESS);
+    ASSERT_COMPARE("pool", output, outLen, hash->x, hash->len);
+    CRYPT_EAL_CtxPoolPutMd(pool, ctx);
+    ctx = NULL;
+exit:
+    CRYPT_EAL_MdFreeCtx(ctx);
+    CRYPT_EAL_CtxPoolFree(pool);
+}
+/* END_CASE */
@@ -401,4 +401,118 @@ void SDV_CRYPTO_SHA3_DEFAULT_PROVIDER_FUNC_TC001(int id, Hex *msg, Hex *hash)
 exit:
     CRYPT_EAL_MdFreeCtx(ctx);
 }
-/* END_CASE */
\ No newline at end of file
+/* END_CASE */
+/**
+ * @test   SDV_CRYPTO_SHAKE_MB_API_TC001
+ * @title  Multi-buffer SHAKE parameter test.
+ * @precon nan
+ * @brief
+ *    1. Call CRYPT_SHAKE_MbInit with a non SHAKE algorithm, expected result 1
+ *    2. Call CRYPT_SHAKE_MbInit with 0 and 9 instances, expected result 2
+ *    3. Call CRYPT_SHAKE_MbUpdate before the initialization, expected result 3
+ *    4. Call CRYPT_SHAKE_MbUpdate with a NULL input of one instance, expected result 4
+ *    5. Call CRYPT_SHAKE_MbUpdate after CRYPT_SHAKE_MbSqueeze, expected result 3
+ * @expect
+ *    1. CRYPT_NOT_SUPPORT
+ *    2. CRYPT_INVALID_ARG
+ *    3. CRYPT_SHA3_ERR_STATE
+ *    4. CRYPT_NULL_INPUT
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_SHAKE_MB_API_TC001(void)
+{
+    TestMemInit();
+    uint8_t data[2][32] = {0};
+    const uint8_t *in[2] = {data[0], NULL};
+    uint8_t *out[2] = {data[0], data[1]};
+    CRYPT_SHAKE_MbCtx *ctx = CRYPT_SHAKE_MbNewCtx();
+    ASSERT_TRUE(ctx != NULL);
+
+    ASSERT_EQ(CRYPT_SHAKE_MbInit(NULL, CRYPT_MD_SHAKE128, 2), CRYPT_NULL_INPUT);
+    ASSERT_EQ(CRYPT_SHAKE_MbInit(ctx, CRYPT_MD_SHA3_256, 2), CRYPT_NOT_SUPPORT);
+    ASSERT_EQ(CRYPT_SHAKE_MbInit(ctx, CRYPT_MD_SHAKE128, 0), CRYPT_INVALID_ARG);
+    ASSERT_EQ(CRYPT_SHAKE_MbInit(ctx, CRYPT_MD_SHAKE128, CRYPT_SHAKE_MB_MAX_NUM + 1), CRYPT_INVALID_ARG);
+    ASSERT_EQ(CRYPT_SHAKE_MbUpdate(ctx, (const uint8_t *const *)out, sizeof(data[0])), CRYPT_SHA3_ERR_STATE);
+    ASSERT_EQ(CRYPT_SHAKE_MbSqueeze(ctx, out, sizeof(data[0])), CRYPT_SHA3_ERR_STATE);
+
+    ASSERT_EQ(CRYPT_SHAKE_MbInit(ctx, CRYPT_MD_SHAKE256, 2), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_SHAKE_MbUpdate(ctx, in, sizeof(data[0])), CRYPT_NULL_INPUT);
+    ASSERT_EQ(CRYPT_SHAKE_MbUpdate(ctx, NULL, sizeof(data[0])), CRYPT_NULL_INPUT);
+    ASSERT_EQ(CRYPT_SHAKE_MbUpdate(ctx, in, 0), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_SHAKE_MbSqueeze(ctx, out, sizeof(data[0])), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_SHAKE_MbUpdate(ctx, (const uint8_t *const *)out, sizeof(data[0])), CRYPT_SHA3_ERR_STATE);
+    CRYPT_SHAKE_MbDeinit(ctx);
+    ASSERT_EQ(CRYPT_SHAKE_MbSqueeze(ctx, out, sizeof(data[0])), CRYPT_SHA3_ERR_STATE);
+exit:
+    CRYPT_SHAKE_MbFreeCtx(ctx);
+}
+/* END_CASE */
+
+/**
+ * @test   SDV_CRYPTO_SHAKE_MB_FUNC_TC001
+ * @title  Multi-buffer SHAKE compared with the single SHAKE.
+ * @precon nan
+ * @brief
+ *    1. Absorb num different messages of inLen bytes in two updates, expected result 1
+ *    2. Squeeze outLen bytes of each instance in pieces of squeezeLen bytes, expected result 1
+ *    3. Calculate the SHAKE of every message with CRYPT_EAL_Md* and compare, expected result 2
+ * @expect
+ *    1. CRYPT_SUCCESS
+ *    2. The results are the same.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_SHAKE_MB_FUNC_TC001(int algId, int num, int inLen, int outLen, int squeezeLen)
+{
+    TestMemInit();
+    uint8_t *msg[CRYPT_SHAKE_MB_MAX_NUM] = {NULL};
+    uint8_t *mbOut[CRYPT_SHAKE_MB_MAX_NUM] = {NULL};
+    uint8_t *expect = NULL;
+    CRYPT_EAL_MdCTX *mdCtx = NULL;
+    CRYPT_SHAKE_MbCtx *ctx = CRYPT_SHAKE_MbNewCtx();
+    ASSERT_TRUE(ctx != NULL);
+    for (int j = 0; j < num; j++) {
+        msg[j] = BSL_SAL_Malloc(inLen + 1);
+        mbOut[j] = BSL_SAL_Malloc(outLen);
+        ASSERT_TRUE(msg[j] != NULL && mbOut[j] != NULL);
+        for (int k = 0; k < inLen; k++) {
+            msg[j][k] = (uint8_t)(k * 31 + j * 7 + 1);
+        }
+    }
+    expect = BSL_SAL_Malloc(outLen);
+    ASSERT_TRUE(expect != NULL);
+
+    ASSERT_EQ(CRYPT_SHAKE_MbInit(ctx, algId, num), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_SHAKE_MbUpdate(ctx, (const uint8_t *const *)msg, inLen / 3), CRYPT_SUCCESS);
+    uint8_t *rest[CRYPT_SHAKE_MB_MAX_NUM];
+    for (int j = 0; j < num; j++) {
+        rest[j] = msg[j] + inLen / 3;
+    }
+    ASSERT_EQ(CRYPT_SHAKE_MbUpdate(ctx, (const uint8_t *const *)rest, inLen - inLen / 3), CRYPT_SUCCESS);
+    for (int done = 0; done < outLen; done += squeezeLen) {
+        uint32_t len = (uint32_t)((outLen - done < squeezeLen) ? (outLen - done) : squeezeLen);
+        uint8_t *pos[CRYPT_SHAKE_MB_MAX_NUM];
+        for (int j = 0; j < num; j++) {
+            pos[j] = mbOut[j] + done;
+        }
+        ASSERT_EQ(CRYPT_SHAKE_MbSqueeze(ctx, pos, len), CRYPT_SUCCESS);
+    }
+
+    mdCtx = CRYPT_EAL_MdNewCtx(algId);
+    ASSERT_TRUE(mdCtx != NULL);
+    for (int j = 0; j < num; j++) {
+        uint32_t expectLen = (uint32_t)outLen;
+        ASSERT_EQ(CRYPT_EAL_MdInit(mdCtx), CRYPT_SUCCESS);
+        ASSERT_EQ(CRYPT_EAL_MdUpdate(mdCtx, msg[j], inLen), CRYPT_SUCCESS);
+        ASSERT_EQ(CRYPT_EAL_MdFinal(mdCtx, expect, &expectLen), CRYPT_SUCCESS);
+        ASSERT_COMPARE("shake mb", mbOut[j], outLen, expect, outLen);
+    }
+exit:
+    for (int j = 0; j < num; j++) {
+        BSL_SAL_Free(msg[j]);
+        BSL_SAL_Free(mbOut[j]);
+    }
+    BSL_SAL_Free(expect);
+    CRYPT_EAL_MdFreeCtx(mdCtx);
+    CRYPT_SHAKE_MbFreeCtx(ctx);
+}
+/* END_CASE */
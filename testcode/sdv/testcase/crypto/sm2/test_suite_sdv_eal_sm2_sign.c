@@ -1119,3 +1119,69 @@ exit:
     CRYPT_EAL_PkeyFreeCtx(pkey);
 }
 /* END_CASE */
+
+/**
+ * @test   SDV_CRYPTO_SM2_ZDIGEST_CACHE_FUNC_TC001
+ * @title  SM2: The cached Z digest follows changes of the user ID and the key.
+ * @precon public key, userId, msg, signature.
+ * @brief
+ *    1. Create the context(ctx) of the sm2 algorithm, expected result 1
+ *    2. Set the userId and public key, and verify twice, expected result 2
+ *    3. Set another userId and verify, expected result 3
+ *    4. Restore the userId and verify, expected result 4
+ *    5. Duplicate the context and verify with the duplicated context, expected result 5
+ *    6. Generate a new key pair and verify, expected result 6
+ *    7. Restore the public key and verify, expected result 7
+ * @expect
+ *    1. Success, and context is not NULL.
+ *    2. CRYPT_SUCCESS
+ *    3. CRYPT_SM2_VERIFY_FAIL
+ *    4-5. CRYPT_SUCCESS
+ *    6. CRYPT_SM2_VERIFY_FAIL
+ *    7. CRYPT_SUCCESS
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_SM2_ZDIGEST_CACHE_FUNC_TC001(Hex *pubKey, Hex *userId, Hex *msg, Hex *sign, int isProvider)
+{
+    uint8_t otherId[SM2_PRVKEY_MAX_LEN] = {0};
+    CRYPT_EAL_PkeyCtx *dupCtx = NULL;
+    CRYPT_EAL_PkeyPub pub = {0};
+    SetSm2PubKey(&pub, pubKey->x, pubKey->len);
+
+    TestMemInit();
+    CRYPT_EAL_PkeyCtx *ctx = NULL;
+    if (isProvider == 1) {
+        ctx = CRYPT_EAL_ProviderPkeyNewCtx(NULL, CRYPT_PKEY_SM2,
+            CRYPT_EAL_PKEY_KEYMGMT_OPERATE  + CRYPT_EAL_PKEY_SIGN_OPERATE, "provider=default");
+    } else {
+        ctx = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_SM2);
+    }
+    ASSERT_TRUE(ctx != NULL);
+    CRYPT_RandRegist(RandFunc);
+
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(ctx, CRYPT_CTRL_SET_SM2_USER_ID, userId->x, userId->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeySetPub(ctx, &pub), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(ctx, CRYPT_MD_SM3, msg->x, msg->len, sign->x, sign->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(ctx, CRYPT_MD_SM3, msg->x, msg->len, sign->x, sign->len), CRYPT_SUCCESS);
+
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(ctx, CRYPT_CTRL_SET_SM2_USER_ID, otherId, sizeof(otherId)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(ctx, CRYPT_MD_SM3, msg->x, msg->len, sign->x, sign->len), CRYPT_SM2_VERIFY_FAIL);
+    ASSERT_EQ(CRYPT_EAL_PkeyCtrl(ctx, CRYPT_CTRL_SET_SM2_USER_ID, userId->x, userId->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(ctx, CRYPT_MD_SM3, msg->x, msg->len, sign->x, sign->len), CRYPT_SUCCESS);
+
+    dupCtx = CRYPT_EAL_PkeyDupCtx(ctx);
+    ASSERT_TRUE(dupCtx != NULL);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(dupCtx, CRYPT_MD_SM3, msg->x, msg->len, sign->x, sign->len), CRYPT_SUCCESS);
+
+    ASSERT_EQ(CRYPT_EAL_PkeyGen(ctx), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(ctx, CRYPT_MD_SM3, msg->x, msg->len, sign->x, sign->len), CRYPT_SM2_VERIFY_FAIL);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(dupCtx, CRYPT_MD_SM3, msg->x, msg->len, sign->x, sign->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeySetPub(ctx, &pub), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PkeyVerify(ctx, CRYPT_MD_SM3, msg->x, msg->len, sign->x, sign->len), CRYPT_SUCCESS);
+
+exit:
+    CRYPT_EAL_PkeyFreeCtx(ctx);
+    CRYPT_EAL_PkeyFreeCtx(dupCtx);
+    CRYPT_RandRegist(NULL);
+}
+/* END_CASE */
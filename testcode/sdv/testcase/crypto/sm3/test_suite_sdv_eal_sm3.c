@@ -18,6 +18,7 @@
 #include "crypt_eal_md.h"
 #include "bsl_sal.h"
 #include "eal_md_local.h"
+#include "crypt_sm3.h"
 #include "crypt_algid.h"
 #include "crypt_errno.h"
 #include "securec.h"
@@ -421,3 +422,47 @@ exit:
     return;
 }
 /* END_CASE */
+
+/**
+ * @test   SDV_CRYPTO_SM3_KDF_FUNC_TC001
+ * @title  CRYPT_SM3_Kdf matches SM3(z || counter) computed with the md interface.
+ * @precon nan
+ * @brief
+ *    1. Derive outLen bytes from a zLen-byte input with CRYPT_SM3_Kdf, expected result 1
+ *    2. Compute SM3(z || 1) || SM3(z || 2) || ... with CRYPT_EAL_Md* and compare, expected result 2
+ * @expect
+ *    1. CRYPT_SUCCESS
+ *    2. The outputs are the same.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_SM3_KDF_FUNC_TC001(int zLen, int outLen)
+{
+    TestMemInit();
+    uint8_t *z = BSL_SAL_Malloc((uint32_t)zLen + 1);
+    uint8_t *out = BSL_SAL_Malloc((uint32_t)outLen);
+    uint8_t *expect = BSL_SAL_Malloc((uint32_t)outLen + 32);
+    CRYPT_EAL_MdCTX *ctx = CRYPT_EAL_MdNewCtx(CRYPT_MD_SM3);
+    ASSERT_TRUE(z != NULL && out != NULL && expect != NULL && ctx != NULL);
+    for (int i = 0; i < zLen; i++) {
+        z[i] = (uint8_t)(i * 7 + 1);
+    }
+    ASSERT_EQ(CRYPT_SM3_Kdf(z, (uint32_t)zLen, out, (uint32_t)outLen), CRYPT_SUCCESS);
+
+    for (uint32_t counter = 1, off = 0; off < (uint32_t)outLen; counter++, off += 32) {
+        uint8_t ctr[4] = {(uint8_t)(counter >> 24), (uint8_t)(counter >> 16), (uint8_t)(counter >> 8),
+            (uint8_t)counter};
+        uint32_t len = 32;
+        ASSERT_EQ(CRYPT_EAL_MdInit(ctx), CRYPT_SUCCESS);
+        ASSERT_EQ(CRYPT_EAL_MdUpdate(ctx, z, (uint32_t)zLen), CRYPT_SUCCESS);
+        ASSERT_EQ(CRYPT_EAL_MdUpdate(ctx, ctr, sizeof(ctr)), CRYPT_SUCCESS);
+        ASSERT_EQ(CRYPT_EAL_MdFinal(ctx, expect + off, &len), CRYPT_SUCCESS);
+    }
+    ASSERT_COMPARE("sm3 kdf", out, outLen, expect, outLen);
+
+exit:
+    BSL_SAL_Free(z);
+    BSL_SAL_Free(out);
+    BSL_SAL_Free(expect);
+    CRYPT_EAL_MdFreeCtx(ctx);
+}
+/* END_CASE */
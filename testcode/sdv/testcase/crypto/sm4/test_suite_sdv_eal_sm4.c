@@ -1625,4 +1625,67 @@ exit:
     CRYPT_EAL_CipherDeinit(ctxDec);
     CRYPT_EAL_CipherFreeCtx(ctxDec);
 }
+/* END_CASE */
+
+/**
+ * @test  SDV_CRYPTO_SM4_ENCRYPT_FUNC_TC016
+ * @title  SM4 CCM encryption and decryption Test
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Create the context ctx. Expected result 1 is obtained.
+ *    2.Call the Init and Reinit interfaces, set msg len, tag len and aad. Expected result 2 is obtained.
+ *    3.Call the Update interface to encrypt data and get tag. Expected result 3 is obtained.
+ *    4.Call the Init and Reinit interfaces, set msg len, tag len and aad. Expected result 4 is obtained.
+ *    5.Call the Update interface to decrypt data and get tag. Expected result 5 is obtained.
+ * @expect
+ *    1.The creation is successful and the ctx is not empty.
+ *    2.Success. Return CRYPT_SUCCESS.
+ *    3.Success, the ciphertext and tag are the same as the vector.
+ *    4.Success. Return CRYPT_SUCCESS.
+ *    5.Success, the plaintext and tag are the same as the vector.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_SM4_ENCRYPT_FUNC_TC016(int isProvider, Hex *key, Hex *iv, Hex *aad, Hex *plaintext, Hex *ciphertext)
+{
+#ifndef HITLS_CRYPTO_CCM
+    SKIP_TEST();
+#endif
+    TestMemInit();
+    uint8_t iv0[8] = {0};
+    uint8_t tag[16] = {0};
+    uint32_t tagLen = ciphertext->len - plaintext->len;
+    uint64_t count = plaintext->len;
+    uint8_t out[MAX_OUTPUT] = {0};
+    uint32_t outLen = sizeof(out);
+
+    CRYPT_EAL_CipherCtx *ctx = (isProvider == 0) ? CRYPT_EAL_CipherNewCtx(CRYPT_CIPHER_SM4_CCM) :
+        CRYPT_EAL_ProviderCipherNewCtx(NULL, CRYPT_CIPHER_SM4_CCM, "provider=default");
+    ASSERT_TRUE(ctx != NULL);
+    // encrypt
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv0, sizeof(iv0), true), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherReinit(ctx, iv->x, iv->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_MSGLEN, &count, sizeof(count)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_TAGLEN, &tagLen, sizeof(tagLen)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_AAD, aad->x, aad->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, plaintext->x, plaintext->len, out, &outLen), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_GET_TAG, tag, tagLen), CRYPT_SUCCESS);
+    ASSERT_EQ(outLen, plaintext->len);
+    ASSERT_TRUE(memcmp(out, ciphertext->x, outLen) == 0);
+    ASSERT_TRUE(memcmp(tag, ciphertext->x + outLen, tagLen) == 0);
+
+    // decrypt
+    outLen = sizeof(out);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv0, sizeof(iv0), false), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherReinit(ctx, iv->x, iv->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_MSGLEN, &count, sizeof(count)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_TAGLEN, &tagLen, sizeof(tagLen)), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_AAD, aad->x, aad->len), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, ciphertext->x, plaintext->len, out, &outLen), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_GET_TAG, tag, tagLen), CRYPT_SUCCESS);
+    ASSERT_EQ(outLen, plaintext->len);
+    ASSERT_TRUE(memcmp(out, plaintext->x, outLen) == 0);
+    ASSERT_TRUE(memcmp(tag, ciphertext->x + outLen, tagLen) == 0);
+exit:
+    CRYPT_EAL_CipherFreeCtx(ctx);
+}
 /* END_CASE */
\ No newline at end of file
@@ -14,6 +14,7 @@
  */
 
 /* BEGIN_HEADER */
+#include <pthread.h>
 
 #include "bsl_sal.h"
 #include "securec.h"
@@ -643,6 +644,193 @@ exit:
 }
 /* END_CASE */
 
+/**
+ * Certs loaded from a bundle decode their names, public key and extensions on first access,
+ * the result must match an eager parse of the same data.
+ */
+/* BEGIN_CASE */
+void SDV_X509_MUL_CERT_PARSE_LAZY_FUNC_TC001(int format, char *path, int certNum)
+{
+    TestMemInit();
+    HITLS_X509_List *lazyList = NULL;
+    HITLS_X509_List *list = NULL;
+    BSL_Buffer encode = {0};
+    BSL_Buffer lazyName = {0};
+    BSL_Buffer name = {0};
+    CRYPT_EAL_PkeyCtx *lazyKey = NULL;
+    CRYPT_EAL_PkeyCtx *key = NULL;
+    bool lazyRes = false;
+    bool res = false;
+
+    ASSERT_EQ(HITLS_X509_CertMulParseFile(format, path, &lazyList), HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_SAL_ReadFile(path, &encode.data, &encode.dataLen), BSL_SUCCESS);
+    ASSERT_EQ(HITLS_X509_CertMulParseBuff(format, &encode, &list), HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_LIST_COUNT(lazyList), certNum);
+    ASSERT_EQ(BSL_LIST_COUNT(list), certNum);
+
+    HITLS_X509_Cert *lazyCert = BSL_LIST_GET_FIRST(lazyList);
+    HITLS_X509_Cert *cert = BSL_LIST_GET_FIRST(list);
+    while (lazyCert != NULL && cert != NULL) {
+        ASSERT_EQ(lazyCert->lazyParts, HITLS_X509_CERT_LAZY_ALL);
+        ASSERT_EQ(cert->lazyParts, 0);
+
+        ASSERT_EQ(HITLS_X509_CertCtrl(lazyCert, HITLS_X509_GET_SUBJECT_DN_STR, &lazyName, sizeof(BSL_Buffer)), 0);
+        ASSERT_EQ(HITLS_X509_CertCtrl(cert, HITLS_X509_GET_SUBJECT_DN_STR, &name, sizeof(BSL_Buffer)), 0);
+        ASSERT_COMPARE("subject", lazyName.data, lazyName.dataLen, name.data, name.dataLen);
+        ASSERT_EQ(lazyCert->lazyParts, HITLS_X509_CERT_LAZY_PUBKEY | HITLS_X509_CERT_LAZY_EXT);
+
+        ASSERT_EQ(HITLS_X509_CertCtrl(lazyCert, HITLS_X509_GET_PUBKEY, &lazyKey, 0), HITLS_X509_SUCCESS);
+        ASSERT_EQ(HITLS_X509_CertCtrl(cert, HITLS_X509_GET_PUBKEY, &key, 0), HITLS_X509_SUCCESS);
+        ASSERT_EQ(CRYPT_EAL_PkeyCmp(lazyKey, key), 0);
+
+        ASSERT_EQ(HITLS_X509_CertCtrl(lazyCert, HITLS_X509_EXT_KU_CERTSIGN, &lazyRes, sizeof(bool)), 0);
+        ASSERT_EQ(HITLS_X509_CertCtrl(cert, HITLS_X509_EXT_KU_CERTSIGN, &res, sizeof(bool)), 0);
+        ASSERT_EQ(lazyRes, res);
+        ASSERT_EQ(lazyCert->lazyParts, 0);
+
+        BSL_SAL_FREE(lazyName.data);
+        BSL_SAL_FREE(name.data);
+        CRYPT_EAL_PkeyFreeCtx(lazyKey);
+        lazyKey = NULL;
+        CRYPT_EAL_PkeyFreeCtx(key);
+        key = NULL;
+        lazyCert = BSL_LIST_GET_NEXT(lazyList);
+        cert = BSL_LIST_GET_NEXT(list);
+    }
+exit:
+    BSL_SAL_FREE(lazyName.data);
+    BSL_SAL_FREE(name.data);
+    CRYPT_EAL_PkeyFreeCtx(lazyKey);
+    CRYPT_EAL_PkeyFreeCtx(key);
+    BSL_SAL_FREE(encode.data);
+    BSL_LIST_FREE(lazyList, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+    BSL_LIST_FREE(list, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+}
+/* END_CASE */
+
+#define LAZY_LOAD_CERT_MAX 8
+
+typedef struct {
+    HITLS_X509_Cert **lazyCerts; // the list cursor is not thread safe, the threads only share the certs
+    HITLS_X509_Cert **certs;
+    uint32_t num;
+    int32_t ret;
+} LazyLoadThreadArg;
+
+static void *LazyLoadThread(void *arg)
+{
+    LazyLoadThreadArg *param = (LazyLoadThreadArg *)arg;
+    param->ret = -1;
+    for (uint32_t i = 0; i < param->num; i++) {
+        CRYPT_EAL_PkeyCtx *lazyKey = NULL;
+        CRYPT_EAL_PkeyCtx *key = NULL;
+        (void)HITLS_X509_CertCtrl(param->lazyCerts[i], HITLS_X509_GET_PUBKEY, &lazyKey, 0);
+        (void)HITLS_X509_CertCtrl(param->certs[i], HITLS_X509_GET_PUBKEY, &key, 0);
+        int32_t cmp = (lazyKey == NULL || key == NULL) ? -1 : CRYPT_EAL_PkeyCmp(lazyKey, key);
+        CRYPT_EAL_PkeyFreeCtx(lazyKey);
+        CRYPT_EAL_PkeyFreeCtx(key);
+        if (cmp != 0) {
+            return NULL;
+        }
+        for (uint32_t j = 0; j < param->num; j++) {
+            bool lazyRes = false;
+            bool res = false;
+            if (HITLS_X509_CheckIssued(param->lazyCerts[i], param->lazyCerts[j], &lazyRes) !=
+                HITLS_X509_CheckIssued(param->certs[i], param->certs[j], &res) || lazyRes != res) {
+                return NULL;
+            }
+        }
+    }
+    param->ret = HITLS_X509_SUCCESS;
+    return NULL;
+}
+
+/**
+ * Lazily parsed certs may be shared by threads, e.g. through a store, the first accesses run concurrently and
+ * every thread must see the fully decoded parts.
+ */
+/* BEGIN_CASE */
+void SDV_X509_MUL_CERT_PARSE_LAZY_FUNC_TC002(int format, char *path)
+{
+    TestMemInit();
+    HITLS_X509_List *lazyList = NULL;
+    HITLS_X509_List *list = NULL;
+    BSL_Buffer encode = {0};
+    HITLS_X509_Cert *lazyCerts[LAZY_LOAD_CERT_MAX + 1];
+    HITLS_X509_Cert *certs[LAZY_LOAD_CERT_MAX + 1];
+    uint32_t num = 0;
+    pthread_t thrd[4];
+    LazyLoadThreadArg arg[4];
+    uint32_t threadNum = 0;
+    uint32_t joinNum = 0;
+
+    ASSERT_EQ(BSL_SAL_ReadFile(path, &encode.data, &encode.dataLen), BSL_SUCCESS);
+    ASSERT_EQ(HITLS_X509_CertMulParseBuffLazy(format, &encode, &lazyList), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_X509_CertMulParseBuff(format, &encode, &list), HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_LIST_COUNT(lazyList), BSL_LIST_COUNT(list));
+    ASSERT_TRUE(BSL_LIST_COUNT(list) <= LAZY_LOAD_CERT_MAX);
+    lazyCerts[0] = BSL_LIST_GET_FIRST(lazyList);
+    certs[0] = BSL_LIST_GET_FIRST(list);
+    while (certs[num] != NULL) {
+        num++;
+        lazyCerts[num] = BSL_LIST_GET_NEXT(lazyList);
+        certs[num] = BSL_LIST_GET_NEXT(list);
+    }
+    for (; threadNum < sizeof(thrd) / sizeof(thrd[0]); threadNum++) {
+        arg[threadNum].lazyCerts = lazyCerts;
+        arg[threadNum].certs = certs;
+        arg[threadNum].num = num;
+        ASSERT_EQ(pthread_create(&thrd[threadNum], NULL, LazyLoadThread, &arg[threadNum]), 0);
+    }
+    for (; joinNum < threadNum; joinNum++) {
+        pthread_join(thrd[joinNum], NULL);
+    }
+    for (uint32_t i = 0; i < threadNum; i++) {
+        ASSERT_EQ(arg[i].ret, HITLS_X509_SUCCESS);
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        ASSERT_EQ(lazyCerts[i]->lazyParts, 0);
+    }
+exit:
+    for (; joinNum < threadNum; joinNum++) {
+        pthread_join(thrd[joinNum], NULL);
+    }
+    BSL_SAL_FREE(encode.data);
+    BSL_LIST_FREE(lazyList, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+    BSL_LIST_FREE(list, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+}
+/* END_CASE */
+
+/* BEGIN_CASE */
+void SDV_X509_MUL_CERT_PARSE_PARALLEL_FUNC_TC001(int format, char *path, int threadNum)
+{
+    TestMemInit();
+    HITLS_X509_List *list = NULL;
+    HITLS_X509_List *parList = NULL;
+    BSL_Buffer encode = {0};
+    ASSERT_EQ(BSL_SAL_ReadFile(path, &encode.data, &encode.dataLen), BSL_SUCCESS);
+
+    int32_t ret = HITLS_X509_CertMulParseBuff(format, &encode, &list);
+    ASSERT_EQ(HITLS_X509_CertMulParseBuffParallel(format, &encode, threadNum, &parList), ret);
+    if (ret != HITLS_X509_SUCCESS) {
+        goto exit;
+    }
+    ASSERT_EQ(BSL_LIST_COUNT(parList), BSL_LIST_COUNT(list));
+    HITLS_X509_Cert *cert = BSL_LIST_GET_FIRST(list);
+    HITLS_X509_Cert *parCert = BSL_LIST_GET_FIRST(parList);
+    while (cert != NULL && parCert != NULL) {
+        ASSERT_COMPARE("cert", parCert->rawData, parCert->rawDataLen, cert->rawData, cert->rawDataLen);
+        ASSERT_EQ(parCert->lazyParts, HITLS_X509_CERT_LAZY_NAME | HITLS_X509_CERT_LAZY_PUBKEY);
+        cert = BSL_LIST_GET_NEXT(list);
+        parCert = BSL_LIST_GET_NEXT(parList);
+    }
+exit:
+    BSL_SAL_FREE(encode.data);
+    BSL_LIST_FREE(list, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+    BSL_LIST_FREE(parList, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+}
+/* END_CASE */
+
 /* BEGIN_CASE */
 void SDV_X509_CERT_SET_VERIOSN_FUNC_TC001(void)
 {
@@ -26,6 +26,8 @@
 #include "crypt_eal_rand.h"
 #include "crypt_errno.h"
 #include "hitls_cms_local.h"
+#include "hitls_cert_local.h"
+#include "hitls_pki.h"
 #include "hitls_pki_errno.h"
 
 /* END_HEADER */
@@ -238,3 +240,143 @@ exit:
     return;
 }
 /* END_CASE */
+
+static int32_t CmsSignUpdateByChunk(HITLS_CMS_SignedData *signedData, Hex *msg, uint32_t chunk, bool isSign)
+{
+    uint32_t offset = 0;
+    while (offset < msg->len) {
+        uint32_t len = (msg->len - offset) < chunk ? (msg->len - offset) : chunk;
+        int32_t ret = isSign ? HITLS_CMS_SignedDataSignUpdate(signedData, msg->x + offset, len) :
+            HITLS_CMS_SignedDataVerifyUpdate(signedData, msg->x + offset, len);
+        if (ret != HITLS_X509_SUCCESS) {
+            return ret;
+        }
+        offset += len;
+    }
+    return HITLS_X509_SUCCESS;
+}
+
+static int32_t CmsVerify(BSL_Buffer *encode, Hex *msg, uint32_t chunk, HITLS_X509_List *certs)
+{
+    HITLS_CMS_SignedData *signedData = HITLS_CMS_SignedDataNew();
+    if (signedData == NULL) {
+        return BSL_MALLOC_FAIL;
+    }
+    int32_t ret = HITLS_CMS_SignedDataVerifyInit(signedData, encode);
+    if (ret == HITLS_X509_SUCCESS) {
+        ret = CmsSignUpdateByChunk(signedData, msg, chunk, false);
+    }
+    if (ret == HITLS_X509_SUCCESS) {
+        ret = HITLS_CMS_SignedDataVerifyFinal(signedData, certs);
+    }
+    HITLS_CMS_SignedDataFree(signedData);
+    return ret;
+}
+
+/**
+ * For test signing detached SignedData by streaming the content, and verifying it with the embedded certificate
+ * and with a trusted one.
+*/
+/* BEGIN_CASE */
+void SDV_CMS_SIGNEDDATA_SIGN_VERIFY_TC001(char *certPath, char *keyPath, int keyType, int mdId, Hex *msg, int chunk)
+{
+    TestRandInit();
+    HITLS_CMS_SignedData *signedData = NULL;
+    HITLS_X509_Cert *cert = NULL;
+    HITLS_X509_List *trusted = NULL;
+    CRYPT_EAL_PkeyCtx *prvKey = NULL;
+    BSL_Buffer encode = {0};
+    ASSERT_EQ(HITLS_X509_CertParseFile(BSL_FORMAT_ASN1, certPath, &cert), HITLS_X509_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PriKeyParseFile(BSL_FORMAT_ASN1, keyType, keyPath, NULL, 0, &prvKey), CRYPT_SUCCESS);
+
+    signedData = HITLS_CMS_SignedDataNew();
+    ASSERT_NE(signedData, NULL);
+    ASSERT_EQ(HITLS_CMS_SignedDataSignInit(signedData), HITLS_CMS_ERR_NO_SIGNER);
+    ASSERT_EQ(HITLS_CMS_SignedDataAddSigner(signedData, cert, prvKey, mdId, NULL), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_CMS_SignedDataSignUpdate(signedData, msg->x, msg->len), HITLS_CMS_ERR_STATE);
+    ASSERT_EQ(HITLS_CMS_SignedDataSignInit(signedData), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_CMS_SignedDataAddSigner(signedData, cert, prvKey, mdId, NULL), HITLS_CMS_ERR_STATE);
+    ASSERT_EQ(CmsSignUpdateByChunk(signedData, msg, (uint32_t)chunk, true), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_CMS_SignedDataSignFinal(signedData, &encode), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_CMS_SignedDataSignUpdate(signedData, msg->x, msg->len), HITLS_CMS_ERR_STATE);
+
+    ASSERT_EQ(CmsVerify(&encode, msg, (uint32_t)chunk, NULL), HITLS_X509_SUCCESS);
+    ASSERT_EQ(CmsVerify(&encode, msg, msg->len, NULL), HITLS_X509_SUCCESS);
+    trusted = BSL_LIST_New(sizeof(HITLS_X509_Cert *));
+    ASSERT_NE(trusted, NULL);
+    ASSERT_EQ(CmsVerify(&encode, msg, msg->len, trusted), HITLS_CMS_ERR_SIGNER_NOT_FOUND);
+
+    msg->x[msg->len - 1] ^= 0x01;
+    ASSERT_EQ(CmsVerify(&encode, msg, (uint32_t)chunk, NULL), HITLS_CMS_ERR_DIGEST_MISMATCH);
+exit:
+    HITLS_CMS_SignedDataFree(signedData);
+    BSL_LIST_FREE(trusted, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
+    HITLS_X509_CertFree(cert);
+    CRYPT_EAL_PkeyFreeCtx(prvKey);
+    BSL_SAL_Free(encode.data);
+}
+/* END_CASE */
+
+/**
+ * For test SignedData with two signers: the content is hashed once per digest algorithm.
+*/
+/* BEGIN_CASE */
+void SDV_CMS_SIGNEDDATA_MULTI_SIGNER_TC001(char *certPath1, char *keyPath1, int mdId1, char *certPath2,
+    char *keyPath2, int mdId2, Hex *msg, int digestNum)
+{
+    TestRandInit();
+    HITLS_CMS_SignedData *signedData = NULL;
+    HITLS_CMS_SignedData *verifyData = NULL;
+    HITLS_X509_Cert *cert1 = NULL;
+    HITLS_X509_Cert *cert2 = NULL;
+    CRYPT_EAL_PkeyCtx *prvKey1 = NULL;
+    CRYPT_EAL_PkeyCtx *prvKey2 = NULL;
+    BSL_Buffer encode = {0};
+    ASSERT_EQ(HITLS_X509_CertParseFile(BSL_FORMAT_ASN1, certPath1, &cert1), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_X509_CertParseFile(BSL_FORMAT_ASN1, certPath2, &cert2), HITLS_X509_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PriKeyParseFile(BSL_FORMAT_ASN1, CRYPT_PRIKEY_PKCS8_UNENCRYPT, keyPath1, NULL, 0, &prvKey1),
+        CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_PriKeyParseFile(BSL_FORMAT_ASN1, CRYPT_PRIKEY_PKCS8_UNENCRYPT, keyPath2, NULL, 0, &prvKey2),
+        CRYPT_SUCCESS);
+
+    signedData = HITLS_CMS_SignedDataNew();
+    ASSERT_NE(signedData, NULL);
+    ASSERT_EQ(HITLS_CMS_SignedDataAddSigner(signedData, cert1, prvKey1, mdId1, NULL), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_CMS_SignedDataAddSigner(signedData, cert2, prvKey2, mdId2, NULL), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_CMS_SignedDataSignInit(signedData), HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_LIST_COUNT(signedData->digests), digestNum);
+    ASSERT_EQ(HITLS_CMS_SignedDataSignUpdate(signedData, msg->x, msg->len), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_CMS_SignedDataSignFinal(signedData, &encode), HITLS_X509_SUCCESS);
+
+    verifyData = HITLS_CMS_SignedDataNew();
+    ASSERT_NE(verifyData, NULL);
+    ASSERT_EQ(HITLS_CMS_SignedDataVerifyInit(verifyData, &encode), HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_LIST_COUNT(verifyData->signers), 2);
+    ASSERT_EQ(BSL_LIST_COUNT(verifyData->digests), digestNum);
+    ASSERT_EQ(HITLS_CMS_SignedDataVerifyUpdate(verifyData, msg->x, msg->len), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_CMS_SignedDataVerifyFinal(verifyData, NULL), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_CMS_SignedDataVerifyFinal(verifyData, NULL), HITLS_CMS_ERR_STATE);
+exit:
+    HITLS_CMS_SignedDataFree(signedData);
+    HITLS_CMS_SignedDataFree(verifyData);
+    HITLS_X509_CertFree(cert1);
+    HITLS_X509_CertFree(cert2);
+    CRYPT_EAL_PkeyFreeCtx(prvKey1);
+    CRYPT_EAL_PkeyFreeCtx(prvKey2);
+    BSL_SAL_Free(encode.data);
+}
+/* END_CASE */
+
+/**
+ * For test verifying detached SignedData generated by other implementations.
+*/
+/* BEGIN_CASE */
+void SDV_CMS_SIGNEDDATA_VERIFY_TC001(char *path, Hex *msg, int expRet)
+{
+    BSL_Buffer encode = {0};
+    ASSERT_EQ(BSL_SAL_ReadFile(path, &encode.data, &encode.dataLen), BSL_SUCCESS);
+    ASSERT_EQ(CmsVerify(&encode, msg, msg->len, NULL), expRet);
+exit:
+    BSL_SAL_Free(encode.data);
+}
+/* END_CASE */
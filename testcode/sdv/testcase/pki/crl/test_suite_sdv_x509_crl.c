@@ -14,6 +14,7 @@
  */
 
 /* BEGIN_HEADER */
+#include <pthread.h>
 
 #include "bsl_sal.h"
 #include "securec.h"
@@ -286,6 +287,165 @@ exit:
 }
 /* END_CASE */
 
+/* BEGIN_CASE */
+void SDV_X509_MUL_CRL_PARSE_PARALLEL_FUNC_TC001(int format, char *path, int threadNum)
+{
+    BSL_GLOBAL_Init();
+    HITLS_X509_List *list = NULL;
+    HITLS_X509_List *parList = NULL;
+    BSL_Buffer encode = {0};
+    ASSERT_EQ(BSL_SAL_ReadFile(path, &encode.data, &encode.dataLen), BSL_SUCCESS);
+
+    int32_t ret = HITLS_X509_CrlMulParseBuff(format, &encode, &list);
+    ASSERT_EQ(HITLS_X509_CrlMulParseBuffParallel(format, &encode, threadNum, &parList), ret);
+    if (ret != HITLS_X509_SUCCESS) {
+        goto exit;
+    }
+    ASSERT_EQ(BSL_LIST_COUNT(parList), BSL_LIST_COUNT(list));
+    HITLS_X509_Crl *crl = BSL_LIST_GET_FIRST(list);
+    HITLS_X509_Crl *parCrl = BSL_LIST_GET_FIRST(parList);
+    while (crl != NULL && parCrl != NULL) {
+        ASSERT_COMPARE("crl", parCrl->rawData, parCrl->rawDataLen, crl->rawData, crl->rawDataLen);
+        ASSERT_EQ(BSL_LIST_COUNT(parCrl->tbs.revokedCerts), BSL_LIST_COUNT(crl->tbs.revokedCerts));
+        crl = BSL_LIST_GET_NEXT(list);
+        parCrl = BSL_LIST_GET_NEXT(parList);
+    }
+exit:
+    BSL_SAL_FREE(encode.data);
+    BSL_LIST_FREE(list, (BSL_LIST_PFUNC_FREE)HITLS_X509_CrlFree);
+    BSL_LIST_FREE(parList, (BSL_LIST_PFUNC_FREE)HITLS_X509_CrlFree);
+}
+/* END_CASE */
+
+/* BEGIN_CASE */
+void SDV_X509_CRL_FIND_REVOKED_FUNC_TC001(char *path, Hex *serial, int expRevoked, int year)
+{
+    HITLS_X509_Crl *crl = NULL;
+    HITLS_X509_List *list = NULL;
+    BslList *revokeList = NULL;
+    bool isRevoked = false;
+    HITLS_X509_CrlRevokedInfo info = {0};
+    BSL_ASN1_Buffer serialNum = {BSL_ASN1_TAG_INTEGER, serial->len, serial->x};
+    ASSERT_EQ(HITLS_X509_CrlParseFile(BSL_FORMAT_ASN1, path, &crl), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_X509_CrlFindRevoked(crl, &serialNum, &isRevoked, &info), HITLS_X509_SUCCESS);
+    ASSERT_EQ(isRevoked, expRevoked != 0);
+    if (isRevoked) {
+        ASSERT_EQ(info.time.year, year);
+    }
+
+    // The multi-crl file parser leaves the revoked list to the index until it is asked for.
+    ASSERT_EQ(HITLS_X509_CrlMulParseFile(BSL_FORMAT_ASN1, path, &list), HITLS_X509_SUCCESS);
+    HITLS_X509_Crl *lazyCrl = BSL_LIST_GET_FIRST(list);
+    ASSERT_EQ(BSL_LIST_COUNT(lazyCrl->tbs.revokedCerts), 0);
+    isRevoked = !isRevoked;
+    ASSERT_EQ(HITLS_X509_CrlFindRevoked(lazyCrl, &serialNum, &isRevoked, NULL), HITLS_X509_SUCCESS);
+    ASSERT_EQ(isRevoked, expRevoked != 0);
+    ASSERT_EQ(HITLS_X509_CrlCtrl(lazyCrl, HITLS_X509_GET_REVOKELIST, &revokeList, sizeof(BslList *)),
+        HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_LIST_COUNT(revokeList), BSL_LIST_COUNT(crl->tbs.revokedCerts));
+exit:
+    HITLS_X509_CrlFree(crl);
+    BSL_LIST_FREE(list, (BSL_LIST_PFUNC_FREE)HITLS_X509_CrlFree);
+}
+/* END_CASE */
+
+#define LAZY_REVOKED_CRL_MAX 8
+
+typedef struct {
+    HITLS_X509_Crl **lazyCrls; // the list cursor is not thread safe, the threads only share the crls
+    HITLS_X509_Crl **crls;
+    uint32_t num;
+    int32_t ret;
+} LazyRevokedThreadArg;
+
+static void *LazyRevokedThread(void *arg)
+{
+    LazyRevokedThreadArg *param = (LazyRevokedThreadArg *)arg;
+    param->ret = -1;
+    for (uint32_t i = 0; i < param->num; i++) {
+        BslList *lazyList = NULL;
+        BslList *list = NULL;
+        if (HITLS_X509_CrlCtrl(param->lazyCrls[i], HITLS_X509_GET_REVOKELIST, &lazyList, sizeof(BslList *)) !=
+            HITLS_X509_SUCCESS ||
+            HITLS_X509_CrlCtrl(param->crls[i], HITLS_X509_GET_REVOKELIST, &list, sizeof(BslList *)) !=
+            HITLS_X509_SUCCESS || BSL_LIST_COUNT(lazyList) != BSL_LIST_COUNT(list)) {
+            return NULL;
+        }
+    }
+    param->ret = HITLS_X509_SUCCESS;
+    return NULL;
+}
+
+/**
+ * Lazily parsed crls may be shared by threads through a store, the first requests of the revoked list run
+ * concurrently and the list must be decoded exactly once.
+ */
+/* BEGIN_CASE */
+void SDV_X509_CRL_LAZY_REVOKED_FUNC_TC001(int format, char *path)
+{
+    TestMemInit();
+    HITLS_X509_List *lazyList = NULL;
+    HITLS_X509_List *list = NULL;
+    HITLS_X509_Crl *lazyCrls[LAZY_REVOKED_CRL_MAX + 1];
+    HITLS_X509_Crl *crls[LAZY_REVOKED_CRL_MAX + 1];
+    uint32_t num = 0;
+    pthread_t thrd[4];
+    LazyRevokedThreadArg arg[4];
+    uint32_t threadNum = 0;
+    uint32_t joinNum = 0;
+    BSL_Buffer encode = {0};
+
+    ASSERT_EQ(BSL_SAL_ReadFile(path, &encode.data, &encode.dataLen), BSL_SUCCESS);
+    ASSERT_EQ(HITLS_X509_CrlMulParseBuffLazy(format, &encode, 1, &lazyList), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_X509_CrlMulParseBuff(format, &encode, &list), HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_LIST_COUNT(lazyList), BSL_LIST_COUNT(list));
+    ASSERT_TRUE(BSL_LIST_COUNT(list) <= LAZY_REVOKED_CRL_MAX);
+    lazyCrls[0] = BSL_LIST_GET_FIRST(lazyList);
+    crls[0] = BSL_LIST_GET_FIRST(list);
+    while (crls[num] != NULL) {
+        ASSERT_EQ(BSL_LIST_COUNT(lazyCrls[num]->tbs.revokedCerts), 0);
+        num++;
+        lazyCrls[num] = BSL_LIST_GET_NEXT(lazyList);
+        crls[num] = BSL_LIST_GET_NEXT(list);
+    }
+    for (; threadNum < sizeof(thrd) / sizeof(thrd[0]); threadNum++) {
+        arg[threadNum].lazyCrls = lazyCrls;
+        arg[threadNum].crls = crls;
+        arg[threadNum].num = num;
+        ASSERT_EQ(pthread_create(&thrd[threadNum], NULL, LazyRevokedThread, &arg[threadNum]), 0);
+    }
+    for (; joinNum < threadNum; joinNum++) {
+        pthread_join(thrd[joinNum], NULL);
+    }
+    for (uint32_t i = 0; i < threadNum; i++) {
+        ASSERT_EQ(arg[i].ret, HITLS_X509_SUCCESS);
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        ASSERT_EQ(lazyCrls[i]->flag & HITLS_X509_CRL_LAZY_REVOKED, 0);
+        ASSERT_EQ(BSL_LIST_COUNT(lazyCrls[i]->tbs.revokedCerts), BSL_LIST_COUNT(crls[i]->tbs.revokedCerts));
+    }
+exit:
+    for (; joinNum < threadNum; joinNum++) {
+        pthread_join(thrd[joinNum], NULL);
+    }
+    BSL_LIST_FREE(lazyList, (BSL_LIST_PFUNC_FREE)HITLS_X509_CrlFree);
+    BSL_LIST_FREE(list, (BSL_LIST_PFUNC_FREE)HITLS_X509_CrlFree);
+    BSL_SAL_Free(encode.data);
+}
+/* END_CASE */
+
+/* BEGIN_CASE */
+void SDV_X509_CRL_NUMBER_CMP_FUNC_TC001(Hex *a, Hex *b, int expRes)
+{
+    BSL_Buffer numA = {a->x, a->len};
+    BSL_Buffer numB = {b->x, b->len};
+    int32_t res = HITLS_X509_CrlNumberCmp(&numA, &numB);
+    ASSERT_EQ(res < 0 ? -1 : (res > 0 ? 1 : 0), expRes);
+exit:
+    return;
+}
+/* END_CASE */
+
 /* BEGIN_CASE */
 void SDV_X509_CRL_Encode_TC001(int format, char *path)
 {
@@ -432,6 +432,60 @@ exit:
 }
 /* END_CASE */
 
+/**
+ * For test parse 12 with several threads, the result and the errors are the same as the serial parsing.
+*/
+/* BEGIN_CASE */
+void SDV_PKCS12_PARSE_P12_MULTI_THREAD_TC001(char *path, char *pwd, int threadNum)
+{
+    char *wrongPwd = "wrong password";
+    BSL_Buffer encode = {0};
+    BSL_Buffer serialCert = {0};
+    BSL_Buffer threadCert = {0};
+    BSL_Buffer encPwd = {(uint8_t *)pwd, strlen(pwd)};
+    BSL_Buffer wrongEncPwd = {(uint8_t *)wrongPwd, strlen(wrongPwd)};
+    HITLS_PKCS12 *serialP12 = NULL;
+    HITLS_PKCS12 *threadP12 = NULL;
+    HITLS_PKCS12_PwdParam param = {
+        .encPwd = &encPwd,
+        .macPwd = &encPwd,
+    };
+    ASSERT_EQ(BSL_SAL_ReadFile(path, &encode.data, &encode.dataLen), BSL_SUCCESS);
+    ASSERT_EQ(HITLS_PKCS12_ParseBuff(BSL_FORMAT_ASN1, &encode, &param, &serialP12, true), HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_PKCS12_ParseBuffEx(BSL_FORMAT_ASN1, &encode, &param, &threadP12, true, threadNum),
+        HITLS_X509_SUCCESS);
+
+    ASSERT_NE(threadP12->key->value.key, NULL);
+    ASSERT_EQ(CRYPT_EAL_PkeyCmp(threadP12->key->value.key, serialP12->key->value.key), CRYPT_SUCCESS);
+    ASSERT_EQ(HITLS_X509_CertGenBuff(BSL_FORMAT_ASN1, serialP12->entityCert->value.cert, &serialCert),
+        HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_X509_CertGenBuff(BSL_FORMAT_ASN1, threadP12->entityCert->value.cert, &threadCert),
+        HITLS_X509_SUCCESS);
+    ASSERT_COMPARE("entity cert", threadCert.data, threadCert.dataLen, serialCert.data, serialCert.dataLen);
+    ASSERT_EQ(BSL_LIST_COUNT(threadP12->certList), BSL_LIST_COUNT(serialP12->certList));
+    HITLS_PKCS12_Free(threadP12);
+    threadP12 = NULL;
+
+    // The MAC is checked before the contents, whichever task finishes first.
+    param.macPwd = &wrongEncPwd;
+    ASSERT_EQ(HITLS_PKCS12_ParseBuffEx(BSL_FORMAT_ASN1, &encode, &param, &threadP12, true, threadNum),
+        HITLS_PKCS12_ERR_VERIFY_FAIL);
+    param.macPwd = &encPwd;
+    param.encPwd = &wrongEncPwd;
+    int32_t ret = HITLS_PKCS12_ParseBuff(BSL_FORMAT_ASN1, &encode, &param, &threadP12, false);
+    ASSERT_NE(ret, HITLS_X509_SUCCESS);
+    ASSERT_EQ(HITLS_PKCS12_ParseBuffEx(BSL_FORMAT_ASN1, &encode, &param, &threadP12, false, threadNum), ret);
+    ASSERT_EQ(threadP12, NULL);
+exit:
+    BSL_SAL_Free(encode.data);
+    BSL_SAL_Free(serialCert.data);
+    BSL_SAL_Free(threadCert.data);
+    HITLS_PKCS12_Free(serialP12);
+    HITLS_PKCS12_Free(threadP12);
+    return;
+}
+/* END_CASE */
+
 /**
  * For test parse 12 of wrong conditions.
 */
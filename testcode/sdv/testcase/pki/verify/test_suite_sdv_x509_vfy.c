@@ -27,6 +27,7 @@
 #include "hitls_cert_local.h"
 #include "hitls_crl_local.h"
 #include "bsl_list_internal.h"
+#include "stub_replace.h"
 
 /* END_HEADER */
 
@@ -655,3 +656,75 @@ exit:
     BSL_LIST_FREE(chain, (BSL_LIST_PFUNC_FREE)HITLS_X509_CertFree);
 }
 /* END_CASE */
+
+/* BEGIN_CASE */
+void SDV_X509_STORE_LOAD_CA_FILE_FUNC_TC001(int format, char *path, int threadNum, int expRet, int caNum)
+{
+    TestMemInit();
+    HITLS_X509_StoreCtx *store = HITLS_X509_StoreCtxNew();
+    ASSERT_NE(store, NULL);
+    ASSERT_EQ(HITLS_X509_StoreCtxLoadCaFile(store, format, path, threadNum), expRet);
+    ASSERT_EQ(BSL_LIST_COUNT(store->store), caNum);
+    // Loading the same bundle again adds nothing.
+    ASSERT_EQ(HITLS_X509_StoreCtxLoadCaFile(store, format, path, threadNum), expRet);
+    ASSERT_EQ(BSL_LIST_COUNT(store->store), caNum);
+exit:
+    HITLS_X509_StoreCtxFree(store);
+}
+/* END_CASE */
+
+static uint32_t g_mallocLeft = 0;
+
+static void *X509_CountedMalloc(uint32_t size)
+{
+    if (g_mallocLeft == 0 || size == 0) {
+        return NULL;
+    }
+    g_mallocLeft--;
+    return malloc(size);
+}
+
+/**
+ * A load that fails at any allocation, including the ones that add the certs to the store, leaves the store as it
+ * was.
+ */
+/* BEGIN_CASE */
+void SDV_X509_STORE_LOAD_CA_FILE_FUNC_TC002(int format, char *path, int caNum)
+{
+    TestMemInit();
+    FuncStubInfo stubInfo = {0};
+    HITLS_X509_StoreCtx *store = HITLS_X509_StoreCtxNew();
+    ASSERT_NE(store, NULL);
+
+    STUB_Init();
+    ASSERT_EQ(STUB_Replace(&stubInfo, BSL_SAL_Malloc, X509_CountedMalloc), 0);
+    int32_t ret = HITLS_X509_ERR_INVALID_PARAM;
+    for (uint32_t allowed = 0; ret != HITLS_X509_SUCCESS && allowed < 10000; allowed++) {
+        g_mallocLeft = allowed;
+        ret = HITLS_X509_StoreCtxLoadCaFile(store, format, path, 1);
+        if (ret != HITLS_X509_SUCCESS) {
+            ASSERT_EQ(BSL_LIST_COUNT(store->store), 0);
+        }
+    }
+    ASSERT_EQ(ret, HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_LIST_COUNT(store->store), caNum);
+exit:
+    STUB_Reset(&stubInfo);
+    HITLS_X509_StoreCtxFree(store);
+}
+/* END_CASE */
+
+/* BEGIN_CASE */
+void SDV_X509_STORE_LOAD_CRL_FILE_FUNC_TC001(int format, char *path, int threadNum, int crlNum)
+{
+    TestMemInit();
+    HITLS_X509_StoreCtx *store = HITLS_X509_StoreCtxNew();
+    ASSERT_NE(store, NULL);
+    ASSERT_EQ(HITLS_X509_StoreCtxLoadCrlFile(store, format, path, threadNum), HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_LIST_COUNT(store->crl), crlNum);
+    ASSERT_EQ(HITLS_X509_StoreCtxLoadCrlFile(store, format, path, threadNum), HITLS_X509_SUCCESS);
+    ASSERT_EQ(BSL_LIST_COUNT(store->crl), crlNum);
+exit:
+    HITLS_X509_StoreCtxFree(store);
+}
+/* END_CASE */
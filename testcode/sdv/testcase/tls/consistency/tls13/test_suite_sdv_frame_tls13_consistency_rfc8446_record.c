@@ -2556,4 +2556,82 @@ exit:
     FRAME_FreeLink(client);
     FRAME_FreeLink(server);
 }
-/* END_CASE */
\ No newline at end of file
+/* END_CASE */
+
+/** @
+* @test     UT_TLS_TLS13_RFC8998_SM_CIPHERSUITE_FUNC_TC001
+* @spec     RFC 8998 defines TLS_SM4_GCM_SM3 and TLS_SM4_CCM_SM3 for TLS 1.3, with curveSM2 as the key exchange group
+*           and sm2sig_sm3 as the signature scheme.
+* @title    Handshake and application data with the TLS 1.3 SM cipher suites.
+* @precon   nan
+* @brief    1. The client and server use the SM2 certificates, the cipher suite under test, curveSM2 and sm2sig_sm3.
+*           Expected result 1.
+*           2. The client and server exchange application data in both directions. Expected result 2.
+*           3. The client updates the traffic keys and sends application data again. Expected result 3.
+* @expect   1. The handshake succeeds with the cipher suite, the group and the signature scheme.
+*           2. The data is received unchanged.
+*           3. The data is received unchanged.
+@ */
+/* BEGIN_CASE */
+void UT_TLS_TLS13_RFC8998_SM_CIPHERSUITE_FUNC_TC001(int cipherSuite)
+{
+    FRAME_Init();
+    FRAME_LinkObj *client = NULL;
+    FRAME_LinkObj *server = NULL;
+    FRAME_CertInfo certInfo = {
+        "sm2_with_userid/ca.der",
+        "sm2_with_userid/inter.der",
+        "sm2_with_userid/sign.der",
+        NULL,
+        "sm2_with_userid/sign.key.der",
+        NULL,
+    };
+    uint16_t suite = (uint16_t)cipherSuite;
+    uint16_t group = HITLS_EC_GROUP_SM2;
+    uint16_t signAlg = CERT_SIG_SCHEME_SM2_SM3;
+
+    HITLS_Config *tlsConfig = HITLS_CFG_NewTLS13Config();
+    ASSERT_TRUE(tlsConfig != NULL);
+    ASSERT_EQ(HITLS_CFG_SetCipherSuites(tlsConfig, &suite, 1), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_CFG_SetGroups(tlsConfig, &group, 1), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_CFG_SetSignature(tlsConfig, &signAlg, 1), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_CFG_SetClientVerifySupport(tlsConfig, true), HITLS_SUCCESS);
+
+    client = FRAME_CreateLinkWithCert(tlsConfig, BSL_UIO_TCP, &certInfo);
+    server = FRAME_CreateLinkWithCert(tlsConfig, BSL_UIO_TCP, &certInfo);
+    ASSERT_TRUE(client != NULL);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_EQ(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT), HITLS_SUCCESS);
+
+    ASSERT_EQ(client->ssl->negotiatedInfo.cipherSuiteInfo.cipherSuite, suite);
+    ASSERT_EQ(server->ssl->negotiatedInfo.negotiatedGroup, group);
+    ASSERT_EQ(server->ssl->negotiatedInfo.signScheme, signAlg);
+
+    uint8_t src[] = "Hello World";
+    uint8_t dest[READ_BUF_SIZE] = {0};
+    uint32_t writeLen = 0;
+    uint32_t readLen = 0;
+    ASSERT_EQ(HITLS_Write(client->ssl, src, sizeof(src), &writeLen), HITLS_SUCCESS);
+    ASSERT_EQ(FRAME_TrasferMsgBetweenLink(client, server), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Read(server->ssl, dest, READ_BUF_SIZE, &readLen), HITLS_SUCCESS);
+    ASSERT_COMPARE("client to server", dest, readLen, src, sizeof(src));
+
+    ASSERT_EQ(HITLS_Write(server->ssl, src, sizeof(src), &writeLen), HITLS_SUCCESS);
+    ASSERT_EQ(FRAME_TrasferMsgBetweenLink(server, client), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Read(client->ssl, dest, READ_BUF_SIZE, &readLen), HITLS_SUCCESS);
+    ASSERT_COMPARE("server to client", dest, readLen, src, sizeof(src));
+
+    ASSERT_EQ(HITLS_KeyUpdate(client->ssl, HITLS_UPDATE_NOT_REQUESTED), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Connect(client->ssl), HITLS_SUCCESS);
+    ASSERT_EQ(FRAME_TrasferMsgBetweenLink(client, server), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Read(server->ssl, dest, READ_BUF_SIZE, &readLen), HITLS_REC_NORMAL_RECV_BUF_EMPTY);
+    ASSERT_EQ(HITLS_Write(client->ssl, src, sizeof(src), &writeLen), HITLS_SUCCESS);
+    ASSERT_EQ(FRAME_TrasferMsgBetweenLink(client, server), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Read(server->ssl, dest, READ_BUF_SIZE, &readLen), HITLS_SUCCESS);
+    ASSERT_COMPARE("after key update", dest, readLen, src, sizeof(src));
+exit:
+    HITLS_CFG_FreeConfig(tlsConfig);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
@@ -30,6 +30,7 @@
 #include <sys/un.h>
 #include <netinet/in.h>
 #include <netinet/ip.h>
+#include <netinet/tcp.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -1107,3 +1108,290 @@ exit:
     FRAME_FreeLink(client);
 }
 /* END_CASE */
+
+#define KTLS_TEST_LOOP_MAX 1000
+#define KTLS_TEST_RETRY_US 1000
+
+static int32_t KtlsCreateTcpPair(int32_t *clientFd, int32_t *serverFd)
+{
+    struct sockaddr_in addr = {0};
+    socklen_t addrLen = sizeof(addr);
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    int32_t listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        return -1;
+    }
+    if (bind(listenFd, (struct sockaddr *)&addr, addrLen) != 0 || listen(listenFd, 1) != 0 ||
+        getsockname(listenFd, (struct sockaddr *)&addr, &addrLen) != 0) {
+        close(listenFd);
+        return -1;
+    }
+    *clientFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (*clientFd < 0 || connect(*clientFd, (struct sockaddr *)&addr, addrLen) != 0) {
+        close(listenFd);
+        return -1;
+    }
+    *serverFd = accept(listenFd, NULL, NULL);
+    close(listenFd);
+    if (*serverFd < 0) {
+        return -1;
+    }
+    /* Both ends are driven by one thread, so a read without data must not block and small records must not wait
+     * for the delayed ACK of the peer */
+    int32_t noDelay = 1;
+    (void)setsockopt(*clientFd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    (void)setsockopt(*serverFd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    (void)fcntl(*clientFd, F_SETFL, fcntl(*clientFd, F_GETFL, 0) | O_NONBLOCK);
+    (void)fcntl(*serverFd, F_SETFL, fcntl(*serverFd, F_GETFL, 0) | O_NONBLOCK);
+    return 0;
+}
+
+static bool KtlsIsRetry(int32_t ret)
+{
+    return ret == HITLS_SUCCESS || ret == HITLS_REC_NORMAL_RECV_BUF_EMPTY || ret == HITLS_REC_NORMAL_IO_BUSY;
+}
+
+static int32_t KtlsHandshake(HITLS_Ctx *client, HITLS_Ctx *server)
+{
+    int32_t clientRet = HITLS_REC_NORMAL_RECV_BUF_EMPTY;
+    int32_t serverRet = HITLS_REC_NORMAL_RECV_BUF_EMPTY;
+    for (uint32_t i = 0; i < KTLS_TEST_LOOP_MAX; i++) {
+        if (clientRet != HITLS_SUCCESS) {
+            clientRet = HITLS_Connect(client);
+        }
+        if (serverRet != HITLS_SUCCESS) {
+            serverRet = HITLS_Accept(server);
+        }
+        if ((clientRet == HITLS_SUCCESS && serverRet == HITLS_SUCCESS) || !KtlsIsRetry(clientRet) ||
+            !KtlsIsRetry(serverRet)) {
+            break;
+        }
+        (void)usleep(KTLS_TEST_RETRY_US);
+    }
+    return (clientRet != HITLS_SUCCESS) ? clientRet : serverRet;
+}
+
+/* Write the data on one end and read it on the other, the post handshake messages are processed by the read. */
+static int32_t KtlsTransfer(HITLS_Ctx *writer, HITLS_Ctx *reader, const uint8_t *data, uint32_t len)
+{
+    uint32_t writeLen = 0;
+    int32_t ret = HITLS_Write(writer, data, len, &writeLen);
+    if (ret != HITLS_SUCCESS || writeLen != len) {
+        return HITLS_INTERNAL_EXCEPTION;
+    }
+    uint8_t buf[READ_BUF_SIZE] = {0};
+    uint32_t readLen = 0;
+    for (uint32_t i = 0; i < KTLS_TEST_LOOP_MAX; i++) {
+        ret = HITLS_Read(reader, buf, sizeof(buf), &readLen);
+        if (ret != HITLS_REC_NORMAL_RECV_BUF_EMPTY) {
+            break;
+        }
+        (void)usleep(KTLS_TEST_RETRY_US);
+    }
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    return (readLen == len && memcmp(buf, data, len) == 0) ? HITLS_SUCCESS : HITLS_INTERNAL_EXCEPTION;
+}
+
+/* Read the data one byte per call, so that every record is larger than the buffer of the caller. */
+static int32_t KtlsReadByByte(HITLS_Ctx *reader, const uint8_t *data, uint32_t len)
+{
+    uint8_t buf[READ_BUF_SIZE] = {0};
+    uint32_t offset = 0;
+    int32_t ret = HITLS_SUCCESS;
+    for (uint32_t i = 0; i < KTLS_TEST_LOOP_MAX && offset < len && offset < sizeof(buf); i++) {
+        uint32_t readLen = 0;
+        ret = HITLS_Read(reader, buf + offset, 1, &readLen);
+        if (ret == HITLS_REC_NORMAL_RECV_BUF_EMPTY) {
+            (void)usleep(KTLS_TEST_RETRY_US);
+            continue;
+        }
+        if (ret != HITLS_SUCCESS || readLen != 1) {
+            return HITLS_INTERNAL_EXCEPTION;
+        }
+        offset++;
+    }
+    return (offset == len && memcmp(buf, data, len) == 0) ? HITLS_SUCCESS : HITLS_INTERNAL_EXCEPTION;
+}
+
+/* @
+* @test  UT_TLS_CM_KTLS_FUNC_TC001
+* @title  Kernel TLS offload of an established connection
+* @precon  nan
+* @brief    1. Set up a TLS connection over a loopback TCP socket pair with the kTLS switch enabled on both ends.
+*              Expected result 1
+*           2. Transfer application data in both directions. Expected result 2
+*           3. TLS1.3: update the keys with HITLS_KeyUpdate and transfer application data again. Expected result 2
+*           4. TLS1.2: start a renegotiation. Expected result 3
+* @expect   1. The connection is set up and both directions of both ends are offloaded. The case is skipped if the
+*              kernel does not provide the tls module.
+*           2. The data is received by the peer.
+*           3. HITLS_CM_LINK_UNSUPPORT_SECURE_RENEGOTIATION is returned and the connection is still usable.
+@ */
+/* BEGIN_CASE */
+void UT_TLS_CM_KTLS_FUNC_TC001(int version)
+{
+    FRAME_Init();
+    HITLS_Config *config = NULL;
+    HITLS_Ctx *client = NULL;
+    HITLS_Ctx *server = NULL;
+    BSL_UIO *clientUio = NULL;
+    BSL_UIO *serverUio = NULL;
+    int32_t clientFd = -1;
+    int32_t serverFd = -1;
+    uint8_t state = 0;
+    uint8_t data[] = "kernel tls application data";
+    uint16_t tls13Suites[] = {HITLS_AES_128_GCM_SHA256};
+    uint16_t tls12Suites[] = {HITLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256};
+
+    config = (version == HITLS_VERSION_TLS13) ? HITLS_CFG_NewTLS13Config() : HITLS_CFG_NewTLS12Config();
+    ASSERT_TRUE(config != NULL);
+    ASSERT_EQ(HiTLS_X509_LoadCertAndKey(config, ECDSA_SHA_CA_PATH, ECDSA_SHA_CHAIN_PATH, ECDSA_SHA256_EE_PATH, NULL,
+        ECDSA_SHA256_PRIV_PATH, NULL), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_CFG_SetCheckKeyUsage(config, false), HITLS_SUCCESS);
+    if (version == HITLS_VERSION_TLS13) {
+        ASSERT_EQ(HITLS_CFG_SetCipherSuites(config, tls13Suites, sizeof(tls13Suites) / sizeof(uint16_t)),
+            HITLS_SUCCESS);
+    } else {
+        ASSERT_EQ(HITLS_CFG_SetCipherSuites(config, tls12Suites, sizeof(tls12Suites) / sizeof(uint16_t)),
+            HITLS_SUCCESS);
+        ASSERT_EQ(HITLS_CFG_SetRenegotiationSupport(config, true), HITLS_SUCCESS);
+    }
+    ASSERT_EQ(HITLS_CFG_SetKtlsSwitch(config, true), HITLS_SUCCESS);
+
+    ASSERT_EQ(KtlsCreateTcpPair(&clientFd, &serverFd), 0);
+    client = HITLS_New(config);
+    server = HITLS_New(config);
+    ASSERT_TRUE(client != NULL && server != NULL);
+    clientUio = BSL_UIO_New(BSL_UIO_TcpMethod());
+    serverUio = BSL_UIO_New(BSL_UIO_TcpMethod());
+    ASSERT_TRUE(clientUio != NULL && serverUio != NULL);
+    ASSERT_EQ(BSL_UIO_Ctrl(clientUio, BSL_UIO_SET_FD, (int32_t)sizeof(clientFd), &clientFd), BSL_SUCCESS);
+    ASSERT_EQ(BSL_UIO_Ctrl(serverUio, BSL_UIO_SET_FD, (int32_t)sizeof(serverFd), &serverFd), BSL_SUCCESS);
+    ASSERT_EQ(HITLS_SetUio(client, clientUio), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_SetUio(server, serverUio), HITLS_SUCCESS);
+
+    ASSERT_EQ(KtlsHandshake(client, server), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_GetKtlsState(client, &state), HITLS_SUCCESS);
+    if (state == 0) {
+        SKIP_TEST();
+    }
+    ASSERT_EQ(state, HITLS_KTLS_TX | HITLS_KTLS_RX);
+    ASSERT_EQ(HITLS_GetKtlsState(server, &state), HITLS_SUCCESS);
+    ASSERT_EQ(state, HITLS_KTLS_TX | HITLS_KTLS_RX);
+
+    ASSERT_EQ(KtlsTransfer(server, client, data, sizeof(data)), HITLS_SUCCESS);
+    ASSERT_EQ(KtlsTransfer(client, server, data, sizeof(data)), HITLS_SUCCESS);
+
+    if (version == HITLS_VERSION_TLS13) {
+        /* The server answers the requested update with its own KeyUpdate before the next data */
+        ASSERT_EQ(HITLS_KeyUpdate(client, HITLS_UPDATE_REQUESTED), HITLS_SUCCESS);
+        ASSERT_EQ(KtlsTransfer(client, server, data, sizeof(data)), HITLS_SUCCESS);
+        ASSERT_EQ(KtlsTransfer(server, client, data, sizeof(data)), HITLS_SUCCESS);
+    } else {
+        ASSERT_EQ(HITLS_Renegotiate(client), HITLS_CM_LINK_UNSUPPORT_SECURE_RENEGOTIATION);
+        ASSERT_EQ(HITLS_Renegotiate(server), HITLS_CM_LINK_UNSUPPORT_SECURE_RENEGOTIATION);
+        ASSERT_EQ(KtlsTransfer(server, client, data, sizeof(data)), HITLS_SUCCESS);
+    }
+    ASSERT_EQ(KtlsTransfer(client, server, data, sizeof(data)), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_GetKtlsState(client, &state), HITLS_SUCCESS);
+    ASSERT_EQ(state, HITLS_KTLS_TX | HITLS_KTLS_RX);
+exit:
+    HITLS_Free(client);
+    HITLS_Free(server);
+    BSL_UIO_Free(clientUio);
+    BSL_UIO_Free(serverUio);
+    HITLS_CFG_FreeConfig(config);
+    if (clientFd >= 0) {
+        close(clientFd);
+    }
+    if (serverFd >= 0) {
+        close(serverFd);
+    }
+}
+/* END_CASE */
+
+/* @
+* @test  UT_TLS_CM_KTLS_FUNC_TC002
+* @title  Kernel TLS offload, reads smaller than the pending post handshake records
+* @precon  nan
+* @brief    1. Set up a TLS1.3 connection over a loopback TCP socket pair with the kTLS switch enabled on both ends.
+*              Expected result 1
+*           2. The server writes application data behind its NewSessionTicket, the client reads it one byte per
+*              call. Expected result 2
+*           3. The server sends a KeyUpdate and application data, the client reads it one byte per call.
+*              Expected result 2
+*           4. Transfer application data from the client to the server. Expected result 3
+* @expect   1. The connection is set up and the client receives through the kernel. The case is skipped if the
+*              kernel does not provide the tls module.
+*           2. The handshake records are processed whole and the application data is received byte by byte.
+*           3. The data is received by the peer.
+@ */
+/* BEGIN_CASE */
+void UT_TLS_CM_KTLS_FUNC_TC002(void)
+{
+    FRAME_Init();
+    HITLS_Config *config = NULL;
+    HITLS_Ctx *client = NULL;
+    HITLS_Ctx *server = NULL;
+    BSL_UIO *clientUio = NULL;
+    BSL_UIO *serverUio = NULL;
+    int32_t clientFd = -1;
+    int32_t serverFd = -1;
+    uint8_t state = 0;
+    uint32_t writeLen = 0;
+    uint8_t data[] = "kernel tls application data";
+    uint16_t suites[] = {HITLS_AES_128_GCM_SHA256};
+
+    config = HITLS_CFG_NewTLS13Config();
+    ASSERT_TRUE(config != NULL);
+    ASSERT_EQ(HiTLS_X509_LoadCertAndKey(config, ECDSA_SHA_CA_PATH, ECDSA_SHA_CHAIN_PATH, ECDSA_SHA256_EE_PATH, NULL,
+        ECDSA_SHA256_PRIV_PATH, NULL), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_CFG_SetCheckKeyUsage(config, false), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_CFG_SetCipherSuites(config, suites, sizeof(suites) / sizeof(uint16_t)), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_CFG_SetKtlsSwitch(config, true), HITLS_SUCCESS);
+
+    ASSERT_EQ(KtlsCreateTcpPair(&clientFd, &serverFd), 0);
+    client = HITLS_New(config);
+    server = HITLS_New(config);
+    ASSERT_TRUE(client != NULL && server != NULL);
+    clientUio = BSL_UIO_New(BSL_UIO_TcpMethod());
+    serverUio = BSL_UIO_New(BSL_UIO_TcpMethod());
+    ASSERT_TRUE(clientUio != NULL && serverUio != NULL);
+    ASSERT_EQ(BSL_UIO_Ctrl(clientUio, BSL_UIO_SET_FD, (int32_t)sizeof(clientFd), &clientFd), BSL_SUCCESS);
+    ASSERT_EQ(BSL_UIO_Ctrl(serverUio, BSL_UIO_SET_FD, (int32_t)sizeof(serverFd), &serverFd), BSL_SUCCESS);
+    ASSERT_EQ(HITLS_SetUio(client, clientUio), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_SetUio(server, serverUio), HITLS_SUCCESS);
+
+    ASSERT_EQ(KtlsHandshake(client, server), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_GetKtlsState(client, &state), HITLS_SUCCESS);
+    if ((state & HITLS_KTLS_RX) == 0) {
+        SKIP_TEST();
+    }
+
+    ASSERT_EQ(HITLS_Write(server, data, sizeof(data), &writeLen), HITLS_SUCCESS);
+    ASSERT_EQ(writeLen, sizeof(data));
+    ASSERT_EQ(KtlsReadByByte(client, data, sizeof(data)), HITLS_SUCCESS);
+
+    ASSERT_EQ(HITLS_KeyUpdate(server, HITLS_UPDATE_NOT_REQUESTED), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Write(server, data, sizeof(data), &writeLen), HITLS_SUCCESS);
+    ASSERT_EQ(writeLen, sizeof(data));
+    ASSERT_EQ(KtlsReadByByte(client, data, sizeof(data)), HITLS_SUCCESS);
+
+    ASSERT_EQ(KtlsTransfer(client, server, data, sizeof(data)), HITLS_SUCCESS);
+exit:
+    HITLS_Free(client);
+    HITLS_Free(server);
+    BSL_UIO_Free(clientUio);
+    BSL_UIO_Free(serverUio);
+    HITLS_CFG_FreeConfig(config);
+    if (clientFd >= 0) {
+        close(clientFd);
+    }
+    if (serverFd >= 0) {
+        close(serverFd);
+    }
+}
+/* END_CASE */
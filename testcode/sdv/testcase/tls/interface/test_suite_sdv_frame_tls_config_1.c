@@ -1684,4 +1684,76 @@ void UT_TLS_CFG_SET_KeyLogCb_TC001()
 exit:
     HITLS_CFG_FreeConfig(config);
 }
-/* END_CASE */
\ No newline at end of file
+/* END_CASE */
+/* @
+* @test  UT_TLS_CFG_SET_KEYSHARE_POOL_FUNC_TC001
+* @title  Test the HITLS_CFG_SetKeySharePool and HITLS_CFG_GetKeySharePoolKeyNum interfaces.
+* @precon  nan
+* @brief   1. Set the pool with a null config, null groups, keyNum 0 and a repeated group. Expected result 1.
+*          2. Keep 4 keys of x25519 and secp256r1 on the server and wait for the pool to fill. Expected result 2.
+*          3. Establish a connection with a client that only offers x25519. Expected result 3.
+*          4. Release the pool. Expected result 4.
+* @expect  1. The interface returns an error code.
+*          2. Both groups hold 4 keys.
+*          3. The connection is established, the server used one x25519 key of the pool and no secp256r1 key.
+*          4. No group holds a key.
+@ */
+/* BEGIN_CASE */
+void UT_TLS_CFG_SET_KEYSHARE_POOL_FUNC_TC001(int tlsVersion)
+{
+    FRAME_Init();
+    HITLS_Config *config_c = NULL;
+    HITLS_Config *config_s = NULL;
+    FRAME_LinkObj *client = NULL;
+    FRAME_LinkObj *server = NULL;
+    uint16_t groups[] = {HITLS_EC_GROUP_CURVE25519, HITLS_EC_GROUP_SECP256R1};
+    uint16_t repeated[] = {HITLS_EC_GROUP_CURVE25519, HITLS_EC_GROUP_CURVE25519};
+    uint16_t clientGroup = HITLS_EC_GROUP_CURVE25519;
+    uint32_t keyNum = 0;
+
+    config_c = GetHitlsConfigViaVersion(tlsVersion);
+    config_s = GetHitlsConfigViaVersion(tlsVersion);
+    ASSERT_TRUE(config_c != NULL);
+    ASSERT_TRUE(config_s != NULL);
+
+    ASSERT_EQ(HITLS_CFG_SetKeySharePool(NULL, groups, 2, 4), HITLS_NULL_INPUT);
+    ASSERT_EQ(HITLS_CFG_SetKeySharePool(config_s, NULL, 2, 4), HITLS_NULL_INPUT);
+    ASSERT_EQ(HITLS_CFG_SetKeySharePool(config_s, groups, 2, 0), HITLS_CONFIG_INVALID_LENGTH);
+    ASSERT_EQ(HITLS_CFG_SetKeySharePool(config_s, repeated, 2, 4), HITLS_CONFIG_INVALID_SET);
+    ASSERT_EQ(HITLS_CFG_GetKeySharePoolKeyNum(config_s, HITLS_EC_GROUP_CURVE25519, NULL), HITLS_NULL_INPUT);
+
+    ASSERT_EQ(HITLS_CFG_SetKeySharePool(config_s, groups, 2, 4), HITLS_SUCCESS);
+    for (int i = 0; i < 100; i++) {
+        uint32_t other = 0;
+        ASSERT_EQ(HITLS_CFG_GetKeySharePoolKeyNum(config_s, HITLS_EC_GROUP_CURVE25519, &keyNum), HITLS_SUCCESS);
+        ASSERT_EQ(HITLS_CFG_GetKeySharePoolKeyNum(config_s, HITLS_EC_GROUP_SECP256R1, &other), HITLS_SUCCESS);
+        if (keyNum == 4 && other == 4) {
+            break;
+        }
+        usleep(10000);
+    }
+    ASSERT_EQ(keyNum, 4);
+
+    ASSERT_EQ(HITLS_CFG_SetGroups(config_c, &clientGroup, 1), HITLS_SUCCESS);
+    client = FRAME_CreateLink(config_c, BSL_UIO_TCP);
+    ASSERT_TRUE(client != NULL);
+    server = FRAME_CreateLink(config_s, BSL_UIO_TCP);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_EQ(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT), HITLS_SUCCESS);
+
+    /* 3 keys left is above half of the pool, so no refill has been started */
+    ASSERT_EQ(HITLS_CFG_GetKeySharePoolKeyNum(config_s, HITLS_EC_GROUP_CURVE25519, &keyNum), HITLS_SUCCESS);
+    ASSERT_EQ(keyNum, 3);
+    ASSERT_EQ(HITLS_CFG_GetKeySharePoolKeyNum(config_s, HITLS_EC_GROUP_SECP256R1, &keyNum), HITLS_SUCCESS);
+    ASSERT_EQ(keyNum, 4);
+
+    ASSERT_EQ(HITLS_CFG_SetKeySharePool(config_s, NULL, 0, 0), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_CFG_GetKeySharePoolKeyNum(config_s, HITLS_EC_GROUP_CURVE25519, &keyNum), HITLS_SUCCESS);
+    ASSERT_EQ(keyNum, 0);
+exit:
+    HITLS_CFG_FreeConfig(config_c);
+    HITLS_CFG_FreeConfig(config_s);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
@@ -111,7 +111,7 @@ HITLS_CERT_KeyType SAL_CERT_SignScheme2CertKeyType(HITLS_SignHashAlgo signScheme
             return TLS_CERT_KEY_TYPE_ED25519;
         case CERT_SIG_SCHEME_ED448:
             return TLS_CERT_KEY_TYPE_ED448;
-#ifdef HITLS_TLS_PROTO_TLCP11
+#if defined(HITLS_TLS_PROTO_TLCP11) || defined(HITLS_TLS_SUITE_AUTH_SM2)
         case CERT_SIG_SCHEME_SM2_SM3:
             return TLS_CERT_KEY_TYPE_SM2;
 #endif
@@ -136,7 +136,7 @@ HITLS_SignHashAlgo SAL_CERT_GetDefaultSignHashAlgo(HITLS_CERT_KeyType keyType)
             return CERT_SIG_SCHEME_ED25519;
         case TLS_CERT_KEY_TYPE_ED448:
             return CERT_SIG_SCHEME_ED448;
-#ifdef HITLS_TLS_PROTO_TLCP11
+#if defined(HITLS_TLS_PROTO_TLCP11) || defined(HITLS_TLS_SUITE_AUTH_SM2)
         case TLS_CERT_KEY_TYPE_SM2:
             return CERT_SIG_SCHEME_SM2_SM3;
 #endif
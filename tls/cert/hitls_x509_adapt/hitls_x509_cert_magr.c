@@ -138,7 +138,7 @@ static HITLS_SignHashAlgo BslCid2SignHashAlgo(BslCid cid)
         { BSL_CID_ECDSAWITHSHA256, CERT_SIG_SCHEME_ECDSA_SECP256R1_SHA256 },
         { BSL_CID_ECDSAWITHSHA384, CERT_SIG_SCHEME_ECDSA_SECP384R1_SHA384 },
         { BSL_CID_ECDSAWITHSHA512, CERT_SIG_SCHEME_ECDSA_SECP521R1_SHA512 },
-#ifdef HITLS_TLS_PROTO_TLCP11
+#if defined(HITLS_TLS_PROTO_TLCP11) || defined(HITLS_TLS_SUITE_AUTH_SM2)
         { BSL_CID_SM2DSAWITHSM3, CERT_SIG_SCHEME_SM2_SM3 },
 #endif
         { BSL_CID_ED25519, CERT_SIG_SCHEME_ED25519 },
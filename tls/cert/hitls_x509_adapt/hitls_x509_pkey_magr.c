@@ -274,7 +274,7 @@ static HITLS_CERT_KeyType CertKeyAlgId2KeyType(CRYPT_EAL_PkeyCtx *pkey)
         {CRYPT_PKEY_DSA, TLS_CERT_KEY_TYPE_DSA},
         {CRYPT_PKEY_ECDSA, TLS_CERT_KEY_TYPE_ECDSA},
         {CRYPT_PKEY_ED25519, TLS_CERT_KEY_TYPE_ED25519},
-#ifdef HITLS_TLS_PROTO_TLCP11
+#if defined(HITLS_TLS_PROTO_TLCP11) || defined(HITLS_TLS_SUITE_AUTH_SM2)
         {CRYPT_PKEY_SM2, TLS_CERT_KEY_TYPE_SM2},
 #endif
     };
@@ -258,6 +258,12 @@ int32_t CommonEventInHandshakingState(HITLS_Ctx *ctx)
     // If HS_DoHandshake returns success, the connection has been established.
     ChangeConnState(ctx, CM_STATE_TRANSPORTING);
     HS_DeInit(ctx);
+#ifdef HITLS_TLS_FEATURE_KTLS
+    if (ctx->config.tlsConfig.isKtlsEnable) {
+        /* The connection keeps the user space record layer if the kernel can not take over */
+        (void)REC_KtlsEnable(ctx);
+    }
+#endif
 
     return HITLS_SUCCESS;
 }
@@ -23,6 +23,9 @@
 #include "session.h"
 #endif
 #include "cert_method.h"
+#ifdef HITLS_TLS_FEATURE_KTLS
+#include "rec.h"
+#endif
 
 #ifdef HITLS_TLS_CONNECTION_INFO_NEGOTIATION
 int32_t HITLS_GetNegotiatedVersion(const HITLS_Ctx *ctx, uint16_t *version)
@@ -475,6 +478,35 @@ int32_t HITLS_GetFlightTransmitSwitch(const HITLS_Ctx *ctx, uint8_t *isEnable)
     return HITLS_CFG_GetFlightTransmitSwitch(&(ctx->config.tlsConfig), isEnable);
 }
 #endif
+#ifdef HITLS_TLS_FEATURE_KTLS
+int32_t HITLS_SetKtlsSwitch(HITLS_Ctx *ctx, uint8_t isEnable)
+{
+    if (ctx == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+
+    return HITLS_CFG_SetKtlsSwitch(&(ctx->config.tlsConfig), isEnable);
+}
+
+int32_t HITLS_GetKtlsSwitch(const HITLS_Ctx *ctx, uint8_t *isEnable)
+{
+    if (ctx == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+
+    return HITLS_CFG_GetKtlsSwitch(&(ctx->config.tlsConfig), isEnable);
+}
+
+int32_t HITLS_GetKtlsState(const HITLS_Ctx *ctx, uint8_t *state)
+{
+    if (ctx == NULL || state == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+
+    *state = REC_KtlsGetState(ctx);
+    return HITLS_SUCCESS;
+}
+#endif
 
 #ifdef HITLS_TLS_CONFIG_CERT
 /**
@@ -639,6 +639,15 @@ static int32_t CheckRenegotiateValid(HITLS_Ctx *ctx)
         return HITLS_CM_LINK_UNSUPPORT_SECURE_RENEGOTIATION;
     }
 
+#ifdef HITLS_TLS_FEATURE_KTLS
+    /* The kernel keeps the record keys once offloaded, they can not be changed by a new handshake. */
+    if (REC_KtlsGetState(ctx) != 0) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17339, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
+            "renegotiation is not supported with kernel tls.", 0, 0, 0, 0);
+        return HITLS_CM_LINK_UNSUPPORT_SECURE_RENEGOTIATION;
+    }
+#endif
+
     /* If the link is not established, renegotiation cannot be performed. */
     if ((ctx->state != CM_STATE_TRANSPORTING) && (ctx->state != CM_STATE_RENEGOTIATION)) {
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15954, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
@@ -93,7 +93,12 @@ static int32_t RecvRenegoReqPreprocess(TLS_Ctx *ctx, uint8_t type)
     }
     /* Renegotiation request is processed only after security renegotiation is negotiated. Otherwise, no renegotiation
      * alert is generated and the peer determines whether to disconnect the link */
-    if (!ctx->negotiatedInfo.isSecureRenegotiation || !ctx->config.tlsConfig.isSupportRenegotiation) {
+    bool isSupport = ctx->negotiatedInfo.isSecureRenegotiation && ctx->config.tlsConfig.isSupportRenegotiation;
+#ifdef HITLS_TLS_FEATURE_KTLS
+    /* The record keys offloaded to the kernel can not be replaced by a new handshake. */
+    isSupport = isSupport && (REC_KtlsGetState(ctx) == 0);
+#endif
+    if (!isSupport) {
         if (type == HELLO_REQUEST) {
             BSL_LOG_BINLOG_FIXLEN(BINLOG_ID16516, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
                 "not support Renegotiation", 0, 0, 0, 0);
@@ -233,3 +233,23 @@ int32_t HITLS_Write(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint3
     }
     return ret;
 }
+
+#ifdef HITLS_TLS_FEATURE_KTLS
+int32_t HITLS_SendFile(HITLS_Ctx *ctx, int32_t fd, int64_t offset, uint32_t len, uint32_t *sentLen)
+{
+    if (ctx == NULL || fd < 0 || len == 0 || sentLen == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    *sentLen = 0;
+
+    int32_t ret = HITLS_WritePreporcess(ctx);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    /* The file content bypasses the record layer, so it is only sent on an established link */
+    if (GetConnState(ctx) != CM_STATE_TRANSPORTING) {
+        return HITLS_CM_LINK_UNESTABLISHED;
+    }
+    return REC_KtlsSendFile(ctx, fd, offset, len, sentLen);
+}
+#endif
@@ -17,7 +17,10 @@
 #define CONFIG_H
 
 #include <stdint.h>
+#include "hitls_build.h"
 #include "hitls_type.h"
+#include "hitls_crypt_type.h"
+#include "tls_config.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,6 +32,14 @@ void CFG_CleanConfig(HITLS_Config *config);
 /** copy the TLS configuration */
 int32_t DumpConfig(HITLS_Ctx *ctx, const HITLS_Config *srcConfig);
 
+#ifdef HITLS_TLS_FEATURE_KEY_SHARE_POOL
+/** take a pregenerated key of the group out of the key share pool, NULL if none is ready */
+HITLS_CRYPT_Key *CFG_KeySharePoolTake(CFG_KeySharePool *pool, uint16_t group);
+
+/** stop the refill thread and release the pool together with the keys it still holds */
+void CFG_KeySharePoolFree(CFG_KeySharePool *pool);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
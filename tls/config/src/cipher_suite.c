@@ -132,6 +132,38 @@ static const CipherSuiteInfo g_cipherSuiteList[] = {
         .cipherType = HITLS_AEAD_CIPHER,
         .strengthBits = 128},
 #endif
+#ifdef HITLS_TLS_SUITE_SM4_GCM_SM3
+    {.enable = true,
+        .name = CIPHER_NAME("HITLS_SM4_GCM_SM3"),
+        .stdName = CIPHER_NAME("TLS_SM4_GCM_SM3"),
+        .cipherSuite = HITLS_SM4_GCM_SM3,
+        .cipherAlg = HITLS_CIPHER_SM4_GCM,
+        .kxAlg = HITLS_KEY_EXCH_NULL,
+        .authAlg = HITLS_AUTH_ANY,
+        .macAlg = HITLS_MAC_AEAD,
+        .hashAlg = HITLS_HASH_SM3,
+        .signScheme = CERT_SIG_SCHEME_UNKNOWN,
+        KEY_BLOCK_PARTITON_LENGTH(12u, 16u, 0u, 0u, 0u, 16u),
+        VERSION_SCOPE(HITLS_VERSION_TLS13, HITLS_VERSION_TLS13, 0u, 0u),
+        .cipherType = HITLS_AEAD_CIPHER,
+        .strengthBits = 128},
+#endif
+#ifdef HITLS_TLS_SUITE_SM4_CCM_SM3
+    {.enable = true,
+        .name = CIPHER_NAME("HITLS_SM4_CCM_SM3"),
+        .stdName = CIPHER_NAME("TLS_SM4_CCM_SM3"),
+        .cipherSuite = HITLS_SM4_CCM_SM3,
+        .cipherAlg = HITLS_CIPHER_SM4_CCM,
+        .kxAlg = HITLS_KEY_EXCH_NULL,
+        .authAlg = HITLS_AUTH_ANY,
+        .macAlg = HITLS_MAC_AEAD,
+        .hashAlg = HITLS_HASH_SM3,
+        .signScheme = CERT_SIG_SCHEME_UNKNOWN,
+        KEY_BLOCK_PARTITON_LENGTH(12u, 16u, 0u, 0u, 0u, 16u),
+        VERSION_SCOPE(HITLS_VERSION_TLS13, HITLS_VERSION_TLS13, 0u, 0u),
+        .cipherType = HITLS_AEAD_CIPHER,
+        .strengthBits = 128},
+#endif
 #ifdef HITLS_TLS_SUITE_RSA_WITH_AES_128_CBC_SHA
     {.enable = true,
         .name = CIPHER_NAME("HITLS_RSA_WITH_AES_128_CBC_SHA"),
@@ -1502,6 +1534,10 @@ const SignSchemeInfo g_signSchemeList[] = {
     { CERT_SIG_SCHEME_DSA_SHA512, HITLS_SIGN_DSA, HITLS_HASH_SHA_512 },
     { CERT_SIG_SCHEME_DSA_SHA1, HITLS_SIGN_DSA, HITLS_HASH_SHA1 },
 #endif
+
+#if defined(HITLS_TLS_SUITE_AUTH_SM2) && defined(HITLS_TLS_PROTO_TLS13)
+    { CERT_SIG_SCHEME_SM2_SM3, HITLS_SIGN_SM2, HITLS_HASH_SM3 },
+#endif
 };
 
 const EcdsaCurveInfo g_ecdsaCurveInfo[] = {
@@ -1732,7 +1768,8 @@ bool CFG_GetSignParamBySchemes(uint16_t version, HITLS_SignHashAlgo scheme, HITL
     (void)signAlg;
     (void)hashAlg;
 #if (defined(HITLS_TLS_PROTO_TLS12) || defined(HITLS_TLS_PROTO_TLS13)  || defined(HITLS_TLS_PROTO_DTLS12)) && \
-    (defined(HITLS_TLS_SUITE_AUTH_RSA) || defined(HITLS_TLS_SUITE_AUTH_ECDSA) || defined(HITLS_TLS_SUITE_AUTH_DSS))
+    (defined(HITLS_TLS_SUITE_AUTH_RSA) || defined(HITLS_TLS_SUITE_AUTH_ECDSA) || defined(HITLS_TLS_SUITE_AUTH_DSS) || \
+    (defined(HITLS_TLS_SUITE_AUTH_SM2) && defined(HITLS_TLS_PROTO_TLS13)))
     /** @alias Search for the signature hash algorithm. If the algorithm is found, ret=true */
     for (uint32_t i = 0; i < (sizeof(g_signSchemeList) / sizeof(g_signSchemeList[0])); i++) {
         if (scheme == g_signSchemeList[i].scheme) {
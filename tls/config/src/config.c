@@ -41,6 +41,7 @@
 #ifdef HITLS_TLS_FEATURE_SESSION
 #include "session_mgr.h"
 #endif
+#include "config.h"
 #include "config_check.h"
 #include "config_default.h"
 #include "bsl_list.h"
@@ -96,6 +97,10 @@ void CFG_CleanConfig(HITLS_Config *config)
 #ifdef HITLS_TLS_CONFIG_MANUAL_DH
     SAL_CRYPT_FreeDhKey(config->dhTmp);
 #endif
+#ifdef HITLS_TLS_FEATURE_KEY_SHARE_POOL
+    CFG_KeySharePoolFree(config->keySharePool);
+    config->keySharePool = NULL;
+#endif
 #ifdef HITLS_TLS_FEATURE_SESSION
     SESSMGR_Free(config->sessMgr);
     config->sessMgr = NULL;
@@ -194,6 +199,9 @@ static void ShallowCopy(HITLS_Ctx *ctx, const HITLS_Config *srcConfig)
 #ifdef HITLS_TLS_FEATURE_FLIGHT
     destConfig->isFlightTransmitEnable = srcConfig->isFlightTransmitEnable;
 #endif
+#ifdef HITLS_TLS_FEATURE_KTLS
+    destConfig->isKtlsEnable = srcConfig->isKtlsEnable;
+#endif
 }
 
 static int32_t DeepCopy(void** destConfig, const void* srcConfig, uint32_t logId, uint32_t len)
@@ -795,6 +803,12 @@ int32_t HITLS_CFG_SetVersionForbid(HITLS_Config *config, uint32_t noVersion)
 }
 #endif
 
+static bool IsTls13CipherSuite(uint16_t cipherSuite)
+{
+    return (cipherSuite >= HITLS_AES_128_GCM_SHA256 && cipherSuite <= HITLS_AES_128_CCM_8_SHA256) ||
+        cipherSuite == HITLS_SM4_GCM_SM3 || cipherSuite == HITLS_SM4_CCM_SM3;
+}
+
 static void GetCipherSuitesCnt(const uint16_t *cipherSuites, uint32_t cipherSuitesSize,
     uint32_t *tls13CipherSize, uint32_t *tlsCipherSize)
 {
@@ -803,7 +817,7 @@ static void GetCipherSuitesCnt(const uint16_t *cipherSuites, uint32_t cipherSuit
     uint32_t tmpTls13CipherSize = *tls13CipherSize;
     for (uint32_t i = 0; i < cipherSuitesSize; i++) {
 #ifdef HITLS_TLS_PROTO_TLS13
-        if (cipherSuites[i] >= HITLS_AES_128_GCM_SHA256 && cipherSuites[i] <= HITLS_AES_128_CCM_8_SHA256) {
+        if (IsTls13CipherSuite(cipherSuites[i])) {
             tmpTls13CipherSize++;
             continue;
         }
@@ -850,7 +864,7 @@ int32_t HITLS_CFG_SetCipherSuites(HITLS_Config *config, const uint16_t *cipherSu
         if (CFG_CheckCipherSuiteSupported(cipherSuites[i]) != true) {
             continue;
         }
-        if (cipherSuites[i] >= HITLS_AES_128_GCM_SHA256 && cipherSuites[i] <= HITLS_AES_128_CCM_8_SHA256) {
+        if (IsTls13CipherSuite(cipherSuites[i])) {
 #ifdef HITLS_TLS_PROTO_TLS13
             tls13CipherSuite[validTls13Cipher] = cipherSuites[i];
             validTls13Cipher++;
@@ -1799,6 +1813,28 @@ int32_t HITLS_CFG_GetFlightTransmitSwitch(const HITLS_Config *config, uint8_t *i
 }
 #endif
 
+#ifdef HITLS_TLS_FEATURE_KTLS
+int32_t HITLS_CFG_SetKtlsSwitch(HITLS_Config *config, uint8_t isEnable)
+{
+    if (config == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+
+    config->isKtlsEnable = (isEnable != 0);
+    return HITLS_SUCCESS;
+}
+
+int32_t HITLS_CFG_GetKtlsSwitch(const HITLS_Config *config, uint8_t *isEnable)
+{
+    if (config == NULL || isEnable == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+
+    *isEnable = config->isKtlsEnable;
+    return HITLS_SUCCESS;
+}
+#endif
+
 #ifdef HITLS_TLS_MAINTAIN_KEYLOG
 int32_t HITLS_CFG_SetKeyLogCb(HITLS_Config *config, HITLS_KeyLogCb callback)
 {
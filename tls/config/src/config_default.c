@@ -276,6 +276,9 @@ static void InitConfig(HITLS_Config *config)
 #ifdef HITLS_TLS_FEATURE_FLIGHT
     config->isFlightTransmitEnable = false;
 #endif
+#ifdef HITLS_TLS_FEATURE_KTLS
+    config->isKtlsEnable = false;
+#endif
 #ifdef HITLS_TLS_FEATURE_CERT_MODE
     /** Set the certificate verification mode */
     config->isSupportClientVerify = false;
@@ -0,0 +1,315 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hitls_build.h"
+#ifdef HITLS_TLS_FEATURE_KEY_SHARE_POOL
+#include "securec.h"
+#include "bsl_log_internal.h"
+#include "bsl_err_internal.h"
+#include "bsl_log.h"
+#include "bsl_sal.h"
+#include "hitls_type.h"
+#include "hitls_error.h"
+#include "hitls_config.h"
+#include "tls_binlog_id.h"
+#include "tls_config.h"
+#include "crypt.h"
+#include "config.h"
+
+/* number of keys asked from the crypt callbacks at once, so that a batch implementation can share the work */
+#define KEY_SHARE_POOL_BATCH_NUM 16u
+
+typedef struct {
+    uint16_t group;
+    uint32_t head;                  /* position of the oldest key in keys */
+    uint32_t count;                 /* number of ready keys */
+    HITLS_CRYPT_Key **keys;         /* ring of keyNum entries */
+} KeySharePoolQueue;
+
+struct KeySharePoolInner {
+    BSL_SAL_ThreadLockHandle lock;  /* protects the queues and the refill thread state */
+    KeySharePoolQueue *queues;
+    uint32_t queueNum;
+    uint32_t keyNum;                /* capacity of each queue */
+    HITLS_CRYPT_Key **keys;         /* storage of all the rings */
+    BSL_SAL_ThreadId thread;        /* refill thread that has not been joined, NULL if there is none */
+    bool isStarting;                /* a refill thread is being created */
+    bool isDone;                    /* the refill thread has left its loop */
+    bool isStopping;                /* the pool is being released */
+};
+
+static uint32_t KeySharePoolSpace(CFG_KeySharePool *pool, uint32_t idx, bool *isStopping)
+{
+    (void)BSL_SAL_ThreadReadLock(pool->lock);
+    uint32_t space = pool->keyNum - pool->queues[idx].count;
+    *isStopping = pool->isStopping;
+    (void)BSL_SAL_ThreadUnlock(pool->lock);
+    return space;
+}
+
+static void KeySharePoolPush(CFG_KeySharePool *pool, uint32_t idx, HITLS_CRYPT_Key **keys, uint32_t num)
+{
+    KeySharePoolQueue *queue = &pool->queues[idx];
+    (void)BSL_SAL_ThreadWriteLock(pool->lock);
+    /* Only the refill thread adds keys, so the space seen before generating them is still free. */
+    for (uint32_t i = 0; i < num; i++) {
+        queue->keys[(queue->head + queue->count) % pool->keyNum] = keys[i];
+        queue->count++;
+    }
+    (void)BSL_SAL_ThreadUnlock(pool->lock);
+}
+
+/* Top every queue up to keyNum keys, one batch per group in turn, and exit once all of them are full. A group whose
+ * keys cannot be generated is skipped, the handshakes generate such keys themselves. */
+static void *KeySharePoolRefill(void *arg)
+{
+    CFG_KeySharePool *pool = (CFG_KeySharePool *)arg;
+    HITLS_CRYPT_Key *keys[KEY_SHARE_POOL_BATCH_NUM];
+    bool isFilled = false;
+    bool isStopping = false;
+    while (!isFilled && !isStopping) {
+        isFilled = true;
+        for (uint32_t i = 0; i < pool->queueNum; i++) {
+            uint32_t num = KeySharePoolSpace(pool, i, &isStopping);
+            if (isStopping) {
+                break;
+            }
+            if (num == 0) {
+                continue;
+            }
+            num = (num < KEY_SHARE_POOL_BATCH_NUM) ? num : KEY_SHARE_POOL_BATCH_NUM;
+            HITLS_ECParameters curveParams = {
+                .type = HITLS_EC_CURVE_TYPE_NAMED_CURVE,
+                .param.namedcurve = pool->queues[i].group,
+            };
+            if (SAL_CRYPT_GenEcdhKeyPairBatch(&curveParams, keys, num) != HITLS_SUCCESS) {
+                BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17335, BSL_LOG_LEVEL_WARN, BSL_LOG_BINLOG_TYPE_RUN,
+                    "key share pool refill of group %u failed.", pool->queues[i].group, 0, 0, 0);
+                continue;
+            }
+            KeySharePoolPush(pool, i, keys, num);
+            isFilled = false;
+        }
+    }
+    (void)BSL_SAL_ThreadWriteLock(pool->lock);
+    pool->isDone = true;
+    (void)BSL_SAL_ThreadUnlock(pool->lock);
+    return NULL;
+}
+
+/* Start a refill thread unless one is still running. The thread exits when the pool is full, so an idle server
+ * holds no thread; the finished one is joined when the next one starts or when the pool is released. */
+static int32_t KeySharePoolStartRefill(CFG_KeySharePool *pool)
+{
+    (void)BSL_SAL_ThreadWriteLock(pool->lock);
+    if (pool->isStopping || pool->isStarting || (pool->thread != NULL && !pool->isDone)) {
+        (void)BSL_SAL_ThreadUnlock(pool->lock);
+        return HITLS_SUCCESS;
+    }
+    BSL_SAL_ThreadId finished = pool->thread;
+    pool->thread = NULL;
+    pool->isStarting = true;
+    pool->isDone = false;
+    (void)BSL_SAL_ThreadUnlock(pool->lock);
+
+    if (finished != NULL) {
+        BSL_SAL_ThreadClose(finished); /* has left its loop already, the join does not wait */
+    }
+    BSL_SAL_ThreadId thread = NULL;
+    int32_t ret = BSL_SAL_ThreadCreate(&thread, KeySharePoolRefill, pool);
+
+    (void)BSL_SAL_ThreadWriteLock(pool->lock);
+    pool->isStarting = false;
+    if (ret == BSL_SUCCESS) {
+        pool->thread = thread;
+    } else {
+        pool->isDone = true;
+    }
+    (void)BSL_SAL_ThreadUnlock(pool->lock);
+    if (ret != BSL_SUCCESS) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17336, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "create key share pool refill thread fail.", 0, 0, 0, 0);
+    }
+    return ret;
+}
+
+static KeySharePoolQueue *KeySharePoolFind(const CFG_KeySharePool *pool, uint16_t group)
+{
+    for (uint32_t i = 0; i < pool->queueNum; i++) {
+        if (pool->queues[i].group == group) {
+            return &pool->queues[i];
+        }
+    }
+    return NULL;
+}
+
+HITLS_CRYPT_Key *CFG_KeySharePoolTake(CFG_KeySharePool *pool, uint16_t group)
+{
+    HITLS_CRYPT_Key *key = NULL;
+    if (pool == NULL) {
+        return NULL;
+    }
+    KeySharePoolQueue *queue = KeySharePoolFind(pool, group);
+    if (queue == NULL) {
+        return NULL;
+    }
+    (void)BSL_SAL_ThreadWriteLock(pool->lock);
+    if (queue->count > 0) {
+        key = queue->keys[queue->head];
+        queue->keys[queue->head] = NULL;
+        queue->head = (queue->head + 1) % pool->keyNum;
+        queue->count--;
+    }
+    /* refill once the queue has drained to half, so that a burst rarely finds it empty */
+    bool needRefill = queue->count <= pool->keyNum / 2;
+    (void)BSL_SAL_ThreadUnlock(pool->lock);
+    if (needRefill) {
+        (void)KeySharePoolStartRefill(pool);
+    }
+    return key;
+}
+
+void CFG_KeySharePoolFree(CFG_KeySharePool *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    (void)BSL_SAL_ThreadWriteLock(pool->lock);
+    pool->isStopping = true;
+    BSL_SAL_ThreadId thread = pool->thread;
+    pool->thread = NULL;
+    (void)BSL_SAL_ThreadUnlock(pool->lock);
+    if (thread != NULL) {
+        BSL_SAL_ThreadClose(thread); /* waits for the batch in progress at most */
+    }
+    for (uint32_t i = 0; i < pool->queueNum; i++) {
+        KeySharePoolQueue *queue = &pool->queues[i];
+        for (uint32_t j = 0; j < queue->count; j++) {
+            SAL_CRYPT_FreeEcdhKey(queue->keys[(queue->head + j) % pool->keyNum]);
+        }
+    }
+    BSL_SAL_FREE(pool->keys);
+    BSL_SAL_FREE(pool->queues);
+    BSL_SAL_ThreadLockFree(pool->lock);
+    BSL_SAL_Free(pool);
+}
+
+/* Generate the first key of every group in place. This rejects groups that cannot be generated before any thread
+ * is started for them. */
+static int32_t KeySharePoolPrime(CFG_KeySharePool *pool)
+{
+    for (uint32_t i = 0; i < pool->queueNum; i++) {
+        HITLS_ECParameters curveParams = {
+            .type = HITLS_EC_CURVE_TYPE_NAMED_CURVE,
+            .param.namedcurve = pool->queues[i].group,
+        };
+        HITLS_CRYPT_Key *key = SAL_CRYPT_GenEcdhKeyPair(&curveParams);
+        if (key == NULL) {
+            BSL_ERR_PUSH_ERROR(HITLS_CRYPT_ERR_ENCODE_ECDH_KEY);
+            BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17337, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+                "key share pool cannot generate key of group %u.", pool->queues[i].group, 0, 0, 0);
+            return HITLS_CRYPT_ERR_ENCODE_ECDH_KEY;
+        }
+        pool->queues[i].keys[0] = key;
+        pool->queues[i].count = 1;
+    }
+    return HITLS_SUCCESS;
+}
+
+static int32_t KeySharePoolNew(const uint16_t *groups, uint32_t groupsSize, uint32_t keyNum,
+    CFG_KeySharePool **pool)
+{
+    CFG_KeySharePool *newPool = BSL_SAL_Calloc(1u, sizeof(CFG_KeySharePool));
+    if (newPool == NULL) {
+        BSL_ERR_PUSH_ERROR(HITLS_MEMALLOC_FAIL);
+        return HITLS_MEMALLOC_FAIL;
+    }
+    int32_t ret = BSL_SAL_ThreadLockNew(&newPool->lock);
+    if (ret != BSL_SUCCESS) {
+        BSL_SAL_Free(newPool);
+        BSL_ERR_PUSH_ERROR(ret);
+        return ret;
+    }
+    newPool->queues = BSL_SAL_Calloc(groupsSize, sizeof(KeySharePoolQueue));
+    newPool->keys = BSL_SAL_Calloc(groupsSize * keyNum, sizeof(HITLS_CRYPT_Key *));
+    if (newPool->queues == NULL || newPool->keys == NULL) {
+        CFG_KeySharePoolFree(newPool);
+        BSL_ERR_PUSH_ERROR(HITLS_MEMALLOC_FAIL);
+        return HITLS_MEMALLOC_FAIL;
+    }
+    newPool->queueNum = groupsSize;
+    newPool->keyNum = keyNum;
+    for (uint32_t i = 0; i < groupsSize; i++) {
+        if (KeySharePoolFind(newPool, groups[i]) != NULL) {
+            CFG_KeySharePoolFree(newPool);
+            BSL_ERR_PUSH_ERROR(HITLS_CONFIG_INVALID_SET);
+            return HITLS_CONFIG_INVALID_SET;
+        }
+        newPool->queues[i].group = groups[i];
+        newPool->queues[i].keys = &newPool->keys[i * keyNum];
+    }
+    ret = KeySharePoolPrime(newPool);
+    if (ret == HITLS_SUCCESS) {
+        ret = KeySharePoolStartRefill(newPool);
+    }
+    if (ret != HITLS_SUCCESS) {
+        CFG_KeySharePoolFree(newPool);
+        return ret;
+    }
+    *pool = newPool;
+    return HITLS_SUCCESS;
+}
+
+int32_t HITLS_CFG_SetKeySharePool(HITLS_Config *config, const uint16_t *groups, uint32_t groupsSize, uint32_t keyNum)
+{
+    if (config == NULL || (groups == NULL && groupsSize != 0)) {
+        return HITLS_NULL_INPUT;
+    }
+    if (groupsSize > HITLS_CFG_MAX_SIZE || keyNum > HITLS_CFG_MAX_SIZE || (groupsSize != 0 && keyNum == 0)) {
+        return HITLS_CONFIG_INVALID_LENGTH;
+    }
+    CFG_KeySharePool *pool = NULL;
+    if (groupsSize != 0) {
+        int32_t ret = KeySharePoolNew(groups, groupsSize, keyNum, &pool);
+        if (ret != HITLS_SUCCESS) {
+            return ret;
+        }
+    }
+    CFG_KeySharePoolFree(config->keySharePool);
+    config->keySharePool = pool;
+    return HITLS_SUCCESS;
+}
+
+int32_t HITLS_CFG_GetKeySharePoolKeyNum(const HITLS_Config *config, uint16_t group, uint32_t *keyNum)
+{
+    if (config == NULL || keyNum == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    *keyNum = 0;
+    CFG_KeySharePool *pool = config->keySharePool;
+    if (pool == NULL) {
+        return HITLS_SUCCESS;
+    }
+    KeySharePoolQueue *queue = KeySharePoolFind(pool, group);
+    if (queue != NULL) {
+        (void)BSL_SAL_ThreadReadLock(pool->lock);
+        *keyNum = queue->count;
+        (void)BSL_SAL_ThreadUnlock(pool->lock);
+    }
+    return HITLS_SUCCESS;
+}
+#endif /* HITLS_TLS_FEATURE_KEY_SHARE_POOL */
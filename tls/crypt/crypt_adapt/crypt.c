@@ -70,6 +70,7 @@ const char *g_cryptCallBackStr[] = {
     [HITLS_CRYPT_CALLBACK_GET_ECDH_ENCODED_PUBKEY] = "get ecdh public key",
     [HITLS_CRYPT_CALLBACK_CALC_ECDH_SHARED_SECRET] = "calculate ecdh shared secret",
     [HITLS_CRYPT_CALLBACK_SM2_CALC_ECDH_SHARED_SECRET] = "calculate sm2 ecdh shared secret",
+    [HITLS_CRYPT_CALLBACK_GENERATE_ECDH_KEY_PAIR_BATCH] = "generate ecdh keys",
 
     [HITLS_CRYPT_CALLBACK_GENERATE_DH_KEY_BY_SECBITS] = "generate Dh key by secbits",
     [HITLS_CRYPT_CALLBACK_GENERATE_DH_KEY_BY_PARAMS] = "generate Dh key by params",
@@ -127,6 +128,7 @@ int32_t HITLS_CRYPT_RegisterEcdhMethod(HITLS_CRYPT_EcdhMethod *userCryptCallBack
 #ifdef HITLS_TLS_PROTO_TLCP11
     g_cryptEcdhMethod.sm2CalEcdhSharedSecret = userCryptCallBack->sm2CalEcdhSharedSecret;
 #endif /* HITLS_TLS_PROTO_TLCP11 */
+    g_cryptEcdhMethod.generateEcdhKeyPairBatch = userCryptCallBack->generateEcdhKeyPairBatch;
     return HITLS_SUCCESS;
 }
 
@@ -471,6 +473,38 @@ HITLS_CRYPT_Key *SAL_CRYPT_GenEcdhKeyPair(const HITLS_ECParameters *curveParams)
     return g_cryptEcdhMethod.generateEcdhKeyPair(curveParams);
 }
 
+int32_t SAL_CRYPT_GenEcdhKeyPairBatch(const HITLS_ECParameters *curveParams, HITLS_CRYPT_Key **keys, uint32_t num)
+{
+    uint32_t i;
+    if (keys == NULL || num == 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_NULL_INPUT);
+        return HITLS_NULL_INPUT;
+    }
+    if (g_cryptEcdhMethod.generateEcdhKeyPairBatch != NULL) {
+        int32_t ret = g_cryptEcdhMethod.generateEcdhKeyPairBatch(curveParams, keys, num);
+        return CheckCallBackRetVal(HITLS_CRYPT_CALLBACK_GENERATE_ECDH_KEY_PAIR_BATCH, ret, BINLOG_ID17333,
+            HITLS_CRYPT_ERR_ENCODE_ECDH_KEY);
+    }
+    for (i = 0; i < num; i++) {
+        keys[i] = g_cryptEcdhMethod.generateEcdhKeyPair(curveParams);
+        if (keys[i] == NULL) {
+            break;
+        }
+    }
+    if (i == num) {
+        return HITLS_SUCCESS;
+    }
+    while (i > 0) {
+        i--;
+        SAL_CRYPT_FreeEcdhKey(keys[i]);
+        keys[i] = NULL;
+    }
+    BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17334, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+        "generate ecdh keys error.", 0, 0, 0, 0);
+    BSL_ERR_PUSH_ERROR(HITLS_CRYPT_ERR_ENCODE_ECDH_KEY);
+    return HITLS_CRYPT_ERR_ENCODE_ECDH_KEY;
+}
+
 void SAL_CRYPT_FreeEcdhKey(HITLS_CRYPT_Key *key)
 {
     if (key != NULL) {
@@ -132,6 +132,10 @@ static uint32_t GetCipherAlgId(HITLS_CipherAlgo cipherAlgo)
             return CRYPT_CIPHER_AES256_CCM;
         case HITLS_CIPHER_SM4_CBC:
             return CRYPT_CIPHER_SM4_CBC;
+        case HITLS_CIPHER_SM4_GCM:
+            return CRYPT_CIPHER_SM4_GCM;
+        case HITLS_CIPHER_SM4_CCM:
+            return CRYPT_CIPHER_SM4_CCM;
         default:
             break;
     }
@@ -381,15 +385,11 @@ int32_t CRYPT_DEFAULT_Digest(HITLS_HashAlgo hashAlgo, const uint8_t *in, uint32_
         return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_DIGEST, BINLOG_ID16630, "GetMDAlgId fail");
     }
 
-    CRYPT_EAL_MdCTX *ctx = CRYPT_EAL_MdNewCtx(id);
+    // The one-shot digest keeps its context on the stack, the free below only wipes it.
+    CRYPT_EAL_MdCtxBuf buf;
+    CRYPT_EAL_MdCTX *ctx = CRYPT_EAL_MdInitCtxIn(&buf, id);
     if (ctx == NULL) {
-        return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_DIGEST, BINLOG_ID16631, "MdNewCtx fail");
-    }
-
-    ret = CRYPT_EAL_MdInit(ctx);
-    if (ret != CRYPT_SUCCESS) {
-        CRYPT_EAL_MdFreeCtx(ctx);
-        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16632, "MdInit fail");
+        return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_DIGEST, BINLOG_ID16631, "MdInitCtxIn fail");
     }
 
     ret = CRYPT_EAL_MdUpdate(ctx, in, inLen);
@@ -432,7 +432,8 @@ static int32_t SpecialModeEncryptPreSolve(CRYPT_EAL_CipherCtx *ctx, const HITLS_
     }
     // In the case of CCM processing, msgLen needs to be set.
     if ((cipher->algo == HITLS_CIPHER_AES_128_CCM) || (cipher->algo == HITLS_CIPHER_AES_128_CCM8) ||
-        (cipher->algo == HITLS_CIPHER_AES_256_CCM) || (cipher->algo == HITLS_CIPHER_AES_256_CCM8)) {
+        (cipher->algo == HITLS_CIPHER_AES_256_CCM) || (cipher->algo == HITLS_CIPHER_AES_256_CCM8) ||
+        (cipher->algo == HITLS_CIPHER_SM4_CCM)) {
         ret = CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_MSGLEN, &inLen, sizeof(inLen));
         if (ret != CRYPT_SUCCESS) {
             return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16636, "SET_MSGLEN fail");
@@ -635,7 +636,8 @@ static int32_t DEFAULT_DecryptPrepare(CRYPT_EAL_CipherCtx *ctx, const HITLS_Ciph
         }
     }
     if ((cipher->algo == HITLS_CIPHER_AES_128_CCM) || (cipher->algo == HITLS_CIPHER_AES_128_CCM8) ||
-        (cipher->algo == HITLS_CIPHER_AES_256_CCM) || (cipher->algo == HITLS_CIPHER_AES_256_CCM8)) {
+        (cipher->algo == HITLS_CIPHER_AES_256_CCM) || (cipher->algo == HITLS_CIPHER_AES_256_CCM8) ||
+        (cipher->algo == HITLS_CIPHER_SM4_CCM)) {
         // The length of the decrypted ciphertext consists of msgLen and tagLen, so tagLen needs to be subtracted.
         uint64_t msgLen = inLen - tagLen;
         ret = CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_MSGLEN, &msgLen, sizeof(msgLen));
@@ -716,7 +718,7 @@ CRYPT_EAL_PkeyCtx *GeneratePkeyByParaId(CRYPT_PKEY_AlgId algId, CRYPT_PKEY_ParaI
     }
 
     if (algId != CRYPT_PKEY_X25519
-#ifdef HITLS_TLS_PROTO_TLCP11
+#if defined(HITLS_TLS_PROTO_TLCP11) || defined(HITLS_TLS_SUITE_AUTH_SM2)
      && algId != CRYPT_PKEY_SM2
 #endif
      ) {
@@ -790,6 +792,58 @@ HITLS_CRYPT_Key *CRYPT_DEFAULT_GenerateEcdhKey(const HITLS_ECParameters *curvePa
     return NULL;
 }
 
+static void FreeKeys(HITLS_CRYPT_Key **keys, uint32_t num)
+{
+    for (uint32_t i = 0; i < num; i++) {
+        CRYPT_DEFAULT_FreeKey(keys[i]);
+        keys[i] = NULL;
+    }
+}
+
+#if defined(HITLS_CRYPTO_PKEY) && defined(HITLS_CRYPTO_X25519)
+static int32_t GenerateX25519KeyBatch(HITLS_CRYPT_Key **keys, uint32_t num)
+{
+    uint32_t i;
+    for (i = 0; i < num; i++) {
+        keys[i] = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_X25519);
+        if (keys[i] == NULL) {
+            BSL_LOG_BINLOG_FIXLEN(BINLOG_ID16658, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+                "PkeyNewCtx fail", 0, 0, 0, 0);
+            FreeKeys(keys, i);
+            return HITLS_CRYPT_ERR_ENCODE_ECDH_KEY;
+        }
+    }
+    /* The public keys are computed eight at a time on CPUs with AVX-512 IFMA */
+    int32_t ret = CRYPT_EAL_PkeyGenBatch((CRYPT_EAL_PkeyCtx *const *)keys, num);
+    if (ret != CRYPT_SUCCESS) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID16660, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN, "PkeyGen fail", 0, 0, 0, 0);
+        FreeKeys(keys, num);
+        return HITLS_CRYPT_ERR_ENCODE_ECDH_KEY;
+    }
+    return HITLS_SUCCESS;
+}
+#endif
+
+int32_t CRYPT_DEFAULT_GenerateEcdhKeyBatch(const HITLS_ECParameters *curveParams, HITLS_CRYPT_Key **keys,
+    uint32_t num)
+{
+    uint32_t i;
+#if defined(HITLS_CRYPTO_PKEY) && defined(HITLS_CRYPTO_X25519)
+    if (curveParams->type == HITLS_EC_CURVE_TYPE_NAMED_CURVE &&
+        curveParams->param.namedcurve == HITLS_EC_GROUP_CURVE25519) {
+        return GenerateX25519KeyBatch(keys, num);
+    }
+#endif
+    for (i = 0; i < num; i++) {
+        keys[i] = CRYPT_DEFAULT_GenerateEcdhKey(curveParams);
+        if (keys[i] == NULL) {
+            FreeKeys(keys, i);
+            return HITLS_CRYPT_ERR_ENCODE_ECDH_KEY;
+        }
+    }
+    return HITLS_SUCCESS;
+}
+
 #ifdef HITLS_TLS_CONFIG_MANUAL_DH
 HITLS_CRYPT_Key *CRYPT_DEFAULT_DupKey(HITLS_CRYPT_Key *key)
 {
@@ -1075,11 +1129,46 @@ Exit:
 }
 #endif /* HITLS_TLS_PROTO_TLCP11 */
 
+#if defined(HITLS_CRYPTO_PKEY) && defined(HITLS_TLS_SUITE_AUTH_SM2) && defined(HITLS_TLS_PROTO_TLS13)
+/* curveSM2 of TLS 1.3 is plain ECDHE on the SM2 curve (RFC 8998), not the SM2 key exchange of TLCP. */
+static CRYPT_EAL_PkeyCtx *Sm2KeyToEcdhKey(CRYPT_EAL_PkeyCtx *key)
+{
+    uint8_t prvData[SM2_PRVKEY_LEN] = {0};
+    CRYPT_EAL_PkeyPrv prv = { 0 };
+    prv.id = CRYPT_PKEY_SM2;
+    prv.key.eccPrv.data = prvData;
+    prv.key.eccPrv.len = sizeof(prvData);
+    if (CRYPT_EAL_PkeyGetPrv(key, &prv) != CRYPT_SUCCESS) {
+        return NULL;
+    }
+    CRYPT_EAL_PkeyCtx *ecdhKey = CRYPT_EAL_PkeyNewCtx(CRYPT_PKEY_ECDH);
+    prv.id = CRYPT_PKEY_ECDH;
+    if (ecdhKey != NULL && (CRYPT_EAL_PkeySetParaById(ecdhKey, CRYPT_ECC_SM2) != CRYPT_SUCCESS ||
+        CRYPT_EAL_PkeySetPrv(ecdhKey, &prv) != CRYPT_SUCCESS)) {
+        CRYPT_EAL_PkeyFreeCtx(ecdhKey);
+        ecdhKey = NULL;
+    }
+    (void)memset_s(prvData, sizeof(prvData), 0, sizeof(prvData));
+    return ecdhKey;
+}
+#endif
+
 int32_t CRYPT_DEFAULT_CalcSharedSecret(HITLS_CRYPT_Key *key, uint8_t *peerPubkey, uint32_t pubKeyLen,
     uint8_t *sharedSecret, uint32_t *sharedSecretLen)
 {
 #ifdef HITLS_CRYPTO_PKEY
     CRYPT_PKEY_AlgId id = CRYPT_EAL_PkeyGetId(key);
+#if defined(HITLS_TLS_SUITE_AUTH_SM2) && defined(HITLS_TLS_PROTO_TLS13)
+    if (id == CRYPT_PKEY_SM2) {
+        CRYPT_EAL_PkeyCtx *ecdhKey = Sm2KeyToEcdhKey(key);
+        if (ecdhKey == NULL) {
+            return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_CALC_SHARED_KEY, BINLOG_ID17338, "sm2 to ecdh fail");
+        }
+        int32_t ret = CRYPT_DEFAULT_CalcSharedSecret(ecdhKey, peerPubkey, pubKeyLen, sharedSecret, sharedSecretLen);
+        CRYPT_EAL_PkeyFreeCtx(ecdhKey);
+        return ret;
+    }
+#endif
 
     CRYPT_EAL_PkeyPub pub = {0};
     pub.id = id;
@@ -229,6 +229,19 @@ void CRYPT_DEFAULT_CipherFree(HITLS_Cipher_Ctx *ctx);
  */
 HITLS_CRYPT_Key *CRYPT_DEFAULT_GenerateEcdhKey(const HITLS_ECParameters *curveParams);
 
+/**
+ * @brief Generate num ECDH key pairs, X25519 keys are generated by CRYPT_EAL_PkeyGenBatch.
+ *
+ * @param curveParams [IN] ECDH parameter
+ * @param keys        [OUT] num key handles, all of them are NULL on failure
+ * @param num         [IN] Number of key pairs
+ *
+ * @retval HITLS_SUCCESS                    succeeded.
+ * @retval HITLS_CRYPT_ERR_ENCODE_ECDH_KEY  Failed to generate a key pair
+ */
+int32_t CRYPT_DEFAULT_GenerateEcdhKeyBatch(const HITLS_ECParameters *curveParams, HITLS_CRYPT_Key **keys,
+    uint32_t num);
+
 /**
  * @brief Generate a DH key pair.
  *
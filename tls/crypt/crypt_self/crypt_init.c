@@ -50,6 +50,7 @@ void HITLS_CryptMethodInit(void)
 #ifdef HITLS_TLS_PROTO_TLCP11
     ecdhMethod.sm2CalEcdhSharedSecret = CRYPT_DEFAULT_CalcSM2SharedSecret;
 #endif /* HITLS_TLS_PROTO_TLCP11 */
+    ecdhMethod.generateEcdhKeyPairBatch = CRYPT_DEFAULT_GenerateEcdhKeyBatch;
     HITLS_CRYPT_RegisterEcdhMethod(&ecdhMethod);
 
 #ifdef HITLS_TLS_SUITE_KX_DHE
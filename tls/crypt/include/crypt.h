@@ -60,6 +60,7 @@ enum HITLS_CryptoCallBack {
     HITLS_CRYPT_CALLBACK_GET_ECDH_ENCODED_PUBKEY,
     HITLS_CRYPT_CALLBACK_CALC_ECDH_SHARED_SECRET,
     HITLS_CRYPT_CALLBACK_SM2_CALC_ECDH_SHARED_SECRET,
+    HITLS_CRYPT_CALLBACK_GENERATE_ECDH_KEY_PAIR_BATCH,
 
     HITLS_CRYPT_CALLBACK_GENERATE_DH_KEY_BY_SECBITS,
     HITLS_CRYPT_CALLBACK_GENERATE_DH_KEY_BY_PARAMS,
@@ -302,6 +303,19 @@ void SAL_CRYPT_CipherFree(HITLS_Cipher_Ctx *ctx);
  */
 HITLS_CRYPT_Key *SAL_CRYPT_GenEcdhKeyPair(const HITLS_ECParameters *curveParams);
 
+/**
+ * @brief Generate num ECDH key pairs on the same curve, for instance to refill a queue of pending key shares.
+ *
+ * @param curveParams [IN] Elliptic curve parameter
+ * @param keys        [OUT] num key handles, all of them are NULL on failure
+ * @param num         [IN] Number of key pairs
+ *
+ * @retval HITLS_SUCCESS                    succeeded.
+ * @retval HITLS_NULL_INPUT                 keys is NULL or num is 0
+ * @retval HITLS_CRYPT_ERR_ENCODE_ECDH_KEY  Failed to generate a key pair
+ */
+int32_t SAL_CRYPT_GenEcdhKeyPairBatch(const HITLS_ECParameters *curveParams, HITLS_CRYPT_Key **keys, uint32_t num);
+
 /**
  * @brief Release the ECDH key.
  *
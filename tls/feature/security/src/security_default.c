@@ -76,7 +76,7 @@ static int32_t GetSigalgSecbits(HITLS_SignHashAlgo signScheme)
         case CERT_SIG_SCHEME_DSA_SHA256:
         case CERT_SIG_SCHEME_ECDSA_SECP256R1_SHA256:
         case CERT_SIG_SCHEME_ED25519:
-#ifdef HITLS_TLS_PROTO_TLCP11
+#if defined(HITLS_TLS_PROTO_TLCP11) || defined(HITLS_TLS_SUITE_AUTH_SM2)
         case CERT_SIG_SCHEME_SM2_SM3:
 #endif
             return HITLS_SECURITY_LEVEL_THREE_SECBITS;
@@ -53,6 +53,17 @@ KeyExchCtx *HS_KeyExchCtxNew(void);
  */
 void HS_KeyExchCtxFree(KeyExchCtx *keyExchCtx);
 
+/**
+ * @brief   Obtain the ephemeral key pair of the server. The key is taken from the key share pool of the global
+ *          configuration if the pool holds one for the curve, and generated otherwise.
+ *
+ * @param   ctx [IN] TLS context
+ * @param   curveParams [IN] Elliptic curve or group of the key
+ *
+ * @return  Key pair handle. If NULL is returned, the generation fails.
+ */
+HITLS_CRYPT_Key *HS_GetServerEphemeralKey(const TLS_Ctx *ctx, const HITLS_ECParameters *curveParams);
+
 /**
  * @brief   Process the server ECDHE key exchange message
  *
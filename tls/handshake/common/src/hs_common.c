@@ -234,7 +234,7 @@ static const HITLS_CurvePubLenInfo CURVE_PUB_LEN_INFO[] = {
     {HITLS_EC_GROUP_BRAINPOOLP384R1, 97u},
     {HITLS_EC_GROUP_BRAINPOOLP512R1, 129u}, /* Length of the elliptic curve brainpoolP512r1 public key */
     {HITLS_EC_GROUP_SECP521R1, 133u}, /* (66 * 2) + 1 elliptic curve SECP521R1 public key length */
-#ifdef HITLS_TLS_PROTO_TLCP11
+#if defined(HITLS_TLS_PROTO_TLCP11) || defined(HITLS_TLS_SUITE_AUTH_SM2)
     {HITLS_EC_GROUP_SM2, 65u},  /* (32 * 2) + 1 elliptic curve SM2 public key length */
 #endif
 #ifdef HITLS_TLS_PROTO_TLS13
@@ -738,6 +738,9 @@ static struct {
     {HITLS_EC_GROUP_SM2, HITLS_VERSION_TLCP11, HITLS_VERSION_TLCP11, 0, 0},
 #endif
 #ifdef HITLS_TLS_PROTO_TLS13
+#ifdef HITLS_TLS_SUITE_AUTH_SM2
+    {HITLS_EC_GROUP_SM2, HITLS_VERSION_TLS13, HITLS_VERSION_TLS13, 0, 0}, /* curveSM2, RFC 8998 */
+#endif
     {HITLS_FF_DHE_2048, HITLS_VERSION_TLS13, HITLS_VERSION_TLS13, 0, 0},
     {HITLS_FF_DHE_3072, HITLS_VERSION_TLS13, HITLS_VERSION_TLS13, 0, 0},
     {HITLS_FF_DHE_4096, HITLS_VERSION_TLS13, HITLS_VERSION_TLS13, 0, 0},
@@ -772,7 +775,6 @@ bool GroupConformToVersion(uint16_t version, uint16_t group)
                 version <= g_groupsConfomVersion[i].maxDtlsVersion) {
                 return true;
             }
-            break;
         }
     }
     return false;
@@ -27,6 +27,9 @@
 #include "crypt.h"
 #include "cert_method.h"
 #include "session.h"
+#ifdef HITLS_TLS_FEATURE_KEY_SHARE_POOL
+#include "config.h"
+#endif
 #ifdef HITLS_TLS_FEATURE_SECURITY
 #include "security.h"
 #endif
@@ -96,6 +99,21 @@ void HS_KeyExchCtxFree(KeyExchCtx *keyExchCtx)
     BSL_SAL_FREE(keyExchCtx);
     return;
 }
+
+HITLS_CRYPT_Key *HS_GetServerEphemeralKey(const TLS_Ctx *ctx, const HITLS_ECParameters *curveParams)
+{
+#ifdef HITLS_TLS_FEATURE_KEY_SHARE_POOL
+    if (ctx->globalConfig != NULL && curveParams->type == HITLS_EC_CURVE_TYPE_NAMED_CURVE) {
+        HITLS_CRYPT_Key *key = CFG_KeySharePoolTake(ctx->globalConfig->keySharePool, curveParams->param.namedcurve);
+        if (key != NULL) {
+            return key;
+        }
+    }
+#else
+    (void)ctx;
+#endif
+    return SAL_CRYPT_GenEcdhKeyPair(curveParams);
+}
 #ifdef HITLS_TLS_HOST_CLIENT
 #ifdef HITLS_TLS_SUITE_KX_ECDHE
 static bool NamedCurveSupport(HITLS_NamedGroup inNamedGroup, const TLS_Config *config)
@@ -41,7 +41,10 @@ static HITLS_SignHashAlgo g_tls13AllowSignHashAlgo[] = {
     CERT_SIG_SCHEME_ED448,
     CERT_SIG_SCHEME_RSA_PSS_PSS_SHA256,
     CERT_SIG_SCHEME_RSA_PSS_PSS_SHA384,
-    CERT_SIG_SCHEME_RSA_PSS_PSS_SHA512
+    CERT_SIG_SCHEME_RSA_PSS_PSS_SHA512,
+#ifdef HITLS_TLS_SUITE_AUTH_SM2
+    CERT_SIG_SCHEME_SM2_SM3, /* rfc8998 section 3.2.1 */
+#endif
 };
 #endif /* HITLS_TLS_PROTO_TLS13 */
 static int32_t CheckSignHashAlg(TLS_Ctx *ctx, uint16_t signHashAlg)
@@ -213,7 +213,7 @@ static int32_t Tls13ServerPrepareKeyShare(TLS_Ctx *ctx)
     };
     HITLS_CRYPT_Key *key = NULL;
      /* The ecdhe and dhe groups can invoke the same interface to generate keys. */
-    key = SAL_CRYPT_GenEcdhKeyPair(&curveParams);
+    key = HS_GetServerEphemeralKey(ctx, &curveParams);
     if (key == NULL) {
         BSL_ERR_PUSH_ERROR(HITLS_CRYPT_ERR_ENCODE_ECDH_KEY);
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15552, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
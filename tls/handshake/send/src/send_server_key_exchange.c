@@ -29,6 +29,7 @@
 #include "cert_method.h"
 #include "hs_ctx.h"
 #include "hs_common.h"
+#include "hs_kx.h"
 #include "pack.h"
 #include "send_process.h"
 #if defined(HITLS_TLS_PROTO_TLS_BASIC) || defined(HITLS_TLS_PROTO_DTLS12)
@@ -192,7 +193,7 @@ static int32_t PackExchMsgPrepare(TLS_Ctx *ctx)
 #ifdef HITLS_TLS_SUITE_KX_ECDHE
         case HITLS_KEY_EXCH_ECDHE: /* TLCP is included here. */
         case HITLS_KEY_EXCH_ECDHE_PSK:
-            key = SAL_CRYPT_GenEcdhKeyPair(&ctx->hsCtx->kxCtx->keyExchParam.ecdh.curveParams);
+            key = HS_GetServerEphemeralKey(ctx, &ctx->hsCtx->kxCtx->keyExchParam.ecdh.curveParams);
             if (key == NULL) {
                 BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15746, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
                     "server generate ecdhe key pair error.", 0, 0, 0, 0);
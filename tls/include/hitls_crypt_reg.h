@@ -51,6 +51,19 @@ typedef int32_t (*CRYPT_RandBytesCallback)(uint8_t *buf, uint32_t len);
  */
 typedef HITLS_CRYPT_Key *(*CRYPT_GenerateEcdhKeyPairCallback)(const HITLS_ECParameters *curveParams);
 
+/**
+ * @ingroup hitls_crypt_reg
+ * @brief   ECDH: Generate num key pairs on the same elliptic curve parameters at once.
+ *
+ * @param   curveParams [IN] Elliptic curve parameter
+ * @param   keys [OUT] num key handles, all of them are NULL on failure
+ * @param   num [IN] Number of key pairs
+ *
+ * @retval  0 indicates success. Other values indicate failure.
+ */
+typedef int32_t (*CRYPT_GenerateEcdhKeyPairBatchCallback)(const HITLS_ECParameters *curveParams,
+    HITLS_CRYPT_Key **keys, uint32_t num);
+
 /**
  * @ingroup hitls_crypt_reg
  * @brief   Release the key.
@@ -457,6 +470,9 @@ typedef struct {
     CRYPT_CalcEcdhSharedSecretCallback calcEcdhSharedSecret;    /**< ECDH: calculate the shared key based on
                                                                            the local key and peer public key. */
     CRYPT_Sm2CalcEcdhSharedSecretCallback sm2CalEcdhSharedSecret;
+    CRYPT_GenerateEcdhKeyPairBatchCallback generateEcdhKeyPairBatch;  /**< ECDH: generate several key pairs at once,
+                                                                           optional, NULL generates them one by one
+                                                                           with generateEcdhKeyPair. */
 } HITLS_CRYPT_EcdhMethod;
 
 /**
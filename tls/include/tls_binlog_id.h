@@ -496,7 +496,9 @@ enum TLS_BINLOG_ID {
     BINLOG_ID17311, BINLOG_ID17312, BINLOG_ID17313, BINLOG_ID17314, BINLOG_ID17315,
     BINLOG_ID17316, BINLOG_ID17317, BINLOG_ID17318, BINLOG_ID17319, BINLOG_ID17320,
     BINLOG_ID17321, BINLOG_ID17322, BINLOG_ID17323, BINLOG_ID17324, BINLOG_ID17325,
-    BINLOG_ID17326, BINLOG_ID17327
+    BINLOG_ID17326, BINLOG_ID17327, BINLOG_ID17328, BINLOG_ID17329, BINLOG_ID17330,
+    BINLOG_ID17331, BINLOG_ID17332, BINLOG_ID17333, BINLOG_ID17334, BINLOG_ID17335,
+    BINLOG_ID17336, BINLOG_ID17337, BINLOG_ID17338, BINLOG_ID17339
 };
 
 #ifdef HITLS_BSL_LOG
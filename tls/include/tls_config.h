@@ -42,6 +42,12 @@ typedef struct CertMgrCtxInner CERT_MgrCtx;
 
 typedef struct TlsSessionManager TLS_SessionMgr;
 
+/**
+ * @ingroup config
+ * @brief   Pregenerated ephemeral keys of the server, see HITLS_CFG_SetKeySharePool
+ */
+typedef struct KeySharePoolInner CFG_KeySharePool;
+
 /**
 * @ingroup  config
 * @brief    DTLS 1.0
@@ -105,6 +111,7 @@ typedef struct TlsConfig {
 
     HITLS_CRYPT_Key *dhTmp;             /* Temporary DH key set by the user */
     HITLS_DhTmpCb dhTmpCb;              /* Temporary ECDH key set by the user */
+    CFG_KeySharePool *keySharePool;     /* pregenerated ephemeral keys, only held by the global configuration */
 
     HITLS_InfoCb infoCb;                /* information indicator callback */
     HITLS_MsgCb msgCb;                  /* message callback function cb for observing all SSL/TLS protocol messages */
@@ -149,6 +156,7 @@ typedef struct TlsConfig {
     bool isQuietShutdown;               /* is support the quiet shutdown mode */
     bool isEncryptThenMac;              /* is EncryptThenMac on */
     bool isFlightTransmitEnable;        /* sending of handshake information in one flighttransmit */
+    bool isKtlsEnable;                  /* offload the record protection to kernel TLS after the handshake */
 
     bool isSupportExtendMasterSecret;   /* is support extended master secret */
     bool isSupportSessionTicket;        /* is support session ticket */
@@ -318,6 +318,45 @@ bool REC_HaveReadSuiteInfo(const TLS_Ctx *ctx);
  * @return Length of the remaining readable app message
  */
 uint32_t APP_GetReadPendingBytes(const TLS_Ctx *ctx);
+
+#ifdef HITLS_TLS_FEATURE_KTLS
+/**
+ * @ingroup record
+ * @brief   Hand the record protection of the established connection over to the kernel TLS module.
+ *
+ * Each direction is offloaded independently. A direction that can not be offloaded keeps the user space record layer,
+ * so a failure of this function does not affect the connection.
+ *
+ * @param   ctx [IN] TLS object
+ *
+ * @retval  HITLS_SUCCESS At least one direction is offloaded
+ * @retval  HITLS_REC_ERR_KTLS_NOT_SUPPORT Nothing is offloaded
+ */
+int32_t REC_KtlsEnable(TLS_Ctx *ctx);
+
+/**
+ * @ingroup record
+ * @brief   Obtain the offloaded directions, combination of HITLS_KTLS_TX and HITLS_KTLS_RX
+ */
+uint8_t REC_KtlsGetState(const TLS_Ctx *ctx);
+
+/**
+ * @ingroup record
+ * @brief   Send file content as application data records encrypted by the kernel
+ *
+ * @param   ctx [IN] TLS object
+ * @param   fd [IN] File descriptor of the content
+ * @param   offset [IN] Offset in the file
+ * @param   len [IN] Number of bytes to be sent
+ * @param   sentLen [OUT] Number of bytes actually sent
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_REC_NORMAL_IO_BUSY The socket is busy
+ * @retval  HITLS_REC_ERR_KTLS_NOT_SUPPORT The transmit direction is not offloaded
+ * @retval  HITLS_REC_ERR_IO_EXCEPTION I/O error
+ */
+int32_t REC_KtlsSendFile(TLS_Ctx *ctx, int32_t fd, int64_t offset, uint32_t len, uint32_t *sentLen);
+#endif /* HITLS_TLS_FEATURE_KTLS */
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,306 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#include "hitls_build.h"
+#ifdef HITLS_TLS_FEATURE_KTLS
+#include "securec.h"
+#include "bsl_sal.h"
+#include "bsl_uio.h"
+#include "tls_binlog_id.h"
+#include "bsl_log_internal.h"
+#include "bsl_log.h"
+#include "bsl_err_internal.h"
+#include "hitls.h"
+#include "hitls_error.h"
+#include "rec.h"
+#include "rec_read.h"
+#include "rec_write.h"
+#include "record.h"
+
+static BSL_UIO *KtlsGetReadUio(const TLS_Ctx *ctx)
+{
+#ifdef HITLS_TLS_FEATURE_FLIGHT
+    return ctx->rUio;
+#else
+    return ctx->uio;
+#endif
+}
+
+static bool KtlsIsTcpUio(const BSL_UIO *uio)
+{
+    return (uio != NULL) && (BSL_UIO_GetTransportType(uio) == BSL_UIO_TCP);
+}
+
+static int32_t KtlsGetCipher(HITLS_CipherAlgo cipherAlg, uint8_t *cipher)
+{
+    switch (cipherAlg) {
+        case HITLS_CIPHER_AES_128_GCM:
+            *cipher = BSL_UIO_KTLS_AES_128_GCM;
+            return HITLS_SUCCESS;
+        case HITLS_CIPHER_AES_256_GCM:
+            *cipher = BSL_UIO_KTLS_AES_256_GCM;
+            return HITLS_SUCCESS;
+        case HITLS_CIPHER_CHACHA20_POLY1305:
+            *cipher = BSL_UIO_KTLS_CHACHA20_POLY1305;
+            return HITLS_SUCCESS;
+        default:
+            return HITLS_REC_ERR_KTLS_NOT_SUPPORT;
+    }
+}
+
+/* Transfer the keys and the sequence number of the current state of one direction to the kernel */
+static int32_t KtlsPushState(TLS_Ctx *ctx, bool isOut)
+{
+    RecCtx *recordCtx = ctx->recCtx;
+    const RecConnState *state = isOut ? recordCtx->writeStates.currentState : recordCtx->readStates.currentState;
+    if (state == NULL || state->suiteInfo == NULL || state->suiteInfo->cipherType != HITLS_AEAD_CIPHER) {
+        return HITLS_REC_ERR_KTLS_NOT_SUPPORT;
+    }
+    const RecConnSuitInfo *suiteInfo = state->suiteInfo;
+    BSL_UIO_KtlsCryptoInfo info = {0};
+    int32_t ret = KtlsGetCipher(suiteInfo->cipherAlg, &info.cipher);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    info.version = ctx->negotiatedInfo.version;
+    info.key = suiteInfo->key;
+    info.keyLen = suiteInfo->encKeyLen;
+    info.iv = suiteInfo->iv;
+    info.ivLen = suiteInfo->fixedIvLength;
+    info.seq = state->seq;
+
+    BSL_UIO *uio = isOut ? ctx->uio : KtlsGetReadUio(ctx);
+    ret = BSL_UIO_Ctrl(uio, isOut ? BSL_UIO_TCP_KTLS_ENABLE_TX : BSL_UIO_TCP_KTLS_ENABLE_RX,
+        (int32_t)sizeof(info), &info);
+    if (ret != BSL_SUCCESS) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17328, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record: kernel TLS is unavailable, out %u, ret %d.", isOut, ret, 0, 0);
+        return HITLS_REC_ERR_KTLS_NOT_SUPPORT;
+    }
+    return HITLS_SUCCESS;
+}
+
+static int32_t KtlsSetRecordType(BSL_UIO *uio, REC_Type recordType)
+{
+    uint8_t type = (uint8_t)recordType;
+    int32_t ret = BSL_UIO_Ctrl(uio, BSL_UIO_TCP_KTLS_SET_RECORD_TYPE, (int32_t)sizeof(type), &type);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_IO_EXCEPTION);
+        return HITLS_REC_ERR_IO_EXCEPTION;
+    }
+    return HITLS_SUCCESS;
+}
+
+/* The kernel builds and encrypts the records, the plaintext is written to the socket directly */
+static int32_t KtlsRecordWrite(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data, uint32_t num)
+{
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_NOTHING;
+#endif
+    if (num > REC_MAX_PLAIN_TEXT_LENGTH) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17329, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record wrtie: plain length is too long.", 0, 0, 0, 0);
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_TOO_BIG_LENGTH);
+        return HITLS_REC_ERR_TOO_BIG_LENGTH;
+    }
+    RecCtx *recordCtx = ctx->recCtx;
+    RecBuf *writeBuf = recordCtx->outBuf;
+    /* Check whether the cache exists, the caller retries with the same data until it is sent */
+    if (writeBuf->end > writeBuf->start) {
+        int32_t ret = KtlsSetRecordType(ctx->uio, recordCtx->ktlsPendingType);
+        if (ret != HITLS_SUCCESS) {
+            return ret;
+        }
+        return StreamWrite(ctx, writeBuf);
+    }
+    if (num == 0) {
+        return HITLS_SUCCESS;
+    }
+    int32_t ret = KtlsSetRecordType(ctx->uio, recordType);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_WRITING;
+#endif
+    uint32_t sendLen = 0;
+    ret = BSL_UIO_Write(ctx->uio, data, num, &sendLen);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_IO_EXCEPTION);
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17330, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record send: IO exception. %d\n", ret, 0, 0, 0);
+        return HITLS_REC_ERR_IO_EXCEPTION;
+    }
+    if (sendLen == num) {
+#ifdef HITLS_TLS_CONFIG_STATE
+        ctx->rwstate = HITLS_NOTHING;
+#endif
+        return HITLS_SUCCESS;
+    }
+    /* The kernel accepted part of the plaintext, keep the rest so that the retry of the caller completes it */
+    if (memcpy_s(writeBuf->buf, writeBuf->bufSize, data + sendLen, num - sendLen) != EOK) {
+        BSL_ERR_PUSH_ERROR(HITLS_MEMCPY_FAIL);
+        return HITLS_MEMCPY_FAIL;
+    }
+    writeBuf->start = 0;
+    writeBuf->end = num - sendLen;
+    recordCtx->ktlsPendingType = recordType;
+    return HITLS_REC_NORMAL_IO_BUSY;
+}
+
+/* The kernel verifies and decrypts the records, the type of the plaintext is obtained from the UIO */
+static int32_t KtlsRecordRead(TLS_Ctx *ctx, REC_Type recordType, uint8_t *data, uint32_t *readLen, uint32_t num)
+{
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_NOTHING;
+#endif
+    bool isPeek = (ctx->peekFlag != 0 && recordType == REC_TYPE_APP);
+    RecBufList *bufList = (recordType == REC_TYPE_HANDSHAKE) ? ctx->recCtx->hsRecList : ctx->recCtx->appRecList;
+    if (!RecBufListEmpty(bufList)) {
+        return RecBufListGetBuffer(bufList, data, num, readLen, isPeek);
+    }
+    if (ctx->peekFlag != 0 && recordType != REC_TYPE_APP) {
+        BSL_ERR_PUSH_ERROR(HITLS_INTERNAL_EXCEPTION);
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17331, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Peek mode applies only if record type is application.", 0, 0, 0, 0);
+        return HITLS_INTERNAL_EXCEPTION;
+    }
+    /*
+     * The type of a record is known only after the kernel returned it, and a record is truncated to the buffer it is
+     * read into. Read in place only if the caller expects application data, can take a whole record and nothing has
+     * to survive the call. Otherwise read into inBuf, so that a pending NewSessionTicket or KeyUpdate is not cut to
+     * the size of the caller buffer.
+     */
+    bool inPlace = !isPeek && recordType == REC_TYPE_APP && num >= REC_MAX_PLAIN_LENGTH;
+    RecBuf readBuf = {0};
+    readBuf.buf = inPlace ? data : ctx->recCtx->inBuf->buf;
+    readBuf.bufSize = inPlace ? num : ctx->recCtx->inBuf->bufSize;
+    BSL_UIO *uio = KtlsGetReadUio(ctx);
+    uint32_t recvLen = 0;
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_READING;
+#endif
+    int32_t ret = BSL_UIO_Read(uio, readBuf.buf, readBuf.bufSize, &recvLen);
+    if (ret != BSL_SUCCESS) {
+        if (ret == BSL_UIO_IO_EOF) {
+            return HITLS_REC_NORMAL_IO_EOF;
+        }
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17332, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Fail to call BSL_UIO_Read in KtlsRecordRead: [%d]", ret, 0, 0, 0);
+        return HITLS_REC_ERR_IO_EXCEPTION;
+    }
+    if (recvLen == 0) {
+        return HITLS_REC_NORMAL_RECV_BUF_EMPTY;
+    }
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_NOTHING;
+#endif
+    uint8_t type = REC_TYPE_APP;
+    (void)BSL_UIO_Ctrl(uio, BSL_UIO_TCP_KTLS_GET_RECORD_TYPE, (int32_t)sizeof(type), &type);
+    readBuf.bufSize = recvLen;
+    readBuf.end = recvLen;
+    RecClearAlertCount(ctx, (REC_Type)type);
+    if (type != recordType) {
+        return RecordUnexpectedMsg(ctx, &readBuf, (REC_Type)type);
+    }
+    if (readBuf.buf == data) {
+        *readLen = recvLen;
+        return HITLS_SUCCESS;
+    }
+    ret = RecBufListAddBuffer(bufList, &readBuf);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    ret = RecDerefBufList(ctx);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    return RecBufListGetBuffer(bufList, data, num, readLen, isPeek);
+}
+
+int32_t REC_KtlsEnable(TLS_Ctx *ctx)
+{
+    RecCtx *recordCtx = ctx->recCtx;
+    uint16_t version = ctx->negotiatedInfo.version;
+    if (version != HITLS_VERSION_TLS12 && version != HITLS_VERSION_TLS13) {
+        return HITLS_REC_ERR_KTLS_NOT_SUPPORT;
+    }
+    /* The kernel does not pad TLS1.3 records, and a pending ciphertext must leave through the old path */
+    bool canTx = KtlsIsTcpUio(ctx->uio) && (recordCtx->outBuf->end == recordCtx->outBuf->start) &&
+        (ctx->config.tlsConfig.recordPaddingCb == NULL);
+    if ((recordCtx->ktlsState & HITLS_KTLS_TX) == 0 && canTx && KtlsPushState(ctx, true) == HITLS_SUCCESS) {
+        recordCtx->ktlsState |= HITLS_KTLS_TX;
+        recordCtx->recWrite = KtlsRecordWrite;
+    }
+    /* Records already read ahead into inBuf have been encrypted with the keys known only to the user space */
+    bool canRx = KtlsIsTcpUio(KtlsGetReadUio(ctx)) && !REC_ReadHasPending(ctx);
+    if ((recordCtx->ktlsState & HITLS_KTLS_RX) == 0 && canRx && KtlsPushState(ctx, false) == HITLS_SUCCESS) {
+        recordCtx->ktlsState |= HITLS_KTLS_RX;
+        recordCtx->recRead = KtlsRecordRead;
+    }
+    return (recordCtx->ktlsState != 0) ? HITLS_SUCCESS : HITLS_REC_ERR_KTLS_NOT_SUPPORT;
+}
+
+uint8_t REC_KtlsGetState(const TLS_Ctx *ctx)
+{
+    return (ctx->recCtx == NULL) ? 0 : ctx->recCtx->ktlsState;
+}
+
+int32_t RecKtlsUpdateKey(TLS_Ctx *ctx, bool isOut)
+{
+    uint8_t direction = isOut ? HITLS_KTLS_TX : HITLS_KTLS_RX;
+    if ((ctx->recCtx->ktlsState & direction) == 0) {
+        return HITLS_SUCCESS;
+    }
+    /* Only the TLS1.3 KeyUpdate can be followed by the kernel. TLS1.2 renegotiation changes the cipher suite. */
+    if (ctx->negotiatedInfo.version != HITLS_VERSION_TLS13) {
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_KTLS_NOT_SUPPORT);
+        return HITLS_REC_ERR_KTLS_NOT_SUPPORT;
+    }
+    int32_t ret = KtlsPushState(ctx, isOut);
+    if (ret != HITLS_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+    }
+    return ret;
+}
+
+int32_t REC_KtlsSendFile(TLS_Ctx *ctx, int32_t fd, int64_t offset, uint32_t len, uint32_t *sentLen)
+{
+    RecCtx *recordCtx = ctx->recCtx;
+    if ((recordCtx->ktlsState & HITLS_KTLS_TX) == 0) {
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_KTLS_NOT_SUPPORT);
+        return HITLS_REC_ERR_KTLS_NOT_SUPPORT;
+    }
+    /* The remaining plaintext of a previous write goes first to keep the stream in order */
+    int32_t ret = KtlsRecordWrite(ctx, REC_TYPE_APP, NULL, 0);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    ret = KtlsSetRecordType(ctx->uio, REC_TYPE_APP);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    BSL_UIO_KtlsSendFileParam param = { .fd = fd, .offset = offset, .len = len, .sentLen = 0 };
+    ret = BSL_UIO_Ctrl(ctx->uio, BSL_UIO_TCP_KTLS_SENDFILE, (int32_t)sizeof(param), &param);
+    if (ret != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_IO_EXCEPTION);
+        return HITLS_REC_ERR_IO_EXCEPTION;
+    }
+    *sentLen = param.sentLen;
+    uint32_t isRetry = 0;
+    (void)BSL_UIO_TestFlags(ctx->uio, BSL_UIO_FLAGS_SHOULD_RETRY, &isRetry);
+    return (param.sentLen == 0 && isRetry != 0) ? HITLS_REC_NORMAL_IO_BUSY : HITLS_SUCCESS;
+}
+#endif /* HITLS_TLS_FEATURE_KTLS */
@@ -211,7 +211,7 @@ exit:
     return ret;
 }
 
-static int32_t RecordUnexpectedMsg(TLS_Ctx *ctx, RecBuf *decryptBuf, REC_Type recordType)
+int32_t RecordUnexpectedMsg(TLS_Ctx *ctx, RecBuf *decryptBuf, REC_Type recordType)
 {
     int32_t ret = HITLS_REC_NORMAL_RECV_UNEXPECT_MSG;
     ctx->recCtx->unexpectedMsgType = recordType;
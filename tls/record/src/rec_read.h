@@ -77,6 +77,18 @@ int32_t TlsRecordRead(TLS_Ctx *ctx, REC_Type recordType, uint8_t *data, uint32_t
  */
 int32_t StreamRead(TLS_Ctx *ctx, RecBuf *inBuf, uint32_t len);
 
+/**
+ * @brief   Cache a record of a type other than the requested one, or hand it to the unexpected message callback
+ *
+ * @param   ctx [IN] TLS context
+ * @param   decryptBuf [IN] Plaintext of the record
+ * @param   recordType [IN] Type of the record
+ *
+ * @retval  HITLS_REC_NORMAL_RECV_UNEXPECT_MSG The record is cached
+ * @retval  For other error codes, see unexpectedMsgProcessCb
+ */
+int32_t RecordUnexpectedMsg(TLS_Ctx *ctx, RecBuf *decryptBuf, REC_Type recordType);
+
 #ifdef __cplusplus
 }
 #endif
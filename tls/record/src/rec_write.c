@@ -58,7 +58,8 @@ static int32_t CheckEncryptionLimits(TLS_Ctx *ctx, RecConnState *state)
         ctx->isKeyUpdateRequest == false &&
 #endif
         (state->suiteInfo->cipherAlg == HITLS_CIPHER_AES_128_GCM ||
-        state->suiteInfo->cipherAlg == HITLS_CIPHER_AES_256_GCM) &&
+        state->suiteInfo->cipherAlg == HITLS_CIPHER_AES_256_GCM ||
+        state->suiteInfo->cipherAlg == HITLS_CIPHER_SM4_GCM) &&
         RecConnGetSeqNum(state) > REC_MAX_AES_GCM_ENCRYPTION_LIMIT) {
         BSL_ERR_PUSH_ERROR(HITLS_REC_ENCRYPTED_NUMBER_OVERFLOW);
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID16188, BSL_LOG_LEVEL_WARN, BSL_LOG_BINLOG_TYPE_RUN,
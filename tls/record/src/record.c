@@ -448,7 +448,11 @@ int32_t REC_ActivePendingState(TLS_Ctx *ctx, bool isOut)
 
     BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15544, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
         "Record: active pending state.", 0, 0, 0, 0);
+#ifdef HITLS_TLS_FEATURE_KTLS
+    return RecKtlsUpdateKey(ctx, isOut);
+#else
     return HITLS_SUCCESS;
+#endif
 }
 
 int32_t REC_GetMaxWriteSize(const TLS_Ctx *ctx, uint32_t *len)
@@ -77,6 +77,10 @@ typedef struct RecCtx {
     REC_Type unexpectedMsgType;
     uint32_t pendingDataSize;               /* Data length */
     const uint8_t *pendingData;             /* Plain Data content */
+#ifdef HITLS_TLS_FEATURE_KTLS
+    uint8_t ktlsState;                      /* Directions offloaded to kernel TLS, HITLS_KTLS_TX | HITLS_KTLS_RX */
+    REC_Type ktlsPendingType;               /* Record type of the plaintext left in outBuf by a partial write */
+#endif
 } RecCtx;
 
 
@@ -95,6 +99,19 @@ int32_t RecDerefBufList(TLS_Ctx *ctx);
 
 void RecClearAlertCount(TLS_Ctx *ctx, REC_Type recordType);
 
+#ifdef HITLS_TLS_FEATURE_KTLS
+/**
+ * @brief   Push the keys of the activated state to the kernel if the direction is offloaded
+ *
+ * @param   ctx [IN] TLS_Ctx context
+ * @param   isOut [IN] is write direction
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_REC_ERR_KTLS_NOT_SUPPORT The kernel can not switch to the new keys
+ */
+int32_t RecKtlsUpdateKey(TLS_Ctx *ctx, bool isOut);
+#endif
+
 #ifdef __cplusplus
 }
 #endif